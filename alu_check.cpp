@@ -0,0 +1,322 @@
+// Exhaustive verification of the ALU in vixen.v against cpu.c.
+//
+// Every ALU operation is applied to every pair of 16-bit operands, once
+// through a Verilator model of vixen.v and once through execute() in
+// cpu.c, and the resulting register value and NZCV flags are compared.
+//
+// The RTL model is used as a combinational ALU slice: the register file,
+// flags and instruction (din) are written directly, and eval() settles the
+// decode and ALU logic without clocking the state machine. The outputs
+// are then taken from alu_out/alu_c/alu_n/alu_z/alu_v and the alu_wr_*
+// enables, which is exactly what the EXECUTE state would commit.
+//
+// Register forms (e.g. "lsl r1, r2") take a from r1 and b from r2, so have
+// 2^32 operand pairs. Immediate forms (e.g. "lsl r1, #n") take b from the
+// instruction, so have only 2^16 * 16 or 2^16 * 256. Operations which read
+// the carry flag (adc, sbc, rsc, rrx) are run for both values of carry in;
+// for the others the incoming flags are varied with the operands, so that
+// flags which should be left untouched are checked too.
+//
+// The work is split into chunks of 256 values of a, which are handed out
+// to worker threads, each with its own RTL model and cpu.
+//
+// Build with "make alu_check".
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "Vvixen.h"
+#include "Vvixen___024root.h"
+#include "verilated.h"
+
+#include "cpu.h"
+
+enum {
+    OPND_REG,       // b is r2
+    OPND_NUM4,      // b is a 4 bit field at [7:4]
+    OPND_NUM8       // b is the 9 bit signed field of add/sub #num8
+};
+
+typedef struct
+{
+    const char *name;
+    u16 op;             // with dst=r1, src=r2, and a zero immediate
+    int operand;
+    bool uses_carry;
+} alu_op;
+
+static const alu_op alu_ops[] = {
+    {"mov",     0x0021, OPND_REG,  0},
+    {"mvn",     0x0121, OPND_REG,  0},
+    {"adc",     0x0221, OPND_REG,  1},
+    {"sbc",     0x0321, OPND_REG,  1},
+    {"add",     0x0421, OPND_REG,  0},
+    {"sub",     0x0521, OPND_REG,  0},
+    {"rsc",     0x0621, OPND_REG,  1},
+    {"rsb",     0x0721, OPND_REG,  0},
+    {"clz",     0x0821, OPND_REG,  0},
+    {"mul",     0x0a21, OPND_REG,  0},
+    {"muh",     0x0b21, OPND_REG,  0},
+    {"and",     0x0c21, OPND_REG,  0},
+    {"cmp",     0x0d21, OPND_REG,  0},
+    {"cmn",     0x0e21, OPND_REG,  0},
+    {"ror",     0x1021, OPND_REG,  0},
+    {"lsl",     0x1121, OPND_REG,  0},
+    {"lsr",     0x1221, OPND_REG,  0},
+    {"asr",     0x1321, OPND_REG,  0},
+    {"orr",     0x1421, OPND_REG,  0},
+    {"eor",     0x1521, OPND_REG,  0},
+    {"bic",     0x1621, OPND_REG,  0},
+    {"tst",     0x1721, OPND_REG,  0},
+    {"ror#",    0x1801, OPND_NUM4, 1},     // includes rrx when num4=0
+    {"lsl#",    0x1901, OPND_NUM4, 0},
+    {"lsr#",    0x1a01, OPND_NUM4, 0},
+    {"asr#",    0x1b01, OPND_NUM4, 0},
+    {"orr#bit", 0x1c01, OPND_NUM4, 0},
+    {"eor#bit", 0x1d01, OPND_NUM4, 0},
+    {"bic#bit", 0x1e01, OPND_NUM4, 0},
+    {"tst#bit", 0x1f01, OPND_NUM4, 0},
+    {"add#",    0x2001, OPND_NUM8, 0},     // sub # is the negative half
+};
+
+static const int num_ops = sizeof(alu_ops) / sizeof(alu_ops[0]);
+
+static const int chunk_bits = 8;                      // values of a per chunk
+static const int chunks_per_op = 1 << (16 - chunk_bits);
+
+static const int max_reported = 8;                    // mismatches printed per op
+
+typedef struct
+{
+    u64 checked;
+    u64 mismatches;
+} op_stats;
+
+static op_stats stats[sizeof(alu_ops) / sizeof(alu_ops[0])];
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int next_chunk = 0;
+static int total_chunks = 0;
+static int selected[sizeof(alu_ops) / sizeof(alu_ops[0])];
+static int num_selected = 0;
+static bool quick = 0;
+
+typedef struct
+{
+    u16 value;
+    u16 flags;
+} alu_result;
+
+// the instruction word for operand b, and the value of r2
+static u16 encode(const alu_op *o, u32 b, u16 *r2)
+{
+    switch(o->operand) {
+        case OPND_NUM4: *r2 = 0; return o->op | (b << 4);
+        case OPND_NUM8: *r2 = 0; return o->op | (b << 4);    // b is 9 bits: sign + num8
+        default:        *r2 = b; return o->op;
+    }
+}
+
+static u32 operand_count(const alu_op *o)
+{
+    switch(o->operand) {
+        case OPND_NUM4: return 16;
+        case OPND_NUM8: return 512;
+        default:        return quick ? 64 : 0x10000;
+    }
+}
+
+// In quick mode register operands b are limited to 0..31 and 0xffe0..0xffff,
+// which still covers every shift corner case.
+static u32 operand_value(const alu_op *o, u32 i)
+{
+    if (quick && o->operand == OPND_REG) {
+        return i < 32 ? i : 0xffc0 + i;
+    }
+    return i;
+}
+
+static alu_result rtl_alu(Vvixen *top, u16 op, u16 a, u16 b, u16 flags)
+{
+    Vvixen___024root *root = top->rootp;
+
+    root->vixen__DOT__r[1] = a;
+    root->vixen__DOT__r[2] = b;
+    root->vixen__DOT__special_reg[FLAGS] = flags;
+    top->din = op;
+    top->eval();
+
+    alu_result res;
+    res.value = root->vixen__DOT__alu_wr_reg ? root->vixen__DOT__alu_out : a;
+    res.flags = flags;
+    if (root->vixen__DOT__alu_wr_nz) {
+        res.flags = (res.flags & ~(FLAG_N|FLAG_Z)) |
+            (root->vixen__DOT__alu_n ? FLAG_N : 0) |
+            (root->vixen__DOT__alu_z ? FLAG_Z : 0);
+    }
+    if (root->vixen__DOT__alu_wr_c) {
+        res.flags = (res.flags & ~FLAG_C) | (root->vixen__DOT__alu_c ? FLAG_C : 0);
+    }
+    if (root->vixen__DOT__alu_wr_v) {
+        res.flags = (res.flags & ~FLAG_V) | (root->vixen__DOT__alu_v ? FLAG_V : 0);
+    }
+    return res;
+}
+
+static alu_result sim_alu(cpu *c, u16 op, u16 a, u16 b, u16 flags)
+{
+    c->r[1] = a;
+    c->r[2] = b;
+    c->special_regs[FLAGS] = flags;
+    execute(c, op);
+
+    alu_result res;
+    res.value = c->r[1];
+    res.flags = c->special_regs[FLAGS];
+    return res;
+}
+
+static void report(int op_index, u16 op, u16 a, u16 b, u16 flags, alu_result rtl, alu_result sim)
+{
+    pthread_mutex_lock(&stats_lock);
+    if (stats[op_index].mismatches < max_reported) {
+        printf("MISMATCH %-8s op=%04x a=%04x b=%04x flags=%04x: rtl=%04x/%04x sim=%04x/%04x\n",
+                alu_ops[op_index].name, op, a, b, flags,
+                rtl.value, rtl.flags, sim.value, sim.flags);
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+static void check_chunk(Vvixen *top, cpu *c, int op_index, int chunk)
+{
+    const alu_op *o = &alu_ops[op_index];
+    u32 n = operand_count(o);
+    u64 checked = 0;
+    u64 mismatches = 0;
+
+    for(u32 ai = 0; ai < (1u << chunk_bits); ai++) {
+        u16 a = (chunk << chunk_bits) | ai;
+        for(u32 i = 0; i < n; i++) {
+            u32 b = operand_value(o, i);
+            u16 r2;
+            u16 op = encode(o, b, &r2);
+
+            // vary the untouched flags with the operands
+            u16 flags = ((a ^ (b * 0x9e37)) & (FLAG_N|FLAG_Z|FLAG_C|FLAG_V)) | FLAG_I;
+
+            for(int cin = 0; cin < (o->uses_carry ? 2 : 1); cin++) {
+                if (o->uses_carry) {
+                    flags = (flags & ~FLAG_C) | (cin ? FLAG_C : 0);
+                }
+                alu_result rtl = rtl_alu(top, op, a, r2, flags);
+                alu_result sim = sim_alu(c, op, a, r2, flags);
+                checked++;
+                if (rtl.value != sim.value || rtl.flags != sim.flags) {
+                    report(op_index, op, a, r2, flags, rtl, sim);
+                    mismatches++;
+                }
+            }
+        }
+    }
+
+    pthread_mutex_lock(&stats_lock);
+    stats[op_index].checked += checked;
+    stats[op_index].mismatches += mismatches;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+static void *worker(void *arg)
+{
+    Vvixen *top = new Vvixen;
+    top->irq = 0;
+    top->clk = 0;
+    top->eval();
+
+    cpu *c = cpu_new();
+
+    while(1) {
+        int chunk = __atomic_fetch_add(&next_chunk, 1, __ATOMIC_RELAXED);
+        if (chunk >= total_chunks) break;
+        check_chunk(top, c, selected[chunk / chunks_per_op], chunk % chunks_per_op);
+    }
+
+    cpu_free(c);
+    delete top;
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: exhaustive check of the vixen.v ALU against sim.c\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help       display this message, and exit\n");
+    fprintf(stderr, "  -j, --jobs N     number of threads (default: number of cpus)\n");
+    fprintf(stderr, "  -o, --op NAME    check only NAME (may be repeated)\n");
+    fprintf(stderr, "  -q, --quick      limit register operand b to 0..31, 0xffe0..0xffff\n");
+    fprintf(stderr, "  -l, --list       list operation names, and exit\n");
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    Verilated::commandArgs(argc, argv);
+
+    int jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    for(int i=1; i<argc; i++) {
+        const char *arg = argv[i];
+        if (!strcmp(arg, "-h") || !strcmp(arg, "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(arg, "-j") || !strcmp(arg, "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if ((!strcmp(arg, "-o") || !strcmp(arg, "--op")) && i+1 < argc) {
+            const char *name = argv[++i];
+            int j;
+            for(j=0; j<num_ops && strcmp(alu_ops[j].name, name); j++) ;
+            if (j == num_ops) {
+                fprintf(stderr, "%s: unknown op `%s'.\n", argv[0], name);
+                exit(1);
+            }
+            selected[num_selected++] = j;
+        }
+        else if (!strcmp(arg, "-q") || !strcmp(arg, "--quick")) {
+            quick = 1;
+        }
+        else if (!strcmp(arg, "-l") || !strcmp(arg, "--list")) {
+            for(int j=0; j<num_ops; j++) printf("%s\n", alu_ops[j].name);
+            exit(0);
+        }
+        else if (arg[0] != '+') {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], arg);
+            exit(1);
+        }
+    }
+
+    if (num_selected == 0) {
+        for(int j=0; j<num_ops; j++) selected[num_selected++] = j;
+    }
+    if (jobs < 1) jobs = 1;
+
+    total_chunks = num_selected * chunks_per_op;
+
+    pthread_t *threads = (pthread_t*)calloc(jobs, sizeof(pthread_t));
+    for(int t=0; t<jobs; t++) pthread_create(&threads[t], 0, worker, 0);
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+    free(threads);
+
+    u64 failed = 0;
+    for(int s=0; s<num_selected; s++) {
+        int j = selected[s];
+        printf("%-8s %12llu checked %12llu mismatched\n", alu_ops[j].name,
+                (unsigned long long)stats[j].checked,
+                (unsigned long long)stats[j].mismatches);
+        failed += stats[j].mismatches;
+    }
+    printf("%s\n", failed ? "FAIL" : "SUCCESS");
+    return failed ? 1 : 0;
+}
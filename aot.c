@@ -0,0 +1,892 @@
+// Ahead-of-time translator from an assembled image to C.
+//
+// The code reachable from the reset address (and from any label which
+// starts with an instruction) is found by following the control flow, and
+// translated instruction by instruction into one C function, with a label
+// at each branch target. gcc then does the rest. Flag updates which are
+// certainly overwritten before being read are left out, and jumps whose
+// target is not known until run time (mov r15, rN; ldw r15, ...; and so
+// on) go through a switch over the addresses which may be jumped to.
+//
+// The output behaves as "sim -q" does: it runs the program until it
+// stops, prints TRAP, and with -s FILE saves a snapshot. Anything the
+// translation cannot follow - a jump to an address with no label, or a
+// store over translated code - is handed on to cpu_run(), so the program
+// runs correctly, if not as quickly. Cycle and instruction counts are kept
+// exactly as the simulator keeps them.
+//
+// Usage, after assembling a program:
+//
+//      ./out/aot -A out/asm.log -o out/aot_prog.c
+//      cc -O2 -I. -o out/aot_prog out/aot_prog.c cpu.c engine.c stops.c listing.c
+//      ./out/aot_prog -s out/aot.snap
+//
+// or "make out/aot_prog".
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "cpu.h"
+#include "listing.h"
+
+enum {
+    F_N = 1,
+    F_Z = 2,
+    F_C = 4,
+    F_V = 8,
+    F_ALL = 15
+};
+
+// How an instruction passes on control.
+enum {
+    FLOW_NEXT,          // to the next instruction
+    FLOW_PRED,          // to the next, or the one after
+    FLOW_BRANCH,        // to target (bra, or a constant written to r15)
+    FLOW_CALL,          // to target, with r14 set to return to the next
+    FLOW_JUMP,          // to an address computed at run time
+    FLOW_STOP           // swi, rtu, hlt or an undefined instruction
+};
+
+typedef struct
+{
+    bool code;          // reachable, and translated
+    bool leader;        // needs a C label
+    bool entry;         // may be jumped to at run time, so in the switch
+    int flow;
+    u16 target;         // for FLOW_BRANCH and FLOW_CALL
+    u8 use;             // flags read
+    u8 def;             // flags always written
+    u8 live;            // flags which may be read after this instruction
+} word;
+
+static cpu *c;
+static listing *l;
+static word w[0x8000];
+static FILE *out;
+
+static u16 op_at(u16 pc)
+{
+    return mem_word(c, pc >> 1);
+}
+
+// Flags read by a pr* condition.
+static u8 cond_flags(u8 cond)
+{
+    switch(cond) {
+        case 0x0: case 0x1: return F_Z;
+        case 0x2: case 0x3: return F_C;
+        case 0x4: case 0x5: return F_N;
+        case 0x6: case 0x7: return F_V;
+        case 0x8: case 0x9: return F_C|F_Z;
+        case 0xa: case 0xb: return F_N|F_V;
+        default:            return F_N|F_Z|F_V;
+    }
+}
+
+// Work out the control flow and flag usage of the instruction at pc.
+static void classify(u16 pc, word *wd)
+{
+    u16 op = op_at(pc);
+    u8 dst = op & 0xf;
+    u8 num4 = (op >> 4) & 0xf;
+    u8 num8 = (op >> 4) & 0xff;
+
+    wd->flow = FLOW_NEXT;
+    wd->use = 0;
+    wd->def = 0;
+
+    switch(op >> 14) {
+        case 0: {
+            u8 cat = (op >> 8) & 0x3f;
+            if (cat < 0x20) {
+                bool writes = 1;
+                switch(cat) {
+                    case 0x00: case 0x01: case 0x08:
+                        break;
+                    case 0x02: case 0x03: case 0x06:
+                        wd->use = F_C;
+                        wd->def = F_ALL;
+                        break;
+                    case 0x04: case 0x05: case 0x07:
+                        wd->def = F_ALL;
+                        break;
+                    case 0x0d: case 0x0e:
+                        wd->def = F_ALL;
+                        writes = 0;
+                        break;
+                    case 0x09: case 0x0f:
+                        wd->flow = FLOW_STOP;
+                        wd->use = F_ALL;
+                        return;
+                    case 0x10:
+                        // ror by zero leaves C alone
+                        wd->def = F_N|F_Z;
+                        wd->use = F_C;
+                        break;
+                    case 0x18:
+                        wd->def = F_N|F_Z|F_C;
+                        if (num4 == 0) wd->use = F_C;
+                        break;
+                    case 0x11: case 0x12: case 0x13:
+                    case 0x19: case 0x1a: case 0x1b:
+                        wd->def = F_N|F_Z|F_C;
+                        break;
+                    case 0x17: case 0x1f:
+                        wd->def = F_N|F_Z;
+                        writes = 0;
+                        break;
+                    default:
+                        wd->def = F_N|F_Z;
+                        break;
+                }
+                if (writes && dst == 15) {
+                    wd->flow = FLOW_JUMP;
+                }
+            }
+            else if (dst != 0xf) {
+                wd->def = F_ALL;
+            }
+            else if ((op >> 8 & 0x1f) == 0x1f) {
+                switch(num4) {
+                    case 0xe: break;
+                    case 0xf: wd->flow = FLOW_STOP; wd->use = F_ALL; break;
+                    default:  wd->flow = FLOW_PRED; wd->use = cond_flags(num4); break;
+                }
+            }
+            else if ((op & 0xf00f) == 0x200f) {
+                wd->flow = FLOW_STOP;
+                wd->use = F_ALL;
+            }
+            else switch(op & 0xff0f) {
+                case 0x300f:
+                    wd->use = F_ALL;
+                    if (num4 == 15) wd->flow = FLOW_JUMP;
+                    break;
+                case 0x310f:
+                    wd->def = F_ALL;
+                    break;
+                case 0x320f: case 0x340f: case 0x360f:
+                    if (num4 == 15) wd->flow = FLOW_JUMP;
+                    break;
+                case 0x330f: case 0x350f: case 0x370f:
+                    break;
+                default:
+                    // rtu, or undefined
+                    wd->flow = FLOW_STOP;
+                    wd->use = F_ALL;
+                    break;
+            }
+            break;
+        }
+        case 1:
+            if (dst == 15) wd->flow = FLOW_JUMP;
+            break;
+        case 2:
+            // a store may hit translated code, and hand over to cpu_run()
+            wd->use = F_ALL;
+            break;
+        case 3:
+            switch((op >> 12) & 0x3) {
+                case 0:
+                case 1:
+                    if (dst == 15) {
+                        wd->flow = FLOW_BRANCH;
+                        wd->target = ((op >> 12) & 1) ? (u16)num8 << 8 : num8;
+                    }
+                    break;
+                default: {
+                    u16 offset = op & 0xfff;
+                    u16 next = pc + 2;
+                    wd->target = next + ((offset & 0x800) ? (offset << 1 | 0xf000) : (offset << 1));
+                    wd->flow = ((op >> 12) & 0x3) == 3 ? FLOW_CALL : FLOW_BRANCH;
+                    break;
+                }
+            }
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Discovery and analysis
+//
+
+static u16 *worklist;
+static int worklist_len;
+
+static void reach(u16 pc, bool entry)
+{
+    if (pc & 1) return;
+    word *wd = &w[pc >> 1];
+    if (entry) {
+        wd->entry = 1;
+        wd->leader = 1;
+    }
+    if (!wd->code) {
+        wd->code = 1;
+        worklist[worklist_len++] = pc;
+    }
+}
+
+static void discover(void)
+{
+    worklist = malloc(0x8000 * sizeof(u16));
+    reach(0, 1);
+
+    // labels at instructions may be jumped to through a register
+    for(int i=0; i<l->num_labels; i++) {
+        u16 addr = l->labels[i].addr;
+        const char *text = l->text[addr];
+        if ((addr & 1) || text == 0) continue;
+        while(isspace((u8)*text)) text++;
+        static const char *data[] = { "db", "dw", "dl", "ds" };
+        bool is_data = 0;
+        for(size_t j=0; j<sizeof(data)/sizeof(data[0]); j++) {
+            int n = strlen(data[j]);
+            if (!strncasecmp(text, data[j], n) && (text[n] == 0 || isspace((u8)text[n]))) is_data = 1;
+        }
+        if (!is_data) reach(addr, 1);
+    }
+
+    while(worklist_len) {
+        u16 pc = worklist[--worklist_len];
+        word *wd = &w[pc >> 1];
+        classify(pc, wd);
+        switch(wd->flow) {
+            case FLOW_NEXT:
+                reach(pc + 2, 0);
+                break;
+            case FLOW_PRED:
+                reach(pc + 2, 0);
+                reach(pc + 4, 0);
+                w[(u16)(pc + 4) >> 1].leader = 1;
+                break;
+            case FLOW_CALL:
+                // the return, through r14
+                reach(pc + 2, 1);
+                // fall through
+            case FLOW_BRANCH:
+                if (wd->target & 1) {
+                    wd->flow = FLOW_JUMP;
+                } else {
+                    reach(wd->target, 0);
+                    w[wd->target >> 1].leader = 1;
+                }
+                break;
+        }
+        // a wrap around from the last word needs a goto
+        if ((wd->flow == FLOW_NEXT || wd->flow == FLOW_PRED) && (u16)(pc + 2) == 0) {
+            w[0].leader = 1;
+        }
+    }
+    free(worklist);
+}
+
+// Find which flags may be read after each instruction, so that updates to
+// the others can be left out.
+static void analyse(void)
+{
+    for(int i=0; i<0x8000; i++) {
+        w[i].live = 0;
+    }
+    bool changed = 1;
+    while(changed) {
+        changed = 0;
+        for(int i=0x7fff; i>=0; i--) {
+            word *wd = &w[i];
+            if (!wd->code) continue;
+            u16 pc = i << 1;
+            u8 live = 0;
+            #define LIVE_IN(a) (w[(u16)(a) >> 1].use | (w[(u16)(a) >> 1].live & ~w[(u16)(a) >> 1].def))
+            switch(wd->flow) {
+                case FLOW_NEXT:   live = LIVE_IN(pc + 2); break;
+                case FLOW_PRED:   live = LIVE_IN(pc + 2) | LIVE_IN(pc + 4); break;
+                case FLOW_BRANCH: live = LIVE_IN(wd->target); break;
+                case FLOW_CALL:   live = LIVE_IN(wd->target); break;
+                case FLOW_JUMP:   live = F_ALL; break;
+                case FLOW_STOP:   live = F_ALL; break;
+            }
+            #undef LIVE_IN
+            if (live != wd->live) {
+                wd->live = live;
+                changed = 1;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Code generation
+//
+
+static const char *prelude =
+    "// Generated by aot.c - do not edit.\n"
+    "\n"
+    "#include <stdio.h>\n"
+    "#include <stdlib.h>\n"
+    "#include <string.h>\n"
+    "#include <errno.h>\n"
+    "\n"
+    "#include \"cpu.h\"\n"
+    "\n"
+    "static u16 mem[0x8000];\n"
+    "static u8 code[0x8000];      // words which have been translated\n"
+    "\n"
+    "static inline u16 rd(u16 addr, bool wide)\n"
+    "{\n"
+    "    u16 hi = addr >> 1;\n"
+    "    u16 lo = ((addr+1) >> 1) & 0x7fff;\n"
+    "    if (wide) return (addr & 1) ? (u16)(mem[hi] << 8 | mem[lo] >> 8) : mem[hi];\n"
+    "    return (addr & 1) ? mem[hi] & 0xff : mem[hi] >> 8;\n"
+    "}\n"
+    "\n"
+    "// Store, returning whether translated code was overwritten.\n"
+    "static inline bool wr(u16 addr, bool wide, u16 data)\n"
+    "{\n"
+    "    u16 hi = addr >> 1;\n"
+    "    u16 lo = ((addr+1) >> 1) & 0x7fff;\n"
+    "    if (wide) {\n"
+    "        if (addr & 1) {\n"
+    "            mem[hi] = (mem[hi] & 0xff00) | (data >> 8);\n"
+    "            mem[lo] = (mem[lo] & 0x00ff) | (u16)(data << 8);\n"
+    "            return code[hi] | code[lo];\n"
+    "        }\n"
+    "        mem[hi] = data;\n"
+    "    } else if (addr & 1) {\n"
+    "        mem[hi] = (mem[hi] & 0xff00) | (data & 0xff);\n"
+    "    } else {\n"
+    "        mem[hi] = (mem[hi] & 0x00ff) | (u16)(data << 8);\n"
+    "    }\n"
+    "    return code[hi];\n"
+    "}\n"
+    "\n"
+    "static inline u16 clz(u16 v)\n"
+    "{\n"
+    "    return v ? __builtin_clz(v) - 16 : 16;\n"
+    "}\n"
+    "\n"
+    "// Register shifts, as execute() does them. Each returns the result, and\n"
+    "// sets *cout, and *wc to whether the carry is written.\n"
+    "static inline u32 ror_r(u16 d, u16 s, u16 *cout, bool *wc)\n"
+    "{\n"
+    "    if ((s & 0xf) == 0) { *wc = 0; *cout = 0; return d; }\n"
+    "    *wc = 1;\n"
+    "    *cout = (d >> ((s-1u) & 0xf)) & 1;\n"
+    "    return (u32)d << (16u-(s & 0xf)) | d >> (s & 0xf);\n"
+    "}\n"
+    "static inline u32 lsl_r(u16 d, u16 s, u16 *cout)\n"
+    "{\n"
+    "    if (s > 16u) { *cout = 0; return 0; }\n"
+    "    if (s > 0u) { *cout = (d >> (16u-s)) & 1; return (u32)d << s; }\n"
+    "    *cout = 0; return d;\n"
+    "}\n"
+    "static inline u32 lsr_r(u16 d, u16 s, u16 *cout)\n"
+    "{\n"
+    "    if (s > 16u) { *cout = 0; return 0; }\n"
+    "    if (s > 0u) { *cout = (d >> (s-1u)) & 1; return d >> s; }\n"
+    "    *cout = 0; return d;\n"
+    "}\n"
+    "static inline u32 asr_r(u16 d, u16 s, u16 *cout)\n"
+    "{\n"
+    "    if (s > 16u) { *cout = d >> 15; return (d & 0x8000) ? 0xffff : 0; }\n"
+    "    if (s > 0u) {\n"
+    "        u32 res = d >> s;\n"
+    "        if (d & 0x8000) res |= ~0u << (16u-s);\n"
+    "        *cout = (d >> (s-1u)) & 1;\n"
+    "        return res;\n"
+    "    }\n"
+    "    *cout = 0; return d;\n"
+    "}\n"
+    "\n";
+
+static char *reg(u16 pc, u8 i)
+{
+    static char buf[4][16];
+    static int n;
+    char *b = buf[n++ & 3];
+    if (i == 15) {
+        snprintf(b, 16, "0x%04x", (u16)(pc + 2));
+    } else {
+        snprintf(b, 16, "r%d", i);
+    }
+    return b;
+}
+
+// Emit flag updates from t, a u32 result, for the flags in mask.
+static void emit_flags(u8 mask, const char *cout, const char *vout)
+{
+    if (mask & F_N) fprintf(out, " fn = (t >> 15) & 1;");
+    if (mask & F_Z) fprintf(out, " fz = (t & 0xffff) == 0;");
+    if (mask & F_V) fprintf(out, " fv = %s;", vout);
+    if (mask & F_C) fprintf(out, " fc = %s;", cout);
+}
+
+static void emit_jump(const char *value)
+{
+    fprintf(out, " pc = %s; goto dispatch;", value);
+}
+
+static void emit_goto(u16 target)
+{
+    if ((target & 1) || !w[target >> 1].code) {
+        fprintf(out, " pc = 0x%04x; goto bail;", target);
+    } else {
+        fprintf(out, " goto L_%04x;", target);
+    }
+}
+
+static void emit_stop(u16 pc, int substate, int cycles)
+{
+    fprintf(out, " I += 1; C += %d; pc = 0x%04x; substate = %d; goto stop;", cycles, (u16)(pc + 2), substate);
+}
+
+static void emit_alu(u16 pc, u16 op, u8 live)
+{
+    u8 dst = op & 0xf;
+    u8 src = (op >> 4) & 0xf;
+    u8 num4 = src;
+    u8 cat = (op >> 8) & 0x3f;
+    const char *d = reg(pc, dst);
+    const char *s = reg(pc, src);
+    const char *wr_to = 0;
+    u8 def = 0;
+    char cout[64] = "0";
+    char vout[64] = "0";
+
+    fprintf(out, " {");
+    fprintf(out, " u16 sne = (u16)((%s ^ %s) >> 15); (void)sne;", d, s);
+    switch(cat) {
+        case 0x00: fprintf(out, " u32 t = %s;", s); wr_to = d; break;
+        case 0x01: fprintf(out, " u32 t = (u16)~%s;", s); wr_to = d; break;
+        case 0x02: fprintf(out, " u32 t = (u32)%s + %s + fc;", d, s); wr_to = d; def = F_ALL; break;
+        case 0x03: fprintf(out, " u32 t = (u32)%s + (u16)~%s + fc;", d, s); wr_to = d; def = F_ALL; break;
+        case 0x04: fprintf(out, " u32 t = (u32)%s + %s;", d, s); wr_to = d; def = F_ALL; break;
+        case 0x05: fprintf(out, " u32 t = (u32)%s + (u16)~%s + 1u;", d, s); wr_to = d; def = F_ALL; break;
+        case 0x06: fprintf(out, " u32 t = (u32)%s + (u16)~%s + fc;", s, d); wr_to = d; def = F_ALL; break;
+        case 0x07: fprintf(out, " u32 t = (u32)%s + (u16)~%s + 1u;", s, d); wr_to = d; def = F_ALL; break;
+        case 0x08: fprintf(out, " u32 t = clz(%s);", s); wr_to = d; break;
+        case 0x0a: fprintf(out, " u32 t = ((u32)%s * %s) & 0xffff;", d, s); wr_to = d; def = F_N|F_Z; break;
+        case 0x0b: fprintf(out, " u32 t = ((u32)%s * %s) >> 16;", d, s); wr_to = d; def = F_N|F_Z; break;
+        case 0x0c: fprintf(out, " u32 t = %s & %s;", d, s); wr_to = d; def = F_N|F_Z; break;
+        case 0x0d: fprintf(out, " u32 t = (u32)%s + (u16)~%s + 1u;", d, s); def = F_ALL; break;
+        case 0x0e: fprintf(out, " u32 t = (u32)%s + %s;", d, s); def = F_ALL; break;
+        case 0x10:
+            fprintf(out, " u16 co; bool wc; u32 t = ror_r(%s, %s, &co, &wc);", d, s);
+            wr_to = d; def = F_N|F_Z|F_C;
+            strcpy(cout, "wc ? co : fc");
+            break;
+        case 0x11: fprintf(out, " u16 co; u32 t = lsl_r(%s, %s, &co);", d, s); wr_to = d; def = F_N|F_Z|F_C; strcpy(cout, "co"); break;
+        case 0x12: fprintf(out, " u16 co; u32 t = lsr_r(%s, %s, &co);", d, s); wr_to = d; def = F_N|F_Z|F_C; strcpy(cout, "co"); break;
+        case 0x13: fprintf(out, " u16 co; u32 t = asr_r(%s, %s, &co);", d, s); wr_to = d; def = F_N|F_Z|F_C; strcpy(cout, "co"); break;
+        case 0x14: fprintf(out, " u32 t = %s | %s;", d, s); wr_to = d; def = F_N|F_Z; break;
+        case 0x15: fprintf(out, " u32 t = %s ^ %s;", d, s); wr_to = d; def = F_N|F_Z; break;
+        case 0x16: fprintf(out, " u32 t = %s & (u16)~%s;", d, s); wr_to = d; def = F_N|F_Z; break;
+        case 0x17: fprintf(out, " u32 t = %s & %s;", d, s); def = F_N|F_Z; break;
+        case 0x18:
+            if (num4 == 0) {
+                fprintf(out, " u32 t = (fc ? 0x8000 : 0) | (%s >> 1);", d);
+                snprintf(cout, sizeof(cout), "%s & 1", d);
+            } else {
+                fprintf(out, " u32 t = (u32)%s << %d | %s >> %d;", d, 16 - num4, d, num4);
+                snprintf(cout, sizeof(cout), "(%s >> %d) & 1", d, num4 - 1);
+            }
+            wr_to = d; def = F_N|F_Z|F_C;
+            break;
+        case 0x19:
+            if (num4) {
+                fprintf(out, " u32 t = (u32)%s << %d;", d, num4);
+                snprintf(cout, sizeof(cout), "(%s >> %d) & 1", d, 16 - num4);
+            } else {
+                fprintf(out, " u32 t = %s;", d);
+            }
+            wr_to = d; def = F_N|F_Z|F_C;
+            break;
+        case 0x1a:
+            if (num4) {
+                fprintf(out, " u32 t = %s >> %d;", d, num4);
+                snprintf(cout, sizeof(cout), "(%s >> %d) & 1", d, num4 - 1);
+            } else {
+                fprintf(out, " u32 t = %s;", d);
+            }
+            wr_to = d; def = F_N|F_Z|F_C;
+            break;
+        case 0x1b:
+            if (num4) {
+                fprintf(out, " u32 t = (u16)((short)%s >> %d);", d, num4);
+                snprintf(cout, sizeof(cout), "(%s >> %d) & 1", d, num4 - 1);
+            } else {
+                fprintf(out, " u32 t = %s;", d);
+            }
+            wr_to = d; def = F_N|F_Z|F_C;
+            break;
+        case 0x1c: fprintf(out, " u32 t = %s | 0x%04x;", d, 1 << num4); wr_to = d; def = F_N|F_Z; break;
+        case 0x1d: fprintf(out, " u32 t = %s ^ 0x%04x;", d, 1 << num4); wr_to = d; def = F_N|F_Z; break;
+        case 0x1e: fprintf(out, " u32 t = %s & 0x%04x;", d, (u16)~(1 << num4)); wr_to = d; def = F_N|F_Z; break;
+        case 0x1f: fprintf(out, " u32 t = %s & 0x%04x;", d, 1 << num4); def = F_N|F_Z; break;
+    }
+
+    if (def == F_ALL) {
+        bool sub = (cat == 0x03 || cat == 0x05 || cat == 0x06 || cat == 0x07 || cat == 0x0d || cat == 0x0e);
+        strcpy(cout, "(t >> 16) & 1");
+        snprintf(vout, sizeof(vout), "((t >> 15) ^ sne ^ (t >> 16) ^ %d) & 1", sub);
+    }
+
+    fprintf(out, " I += 1; C += 2;");
+    emit_flags(def & live, cout, vout);
+    if (wr_to) {
+        if (dst == 15) {
+            emit_jump("(u16)t");
+        } else {
+            fprintf(out, " %s = t;", wr_to);
+        }
+    }
+    fprintf(out, " }");
+}
+
+static void emit_cond(u8 cond)
+{
+    static const char *conds[14] = {
+        "fz", "!fz", "fc", "!fc", "fn", "!fn", "fv", "!fv",
+        "fc && !fz", "!fc || fz", "fn == fv", "fn != fv",
+        "!fz && fn == fv", "fz || fn != fv"
+    };
+    fprintf(out, "%s", conds[cond]);
+}
+
+static void emit_insn(u16 pc)
+{
+    const word *wd = &w[pc >> 1];
+    u16 op = op_at(pc);
+    u8 dst = op & 0xf;
+    u8 num4 = (op >> 4) & 0xf;
+    u8 num5 = (op >> 8) & 0x1f;
+    u8 num8 = (op >> 4) & 0xff;
+
+    if (wd->leader) {
+        fprintf(out, "L_%04x:\n", pc);
+    }
+    const char *text = l->text[pc];
+    if (text) {
+        fprintf(out, "    // %04x  ", pc);
+        for(const char *p = text; *p && *p != '\n'; p++) {
+            // keep the comment a comment
+            fputc((p[0] == '*' && p[1] == '/') || (p[0] == '/' && p[1] == '*') ? ' ' : *p, out);
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "   ");
+
+    switch(op >> 14) {
+        case 0: {
+            u8 cat = (op >> 8) & 0x3f;
+            if (cat < 0x20) {
+                if (cat == 0x09 || cat == 0x0f) {
+                    emit_stop(pc, SS_TRAP, 3);
+                } else {
+                    emit_alu(pc, op, wd->live);
+                }
+            }
+            else if (dst != 0xf) {
+                bool sign = (op >> 12) & 1;
+                u16 delta = sign ? (u16)num8 | 0xff00 : num8;
+                fprintf(out, " { u16 sne = (r%d >> 15) != %d; u32 t = (u32)r%d + 0x%04x; I += 1; C += 2;",
+                        dst, sign, dst, delta);
+                emit_flags(F_ALL & wd->live, "(t >> 16) & 1", "((t >> 15) ^ sne ^ (t >> 16)) & 1");
+                fprintf(out, " r%d = t; }", dst);
+            }
+            else if ((op >> 8 & 0x1f) == 0x1f) {
+                switch(num4) {
+                    case 0xe: fprintf(out, " I += 1; C += 2;"); break;
+                    case 0xf: emit_stop(pc, SS_HALT, 2); break;
+                    default:
+                        fprintf(out, " I += 1; C += 2; if (!(");
+                        emit_cond(num4);
+                        fprintf(out, ")) { C += 2;");
+                        emit_goto(pc + 4);
+                        fprintf(out, " }");
+                        break;
+                }
+            }
+            else if ((op & 0xf00f) == 0x200f) {
+                emit_stop(pc, SS_SWI, 3);
+            }
+            else {
+                u8 sr = num4;
+                switch(op & 0xff0f) {
+                    case 0x300f:
+                        fprintf(out, " I += 1; C += 2;");
+                        if (sr == 15) {
+                            emit_jump("FLAGS_WORD");
+                        } else {
+                            fprintf(out, " r%d = FLAGS_WORD;", sr);
+                        }
+                        break;
+                    case 0x310f:
+                        fprintf(out, " I += 1; C += 2; SET_FLAGS(%s);", reg(pc, sr));
+                        break;
+                    case 0x320f: case 0x340f: case 0x360f: {
+                        int i = ((op >> 8) & 0xf) == 2 ? USER_FLAGS : ((op >> 8) & 0xf) == 4 ? USER_R13 : USER_R14;
+                        fprintf(out, " I += 1; C += 2;");
+                        if (sr == 15) {
+                            char v[16];
+                            snprintf(v, sizeof(v), "sr%d", i);
+                            emit_jump(v);
+                        } else {
+                            fprintf(out, " r%d = sr%d;", sr, i);
+                        }
+                        break;
+                    }
+                    case 0x330f: case 0x350f: case 0x370f: {
+                        int i = ((op >> 8) & 0xf) == 3 ? USER_FLAGS : ((op >> 8) & 0xf) == 5 ? USER_R13 : USER_R14;
+                        fprintf(out, " I += 1; C += 2; sr%d = %s;", i, reg(pc, sr));
+                        break;
+                    }
+                    case 0x380f:
+                        emit_stop(pc, SS_RTU, 2);
+                        break;
+                    default:
+                        emit_stop(pc, SS_TRAP, 3);
+                        break;
+                }
+            }
+            break;
+        }
+        case 1: {
+            bool wide = (op >> 13) & 1;
+            u8 base = (op >> 4) & 0xf;
+            char addr[32];
+            snprintf(addr, sizeof(addr), "(u16)(%s + %d)", reg(pc, base), num5);
+            fprintf(out, " I += 1; C += 4;");
+            if (dst == 15) {
+                char v[64];
+                snprintf(v, sizeof(v), "rd(%s, %d)", addr, wide);
+                emit_jump(v);
+            } else {
+                fprintf(out, " r%d = rd(%s, %d);", dst, addr, wide);
+            }
+            break;
+        }
+        case 2: {
+            bool wide = (op >> 13) & 1;
+            u8 base = (op >> 4) & 0xf;
+            fprintf(out, " I += 1; C += 3; if (wr((u16)(%s + %d), %d, %s)) {", reg(pc, base), num5, wide, reg(pc, dst));
+            fprintf(out, " pc = 0x%04x; goto bail; }", (u16)(pc + 2));
+            break;
+        }
+        case 3:
+            switch((op >> 12) & 0x3) {
+                case 0:
+                case 1: {
+                    u16 value = ((op >> 12) & 1) ? (u16)num8 << 8 : num8;
+                    fprintf(out, " I += 1; C += 2;");
+                    if (dst == 15) {
+                        emit_goto(value);
+                    } else {
+                        fprintf(out, " r%d = 0x%04x;", dst, value);
+                    }
+                    break;
+                }
+                default:
+                    fprintf(out, " I += 1; C += 2;");
+                    if (((op >> 12) & 0x3) == 3) {
+                        fprintf(out, " r14 = 0x%04x;", (u16)(pc + 2));
+                    }
+                    emit_goto(wd->target);
+                    break;
+            }
+            break;
+    }
+
+    fprintf(out, "\n");
+
+    if ((wd->flow == FLOW_NEXT || wd->flow == FLOW_PRED) && (u16)(pc + 2) == 0) {
+        fprintf(out, "    goto L_0000;\n");
+    }
+}
+
+static void emit(const char *image_name)
+{
+    fprintf(out, "%s", prelude);
+
+    fprintf(out, "// The image translated, from %s.\n", image_name);
+    fprintf(out, "static const u16 image[0x8000] = {");
+    for(int i=0; i<0x8000; i++) {
+        fprintf(out, "%s0x%04x,", (i % 12) ? " " : "\n    ", mem_word(c, i));
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static const u8 translated[0x8000] = {");
+    int n = 0;
+    for(int i=0; i<0x8000; i++) {
+        if (w[i].code) {
+            fprintf(out, "%s[0x%04x] = 1,", (n++ % 8) ? " " : "\n    ", i);
+        }
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out,
+        "#define FLAGS_WORD ((u16)(fo | fn << 15 | fz << 14 | fc << 13 | fv << 12))\n"
+        "#define SET_FLAGS(v) do { u16 f_ = (v); fo = f_ & 0x0fff; fn = f_ >> 15 & 1; fz = f_ >> 14 & 1; fc = f_ >> 13 & 1; fv = f_ >> 12 & 1; } while(0)\n"
+        "\n"
+        "// Run m until it stops, returning the substate which stopped it, or -1\n"
+        "// if it must be finished by cpu_run().\n"
+        "static int run(cpu *m)\n"
+        "{\n"
+        "    u16 r0 = m->r[0], r1 = m->r[1], r2 = m->r[2], r3 = m->r[3];\n"
+        "    u16 r4 = m->r[4], r5 = m->r[5], r6 = m->r[6], r7 = m->r[7];\n"
+        "    u16 r8 = m->r[8], r9 = m->r[9], r10 = m->r[10], r11 = m->r[11];\n"
+        "    u16 r12 = m->r[12], r13 = m->r[13], r14 = m->r[14];\n"
+        "    u16 sr1 = m->special_regs[USER_FLAGS], sr2 = m->special_regs[USER_R13], sr3 = m->special_regs[USER_R14];\n"
+        "    u16 fo; u8 fn, fz, fc, fv;\n"
+        "    SET_FLAGS(m->special_regs[FLAGS]);\n"
+        "    u64 I = m->instructions, C = m->cycles;\n"
+        "    u16 pc = m->r[15];\n"
+        "    int substate = -1;\n"
+        "    for(int i=0; i<0x8000; i++) mem[i] = mem_word(m, i);\n"
+        "    goto dispatch;\n"
+        "\n");
+
+    for(int i=0; i<0x8000; i++) {
+        if (w[i].code) {
+            emit_insn(i << 1);
+        }
+    }
+
+    fprintf(out,
+        "\n"
+        "dispatch:\n"
+        "    switch(pc) {\n");
+    for(int i=0; i<0x8000; i++) {
+        if (w[i].code && w[i].entry) {
+            fprintf(out, "        case 0x%04x: goto L_%04x;\n", i << 1, i << 1);
+        }
+    }
+    fprintf(out,
+        "        default: goto bail;\n"
+        "    }\n"
+        "\n"
+        "    // hand over to the interpreter, or stop\n"
+        "bail:\n"
+        "    substate = -1;\n"
+        "stop:\n"
+        "    m->r[0] = r0; m->r[1] = r1; m->r[2] = r2; m->r[3] = r3;\n"
+        "    m->r[4] = r4; m->r[5] = r5; m->r[6] = r6; m->r[7] = r7;\n"
+        "    m->r[8] = r8; m->r[9] = r9; m->r[10] = r10; m->r[11] = r11;\n"
+        "    m->r[12] = r12; m->r[13] = r13; m->r[14] = r14; m->r[15] = pc;\n"
+        "    m->special_regs[FLAGS] = FLAGS_WORD;\n"
+        "    m->special_regs[USER_FLAGS] = sr1;\n"
+        "    m->special_regs[USER_R13] = sr2;\n"
+        "    m->special_regs[USER_R14] = sr3;\n"
+        "    m->instructions = I;\n"
+        "    m->cycles = C;\n"
+        "    for(int i=0; i<0x8000; i++) {\n"
+        "        if (mem_word(m, i) != mem[i]) mem_set_word(m, i, mem[i]);\n"
+        "    }\n"
+        "    return substate;\n"
+        "}\n"
+        "\n");
+}
+
+static void emit_main(void)
+{
+    fprintf(out,
+        "int main(int argc, char **argv)\n"
+        "{\n"
+        "    const char *save_file = 0;\n"
+        "    for(int i=1; i<argc; i++) {\n"
+        "        if ((!strcmp(argv[i], \"-s\") || !strcmp(argv[i], \"--save\")) && i+1 < argc) {\n"
+        "            save_file = argv[++i];\n"
+        "        } else {\n"
+        "            fprintf(stderr, \"usage: %%s [-s FILE]\\n\", argv[0]);\n"
+        "            exit(1);\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    cpu *m = cpu_new();\n"
+        "    for(int i=0; i<0x8000; i++) {\n"
+        "        mem_set_word(m, i, image[i]);\n"
+        "        code[i] = translated[i];\n"
+        "    }\n"
+        "\n"
+        "    // run translated code while we can, and interpret the rest\n"
+        "    if (run(m) < 0) {\n"
+        "        while(cpu_run(m, ~0ull) != RUN_STOPPED) {}\n"
+        "    }\n"
+        "\n"
+        "    printf(\"TRAP\\n\");\n"
+        "    if (save_file && cpu_save(m, save_file)) {\n"
+        "        fprintf(stderr, \"could not save %%s: %%s\\n\", save_file, strerror(errno));\n"
+        "        exit(1);\n"
+        "    }\n"
+        "    cpu_free(m);\n"
+        "    return 0;\n"
+        "}\n");
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: translate an assembled image to C\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -A, --asm FILE         read labels from FILE (default: out/asm.log)\n");
+    fprintf(stderr, "  -i, --image BASE       read BASE.0 and BASE.1 (default: out/mem.bin)\n");
+    fprintf(stderr, "  -o, --output FILE      write C to FILE (default: stdout)\n");
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *asm_file = "out/asm.log";
+    const char *image = "out/mem.bin";
+    const char *output = 0;
+
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-A") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-i") || !strcmp(argv[i], "--image")) && i+1 < argc) {
+            image = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-o") || !strcmp(argv[i], "--output")) && i+1 < argc) {
+            output = argv[++i];
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+
+    l = listing_load(asm_file);
+    if (l == 0) {
+        exit(1);
+    }
+    c = cpu_new();
+    if (cpu_load_image(c, image)) {
+        fprintf(stderr, "could not load %s.0, %s.1\n", image, image);
+        exit(1);
+    }
+
+    discover();
+    analyse();
+
+    out = output ? fopen(output, "w") : stdout;
+    if (out == 0) {
+        perror(output);
+        exit(1);
+    }
+    emit(image);
+    emit_main();
+    if (output && fclose(out) != 0) {
+        perror(output);
+        exit(1);
+    }
+
+    cpu_free(c);
+    listing_free(l);
+    return 0;
+}
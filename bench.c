@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+enum {
+    MAX_DEPTH = 16,         // regions open at once
+    NAME_SIZE = 64,
+
+    // the swi stopping a region is not counted
+    STOP_INSTRUCTIONS = 1,
+    STOP_CYCLES = 3
+};
+
+typedef struct
+{
+    u64 min;
+    u64 median;
+    u64 max;
+} summary;
+
+typedef struct region
+{
+    char name[NAME_SIZE];
+    u64 *instructions;      // per run
+    u64 *cycles;
+    int runs;
+    int size;
+} region;
+
+typedef struct
+{
+    int region;
+    u64 instructions;       // at the start
+    u64 cycles;
+} open_region;
+
+struct bench
+{
+    const listing *l;
+    region *regions;        // in order of first use
+    int num_regions;
+    open_region open[MAX_DEPTH];
+    int depth;
+    int lost;               // runs started too deep to record
+};
+
+bench *bench_new(const listing *l)
+{
+    bench *b = calloc(1, sizeof(bench));
+    b->l = l;
+    return b;
+}
+
+void bench_free(bench *b)
+{
+    if (b == 0) return;
+    for(int i=0; i<b->num_regions; i++) {
+        free(b->regions[i].instructions);
+        free(b->regions[i].cycles);
+    }
+    free(b->regions);
+    free(b);
+}
+
+static int find_region(bench *b, const char *name)
+{
+    for(int i=0; i<b->num_regions; i++) {
+        if (!strcmp(b->regions[i].name, name)) return i;
+    }
+    if ((b->num_regions & (b->num_regions-1)) == 0) {
+        int size = b->num_regions ? 2*b->num_regions : 8;
+        b->regions = realloc(b->regions, size * sizeof(region));
+    }
+    region *r = &b->regions[b->num_regions];
+    memset(r, 0, sizeof(region));
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    return b->num_regions++;
+}
+
+void bench_start(bench *b, const cpu *c, u16 name_addr)
+{
+    if (b->depth == MAX_DEPTH) {
+        b->lost++;
+        return;
+    }
+    char name[NAME_SIZE];
+    const char *label = b->l ? b->l->label[name_addr] : 0;
+    if (label) {
+        snprintf(name, sizeof(name), "%s", label);
+    } else {
+        snprintf(name, sizeof(name), "0x%04x", name_addr);
+    }
+    open_region *o = &b->open[b->depth++];
+    o->region = find_region(b, name);
+    o->instructions = c->instructions;
+    o->cycles = c->cycles;
+}
+
+int bench_stop(bench *b, const cpu *c)
+{
+    if (b->lost) {
+        b->lost--;
+        return 0;
+    }
+    if (b->depth == 0) return -1;
+
+    open_region *o = &b->open[--b->depth];
+    region *r = &b->regions[o->region];
+    if (r->runs == r->size) {
+        r->size = r->size ? 2*r->size : 64;
+        r->instructions = realloc(r->instructions, r->size * sizeof(u64));
+        r->cycles = realloc(r->cycles, r->size * sizeof(u64));
+    }
+    r->instructions[r->runs] = c->instructions - STOP_INSTRUCTIONS - o->instructions;
+    r->cycles[r->runs] = c->cycles - STOP_CYCLES - o->cycles;
+    r->runs++;
+    return 0;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    u64 x = *(const u64 *)a;
+    u64 y = *(const u64 *)b;
+    return x < y ? -1 : x > y;
+}
+
+static summary summarise(const u64 *values, int n)
+{
+    summary s = {0, 0, 0};
+    if (n == 0) return s;
+    u64 *sorted = malloc(n * sizeof(u64));
+    memcpy(sorted, values, n * sizeof(u64));
+    qsort(sorted, n, sizeof(u64), compare_u64);
+    s.min = sorted[0];
+    s.median = sorted[(n-1)/2];
+    s.max = sorted[n-1];
+    free(sorted);
+    return s;
+}
+
+static void write_summary(FILE *fp, const char *name, summary s)
+{
+    fprintf(fp, "\"%s\": {\"min\": %llu, \"median\": %llu, \"max\": %llu}",
+            name,
+            (unsigned long long)s.min,
+            (unsigned long long)s.median,
+            (unsigned long long)s.max);
+}
+
+void bench_write(const bench *b, FILE *fp)
+{
+    fprintf(fp, "{\n  \"regions\": [\n");
+    for(int i=0; i<b->num_regions; i++) {
+        const region *r = &b->regions[i];
+        fprintf(fp, "    {\"name\": \"%s\", \"runs\": %d, ", r->name, r->runs);
+        write_summary(fp, "instructions", summarise(r->instructions, r->runs));
+        fprintf(fp, ", ");
+        write_summary(fp, "cycles", summarise(r->cycles, r->runs));
+        fprintf(fp, "}%s\n", i+1 < b->num_regions ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+int bench_compare(const bench *b, const char *file, FILE *report)
+{
+    FILE *fp = fopen(file, "r");
+    if (fp == 0) return -1;
+
+    int regressions = 0;
+    char line[1024];
+    while(fgets(line, sizeof(line), fp)) {
+        char name[NAME_SIZE];
+        int runs;
+        unsigned long long v[6];    // instructions then cycles: min, median, max
+        int n = sscanf(line,
+                " {\"name\": \"%63[^\"]\", \"runs\": %d, "
+                "\"instructions\": {\"min\": %llu, \"median\": %llu, \"max\": %llu}, "
+                "\"cycles\": {\"min\": %llu, \"median\": %llu, \"max\": %llu}",
+                name, &runs, &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]);
+        if (n != 8) continue;
+
+        const region *r = 0;
+        for(int i=0; i<b->num_regions; i++) {
+            if (!strcmp(b->regions[i].name, name)) r = &b->regions[i];
+        }
+        if (r == 0 || r->runs == 0) {
+            fprintf(report, "REGRESSED %s: not run\n", name);
+            regressions++;
+            continue;
+        }
+
+        summary cy = { v[3], v[4], v[5] };
+        summary now = summarise(r->cycles, r->runs);
+        bool regressed = now.median > cy.median || now.max > cy.max;
+        bool improved = now.median < cy.median || now.max < cy.max;
+        if (regressed || improved) {
+            fprintf(report, "%s %s: cycles median %llu -> %llu, max %llu -> %llu\n",
+                    regressed ? "REGRESSED" : "IMPROVED", name,
+                    (unsigned long long)cy.median, (unsigned long long)now.median,
+                    (unsigned long long)cy.max, (unsigned long long)now.max);
+        }
+        regressions += regressed;
+    }
+    fclose(fp);
+    return regressions;
+}
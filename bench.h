@@ -0,0 +1,61 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// Benchmark regions, marked by vixen programs with semihosting calls (see
+// semihost.h):
+//
+//      mov r0, #hi(.f16_mul)       ; name the region after a label
+//      add r0, #lo(.f16_mul)
+//      swi #.SYS_BENCH_START
+//      ...                         ; measured
+//      swi #.SYS_BENCH_STOP
+//
+// Each region is named after the label at the address in r0 when it is
+// started - typically the routine measured - and may be entered any
+// number of times. Its instructions and cycles are everything executed
+// between the two swis, neither of which is counted. Regions may nest.
+//
+// The results are written as JSON, with one region per line:
+//
+//      {
+//        "regions": [
+//          {"name": "f16_mul", "runs": 2000, "instructions": {"min": 9, "median": 61, "max": 83}, "cycles": {...}},
+//          ...
+//        ]
+//      }
+//
+// and compared against a baseline in the same form, for which each
+// region's median and maximum cycles must not increase.
+
+#include <stdio.h>
+
+#include "cpu.h"
+#include "listing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct bench bench;
+
+// Regions are named from l, which may be 0.
+bench *bench_new(const listing *l);
+void bench_free(bench *b);
+
+// Start a region named after the label at name_addr.
+void bench_start(bench *b, const cpu *c, u16 name_addr);
+
+// Stop the innermost region started. Returns 0, or -1 if there is none.
+int bench_stop(bench *b, const cpu *c);
+
+void bench_write(const bench *b, FILE *fp);
+
+// Compare against the baseline in file, reporting differences to report.
+// Returns the number of regressions, or -1 if file could not be read.
+int bench_compare(const bench *b, const char *file, FILE *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
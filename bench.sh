@@ -0,0 +1,92 @@
+#!/bin/bash
+#
+# Runs the benchmarks in programs/bench, comparing each against its stored
+# baseline in programs/bench/*.json; fails if any region's median or
+# maximum cycles have increased. With --update, stores the results as the
+# new baselines instead.
+
+OUT="out/bench"
+SRC="programs/bench"
+MAX_INSTRUCTIONS=100000000  # so a routine which never returns can't hang the run
+
+UPDATE=0
+if [ "$1" = --update ]; then
+    UPDATE=1
+    shift
+fi
+
+if [ $# = 0 ]; then
+    SUITES=(f16_mul f16_div f16_add f16_sub f16_fma f16_vector f16_unary math gfx)
+else
+    SUITES=("$@")
+fi
+
+FAILED=0
+
+function run_bench() {
+    local suite="$1"; shift
+    local logs="$OUT/$suite"
+
+    rm -rf "$logs"
+    mkdir -p "$logs"
+    if ! ./asm.pl programs/semihost.asm "$@" > "$logs/asm.log"; then
+        echo >&2 "..."
+        tail >&2 "$logs/asm.log"
+        exit 1
+    fi
+
+    local baseline=()
+    [ $UPDATE = 0 ] && baseline=(--bench-baseline "$SRC/$suite.json")
+
+    echo "$suite"
+    if ! ./out/sim -q -A "$logs/asm.log" --entry .bench \
+            --max-instructions "$MAX_INSTRUCTIONS" \
+            --bench "$logs/bench.json" "${baseline[@]}"; then
+        FAILED=1
+    elif [ $UPDATE = 1 ]; then
+        cp "$logs/bench.json" "$SRC/$suite.json"
+    fi
+}
+
+function f16_binary() {
+    local op="$1" lib="$2"
+    run_bench "f16_$op" \
+        "$SRC/f16_binary.asm" \
+        "programs/f16/${op}_testdata.asm" \
+        programs/f16/internal.asm \
+        "programs/f16/$lib.asm"
+}
+
+for s in "${SUITES[@]}"; do
+    case "$s" in
+        f16_mul)    f16_binary mul mul ;;
+        f16_div)    f16_binary div div ;;
+        f16_add)    f16_binary add add_sub ;;
+        f16_sub)    f16_binary sub add_sub ;;
+        f16_fma)    run_bench f16_fma \
+                        "$SRC/f16_fma.asm" \
+                        programs/f16/fma_testdata.asm \
+                        programs/f16/internal.asm \
+                        programs/f16/fma.asm \
+                        programs/f16/mul.asm \
+                        programs/f16/add_sub.asm ;;
+        f16_vector) run_bench f16_vector \
+                        "$SRC/f16_vector.asm" \
+                        programs/f16/internal.asm \
+                        programs/f16/mul.asm \
+                        programs/f16/add_sub.asm \
+                        programs/f16/fma.asm \
+                        programs/f16/vector.asm ;;
+        f16_unary)  run_bench f16_unary \
+                        programs/f16/internal.asm \
+                        programs/f16/sqrt.asm \
+                        programs/f16/ftoa.asm \
+                        programs/f16/atof.asm \
+                        "$SRC/f16_unary.asm" ;;
+        math)       run_bench math programs/math.asm "$SRC/math.asm" ;;
+        gfx)        run_bench gfx programs/test_card.asm "$SRC/gfx.asm" ;;
+        *)          echo >&2 "unknown benchmark: $s"; exit 1 ;;
+    esac
+done
+
+exit $FAILED
@@ -0,0 +1,212 @@
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "coverage.h"
+
+// File layout: "vixcov" + version byte + 0, then executed, taken and
+// not_taken in turn.
+static const char coverage_magic[8] = {'v','i','x','c','o','v', 1, 0};
+
+enum { coverage_size = sizeof(coverage_magic) + sizeof(coverage) };
+
+static inline bool is_pred(u16 op)
+{
+    return (op & 0xff0f) == 0x3f0f && ((op >> 4) & 0xf) < 0xe;
+}
+
+static inline bool is_branch(u16 op)
+{
+    return (op & 0xe000) == 0xe000;
+}
+
+static inline void set_bit(u8 *bits, u16 addr)
+{
+    bits[addr >> 3] |= 1 << (addr & 7);
+}
+
+static inline bool get_bit(const u8 *bits, u16 addr)
+{
+    return (bits[addr >> 3] >> (addr & 7)) & 1;
+}
+
+coverage *coverage_new(void)
+{
+    coverage *cov = calloc(1, sizeof(coverage));
+    if (cov == 0) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    return cov;
+}
+
+void coverage_free(coverage *cov)
+{
+    free(cov);
+}
+
+void coverage_record(coverage *cov, cpu *c, u16 pc, u16 op)
+{
+    set_bit(cov->executed, pc);
+    if (is_pred(op)) {
+        if (c->r[15] == (u16)(pc + 4)) {
+            set_bit(cov->not_taken, pc);
+            u16 skipped = pc + 2;
+            if (is_branch(mem_rd(c, skipped, 1))) {
+                set_bit(cov->not_taken, skipped);
+            }
+        } else {
+            set_bit(cov->taken, pc);
+        }
+    }
+    else if (is_branch(op)) {
+        set_bit(cov->taken, pc);
+    }
+}
+
+int coverage_merge(coverage *cov, const char *file)
+{
+    FILE *fp = fopen(file, "rb");
+    if (fp == 0) return -1;
+
+    u8 *buf = malloc(coverage_size);
+    size_t n = buf ? fread(buf, 1, coverage_size, fp) : 0;
+    int err = (buf == 0 || ferror(fp)) ? errno : EINVAL;
+    fclose(fp);
+    if (n != coverage_size || memcmp(buf, coverage_magic, sizeof(coverage_magic))) {
+        free(buf);
+        errno = err;
+        return -1;
+    }
+
+    const u8 *saved = buf + sizeof(coverage_magic);
+    u8 *bits = (u8 *)cov;
+    for(size_t i=0; i<sizeof(coverage); i++) {
+        bits[i] |= saved[i];
+    }
+    free(buf);
+    return 0;
+}
+
+int coverage_save(const coverage *cov, const char *file)
+{
+    FILE *fp = fopen(file, "wb");
+    if (fp == 0) return -1;
+    int res = 0;
+    if (fwrite(coverage_magic, 1, sizeof(coverage_magic), fp) != sizeof(coverage_magic) ||
+            fwrite(cov, 1, sizeof(coverage), fp) != sizeof(coverage)) {
+        res = -1;
+    }
+    int err = errno;
+    if (fclose(fp) != 0) res = -1;
+    else errno = err;
+    return res;
+}
+
+static bool is_data(const char *text)
+{
+    static const char *directives[] = {"db", "dw", "dl", "ds"};
+    for(int i=0; i<4; i++) {
+        if (!strncasecmp(text, directives[i], 2) && (text[2] == 0 || isspace((u8)text[2]))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void percent(FILE *out, const char *what, int n, int total)
+{
+    fprintf(out, "%d/%d %s (%.1f%%)", n, total, what, total ? 100.0 * n / total : 100.0);
+}
+
+int coverage_write_listing(const coverage *cov, const char *asm_file, FILE *out)
+{
+    FILE *fp = fopen(asm_file, "r");
+    if (fp == 0) return -1;
+
+    // labels seen since the last line which emitted anything
+    char pending[64][128];
+    int num_pending = 0;
+
+    char *unreached = 0;        // labels of code never executed
+    size_t unreached_len = 0;
+
+    int insns = 0, insns_executed = 0;
+    int directions = 0, directions_taken = 0;
+    bool prev_pred = 0;         // the previous line was a pr*
+
+    char buf[1024];
+    while(fgets(buf, sizeof(buf), fp)) {
+        u16 addr;
+        u16 op;
+        int value_start = 0;
+        int value_end = 0;
+        int text = 0;
+
+        if (buf[0] == '.') {
+            if (num_pending < 64) {
+                snprintf(pending[num_pending++], sizeof(pending[0]), "%.*s",
+                        (int)strcspn(buf, "\r\n"), buf);
+            }
+            fprintf(out, "%9s %s", "", buf);
+            continue;
+        }
+        if (sscanf(buf, "%hx %n%hx%n ; %n", &addr, &value_start, &op, &value_end, &text) < 2 ||
+                value_end - value_start != 4 || (text && is_data(buf+text))) {
+            if (value_end) {
+                num_pending = 0;
+                prev_pred = 0;
+            }
+            fprintf(out, "%9s %s", "", buf);
+            continue;
+        }
+
+        bool executed = get_bit(cov->executed, addr);
+        insns++;
+        insns_executed += executed;
+        if (!executed) {
+            for(int i=0; i<num_pending; i++) {
+                size_t len = strlen(pending[i]);
+                unreached = realloc(unreached, unreached_len + len + 2);
+                sprintf(unreached + unreached_len, " %s", pending[i]);
+                unreached_len += len + 1;
+            }
+        }
+        num_pending = 0;
+
+        char branch[3] = "  ";
+        if (is_pred(op) || (is_branch(op) && prev_pred)) {
+            bool taken = get_bit(cov->taken, addr);
+            bool not_taken = get_bit(cov->not_taken, addr);
+            branch[0] = taken ? 't' : '-';
+            branch[1] = not_taken ? 'n' : '-';
+            directions += 2;
+            directions_taken += taken + not_taken;
+        }
+        prev_pred = is_pred(op);
+
+        fprintf(out, "%-6s %s %s", executed ? "" : "#####", branch, buf);
+    }
+    int err = errno;
+    bool failed = ferror(fp);
+    fclose(fp);
+    if (failed) {
+        free(unreached);
+        errno = err;
+        return -1;
+    }
+
+    fprintf(out, "; coverage: ");
+    percent(out, "instructions executed", insns_executed, insns);
+    fprintf(out, ", ");
+    percent(out, "branch directions taken", directions_taken, directions);
+    fprintf(out, "\n");
+    if (unreached) {
+        fprintf(out, "; never reached:%s\n", unreached);
+        free(unreached);
+    }
+    return 0;
+}
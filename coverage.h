@@ -0,0 +1,62 @@
+#ifndef COVERAGE_H
+#define COVERAGE_H
+
+// Statement and branch coverage, recorded by the simulator one step at a
+// time (see sim --coverage).
+//
+// Three 64K-bit bitmaps are kept, by byte address: the instructions
+// executed, and for each pr* and bra/bl which way it went. A pr* is taken
+// when its condition holds, and not taken when it skips the next
+// instruction; a bra or bl is taken when executed, and not taken when
+// skipped by the pr* before it.
+//
+// Coverage is saved to a file, and merged with what is already there, so
+// it accumulates over any number of runs of the same image - e.g. one per
+// batch of test vectors. It can then be written as the asm.pl listing,
+// annotated with what was not covered:
+//
+//             tn 4f52 3f3f ; prlo                  went both ways
+//             .tiny_delta
+//      #####     4f56 19a5 ; lsl a_exp, #10        never executed
+//             -n 000e 3f1f ; prne                  never taken
+//      #####  -n 0010 e00b ; bra .failure          (so never executed)
+//
+// followed by a summary naming the labels never reached.
+
+#include <stdio.h>
+
+#include "cpu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct coverage
+{
+    u8 executed[0x10000 / 8];
+    u8 taken[0x10000 / 8];
+    u8 not_taken[0x10000 / 8];
+} coverage;
+
+coverage *coverage_new(void);
+void coverage_free(coverage *cov);
+
+// Record a step of c, which has just executed op from address pc.
+void coverage_record(coverage *cov, cpu *c, u16 pc, u16 op);
+
+// Add the coverage saved in file to cov. Returns 0 on success, or -1 with
+// errno set (ENOENT if there is no such file).
+int coverage_merge(coverage *cov, const char *file);
+
+// Save cov to file. Returns 0 on success, or -1 with errno set.
+int coverage_save(const coverage *cov, const char *file);
+
+// Write the listing asm_file, as printed by asm.pl, annotated with cov.
+// Returns 0 on success, or -1 with errno set if asm_file can't be read.
+int coverage_write_listing(const coverage *cov, const char *asm_file, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,776 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu.h"
+
+//------------------------------------------------------------------------------
+// Machine lifetime
+//
+
+static page *page_new(void)
+{
+    page *p = malloc(sizeof(page));
+    if (p == 0) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    p->refs = 1;
+    return p;
+}
+
+static void page_release(page *p)
+{
+    if (__atomic_sub_fetch(&p->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(p);
+    }
+}
+
+// Give c its own copy of a shared page, prior to writing to it.
+page *page_unshare(cpu *c, int index)
+{
+    page *old = c->pages[index];
+    page *p = page_new();
+    memcpy(p->w, old->w, sizeof(p->w));
+    c->pages[index] = p;
+    page_release(old);
+    c->pages_copied++;
+    return p;
+}
+
+cpu *cpu_new(void)
+{
+    cpu *c = calloc(1, sizeof(cpu));
+    if (c == 0) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    // all pages start out sharing a single zeroed page
+    page *zero = page_new();
+    memset(zero->w, 0, sizeof(zero->w));
+    zero->refs = NUM_PAGES;
+    for(int i=0; i<NUM_PAGES; i++) c->pages[i] = zero;
+
+    cpu_reset(c);
+    return c;
+}
+
+void cpu_copy(cpu *dst, const cpu *src)
+{
+    if (dst == src) return;
+    for(int i=0; i<NUM_PAGES; i++) {
+        if (dst->pages[i] == src->pages[i]) continue;
+        __atomic_add_fetch(&src->pages[i]->refs, 1, __ATOMIC_RELAXED);
+        if (dst->pages[i] == 0) continue;
+        // predecoded instructions stay good for pages which are unchanged
+        if (dst->decoded && dst->pages[i] != src->pages[i]) {
+            memset(&dst->decoded[i << PAGE_SHIFT], 0, PAGE_WORDS * sizeof(insn));
+            // and those before it, which may be fused with instructions in it
+            u16 before = (i << PAGE_SHIFT) - 1;
+            dst->decoded[before & 0x7fff].kind = 0;
+            dst->decoded[(before-1) & 0x7fff].kind = 0;
+        }
+        page_release(dst->pages[i]);
+    }
+
+    // the predecoded instructions belong to dst
+    insn *decoded = dst->decoded;
+    const struct stops *decoded_for = dst->decoded_for;
+    int decoded_version = dst->decoded_version;
+    u8 code_page[NUM_PAGES];
+    memcpy(code_page, dst->code_page, sizeof(code_page));
+    u64 code_writes = dst->code_writes;
+    u64 code_discarded = dst->code_discarded;
+    u8 *edges = dst->edges;
+    u64 new_edges = dst->new_edges;
+    *dst = *src;
+    dst->pages_copied = 0;
+    dst->decoded = decoded;
+    dst->decoded_for = decoded_for;
+    dst->decoded_version = decoded_version;
+    memcpy(dst->code_page, code_page, sizeof(code_page));
+    dst->code_writes = code_writes;
+    dst->code_discarded = code_discarded;
+    dst->edges = edges;
+    dst->new_edges = new_edges;
+}
+
+void cpu_flush_decoded(cpu *c)
+{
+    if (c->decoded) {
+        memset(c->decoded, 0, 0x8000 * sizeof(insn));
+    }
+    memset(c->code_page, 0, sizeof(c->code_page));
+}
+
+// Word i, in a page marked as holding code, is being written: discard the
+// insns which depend on it.
+void code_written(cpu *c, u16 i)
+{
+    c->code_writes++;
+    for(int j=0; j<3; j++) {
+        insn *d = &c->decoded[(i-j) & 0x7fff];
+        if (d->kind) {
+            d->kind = 0;
+            c->code_discarded++;
+        }
+    }
+}
+
+cpu *cpu_fork(const cpu *c)
+{
+    cpu *f = calloc(1, sizeof(cpu));
+    if (f == 0) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    cpu_copy(f, c);
+    return f;
+}
+
+void cpu_free(cpu *c)
+{
+    if (c == 0) return;
+    for(int i=0; i<NUM_PAGES; i++) page_release(c->pages[i]);
+    free(c->decoded);
+    free(c);
+}
+
+void cpu_reset(cpu *c)
+{
+    for(int i=0; i<16; i++) c->r[i] = 0;
+    for(int i=0; i<4; i++) c->special_regs[i] = 0;
+    c->instructions = 0;
+    c->cycles = 0;
+    c->stored = 0;
+    c->loaded = 0;
+}
+
+int cpu_load_image(cpu *c, const char *base)
+{
+    char hi_file[1024];
+    char lo_file[1024];
+    snprintf(hi_file, sizeof(hi_file), "%s.0", base);
+    snprintf(lo_file, sizeof(lo_file), "%s.1", base);
+
+    FILE* hi_fp = fopen(hi_file, "r");
+    FILE* lo_fp = fopen(lo_file, "r");
+    if (hi_fp == 0 || lo_fp == 0) {
+        int err = errno;
+        if (hi_fp) fclose(hi_fp);
+        if (lo_fp) fclose(lo_fp);
+        errno = err;
+        return -1;
+    }
+    for(int i=0; i<0x8000; i++) {
+        u8 hi, lo;
+        if (fscanf(hi_fp, "%hhx", &hi) != 1 || fscanf(lo_fp, "%hhx", &lo) != 1) {
+            fclose(hi_fp);
+            fclose(lo_fp);
+            errno = EINVAL;
+            return -1;
+        }
+        mem_set_word(c, i, (u16)hi<<8 | lo);
+    }
+    fclose(hi_fp);
+    fclose(lo_fp);
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Execution
+//
+
+static inline u16 rd(cpu *c, int i)
+{
+    c->touched_reg[i] |= TOUCH_RD;
+    return c->r[i];
+}
+
+static inline void wr(cpu *c, int i, u16 value)
+{
+    c->touched_reg[i] |= TOUCH_WR;
+    c->r[i] = value;
+}
+
+static inline void touch_skip(cpu *c)
+{
+    c->touched_skip = 1;
+}
+
+static inline void untouch_all(cpu *c)
+{
+    for(int i=0; i<16; i++) c->touched_reg[i] = 0;
+    c->touched_skip = 0;
+}
+
+u16 mem_rd(cpu *c, u16 addr, bool wide)
+{
+    u16 addr_hi = addr >> 1;
+    u16 addr_lo = ((addr+1) >> 1) & 0x7fff;   // wraps, as in memory.v
+    bool aligned = (addr & 1) == 0;
+
+    if (wide) {
+        if (aligned) {
+            return mem_word(c, addr_hi);
+        } else {
+            return mem_word(c, addr_hi) << 8 | mem_word(c, addr_lo) >> 8;
+        }
+    }
+    else {
+        if (aligned) {
+            return mem_word(c, addr_hi) >> 8;
+        } else {
+            return mem_word(c, addr_hi) & 0xff;
+        }
+    }
+}
+
+void mem_wr(cpu *c, u16 addr, bool wide, u16 data)
+{
+    u16 addr_hi = addr >> 1;
+    u16 addr_lo = ((addr+1) >> 1) & 0x7fff;   // wraps, as in memory.v
+    bool aligned = (addr & 1) == 0;
+
+    u16 *hi = mem_word_wr(c, addr_hi);
+    if (wide) {
+        if (aligned) {
+            *hi = data;
+        } else {
+            u16 *lo = mem_word_wr(c, addr_lo);
+            *hi = (*hi & 0xff00) | (data >> 8);
+            *lo = (*lo & 0x00ff) | (data << 8);
+        }
+    }
+    else {
+        if (aligned) {
+            *hi = (*hi & 0x00ff) | (data << 8);
+        } else {
+            *hi = (*hi & 0xff00) | (data & 0xff);
+        }
+    }
+}
+
+static u16 clz(u16 val)
+{
+    if (!val) return 16;
+    u16 i = 0;
+    for( ; !(val & 0x8000); val <<= 1) i++;
+    return i;
+}
+
+// Clock cycles taken by each substate, counting from the FETCH2 which
+// latches the instruction up to the next FETCH2. See the state machine
+// in vixen.v.
+static const u8 substate_cycles[] = {
+    [SS_NOP]        = 2,    // FETCH2 EXECUTE
+    [SS_ALU]        = 2,
+    [SS_LOAD]       = 4,    // FETCH2 EXECUTE LOAD LOAD2
+    [SS_STORE]      = 3,    // FETCH2 EXECUTE FETCH
+    [SS_RD_FLAGS]   = 2,
+    [SS_WR_FLAGS]   = 2,
+    [SS_RD_SPECIAL] = 2,
+    [SS_WR_SPECIAL] = 2,
+    [SS_SWI]        = 3,    // FETCH2 EXECUTE FETCH
+    [SS_RTU]        = 2,
+    [SS_BRANCH]     = 2,
+    [SS_PRED]       = 2,
+    [SS_HALT]       = 2,
+    [SS_TRAP]       = 3,    // FETCH2 EXECUTE FETCH
+};
+
+// An instruction skipped by a failed predicate costs FETCH2 FETCH.
+static const u8 skip_cycles = 2;
+
+#define t(args...) do { if (c->want_disasm) sprintf(c->disasm, args); } while(0)
+
+int execute(cpu *c, u16 op)
+{
+    c->stored = 0;
+    c->loaded = 0;
+
+    u8 dst          = (op >> 0)  & 0x0f;
+    u8 src          = (op >> 4)  & 0x0f;
+    u8 num4         = (op >> 4)  & 0x0f;
+    u8 num5         = (op >> 8)  & 0x1f;
+    u8 num8         = (op >> 4)  & 0xff;
+    u8 sign         = (op >> 12) & 0x1;
+    u8 major_cat    = (op >> 14) & 0x3;
+    u8 arithlog_cat = (op >> 8)  & 0x3f;
+    u8 mov8_br      = (op >> 12) & 0x3;
+    u8 ldst_wide    = (op >> 13) & 0x1;
+    u8 ldst_base    = (op >> 4)  & 0xf;
+    u8 ldst_target  = (op >> 0)  & 0xf;
+    u8 pred_cond    = (op >> 4)  & 0xf;
+    u16 br_offset   = (op >> 0)  & 0xfff;
+    u8 special_reg  = (op >> 4)  & 0xf;
+
+    u16 cin = (c->special_regs[FLAGS] & FLAG_C) != 0;
+    u16 cout;
+    u32 res;
+
+    int substate = SS_TRAP;
+
+    bool mov_op   = 0;
+    bool sub_op   = 0;
+    bool add_op   = 0;
+    bool trap_op  = 0;
+    bool logic_op = 0;
+    bool cmp_op   = 0;
+    bool shift_op = 0;
+    bool tst_op   = 0;
+    bool signs_ne = 0;
+
+    u16 ldst_addr = 0;
+
+    bool br_link = 0;
+    u16 br_addr = 0;
+
+    bool pred_true = 0;
+
+    bool flag_n = (c->special_regs[FLAGS] & FLAG_N) != 0;
+    bool flag_z = (c->special_regs[FLAGS] & FLAG_Z) != 0;
+    bool flag_c = (c->special_regs[FLAGS] & FLAG_C) != 0;
+    bool flag_v = (c->special_regs[FLAGS] & FLAG_V) != 0;
+
+    u8 special_special = 0;
+
+    if (major_cat == 0x00) {
+        substate = SS_ALU;
+        signs_ne = (c->r[dst] ^ c->r[src]) >> 15;
+        switch(arithlog_cat) {
+            case 0x00: t("mov r%d, r%d", dst, src); mov_op = 1; res = rd(c, src); break;
+            case 0x01: t("mvn r%d, r%d", dst, src); mov_op = 1; res = (u16)~rd(c, src); break;
+            case 0x02: t("adc r%d, r%d", dst, src); add_op = 1; res = (u32)rd(c, dst) + rd(c, src) + cin; break;
+            case 0x03: t("sbc r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(c, dst) + (u16)~rd(c, src) + cin; break;
+            case 0x04: t("add r%d, r%d", dst, src); add_op = 1; res = (u32)rd(c, dst) + rd(c, src); break;
+            case 0x05: t("sub r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(c, dst) + (u16)~rd(c, src) + 1u; break;
+            case 0x06: t("rsc r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(c, src) + (u16)~rd(c, dst) + cin; break;
+            case 0x07: t("rsb r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(c, src) + (u16)~rd(c, dst) + 1u; break;
+
+            case 0x08: t("clz r%d, r%d", dst, src); mov_op = 1; res = clz(rd(c, src)); break;
+            case 0x09: t("???");                    substate = SS_TRAP; break;
+            case 0x0a: t("mul r%d, r%d", dst, src); logic_op = 1; res = ((u32)rd(c, dst) * rd(c, src)) & 0xffff; break;
+            case 0x0b: t("muh r%d, r%d", dst, src); logic_op = 1; res = ((u32)rd(c, dst) * rd(c, src)) >> 16; break;
+            case 0x0c: t("and r%d, r%d", dst, src); logic_op = 1; res = rd(c, dst) & rd(c, src); break;
+            case 0x0d: t("cmp r%d, r%d", dst, src); cmp_op = 1; res = (u32)rd(c, dst) + (u16)~rd(c, src) + 1u; break;
+            case 0x0e: t("cmn r%d, r%d", dst, src); cmp_op = 1; res = (u32)rd(c, dst) + rd(c, src); break;
+            case 0x0f: t("???");                    substate = SS_TRAP; break;
+
+            // ROR
+            case 0x10:
+                t("ror r%d, r%d", dst, src);
+                if ((rd(c, src) & 0xf)==0) {
+                    logic_op = 1;
+                    res = rd(c, dst);
+                } else {
+                    shift_op = 1;
+                    res = rd(c, dst) << (16u-(rd(c, src) & 0xf)) |
+                        rd(c, dst) >>      (rd(c, src) & 0xf);
+                    cout = (rd(c, dst) >> ((rd(c, src)-1u) & 0xf)) & 1;
+                }
+                break;
+            // LSL
+            case 0x11:
+                t("lsl r%d, r%d", dst, src);
+                shift_op = 1;
+                if (rd(c, src) > 16u) {
+                    // vixen.v shifts 17 bits (carry:value), so all are lost
+                    res = 0;
+                    cout = 0;
+                } else if (rd(c, src) > 0u) {
+                    res = (u32)rd(c, dst) << rd(c, src);
+                    cout = (rd(c, src) <= 16u) && ((rd(c, dst) >> (16u-rd(c, src))) & 1);
+                } else {
+                    res = rd(c, dst);
+                    cout = 0;
+                }
+                break;
+            // LSR
+            case 0x12:
+                t("lsr r%d, r%d", dst, src);
+                shift_op = 1;
+                if (rd(c, src) > 16u) {
+                    res = 0;
+                    cout = 0;
+                } else if (rd(c, src) > 0u) {
+                    res = rd(c, dst) >> rd(c, src);
+                    cout = (rd(c, dst) >> (rd(c, src)-1u)) & 1;
+                } else {
+                    res = rd(c, dst);
+                    cout = 0;
+                }
+                break;
+            // ASR
+            case 0x13:
+                t("asr r%d, r%d", dst, src);
+                shift_op = 1;
+                if (rd(c, src) > 16u) {
+                    // only copies of the sign bit remain, in both value and carry
+                    res = (rd(c, dst) & 0x8000) ? 0xffff : 0;
+                    cout = rd(c, dst) >> 15;
+                } else if (rd(c, src) > 0u) {
+                    res = rd(c, dst) >> rd(c, src);
+                    if (rd(c, dst) & 0x8000) res |= (~0) << (16u-rd(c, src));
+                    cout = (rd(c, dst) >> (rd(c, src)-1u)) & 1;
+                } else {
+                    res = rd(c, dst);
+                    cout = 0;
+                }
+                break;
+
+            case 0x14: t("orr r%d, r%d", dst, src); logic_op = 1; res = rd(c, dst) | rd(c, src); break;
+            case 0x15: t("eor r%d, r%d", dst, src); logic_op = 1; res = rd(c, dst) ^ rd(c, src); break;
+            case 0x16: t("bic r%d, r%d", dst, src); logic_op = 1; res = rd(c, dst) & ~rd(c, src); break;
+            case 0x17: t("tst r%d, r%d", dst, src); tst_op = 1;   res = rd(c, dst) & rd(c, src); break;
+
+            // RRX / ROR#
+            case 0x18:
+                shift_op = 1;
+                if (num4 == 0) {
+                    t("rrx r%d", dst);
+                    res = (cin ? 0x8000 : 0) | (rd(c, dst) >> 1);
+                    cout = rd(c, dst) & 1;
+                } else {
+                    t("ror r%d, #%d", dst, num4);
+                    shift_op = 1;
+                    res = rd(c, dst) << (16u-num4) |
+                        rd(c, dst) >>      num4;
+                    cout = (rd(c, dst) >> (num4-1u)) & 1;
+                }
+                break;
+
+            case 0x19:
+                t("lsl r%d, #%d", dst, num4);
+                shift_op = 1;
+                if (num4 > 0u) {
+                    res = rd(c, dst) << num4;
+                    cout = (rd(c, dst) >> (16u-num4)) & 1;
+                } else {
+                    res = rd(c, dst);
+                    cout = 0;
+                }
+                break;
+            case 0x1a:
+                t("lsr r%d, #%d", dst, num4);
+                shift_op = 1;
+                if (num4 > 0u) {
+                    res = rd(c, dst) >> num4;
+                    cout = (rd(c, dst) >> (num4-1u)) & 1;
+                } else {
+                    res = rd(c, dst);
+                    cout = 0;
+                }
+                break;
+            case 0x1b:
+                t("asr r%d, #%d", dst, num4);
+                shift_op = 1;
+                if (num4 > 0u) {
+                    res = rd(c, dst) >> num4;
+                    if (rd(c, dst) & 0x8000) res |= (~0) << (16u-num4);
+                    cout = (rd(c, dst) >> (num4-1u)) & 1;
+                } else {
+                    res = rd(c, dst);
+                    cout = 0;
+                }
+                break;
+
+            case 0x1c: t("orr r%d, #bit %d", dst, num4); logic_op = 1; res = rd(c, dst) | (1<<num4); break;
+            case 0x1d: t("eor r%d, #bit %d", dst, num4); logic_op = 1; res = rd(c, dst) ^ (1<<num4); break;
+            case 0x1e: t("bic r%d, #bit %d", dst, num4); logic_op = 1; res = rd(c, dst) & ~(1<<num4); break;
+            case 0x1f: t("tst r%d, #bit %d", dst, num4); tst_op = 1;   res = rd(c, dst) & (1<<num4); break;
+
+            default:
+                if (dst != 0xf) {
+                    add_op = 1;
+                    signs_ne = (rd(c, dst)>>15) != sign;
+                    if (sign == 0) {
+                        t("add r%d, #0x%02x", dst, num8);
+                        res = (u32)rd(c, dst) + num8;
+                    } else {
+                        u16 delta = (u16)num8 | 0xff00;
+                        t("sub r%d, #0x%02x", dst, -(signed short)delta);
+                        res = (u32)rd(c, dst) + delta;
+                    }
+                }
+                else if ((op>>8 & 0x1f) == 0x1f) {
+                    substate = SS_PRED;
+                    switch(pred_cond) {
+                        case 0x0: t("preq"); pred_true = flag_z; break;
+                        case 0x1: t("prne"); pred_true = !flag_z; break;
+                        case 0x2: t("prcs"); pred_true = flag_c; break;
+                        case 0x3: t("prcc"); pred_true = !flag_c; break;
+                        case 0x4: t("prmi"); pred_true = flag_n; break;
+                        case 0x5: t("prpl"); pred_true = !flag_n; break;
+                        case 0x6: t("prvs"); pred_true = flag_v; break;
+                        case 0x7: t("prvc"); pred_true = !flag_v; break;
+                        case 0x8: t("prhi"); pred_true = flag_c && !flag_z; break;
+                        case 0x9: t("prls"); pred_true = !flag_c || flag_z; break;
+                        case 0xa: t("prge"); pred_true = flag_n == flag_v; break;
+                        case 0xb: t("prlt"); pred_true = flag_n != flag_v; break;
+                        case 0xc: t("prgt"); pred_true = !flag_z && (flag_n == flag_v); break;
+                        case 0xd: t("prle"); pred_true = flag_z || (flag_n ^ flag_v); break;
+                        case 0xe: t("nop"); substate = SS_NOP; break;
+                        case 0xf: t("hlt"); substate = SS_HALT; break;
+                    }
+                }
+                else if ((op & 0xf00f) == 0x200f) {
+                    t("swi #%d", num8);
+                    substate = SS_SWI;
+                }
+                else switch(op & 0xff0f) {
+                    case 0x300f: t("mrs r%d, flags", special_reg); substate = SS_RD_FLAGS; break;
+                    case 0x310f: t("msr flags, r%d", special_reg); substate = SS_WR_FLAGS; break;
+                    case 0x320f: t("mrs r%d, uflags", special_reg); substate = SS_RD_SPECIAL; special_special = USER_FLAGS; break;
+                    case 0x330f: t("msr uflags, r%d", special_reg); substate = SS_WR_SPECIAL; special_special = USER_FLAGS; break;
+                    case 0x340f: t("mrs r%d, u13", special_reg); substate = SS_RD_SPECIAL; special_special = USER_R13; break;
+                    case 0x350f: t("msr u13, r%d", special_reg); substate = SS_WR_SPECIAL; special_special = USER_R13; break;
+                    case 0x360f: t("mrs r%d, u14", special_reg); substate = SS_RD_SPECIAL; special_special = USER_R14; break;
+                    case 0x370f: t("msr u14, r%d", special_reg); substate = SS_WR_SPECIAL; special_special = USER_R14; break;
+                    case 0x380f: t("rtu r%d", special_reg); substate = SS_RTU; break;
+                    default: t("???"); substate = SS_TRAP; break;
+                }
+                break;
+        }
+    }
+    else if (major_cat == 0x01) {
+        if (ldst_wide) {
+            t("ldw r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
+        } else {
+            t("ldb r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
+        }
+        substate = SS_LOAD;
+        ldst_addr = rd(c, ldst_base) + num5;
+    }
+    else if (major_cat == 0x02) {
+        if (ldst_wide) {
+            t("stw r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
+        } else {
+            t("stb r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
+        }
+        substate = SS_STORE;
+        ldst_addr = rd(c, ldst_base) + num5;
+    }
+    else if (major_cat == 0x03) {
+        switch(mov8_br) {
+            case 0x0: t("mov r%d, #0x00%02x", dst, num8); substate = SS_ALU; mov_op = 1; res = (u16)num8; break;
+            case 0x1: t("mov r%d, #0x%02x00", dst, num8); substate = SS_ALU; mov_op = 1; res = (u16)num8 << 8; break;
+            default:
+                substate = SS_BRANCH;
+                br_link = mov8_br == 0x3;
+                if (br_offset & 0x800) {
+                    br_addr = c->r[15] + (br_offset<<1 | 0xf000);
+                } else {
+                    br_addr = c->r[15] + (br_offset<<1);
+                }
+                if (br_link) {
+                    t("bl 0x%04x", br_addr);
+                } else {
+                    t("bra 0x%04x", br_addr);
+                }
+                break;
+        }
+    }
+
+    if (add_op | sub_op | cmp_op) cout = (res >> 16) & 1;
+
+    bool wr_reg = add_op | sub_op          | shift_op | logic_op | mov_op ;
+    bool wr_nz  = add_op | sub_op | cmp_op | shift_op | logic_op | tst_op ;
+    bool wr_c   = add_op | sub_op | cmp_op | shift_op                     ;
+    bool wr_v   = add_op | sub_op | cmp_op                                ;
+    bool nout = (res >> 15) & 1;
+    bool zout = (res & 0xffff) == 0;
+    bool vout = nout ^ signs_ne ^ cout ^ (sub_op | cmp_op);
+
+    switch(substate) {
+        case SS_NOP:
+            break;
+        case SS_ALU:
+            if (wr_reg) {
+                wr(c, dst, res);
+            }
+            u16 fl = c->special_regs[FLAGS];
+            if (wr_nz) { fl &= ~FLAG_N; fl |= (nout ? FLAG_N : 0); }
+            if (wr_nz) { fl &= ~FLAG_Z; fl |= (zout ? FLAG_Z : 0); }
+            if (wr_c)  { fl &= ~FLAG_C; fl |= (cout ? FLAG_C : 0); }
+            if (wr_v)  { fl &= ~FLAG_V; fl |= (vout ? FLAG_V : 0); }
+            c->special_regs[FLAGS] = fl;
+            break;
+
+        case SS_LOAD:
+            wr(c, ldst_target, mem_rd(c, ldst_addr, ldst_wide));
+            c->loaded = 1;
+            c->load_wide = ldst_wide;
+            c->load_addr = ldst_addr;
+            if (c->trace_read) {
+                printf("READ %s [%04x] => %04x\n", ldst_wide ? "WORD" : "BYTE", ldst_addr, c->r[ldst_target]);
+            }
+            break;
+        case SS_STORE:
+            if (c->trace_write) {
+                printf("WRITE %s [%04x] <= %04x\n", ldst_wide ? "WORD" : "BYTE", ldst_addr, c->r[ldst_target]);
+            }
+            c->store_old = mem_rd(c, ldst_addr, ldst_wide);
+            mem_wr(c, ldst_addr, ldst_wide, c->r[ldst_target]);
+            c->stored = 1;
+            c->store_wide = ldst_wide;
+            c->store_addr = ldst_addr;
+            c->store_data = c->r[ldst_target];
+            break;
+        case SS_RD_FLAGS:
+            wr(c, special_reg, c->special_regs[FLAGS]);
+            break;
+        case SS_WR_FLAGS:
+            c->special_regs[FLAGS] = rd(c, special_reg);
+            break;
+        case SS_BRANCH:
+            if (br_link) {
+                wr(c, 14, c->r[15]);
+            }
+            c->r[15] = br_addr;
+            break;
+        case SS_PRED:
+            if (!pred_true) {
+                touch_skip(c);
+                c->r[15] += 2;
+                c->cycles += skip_cycles;
+            }
+            break;
+        case SS_RD_SPECIAL:
+            wr(c, special_reg, c->special_regs[special_special]);
+            break;
+        case SS_WR_SPECIAL:
+            c->special_regs[special_special] = rd(c, special_reg);
+            break;
+        case SS_SWI:
+        case SS_RTU:
+        case SS_HALT:
+        case SS_TRAP:
+            // left to the caller
+            break;
+    }
+
+    c->instructions++;
+    c->cycles += substate_cycles[substate];
+    return substate;
+}
+
+u32 op_writes(u16 op)
+{
+    const u32 pc = 1u << 15;
+    const u32 flags = 1u << 16;
+    u8 dst = op & 0xf;
+
+    switch(op >> 14) {
+        case 0:
+            if (((op >> 8) & 0x3f) < 0x20 || dst != 0xf) {
+                // alu, including those which only set flags
+                return 1u << dst | flags;
+            }
+            // pr*, swi, mrs, msr, rtu
+            return 1u << ((op >> 4) & 0xf) | pc | flags;
+        case 1:
+            return 1u << dst;
+        case 2:
+            return 0;
+        default:
+            switch((op >> 12) & 0x3) {
+                case 0:
+                case 1: return 1u << dst;
+                case 2: return pc;
+                default: return pc | 1u << 14;
+            }
+    }
+}
+
+int cpu_step(cpu *c)
+{
+    u16 pc = c->r[15];
+    u16 op = mem_rd(c, pc, 1);
+    c->r[15] = pc + 2;
+    c->resume_break = 0;
+    untouch_all(c);
+    return execute(c, op);
+}
+
+//------------------------------------------------------------------------------
+// Snapshots
+//
+// Layout, all values little endian:
+//      +0      "vixsnap" + version byte
+//      +8      r0-r15
+//      +40     special_regs[4]
+//      +48     instructions (64 bits)
+//      +56     cycles (64 bits)
+//      +64     memory, as 0x8000 words
+//
+// The simulator models no devices, so there is no device state to save.
+
+static const char snapshot_magic[8] = {'v','i','x','s','n','a','p', 1};
+
+enum { snapshot_size = 64 + 2*0x8000 };
+
+static u8 *put16(u8 *p, u16 v) { p[0] = v; p[1] = v>>8; return p+2; }
+static u8 *put64(u8 *p, u64 v) { for(int i=0; i<8; i++) p[i] = v >> 8*i; return p+8; }
+
+static const u8 *get16(const u8 *p, u16 *v) { *v = p[0] | p[1]<<8; return p+2; }
+static const u8 *get64(const u8 *p, u64 *v) { *v = 0; for(int i=0; i<8; i++) *v |= (u64)p[i] << 8*i; return p+8; }
+
+int cpu_save(const cpu *c, const char *file)
+{
+    u8 *buf = malloc(snapshot_size);
+    if (buf == 0) return -1;
+    u8 *p = buf;
+
+    memcpy(p, snapshot_magic, sizeof(snapshot_magic));
+    p += sizeof(snapshot_magic);
+    for(int i=0; i<16; i++) p = put16(p, c->r[i]);
+    for(int i=0; i<4; i++) p = put16(p, c->special_regs[i]);
+    p = put64(p, c->instructions);
+    p = put64(p, c->cycles);
+    for(int i=0; i<0x8000; i++) p = put16(p, mem_word(c, i));
+
+    int res = -1;
+    FILE *fp = fopen(file, "wb");
+    if (fp != 0) {
+        res = fwrite(buf, 1, snapshot_size, fp) == snapshot_size ? 0 : -1;
+        int err = errno;
+        if (fclose(fp) != 0) res = -1;
+        else errno = err;
+    }
+    free(buf);
+    return res;
+}
+
+int cpu_load(cpu *c, const char *file)
+{
+    FILE *fp = fopen(file, "rb");
+    if (fp == 0) return -1;
+
+    u8 *buf = malloc(snapshot_size);
+    size_t n = buf ? fread(buf, 1, snapshot_size, fp) : 0;
+    int err = (buf == 0 || ferror(fp)) ? errno : EINVAL;
+    fclose(fp);
+    if (n != snapshot_size || memcmp(buf, snapshot_magic, sizeof(snapshot_magic))) {
+        free(buf);
+        errno = err;
+        return -1;
+    }
+
+    const u8 *p = buf + sizeof(snapshot_magic);
+    for(int i=0; i<16; i++) p = get16(p, &c->r[i]);
+    for(int i=0; i<4; i++) p = get16(p, &c->special_regs[i]);
+    p = get64(p, &c->instructions);
+    p = get64(p, &c->cycles);
+    for(int i=0; i<0x8000; i++) {
+        u16 w;
+        p = get16(p, &w);
+        mem_set_word(c, i, w);
+    }
+    c->stored = 0;
+    c->loaded = 0;
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,221 @@
+#ifndef CPU_H
+#define CPU_H
+
+// vixen cpu core - shared by the tracing simulator (sim.c) and the
+// tools which need to drive the cpu directly (e.g. lockstep.cpp).
+
+#ifdef __cplusplus
+extern "C" {
+#else
+typedef unsigned char bool;
+#endif
+
+typedef unsigned char u8;
+typedef unsigned short u16;
+typedef unsigned long u32;
+typedef unsigned long long u64;
+
+enum {
+    FLAGS      = 0,
+    USER_FLAGS = 1,
+    USER_R13   = 2,
+    USER_R14   = 3
+};
+
+enum {
+    FLAG_N = 1<<15,
+    FLAG_Z = 1<<14,
+    FLAG_C = 1<<13,
+    FLAG_V = 1<<12,
+    FLAG_I = 1<<0
+};
+
+// execution substates - these mirror the SS_* states in vixen.v
+enum {
+    SS_NOP        = 0,
+    SS_ALU        = 1,
+    SS_LOAD       = 2,
+    SS_STORE      = 3,
+    SS_RD_FLAGS   = 4,
+    SS_WR_FLAGS   = 5,
+    SS_RD_SPECIAL = 6,
+    SS_WR_SPECIAL = 7,
+    SS_SWI        = 8,
+    SS_RTU        = 9,
+    SS_BRANCH     = 10,
+    SS_PRED       = 11,
+    SS_HALT       = 12,
+    SS_TRAP       = 13
+};
+
+enum {
+    TOUCH_RD = 1,
+    TOUCH_WR = 2
+};
+
+// Memory is held in pages of 128 words (256 bytes). Pages are reference
+// counted, and shared copy-on-write between a cpu and those forked from it,
+// so a fork costs only the page table, and each fork pays for the pages it
+// writes to.
+enum {
+    PAGE_SHIFT = 7,
+    PAGE_WORDS = 1 << PAGE_SHIFT,
+    PAGE_MASK  = PAGE_WORDS - 1,
+    NUM_PAGES  = 0x8000 >> PAGE_SHIFT
+};
+
+typedef struct page
+{
+    int refs;
+    u16 w[PAGE_WORDS];
+} page;
+
+// A predecoded instruction, for cpu_run() - see engine.c. There is one
+// for each word of memory, decoded on first execution and discarded when
+// the word, or either of the two words after it, is written to (as it may
+// be fused with those). Only writes to pages marked in code_page, which
+// hold words some insn was decoded from, need look for insns to discard.
+typedef struct insn
+{
+    u8 kind;                // handler, or 0 if not yet decoded
+    u8 a;                   // first operand: usually the destination register
+    u8 b;                   // second operand: source/base register, or condition
+    u8 c;                   // third operand, for fused instructions
+    u16 imm;                // immediate, offset or branch target
+    u16 op;                 // the original opcode
+} insn;
+
+struct stops;
+
+typedef struct cpu
+{
+    u16 r[16];
+    u16 special_regs[4];
+    page *pages[NUM_PAGES];
+
+    u64 instructions;       // instructions executed (skipped ones are not counted)
+    u64 cycles;             // clock cycles, as per the state machine in vixen.v
+    u64 pages_copied;       // shared pages copied on write since fork
+
+    // trace support
+    bool want_disasm;       // fill in disasm on every execute()
+    bool trace_read;        // print memory reads
+    bool trace_write;       // print memory writes
+    char disasm[32];
+    u8 touched_reg[16];
+    bool touched_skip;
+
+    // the load performed by the last execute() or cpu_run(c, 1), if any
+    bool loaded;
+    bool load_wide;
+    u16 load_addr;
+
+    // the store performed by the last execute() or cpu_run(c, 1), if any
+    bool stored;
+    bool store_wide;
+    u16 store_addr;
+    u16 store_data;
+    u16 store_old;          // memory contents before the store
+
+    // cpu_run() state
+    insn *decoded;          // predecoded instructions, by word address
+    const struct stops *decoded_for;
+    int decoded_version;
+    u8 code_page[NUM_PAGES];    // words in the page have been decoded
+    u64 code_writes;        // writes to words in code pages
+    u64 code_discarded;     // insns discarded by those writes
+    struct stops *stops;    // breakpoints, watchpoints, conditions - may be 0
+    u8 *edges;              // if set, cpu_run() sets edges[pc|taken] for each pr* at pc
+    u64 new_edges;          // edges set for the first time
+    int stop_hit;           // index of the stop which ended cpu_run()
+    int stop_substate;      // substate which ended cpu_run(), for RUN_STOPPED
+    bool resume_break;      // cpu_run() ended on a breakpoint at the current pc
+} cpu;
+
+// Allocate a cpu with zeroed memory and registers.
+cpu *cpu_new(void);
+
+// Allocate a copy of c, sharing its memory copy-on-write.
+cpu *cpu_fork(const cpu *c);
+
+// Make dst a copy of src, sharing src's memory copy-on-write. Only pages
+// which differ cost anything, so resetting a cpu to the one it was copied
+// from is cheap.
+void cpu_copy(cpu *dst, const cpu *src);
+
+void cpu_free(cpu *c);
+
+void cpu_reset(cpu *c);
+
+// Load out/mem.bin.0 and out/mem.bin.1 as written by asm.pl, given "out/mem.bin".
+int cpu_load_image(cpu *c, const char *base);
+
+page *page_unshare(cpu *c, int index);
+
+// Memory access by word index (i.e. address/2).
+static inline u16 mem_word(const cpu *c, u16 i)
+{
+    return c->pages[i >> PAGE_SHIFT]->w[i & PAGE_MASK];
+}
+
+void code_written(cpu *c, u16 i);
+
+static inline u16 *mem_word_wr(cpu *c, u16 i)
+{
+    if (c->code_page[i >> PAGE_SHIFT]) {
+        code_written(c, i);
+    }
+    page *p = c->pages[i >> PAGE_SHIFT];
+    if (__atomic_load_n(&p->refs, __ATOMIC_RELAXED) != 1) {
+        p = page_unshare(c, i >> PAGE_SHIFT);
+    }
+    return &p->w[i & PAGE_MASK];
+}
+
+static inline void mem_set_word(cpu *c, u16 i, u16 value)
+{
+    *mem_word_wr(c, i) = value;
+}
+
+u16 mem_rd(cpu *c, u16 addr, bool wide);
+void mem_wr(cpu *c, u16 addr, bool wide, u16 data);
+
+// Execute a single instruction, returning its substate. The caller is
+// responsible for advancing the pc beforehand. SS_SWI, SS_RTU, SS_HALT
+// and SS_TRAP are not acted upon - it is up to the caller to stop.
+int execute(cpu *c, u16 op);
+
+// Fetch the instruction at pc, advance pc, and execute it.
+int cpu_step(cpu *c);
+
+// Reasons for cpu_run() to return.
+enum {
+    RUN_LIMIT   = 0,        // max_steps instructions executed
+    RUN_STOPPED = 1,        // an instruction in stop_substate executed (SWI/RTU/HALT/TRAP)
+    RUN_BREAK   = 2,        // pc reached breakpoint stop_hit, which has not executed
+    RUN_WATCH   = 3         // watchpoint or condition stop_hit triggered, after the instruction
+};
+
+// Run up to max_steps instructions, much faster than cpu_step() when no
+// trace output is wanted. Stops whenever cpu_step() would return
+// SS_SWI/SS_RTU/SS_HALT/SS_TRAP, and for the stops in c->stops. A
+// breakpoint which ended the previous run is passed over on resuming.
+int cpu_run(cpu *c, u64 max_steps);
+
+// Discard all predecoded instructions.
+void cpu_flush_decoded(cpu *c);
+
+// Registers which op may write, as a mask with bit 16 for the flags.
+u32 op_writes(u16 op);
+
+// Snapshots hold the complete machine state (registers, special registers,
+// counters and memory) in a portable binary file. Both return 0 on
+// success, or -1 with errno set.
+int cpu_save(const cpu *c, const char *file);
+int cpu_load(cpu *c, const char *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,635 @@
+// cpu_run(): a faster way to execute instructions than cpu_step().
+//
+// Each word of memory has an insn, decoded from it the first time it is
+// executed, which selects a handler and holds its operands in ready-to-use
+// form. Pages holding decoded words are marked in code_page, and writes to
+// them clear the insns for the word written (see mem_word_wr), so code may
+// be modified freely. Writes to other pages cost only the check of the mark;
+// code_writes and code_discarded count the rest.
+//
+// The handlers must behave exactly as execute() does, other than for trace
+// output - anything uncommon, or wanting trace output, goes through
+// cpu_step() instead.
+//
+// Common pairs and triples of instructions (measured on the f16 library)
+// are fused into a single insn, executed by one handler: mov #hi + add #lo,
+// cmp/tst/and/sub + pr*, pr* + bra, cmp + pr* + bra and mov # + cmp. A
+// fused insn does exactly what its instructions would one by one. It is
+// not used if any instruction after the first has a stop on it, or if
+// fewer than FUSED_MAX steps remain, and any write to one of its words
+// clears it (see mem_word_wr).
+//
+// If c->edges is set, the outcome of every pr* is recorded there, for
+// coverage-guided fuzzing; this costs a test per pr* otherwise.
+//
+// Breakpoints and conditions are patched into the insns as K_SLOW, so cost
+// nothing elsewhere. Watchpoints are looked for by loads and stores, only
+// in pages which have been marked as holding one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "stops.h"
+
+enum {
+    K_UNDECODED = 0,
+    K_SLOW,             // via cpu_step(), checking stops
+
+    K_MOV, K_MVN,
+    K_ADC, K_SBC, K_ADD, K_SUB, K_RSC, K_RSB,
+    K_MUL, K_MUH, K_AND, K_ORR, K_EOR, K_BIC,
+    K_CMP, K_CMN, K_TST,
+    K_RRX, K_ROR_I, K_LSL_I, K_LSR_I, K_ASR_I,
+    K_ORR_BIT, K_EOR_BIT, K_BIC_BIT, K_TST_BIT,
+    K_ADD_I,            // add/sub #num8, with b as the sign
+    K_MOV_I,
+    K_LDW, K_LDB, K_STW, K_STB,
+    K_BRA, K_BL,
+    K_PRED,
+    K_NOP,
+    K_HALT,
+
+    // fused - see fuse()
+    K_FUSED,
+    K_MOVHI_ADD = K_FUSED,  // mov rA, #hi ; add rA, #lo - result in imm, flags in c
+    K_MOV_I_CMP,            // mov rA, #imm ; cmp rB, rC (c)
+    K_CMP_PRED,             // cmp rA, rB ; pr* - c is cond|FUSE_BRA, imm the bra target
+    K_TST_PRED,             // tst rA, rB ; pr*
+    K_AND_PRED,             // and rA, rB ; pr*
+    K_SUB_PRED,             // sub rA, rB ; pr*
+    K_TST_BIT_PRED,         // tst rA, #bit B ; pr*
+    K_PRED_BRA              // pr* ; bra - b is cond, imm the target
+};
+
+enum {
+    FUSE_BRA = 0x10,        // the predicate is followed by a bra, also fused
+    FUSED_MAX = 3           // most instructions in a fused insn
+};
+
+// Cycles per instruction, as substate_cycles in cpu.c.
+enum {
+    CYCLES_ALU    = 2,
+    CYCLES_LOAD   = 4,
+    CYCLES_STORE  = 3,
+    CYCLES_BRANCH = 2,
+    CYCLES_SKIP   = 2
+};
+
+static void decode_one(const cpu *c, insn *d, u16 pc)
+{
+    u16 op = mem_word(c, pc >> 1);
+    u8 dst  = op & 0xf;
+    u8 num4 = (op >> 4) & 0xf;
+    u8 num8 = (op >> 4) & 0xff;
+
+    d->op = op;
+    d->a = dst;
+    d->b = num4;
+    d->c = 0;
+    d->imm = 0;
+    d->kind = K_SLOW;
+
+    const stops *s = c->stops;
+    if (s) {
+        if (stops_is_break(s, pc) || s->until_always || (op_writes(op) & s->until_regs)) {
+            return;
+        }
+    }
+
+    switch(op >> 14) {
+        case 0: {
+            static const u8 alu_kinds[0x20] = {
+                [0x00] = K_MOV, [0x01] = K_MVN, [0x02] = K_ADC, [0x03] = K_SBC,
+                [0x04] = K_ADD, [0x05] = K_SUB, [0x06] = K_RSC, [0x07] = K_RSB,
+                [0x0a] = K_MUL, [0x0b] = K_MUH, [0x0c] = K_AND, [0x0d] = K_CMP,
+                [0x0e] = K_CMN,
+                [0x14] = K_ORR, [0x15] = K_EOR, [0x16] = K_BIC, [0x17] = K_TST,
+                [0x19] = K_LSL_I, [0x1a] = K_LSR_I, [0x1b] = K_ASR_I,
+                [0x1c] = K_ORR_BIT, [0x1d] = K_EOR_BIT, [0x1e] = K_BIC_BIT, [0x1f] = K_TST_BIT,
+            };
+            u8 cat = (op >> 8) & 0x3f;
+            if (cat < 0x20) {
+                if (cat == 0x18) {
+                    d->kind = num4 ? K_ROR_I : K_RRX;
+                } else if (alu_kinds[cat]) {
+                    d->kind = alu_kinds[cat];
+                }
+                if (cat >= 0x1c) {
+                    d->imm = 1 << num4;
+                }
+            }
+            else if (dst != 0xf) {
+                d->kind = K_ADD_I;
+                d->b = (op >> 12) & 1;
+                d->imm = d->b ? (u16)num8 | 0xff00 : num8;
+            }
+            else if ((op >> 8 & 0x1f) == 0x1f) {
+                switch(num4) {
+                    case 0xe: d->kind = K_NOP; break;
+                    case 0xf: d->kind = K_HALT; break;
+                    default:  d->kind = K_PRED; break;
+                }
+            }
+            break;
+        }
+        case 1:
+        case 2:
+            d->kind = (op >> 14) == 1 ?
+                ((op >> 13 & 1) ? K_LDW : K_LDB) :
+                ((op >> 13 & 1) ? K_STW : K_STB);
+            d->a = op & 0xf;
+            d->b = (op >> 4) & 0xf;
+            d->imm = (op >> 8) & 0x1f;
+            break;
+        case 3:
+            switch((op >> 12) & 0x3) {
+                case 0: d->kind = K_MOV_I; d->imm = num8; break;
+                case 1: d->kind = K_MOV_I; d->imm = (u16)num8 << 8; break;
+                default: {
+                    u16 offset = op & 0xfff;
+                    u16 next = pc + 2;
+                    d->imm = next + ((offset & 0x800) ? (offset << 1 | 0xf000) : (offset << 1));
+                    d->kind = ((op >> 12) & 0x3) == 3 ? K_BL : K_BRA;
+                    break;
+                }
+            }
+            break;
+    }
+}
+
+static inline u16 nz(u32 res);
+static inline u16 nzcv(u32 res, u16 signs_ne, u16 sub);
+
+// Fuse the insn d at pc with those following it, if they make one of the
+// sequences we handle.
+static void fuse(const cpu *c, insn *d, u16 pc)
+{
+    insn next, after;
+    decode_one(c, &next, pc + 2);
+
+    switch(d->kind) {
+        case K_MOV_I:
+            if ((d->op & 0xf000) == 0xd000 && next.kind == K_ADD_I && next.a == d->a && d->a != 15) {
+                // the result and flags depend only on the constants
+                u32 res = (u32)d->imm + next.imm;
+                u16 signs_ne = (d->imm >> 15) != next.b;
+                d->kind = K_MOVHI_ADD;
+                d->imm = res;
+                d->c = nzcv(res, signs_ne, 0) >> 12;
+            }
+            else if (next.kind == K_CMP && d->a != 15 && next.a != 15 && next.b != 15) {
+                // a cmp of r15 must read it as its own pc+2, so is not fused
+                d->kind = K_MOV_I_CMP;
+                d->b = next.a;
+                d->c = next.b;
+            }
+            return;
+
+        case K_CMP:
+        case K_TST:
+        case K_AND:
+        case K_SUB:
+        case K_TST_BIT:
+            if (next.kind != K_PRED || d->a == 15) {
+                return;
+            }
+            decode_one(c, &after, pc + 4);
+            d->c = next.b;
+            if (after.kind == K_BRA) {
+                d->c |= FUSE_BRA;
+                d->imm = after.imm;
+            }
+            switch(d->kind) {
+                case K_CMP:     d->kind = K_CMP_PRED; break;
+                case K_TST:     d->kind = K_TST_PRED; break;
+                case K_AND:     d->kind = K_AND_PRED; break;
+                case K_SUB:     d->kind = K_SUB_PRED; break;
+                case K_TST_BIT: d->kind = K_TST_BIT_PRED; break;
+            }
+            return;
+
+        case K_PRED:
+            if (next.kind == K_BRA) {
+                d->kind = K_PRED_BRA;
+                d->imm = next.imm;
+            }
+            return;
+    }
+}
+
+static void decode(cpu *c, insn *d, u16 pc)
+{
+    decode_one(c, d, pc);
+    fuse(c, d, pc);
+
+    // writes to any of the words read must now discard d
+    u16 i = pc >> 1;
+    c->code_page[i >> PAGE_SHIFT] = 1;
+    c->code_page[((i+1) & 0x7fff) >> PAGE_SHIFT] = 1;
+    c->code_page[((i+2) & 0x7fff) >> PAGE_SHIFT] = 1;
+}
+
+static inline void edge(cpu *c, u16 pc, bool taken)
+{
+    u8 *e = &c->edges[pc | taken];
+    if (!*e) {
+        *e = 1;
+        c->new_edges++;
+    }
+}
+
+static bool ends_run(int substate)
+{
+    return substate == SS_SWI || substate == SS_RTU || substate == SS_HALT || substate == SS_TRAP;
+}
+
+// Execute one instruction via cpu_step(), checking all stops. Returns a
+// RUN_* reason to stop, or -1 to carry on.
+static int slow_step(cpu *c, bool resume)
+{
+    stops *s = c->stops;
+    u16 pc = c->r[15];
+
+    if (s && !resume && stops_is_break(s, pc)) {
+        int hit = stops_break(s, c, pc);
+        if (hit >= 0) {
+            c->stop_hit = hit;
+            c->resume_break = 1;
+            return RUN_BREAK;
+        }
+    }
+
+    u16 op = mem_rd(c, pc, 1);
+    int substate = cpu_step(c);
+    if (c->edges && substate == SS_PRED) {
+        edge(c, pc, c->r[15] == (u16)(pc + 2));
+    }
+    if (ends_run(substate)) {
+        c->stop_substate = substate;
+        return RUN_STOPPED;
+    }
+
+    if (s) {
+        int hit = -1;
+        if (c->loaded && (s->watch_page[c->load_addr >> 8] | s->watch_page[(u16)(c->load_addr + c->load_wide) >> 8])) {
+            hit = stops_access(s, c, c->load_addr, c->load_wide, 0);
+        }
+        if (hit < 0 && c->stored && (s->watch_page[c->store_addr >> 8] | s->watch_page[(u16)(c->store_addr + c->store_wide) >> 8])) {
+            hit = stops_access(s, c, c->store_addr, c->store_wide, 1);
+        }
+        if (hit < 0 && (s->until_always || (op_writes(op) & s->until_regs))) {
+            hit = stops_until(s, c);
+        }
+        if (hit >= 0) {
+            c->stop_hit = hit;
+            return RUN_WATCH;
+        }
+    }
+    return -1;
+}
+
+static inline u16 load(cpu *c, u16 addr, bool wide)
+{
+    if (wide && !(addr & 1)) {
+        return mem_word(c, addr >> 1);
+    }
+    return mem_rd(c, addr, wide);
+}
+
+static inline void store(cpu *c, u16 addr, bool wide, u16 data)
+{
+    if (wide && !(addr & 1)) {
+        *mem_word_wr(c, addr >> 1) = data;
+    } else {
+        mem_wr(c, addr, wide, data);
+    }
+}
+
+// Look for a watchpoint on a load or store which has just happened.
+static int watched(cpu *c, const u8 *watch_page, u16 addr, bool wide, bool write)
+{
+    u8 how = write ? WATCH_WRITE : WATCH_READ;
+    if (!((watch_page[addr >> 8] | watch_page[(u16)(addr + wide) >> 8]) & how)) {
+        return -1;
+    }
+    return stops_access(c->stops, c, addr, wide, write);
+}
+
+#define FLAGS_NZCV (FLAG_N|FLAG_Z|FLAG_C|FLAG_V)
+#define FLAGS_NZC  (FLAG_N|FLAG_Z|FLAG_C)
+#define FLAGS_NZ   (FLAG_N|FLAG_Z)
+
+static inline u16 nz(u32 res)
+{
+    return ((res & 0x8000) ? FLAG_N : 0) | ((res & 0xffff) ? 0 : FLAG_Z);
+}
+
+// Flags for add/sub/cmp/cmn, as computed by execute().
+static inline u16 nzcv(u32 res, u16 signs_ne, u16 sub)
+{
+    u16 n = (res >> 15) & 1;
+    u16 cout = (res >> 16) & 1;
+    u16 v = n ^ signs_ne ^ cout ^ sub;
+    return nz(res) | (cout ? FLAG_C : 0) | (v ? FLAG_V : 0);
+}
+
+static inline void set_flags(cpu *c, u16 mask, u16 value)
+{
+    c->special_regs[FLAGS] = (c->special_regs[FLAGS] & ~mask) | value;
+}
+
+static inline bool condition(u16 flags, u8 cond)
+{
+    bool n = (flags & FLAG_N) != 0;
+    bool z = (flags & FLAG_Z) != 0;
+    bool cf = (flags & FLAG_C) != 0;
+    bool v = (flags & FLAG_V) != 0;
+    switch(cond) {
+        case 0x0: return z;
+        case 0x1: return !z;
+        case 0x2: return cf;
+        case 0x3: return !cf;
+        case 0x4: return n;
+        case 0x5: return !n;
+        case 0x6: return v;
+        case 0x7: return !v;
+        case 0x8: return cf && !z;
+        case 0x9: return !cf || z;
+        case 0xa: return n == v;
+        case 0xb: return n != v;
+        case 0xc: return !z && (n == v);
+        default:  return z || (n ^ v);
+    }
+}
+
+int cpu_run(cpu *c, u64 max_steps)
+{
+    stops *s = c->stops;
+
+    if (c->decoded == 0) {
+        c->decoded = calloc(0x8000, sizeof(insn));
+        if (c->decoded == 0) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    if (c->decoded_for != s || (s && c->decoded_version != s->version)) {
+        cpu_flush_decoded(c);
+        c->decoded_for = s;
+        c->decoded_version = s ? s->version : 0;
+    }
+
+    const u8 *watch_page = (s && s->num_watch_pages) ? s->watch_page : 0;
+    bool slow = c->want_disasm || c->trace_read || c->trace_write;
+    u64 start = c->instructions;    // every step executes one instruction
+    int hit;
+
+    c->stored = 0;
+    c->loaded = 0;
+
+    // step off a breakpoint we stopped at last time
+    if (c->resume_break && max_steps > 0) {
+        c->resume_break = 0;
+        int why = slow_step(c, 1);
+        if (why >= 0) return why;
+    }
+
+    u16 *r = c->r;
+    while(c->instructions - start < max_steps) {
+        u16 pc = r[15];
+        insn *d = &c->decoded[pc >> 1];
+        if (d->kind == K_UNDECODED && !(pc & 1)) {
+            decode(c, d, pc);
+        }
+        if (slow || (pc & 1) || d->kind == K_SLOW ||
+                (d->kind >= K_FUSED && max_steps - (c->instructions - start) < FUSED_MAX)) {
+            int why = slow_step(c, 0);
+            if (why >= 0) return why;
+            continue;
+        }
+
+        u8 a = d->a;
+        u8 b = d->b;
+        u32 res;
+        u16 cin = (c->special_regs[FLAGS] & FLAG_C) != 0;
+        r[15] = pc + 2;
+        c->instructions++;
+
+        switch(d->kind) {
+            case K_MOV: r[a] = r[b];            c->cycles += CYCLES_ALU; break;
+            case K_MVN: r[a] = ~r[b];           c->cycles += CYCLES_ALU; break;
+            case K_MOV_I: r[a] = d->imm;        c->cycles += CYCLES_ALU; break;
+
+            case K_ADC: res = (u32)r[a] + r[b] + cin;        set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 0)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_SBC: res = (u32)r[a] + (u16)~r[b] + cin;  set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_ADD: res = (u32)r[a] + r[b];              set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 0)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_SUB: res = (u32)r[a] + (u16)~r[b] + 1u;   set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_RSC: res = (u32)r[b] + (u16)~r[a] + cin;  set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_RSB: res = (u32)r[b] + (u16)~r[a] + 1u;   set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_CMP: res = (u32)r[a] + (u16)~r[b] + 1u;   set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1)); c->cycles += CYCLES_ALU; break;
+            case K_CMN: res = (u32)r[a] + r[b];              set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1)); c->cycles += CYCLES_ALU; break;
+
+            case K_MUL: res = ((u32)r[a] * r[b]) & 0xffff;   set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_MUH: res = ((u32)r[a] * r[b]) >> 16;      set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_AND: res = r[a] & r[b];                   set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_ORR: res = r[a] | r[b];                   set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_EOR: res = r[a] ^ r[b];                   set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_BIC: res = r[a] & (u16)~r[b];             set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_TST: res = r[a] & r[b];                   set_flags(c, FLAGS_NZ, nz(res)); c->cycles += CYCLES_ALU; break;
+
+            case K_ORR_BIT: res = r[a] | d->imm;             set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_EOR_BIT: res = r[a] ^ d->imm;             set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_BIC_BIT: res = r[a] & (u16)~d->imm;       set_flags(c, FLAGS_NZ, nz(res)); r[a] = res; c->cycles += CYCLES_ALU; break;
+            case K_TST_BIT: res = r[a] & d->imm;             set_flags(c, FLAGS_NZ, nz(res)); c->cycles += CYCLES_ALU; break;
+
+            case K_RRX: {
+                u16 v = r[a];
+                res = (cin ? 0x8000 : 0) | (v >> 1);
+                set_flags(c, FLAGS_NZC, nz(res) | ((v & 1) ? FLAG_C : 0));
+                r[a] = res;
+                c->cycles += CYCLES_ALU;
+                break;
+            }
+            case K_ROR_I: {
+                u16 v = r[a];
+                res = v << (16u - b) | v >> b;
+                set_flags(c, FLAGS_NZC, nz(res) | (((v >> (b - 1u)) & 1) ? FLAG_C : 0));
+                r[a] = res;
+                c->cycles += CYCLES_ALU;
+                break;
+            }
+            case K_LSL_I: {
+                u16 v = r[a];
+                u16 cout = b ? (v >> (16u - b)) & 1 : 0;
+                res = v << b;
+                set_flags(c, FLAGS_NZC, nz(res) | (cout ? FLAG_C : 0));
+                r[a] = res;
+                c->cycles += CYCLES_ALU;
+                break;
+            }
+            case K_LSR_I: {
+                u16 v = r[a];
+                u16 cout = b ? (v >> (b - 1u)) & 1 : 0;
+                res = v >> b;
+                set_flags(c, FLAGS_NZC, nz(res) | (cout ? FLAG_C : 0));
+                r[a] = res;
+                c->cycles += CYCLES_ALU;
+                break;
+            }
+            case K_ASR_I: {
+                u16 v = r[a];
+                u16 cout = b ? (v >> (b - 1u)) & 1 : 0;
+                res = (u16)((short)v >> b);
+                set_flags(c, FLAGS_NZC, nz(res) | (cout ? FLAG_C : 0));
+                r[a] = res;
+                c->cycles += CYCLES_ALU;
+                break;
+            }
+
+            case K_ADD_I: {
+                u16 signs_ne = (r[a] >> 15) != b;
+                res = (u32)r[a] + d->imm;
+                set_flags(c, FLAGS_NZCV, nzcv(res, signs_ne, 0));
+                r[a] = res;
+                c->cycles += CYCLES_ALU;
+                break;
+            }
+
+            case K_LDW:
+            case K_LDB: {
+                bool wide = d->kind == K_LDW;
+                u16 addr = r[b] + d->imm;
+                r[a] = load(c, addr, wide);
+                c->loaded = 1;
+                c->load_wide = wide;
+                c->load_addr = addr;
+                c->cycles += CYCLES_LOAD;
+                if (watch_page && (hit = watched(c, watch_page, addr, wide, 0)) >= 0) {
+                    c->stop_hit = hit;
+                    return RUN_WATCH;
+                }
+                break;
+            }
+            case K_STW:
+            case K_STB: {
+                bool wide = d->kind == K_STW;
+                u16 addr = r[b] + d->imm;
+                c->store_old = load(c, addr, wide);
+                store(c, addr, wide, r[a]);
+                c->stored = 1;
+                c->store_wide = wide;
+                c->store_addr = addr;
+                c->store_data = r[a];
+                c->cycles += CYCLES_STORE;
+                if (watch_page && (hit = watched(c, watch_page, addr, wide, 1)) >= 0) {
+                    c->stop_hit = hit;
+                    return RUN_WATCH;
+                }
+                break;
+            }
+
+            case K_BL:
+                r[14] = pc + 2;
+                // fall through
+            case K_BRA:
+                r[15] = d->imm;
+                c->cycles += CYCLES_BRANCH;
+                break;
+
+            case K_PRED: {
+                bool taken = condition(c->special_regs[FLAGS], b);
+                if (c->edges) edge(c, pc, taken);
+                c->cycles += CYCLES_ALU;
+                if (!taken) {
+                    r[15] += 2;
+                    c->cycles += CYCLES_SKIP;
+                }
+                break;
+            }
+
+            case K_NOP:
+                c->cycles += CYCLES_ALU;
+                break;
+
+            case K_HALT:
+                c->cycles += CYCLES_ALU;
+                c->stop_substate = SS_HALT;
+                return RUN_STOPPED;
+
+            case K_MOVHI_ADD:
+                r[a] = d->imm;
+                set_flags(c, FLAGS_NZCV, (u16)d->c << 12);
+                r[15] = pc + 4;
+                c->instructions++;
+                c->cycles += 2*CYCLES_ALU;
+                break;
+
+            case K_MOV_I_CMP:
+                r[a] = d->imm;
+                res = (u32)r[b] + (u16)~r[d->c] + 1u;
+                set_flags(c, FLAGS_NZCV, nzcv(res, (r[b] ^ r[d->c]) >> 15, 1));
+                r[15] = pc + 4;
+                c->instructions++;
+                c->cycles += 2*CYCLES_ALU;
+                break;
+
+            case K_CMP_PRED:
+                res = (u32)r[a] + (u16)~r[b] + 1u;
+                set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1));
+                goto fused_pred;
+            case K_TST_PRED:
+                set_flags(c, FLAGS_NZ, nz(r[a] & r[b]));
+                goto fused_pred;
+            case K_TST_BIT_PRED:
+                set_flags(c, FLAGS_NZ, nz(r[a] & (1u << b)));
+                goto fused_pred;
+            case K_AND_PRED:
+                res = r[a] & r[b];
+                set_flags(c, FLAGS_NZ, nz(res));
+                r[a] = res;
+                goto fused_pred;
+            case K_SUB_PRED:
+                res = (u32)r[a] + (u16)~r[b] + 1u;
+                set_flags(c, FLAGS_NZCV, nzcv(res, (r[a] ^ r[b]) >> 15, 1));
+                r[a] = res;
+                goto fused_pred;
+
+            fused_pred: {
+                // the predicate at pc+2, and the bra at pc+4 if FUSE_BRA
+                bool taken = condition(c->special_regs[FLAGS], d->c & 0xf);
+                if (c->edges) edge(c, pc + 2, taken);
+                c->instructions++;
+                c->cycles += 2*CYCLES_ALU;
+                if (!taken) {
+                    r[15] = pc + 6;
+                    c->cycles += CYCLES_SKIP;
+                } else if (d->c & FUSE_BRA) {
+                    r[15] = d->imm;
+                    c->instructions++;
+                    c->cycles += CYCLES_BRANCH;
+                } else {
+                    r[15] = pc + 4;
+                }
+                break;
+            }
+
+            case K_PRED_BRA: {
+                bool taken = condition(c->special_regs[FLAGS], b);
+                if (c->edges) edge(c, pc, taken);
+                c->cycles += CYCLES_ALU;
+                if (!taken) {
+                    r[15] = pc + 4;
+                    c->cycles += CYCLES_SKIP;
+                } else {
+                    r[15] = d->imm;
+                    c->instructions++;
+                    c->cycles += CYCLES_BRANCH;
+                }
+                break;
+            }
+        }
+    }
+    return RUN_LIMIT;
+}
@@ -0,0 +1,47 @@
+#!/bin/bash
+
+# Check the f16 routines for every pair of operands, with out/f16_sweep.
+# Progress is checkpointed in $OUT/OP.ckpt, so an interrupted sweep carries
+# on where it left off when run again; remove the checkpoint to start over.
+# Any other arguments, e.g. -j 4, are passed to f16_sweep.
+#
+#       ./f16-sweep.sh [mul] [div] [add] [sub] [f16_sweep options]
+
+OUT="out/f16-sweep"
+SRC="programs/f16"
+
+TESTS=()
+ARGS=()
+for arg in "$@"; do
+    case "$arg" in
+        mul|div|add|sub) TESTS+=("$arg") ;;
+        *) ARGS+=("$arg") ;;
+    esac
+done
+[ ${#TESTS[@]} = 0 ] && TESTS=(mul div add sub)
+
+make -s out/f16_sweep || exit 1
+mkdir -p "$OUT"
+
+status=0
+function sweep() {
+    local op="$1"
+    local lib="$2"
+
+    if ! ./asm.pl "$SRC/internal.asm" "$SRC/${lib}.asm" > "$OUT/$op.asm.log"; then
+        echo >&2 "..."
+        tail >&2 "$OUT/$op.asm.log"
+        exit 1
+    fi
+    ./out/f16_sweep -A "$OUT/$op.asm.log" -c "$OUT/$op.ckpt" "${ARGS[@]}" "f16_$op" |
+        tee "$OUT/$op.log"
+    [ ${PIPESTATUS[0]} = 0 ] || status=1
+}
+
+for t in "${TESTS[@]}"; do
+    [ "$t" = mul ] && sweep mul mul
+    [ "$t" = div ] && sweep div div
+    [ "$t" = add ] && sweep add add_sub
+    [ "$t" = sub ] && sweep sub add_sub
+done
+exit $status
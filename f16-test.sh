@@ -2,24 +2,48 @@
 
 OUT="out/f16-test"
 SRC="programs/f16"
+MAX_INSTRUCTIONS=10000000   # so a routine which never returns can't hang the run
+MAX_INSTRUCTIONS_PER_VECTOR=1000    # likewise, added per streamed vector
+
+# With --stream N, the operations of two or three operands are run over the
+# special values and N generated vectors, streamed by
+# programs/f16/stream_harness.asm from a binary file written by gen_test,
+# rather than traced over the assembled test data.
+STREAM=
+if [ "$1" = --stream ]; then
+    STREAM="$2"
+    shift 2
+fi
 
 if [ $# = 0 ]; then
-    TESTS=(mul div add sub)
+    TESTS=(mul div add sub fma unary vector)
 else
     TESTS=("$@")
 fi
 
+# Coverage of each library is merged over the tests using it, in
+# $OUT/LIB.cov, and written as an annotated listing to $OUT/LIB.lst.
+declare -A COVERAGE_CLEARED
+
 function run_test() {
-    local op="$1"; shift
+    local op="$1"
+    local lib="$2"
+    local operands="${3:-2}"
+    local harness="harness"
+    [ "$operands" = 3 ] && harness="harness3"
     local libs=(
-        "$SRC/harness.asm"
+        "$SRC/$harness.asm"
         "$SRC/${op}_testdata.asm"
         "$SRC/internal.asm"
-        "$SRC/${op}.asm"
-        "$@"
+        "$SRC/${lib}.asm"
     )
     local logs="$OUT/$op"
 
+    if [ -n "$STREAM" ]; then
+        run_stream_test "$op" "$lib" "$operands"
+        return
+    fi
+
     rm -rf "$logs"
     mkdir -p "$logs"
     if ! ./asm.pl "${libs[@]}" > "$logs/asm.log"; then
@@ -28,16 +52,99 @@ function run_test() {
         exit 1
     fi
 
-    ./out/sim --color |
+    if [ -z "${COVERAGE_CLEARED[$lib]}" ]; then
+        rm -f "$OUT/$lib.cov"
+        COVERAGE_CLEARED[$lib]=1
+    fi
+
+    ./out/sim --color --max-instructions "$MAX_INSTRUCTIONS" \
+            -A "$logs/asm.log" \
+            --coverage "$OUT/$lib.cov" --coverage-listing "$OUT/$lib.lst" |
         tee "$logs/color.log" | sed $'s/\e\[[^m]*m//g' |
-        tee "$logs/plain.log" | grep 'ffff ....$' |
+        tee "$logs/plain.log" | grep -e 'ffff ....\( ;.*\)\?$' -e '^LIMIT' |
+        tee "$logs/fail.log"
+}
+
+function run_stream_test() {
+    local op="$1"
+    local lib="$2"
+    local operands="$3"
+    local logs="$OUT/$op"
+    local libs=(
+        "programs/semihost.asm"
+        "$SRC/stream_harness.asm"
+        "$logs/op.asm"
+        "$SRC/internal.asm"
+        "$SRC/${lib}.asm"
+    )
+
+    rm -rf "$logs"
+    mkdir -p "$logs"
+    ./out/gen_test -b "$logs" -n "$STREAM" "$op" || exit 1
+    printf '.unit_test_op\n    dw .f16_%s\n' "$op" > "$logs/op.asm"
+    printf '.unit_test_operands\n    dw %d\n' "$operands" >> "$logs/op.asm"
+    if ! ./asm.pl "${libs[@]}" > "$logs/asm.log"; then
+        echo >&2 "..."
+        tail >&2 "$logs/asm.log"
+        exit 1
+    fi
+
+    # stream_harness.asm exits with status 1 on any failure; a run which
+    # stops any other way is a failure too
+    local limit=$((MAX_INSTRUCTIONS + STREAM * MAX_INSTRUCTIONS_PER_VECTOR))
+    ./out/sim -q --max-instructions "$limit" \
+            -A "$logs/asm.log" --input "$logs/$op.bin" |
+        tee "$logs/plain.log" |
+        grep -e '^FAIL' -e '^LIMIT' -e '^STOPPED' -e '^TRAP' -e '^no --input' |
         tee "$logs/fail.log"
+    local status=${PIPESTATUS[0]}
+    if [ "$status" != 0 ] && [ ! -s "$logs/fail.log" ]; then
+        echo "exit status $status" | tee "$logs/fail.log"
+    fi
+}
+
+# The unary routines are checked exhaustively, over all 65536 inputs, by
+# f16_unary rather than against test data.
+function run_unary() {
+    local logs="$OUT/unary"
+
+    rm -rf "$logs"
+    mkdir -p "$logs"
+    if ! ./asm.pl "$SRC/internal.asm" "$SRC/sqrt.asm" "$SRC/ftoi.asm" \
+            "$SRC/itof.asm" "$SRC/ftoa.asm" "$SRC/atof.asm" > "$logs/asm.log"; then
+        echo >&2 "..."
+        tail >&2 "$logs/asm.log"
+        exit 1
+    fi
+
+    ./out/f16_unary -A "$logs/asm.log" | tee "$logs/plain.log" |
+        grep -v -e '  pass  ' -e '^0 checks failed' | tee "$logs/fail.log"
+}
+
+# The vector routines are checked over random arrays, by f16_vector.
+function run_vector() {
+    local logs="$OUT/vector"
+
+    rm -rf "$logs"
+    mkdir -p "$logs"
+    if ! ./asm.pl "$SRC/internal.asm" "$SRC/mul.asm" "$SRC/fma.asm" \
+            "$SRC/vector.asm" > "$logs/asm.log"; then
+        echo >&2 "..."
+        tail >&2 "$logs/asm.log"
+        exit 1
+    fi
+
+    ./out/f16_vector -A "$logs/asm.log" | tee "$logs/plain.log" |
+        grep -v -e '  pass  ' -e '^0 checks failed' | tee "$logs/fail.log"
 }
 
 for t in "${TESTS[@]}"; do
-    [ "$t" = mul ] && run_test mul 
-    [ "$t" = div ] && run_test div 
-    [ "$t" = add ] && run_test add programs/f16/sub.asm
-    [ "$t" = sub ] && run_test sub programs/f16/add.asm
+    [ "$t" = mul ] && run_test mul mul
+    [ "$t" = div ] && run_test div div
+    [ "$t" = add ] && run_test add add_sub
+    [ "$t" = sub ] && run_test sub add_sub
+    [ "$t" = fma ] && run_test fma fma 3
+    [ "$t" = unary ] && run_unary
+    [ "$t" = vector ] && run_vector
 done
 
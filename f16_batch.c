@@ -0,0 +1,245 @@
+// Fan-out runner for the f16 unit test harnesses (programs/f16/harness.asm,
+// or harness3.asm for operations of three operands).
+//
+// Rather than running the test vectors one after another in a single
+// machine, the program is run once up to .loop, and then every vector is
+// run in its own fork of that machine. Forks share memory copy-on-write,
+// so each costs little more than the pages it writes to, and as every
+// vector starts from the same state, a failure in one cannot disturb the
+// next. Vectors run under cpu_run(), with breakpoints at .continue and
+// .failure, and each thread reuses one cpu so its predecoded instructions
+// carry over from vector to vector. The number of operands, and so the size
+// of each record of test data, is read from the harness's .unit_test_operands.
+//
+// Usage, after assembling a harness as f16-test.sh does:
+//
+//      ./asm.pl programs/f16/harness.asm programs/f16/mul_testdata.asm
+//          programs/f16/internal.asm programs/f16/mul.asm > out/asm.log
+//      ./out/f16_batch -A out/asm.log
+//
+// Build with "make out/f16_batch".
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "listing.h"
+#include "stops.h"
+
+// a vector which runs for longer than this is assumed to be stuck
+static const u64 MAX_INSTRUCTIONS = 1000000;
+
+enum {
+    PASS,
+    FAIL,
+    STUCK,
+    STOPPED
+};
+
+typedef struct
+{
+    int status;
+    u16 number;
+    u16 a;
+    u16 b;
+    u16 c;
+    u16 got;
+    u16 expected;
+    u64 instructions;
+    u64 cycles;
+    u64 pages_copied;
+} result;
+
+typedef struct
+{
+    const cpu *base;
+    const listing *l;
+    u16 data;           // address of the first vector
+    int operands;       // 2, or 3 for harness3.asm
+    u16 addr_continue;
+    u16 addr_failure;
+    int num_vectors;
+    result *results;
+    int next;           // next vector to be claimed
+} batch;
+
+static void run_vector(const batch *b, cpu *c, int i, result *res)
+{
+    stops *s = c->stops;
+    cpu_copy(c, b->base);
+    c->stops = s;
+
+    u16 v = b->data + 2*(b->operands+2)*i;
+    c->r[13] = v;
+    c->instructions = 0;
+    c->cycles = 0;
+
+    res->number = mem_rd(c, v, 1);
+    res->a = mem_rd(c, v+2, 1);
+    res->b = mem_rd(c, v+4, 1);
+    if (b->operands == 3) res->c = mem_rd(c, v+6, 1);
+    res->expected = mem_rd(c, v+2*(b->operands+1), 1);
+    res->status = STUCK;
+
+    switch(cpu_run(c, MAX_INSTRUCTIONS)) {
+        case RUN_BREAK:
+            res->status = c->r[15] == b->addr_continue ? PASS : FAIL;
+            res->got = c->r[2];
+            break;
+        case RUN_STOPPED:
+            res->status = STOPPED;
+            break;
+    }
+
+    res->instructions = c->instructions;
+    res->cycles = c->cycles;
+    res->pages_copied = c->pages_copied;
+}
+
+static void *worker(void *arg)
+{
+    batch *b = arg;
+    cpu *c = cpu_fork(b->base);
+    c->stops = stops_new();
+    char err[128];
+    if (stops_add(c->stops, STOP_BREAK, ".continue", b->l, err, sizeof(err)) < 0 ||
+            stops_add(c->stops, STOP_BREAK, ".failure", b->l, err, sizeof(err)) < 0) {
+        fprintf(stderr, "%s\n", err);
+        exit(1);
+    }
+
+    while(1) {
+        int i = __atomic_fetch_add(&b->next, 1, __ATOMIC_RELAXED);
+        if (i >= b->num_vectors) break;
+        run_vector(b, c, i, &b->results[i]);
+    }
+
+    stops_free(c->stops);
+    cpu_free(c);
+    return 0;
+}
+
+static int find(const listing *l, const char *name)
+{
+    int addr = listing_find(l, name);
+    if (addr < 0) {
+        fprintf(stderr, "label .%s not found - is this an f16 harness?\n", name);
+        exit(1);
+    }
+    return addr;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: run each f16 test vector in its own fork of the machine\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -A, --asm FILE         read labels from FILE (default: out/asm.log)\n");
+    fprintf(stderr, "  -j, --jobs N           run N threads (default: one per cpu)\n");
+    fprintf(stderr, "  -v, --verbose          print every vector, not just failures\n");
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *asm_file = "out/asm.log";
+    int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    bool verbose = 0;
+
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-A") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-v") || !strcmp(argv[i], "--verbose")) {
+            verbose = 1;
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+    if (jobs < 1) jobs = 1;
+
+    listing *l = listing_load(asm_file);
+    if (l == 0) {
+        exit(1);
+    }
+
+    cpu *base = cpu_new();
+    if (cpu_load_image(base, "out/mem.bin")) {
+        fprintf(stderr, "could not load out/mem.bin.0, out/mem.bin.1\n");
+        exit(1);
+    }
+
+    batch b = {};
+    u16 addr_loop = find(l, "loop");
+    u16 data_start = find(l, "unit_test_data");
+    u16 data_end = find(l, "unit_test_end");
+    b.addr_continue = find(l, "continue");
+    b.addr_failure = find(l, "failure");
+    b.data = data_start + 2;
+    b.operands = mem_rd(base, find(l, "unit_test_operands"), 1);
+    if (b.operands != 2 && b.operands != 3) {
+        fprintf(stderr, "unsupported number of operands %d\n", b.operands);
+        exit(1);
+    }
+    b.num_vectors = (data_end - b.data) / (2*(b.operands+2));
+
+    // run the common set up once
+    while(base->r[15] != addr_loop) {
+        if (base->instructions >= MAX_INSTRUCTIONS) {
+            fprintf(stderr, "did not reach .loop\n");
+            exit(1);
+        }
+        cpu_step(base);
+    }
+    b.base = base;
+    b.l = l;
+
+    b.results = calloc(b.num_vectors, sizeof(result));
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    for(int t=0; t<jobs; t++) pthread_create(&threads[t], 0, worker, &b);
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+
+    int failures = 0;
+    u64 instructions = 0;
+    u64 cycles = 0;
+    u64 pages_copied = 0;
+    for(int i=0; i<b.num_vectors; i++) {
+        const result *res = &b.results[i];
+        static const char *status_name[] = { "PASS", "FAIL", "STUCK", "STOPPED" };
+        if (res->status != PASS) failures++;
+        if (verbose || res->status != PASS) {
+            printf("%-7s #%04x a=%04x b=%04x", status_name[res->status], res->number, res->a, res->b);
+            if (b.operands == 3) printf(" c=%04x", res->c);
+            printf(" got=%04x expected=%04x  %llu instructions, %llu cycles\n",
+                    res->got, res->expected,
+                    (unsigned long long)res->instructions,
+                    (unsigned long long)res->cycles);
+        }
+        instructions += res->instructions;
+        cycles += res->cycles;
+        pages_copied += res->pages_copied;
+    }
+
+    printf("%d vectors, %d failed: %llu instructions, %llu cycles, %llu pages copied\n",
+            b.num_vectors, failures,
+            (unsigned long long)instructions,
+            (unsigned long long)cycles,
+            (unsigned long long)pages_copied);
+
+    free(threads);
+    free(b.results);
+    cpu_free(base);
+    listing_free(l);
+    return failures ? 1 : 0;
+}
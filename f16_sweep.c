@@ -0,0 +1,417 @@
+// Exhaustive check of an f16 binary operation over all 2^32 operand pairs.
+//
+// The vixen routine is called for every (a, b), from the snapshot of the
+// machine set up by fixture.h, and its
+// result compared with the reference library's (ref/float16.h), which is
+// computed 64K results at a time with its batch forms.
+//
+// The work is split into 65536 chunks, one for each a, which the threads
+// claim in turn. With a checkpoint file, each chunk finished is appended to
+// it, with its mismatches counted by the class of b; a later run with the
+// same file skips those chunks, so a sweep which is stopped can be resumed.
+// The checkpoint records a hash of the image, and is not resumed from if
+// the program has changed.
+//
+// Mismatches are summarised by the classes of the operands - zero,
+// subnormal, normal, inf, NaN, and sign.
+//
+// Usage, after assembling the routine (labels are read from out/asm.log):
+//
+//      ./asm.pl programs/f16/internal.asm programs/f16/mul.asm > out/asm.log
+//      ./out/f16_sweep -c out/f16_mul.ckpt f16_mul
+//
+// or f16-sweep.sh, which does this for each operation.
+//
+// Build with "make out/f16_sweep".
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "fixture.h"
+#include "listing.h"
+#include "ref/float16.h"
+
+enum {
+    CHUNKS = 0x10000,       // one per a
+    CHUNK_SIZE = 0x10000,   // b = 0..0xffff
+    MAX_REPORTS = 20        // mismatches printed
+};
+
+//------------------------------------------------------------------------------
+// Classes
+//
+
+enum {
+    ZERO,
+    SUBNORMAL,
+    NORMAL,
+    INF,
+    NAN_,
+    NUM_CLASSES = 10        // each of the above, positive then negative
+};
+
+static const char *class_names[NUM_CLASSES] = {
+    "+zero", "+sub", "+norm", "+inf", "+nan",
+    "-zero", "-sub", "-norm", "-inf", "-nan"
+};
+
+static int class_of(u16 x)
+{
+    int exp = (x >> 10) & 0x1f;
+    int fra = x & 0x3ff;
+    int c = exp == 0    ? (fra ? SUBNORMAL : ZERO)
+          : exp == 0x1f ? (fra ? NAN_ : INF)
+          :               NORMAL;
+    return (x & 0x8000) ? c + NUM_CLASSES/2 : c;
+}
+
+//------------------------------------------------------------------------------
+// Sweep
+//
+
+typedef struct
+{
+    const char *label;      // without the '.'
+    void (*ref)(const u16 *a, const u16 *b, u16 *z, size_t n);
+} operation;
+
+static const operation operations[] = {
+    {"f16_mul", f16_mul_n},
+    {"f16_div", f16_div_n},
+    {"f16_add", f16_add_n},
+    {"f16_sub", f16_sub_n},
+};
+
+typedef struct
+{
+    const operation *op;
+    const cpu *base;
+    u16 entry;
+    u32 first, last;        // range of a swept
+    u8 *done;               // by a: already in the checkpoint
+    u32 next;               // next a to be claimed
+
+    pthread_mutex_t lock;   // for the rest
+    FILE *checkpoint;       // or 0
+    u64 mismatches[NUM_CLASSES][NUM_CLASSES];   // by class of a, then b
+    u64 stuck;
+    u64 calls;
+    u32 chunks;             // finished, including those resumed
+    int reported;
+} sweep;
+
+// Call the routine from the snapshot. Returns whether it returned, with
+// its result in *z.
+static bool call(const sweep *s, cpu *c, u16 a, u16 b, u16 *z)
+{
+    u16 in[2] = {a, b};
+    if (fixture_call(c, s->base, s->entry, in, 2, FIXTURE_MAX_INSTRUCTIONS) != CALL_RETURNED) {
+        return 0;
+    }
+    *z = c->r[2];
+    return 1;
+}
+
+static void report(sweep *s, u16 a, u16 b, u16 got, u16 expected, bool returned)
+{
+    if (s->reported++ >= MAX_REPORTS) return;
+    if (returned) {
+        printf("MISMATCH a=%04x b=%04x  got %04x  expected %04x\n", a, b, got, expected);
+    } else {
+        printf("STUCK    a=%04x b=%04x  expected %04x\n", a, b, expected);
+    }
+}
+
+static void *worker(void *arg)
+{
+    sweep *s = arg;
+    cpu *c = cpu_fork(s->base);
+    u16 *a = malloc(CHUNK_SIZE * sizeof(u16));
+    u16 *b = malloc(CHUNK_SIZE * sizeof(u16));
+    u16 *expected = malloc(CHUNK_SIZE * sizeof(u16));
+    for(u32 i=0; i<CHUNK_SIZE; i++) b[i] = i;
+
+    for(;;) {
+        u32 x = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED);
+        if (x > s->last) break;
+        if (s->done[x]) continue;
+
+        for(u32 i=0; i<CHUNK_SIZE; i++) a[i] = x;
+        s->op->ref(a, b, expected, CHUNK_SIZE);
+
+        u64 counts[NUM_CLASSES] = {};
+        u64 stuck = 0;
+        for(u32 i=0; i<CHUNK_SIZE; i++) {
+            u16 got = 0;
+            bool returned = call(s, c, x, i, &got);
+            if (returned && got == expected[i]) continue;
+
+            counts[class_of(i)]++;
+            stuck += !returned;
+            pthread_mutex_lock(&s->lock);
+            report(s, x, i, got, expected[i], returned);
+            pthread_mutex_unlock(&s->lock);
+        }
+
+        pthread_mutex_lock(&s->lock);
+        for(int k=0; k<NUM_CLASSES; k++) s->mismatches[class_of(x)][k] += counts[k];
+        s->stuck += stuck;
+        s->calls += CHUNK_SIZE;
+        s->chunks++;
+        if (s->checkpoint) {
+            fprintf(s->checkpoint, "%04x %llu", (unsigned)x, (unsigned long long)stuck);
+            for(int k=0; k<NUM_CLASSES; k++) fprintf(s->checkpoint, " %llu", (unsigned long long)counts[k]);
+            fprintf(s->checkpoint, "\n");
+            fflush(s->checkpoint);
+        }
+        pthread_mutex_unlock(&s->lock);
+    }
+
+    free(expected);
+    free(b);
+    free(a);
+    cpu_free(c);
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Checkpoints
+//
+// The first line names the routine and the image it was swept in:
+//
+//      f16_sweep f16_mul 8c3f2a1e0b7d4c65
+//
+// and every other is a finished chunk: a, the calls which got stuck, then
+// the mismatches for each class of b, in the order of class_names.
+//
+
+static u64 image_hash(const cpu *c)
+{
+    // FNV-1a
+    u64 h = 0xcbf29ce484222325ull;
+    for(u32 i=0; i<0x8000; i++) {
+        u16 w = mem_word(c, i);
+        h = (h ^ (w & 0xff)) * 0x100000001b3ull;
+        h = (h ^ (w >> 8)) * 0x100000001b3ull;
+    }
+    return h;
+}
+
+// Read the chunks already done into s, and open the file for appending to.
+static void open_checkpoint(sweep *s, const char *file, u64 hash)
+{
+    char header[128];
+    snprintf(header, sizeof(header), "f16_sweep %s %016llx\n", s->op->label, (unsigned long long)hash);
+
+    FILE *fp = fopen(file, "r");
+    if (fp) {
+        char line[256];
+        if (fgets(line, sizeof(line), fp) == 0 || strcmp(line, header)) {
+            fprintf(stderr, "%s is not a checkpoint of this .%s - remove it to start again\n",
+                    file, s->op->label);
+            exit(1);
+        }
+        while(fgets(line, sizeof(line), fp)) {
+            unsigned x;
+            unsigned long long stuck, n[NUM_CLASSES];
+            if (sscanf(line, "%x %llu %llu %llu %llu %llu %llu %llu %llu %llu %llu %llu",
+                        &x, &stuck, &n[0], &n[1], &n[2], &n[3], &n[4],
+                        &n[5], &n[6], &n[7], &n[8], &n[9]) != 2 + NUM_CLASSES ||
+                    x >= CHUNKS || s->done[x]) {
+                continue;       // e.g. cut short when a run was killed
+            }
+            s->done[x] = 1;
+            if (x < s->first || x > s->last) continue;
+            for(int k=0; k<NUM_CLASSES; k++) s->mismatches[class_of(x)][k] += n[k];
+            s->stuck += stuck;
+            s->chunks++;
+        }
+        fclose(fp);
+    }
+
+    s->checkpoint = fopen(file, "a");
+    if (s->checkpoint == 0) {
+        perror(file);
+        exit(1);
+    }
+    if (ftell(s->checkpoint) == 0) {
+        fputs(header, s->checkpoint);
+        fflush(s->checkpoint);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static void print_summary(const sweep *s)
+{
+    u64 total = 0;
+    for(int i=0; i<NUM_CLASSES; i++) {
+        for(int j=0; j<NUM_CLASSES; j++) total += s->mismatches[i][j];
+    }
+    u32 chunks = s->last - s->first + 1;
+    printf(".%s: %u/%u values of a swept, %llu mismatches (%llu stuck)\n",
+            s->op->label, (unsigned)s->chunks, (unsigned)chunks,
+            (unsigned long long)total, (unsigned long long)s->stuck);
+    if (total == 0) return;
+
+    printf("\n%-8s", "a \\ b");
+    for(int j=0; j<NUM_CLASSES; j++) printf(" %9s", class_names[j]);
+    printf("\n");
+    for(int i=0; i<NUM_CLASSES; i++) {
+        printf("%-8s", class_names[i]);
+        for(int j=0; j<NUM_CLASSES; j++) printf(" %9llu", (unsigned long long)s->mismatches[i][j]);
+        printf("\n");
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: check an f16 routine against the reference for every pair of operands\n\n", prog);
+    fprintf(stderr, "Usage: %s [options] LABEL\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -A, --asm FILE         read labels from FILE (default: out/asm.log)\n");
+    fprintf(stderr, "  -j, --jobs N           run N threads (default: one per cpu)\n");
+    fprintf(stderr, "  -c, --checkpoint FILE  record progress in FILE, resuming from it if it exists\n");
+    fprintf(stderr, "  -r, --range FIRST:LAST sweep only a = FIRST..LAST, in hex (default: 0:ffff)\n");
+    fprintf(stderr, "  -q, --quiet            do not show progress\n");
+    fprintf(stderr, "\nLabels:\n");
+    for(size_t i=0; i<sizeof(operations)/sizeof(operations[0]); i++) {
+        fprintf(stderr, "  %s\n", operations[i].label);
+    }
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *asm_file = "out/asm.log";
+    const char *checkpoint_file = 0;
+    const char *label = 0;
+    int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    bool quiet = 0;
+
+    static sweep s = {};
+    s.first = 0;
+    s.last = CHUNKS - 1;
+
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-A") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if ((!strcmp(argv[i], "-c") || !strcmp(argv[i], "--checkpoint")) && i+1 < argc) {
+            checkpoint_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-r") || !strcmp(argv[i], "--range")) && i+1 < argc) {
+            unsigned first, last;
+            if (sscanf(argv[++i], "%x:%x", &first, &last) != 2 || first > last || last >= CHUNKS) {
+                fprintf(stderr, "%s: bad range `%s'.\n", argv[0], argv[i]);
+                exit(1);
+            }
+            s.first = first;
+            s.last = last;
+        }
+        else if (!strcmp(argv[i], "-q") || !strcmp(argv[i], "--quiet")) {
+            quiet = 1;
+        }
+        else if (argv[i][0] != '-' && label == 0) {
+            label = argv[i][0] == '.' ? argv[i]+1 : argv[i];
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+    if (jobs < 1) jobs = 1;
+    if (label == 0) {
+        usage(argv[0]);
+    }
+
+    for(size_t i=0; i<sizeof(operations)/sizeof(operations[0]); i++) {
+        if (!strcmp(operations[i].label, label)) s.op = &operations[i];
+    }
+    if (s.op == 0) {
+        fprintf(stderr, "no reference for .%s - see --help\n", label);
+        exit(1);
+    }
+
+    listing *l = listing_load(asm_file);
+    if (l == 0) {
+        exit(1);
+    }
+    int entry = listing_find(l, label);
+    if (entry < 0) {
+        fprintf(stderr, "label .%s not found in %s\n", label, asm_file);
+        exit(1);
+    }
+    s.entry = entry;
+
+    cpu *base = fixture_load("out/mem.bin");
+    if (base == 0) {
+        exit(1);
+    }
+    u64 hash = image_hash(base);
+    s.base = base;
+    s.next = s.first;
+    s.done = calloc(CHUNKS, 1);
+    pthread_mutex_init(&s.lock, 0);
+
+    if (checkpoint_file) {
+        open_checkpoint(&s, checkpoint_file, hash);
+    }
+    u32 resumed = s.chunks;
+
+    double start = fixture_now();
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    for(int t=0; t<jobs; t++) pthread_create(&threads[t], 0, worker, &s);
+
+    u32 chunks = s.last - s.first + 1;
+    while(!quiet) {
+        pthread_mutex_lock(&s.lock);
+        u32 finished = s.chunks;
+        u64 calls = s.calls;
+        pthread_mutex_unlock(&s.lock);
+        if (finished == chunks) break;
+
+        double elapsed = fixture_now() - start;
+        double rate = calls / (elapsed > 0 ? elapsed : 1);
+        double remaining = rate > 0 ? (double)(chunks - finished) * CHUNK_SIZE / rate : 0;
+        fprintf(stderr, "\r.%s: %u/%u, %.1fM calls/s, %.0fs to go   ",
+                label, (unsigned)finished, (unsigned)chunks, rate / 1e6, remaining);
+        sleep(1);
+    }
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+    double elapsed = fixture_now() - start;
+    if (!quiet) fprintf(stderr, "\r\033[K");
+
+    if (s.reported > MAX_REPORTS) {
+        printf("... %d more\n", s.reported - MAX_REPORTS);
+    }
+    if (resumed) {
+        printf("resumed %u values of a from %s\n", (unsigned)resumed, checkpoint_file);
+    }
+    printf("%llu calls in %.2fs (%.2fM/s per thread)\n",
+            (unsigned long long)s.calls, elapsed, s.calls / elapsed / jobs / 1e6);
+    print_summary(&s);
+
+    bool failed = s.stuck != 0;
+    for(int i=0; i<NUM_CLASSES; i++) {
+        for(int j=0; j<NUM_CLASSES; j++) failed |= s.mismatches[i][j] != 0;
+    }
+
+    if (s.checkpoint) fclose(s.checkpoint);
+    free(threads);
+    free(s.done);
+    cpu_free(base);
+    listing_free(l);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,348 @@
+// Exhaustive checks of the f16 unary routines.
+//
+// Every 16-bit input is run through each of these, and the result, with
+// the V flag, compared against the reference library (ref/float16.h) and
+// the behaviour documented in the routine:
+//
+//      .f16_sqrt       r2 = sqrt(a), correctly rounded; V=1 on NaN
+//      .f16_ftoi       r2 = a truncated to a signed integer, or 0x0000 for
+//                      NaN, 0x7fff / 0x8000 when out of range, with V=1
+//      .f16_ftou       r2 = a truncated to an unsigned integer, or 0x0000
+//                      for NaN and a <= -1, 0xffff for +Inf, with V=1
+//      .f16_itof       r2 = the signed integer a, rounded; V=0
+//      .f16_utof       r2 = the unsigned integer a, rounded; V=0
+//      round trip      .f16_parse(.f16_to_ascii(a)) = a, with V=0, except
+//                      for NaN, which parses as NaN with V=1. The string
+//                      must be \0 terminated, with r1 returned past the
+//                      \0. Zero is formatted without its sign, so -0 comes
+//                      back as +0.
+//
+// Each call starts from the snapshot of the machine set up by fixture.h,
+// or for the parse of a round trip, from where the format left it, and the
+// inputs are shared out between a thread per cpu in blocks. Each check is
+// timed, and the cycles taken by the routines are summarised.
+//
+// Usage, after assembling the routines (labels are read from out/asm.log):
+//
+//      ./asm.pl programs/f16/internal.asm programs/f16/sqrt.asm
+//          programs/f16/ftoi.asm programs/f16/itof.asm
+//          programs/f16/ftoa.asm programs/f16/atof.asm > out/asm.log
+//      ./out/f16_unary [CHECK...]
+//
+// f16-test.sh runs this as its "unary" test. Build with "make out/f16_unary".
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "fixture.h"
+#include "listing.h"
+#include "ref/float16.h"
+
+enum {
+    INPUTS = 0x10000,
+    BLOCK = 256,            // inputs claimed by a thread at a time
+    MAX_REPORTS = 20,       // failures printed per check
+    MAX_TEXT = 32,          // formatted value, with room to spare
+    BUF_ADDR = 0xf000       // formatted value
+};
+
+//------------------------------------------------------------------------------
+// Checks
+//
+
+typedef struct
+{
+    u16 z;
+    bool v;
+} result;
+
+typedef struct unary unary;
+
+typedef struct
+{
+    unary *u;
+    cpu *c;
+    u64 cycles;             // of the call(s) for this input
+} context;
+
+typedef struct check
+{
+    const char *name;
+    const char *labels[2];  // the routines called
+    // Run input x, returning 0 on success, or describing the failure in msg.
+    bool (*run)(const struct check *k, context *ctx, u16 x, char *msg, size_t size);
+} check;
+
+struct unary
+{
+    const cpu *base;
+    const check *k;
+    u16 entry[2];
+    int next;               // next input to be claimed
+
+    pthread_mutex_t lock;   // for the rest
+    int failures;
+    u64 cycles;
+    u64 max_cycles;
+};
+
+static bool is_nan(u16 x)
+{
+    return (x & 0x7fff) > 0x7c00;
+}
+
+// Call the routine at entry with r0 and r1, from the snapshot if reset, or
+// else from where the last call left the machine. Returns whether it
+// returned, with its result.
+static bool call(context *ctx, u16 entry, u16 r0, u16 r1, bool reset, result *res)
+{
+    cpu *c = ctx->c;
+    u16 in[2] = {r0, r1};
+    const cpu *from = reset ? ctx->u->base : 0;
+    u64 cycles = (from ? from : c)->cycles;
+    if (fixture_call(c, from, entry, in, 2, FIXTURE_MAX_INSTRUCTIONS) != CALL_RETURNED) {
+        return 0;
+    }
+    ctx->cycles += c->cycles - cycles;
+    res->z = c->r[2];
+    res->v = (c->special_regs[FLAGS] & FLAG_V) != 0;
+    return 1;
+}
+
+// A routine taking r0 to r2, compared with expected.
+static bool check_result(const check *k, context *ctx, u16 x, result expected, char *msg, size_t size)
+{
+    result got;
+    if (!call(ctx, ctx->u->entry[0], x, 0, 1, &got)) {
+        snprintf(msg, size, "STUCK    .%s(%04x)", k->labels[0], x);
+        return 1;
+    }
+    if (got.z != expected.z || got.v != expected.v) {
+        snprintf(msg, size, "MISMATCH .%s(%04x)  got %04x V=%d  expected %04x V=%d",
+                k->labels[0], x, got.z, got.v, expected.z, expected.v);
+        return 1;
+    }
+    return 0;
+}
+
+static bool run_sqrt(const check *k, context *ctx, u16 x, char *msg, size_t size)
+{
+    u16 z = f16_sqrt(x);
+    return check_result(k, ctx, x, (result){z, is_nan(z)}, msg, size);
+}
+
+static bool run_ftoi(const check *k, context *ctx, u16 x, char *msg, size_t size)
+{
+    float f = f16_to_float(x);
+    result expected = isnan(f)      ? (result){0x0000, 1}
+                    : f >= 32768.0f ? (result){0x7fff, 1}
+                    : f < -32768.0f ? (result){0x8000, 1}
+                    :                 (result){(u16)(int)f, 0};
+    return check_result(k, ctx, x, expected, msg, size);
+}
+
+static bool run_ftou(const check *k, context *ctx, u16 x, char *msg, size_t size)
+{
+    float f = f16_to_float(x);
+    result expected = isnan(f)      ? (result){0x0000, 1}
+                    : f <= -1.0f    ? (result){0x0000, 1}
+                    : isinf(f)      ? (result){0xffff, 1}
+                    :                 (result){(u16)(int)f, 0};
+    return check_result(k, ctx, x, expected, msg, size);
+}
+
+static bool run_itof(const check *k, context *ctx, u16 x, char *msg, size_t size)
+{
+    return check_result(k, ctx, x, (result){f16_from_float((short)x), 0}, msg, size);
+}
+
+static bool run_utof(const check *k, context *ctx, u16 x, char *msg, size_t size)
+{
+    return check_result(k, ctx, x, (result){f16_from_float(x), 0}, msg, size);
+}
+
+static bool run_round_trip(const check *k, context *ctx, u16 x, char *msg, size_t size)
+{
+    cpu *c = ctx->c;
+    result formatted, parsed;
+    if (!call(ctx, ctx->u->entry[0], x, BUF_ADDR, 1, &formatted)) {
+        snprintf(msg, size, "STUCK    .%s(%04x)", k->labels[0], x);
+        return 1;
+    }
+    u16 len = c->r[1] - BUF_ADDR;         // including the \0
+    char text[MAX_TEXT];
+    for(u16 i=0; i<len && i<MAX_TEXT; i++) text[i] = mem_rd(c, BUF_ADDR + i, 0);
+    if (len == 0 || len > MAX_TEXT || memchr(text, 0, len) != text + len-1) {
+        snprintf(msg, size, "FORMAT   .%s(%04x) returned r1 = buf+%u", k->labels[0], x, len);
+        return 1;
+    }
+
+    if (!call(ctx, ctx->u->entry[1], BUF_ADDR, 0, 0, &parsed)) {
+        snprintf(msg, size, "STUCK    .%s(\"%s\") from %04x", k->labels[1], text, x);
+        return 1;
+    }
+
+    bool ok = is_nan(x) ? is_nan(parsed.z) && parsed.v
+                        : parsed.z == (x == 0x8000 ? 0x0000 : x) && !parsed.v;
+    if (!ok) {
+        snprintf(msg, size, "MISMATCH %04x -> \"%s\" -> %04x V=%d", x, text, parsed.z, parsed.v);
+        return 1;
+    }
+    return 0;
+}
+
+static const check checks[] = {
+    {"sqrt",       {"f16_sqrt"},                   run_sqrt},
+    {"ftoi",       {"f16_ftoi"},                   run_ftoi},
+    {"ftou",       {"f16_ftou"},                   run_ftou},
+    {"itof",       {"f16_itof"},                   run_itof},
+    {"utof",       {"f16_utof"},                   run_utof},
+    {"round_trip", {"f16_to_ascii", "f16_parse"},  run_round_trip},
+};
+
+//------------------------------------------------------------------------------
+
+static void *worker(void *arg)
+{
+    unary *u = arg;
+    context ctx = {u, cpu_fork(u->base), 0};
+    char msg[160];
+    u64 cycles = 0, max_cycles = 0;
+
+    for(;;) {
+        int first = __atomic_fetch_add(&u->next, BLOCK, __ATOMIC_RELAXED);
+        if (first >= INPUTS) break;
+        for(int x=first; x < first+BLOCK; x++) {
+            ctx.cycles = 0;
+            bool failed = u->k->run(u->k, &ctx, x, msg, sizeof(msg));
+            cycles += ctx.cycles;
+            if (ctx.cycles > max_cycles) max_cycles = ctx.cycles;
+            if (failed) {
+                pthread_mutex_lock(&u->lock);
+                if (u->failures++ < MAX_REPORTS) printf("%s\n", msg);
+                pthread_mutex_unlock(&u->lock);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&u->lock);
+    u->cycles += cycles;
+    if (max_cycles > u->max_cycles) u->max_cycles = max_cycles;
+    pthread_mutex_unlock(&u->lock);
+
+    cpu_free(ctx.c);
+    return 0;
+}
+
+// Run one check over every input. Returns its failures.
+static int run_check(const cpu *base, const listing *l, const check *k, int jobs)
+{
+    static unary u;
+    memset(&u, 0, sizeof(u));
+    u.base = base;
+    u.k = k;
+    pthread_mutex_init(&u.lock, 0);
+    for(int i=0; i<2 && k->labels[i]; i++) {
+        int addr = listing_find(l, k->labels[i]);
+        if (addr < 0) {
+            printf("%-10s  label .%s not found - skipped\n", k->name, k->labels[i]);
+            return 1;
+        }
+        u.entry[i] = addr;
+    }
+
+    double start = fixture_now();
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    for(int t=0; t<jobs; t++) pthread_create(&threads[t], 0, worker, &u);
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+    double elapsed = fixture_now() - start;
+    free(threads);
+
+    if (u.failures > MAX_REPORTS) {
+        printf("... %d more\n", u.failures - MAX_REPORTS);
+    }
+    printf("%-10s  %s  %5d failures  %6.3fs  cycles mean %.1f max %llu\n",
+            k->name, u.failures ? "FAIL" : "pass", u.failures, elapsed,
+            (double)u.cycles / INPUTS, (unsigned long long)u.max_cycles);
+    pthread_mutex_destroy(&u.lock);
+    return u.failures;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: check the f16 unary routines over every input\n\n", prog);
+    fprintf(stderr, "Usage: %s [options] [CHECK...]\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -A, --asm FILE         read labels from FILE (default: out/asm.log)\n");
+    fprintf(stderr, "  -j, --jobs N           run N threads (default: one per cpu)\n");
+    fprintf(stderr, "\nChecks (default: all):\n");
+    for(size_t i=0; i<sizeof(checks)/sizeof(checks[0]); i++) {
+        fprintf(stderr, "  %s\n", checks[i].name);
+    }
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *asm_file = "out/asm.log";
+    int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    bool selected[sizeof(checks)/sizeof(checks[0])] = {};
+    bool any_selected = 0;
+
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-A") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if (argv[i][0] != '-') {
+            size_t k;
+            for(k=0; k<sizeof(checks)/sizeof(checks[0]); k++) {
+                if (!strcmp(checks[k].name, argv[i])) break;
+            }
+            if (k == sizeof(checks)/sizeof(checks[0])) {
+                fprintf(stderr, "%s: unknown check `%s' - see --help\n", argv[0], argv[i]);
+                exit(1);
+            }
+            selected[k] = 1;
+            any_selected = 1;
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+    if (jobs < 1) jobs = 1;
+
+    listing *l = listing_load(asm_file);
+    if (l == 0) {
+        exit(1);
+    }
+
+    cpu *base = fixture_load("out/mem.bin");
+    if (base == 0) {
+        exit(1);
+    }
+
+    int failed = 0;
+    double start = fixture_now();
+    for(size_t k=0; k<sizeof(checks)/sizeof(checks[0]); k++) {
+        if (any_selected && !selected[k]) continue;
+        failed += run_check(base, l, &checks[k], jobs) != 0;
+    }
+    printf("%d checks failed, in %.2fs on %d threads\n", failed, fixture_now() - start, jobs);
+
+    cpu_free(base);
+    listing_free(l);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,525 @@
+// Randomised checks of the f16 vector routines (programs/f16/vector.asm).
+//
+// Each check runs random arrays of 0 to MAX_N elements through its routine,
+// and compares what it returns, and what it writes, against the reference
+// library (ref/float16.h):
+//
+//      .f16_dot        r2 = f16_dot(x, y, n); V=1 on NaN
+//      .f16_sum        r2 = f16_sum(x, n); V=1 on NaN
+//      .f16_scale      x[i] = f16_mul(s, x[i])
+//      .f16_axpy       y[i] = f16_fma(a, x[i], y[i])
+//
+// f16_dot and f16_sum model the routines step by step, so the reductions
+// are also checked independently, against the exact result computed in
+// 128 bit fixed point and correctly rounded. Rounding the routines' 30 bit
+// sum may be 1 ulp away from that, but no further; infinities and NaNs
+// must match it exactly.
+//
+// The arrays are drawn in a few styles: any finite values, values of
+// similar magnitude (so that sums cancel), small and subnormal values, and
+// any of these mixed with zeros, infinities and NaNs. Every case is
+// generated from its number, so a failure can be repeated. Each call starts
+// from the snapshot of the machine set up by fixture.h, with the arrays
+// written into it; the routines must return with sp as it was, and must not
+// write past the arrays.
+//
+// Usage, after assembling the routines (labels are read from out/asm.log):
+//
+//      ./asm.pl programs/f16/internal.asm programs/f16/mul.asm
+//          programs/f16/fma.asm programs/f16/vector.asm > out/asm.log
+//      ./out/f16_vector [CHECK...]
+//
+// f16-test.sh runs this as its "vector" test. Build with "make out/f16_vector".
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "fixture.h"
+#include "listing.h"
+#include "ref/float16.h"
+
+enum {
+    MAX_N = 48,             // elements in an array
+    BLOCK = 64,             // cases claimed by a thread at a time
+    MAX_REPORTS = 20,       // failures printed per check
+    GUARD = 0xdead,         // the word after each array
+    X_ADDR = 0xe000,
+    Y_ADDR = 0xe100
+};
+
+//------------------------------------------------------------------------------
+// Cases
+//
+
+typedef struct
+{
+    u64 state;
+} rng;
+
+static u32 next(rng *r)
+{
+    // splitmix64
+    u64 z = (r->state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return (z ^ (z >> 31)) >> 32;
+}
+
+static u32 below(rng *r, u32 n)
+{
+    return next(r) % n;
+}
+
+enum { ANY, SIMILAR, SMALL, STYLES };
+
+// A value in the given style, or with specials, sometimes a special instead.
+static u16 value(rng *r, int style, bool specials)
+{
+    static const u16 special[] = {0x0000, 0x8000, 0x7c00, 0xfc00, 0x7e00, 0x0001, 0x83ff};
+    if (specials && below(r, 8) == 0) {
+        return special[below(r, sizeof(special)/sizeof(special[0]))];
+    }
+    u16 sign = next(r) & 0x8000;
+    u16 exp = style == SIMILAR ? 12 + below(r, 6)
+            : style == SMALL   ? below(r, 8)
+            :                    1 + below(r, 30);
+    return sign | exp << 10 | (next(r) & 0x3ff);
+}
+
+typedef struct
+{
+    u16 n;
+    u16 s;                  // the scalar, of .f16_scale and .f16_axpy
+    u16 x[MAX_N];
+    u16 y[MAX_N];
+} vectors;
+
+// Case number i of a check.
+static void generate(u64 i, vectors *v)
+{
+    rng r = {i * 0x2545f4914f6cdd1dull + 1};
+    int style = i % STYLES;
+    bool specials = (i / STYLES) % 4 == 0;
+    v->n = below(&r, MAX_N + 1);
+    v->s = value(&r, style, specials);
+    for(int k=0; k<v->n; k++) {
+        v->x[k] = value(&r, style, specials);
+        v->y[k] = value(&r, style, specials);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Checks
+//
+
+typedef struct vector vector;
+
+typedef struct
+{
+    vector *u;
+    cpu *c;
+    u64 cycles;             // of the call for this case
+} context;
+
+typedef struct check
+{
+    const char *name;
+    const char *label;      // the routine called
+    // Run case v, returning 0 on success, or describing the failure in msg.
+    bool (*run)(const struct check *k, context *ctx, const vectors *v, char *msg, size_t size);
+} check;
+
+struct vector
+{
+    const cpu *base;
+    const check *k;
+    u16 entry;
+    u64 cases;
+    u64 next;               // next case to be claimed
+
+    pthread_mutex_t lock;   // for the rest
+    int failures;
+    u64 cycles;
+    u64 elements;
+    u64 max_cycles;
+};
+
+static bool is_nan(u16 x)
+{
+    return (x & 0x7fff) > 0x7c00;
+}
+
+// The finite f16 x as a multiple of 2^-24.
+static __int128 fixed(u16 x)
+{
+    int exp = (x >> 10) & 0x1f;
+    __int128 m = exp ? (x & 0x3ff) | 0x400 : x & 0x3ff;
+    m <<= exp ? exp - 1 : 0;
+    return (x & 0x8000) ? -m : m;
+}
+
+// s * 2^-scale, correctly rounded to nearest even.
+static u16 round_fixed(__int128 s, int scale)
+{
+    u16 sign = s < 0 ? 0x8000 : 0;
+    unsigned __int128 mag = s < 0 ? -s : s;
+    int bits = 0;
+    while(bits < 128 && (mag >> bits) != 0) bits++;
+
+    // keep 11 bits, or down to units of 2^-24 if subnormal
+    int shift = bits - 11 > scale - 24 ? bits - 11 : scale - 24;
+    unsigned __int128 q = mag;
+    if (shift > 0) {
+        unsigned __int128 rem = mag & (((unsigned __int128)1 << shift) - 1);
+        unsigned __int128 half = (unsigned __int128)1 << (shift - 1);
+        q = mag >> shift;
+        if (rem > half || (rem == half && (q & 1))) q++;
+    } else {
+        q <<= -shift;
+    }
+    int exp = shift - scale + 25;
+    if (q == 0x800) {
+        q >>= 1;
+        exp++;
+    }
+    if (q < 0x400) return sign | (u16)q;
+    if (exp >= 31) return sign | 0x7c00;
+    return sign | exp << 10 | ((u16)q & 0x3ff);
+}
+
+// Infinities and NaNs found among the terms, or 0 if there are none.
+static u16 special_sum(bool nan, bool pos_inf, bool neg_inf)
+{
+    if (nan || (pos_inf && neg_inf)) return F16_QNAN;
+    if (pos_inf) return 0x7c00;
+    if (neg_inf) return 0xfc00;
+    return 0;
+}
+
+static bool is_inf(u16 x)
+{
+    return (x & 0x7fff) == 0x7c00;
+}
+
+// x[0]*y[0] + ... + x[n-1]*y[n-1], correctly rounded. Zeros may have
+// either sign.
+static u16 exact_dot(const u16 *x, const u16 *y, int n)
+{
+    bool nan = 0, pos_inf = 0, neg_inf = 0;
+    __int128 s = 0;
+    for(int i=0; i<n; i++) {
+        if (is_nan(x[i]) || is_nan(y[i])) {
+            nan = 1;
+        } else if (is_inf(x[i]) || is_inf(y[i])) {
+            if ((x[i] & 0x7fff) == 0 || (y[i] & 0x7fff) == 0) nan = 1;
+            else if ((x[i] ^ y[i]) & 0x8000) neg_inf = 1;
+            else pos_inf = 1;
+        } else {
+            s += fixed(x[i]) * fixed(y[i]);
+        }
+    }
+    u16 special = special_sum(nan, pos_inf, neg_inf);
+    return special ? special : round_fixed(s, 48);
+}
+
+// x[0] + ... + x[n-1], correctly rounded. Zeros may have either sign.
+static u16 exact_sum(const u16 *x, int n)
+{
+    bool nan = 0, pos_inf = 0, neg_inf = 0;
+    __int128 s = 0;
+    for(int i=0; i<n; i++) {
+        if (is_nan(x[i])) nan = 1;
+        else if (x[i] == 0x7c00) pos_inf = 1;
+        else if (x[i] == 0xfc00) neg_inf = 1;
+        else s += fixed(x[i]);
+    }
+    u16 special = special_sum(nan, pos_inf, neg_inf);
+    return special ? special : round_fixed(s, 24);
+}
+
+// x as an integer, ordered as the f16 values are, and one apart from its
+// neighbours.
+static int ordered(u16 x)
+{
+    return (x & 0x8000) ? -(x & 0x7fff) : x;
+}
+
+static void write_array(cpu *c, u16 addr, const u16 *a, int n)
+{
+    for(int k=0; k<n; k++) mem_wr(c, addr + 2*k, 1, a[k]);
+    mem_wr(c, addr + 2*n, 1, GUARD);
+}
+
+// Whether the array at addr holds expected, with the guard word after it.
+// If not, describes the first difference in msg.
+static bool array_is(cpu *c, const check *k, const char *array, u16 addr,
+        const u16 *expected, int n, char *msg, size_t size)
+{
+    for(int i=0; i<n; i++) {
+        u16 got = mem_rd(c, addr + 2*i, 1);
+        if (got != expected[i]) {
+            snprintf(msg, size, "MISMATCH .%s n=%d  %s[%d] got %04x expected %04x",
+                    k->label, n, array, i, got, expected[i]);
+            return 0;
+        }
+    }
+    if (mem_rd(c, addr + 2*n, 1) != GUARD) {
+        snprintf(msg, size, "OVERRUN  .%s n=%d  wrote past %s", k->label, n, array);
+        return 0;
+    }
+    return 1;
+}
+
+// Call the routine with r0 to r3, from the snapshot the worker copied and
+// wrote the arrays into. Returns whether it returned, with sp restored,
+// leaving the result in r2.
+static bool call(context *ctx, const check *k, u16 r0, u16 r1, u16 r2, u16 r3, char *msg, size_t size)
+{
+    cpu *c = ctx->c;
+    u16 in[4] = {r0, r1, r2, r3};
+    u64 cycles = c->cycles;
+
+    switch(fixture_call(c, 0, ctx->u->entry, in, 4, FIXTURE_MAX_INSTRUCTIONS)) {
+        case CALL_RETURNED:
+            break;
+        case CALL_STUCK:
+            snprintf(msg, size, "STUCK    .%s(%04x, %04x, %04x, %04x)", k->label, r0, r1, r2, r3);
+            return 0;
+        case CALL_STACK:
+            snprintf(msg, size, "STACK    .%s returned with sp=%04x", k->label, c->r[13]);
+            return 0;
+    }
+    ctx->cycles = c->cycles - cycles;
+    return 1;
+}
+
+// A reduction's result, in r2 with the V flag.
+static bool result_is(context *ctx, const check *k, const vectors *v, u16 expected, char *msg, size_t size)
+{
+    u16 got = ctx->c->r[2];
+    bool got_v = (ctx->c->special_regs[FLAGS] & FLAG_V) != 0;
+    if (got != expected || got_v != is_nan(expected)) {
+        snprintf(msg, size, "MISMATCH .%s n=%d  got %04x V=%d  expected %04x V=%d",
+                k->label, v->n, got, got_v, expected, is_nan(expected));
+        return 0;
+    }
+    return 1;
+}
+
+// A reduction's result in r2, against the exact one: within 1 ulp if
+// finite, otherwise the same.
+static bool near_exact(context *ctx, const check *k, const vectors *v, u16 exact, char *msg, size_t size)
+{
+    u16 got = ctx->c->r[2];
+    bool finite = !is_nan(got) && !is_inf(got) && !is_nan(exact) && !is_inf(exact);
+    int ulps = abs(ordered(got) - ordered(exact));
+    if (finite ? ulps > 1 : got != exact) {
+        snprintf(msg, size, "INEXACT  .%s n=%d  got %04x  correctly rounded %04x",
+                k->label, v->n, got, exact);
+        return 0;
+    }
+    return 1;
+}
+
+static bool run_dot(const check *k, context *ctx, const vectors *v, char *msg, size_t size)
+{
+    write_array(ctx->c, X_ADDR, v->x, v->n);
+    write_array(ctx->c, Y_ADDR, v->y, v->n);
+    return !call(ctx, k, X_ADDR, Y_ADDR, v->n, 0, msg, size) ||
+           !result_is(ctx, k, v, f16_dot(v->x, v->y, v->n), msg, size) ||
+           !near_exact(ctx, k, v, exact_dot(v->x, v->y, v->n), msg, size) ||
+           !array_is(ctx->c, k, "x", X_ADDR, v->x, v->n, msg, size) ||
+           !array_is(ctx->c, k, "y", Y_ADDR, v->y, v->n, msg, size);
+}
+
+static bool run_sum(const check *k, context *ctx, const vectors *v, char *msg, size_t size)
+{
+    write_array(ctx->c, X_ADDR, v->x, v->n);
+    return !call(ctx, k, X_ADDR, v->n, 0, 0, msg, size) ||
+           !result_is(ctx, k, v, f16_sum(v->x, v->n), msg, size) ||
+           !near_exact(ctx, k, v, exact_sum(v->x, v->n), msg, size) ||
+           !array_is(ctx->c, k, "x", X_ADDR, v->x, v->n, msg, size);
+}
+
+static bool run_scale(const check *k, context *ctx, const vectors *v, char *msg, size_t size)
+{
+    u16 expected[MAX_N];
+    for(int i=0; i<v->n; i++) expected[i] = f16_mul(v->s, v->x[i]);
+    write_array(ctx->c, X_ADDR, v->x, v->n);
+    return !call(ctx, k, v->s, X_ADDR, v->n, 0, msg, size) ||
+           !array_is(ctx->c, k, "x", X_ADDR, expected, v->n, msg, size);
+}
+
+static bool run_axpy(const check *k, context *ctx, const vectors *v, char *msg, size_t size)
+{
+    u16 expected[MAX_N];
+    for(int i=0; i<v->n; i++) expected[i] = f16_fma(v->s, v->x[i], v->y[i]);
+    write_array(ctx->c, X_ADDR, v->x, v->n);
+    write_array(ctx->c, Y_ADDR, v->y, v->n);
+    return !call(ctx, k, v->s, X_ADDR, Y_ADDR, v->n, msg, size) ||
+           !array_is(ctx->c, k, "y", Y_ADDR, expected, v->n, msg, size) ||
+           !array_is(ctx->c, k, "x", X_ADDR, v->x, v->n, msg, size);
+}
+
+static const check checks[] = {
+    {"dot",     "f16_dot",      run_dot},
+    {"sum",     "f16_sum",      run_sum},
+    {"scale",   "f16_scale",    run_scale},
+    {"axpy",    "f16_axpy",     run_axpy},
+};
+
+//------------------------------------------------------------------------------
+
+static void *worker(void *arg)
+{
+    vector *u = arg;
+    context ctx = {u, cpu_fork(u->base), 0};
+    char msg[160];
+    u64 cycles = 0, elements = 0, max_cycles = 0;
+    vectors v;
+
+    for(;;) {
+        u64 first = __atomic_fetch_add(&u->next, BLOCK, __ATOMIC_RELAXED);
+        if (first >= u->cases) break;
+        for(u64 i=first; i < first+BLOCK && i < u->cases; i++) {
+            generate(i, &v);
+            cpu_copy(ctx.c, u->base);
+            ctx.cycles = 0;
+            bool failed = u->k->run(u->k, &ctx, &v, msg, sizeof(msg));
+            cycles += ctx.cycles;
+            elements += v.n;
+            if (ctx.cycles > max_cycles) max_cycles = ctx.cycles;
+            if (failed) {
+                pthread_mutex_lock(&u->lock);
+                if (u->failures++ < MAX_REPORTS) printf("%s  (case %llu)\n", msg, (unsigned long long)i);
+                pthread_mutex_unlock(&u->lock);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&u->lock);
+    u->cycles += cycles;
+    u->elements += elements;
+    if (max_cycles > u->max_cycles) u->max_cycles = max_cycles;
+    pthread_mutex_unlock(&u->lock);
+
+    cpu_free(ctx.c);
+    return 0;
+}
+
+// Run one check over its cases. Returns its failures.
+static int run_check(const cpu *base, const listing *l, const check *k, u64 cases, int jobs)
+{
+    static vector u;
+    memset(&u, 0, sizeof(u));
+    u.base = base;
+    u.k = k;
+    u.cases = cases;
+    pthread_mutex_init(&u.lock, 0);
+    int addr = listing_find(l, k->label);
+    if (addr < 0) {
+        printf("%-6s  label .%s not found - skipped\n", k->name, k->label);
+        return 1;
+    }
+    u.entry = addr;
+
+    double start = fixture_now();
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    for(int t=0; t<jobs; t++) pthread_create(&threads[t], 0, worker, &u);
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+    double elapsed = fixture_now() - start;
+    free(threads);
+
+    if (u.failures > MAX_REPORTS) {
+        printf("... %d more\n", u.failures - MAX_REPORTS);
+    }
+    printf("%-6s  %s  %5d failures  %6.3fs  cycles per element %.1f, per call max %llu\n",
+            k->name, u.failures ? "FAIL" : "pass", u.failures, elapsed,
+            u.elements ? (double)u.cycles / u.elements : 0.0,
+            (unsigned long long)u.max_cycles);
+    pthread_mutex_destroy(&u.lock);
+    return u.failures;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: check the f16 vector routines over random arrays\n\n", prog);
+    fprintf(stderr, "Usage: %s [options] [CHECK...]\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -A, --asm FILE         read labels from FILE (default: out/asm.log)\n");
+    fprintf(stderr, "  -n, --cases N          run N cases of each check (default: 100000)\n");
+    fprintf(stderr, "  -j, --jobs N           run N threads (default: one per cpu)\n");
+    fprintf(stderr, "\nChecks (default: all):\n");
+    for(size_t i=0; i<sizeof(checks)/sizeof(checks[0]); i++) {
+        fprintf(stderr, "  %s\n", checks[i].name);
+    }
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *asm_file = "out/asm.log";
+    u64 cases = 100000;
+    int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    bool selected[sizeof(checks)/sizeof(checks[0])] = {};
+    bool any_selected = 0;
+
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-A") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-n") || !strcmp(argv[i], "--cases")) && i+1 < argc) {
+            cases = strtoull(argv[++i], 0, 0);
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if (argv[i][0] != '-') {
+            size_t k;
+            for(k=0; k<sizeof(checks)/sizeof(checks[0]); k++) {
+                if (!strcmp(checks[k].name, argv[i])) break;
+            }
+            if (k == sizeof(checks)/sizeof(checks[0])) {
+                fprintf(stderr, "%s: unknown check `%s' - see --help\n", argv[0], argv[i]);
+                exit(1);
+            }
+            selected[k] = 1;
+            any_selected = 1;
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+    if (jobs < 1) jobs = 1;
+
+    listing *l = listing_load(asm_file);
+    if (l == 0) {
+        exit(1);
+    }
+
+    cpu *base = fixture_load("out/mem.bin");
+    if (base == 0) {
+        exit(1);
+    }
+
+    int failed = 0;
+    double start = fixture_now();
+    for(size_t k=0; k<sizeof(checks)/sizeof(checks[0]); k++) {
+        if (any_selected && !selected[k]) continue;
+        failed += run_check(base, l, &checks[k], cases, jobs) != 0;
+    }
+    printf("%d checks failed, in %.2fs on %d threads\n", failed, fixture_now() - start, jobs);
+
+    cpu_free(base);
+    listing_free(l);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,44 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "fixture.h"
+
+cpu *fixture_load(const char *base)
+{
+    cpu *c = cpu_new();
+    if (cpu_load_image(c, base)) {
+        fprintf(stderr, "could not load %s.0, %s.1\n", base, base);
+        cpu_free(c);
+        return 0;
+    }
+    mem_wr(c, FIXTURE_RETURN_ADDR, 1, 0x3fff);      // hlt
+    return c;
+}
+
+call_status fixture_call(cpu *c, const cpu *snapshot, u16 entry,
+        const u16 *in, int num_in, u64 max_instructions)
+{
+    if (snapshot) cpu_copy(c, snapshot);
+    for(int i=0; i<num_in; i++) {
+        c->r[i] = in[i];
+    }
+    c->r[13] = FIXTURE_STACK_ADDR;
+    c->r[14] = FIXTURE_RETURN_ADDR;
+    c->r[15] = entry;
+
+    if (cpu_run(c, max_instructions) != RUN_STOPPED ||
+            c->stop_substate != SS_HALT || c->r[15] != (u16)(FIXTURE_RETURN_ADDR + 2)) {
+        return CALL_STUCK;
+    }
+    if (c->r[13] != FIXTURE_STACK_ADDR) {
+        return CALL_STACK;
+    }
+    return CALL_RETURNED;
+}
+
+double fixture_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,49 @@
+#ifndef FIXTURE_H
+#define FIXTURE_H
+
+// Fixture for the tools which call a routine over and over - fuzz.c,
+// f16_sweep.c, f16_unary.c and f16_vector.c.
+//
+// The image is loaded once into a snapshot of the machine, with a hlt at
+// the return address. Each call copies the snapshot into the caller's
+// machine, which shares its memory copy-on-write, sets up the arguments,
+// stack and link, and runs the routine until it halts at the return
+// address.
+
+#include "cpu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    FIXTURE_RETURN_ADDR = 0xfffe,       // where the hlt is
+    FIXTURE_STACK_ADDR = 0xfe00,
+    FIXTURE_MAX_INSTRUCTIONS = 100000   // a call which runs for longer is taken to be stuck
+};
+
+typedef enum {
+    CALL_RETURNED,
+    CALL_STUCK,         // did not halt at the return address in time
+    CALL_STACK          // returned, but without restoring sp
+} call_status;
+
+// Load the image in base.0 and base.1 (e.g. "out/mem.bin") into a new
+// machine, with a hlt at FIXTURE_RETURN_ADDR. On failure a message is
+// printed to stderr, and 0 returned.
+cpu *fixture_load(const char *base);
+
+// Call the routine at entry in c, with r0 onwards set from the num_in
+// words of in, and sp and the link set up. The call starts from snapshot,
+// or from where the last call left c if snapshot is 0.
+call_status fixture_call(cpu *c, const cpu *snapshot, u16 entry,
+        const u16 *in, int num_in, u64 max_instructions);
+
+// Seconds on the monotonic clock, for timing runs.
+double fixture_now(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
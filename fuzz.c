@@ -0,0 +1,471 @@
+// Coverage-guided fuzzer for vixen routines.
+//
+// A routine is called over and over, from its entry label, with inputs
+// mutated from a corpus, and its outputs checked against a host reference.
+// The inputs are in r0 upwards, and for routines taking arrays, also in
+// memory, at an address fixed per target. An input is kept in the corpus
+// when it takes some pr* a way it has not gone before (see cpu->edges), so
+// the fuzzer works its way into the routine's rarer paths rather than
+// sampling inputs blindly.
+//
+// Each call starts from the snapshot of the machine set up by fixture.h,
+// with the image loaded and a hlt at the return address: resetting to it
+// with cpu_copy() costs only the pages the last call wrote to, and the
+// predecoded instructions carry over, so a thread makes millions of calls
+// a second. Each thread keeps its own corpus and edges.
+//
+// Usage, after assembling the routine (labels are read from out/asm.log):
+//
+//      ./asm.pl programs/f16/internal.asm programs/f16/div.asm > out/asm.log
+//      ./out/fuzz f16_div
+//
+//      ./asm.pl programs/math.asm > out/asm.log
+//      ./out/fuzz math_udiv32
+//
+//      ./asm.pl programs/f16/internal.asm programs/f16/mul.asm
+//          programs/f16/fma.asm programs/f16/vector.asm > out/asm.log
+//      ./out/fuzz f16_dot
+//
+// The f16 routines are checked against ref/float16.c, which is correctly
+// rounded; NaN results must be the canonical quiet NaN, 0x7e00, as in the
+// test data.
+//
+// Build with "make out/fuzz".
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "fixture.h"
+#include "listing.h"
+#include "ref/float16.h"
+
+enum {
+    MAX_IN = 4,             // input registers, from r0
+    MAX_MEM = 32,           // input words in memory
+    MAX_OUT = 4,
+    MAX_REPORTS = 20        // mismatches printed
+};
+
+//------------------------------------------------------------------------------
+// Targets
+//
+
+typedef struct
+{
+    const char *label;      // entry, without the '.'
+    int num_in;
+    int num_out;
+    u8 out_regs[MAX_OUT];
+    void (*ref)(const u16 *in, u16 *out);
+    void (*fix)(u16 *in);   // make an input valid, if needed
+    const u16 *interesting; // values to mutate towards
+    int num_interesting;
+    u16 mem_addr;           // where the input's words after the registers go
+    int num_mem;            // how many there are
+} target;
+
+// The words of an input: the registers, then those in memory.
+static int num_words(const target *t)
+{
+    return t->num_in + t->num_mem;
+}
+
+static void ref_f16_mul(const u16 *in, u16 *out) { out[0] = f16_mul(in[0], in[1]); }
+static void ref_f16_div(const u16 *in, u16 *out) { out[0] = f16_div(in[0], in[1]); }
+static void ref_f16_add(const u16 *in, u16 *out) { out[0] = f16_add(in[0], in[1]); }
+static void ref_f16_sub(const u16 *in, u16 *out) { out[0] = f16_sub(in[0], in[1]); }
+
+enum {
+    VECTOR_ADDR = 0xe000,
+    VECTOR_N = MAX_MEM/2    // elements in each of x and y for f16_dot
+};
+
+// r0 = x, r1 = y, r2 = n, then x[] and y[] in memory
+static void ref_f16_dot(const u16 *in, u16 *out) { out[0] = f16_dot(in + 3, in + 3 + VECTOR_N, in[2]); }
+
+// r0 = x, r1 = n, then x[] in memory
+static void ref_f16_sum(const u16 *in, u16 *out) { out[0] = f16_sum(in + 2, in[1]); }
+
+static void fix_dot(u16 *in)
+{
+    in[0] = VECTOR_ADDR;
+    in[1] = VECTOR_ADDR + 2*VECTOR_N;
+    in[2] %= VECTOR_N + 1;
+}
+
+static void fix_sum(u16 *in)
+{
+    in[0] = VECTOR_ADDR;
+    in[1] %= MAX_MEM + 1;
+}
+
+static u32 word(const u16 *w) { return (u32)w[0] << 16 | w[1]; }
+static void split(u32 v, u16 *w) { w[0] = v >> 16; w[1] = v; }
+
+// quotient then remainder
+static void ref_udiv32(const u16 *in, u16 *out)
+{
+    u32 u = word(in);
+    u32 v = word(in + 2);
+    split(u / v, out);
+    split(u % v, out + 2);
+}
+
+static void ref_mul32x32(const u16 *in, u16 *out)
+{
+    split(word(in) * word(in + 2), out);
+}
+
+static void fix_divisor(u16 *in)
+{
+    if (in[2] == 0 && in[3] == 0) in[3] = 1;
+}
+
+static const u16 f16_interesting[] = {
+    0x0000, 0x0001, 0x03ff, 0x0400, 0x3c00, 0x3c01, 0x4000, 0x4200,
+    0x7bff, 0x7c00, 0x7c01, 0x7e00, 0x7fff, 0x3bff, 0x0200, 0x0401,
+    0x8000, 0x8001, 0x83ff, 0x8400, 0xbc00, 0xbc01, 0xc000, 0xc200,
+    0xfbff, 0xfc00, 0xfc01, 0xfe00, 0xffff, 0xbbff, 0x8200, 0x8401,
+};
+
+static const u16 u16_interesting[] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x00ff, 0x0100, 0x7fff, 0x8000,
+    0x8001, 0xfffe, 0xffff, 0x5555, 0xaaaa, 0x0010, 0x1000, 0x0fff,
+};
+
+#define F16_BINARY(name) \
+    {#name, 2, 1, {2}, ref_##name, 0, f16_interesting, sizeof(f16_interesting)/sizeof(u16), 0, 0}
+
+static const target targets[] = {
+    F16_BINARY(f16_mul),
+    F16_BINARY(f16_div),
+    F16_BINARY(f16_add),
+    F16_BINARY(f16_sub),
+    {"math_udiv32",      4, 4, {0, 1, 4, 5}, ref_udiv32,   fix_divisor, u16_interesting, sizeof(u16_interesting)/sizeof(u16), 0, 0},
+    {"math_udiv32_fast", 4, 4, {4, 5, 0, 1}, ref_udiv32,   fix_divisor, u16_interesting, sizeof(u16_interesting)/sizeof(u16), 0, 0},
+    {"math_mul32x32",    4, 2, {4, 5},       ref_mul32x32, 0,           u16_interesting, sizeof(u16_interesting)/sizeof(u16), 0, 0},
+    {"f16_dot",          3, 1, {2},          ref_f16_dot,  fix_dot,     f16_interesting, sizeof(f16_interesting)/sizeof(u16), VECTOR_ADDR, MAX_MEM},
+    {"f16_sum",          2, 1, {2},          ref_f16_sum,  fix_sum,     f16_interesting, sizeof(f16_interesting)/sizeof(u16), VECTOR_ADDR, MAX_MEM},
+};
+
+//------------------------------------------------------------------------------
+// Fuzzing
+//
+
+typedef struct
+{
+    u16 in[MAX_IN + MAX_MEM];
+} input;
+
+typedef struct
+{
+    const target *t;
+    const cpu *base;
+    u16 entry;
+    u64 execs;              // per thread
+    double seconds;         // or 0
+    u64 seed;
+
+    pthread_mutex_t lock;   // for the rest
+    int mismatches;
+    u8 edges[0x10000];      // union over the threads
+    input *corpus;          // likewise
+    int corpus_size;
+    u64 total_execs;
+} fuzz;
+
+typedef struct
+{
+    fuzz *f;
+    int index;
+} worker_arg;
+
+static u64 next_random(u64 *state)
+{
+    // xorshift64*
+    u64 x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545f4914f6cdd1dull;
+}
+
+static void mutate(const target *t, input *x, const input *other, u64 *rng)
+{
+    int n = 1 + next_random(rng) % 3;
+    for(int k=0; k<n; k++) {
+        u64 r = next_random(rng);
+        u16 *w = &x->in[(r >> 8) % num_words(t)];
+        switch(r % 8) {
+            case 0: *w = r >> 32; break;
+            case 1: *w ^= 1 << ((r >> 32) & 0xf); break;
+            case 2: *w = t->interesting[(r >> 32) % t->num_interesting]; break;
+            case 3: *w += (int)((r >> 32) % 33) - 16; break;
+            case 4: *w ^= 0x8000; break;
+            case 5: *w = (*w & 0x83ff) | ((r >> 32) & 0x7c00); break;     // f16 exponent
+            case 6: *w = (*w & 0xfc00) | ((r >> 32) & 0x03ff); break;     // f16 fraction
+            case 7: *w = other->in[(r >> 40) % num_words(t)]; break;
+        }
+    }
+    if (t->fix) t->fix(x->in);
+}
+
+// Call the routine with x, from the snapshot. Returns whether it returned,
+// with its outputs in out.
+static bool call(const fuzz *f, cpu *c, const input *x, u16 *out)
+{
+    const target *t = f->t;
+    cpu_copy(c, f->base);
+    for(int i=0; i<t->num_mem; i++) {
+        mem_wr(c, t->mem_addr + 2*i, 1, x->in[t->num_in + i]);
+    }
+    if (fixture_call(c, 0, f->entry, x->in, t->num_in, FIXTURE_MAX_INSTRUCTIONS) != CALL_RETURNED) {
+        return 0;
+    }
+    for(int i=0; i<f->t->num_out; i++) {
+        out[i] = c->r[f->t->out_regs[i]];
+    }
+    return 1;
+}
+
+static void report(fuzz *f, const input *x, const u16 *got, const u16 *expected, bool returned)
+{
+    pthread_mutex_lock(&f->lock);
+    if (f->mismatches++ < MAX_REPORTS) {
+        printf("%s", returned ? "MISMATCH" : "STUCK");
+        for(int i=0; i<f->t->num_in; i++) printf(" r%d=%04x", i, x->in[i]);
+        if (f->t->num_mem) {
+            printf("  [%04x]", f->t->mem_addr);
+            for(int i=0; i<f->t->num_mem; i++) printf(" %04x", x->in[f->t->num_in + i]);
+        }
+        if (returned) {
+            printf("  got");
+            for(int i=0; i<f->t->num_out; i++) printf(" %04x", got[i]);
+        }
+        printf("  expected");
+        for(int i=0; i<f->t->num_out; i++) printf(" %04x", expected[i]);
+        printf("\n");
+    }
+    pthread_mutex_unlock(&f->lock);
+}
+
+// Run x, returning whether it reached new edges.
+static bool run_input(fuzz *f, cpu *c, const input *x)
+{
+    u16 got[MAX_OUT], expected[MAX_OUT];
+    u64 new_edges = c->new_edges;
+    bool returned = call(f, c, x, got);
+    f->t->ref(x->in, expected);
+    if (!returned || memcmp(got, expected, f->t->num_out * sizeof(u16))) {
+        report(f, x, got, expected, returned);
+    }
+    return c->new_edges != new_edges;
+}
+
+static void *worker(void *arg)
+{
+    fuzz *f = ((worker_arg *)arg)->f;
+    const target *t = f->t;
+    u64 rng = f->seed * 0x9e3779b97f4a7c15ull + ((worker_arg *)arg)->index + 1;
+
+    cpu *c = cpu_fork(f->base);
+    c->edges = calloc(0x10000, 1);
+
+    int size = 0, capacity = 256;
+    input *corpus = malloc(capacity * sizeof(input));
+
+    // seed the corpus with the interesting values: every pair for binary
+    // operations, and a spread of them otherwise
+    u64 execs = 0;
+    int words = num_words(t);
+    int seeds = words <= 2 ? t->num_interesting * t->num_interesting : 4096;
+    for(int i=0; i<seeds || size == 0; i++) {
+        input x = {};
+        for(int j=0; j<words; j++) {
+            int k = words <= 2 && i < seeds ? (j ? i % t->num_interesting : i / t->num_interesting)
+                                            : (int)(next_random(&rng) % t->num_interesting);
+            x.in[j] = t->interesting[k];
+        }
+        if (t->fix) t->fix(x.in);
+        execs++;
+        if (run_input(f, c, &x) || (size == 0 && i >= seeds)) {
+            corpus[size++] = x;
+        }
+    }
+
+    double deadline = f->seconds ? fixture_now() + f->seconds : 0;
+    for( ; f->seconds ? 1 : execs < f->execs; execs++) {
+        if (deadline && (execs & 0xfff) == 0 && fixture_now() >= deadline) break;
+
+        input x = corpus[next_random(&rng) % size];
+        mutate(t, &x, &corpus[next_random(&rng) % size], &rng);
+        if (run_input(f, c, &x)) {
+            if (size == capacity) {
+                capacity *= 2;
+                corpus = realloc(corpus, capacity * sizeof(input));
+            }
+            corpus[size++] = x;
+        }
+    }
+
+    pthread_mutex_lock(&f->lock);
+    for(int i=0; i<0x10000; i++) f->edges[i] |= c->edges[i];
+    f->corpus = realloc(f->corpus, (f->corpus_size + size) * sizeof(input));
+    memcpy(f->corpus + f->corpus_size, corpus, size * sizeof(input));
+    f->corpus_size += size;
+    f->total_execs += execs;
+    pthread_mutex_unlock(&f->lock);
+
+    free(corpus);
+    free(c->edges);
+    cpu_free(c);
+    return 0;
+}
+
+// Write the corpus, with the reference results, as asm.pl data.
+static void write_corpus(const fuzz *f, const char *file)
+{
+    FILE *fp = fopen(file, "w");
+    if (fp == 0) {
+        perror(file);
+        exit(1);
+    }
+    fprintf(fp, "    ; .%s: inputs reaching new edges, and their expected results\n", f->t->label);
+    for(int i=0; i<f->corpus_size; i++) {
+        u16 expected[MAX_OUT];
+        f->t->ref(f->corpus[i].in, expected);
+        fprintf(fp, "    dw ");
+        for(int j=0; j<num_words(f->t); j++) fprintf(fp, "0x%04x, ", f->corpus[i].in[j]);
+        for(int j=0; j<f->t->num_out; j++) fprintf(fp, "0x%04x%s", expected[j], j+1 < f->t->num_out ? ", " : "\n");
+    }
+    fclose(fp);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: coverage-guided fuzzer for vixen routines\n\n", prog);
+    fprintf(stderr, "Usage: %s [options] LABEL\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -A, --asm FILE         read labels from FILE (default: out/asm.log)\n");
+    fprintf(stderr, "  -j, --jobs N           run N threads (default: one per cpu)\n");
+    fprintf(stderr, "  -n, --execs N          calls per thread (default: 1000000)\n");
+    fprintf(stderr, "  -t, --time SECONDS     run for SECONDS instead\n");
+    fprintf(stderr, "  -s, --seed N           seed for the random mutations (default: 1)\n");
+    fprintf(stderr, "  -o, --corpus FILE      write the corpus to FILE as asm.pl data\n");
+    fprintf(stderr, "\nLabels:\n");
+    for(size_t i=0; i<sizeof(targets)/sizeof(targets[0]); i++) {
+        fprintf(stderr, "  %s\n", targets[i].label);
+    }
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    const char *asm_file = "out/asm.log";
+    const char *corpus_file = 0;
+    const char *label = 0;
+    int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+
+    static fuzz f = {};
+    f.execs = 1000000;
+    f.seed = 1;
+
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-A") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_file = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if ((!strcmp(argv[i], "-n") || !strcmp(argv[i], "--execs")) && i+1 < argc) {
+            f.execs = strtoull(argv[++i], 0, 0);
+        }
+        else if ((!strcmp(argv[i], "-t") || !strcmp(argv[i], "--time")) && i+1 < argc) {
+            f.seconds = atof(argv[++i]);
+        }
+        else if ((!strcmp(argv[i], "-s") || !strcmp(argv[i], "--seed")) && i+1 < argc) {
+            f.seed = strtoull(argv[++i], 0, 0);
+        }
+        else if ((!strcmp(argv[i], "-o") || !strcmp(argv[i], "--corpus")) && i+1 < argc) {
+            corpus_file = argv[++i];
+        }
+        else if (argv[i][0] != '-' && label == 0) {
+            label = argv[i][0] == '.' ? argv[i]+1 : argv[i];
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+    if (jobs < 1) jobs = 1;
+    if (label == 0) {
+        usage(argv[0]);
+    }
+
+    for(size_t i=0; i<sizeof(targets)/sizeof(targets[0]); i++) {
+        if (!strcmp(targets[i].label, label)) f.t = &targets[i];
+    }
+    if (f.t == 0) {
+        fprintf(stderr, "no reference for .%s - see --help\n", label);
+        exit(1);
+    }
+
+    listing *l = listing_load(asm_file);
+    if (l == 0) {
+        exit(1);
+    }
+    int entry = listing_find(l, label);
+    if (entry < 0) {
+        fprintf(stderr, "label .%s not found in %s\n", label, asm_file);
+        exit(1);
+    }
+    f.entry = entry;
+
+    cpu *base = fixture_load("out/mem.bin");
+    if (base == 0) {
+        exit(1);
+    }
+    f.base = base;
+    pthread_mutex_init(&f.lock, 0);
+
+    double start = fixture_now();
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    worker_arg *args = calloc(jobs, sizeof(worker_arg));
+    for(int t=0; t<jobs; t++) {
+        args[t].f = &f;
+        args[t].index = t;
+        pthread_create(&threads[t], 0, worker, &args[t]);
+    }
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+    double elapsed = fixture_now() - start;
+
+    int edges = 0;
+    for(int i=0; i<0x10000; i++) edges += f.edges[i];
+
+    if (f.mismatches > MAX_REPORTS) {
+        printf("... %d more\n", f.mismatches - MAX_REPORTS);
+    }
+    printf(".%s: %llu calls in %.2fs (%.2fM/s per thread), %d edges, corpus %d, %d mismatches\n",
+            label, (unsigned long long)f.total_execs, elapsed,
+            f.total_execs / elapsed / jobs / 1e6, edges, f.corpus_size, f.mismatches);
+
+    if (corpus_file) {
+        write_corpus(&f, corpus_file);
+    }
+
+    free(args);
+    free(threads);
+    free(f.corpus);
+    cpu_free(base);
+    listing_free(l);
+    return f.mismatches ? 1 : 0;
+}
@@ -0,0 +1,797 @@
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "gdbstub.h"
+#include "semihost.h"
+#include "stops.h"
+
+enum {
+    PACKET_SIZE = 0x1000,
+    NUM_REGS = 17,          // r0-r15, flags
+    REG_FLAGS = 16
+};
+
+// how often to look for a ^C from gdb while running
+static const u64 POLL_EVERY = 0x10000;
+
+static const char target_xml[] =
+    "<?xml version=\"1.0\"?>"
+    "<!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+    "<target version=\"1.0\">"
+    "<feature name=\"org.vixen.core\">"
+    "<reg name=\"r0\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r1\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r2\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r3\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r4\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r5\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r6\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r7\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r8\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r9\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r10\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r11\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r12\" bitsize=\"16\" type=\"int\"/>"
+    "<reg name=\"r13\" bitsize=\"16\" type=\"data_ptr\"/>"
+    "<reg name=\"r14\" bitsize=\"16\" type=\"code_ptr\"/>"
+    "<reg name=\"pc\" bitsize=\"16\" type=\"code_ptr\"/>"
+    "<reg name=\"flags\" bitsize=\"16\" type=\"int\"/>"
+    "</feature>"
+    "</target>";
+
+// A breakpoint, or a watchpoint on one byte, set by gdb: one of the stops
+// in c->stops.
+typedef struct point
+{
+    int type;                   // as in Z packets: 0-1 break, 2 write, 3 read, 4 access
+    u16 addr;
+    int id;                     // of the stop
+} point;
+
+typedef struct
+{
+    cpu *c;
+    history *h;
+    const listing *l;
+    int in;
+    int out;
+    bool no_ack;
+    bool done;
+
+    point *points;
+    int num_points;
+
+    char rx[PACKET_SIZE];       // unparsed input
+    int rx_len;
+    int rx_pos;
+} gdb;
+
+//------------------------------------------------------------------------------
+// Transport
+//
+
+static int get_char(gdb *g)
+{
+    if (g->rx_pos == g->rx_len) {
+        int n;
+        do {
+            n = read(g->in, g->rx, sizeof(g->rx));
+        } while(n < 0 && errno == EINTR);
+        if (n <= 0) return -1;
+        g->rx_len = n;
+        g->rx_pos = 0;
+    }
+    return (u8)g->rx[g->rx_pos++];
+}
+
+static void put_bytes(gdb *g, const char *buf, int len)
+{
+    while(len > 0) {
+        int n = write(g->out, buf, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            g->done = 1;
+            return;
+        }
+        buf += n;
+        len -= n;
+    }
+}
+
+static const char hex[] = "0123456789abcdef";
+
+static int unhex(int ch)
+{
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+static void put_packet(gdb *g, const char *data)
+{
+    static char buf[2*PACKET_SIZE + 8];
+    int len = 0;
+    u8 sum = 0;
+    buf[len++] = '$';
+    for(const char *p = data; *p; p++) {
+        buf[len++] = *p;
+        sum += (u8)*p;
+    }
+    buf[len++] = '#';
+    buf[len++] = hex[sum >> 4];
+    buf[len++] = hex[sum & 0xf];
+    put_bytes(g, buf, len);
+
+    if (!g->no_ack) {
+        // a '-' asks for the packet again
+        int ch;
+        while((ch = get_char(g)) == '-') {
+            put_bytes(g, buf, len);
+        }
+    }
+}
+
+static void put_packetf(gdb *g, const char *fmt, ...)
+{
+    char buf[PACKET_SIZE];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    put_packet(g, buf);
+}
+
+// Read a packet into buf (without the framing), returning its length,
+// or -1 if the connection has gone. A ^C outside a packet returns 0
+// with buf[0] set to 0x03.
+static int get_packet(gdb *g, char *buf, int size)
+{
+    while(1) {
+        int ch = get_char(g);
+        if (ch < 0) return -1;
+        if (ch == 0x03) {
+            buf[0] = 0x03;
+            buf[1] = 0;
+            return 0;
+        }
+        if (ch != '$') continue;
+
+        int len = 0;
+        u8 sum = 0;
+        while((ch = get_char(g)) >= 0 && ch != '#') {
+            if (len < size-1) buf[len++] = ch;
+            sum += (u8)ch;
+        }
+        int hi = unhex(get_char(g));
+        int lo = unhex(get_char(g));
+        if (ch < 0 || hi < 0 || lo < 0) return -1;
+        buf[len] = 0;
+
+        if (g->no_ack) return len;
+        if (sum == (hi << 4 | lo)) {
+            put_bytes(g, "+", 1);
+            return len;
+        }
+        put_bytes(g, "-", 1);
+    }
+}
+
+// Has gdb sent a ^C?
+static bool interrupted(gdb *g)
+{
+    if (g->rx_pos < g->rx_len) {
+        return g->rx[g->rx_pos] == 0x03 && ++g->rx_pos;
+    }
+    struct pollfd pfd = { g->in, POLLIN, 0 };
+    if (poll(&pfd, 1, 0) <= 0) return 0;
+    int ch = get_char(g);
+    return ch == 0x03 || ch < 0;
+}
+
+int gdb_accept(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 1) < 0) {
+        int err = errno;
+        close(fd);
+        errno = err;
+        return -1;
+    }
+
+    int conn;
+    do {
+        conn = accept(fd, 0, 0);
+    } while(conn < 0 && errno == EINTR);
+    int err = errno;
+    close(fd);
+    if (conn < 0) {
+        errno = err;
+        return -1;
+    }
+    setsockopt(conn, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return conn;
+}
+
+//------------------------------------------------------------------------------
+// Execution
+//
+
+static const int point_kinds[] = { STOP_BREAK, STOP_BREAK, STOP_WATCH, STOP_RWATCH, STOP_AWATCH };
+
+// Add a point of the given type at addr. Returns 0, or -1 on failure.
+static int add_point(gdb *g, int type, u16 addr)
+{
+    cpu *c = g->c;
+    if (c->stops == 0) {
+        c->stops = stops_new();
+    }
+    char spec[16];
+    char err[128];
+    snprintf(spec, sizeof(spec), type < 2 ? "0x%04x" : "b[0x%04x]", addr);
+    int i = stops_add(c->stops, point_kinds[type], spec, 0, err, sizeof(err));
+    if (i < 0) return -1;
+
+    g->points = realloc(g->points, (g->num_points + 1) * sizeof(point));
+    g->points[g->num_points++] = (point){ type, addr, c->stops->list[i].id };
+    return 0;
+}
+
+// Remove the point of the given type at addr, if there is one.
+static void remove_point(gdb *g, int type, u16 addr)
+{
+    for(int i=0; i<g->num_points; i++) {
+        point *pt = &g->points[i];
+        if (pt->type == type && pt->addr == addr) {
+            stops_remove(g->c->stops, pt->id);
+            memmove(pt, pt+1, (g->num_points - i - 1) * sizeof(point));
+            g->num_points--;
+            return;
+        }
+    }
+}
+
+// Return the point which is the stop with the given id, or 0.
+static const point *find_point(const gdb *g, int id)
+{
+    for(int i=0; i<g->num_points; i++) {
+        if (g->points[i].id == id) return &g->points[i];
+    }
+    return 0;
+}
+
+static bool is_breakpoint(const gdb *g, u16 addr)
+{
+    for(int i=0; i<g->num_points; i++) {
+        if (g->points[i].type < 2 && g->points[i].addr == addr) return 1;
+    }
+    return 0;
+}
+
+static bool is_write_watched(const gdb *g, u16 addr)
+{
+    for(int i=0; i<g->num_points; i++) {
+        const point *pt = &g->points[i];
+        if ((pt->type == 2 || pt->type == 4) && pt->addr == addr) return 1;
+    }
+    return 0;
+}
+
+static void report_stop(gdb *g, int signal)
+{
+    put_packetf(g, "S%02x", signal);
+}
+
+// Report why a run ended, and return 1 - unless it was a semihosting call,
+// which is carried out, returning 0 so that the run carries on.
+static bool report_run(gdb *g, int why)
+{
+    cpu *c = g->c;
+    if (why == RUN_STOPPED) {
+        int status;
+        switch(c->stop_substate == SS_SWI ? semihost(c, 0, &status) : SEMIHOST_NONE) {
+            case SEMIHOST_CHANGED:
+                // which replaying the history would not reproduce
+                history_reset(g->h, c);
+                return 0;
+            case SEMIHOST_DONE:
+                return 0;
+            case SEMIHOST_EXIT:
+                put_packetf(g, "W%02x", status & 0xff);
+                return 1;
+        }
+        if (c->stop_substate == SS_HALT) {
+            // leave the hlt as the next to execute
+            history_back(g->h, c, 1);
+            put_packet(g, "W00");
+        } else {
+            // any other swi, or an rtu or trap
+            report_stop(g, 5);
+        }
+        return 1;
+    }
+    const point *pt = 0;
+    if (why == RUN_BREAK || why == RUN_WATCH) {
+        pt = find_point(g, c->stops->list[c->stop_hit].id);
+    }
+    if (pt == 0) {
+        // a limited step, or one of the simulator's own --break/--watch/--until stops
+        report_stop(g, 5);
+    }
+    else if (pt->type < 2) {
+        put_packet(g, "T05swbreak:;");
+    }
+    else {
+        static const char *const names[] = { "", "", "watch", "rwatch", "awatch" };
+        put_packetf(g, "T05%s:%04x;", names[pt->type], pt->addr);
+    }
+    return 1;
+}
+
+// Send what the program writes by semihosting to gdb's console.
+static void program_output(void *ctx, const char *buf, int len)
+{
+    gdb *g = ctx;
+    char out[PACKET_SIZE];
+    while(len > 0) {
+        int n = len < PACKET_SIZE/2 - 1 ? len : PACKET_SIZE/2 - 1;
+        char *p = out;
+        *p++ = 'O';
+        for(int i=0; i<n; i++) {
+            *p++ = hex[(u8)buf[i] >> 4];
+            *p++ = hex[buf[i] & 0xf];
+        }
+        *p = 0;
+        put_packet(g, out);
+        buf += n;
+        len -= n;
+    }
+}
+
+// Run (or single step) forward at full speed until a stop, and report it.
+// Any breakpoint at the current pc is passed over.
+static void resume(gdb *g, bool single)
+{
+    cpu *c = g->c;
+    c->resume_break = 1;
+    while(1) {
+        int why = single ? history_step(g->h, c) : history_run(g->h, c, POLL_EVERY);
+        if (why == RUN_LIMIT && !single) {
+            if (interrupted(g)) {
+                report_stop(g, 2);
+                return;
+            }
+            continue;
+        }
+        if (report_run(g, why)) {
+            return;
+        }
+        if (single) {
+            // the semihosting call was the step
+            report_stop(g, 5);
+            return;
+        }
+    }
+}
+
+static bool match_stop(const undo *u, void *ctx)
+{
+    const gdb *g = ctx;
+    if (is_breakpoint(g, u->pc)) return 1;
+    if (u->stored) {
+        for(int i=0; i <= u->store_wide; i++) {
+            if (is_write_watched(g, u->store_addr + i)) return 1;
+        }
+    }
+    return 0;
+}
+
+static void reverse(gdb *g, bool single)
+{
+    if (g->h->now == 0) {
+        put_packet(g, "T05replaylog:begin;");
+        return;
+    }
+    if (single) {
+        history_back(g->h, g->c, 1);
+        report_stop(g, 5);
+        return;
+    }
+    if (history_reverse_find(g->h, g->c, match_stop, g) == 0) {
+        put_packet(g, "T05");
+        return;
+    }
+    history_goto(g->h, g->c, 0);
+    put_packet(g, "T05replaylog:begin;");
+}
+
+//------------------------------------------------------------------------------
+// Requests
+//
+
+static u16 get_reg(const cpu *c, int n)
+{
+    return n == REG_FLAGS ? c->special_regs[FLAGS] : c->r[n];
+}
+
+static void set_reg(cpu *c, int n, u16 v)
+{
+    if (n == REG_FLAGS) {
+        c->special_regs[FLAGS] = v;
+    } else {
+        c->r[n] = v;
+    }
+}
+
+static char *put_hex16(char *p, u16 v)
+{
+    *p++ = hex[(v >> 12) & 0xf];
+    *p++ = hex[(v >> 8) & 0xf];
+    *p++ = hex[(v >> 4) & 0xf];
+    *p++ = hex[v & 0xf];
+    *p = 0;
+    return p;
+}
+
+// Parse hex digits, advancing *pp. Returns the number of digits read.
+static int get_hex(const char **pp, unsigned long *v)
+{
+    int n = 0;
+    *v = 0;
+    int d;
+    while((d = unhex(**pp)) >= 0) {
+        *v = *v << 4 | d;
+        (*pp)++;
+        n++;
+    }
+    return n;
+}
+
+static int get_hex_bytes(const char *p, char *out, int max)
+{
+    int n = 0;
+    while(n < max && unhex(p[0]) >= 0 && unhex(p[1]) >= 0) {
+        out[n++] = unhex(p[0]) << 4 | unhex(p[1]);
+        p += 2;
+    }
+    out[n] = 0;
+    return n;
+}
+
+// Send text to gdb's console, as the output of a monitor command.
+static void console(gdb *g, const char *fmt, ...)
+{
+    char text[PACKET_SIZE/2 - 2];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(text, sizeof(text), fmt, ap);
+    va_end(ap);
+
+    char buf[PACKET_SIZE];
+    char *p = buf;
+    *p++ = 'O';
+    for(const char *t = text; *t; t++) {
+        *p++ = hex[(u8)*t >> 4];
+        *p++ = hex[*t & 0xf];
+    }
+    *p = 0;
+    put_packet(g, buf);
+}
+
+static int lookup_label(gdb *g, const char *name)
+{
+    if (name[0] == '.') name++;
+    return g->l ? listing_find(g->l, name) : -1;
+}
+
+static void monitor(gdb *g, const char *cmd)
+{
+    char verb[32] = "";
+    char arg[256] = "";
+    sscanf(cmd, "%31s %255s", verb, arg);
+
+    if (!strcmp(verb, "labels")) {
+        for(int i=0; g->l && i<g->l->num_labels; i++) {
+            const listing_label *lab = &g->l->labels[i];
+            if (strstr(lab->name, arg)) {
+                console(g, "%04x .%s\n", lab->addr, lab->name);
+            }
+        }
+    }
+    else if (!strcmp(verb, "where")) {
+        u16 pc = g->c->r[15];
+        const listing_label *best = 0;
+        for(int i=0; g->l && i<g->l->num_labels; i++) {
+            const listing_label *lab = &g->l->labels[i];
+            if (lab->addr <= pc && (!best || lab->addr > best->addr)) best = lab;
+        }
+        if (best) {
+            console(g, "%04x .%s+%d\n", pc, best->name, pc - best->addr);
+        } else {
+            console(g, "%04x\n", pc);
+        }
+    }
+    else if (!strcmp(verb, "break") || !strcmp(verb, "delete")) {
+        int addr = lookup_label(g, arg);
+        if (addr < 0) {
+            console(g, "unknown label %s\n", arg);
+        }
+        else if (verb[0] == 'b') {
+            add_point(g, 0, addr);
+            console(g, "breakpoint at %04x\n", addr);
+        }
+        else {
+            remove_point(g, 0, addr);
+        }
+    }
+    else if (!strcmp(verb, "info")) {
+        console(g, "@%llu: %llu instructions, %llu cycles\n",
+                (unsigned long long)g->h->now,
+                (unsigned long long)g->c->instructions,
+                (unsigned long long)g->c->cycles);
+    }
+    else {
+        console(g, "commands: labels [TEXT], where, break .label, delete .label, info\n");
+    }
+    put_packet(g, "OK");
+}
+
+static void set_point(gdb *g, const char *args, bool insert)
+{
+    const char *p = args;
+    unsigned long type, addr, len;
+    get_hex(&p, &type);
+    if (*p++ != ',') goto bad;
+    get_hex(&p, &addr);
+    if (*p++ != ',') goto bad;
+    get_hex(&p, &len);
+
+    if (type > 4) {
+        put_packet(g, "");
+        return;
+    }
+    // a watchpoint is a point on each byte
+    if (type < 2) len = 1;
+    for(unsigned long i=0; i<len; i++) {
+        if (!insert) {
+            remove_point(g, type, addr + i);
+        } else if (add_point(g, type, addr + i)) {
+            goto bad;
+        }
+    }
+    put_packet(g, "OK");
+    return;
+
+bad:
+    put_packet(g, "E01");
+}
+
+static void features(gdb *g, const char *args)
+{
+    // annex:offset,length
+    const char *p = strchr(args, ':');
+    if (!p || strncmp(args, "target.xml", p - args)) {
+        put_packet(g, "E00");
+        return;
+    }
+    p++;
+    unsigned long offset, length;
+    get_hex(&p, &offset);
+    if (*p++ != ',') {
+        put_packet(g, "E01");
+        return;
+    }
+    get_hex(&p, &length);
+
+    unsigned long size = sizeof(target_xml) - 1;
+    if (offset >= size) {
+        put_packet(g, "l");
+        return;
+    }
+    if (length > PACKET_SIZE - 2) length = PACKET_SIZE - 2;
+    unsigned long n = size - offset < length ? size - offset : length;
+
+    char buf[PACKET_SIZE];
+    buf[0] = (offset + n < size) ? 'm' : 'l';
+    memcpy(buf+1, target_xml + offset, n);
+    buf[n+1] = 0;
+    put_packet(g, buf);
+}
+
+static void query(gdb *g, const char *pkt)
+{
+    if (!strncmp(pkt, "qSupported", 10)) {
+        put_packetf(g, "PacketSize=%x;qXfer:features:read+;swbreak+;ReverseStep+;ReverseContinue+;QStartNoAckMode+", PACKET_SIZE);
+    }
+    else if (!strcmp(pkt, "QStartNoAckMode")) {
+        put_packet(g, "OK");
+        g->no_ack = 1;
+    }
+    else if (!strncmp(pkt, "qXfer:features:read:", 20)) {
+        features(g, pkt + 20);
+    }
+    else if (!strcmp(pkt, "qAttached")) {
+        put_packet(g, "1");
+    }
+    else if (!strncmp(pkt, "qSymbol", 7)) {
+        put_packet(g, "OK");
+    }
+    else if (!strncmp(pkt, "qRcmd,", 6)) {
+        char cmd[PACKET_SIZE/2];
+        get_hex_bytes(pkt + 6, cmd, sizeof(cmd) - 1);
+        monitor(g, cmd);
+    }
+    else {
+        put_packet(g, "");
+    }
+}
+
+static void handle(gdb *g, const char *pkt)
+{
+    cpu *c = g->c;
+    char buf[PACKET_SIZE];
+    const char *p = pkt + 1;
+    unsigned long addr, len, v;
+
+    switch(pkt[0]) {
+        case '?':
+            report_stop(g, 5);
+            break;
+
+        case 'g': {
+            char *q = buf;
+            for(int i=0; i<NUM_REGS; i++) q = put_hex16(q, get_reg(c, i));
+            put_packet(g, buf);
+            break;
+        }
+
+        case 'G':
+            for(int i=0; i<NUM_REGS && strlen(p) >= 4; i++, p += 4) {
+                const char *r = p;
+                char digits[5];
+                memcpy(digits, r, 4);
+                digits[4] = 0;
+                set_reg(c, i, strtoul(digits, 0, 16));
+            }
+            history_reset(g->h, c);
+            put_packet(g, "OK");
+            break;
+
+        case 'p':
+            get_hex(&p, &addr);
+            if (addr >= NUM_REGS) {
+                put_packet(g, "E00");
+                break;
+            }
+            put_hex16(buf, get_reg(c, addr));
+            put_packet(g, buf);
+            break;
+
+        case 'P':
+            get_hex(&p, &addr);
+            if (*p++ != '=' || addr >= NUM_REGS || get_hex(&p, &v) == 0) {
+                put_packet(g, "E00");
+                break;
+            }
+            set_reg(c, addr, v);
+            history_reset(g->h, c);
+            put_packet(g, "OK");
+            break;
+
+        case 'm':
+            get_hex(&p, &addr);
+            if (*p++ != ',' || get_hex(&p, &len) == 0) {
+                put_packet(g, "E00");
+                break;
+            }
+            if (len > PACKET_SIZE/2 - 1) len = PACKET_SIZE/2 - 1;
+            for(unsigned long i=0; i<len; i++) {
+                u8 b = mem_rd(c, addr + i, 0);
+                buf[2*i] = hex[b >> 4];
+                buf[2*i+1] = hex[b & 0xf];
+            }
+            buf[2*len] = 0;
+            put_packet(g, buf);
+            break;
+
+        case 'M': {
+            get_hex(&p, &addr);
+            if (*p++ != ',' || get_hex(&p, &len) == 0 || *p++ != ':') {
+                put_packet(g, "E00");
+                break;
+            }
+            int n = get_hex_bytes(p, buf, sizeof(buf) - 1);
+            for(int i=0; i<n && i<(int)len; i++) mem_wr(c, addr + i, 0, (u8)buf[i]);
+            history_reset(g->h, c);
+            put_packet(g, "OK");
+            break;
+        }
+
+        case 'c':
+        case 's':
+            if (get_hex(&p, &addr)) {
+                c->r[15] = addr;
+                history_reset(g->h, c);
+            }
+            resume(g, pkt[0] == 's');
+            break;
+
+        case 'b':
+            if (pkt[1] == 'c' || pkt[1] == 's') {
+                reverse(g, pkt[1] == 's');
+            } else {
+                put_packet(g, "");
+            }
+            break;
+
+        case 'Z':
+        case 'z':
+            set_point(g, p, pkt[0] == 'Z');
+            break;
+
+        case 'H':
+            put_packet(g, "OK");
+            break;
+
+        case 'q':
+        case 'Q':
+            query(g, pkt);
+            break;
+
+        case 'D':
+            put_packet(g, "OK");
+            g->done = 1;
+            break;
+
+        case 'k':
+            g->done = 1;
+            break;
+
+        default:
+            put_packet(g, "");
+            break;
+    }
+}
+
+void gdb_serve(cpu *c, history *h, const listing *l, int in_fd, int out_fd)
+{
+    gdb *g = calloc(1, sizeof(gdb));
+    g->c = c;
+    g->h = h;
+    g->l = l;
+    g->in = in_fd;
+    g->out = out_fd;
+    semihost_output(program_output, g);
+
+    char pkt[PACKET_SIZE];
+    while(!g->done) {
+        int len = get_packet(g, pkt, sizeof(pkt));
+        if (len < 0) break;
+        if (len == 0 && pkt[0] == 0x03) {
+            // ^C while already stopped
+            report_stop(g, 2);
+            continue;
+        }
+        handle(g, pkt);
+    }
+    semihost_output(0, 0);
+    free(g->points);
+    free(g);
+}
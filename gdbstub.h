@@ -0,0 +1,47 @@
+#ifndef GDBSTUB_H
+#define GDBSTUB_H
+
+// GDB remote serial protocol server for the simulator.
+//
+// Registers are r0-r15 (r15 being the pc) followed by flags, all 16 bits
+// and sent big endian, as vixen stores words in memory. A matching target
+// description is offered via qXfer:features:read.
+//
+// Breakpoints (Z0) and watchpoints (Z2, Z3, Z4) are added to c->stops
+// (see stops.h), so the program runs at full speed between them. Execution
+// history is recorded, so reverse-step and reverse-continue are also
+// supported.
+//
+// Semihosting calls are carried out, with the program's output sent to
+// gdb's console. hlt and SYS_EXIT are reported as the program exiting, and
+// any other swi, rtu or trap as SIGTRAP.
+//
+// The assembler listing's labels are available through monitor commands:
+//
+//      monitor labels [TEXT]       list the labels containing TEXT
+//      monitor where               show pc relative to the nearest label
+//      monitor break .label        set a breakpoint at a label
+//      monitor delete .label       remove it
+//      monitor info                show the time and counters
+
+#include "cpu.h"
+#include "history.h"
+#include "listing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Wait for a connection on a local TCP port, returning its fd, or -1 with
+// errno set.
+int gdb_accept(int port);
+
+// Serve requests read from in_fd, replying on out_fd, until gdb detaches
+// or kills the program. l may be 0.
+void gdb_serve(cpu *c, history *h, const listing *l, int in_fd, int out_fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
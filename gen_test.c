@@ -1,9 +1,89 @@
-#include "softfloat.h"
+// Writes test data for the f16 library's operations of two or three
+// operands - all of them, or those named, in one run:
+//
+//      gen_test -a programs/f16            writes programs/f16/<op>_testdata.asm
+//      gen_test -b out -n 1000000 mul      writes out/mul.bin
+//
+// The asm files are for programs/f16/harness.asm, or harness3.asm for fma;
+// the binary ones, records of the words a, b (c) and the expected result,
+// most significant byte first, are for programs/f16/stream_harness.asm.
+//
+// Each set is the 676 pairs of special values - for fma, the 2197 triples
+// of 13 of them - then N generated vectors (1324 by default) drawn from
+// each of these in turn, a quarter at a time:
+//
+//      uniform     any finite operands
+//      boundary    results near overflow, or the normal/subnormal boundary
+//      subnormal   mostly subnormal operands
+//      ties        results exactly halfway between two f16s, where the
+//                  round to even matters
+//
+// The generated vectors are split into blocks of BLOCK_SIZE, each with its
+// own random number generator seeded from the seed, the operation and the
+// block number, which the threads claim in turn; so the output depends on
+// the seed, but not on the number of threads.
+//
+// Expected results are from the reference library, ref/float16.h.
+
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ref/float16.h"
+
+enum {
+    BLOCK_SIZE = 1024,
+    MAX_TIE_TRIES = 1000,       // before settling for a vector which is not a tie
+    ASM_MAX_WORDS = 28000       // what fits between 0x1000 and the stack
+};
+
+enum {
+    OP_MUL,
+    OP_DIV,
+    OP_ADD,
+    OP_SUB,
+    OP_FMA,
+    NUM_OPS
+};
+
+struct {
+    const char *name;
+    int operands;
+    uint16_t (*fn)(uint16_t a, uint16_t b);
+    uint16_t (*fn3)(uint16_t a, uint16_t b, uint16_t c);
+} operations[NUM_OPS] = {
+    {"mul", 2, f16_mul, 0},
+    {"div", 2, f16_div, 0},
+    {"add", 2, f16_add, 0},
+    {"sub", 2, f16_sub, 0},
+    {"fma", 3, 0,       f16_fma}
+};
+
+static uint16_t apply(int op, uint16_t a, uint16_t b, uint16_t c)
+{
+    return operations[op].operands == 3 ? operations[op].fn3(a, b, c)
+                                        : operations[op].fn(a, b);
+}
 
-#define OPERATION f16_sub
-#define QUOTED_OP "f16_sub"
+enum {
+    UNIFORM,
+    BOUNDARY,
+    SUBNORMAL,
+    TIES,
+    NUM_DISTRIBUTIONS
+};
+
+const char *distribution_names[NUM_DISTRIBUTIONS] = {
+    "Uniform random values",
+    "Results near the exponent boundaries",
+    "Mostly subnormal values",
+    "Rounding ties"
+};
 
 const uint16_t f16_zero      = 0x0000; // 0
 const uint16_t f16_min_sub   = 0x0001; // smallest subnormal
@@ -20,23 +100,25 @@ const uint16_t f16_qnan      = 0x7e00; // smallest quiet NaN
 const uint16_t f16_max_nan   = 0x7fff; // largest valid NaN
 const uint16_t f16_neg       = 0x8000; // negative sign bit
 
+#define NUM_SPECIALS 26
+
 struct {
     const char *label;
     uint16_t value;
-} values[26] = {
-    {"+zero",     f16_zero    },  
-    {"+min_sub",  f16_min_sub },  
-    {"+max_sub",  f16_max_sub },  
-    {"+min_norm", f16_min_norm},  
-    {"+one",      f16_one     },  
-    {"+one_eps",  f16_one_eps },  
-    {"+two",      f16_two     },  
-    {"+three",    f16_three   },  
-    {"+max",      f16_max     },  
-    {"+inf",      f16_inf     },  
-    {"+min_nan",  f16_min_nan },  
-    {"+qnan",     f16_qnan    },  
-    {"+max_nan",  f16_max_nan },  
+} values[NUM_SPECIALS] = {
+    {"+zero",     f16_zero    },
+    {"+min_sub",  f16_min_sub },
+    {"+max_sub",  f16_max_sub },
+    {"+min_norm", f16_min_norm},
+    {"+one",      f16_one     },
+    {"+one_eps",  f16_one_eps },
+    {"+two",      f16_two     },
+    {"+three",    f16_three   },
+    {"+max",      f16_max     },
+    {"+inf",      f16_inf     },
+    {"+min_nan",  f16_min_nan },
+    {"+qnan",     f16_qnan    },
+    {"+max_nan",  f16_max_nan },
 
     {"-zero",     f16_neg|f16_zero    },
     {"-min_sub",  f16_neg|f16_min_sub },
@@ -53,49 +135,444 @@ struct {
     {"-max_nan",  f16_neg|f16_max_nan }
 };
 
-int main()
+// The specials for each operand of fma, as indices into values.
+static const int fma_specials[] = {0, 13, 1, 16, 4, 17, 5, 20, 8, 21, 9, 22, 11};
+
+#define NUM_FMA_SPECIALS (int)(sizeof(fma_specials)/sizeof(fma_specials[0]))
+
+typedef struct {
+    uint16_t a, b, c, z;    // c only for fma
+} vector;
+
+static long num_specials(int op)
+{
+    return operations[op].operands == 3
+        ? NUM_FMA_SPECIALS * NUM_FMA_SPECIALS * NUM_FMA_SPECIALS
+        : NUM_SPECIALS * NUM_SPECIALS;
+}
+
+// The k-th combination of special values for op, with their labels.
+static vector special(int op, long k, const char *labels[3])
+{
+    int i, j, l = 0;
+    if (operations[op].operands == 3) {
+        i = fma_specials[k / (NUM_FMA_SPECIALS * NUM_FMA_SPECIALS)];
+        j = fma_specials[k / NUM_FMA_SPECIALS % NUM_FMA_SPECIALS];
+        l = fma_specials[k % NUM_FMA_SPECIALS];
+    }
+    else {
+        i = k / NUM_SPECIALS;
+        j = k % NUM_SPECIALS;
+    }
+    labels[0] = values[i].label;
+    labels[1] = values[j].label;
+    labels[2] = values[l].label;
+    uint16_t a = values[i].value;
+    uint16_t b = values[j].value;
+    uint16_t c = values[l].value;
+    return (vector) {a, b, c, apply(op, a, b, c)};      // any NaN is the lowest quiet NaN
+}
+
+//------------------------------------------------------------------------------
+// Random values
+//
+
+// splitmix64
+static uint64_t next(uint64_t *state)
 {
-    softfloat_roundingMode = softfloat_round_near_even;
-    softfloat_exceptionFlags = 0;
-    softfloat_detectTininess = softfloat_tininess_beforeRounding;
+    uint64_t z = (*state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+// 0..n-1
+static int below(uint64_t *state, int n)
+{
+    return (int)((next(state) >> 32) * n >> 32);
+}
 
-    srandom(11111);
+static uint16_t make(int sign, int exp, int fra)
+{
+    if (exp < 0) exp = 0;
+    if (exp > 30) exp = 30;
+    return (sign ? f16_neg : 0) | exp << 10 | (fra & 0x3ff);
+}
+
+static uint16_t any_finite(uint64_t *r)
+{
+    uint16_t x;
+    do x = (uint16_t) next(r); while((x & ~f16_neg) >= f16_inf);
+    return x;
+}
+
+// Keeps only the top k bits of the fraction, k = 0..10, so that results are
+// often exact or halfway.
+static uint16_t few_bits(uint64_t *r, uint16_t x)
+{
+    int k = below(r, 11);
+    return x & ~((1 << (10 - k)) - 1);
+}
+
+static int exp_of(uint16_t x)
+{
+    return (x >> 10) & 0x1f;
+}
+
+// Whether op(a, b, c) is exactly halfway between two finite f16s.
+static bool is_tie(int op, uint16_t a, uint16_t b, uint16_t c)
+{
+    uint16_t z = apply(op, a, b, c);
+    if ((z & ~f16_neg) >= f16_max) return 0;
+
+    // These are exact in double: the product of two 11 bit significands,
+    // and the sum of two f16s, which span at most 40 bits.
+    double x = f16_to_float(a);
+    double y = f16_to_float(b);
+    double exact = op == OP_MUL ? x * y
+                 : op == OP_DIV ? x / y     // approximate: only its side of z is used
+                 : op == OP_ADD ? x + y
+                 : op == OP_SUB ? x - y
+                 :                x * y + f16_to_float(c);
+    if (op == OP_FMA) {
+        // the product is exact, but the sum may not be: if its error (by
+        // Knuth's two-sum) is not 0, neither it nor the exact one is a tie
+        double p = x * y;
+        double w = f16_to_float(c);
+        double v = exact - p;
+        if ((p - (exact - v)) + (w - v) != 0) return 0;
+    }
+    double zd = f16_to_float(z);
+    if (exact == zd) return 0;
+
+    // the f16 on the other side of the exact result
+    double other = f16_to_float(fabs(exact) > fabs(zd) ? z + 1 : z - 1);
+    double mid = (zd + other) / 2;
+    if (op == OP_DIV) {
+        return x == mid * y;        // 12 bits by 11: exact
+    }
+    return exact == mid;
+}
+
+static vector generate(int op, int distribution, uint64_t *r)
+{
+    uint16_t a, b, c = 0;
+    int sign_a = below(r, 2);
+    int sign_b = below(r, 2);
+
+    switch(distribution) {
+        case UNIFORM:
+            a = any_finite(r);
+            b = any_finite(r);
+            if (op == OP_FMA) c = any_finite(r);
+            break;
+
+        case BOUNDARY: {
+            // the biased exponent wanted for the result: overflowing, or
+            // either side of the smallest normal
+            static const int targets[] = {-1, 0, 1, 2, 29, 30, 31};
+            int target = targets[below(r, sizeof(targets)/sizeof(targets[0]))];
+            int exp_a = 1 + below(r, 30);
+            int exp_b;
+            if (op == OP_MUL || op == OP_FMA) {
+                exp_b = target - exp_a + 15;
+            }
+            else if (op == OP_DIV) {
+                exp_b = exp_a - target + 15;
+            }
+            else {
+                // near the top, like signs adding; near the bottom,
+                // nearly equal values cancelling
+                bool high = target > 15;
+                exp_a = high ? 30 - below(r, 2) : below(r, 3);
+                exp_b = exp_a - below(r, 2);
+                sign_b = sign_a ^ (op == OP_SUB) ^ !high;
+            }
+            a = make(sign_a, exp_a, (int) next(r));
+            b = make(sign_b, exp_b, (int) next(r));
+            if (op == OP_FMA) {
+                // about the product's size, so often cancelling it
+                c = make(below(r, 2), target - below(r, 3), (int) next(r));
+            }
+            break;
+        }
+
+        case SUBNORMAL:
+            a = below(r, 4) ? make(sign_a, 0, (int) next(r)) : any_finite(r);
+            b = below(r, 4) ? make(sign_b, 0, (int) next(r)) : any_finite(r);
+            if (op == OP_FMA) {
+                c = below(r, 4) ? make(below(r, 2), 0, (int) next(r)) : any_finite(r);
+            }
+            break;
+
+        case TIES:
+        default:
+            for(int tries=0; tries<MAX_TIE_TRIES; tries++) {
+                a = few_bits(r, any_finite(r));
+                b = few_bits(r, any_finite(r));
+                if (op == OP_DIV) {
+                    // exact quotients are subnormal (a's bits shifted out
+                    // exactly), so divide by a much larger power of two
+                    int exp_a = 1 + below(r, 15);
+                    a = make(sign_a, exp_a, (int) next(r));
+                    b = make(sign_b, exp_a + 15 + below(r, 11), 0);
+                }
+                else if (op == OP_ADD || op == OP_SUB) {
+                    b = make(sign_b, exp_of(a) - below(r, 13), b);
+                }
+                else if (op == OP_FMA) {
+                    // within the product's 22 bits, the sum can be a tie
+                    int exp_p = exp_of(a) + exp_of(b) - 15;
+                    c = make(below(r, 2), exp_p + 1 - below(r, 13), few_bits(r, any_finite(r)));
+                }
+                if (is_tie(op, a, b, c)) break;
+            }
+            break;
+    }
+    return (vector) {a, b, c, apply(op, a, b, c)};
+}
+
+//------------------------------------------------------------------------------
+// Generation
+//
+
+typedef struct {
+    uint64_t seed;
+    long count;             // generated vectors per operation
+    int ops[NUM_OPS];
+    int num_ops;
+    vector *vectors[NUM_OPS];
+    long blocks;            // per operation
+    long next;              // next block to claim, over all operations
+} job;
+
+static void *worker(void *arg)
+{
+    job *j = arg;
+    for(;;) {
+        long n = __atomic_fetch_add(&j->next, 1, __ATOMIC_RELAXED);
+        if (n >= j->blocks * j->num_ops) break;
 
-    float16_t a, b, z;
+        int op = j->ops[n / j->blocks];
+        long block = n % j->blocks;
+        uint64_t r = j->seed ^ (uint64_t)(op + 1) << 56 ^ (uint64_t) block;
+        next(&r);
+
+        long first = block * BLOCK_SIZE;
+        long last = first + BLOCK_SIZE;
+        if (last > j->count) last = j->count;
+        for(long i=first; i<last; i++) {
+            int distribution = i * NUM_DISTRIBUTIONS / j->count;
+            j->vectors[op][i] = generate(op, distribution, &r);
+        }
+    }
+    return 0;
+}
+
+static FILE *create(const char *dir, const char *op, const char *suffix)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s%s", dir, op, suffix);
+    FILE *fp = fopen(path, "w");
+    if (fp == 0) {
+        perror(path);
+        exit(1);
+    }
+    return fp;
+}
+
+static void write_asm(const char *dir, int op, const vector *vectors, long count)
+{
+    FILE *fp = create(dir, operations[op].name, "_testdata.asm");
     uint16_t label = 0;
+    bool fma = operations[op].operands == 3;
+
+    fprintf(fp, ".unit_test_data\n");
+    fprintf(fp, "    dw .f16_%s\n", operations[op].name);
+
+    fprintf(fp, "\n");
+    fprintf(fp, "    ; Special values\n");
+    for(long k=0; k<num_specials(op); k++) {
+        const char *labels[3];
+        vector v = special(op, k, labels);
+        if (fma) {
+            fprintf(fp, "    dw 0x%04x, 0x%04x, 0x%04x, 0x%04x, 0x%04x   ;   %-10s %-10s %s\n",
+                    label++, v.a, v.b, v.c, v.z, labels[0], labels[1], labels[2]);
+        }
+        else {
+            fprintf(fp, "    dw 0x%04x, 0x%04x, 0x%04x, 0x%04x   ;   %-10s %s\n",
+                    label++, v.a, v.b, v.z, labels[0], labels[1]);
+        }
+    }
+
+    int distribution = -1;
+    for(long i=0; i<count; i++) {
+        if (i * NUM_DISTRIBUTIONS / count != distribution) {
+            distribution = i * NUM_DISTRIBUTIONS / count;
+            fprintf(fp, "\n");
+            fprintf(fp, "    ; %s\n", distribution_names[distribution]);
+        }
+        const vector *v = &vectors[i];
+        if (fma) {
+            fprintf(fp, "    dw 0x%04x, 0x%04x, 0x%04x, 0x%04x, 0x%04x\n",
+                    label++, v->a, v->b, v->c, v->z);
+        }
+        else {
+            fprintf(fp, "    dw 0x%04x, 0x%04x, 0x%04x, 0x%04x\n", label++, v->a, v->b, v->z);
+        }
+    }
+
+    fprintf(fp, ".unit_test_end\n");
+    fclose(fp);
+}
+
+// Writes v as a record of its operands and result, returning its end.
+static uint8_t *put_record(uint8_t *p, int op, const vector *v)
+{
+    uint16_t words[4] = {v->a, v->b, v->c, v->z};
+    if (operations[op].operands == 2) words[2] = v->z;
+    for(int i=0; i<=operations[op].operands; i++) {
+        *p++ = words[i] >> 8;
+        *p++ = words[i];
+    }
+    return p;
+}
+
+static void write_binary(const char *dir, int op, const vector *vectors, long count)
+{
+    FILE *fp = create(dir, operations[op].name, ".bin");
+    long total = num_specials(op) + count;
+    int size = 2 * (operations[op].operands + 1);
+    uint8_t *records = malloc(total * size);
+    uint8_t *p = records;
+
+    for(long k=0; k<num_specials(op); k++) {
+        const char *labels[3];
+        vector v = special(op, k, labels);
+        p = put_record(p, op, &v);
+    }
+    for(long i=0; i<count; i++) {
+        p = put_record(p, op, &vectors[i]);
+    }
+
+    if (fwrite(records, size, total, fp) != (size_t) total || fclose(fp)) {
+        fprintf(stderr, "could not write %s.bin\n", operations[op].name);
+        exit(1);
+    }
+    free(records);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: write test data for the f16 operations\n\n", prog);
+    fprintf(stderr, "Usage: %s [options] [OP...]\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -a, --asm DIR          write DIR/OP_testdata.asm\n");
+    fprintf(stderr, "  -b, --binary DIR       write DIR/OP.bin\n");
+    fprintf(stderr, "  -n, --count N          generate N vectors after the specials (default: 1324)\n");
+    fprintf(stderr, "  -s, --seed N           seed the generators with N (default: 11111)\n");
+    fprintf(stderr, "  -j, --jobs N           run N threads (default: one per cpu)\n");
+    fprintf(stderr, "\nOperations (default: all):\n");
+    for(int i=0; i<NUM_OPS; i++) {
+        fprintf(stderr, "  %s\n", operations[i].name);
+    }
+    exit(0);
+}
 
-    //
-    // Generate a total of 2000 test cases
-    //
-    printf(".unit_test_data\n");
-    printf("    dw ." QUOTED_OP "\n");
-
-    printf("\n");
-    printf("    ; Special values\n");
-    for(int i=0; i<26; i++) {
-        for(int j=0; j<26; j++) {
-            a.v = values[i].value;
-            b.v = values[j].value;
-            z = OPERATION(a, b);
-            if (!f16_eq(z, z)) z.v = f16_qnan;    // convert any NaN to lowest quiet NaN
-            printf("    dw 0x%04x, 0x%04x, 0x%04x, 0x%04x   ;   %-10s %s\n", label++, a.v, b.v, z.v, values[i].label, values[j].label);
-        }
-    }
-
-    printf("\n");
-    printf("    ; Random values\n");
-    for(int i=0; i<1324; i++) {
-        uint16_t r, s;
-        do r = (uint16_t) random(); while((r & ~f16_neg) >= f16_inf);
-        do s = (uint16_t) random(); while((s & ~f16_neg) >= f16_inf);
-        a.v = r;
-        b.v = s;
-        z = OPERATION(a, b);
-        if (!f16_eq(z, z)) z.v = f16_qnan;    // convert any NaN to lowest quiet NaN
-        printf("    dw 0x%04x, 0x%04x, 0x%04x, 0x%04x\n", label++, a.v, b.v, z.v);
-    }
-
-    printf(".unit_test_end\n");
+int main(int argc, char **argv)
+{
+    const char *asm_dir = 0;
+    const char *binary_dir = 0;
+    int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+
+    static job j = {};
+    bool selected[NUM_OPS] = {};
+    j.seed = 11111;
+    j.count = 1324;
+
+    for(int i=1; i<argc; i++) {
+        char *end = 0;
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-a") || !strcmp(argv[i], "--asm")) && i+1 < argc) {
+            asm_dir = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-b") || !strcmp(argv[i], "--binary")) && i+1 < argc) {
+            binary_dir = argv[++i];
+        }
+        else if ((!strcmp(argv[i], "-n") || !strcmp(argv[i], "--count")) && i+1 < argc) {
+            j.count = strtol(argv[++i], &end, 0);
+            if (*end || j.count < 0) {
+                fprintf(stderr, "%s: bad count `%s'.\n", argv[0], argv[i]);
+                exit(1);
+            }
+        }
+        else if ((!strcmp(argv[i], "-s") || !strcmp(argv[i], "--seed")) && i+1 < argc) {
+            j.seed = strtoull(argv[++i], &end, 0);
+            if (*end) {
+                fprintf(stderr, "%s: bad seed `%s'.\n", argv[0], argv[i]);
+                exit(1);
+            }
+        }
+        else if ((!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) && i+1 < argc) {
+            jobs = atoi(argv[++i]);
+        }
+        else if (argv[i][0] != '-') {
+            int op = -1;
+            for(int k=0; k<NUM_OPS; k++) {
+                if (!strcmp(argv[i], operations[k].name)) op = k;
+            }
+            if (op < 0) {
+                fprintf(stderr, "%s: unknown operation `%s' - see --help\n", argv[0], argv[i]);
+                exit(1);
+            }
+            selected[op] = 1;
+        }
+        else {
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+    if (jobs < 1) jobs = 1;
+    if (asm_dir == 0 && binary_dir == 0) {
+        usage(argv[0]);
+    }
+    for(int k=0; k<NUM_OPS; k++) {
+        if (selected[k]) j.ops[j.num_ops++] = k;
+    }
+    if (j.num_ops == 0) {
+        for(int k=0; k<NUM_OPS; k++) j.ops[j.num_ops++] = k;
+    }
+    for(int k=0; asm_dir && k<j.num_ops; k++) {
+        int op = j.ops[k];
+        int words = operations[op].operands + 2;    // with the label
+        if ((num_specials(op) + j.count) * words > ASM_MAX_WORDS) {
+            fprintf(stderr, "%s: too many %s vectors to assemble - at most %ld\n",
+                    argv[0], operations[op].name, ASM_MAX_WORDS / words - num_specials(op));
+            exit(1);
+        }
+    }
+
+    j.blocks = (j.count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    for(int k=0; k<j.num_ops; k++) {
+        j.vectors[j.ops[k]] = malloc((j.count ? j.count : 1) * sizeof(vector));
+        if (j.vectors[j.ops[k]] == 0) {
+            fprintf(stderr, "%s: out of memory\n", argv[0]);
+            exit(1);
+        }
+    }
+
+    pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+    for(int t=0; t<jobs; t++) pthread_create(&threads[t], 0, worker, &j);
+    for(int t=0; t<jobs; t++) pthread_join(threads[t], 0);
+
+    for(int k=0; k<j.num_ops; k++) {
+        int op = j.ops[k];
+        if (asm_dir) write_asm(asm_dir, op, j.vectors[op], j.count);
+        if (binary_dir) write_binary(binary_dir, op, j.vectors[op], j.count);
+    }
 
     return 0;
 }
@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "history.h"
+
+// Step c, describing in u how to undo it. Returns the RUN_* result, u
+// being left untouched for RUN_BREAK as nothing was executed.
+static int record_step(cpu *c, undo *u)
+{
+    u16 r[16];
+    u16 special_regs[4];
+    memcpy(r, c->r, sizeof(r));
+    memcpy(special_regs, c->special_regs, sizeof(special_regs));
+    u64 instructions = c->instructions;
+    u64 cycles = c->cycles;
+
+    int why = cpu_run(c, 1);
+    if (c->instructions == instructions) {
+        return why;
+    }
+
+    u->pc = r[15];
+    u->instructions = c->instructions - instructions;
+    u->cycles = c->cycles - cycles;
+
+    int n = 0;
+    for(int i=0; i<15; i++) {
+        if (c->r[i] != r[i]) {
+            if (n == UNDO_SLOTS) goto overflow;
+            u->changed[n].index = i;
+            u->changed[n].old = r[i];
+            n++;
+        }
+    }
+    for(int i=0; i<4; i++) {
+        if (c->special_regs[i] != special_regs[i]) {
+            if (n == UNDO_SLOTS) goto overflow;
+            u->changed[n].index = UNDO_SPECIAL + i;
+            u->changed[n].old = special_regs[i];
+            n++;
+        }
+    }
+    for(; n<UNDO_SLOTS; n++) {
+        u->changed[n].index = UNDO_NONE;
+    }
+
+    u->stored = c->stored;
+    u->store_wide = c->store_wide;
+    u->store_addr = c->store_addr;
+    u->store_old = c->store_old;
+    return why;
+
+overflow:
+    fprintf(stderr, "history: instruction at %04x changed more than %d registers\n", u->pc, UNDO_SLOTS);
+    abort();
+}
+
+static void undo_step(cpu *c, const undo *u)
+{
+    if (u->stored) {
+        mem_wr(c, u->store_addr, u->store_wide, u->store_old);
+    }
+    for(int n=UNDO_SLOTS-1; n>=0; n--) {
+        u8 index = u->changed[n].index;
+        if (index == UNDO_NONE) continue;
+        if (index >= UNDO_SPECIAL) {
+            c->special_regs[index - UNDO_SPECIAL] = u->changed[n].old;
+        } else {
+            c->r[index] = u->changed[n].old;
+        }
+    }
+    c->r[15] = u->pc;
+    c->instructions -= u->instructions;
+    c->cycles -= u->cycles;
+    c->stored = 0;
+}
+
+static void add_checkpoint(history *h, const cpu *c)
+{
+    if (h->num_checkpoints == h->max_checkpoints) {
+        // thin out, keeping those at even multiples of the interval
+        int n = 0;
+        for(int i=0; i<h->num_checkpoints; i++) {
+            if (i % 2 == 0) {
+                h->checkpoints[n++] = h->checkpoints[i];
+            } else {
+                cpu_free(h->checkpoints[i]);
+            }
+        }
+        h->num_checkpoints = n;
+        h->interval *= 2;
+        if (h->now != h->num_checkpoints * h->interval) {
+            return;
+        }
+    }
+    h->checkpoints[h->num_checkpoints++] = cpu_fork(c);
+}
+
+history *history_new(const cpu *c, u64 log_size, u64 interval)
+{
+    history *h = calloc(1, sizeof(history));
+    h->log_size = log_size ? log_size : 1;
+    h->log = malloc(h->log_size * sizeof(undo));
+    h->interval = interval ? interval : 1;
+    h->max_checkpoints = 256;
+    h->checkpoints = calloc(h->max_checkpoints, sizeof(cpu*));
+    add_checkpoint(h, c);
+    return h;
+}
+
+void history_free(history *h)
+{
+    if (h == 0) return;
+    for(int i=0; i<h->num_checkpoints; i++) {
+        cpu_free(h->checkpoints[i]);
+    }
+    free(h->checkpoints);
+    free(h->log);
+    free(h);
+}
+
+void history_reset(history *h, const cpu *c)
+{
+    for(int i=0; i<h->num_checkpoints; i++) {
+        cpu_free(h->checkpoints[i]);
+    }
+    h->num_checkpoints = 0;
+    h->now = 0;
+    h->log_count = 0;
+    add_checkpoint(h, c);
+}
+
+int history_step(history *h, cpu *c)
+{
+    if (h->now == h->num_checkpoints * h->interval) {
+        add_checkpoint(h, c);
+    }
+    u64 instructions = c->instructions;
+    int why = record_step(c, &h->log[h->now % h->log_size]);
+    if (c->instructions != instructions) {
+        h->now++;
+        if (h->log_count < h->log_size) {
+            h->log_count++;
+        }
+    }
+    return why;
+}
+
+int history_run(history *h, cpu *c, u64 max_steps)
+{
+    while(max_steps > 0) {
+        if (h->now == h->num_checkpoints * h->interval) {
+            add_checkpoint(h, c);
+        }
+
+        // run as far as the next checkpoint
+        u64 n = h->num_checkpoints * h->interval - h->now;
+        if (n > max_steps) n = max_steps;
+
+        u64 instructions = c->instructions;
+        int why = cpu_run(c, n);
+        u64 steps = c->instructions - instructions;
+
+        // cpu_run() leaves no undo log
+        h->now += steps;
+        if (steps) h->log_count = 0;
+        max_steps -= steps;
+
+        if (why != RUN_LIMIT) {
+            return why;
+        }
+    }
+    return RUN_LIMIT;
+}
+
+// Settings which must be off while replaying.
+typedef struct settings
+{
+    bool want_disasm;
+    bool trace_read;
+    bool trace_write;
+    struct stops *stops;
+} settings;
+
+// Turn off trace output and stops while replaying, saving the settings.
+static void quiet(cpu *c, settings *saved)
+{
+    saved->want_disasm = c->want_disasm;
+    saved->trace_read = c->trace_read;
+    saved->trace_write = c->trace_write;
+    saved->stops = c->stops;
+    c->want_disasm = 0;
+    c->trace_read = 0;
+    c->trace_write = 0;
+    c->stops = 0;
+}
+
+static void unquiet(cpu *c, const settings *saved)
+{
+    c->want_disasm = saved->want_disasm;
+    c->trace_read = saved->trace_read;
+    c->trace_write = saved->trace_write;
+    c->stops = saved->stops;
+}
+
+int history_goto(history *h, cpu *c, u64 t)
+{
+    if (t > h->now) {
+        return -1;
+    }
+
+    if (h->now - t <= h->log_count) {
+        while(h->now > t) {
+            h->now--;
+            h->log_count--;
+            undo_step(c, &h->log[h->now % h->log_size]);
+        }
+    }
+    else {
+        int k = t / h->interval;
+        for(int i=k+1; i<h->num_checkpoints; i++) {
+            cpu_free(h->checkpoints[i]);
+        }
+        h->num_checkpoints = k+1;
+
+        // the checkpoint's trace settings may be out of date
+        settings saved, ignored;
+        quiet(c, &saved);
+        cpu_copy(c, h->checkpoints[k]);
+        quiet(c, &ignored);
+
+        h->now = k * h->interval;
+        h->log_count = 0;
+        while(h->now < t) {
+            history_step(h, c);
+        }
+        unquiet(c, &saved);
+    }
+
+    // the store (if any) is no longer the most recent thing to happen
+    c->stored = 0;
+    c->resume_break = 0;
+    return 0;
+}
+
+u64 history_back(history *h, cpu *c, u64 n)
+{
+    if (n > h->now) n = h->now;
+    history_goto(h, c, h->now - n);
+    return n;
+}
+
+int history_reverse_find(history *h, cpu *c, bool (*match)(const undo *u, void *ctx), void *ctx)
+{
+    // first look through the undo log
+    for(u64 i=0; i<h->log_count; i++) {
+        u64 t = h->now - 1 - i;
+        if (match(&h->log[t % h->log_size], ctx)) {
+            return history_goto(h, c, t);
+        }
+    }
+
+    // then replay each earlier stretch between checkpoints, latest first
+    u64 limit = h->now - h->log_count;
+    if (limit == 0) {
+        return -1;
+    }
+    for(int k = (limit-1) / h->interval; k >= 0; k--) {
+        u64 t = k * h->interval;
+        u64 end = t + h->interval < limit ? t + h->interval : limit;
+        u64 found = 0;
+        bool any = 0;
+
+        cpu *tmp = cpu_fork(h->checkpoints[k]);
+        settings saved;
+        quiet(tmp, &saved);
+        for(; t < end; t++) {
+            undo u;
+            record_step(tmp, &u);
+            if (match(&u, ctx)) {
+                found = t;
+                any = 1;
+            }
+        }
+        cpu_free(tmp);
+
+        if (any) {
+            return history_goto(h, c, found);
+        }
+    }
+    return -1;
+}
+
+static bool match_write(const undo *u, void *ctx)
+{
+    u16 addr = *(u16*)ctx;
+    if (!u->stored) return 0;
+    return u->store_addr == addr || (u->store_wide && (u16)(u->store_addr + 1) == addr);
+}
+
+int history_reverse_to_write(history *h, cpu *c, u16 addr)
+{
+    return history_reverse_find(h, c, match_write, &addr);
+}
+
+static bool match_pc(const undo *u, void *ctx)
+{
+    return u->pc == *(u16*)ctx;
+}
+
+int history_reverse_to_pc(history *h, cpu *c, u16 pc)
+{
+    return history_reverse_find(h, c, match_pc, &pc);
+}
@@ -0,0 +1,107 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+// Execution history, for stepping the cpu backwards.
+//
+// Every step taken through history_step() appends an entry to a bounded
+// undo log, recording the pc and the old value of each register, special
+// register and memory location that the instruction changed. Stepping back
+// within the log just replays those entries in reverse.
+//
+// For going back further than the log reaches, a fork of the cpu is kept
+// every so many steps as a checkpoint (cheap, as memory is shared
+// copy-on-write). The cpu is restored from the nearest checkpoint at or
+// before the target, and run forward from there. When the checkpoint table
+// fills up every other checkpoint is dropped and the interval doubled, so
+// the whole run back to the start always remains reachable.
+//
+// Time is counted in steps since history_new() or history_reset(). Each
+// step is one instruction, counted by cpu->instructions even when skipped
+// by a predicate, so time advances exactly as cpu->instructions does.
+
+#include "cpu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    UNDO_NONE = 0xff,   // unused slot in undo.changed[]
+    UNDO_SPECIAL = 16,  // changed[].index for special_regs[i] is UNDO_SPECIAL+i
+    UNDO_SLOTS = 3      // no instruction changes more than this, besides the pc
+};
+
+typedef struct undo
+{
+    u16 pc;             // address of the instruction
+    u8 instructions;    // added to cpu->instructions (always 1)
+    u8 cycles;          // added to cpu->cycles
+    struct {
+        u8 index;       // 0-14 for r0-r14, UNDO_SPECIAL+i for special_regs[i]
+        u16 old;
+    } changed[UNDO_SLOTS];
+    bool stored;
+    bool store_wide;
+    u16 store_addr;
+    u16 store_old;
+} undo;
+
+typedef struct history
+{
+    u64 now;            // steps taken since history_new()
+
+    undo *log;          // ring buffer of the most recent steps
+    u64 log_size;
+    u64 log_count;      // entries available, at most log_size
+
+    cpu **checkpoints;  // checkpoints[i] is the state at time i*interval
+    int num_checkpoints;
+    int max_checkpoints;
+    u64 interval;
+} history;
+
+// Start recording history for c, from its current state. log_size is the
+// number of steps which can be undone directly, and interval the number of
+// steps between checkpoints.
+history *history_new(const cpu *c, u64 log_size, u64 interval);
+
+void history_free(history *h);
+
+// Forget all history, and start again from c's current state. This must be
+// called whenever c is changed other than by history_step().
+void history_reset(history *h, const cpu *c);
+
+// Step c forward one instruction, recording it. Returns the RUN_* result
+// of cpu_run(), so stops in c->stops are honoured; nothing is recorded for
+// RUN_BREAK.
+int history_step(history *h, cpu *c);
+
+// Run c forward up to max_steps with cpu_run(), returning its RUN_*
+// result. This is much faster than history_step(), but leaves nothing in
+// the undo log, so going back will replay from a checkpoint.
+int history_run(history *h, cpu *c, u64 max_steps);
+
+// Restore c to its state at time t, which must not be in the future.
+// Returns 0, or -1 if t > h->now.
+int history_goto(history *h, cpu *c, u64 t);
+
+// Step back n steps, or as far as the start. Returns the number of steps
+// taken back.
+u64 history_back(history *h, cpu *c, u64 n);
+
+// Step back to just before the most recent step for which match() returns
+// true, i.e. so that the matching instruction is the next to execute.
+// Returns 0, or -1 if there is no such step (in which case c is unchanged).
+int history_reverse_find(history *h, cpu *c, bool (*match)(const undo *u, void *ctx), void *ctx);
+
+// history_reverse_find() for the last store which wrote to the byte at addr.
+int history_reverse_to_write(history *h, cpu *c, u16 addr);
+
+// history_reverse_find() for the last time the instruction at pc executed.
+int history_reverse_to_pc(history *h, cpu *c, u16 pc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
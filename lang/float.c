@@ -1,38 +1,337 @@
-#include <math.h>
+#include <stdint.h>
+#include <string.h>
 #include "header.h"
 
-u16 f16_from_float(float f)
+// Every f16 as a float, indexed by its bits - see float_init().
+float f16_floats[0x10000];
+
+static uint32_t float_bits(float f)
 {
-    if (isnan(f)) return 0x7e00;
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
 
-    u16 sign = signbit(f) ? 0x8000:0;
-    if (isinf(f)) return sign|0x7c00;
-    if (f==0.0f)  return sign|0x0000;
+static float bits_float(uint32_t u)
+{
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
 
-    unsigned long fbits = *(unsigned long*)&f;
-    int exp = ((fbits>>23) & 0xff) - 112;
-    if (exp > 30) return sign|0x7c00;
-    u16 fra = (fbits>>13) & 0x03ff;
-    if (exp >= 1) return sign|(exp<<10)|fra;
-    fra |= 0x0400;
-    for(; exp < 1; exp++) fra >>= 1;
-    return sign|fra;
+// Rounded to nearest, ties to even, with subnormals; any NaN is 0x7e00.
+u16 f16_from_float(float f)
+{
+    uint32_t bits = float_bits(f);
+    u16 sign = (bits >> 16) & 0x8000;
+    bits &= 0x7fffffff;
+
+    if (bits >= 0x47800000) {               // 65536 or more, or NaN
+        return bits > 0x7f800000 ? 0x7e00 : sign|0x7c00;
+    }
+    if (bits < 0x38800000) {                // below the smallest normal
+        // adding 0.5 leaves the subnormal's fraction, in units of 2^-24, at
+        // the bottom of the sum's, with the rounding done by the addition
+        return sign | (float_bits(bits_float(bits) + 0.5f) - 0x3f000000);
+    }
+    // rebias; adding just under half, plus the lowest bit kept, carries into
+    // it when more than half is dropped, or exactly half and it is odd
+    bits += ((uint32_t)(15 - 127) << 23) + 0xfff + ((bits >> 13) & 1);
+    return sign | bits >> 13;
 }
 
-float f16_to_float(u16 u)
+static float f16_to_float_exact(u16 u)
 {
-    unsigned long lu = u;
-    unsigned long bits = (lu & 0x8000) << 16;
+    uint32_t lu = u;
+    uint32_t bits = (lu & 0x8000) << 16;
     lu &= 0x7fff;
     if (lu != 0) {
         if (lu >= 0x7c00) bits |= 0x70000000;
         else {
-            unsigned long adj = 112;
-            while(lu < 0x0200) { lu <<= 1; adj -= 1; }
+            uint32_t adj = 112;
+            while(lu < 0x0400) { lu <<= 1; adj -= 1; }
             lu += adj<<10;
         }
         bits |= lu << 13;
     }
-    return *(float*) &bits;
+    return bits_float(bits);
+}
+
+void float_init()
+{
+    for(uint32_t u=0; u<0x10000; u++) {
+        f16_floats[u] = f16_to_float_exact(u);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Decimal conversion
+//
+
+typedef unsigned __int128 u128;
+
+static const uint64_t pow10s[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull,
+    1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+    1000000000000000000ull, 10000000000000000000ull
+};
+
+static u128 pow10_wide(int n)
+{
+    return n < 20 ? pow10s[n] : (u128)pow10s[19] * pow10s[n - 19];
+}
+
+// The value of x (positive, finite - or 0x7c00, as 2^16) as num * 2^p.
+static void f16_value(u16 x, uint32_t *num, int *p)
+{
+    int exp = x >> 10;
+    *num = exp ? (x & 0x3ff) | 0x400 : x & 0x3ff;
+    *p = (exp ? exp : 1) - 25;
+}
+
+// The point halfway between x and the next f16 up, as num * 2^p.
+static void f16_midpoint(u16 x, uint32_t *num, int *p)
+{
+    uint32_t num_next;
+    int p_next;
+    f16_value(x, num, p);
+    f16_value(x + 1, &num_next, &p_next);
+    *num += num_next << (p_next - *p);
+    *p -= 1;
+}
+
+// The sign of d * 10^e - num * 2^p, where the decimal is a little more than
+// that if sticky; exact for d of up to F16_PARSE_DIGITS digits, d * 10^e
+// and num * 2^p within about 10^-9 to 10^7.
+static int compare(u128 d, int e, int sticky, uint32_t num, int p)
+{
+    u128 left = d;
+    u128 right = num;
+    if (e >= 0) left *= pow10_wide(e); else right *= pow10_wide(-e);
+    if (p >= 0) right <<= p; else left <<= -p;
+    if (left != right) return left < right ? -1 : 1;
+    return sticky;
+}
+
+static int count_digits(u128 d)
+{
+    int n = 1;
+    while(n < 39 && d >= pow10_wide(n)) n++;
+    return n;
+}
+
+// d * 10^e rounded to nearest even, as a positive f16.
+static u16 f16_from_decimal(u128 d, int e, int sticky)
+{
+    if (d == 0) return 0;
+    int mag = count_digits(d) + e;              // d * 10^e < 10^mag
+    if (mag > 6) return 0x7c00;
+    if (mag < -8) return 0;                     // below half the least subnormal
+
+    // the greatest x <= the decimal
+    u16 lo = 0, hi = 0x7c00;
+    while(hi - lo > 1) {
+        u16 mid = (lo + hi) / 2;
+        uint32_t num;
+        int p;
+        f16_value(mid, &num, &p);
+        if (compare(d, e, sticky, num, p) >= 0) lo = mid; else hi = mid;
+    }
+    uint32_t num;
+    int p;
+    f16_midpoint(lo, &num, &p);
+    int c = compare(d, e, sticky, num, p);
+    return (c > 0 || (c == 0 && (lo & 1))) ? lo + 1 : lo;
+}
+
+// The shortest decimal digits of each positive finite f16 which read back
+// as it, as d | (e + 32) << 17 for d * 10^e, d having no trailing zeros.
+//
+// This is not a constant table generated at build time: its 31743 entries
+// (124KB) are computed on the first str() or print of a float, by
+// shortest_digits() - a few tens of ms. Each is checked against
+// f16_from_decimal(), which f16_parse() rounds with, so the two cannot
+// disagree, and a program which never formats a float never pays for it.
+static uint32_t f16_digits[0x7c00];
+static int f16_digits_ready = 0;
+
+// x * 10^-e rounded to nearest even.
+static uint64_t scale_round(u16 x, int e)
+{
+    uint32_t num;
+    int p;
+    f16_value(x, &num, &p);
+    u128 n = num;
+    u128 d = 1;
+    if (p >= 0) n <<= p; else d <<= -p;
+    if (e >= 0) d *= pow10_wide(e); else n *= pow10_wide(-e);
+    u128 q = n / d;
+    u128 r2 = (n % d) * 2;
+    return q + (r2 > d || (r2 == d && (q & 1)));
 }
 
+static uint32_t shortest_digits(u16 x)
+{
+    uint32_t num;
+    int p;
+    f16_value(x, &num, &p);
+
+    // from one significant digit up: five always suffice. The nearest d
+    // with so many may not read back when the next one on the other side
+    // of x does, as the gap below a power of two is half that above.
+    int e = 4;
+    while(scale_round(x, e) == 0) e--;
+    for(;; e--) {
+        uint64_t d = scale_round(x, e);
+        uint64_t other = compare(d, e, 0, num, p) < 0 ? d + 1 : d - 1;
+        uint64_t found = f16_from_decimal(d, e, 0) == x ? d
+                       : other && f16_from_decimal(other, e, 0) == x ? other
+                       : 0;
+        if (found) {
+            while(found % 10 == 0) { found /= 10; e++; }
+            return found | (uint32_t)(e + 32) << 17;
+        }
+    }
+}
+
+// Writes the shortest decimal which reads back as f, e.g. "0.1", "-2.0",
+// "6e-8", "inf" or "nan", with a \0 to buf - at least F16_STR_MAX bytes.
+// Returns its length.
+int f16_format(u16 f, char *buf)
+{
+    char *q = buf;
+    if ((f & 0x7fff) > 0x7c00) {
+        memcpy(buf, "nan", 4);
+        return 3;
+    }
+    if (f & 0x8000) *q++ = '-';
+    u16 x = f & 0x7fff;
+    if (x == 0x7c00) {
+        memcpy(q, "inf", 4);
+        return q + 3 - buf;
+    }
+    if (x == 0) {
+        memcpy(q, "0.0", 4);
+        return q + 3 - buf;
+    }
+
+    if (!f16_digits_ready) {                    // first use - see f16_digits
+        for(u16 i=1; i<0x7c00; i++) f16_digits[i] = shortest_digits(i);
+        f16_digits_ready = 1;
+    }
+    uint32_t entry = f16_digits[x];
+    char digits[8];
+    int n = 0;
+    for(uint32_t d = entry & 0x1ffff; d; d /= 10) digits[n++] = '0' + d % 10;
+    int lead = (int)(entry >> 17) - 32 + n - 1;    // the leading digit's power of 10
+
+    if (lead < -5) {
+        // d.ddde-N
+        *q++ = digits[--n];
+        if (n) *q++ = '.';
+        while(n) *q++ = digits[--n];
+        *q++ = 'e';
+        *q++ = '-';
+        if (-lead >= 10) *q++ = '0' + -lead / 10;
+        *q++ = '0' + -lead % 10;
+    }
+    else if (lead < 0) {
+        *q++ = '0';
+        *q++ = '.';
+        for(int i=-1; i>lead; i--) *q++ = '0';
+        while(n) *q++ = digits[--n];
+    }
+    else {
+        for(int i=lead; i>=0; i--) *q++ = n ? digits[--n] : '0';
+        *q++ = '.';
+        if (n == 0) *q++ = '0';
+        while(n) *q++ = digits[--n];
+    }
+    *q = 0;
+    return q - buf;
+}
+
+static int lower(char ch)
+{
+    return (ch >= 'A' && ch <= 'Z') ? ch - 'A' + 'a' : ch;
+}
+
+// Significant digits kept by f16_parse, those after only being known to be
+// non-zero or not: an f16, or the point halfway between two, is exact in 22.
+#define F16_PARSE_DIGITS 25
+
+static int match_word(const char *s, const char *word)
+{
+    int n = 0;
+    while(word[n] && lower(s[n]) == word[n]) n++;
+    return word[n] ? 0 : n;
+}
+
+// Reads a decimal number - [+-]digits[.digits][e[+-]digits] - or inf,
+// infinity or nan, from s, rounded to nearest even. Sets *end just past
+// it, or to s if there is none there.
+u16 f16_parse(const char *s, const char **end)
+{
+    const char *p = s;
+    u16 sign = 0;
+    if (*p == '+' || *p == '-') sign = (*p++ == '-') ? 0x8000 : 0;
+
+    int n;
+    if ((n = match_word(p, "infinity")) || (n = match_word(p, "inf"))) {
+        *end = p + n;
+        return sign | 0x7c00;
+    }
+    if ((n = match_word(p, "nan"))) {
+        *end = p + n;
+        return 0x7e00;
+    }
+
+    u128 d = 0;
+    int e = 0;
+    int sticky = 0;
+    int digits = 0;     // significant digits in d
+    int any = 0;
+    int dp = 0;
+    for(;; p++) {
+        if (*p == '.' && !dp) {
+            dp = 1;
+        }
+        else if (*p >= '0' && *p <= '9') {
+            any = 1;
+            if (digits < F16_PARSE_DIGITS) {
+                d = d * 10 + (*p - '0');
+                if (d) digits++;
+                if (dp) e--;
+            }
+            else {
+                if (*p != '0') sticky = 1;
+                if (!dp) e++;
+            }
+        }
+        else {
+            break;
+        }
+    }
+    if (!any) {
+        *end = s;
+        return 0;
+    }
+
+    if (*p == 'e' || *p == 'E') {
+        const char *q = p + 1;
+        int exp_sign = 1;
+        if (*q == '+' || *q == '-') exp_sign = (*q++ == '-') ? -1 : 1;
+        if (*q >= '0' && *q <= '9') {
+            int exp = 0;
+            for(; *q >= '0' && *q <= '9'; q++) {
+                if (exp < 10000) exp = exp * 10 + (*q - '0');
+            }
+            e += exp_sign * exp;
+            p = q;
+        }
+    }
+    *end = p;
+    return sign | f16_from_decimal(d, e, sticky);
+}
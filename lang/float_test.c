@@ -0,0 +1,117 @@
+// Exhaustive checks of f16_format and f16_parse (float.c): that every f16
+// reads back as itself, in as few digits as any decimal which does, and
+// that halfway cases, and those either side of them, round correctly.
+//
+//      make test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "header.h"
+
+static int failures = 0;
+
+static void report(const char *what, u16 x, const char *text, u16 got)
+{
+    if (failures++ < 20) printf("%-12s %04x \"%s\" -> %04x\n", what, x, text, got);
+}
+
+static int is_nan(u16 x)
+{
+    return (x & 0x7fff) > 0x7c00;
+}
+
+// The number of significant digits in a formatted decimal.
+static int significant_digits(const char *text)
+{
+    char digits[F16_STR_MAX];
+    int n = 0;
+    for(const char *p = text; *p && *p != 'e'; p++) {
+        if (*p >= '0' && *p <= '9' && (n || *p != '0')) digits[n++] = *p;
+    }
+    while(n > 1 && digits[n-1] == '0') n--;
+    return n;
+}
+
+// Whether a decimal of n significant digits reads back as x (positive,
+// finite), by libc - strtof is exact for so few digits, so only the f16
+// conversion rounds. The nearest such decimal may not when its neighbour
+// on the other side of x does.
+static int reads_back_in(u16 x, int n)
+{
+    char text[64];
+    double value = f16_to_float(x);
+    snprintf(text, sizeof(text), "%.*e", n - 1, value);
+    if (f16_from_float(strtof(text, 0)) == x) return 1;
+
+    double step = 1;
+    for(int exp = atoi(strchr(text, 'e') + 1) - (n - 1); exp; ) {
+        if (exp > 0) { step *= 10; exp--; } else { step /= 10; exp++; }
+    }
+    double d = strtod(text, 0);
+    snprintf(text, sizeof(text), "%.*e", n - 1, d < value ? d + step : d - step);
+    return f16_from_float(strtof(text, 0)) == x;
+}
+
+static void check_round_trip(u16 x)
+{
+    char buf[F16_STR_MAX + 8];
+    int len = f16_format(x, buf);
+    if (len != (int)strlen(buf) || len >= F16_STR_MAX) {
+        report("length", x, buf, len);
+        return;
+    }
+
+    const char *end;
+    u16 got = f16_parse(buf, &end);
+    if (end != buf + len) report("end", x, buf, end - buf);
+    if (is_nan(x) ? !is_nan(got) : got != x) report("round-trip", x, buf, got);
+
+    u16 x_abs = x & 0x7fff;
+    if (x_abs == 0 || x_abs >= 0x7c00) return;
+    got = f16_from_float(strtof(buf, 0));
+    if (got != x) report("libc", x, buf, got);
+    int n = significant_digits(buf);
+    if (n > 1 && reads_back_in(x_abs, n - 1)) report("shortest", x, buf, n);
+}
+
+// The exact decimal halfway between x and the next f16 up reads as the even
+// one of them; just above it, as the upper; just below it, as the lower.
+static void check_halfway(u16 x)
+{
+    char text[64];
+    double next = x == 0x7bff ? 65536 : f16_to_float(x + 1);     // past the greatest, as if not infinite
+    double mid = (f16_to_float(x) + next) / 2;
+    // exact: a multiple of 2^-25 has at most 25 decimal places
+    snprintf(text, sizeof(text), "%.30f", mid);
+    const char *end;
+    u16 even = (x & 1) ? x + 1 : x;
+    u16 got = f16_parse(text, &end);
+    if (got != even) report("halfway", x, text, got);
+
+    char above[80];
+    snprintf(above, sizeof(above), "%s1", text);
+    got = f16_parse(above, &end);
+    if (got != x + 1) report("above", x, above, got);
+
+    // less 10^-30: the last non-zero digit down one, the zeros after it 9s
+    int i = strlen(text) - 1;
+    for(; text[i] == '0' || text[i] == '.'; i--) {
+        if (text[i] == '0') text[i] = '9';
+    }
+    text[i]--;
+    got = f16_parse(text, &end);
+    if (got != x) report("below", x, text, got);
+}
+
+int main()
+{
+    float_init();
+
+    for(unsigned x=0; x<0x10000; x++) check_round_trip(x);
+    for(u16 x=0; x<0x7c00; x++) check_halfway(x);
+
+    printf("%s: %d failures\n", failures ? "FAIL" : "pass", failures);
+    return failures != 0;
+}
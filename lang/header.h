@@ -93,7 +93,19 @@ void die(const char* msg);
 void vm_die(const char* msg);
 u16 vm_run(const u8* vm_pc_base);
 u16 f16_from_float(float f);
-float f16_to_float(u16 u);
+
+extern float f16_floats[0x10000];
+void float_init();
+
+#define F16_STR_MAX 16
+int f16_format(u16 f, char *buf);
+u16 f16_parse(const char *s, const char **end);
+
+static inline float f16_to_float(u16 u)
+{
+    return f16_floats[u];
+}
+
 const char* debug_op_name(u8 op);
 
 void emit_op(u8 op);
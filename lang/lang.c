@@ -707,8 +707,8 @@ u16 parse_literal()
             }
         case kind_float:
             {
-                float f = (float)atof((const char*)token_ptr);
-                u16 f16 = f16_from_float(f);
+                const char *end;
+                u16 f16 = f16_parse((const char*)token_ptr, &end);
                 emit_op(op_lit_float);
                 emit_word(f16);
                 return 1;
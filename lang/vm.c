@@ -4,6 +4,7 @@
 #include <math.h>
 
 #include "header.h"
+#include "../ref/float16_int.h"
 
 typedef short i16;
 
@@ -315,7 +316,7 @@ void vm_add()
         return;
     }
     if (vm_a.k == kind_float) {
-        push_float(f16_to_float(vm_a.f) + f16_to_float(vm_b.f));
+        push_f16(f16i_add(vm_a.f, vm_b.f));
         return;
     }
     if (vm_a.k == kind_str_0) {
@@ -359,12 +360,13 @@ void vm_relop(u8 op)
             cmp = (vm_a.i == vm_b.i) ? 0 : (vm_a.i < vm_b.i) ? -1 : 1;
             break;
 
-        case kind_float: {
-            float af = f16_to_float(vm_a.f);
-            float bf = f16_to_float(vm_b.f);
-            cmp = (af == bf) ? 0 : (af < bf) ? -1 : 1;
+        case kind_float:
+            cmp = f16i_compare(vm_a.f, vm_b.f);
+            if (cmp == 2) {             // unordered: only != holds
+                push_bool(op == op_ne);
+                return;
+            }
             break;
-        }
 
         case kind_str_0:
         case kind_str_1:
@@ -506,11 +508,11 @@ void fn_float()
                 char buf[32];
                 memcpy(buf, data, len);
                 buf[len] = '\0';
-                char* endptr;
-                float f = strtof(buf, &endptr);
+                const char* endptr;
+                u16 f = f16_parse(buf, &endptr);
                 // if *str is not `\0' but **endptr is `\0' on return, the entire string was valid.
                 if (endptr > buf && *endptr == '\0') {
-                    push_float(f);
+                    push_f16(f);
                     return;
                 }
             }
@@ -580,7 +582,7 @@ void fn_str()
             break;
 
         case kind_float:
-            len = sprintf(buf, "%f", f16_to_float(vm_a.f));
+            len = f16_format(vm_a.f, buf);
             q = buf;
             break;
 
@@ -762,9 +764,12 @@ void vm_print(value val)
             printf("%d", val.i);
             break;
 
-        case kind_float:
-            printf("%f", f16_to_float(val.f));
+        case kind_float: {
+            char buf[F16_STR_MAX];
+            f16_format(val.f, buf);
+            printf("%s", buf);
             break;
+        }
 
         case kind_str_0:
             break;
@@ -1019,6 +1024,8 @@ u16 vm_run(const u8 *vm_pc_base)
     fprintf(stderr, "\n");
     fprintf(stderr, "RUNNING\n");
 
+    float_init();
+
     vm_fp = 0;
     vm_sp = 0;
     vm_pc = (u16)(vm_pc_base - code_base);
@@ -1031,10 +1038,10 @@ u16 vm_run(const u8 *vm_pc_base)
         switch(op) {
             // arithmetic operators
             case op_neg:    pop_num(); if (vm_a.k == kind_int) push_int(-vm_a.i); else push_f16(vm_a.f ^ 0x8000); break;
-            case op_mul:    pop_nums(); if (vm_a.k == kind_int) push_int(vm_a.i * vm_b.i); else push_float(f16_to_float(vm_a.f) * f16_to_float(vm_b.f)); break;
-            case op_div:    pop_nums(); if (vm_a.k == kind_int) push_int(vm_a.i / vm_b.i); else push_float(f16_to_float(vm_a.f) / f16_to_float(vm_b.f)); break;
+            case op_mul:    pop_nums(); if (vm_a.k == kind_int) push_int(vm_a.i * vm_b.i); else push_f16(f16i_mul(vm_a.f, vm_b.f)); break;
+            case op_div:    pop_nums(); if (vm_a.k == kind_int) push_int(vm_a.i / vm_b.i); else push_f16(f16i_div(vm_a.f, vm_b.f)); break;
             case op_add:    vm_add(); break;
-            case op_sub:    pop_nums(); if (vm_a.k == kind_int) push_int(vm_a.i - vm_b.i); else push_float(f16_to_float(vm_a.f) - f16_to_float(vm_b.f)); break;
+            case op_sub:    pop_nums(); if (vm_a.k == kind_int) push_int(vm_a.i - vm_b.i); else push_f16(f16i_sub(vm_a.f, vm_b.f)); break;
             case op_mod:    pop_ints(); push_int(vm_a.i % vm_b.i); break;
 
             // relational operators
@@ -0,0 +1,114 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "listing.h"
+
+static void add_label(listing *l, const char *name, u16 addr)
+{
+    if ((l->num_labels & (l->num_labels-1)) == 0) {
+        int size = l->num_labels ? 2*l->num_labels : 64;
+        l->labels = realloc(l->labels, size * sizeof(listing_label));
+    }
+    l->labels[l->num_labels].name = name;
+    l->labels[l->num_labels].addr = addr;
+    l->num_labels++;
+    l->label[addr] = name;
+}
+
+listing *listing_load(const char *file)
+{
+    FILE *fp = fopen(file, "r");
+    if (fp == 0) {
+        fprintf(stderr, "could not load %s\n", file);
+        return 0;
+    }
+
+    listing *l = calloc(1, sizeof(listing));
+
+    // labels seen since the last line which emitted anything
+    const char *pending[64];
+    int num_pending = 0;
+    u16 next_org = 0;
+
+    int lineno = 0;
+    char buf[1024];
+    while(fgets(buf, sizeof(buf), fp)) {
+        lineno++;
+        char *end = strchr(buf, '\n');
+        if (end) *end = '\0';
+
+        u16 org;
+        u16 value;
+        int value_start = 0;
+        int value_end = 0;
+        int text = 0;
+
+        if (buf[0] == '.') {
+            if (num_pending == sizeof(pending)/sizeof(pending[0])) {
+                fprintf(stderr, "%s:%d: too many labels\n", file, lineno);
+                fclose(fp);
+                listing_free(l);
+                return 0;
+            }
+            pending[num_pending++] = strdup(buf+1);
+        }
+        else if (2 <= sscanf(buf, "%hx %n%hx%n ; %n", &org, &value_start, &value, &value_end, &text)) {
+            next_org = org + (value_end - value_start) / 2;
+            for(int i=0; i<num_pending; i++) {
+                add_label(l, pending[i], org);
+            }
+            num_pending = 0;
+            if (text && l->text[org] == 0) {
+                l->text[org] = strdup(buf+text);
+            }
+        }
+        else if (buf[0] == ';') {
+            // ignore comment
+        }
+        else {
+            fprintf(stderr, "%s:%d: syntax error\n", file, lineno);
+            fclose(fp);
+            listing_free(l);
+            return 0;
+        }
+    }
+
+    if (ferror(fp)) {
+        fprintf(stderr, "%s:%d: while reading: %s\n", file, lineno, strerror(errno));
+        fclose(fp);
+        listing_free(l);
+        return 0;
+    }
+    fclose(fp);
+
+    // labels at the very end refer to the address following the last data
+    for(int i=0; i<num_pending; i++) {
+        add_label(l, pending[i], next_org);
+    }
+    return l;
+}
+
+void listing_free(listing *l)
+{
+    if (l == 0) return;
+    for(int i=0; i<l->num_labels; i++) {
+        free((char*)l->labels[i].name);
+    }
+    for(int i=0; i<65536; i++) {
+        free((char*)l->text[i]);
+    }
+    free(l->labels);
+    free(l);
+}
+
+int listing_find(const listing *l, const char *name)
+{
+    for(int i=0; i<l->num_labels; i++) {
+        if (!strcmp(l->labels[i].name, name)) {
+            return l->labels[i].addr;
+        }
+    }
+    return -1;
+}
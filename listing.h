@@ -0,0 +1,46 @@
+#ifndef LISTING_H
+#define LISTING_H
+
+// Reader for the listing which asm.pl prints on stdout, e.g. out/asm.log:
+//
+//      .label
+//      0100 1234 ; source line
+//      ; comment
+//
+// A label refers to the address of the next line which emits code or data.
+
+#include "cpu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    const char *name;
+    u16 addr;
+} listing_label;
+
+typedef struct listing
+{
+    const char *label[65536];   // last label defined at each address
+    const char *text[65536];    // source line for each address
+
+    listing_label *labels;      // every label, in listing order
+    int num_labels;
+} listing;
+
+// Load a listing. On failure a message is printed to stderr, and 0 returned.
+listing *listing_load(const char *file);
+
+void listing_free(listing *l);
+
+// Return the address of the named label (without the leading '.'),
+// or -1 if there is no such label.
+int listing_find(const listing *l, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
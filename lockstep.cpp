@@ -0,0 +1,338 @@
+// Lockstep differential co-simulation of the C simulator (cpu.c)
+// against a Verilator model of vixen.v.
+//
+// Both models are loaded with the same memory image and run side by side.
+// Every time the RTL enters its EXECUTE state an instruction retires, and
+// the C model is stepped by one instruction to match, and the
+// architectural state at retirement (pc, opcode, r0-r15, flags, and any
+// store made by the instruction) is compared. On the first divergence the
+// most recent retirements from both models are printed, and we exit with a
+// non-zero status.
+//
+// The memory model is a port of memory.v/ram8.v (registered reads, byte
+// lanes), without top.v's I/O decoding - like sim.c, the whole 64K address
+// space is RAM, and the irq line is held low.
+//
+// Build with "make lockstep".
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Vvixen.h"
+#include "Vvixen___024root.h"
+#include "verilated.h"
+
+#include "cpu.h"
+
+// RTL state encodings, from vixen.v
+static const int RTL_EXECUTE = 3;
+
+// number of retirements kept for the divergence report
+static const int HISTORY = 16;
+
+typedef struct
+{
+    u64 seq;            // retirement number
+    u16 pc;
+    u16 op;
+    u16 r[16];          // r15 is pc+2, as it is during EXECUTE
+    u16 flags;
+    bool stored;
+    bool store_wide;
+    u16 store_addr;
+    u16 store_data;     // for byte stores only the low 8 bits are kept
+} retirement;
+
+typedef struct
+{
+    retirement ring[HISTORY];
+    u64 count;
+} history;
+
+static bool same_retirement(const retirement *a, const retirement *b)
+{
+    if (a->pc != b->pc || a->op != b->op || a->flags != b->flags ||
+            memcmp(a->r, b->r, sizeof(a->r)) != 0 || a->stored != b->stored) {
+        return 0;
+    }
+    return !a->stored || (a->store_wide == b->store_wide &&
+                          a->store_addr == b->store_addr &&
+                          a->store_data == b->store_data);
+}
+
+static retirement *next_slot(history *h)
+{
+    retirement *t = &h->ring[h->count % HISTORY];
+    memset(t, 0, sizeof(*t));
+    t->seq = h->count++;
+    return t;
+}
+
+//------------------------------------------------------------------------------
+// RTL side
+//
+
+// A port of memory.v: two byte-wide rams with registered outputs.
+typedef struct
+{
+    u8 hi[0x8000];
+    u8 lo[0x8000];
+    u8 hi_dout;
+    u8 lo_dout;
+} rtl_memory;
+
+static void rtl_memory_clock(rtl_memory *m, bool en, bool wr, bool wide, u16 addr, u16 din)
+{
+    if (!en) return;
+
+    u16 mem_addr = addr >> 1;
+    bool aligned = (addr & 1) == 0;
+
+    u16 hi_addr = aligned ? mem_addr : (mem_addr + 1) & 0x7fff;
+    u16 lo_addr = mem_addr;
+
+    u8 hi_din = (wide && aligned)  ? din >> 8 : din & 0xff;
+    u8 lo_din = (wide && !aligned) ? din >> 8 : din & 0xff;
+
+    bool hi_en = wide || aligned;
+    bool lo_en = wide || !aligned;
+
+    if (hi_en) {
+        m->hi_dout = m->hi[hi_addr];
+        if (wr) m->hi[hi_addr] = hi_din;
+    }
+    if (lo_en) {
+        m->lo_dout = m->lo[lo_addr];
+        if (wr) m->lo[lo_addr] = lo_din;
+    }
+}
+
+static u16 rtl_memory_dout(rtl_memory *m, u16 addr)
+{
+    bool aligned = (addr & 1) == 0;
+    return aligned ? (m->hi_dout << 8 | m->lo_dout) : (m->lo_dout << 8 | m->hi_dout);
+}
+
+typedef struct
+{
+    Vvixen *top;
+    rtl_memory mem;
+    u64 cycles;
+} rtl;
+
+static void rtl_tick(rtl *v)
+{
+    // ram8 samples the cpu's registered outputs at the same edge
+    // that the cpu samples the ram's registered output
+    bool en   = v->top->en;
+    bool wr   = v->top->wr;
+    bool wide = v->top->wide;
+    u16 addr  = v->top->addr;
+    u16 dout  = v->top->dout;
+
+    v->top->clk = 1;
+    v->top->eval();
+
+    // dout1's byte lane mux follows the cpu's current address
+    rtl_memory_clock(&v->mem, en, wr, wide, addr, dout);
+    v->top->din = rtl_memory_dout(&v->mem, v->top->addr);
+    v->top->eval();
+
+    v->top->clk = 0;
+    v->top->eval();
+
+    v->cycles++;
+}
+
+static void rtl_capture(rtl *v, retirement *t)
+{
+    Vvixen___024root *root = v->top->rootp;
+    u16 op = v->top->din;
+
+    for(int i=0; i<16; i++) t->r[i] = root->vixen__DOT__r[i];
+    t->pc = t->r[15] - 2;
+    t->op = op;
+    t->flags = root->vixen__DOT__special_reg[FLAGS];
+
+    if (root->vixen__DOT__substate == SS_STORE) {
+        u16 target = root->vixen__DOT__r[op & 0xf];
+        t->stored = 1;
+        t->store_wide = root->vixen__DOT__ld_st_wide;
+        t->store_addr = root->vixen__DOT__ld_st_addr;
+        t->store_data = t->store_wide ? target : (target & 0xff);
+    }
+}
+
+//------------------------------------------------------------------------------
+// C side
+//
+
+static int c_step(cpu *c, retirement *t)
+{
+    u16 pc = c->r[15];
+
+    t->pc = pc;
+    t->op = mem_rd(c, pc, 1);
+    for(int i=0; i<16; i++) t->r[i] = c->r[i];
+    t->r[15] = pc + 2;
+    t->flags = c->special_regs[FLAGS];
+
+    int substate = cpu_step(c);
+
+    if (c->stored) {
+        t->stored = 1;
+        t->store_wide = c->store_wide;
+        t->store_addr = c->store_addr;
+        t->store_data = c->store_wide ? c->store_data : (c->store_data & 0xff);
+    }
+    return substate;
+}
+
+//------------------------------------------------------------------------------
+// Reporting
+//
+
+static void print_retirement(const char *who, const retirement *t, const retirement *other)
+{
+    printf("%-4s #%-10llu %04x %04x", who, (unsigned long long)t->seq, t->pc, t->op);
+    printf(" %c%c%c%c",
+            (t->flags & FLAG_N) ? 'N' : '.',
+            (t->flags & FLAG_Z) ? 'Z' : '.',
+            (t->flags & FLAG_C) ? 'C' : '.',
+            (t->flags & FLAG_V) ? 'V' : '.');
+    if (t->flags != other->flags) printf("*");
+    for(int i=0; i<16; i++) {
+        printf(" %04x%s", t->r[i], t->r[i] != other->r[i] ? "*" : "");
+    }
+    if (t->stored) {
+        bool diff = !other->stored ||
+            t->store_wide != other->store_wide ||
+            t->store_addr != other->store_addr ||
+            t->store_data != other->store_data;
+        printf(" WRITE %s [%04x] <= %04x%s", t->store_wide ? "WORD" : "BYTE", t->store_addr, t->store_data, diff ? "*" : "");
+    }
+    printf("\n");
+}
+
+static void report_divergence(history *hc, history *hv)
+{
+    printf("DIVERGED at retirement %llu (fields marked * differ)\n\n", (unsigned long long)(hc->count - 1));
+    printf("%-4s %-11s %-4s %-4s %-4s", "", "seq", "pc", "op", "flag");
+    for(int i=0; i<16; i++) printf(" r%-3d", i);
+    printf("\n");
+
+    u64 n = hc->count < (u64)HISTORY ? hc->count : (u64)HISTORY;
+    for(u64 i = hc->count - n; i < hc->count; i++) {
+        const retirement *tc = &hc->ring[i % HISTORY];
+        const retirement *tv = &hv->ring[i % HISTORY];
+        print_retirement("sim", tc, tv);
+        print_retirement("rtl", tv, tc);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Main
+//
+
+static void load_image(cpu *c, rtl_memory *m)
+{
+    if (cpu_load_image(c, "out/mem.bin")) {
+        fprintf(stderr, "could not load out/mem.bin.0, out/mem.bin.1: %s\n", strerror(errno));
+        exit(1);
+    }
+    for(int i=0; i<0x8000; i++) {
+        u16 word = mem_word(c, i);
+        m->hi[i] = word >> 8;
+        m->lo[i] = word & 0xff;
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "%s: lockstep co-simulation of sim.c against vixen.v\n\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -h, --help             display this message, and exit\n");
+    fprintf(stderr, "  -n, --max-retire N     stop after N instructions (default: no limit)\n");
+    fprintf(stderr, "  -q, --quiet            do not print a summary on success\n");
+    exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    Verilated::commandArgs(argc, argv);
+
+    u64 max_retire = 0;
+    bool quiet = 0;
+    for(int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            usage(argv[0]);
+        }
+        else if ((!strcmp(argv[i], "-n") || !strcmp(argv[i], "--max-retire")) && i+1 < argc) {
+            max_retire = strtoull(argv[++i], 0, 0);
+        }
+        else if (!strcmp(argv[i], "-q") || !strcmp(argv[i], "--quiet")) {
+            quiet = 1;
+        }
+        else if (argv[i][0] != '+') {   // leave +verilator+ args alone
+            fprintf(stderr, "%s: unknown option `%s'.\n", argv[0], argv[i]);
+            exit(1);
+        }
+    }
+
+    cpu *c = cpu_new();
+    static rtl v;
+    static history hc, hv;
+
+    load_image(c, &v.mem);
+
+    v.top = new Vvixen;
+    v.top->irq = 0;
+    v.top->clk = 0;
+    v.top->din = 0;
+    v.top->eval();
+
+    int status = 0;
+    while(max_retire == 0 || hc.count < max_retire) {
+        rtl_tick(&v);
+        if (v.top->rootp->vixen__DOT__state != RTL_EXECUTE) {
+            continue;
+        }
+
+        retirement *tv = next_slot(&hv);
+        rtl_capture(&v, tv);
+
+        retirement *tc = next_slot(&hc);
+        int substate = c_step(c, tc);
+
+        if (!same_retirement(tc, tv)) {
+            report_divergence(&hc, &hv);
+            status = 1;
+            break;
+        }
+
+        if (substate == SS_HALT) {
+            break;
+        }
+        if (substate == SS_SWI || substate == SS_RTU || substate == SS_TRAP) {
+            // sim.c stops here, so there is nothing to compare against
+            printf("STOPPED at retirement %llu: pc=%04x op=%04x is not supported by sim.c\n",
+                    (unsigned long long)tc->seq, tc->pc, tc->op);
+            status = 2;
+            break;
+        }
+    }
+
+    if (!quiet || status != 0) {
+        printf("retired %llu instructions: sim %llu cycles, rtl %llu cycles\n",
+                (unsigned long long)hc.count,
+                (unsigned long long)c->cycles,
+                (unsigned long long)v.cycles);
+    }
+
+    v.top->final();
+    delete v.top;
+    cpu_free(c);
+    return status;
+}
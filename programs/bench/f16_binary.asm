@@ -0,0 +1,43 @@
+; Benchmark of an f16 binary operation over its unit test vectors - list
+; after programs/semihost.asm and before the test data and libraries, as
+; for programs/f16/harness.asm, e.g.
+;
+;       ./asm.pl programs/semihost.asm programs/bench/f16_binary.asm \
+;           programs/f16/mul_testdata.asm programs/f16/internal.asm \
+;           programs/f16/mul.asm > out/asm.log
+;       ./out/sim -q -A out/asm.log --entry .bench --bench -
+;
+; The region is named after the routine under test, and includes loading
+; its arguments and the call through .unit_test_data.
+.bench
+{
+    mov r13, #hi(.unit_test_data+2)
+    add r13, #lo(.unit_test_data+2)
+
+.loop
+    mov r0, #hi(.unit_test_data)
+    add r0, #lo(.unit_test_data)
+    ldw r0, [r0]
+    swi #.SYS_BENCH_START
+    ldw r0, [r13, #2]
+    ldw r1, [r13, #4]
+    bl .call
+    swi #.SYS_BENCH_STOP
+
+    add r13, #8
+    mov r12, #hi(.unit_test_end)
+    add r12, #lo(.unit_test_end)
+    cmp r13, r12
+    prne
+    bra .loop
+
+    mov r0, #0
+    swi #.SYS_EXIT
+
+.call
+    mov r12, #hi(.unit_test_data)
+    add r12, #lo(.unit_test_data)
+    ldw r15, [r12]
+}
+
+org 0x1000
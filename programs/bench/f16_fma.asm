@@ -0,0 +1,79 @@
+; Benchmark of .f16_fma against .f16_mul then .f16_add, over the fma unit
+; test vectors - list after programs/semihost.asm and before the test data
+; and libraries, e.g.
+;
+;       ./asm.pl programs/semihost.asm programs/bench/f16_fma.asm \
+;           programs/f16/fma_testdata.asm programs/f16/internal.asm \
+;           programs/f16/fma.asm programs/f16/mul.asm \
+;           programs/f16/add_sub.asm > out/asm.log
+;       ./out/sim -q -A out/asm.log --entry .bench --bench -
+;
+; The regions, f16_fma and f16_mul_add, each include loading the three
+; arguments and the call.
+.bench
+{
+    alias r13 ptr
+
+    mov ptr, #hi(.unit_test_data+2)
+    add ptr, #lo(.unit_test_data+2)
+
+.loop
+    mov r0, #hi(.f16_fma)
+    add r0, #lo(.f16_fma)
+    swi #.SYS_BENCH_START
+    ldw r0, [ptr, #2]
+    ldw r1, [ptr, #4]
+    ldw r2, [ptr, #6]
+    bl .call_fma
+    swi #.SYS_BENCH_STOP
+
+    mov r0, #hi(.f16_mul_add)
+    add r0, #lo(.f16_mul_add)
+    swi #.SYS_BENCH_START
+    ldw r0, [ptr, #2]
+    ldw r1, [ptr, #4]
+    ldw r2, [ptr, #6]
+    bl .f16_mul_add
+    swi #.SYS_BENCH_STOP
+
+    add ptr, #10
+    mov r12, #hi(.unit_test_end)
+    add r12, #lo(.unit_test_end)
+    cmp ptr, r12
+    prne
+    bra .loop
+
+    mov r0, #0
+    swi #.SYS_EXIT
+}
+
+; a * b + c as .f16_mul then .f16_add, rounding twice, for comparison.
+.f16_mul_add
+{
+    alias r10 c
+    alias r11 return
+
+    mov return, r14
+    mov c, r2
+    bl .call_mul
+    mov r0, r2
+    mov r1, c
+    bl .call_add
+    mov r15, return
+}
+
+; The libraries are beyond the reach of bl, after the test data.
+.call_fma
+    mov r12, #hi(.f16_fma)
+    add r12, #lo(.f16_fma)
+    mov r15, r12
+.call_mul
+    mov r12, #hi(.f16_mul)
+    add r12, #lo(.f16_mul)
+    mov r15, r12
+.call_add
+    mov r12, #hi(.f16_add)
+    add r12, #lo(.f16_add)
+    mov r15, r12
+
+org 0x1000
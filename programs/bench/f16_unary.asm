@@ -0,0 +1,64 @@
+; Benchmark of the f16 unary operations - list after programs/semihost.asm
+; and the libraries, e.g.
+;
+;       ./asm.pl programs/semihost.asm programs/f16/internal.asm \
+;           programs/f16/sqrt.asm programs/f16/ftoa.asm programs/f16/atof.asm \
+;           programs/bench/f16_unary.asm > out/asm.log
+;       ./out/sim -q -A out/asm.log --entry .bench --bench -
+;
+; .f16_sqrt, .f16_to_ascii and .f16_parse are each run over a spread of
+; positive finite values, the string parsed being the one just formatted.
+.bench
+{
+    alias r13 sp
+    alias r14 link
+
+    def STEP  17                ; so every exponent is sampled
+    def END   0x7c00            ; +Inf
+    def BUF   0x8000            ; formatted value
+    def STACK 0x9000
+
+    mov sp, #hi(.STACK)
+    add sp, #lo(.STACK)
+    mov r0, #0
+
+.loop
+    stw r0, [sp, #2]            ; the value, kept over the calls
+
+    mov r0, #hi(.f16_sqrt)
+    add r0, #lo(.f16_sqrt)
+    swi #.SYS_BENCH_START
+    ldw r0, [sp, #2]
+    bl .f16_sqrt
+    swi #.SYS_BENCH_STOP
+
+    mov r0, #hi(.f16_to_ascii)
+    add r0, #lo(.f16_to_ascii)
+    swi #.SYS_BENCH_START
+    ldw r0, [sp, #2]
+    mov r1, #hi(.BUF)
+    add r1, #lo(.BUF)
+    bl .f16_to_ascii
+    swi #.SYS_BENCH_STOP
+    mov r0, #0
+    stb r0, [r1]
+
+    mov r0, #hi(.f16_parse)
+    add r0, #lo(.f16_parse)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.BUF)
+    add r0, #lo(.BUF)
+    bl .f16_parse
+    swi #.SYS_BENCH_STOP
+
+    ldw r0, [sp, #2]
+    add r0, #.STEP
+    mov r1, #hi(.END)
+    add r1, #lo(.END)
+    cmp r0, r1
+    prlo
+    bra .loop
+
+    mov r0, #0
+    swi #.SYS_EXIT
+}
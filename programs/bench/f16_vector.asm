@@ -0,0 +1,325 @@
+; Benchmark of the f16 vector routines in programs/f16/vector.asm against
+; loops calling the scalar routines for each element - list after
+; programs/semihost.asm and before the libraries, e.g.
+;
+;       ./asm.pl programs/semihost.asm programs/bench/f16_vector.asm \
+;           programs/f16/internal.asm programs/f16/mul.asm \
+;           programs/f16/add_sub.asm programs/f16/fma.asm \
+;           programs/f16/vector.asm > out/asm.log
+;       ./out/sim -q -A out/asm.log --entry .bench --bench -
+;
+; Each routine, and its loop of scalar calls (.scalar_dot and so on), is run
+; over the first n elements of .signal and .window, for n from 4 to 64 in
+; steps of 4. The regions include the call, but not the copying of the
+; array which .f16_scale and .f16_axpy overwrite.
+def BENCH_STACK     0xfe00
+def BENCH_WORK      0x8000      ; the array overwritten
+def BENCH_SCALE     0x3e00      ; 1.5
+def BENCH_AXPY      0xbc66      ; -1.1
+
+.bench
+{
+    mov r13, #.BENCH_STACK
+    sub r13, #2
+    mov r0, #4
+    stw r0, [r13, #0]           ; n
+
+.loop
+    mov r0, #hi(.f16_dot)
+    add r0, #lo(.f16_dot)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.signal)
+    add r0, #lo(.signal)
+    mov r1, #hi(.window)
+    add r1, #lo(.window)
+    ldw r2, [r13, #0]
+    bl .call_dot
+    swi #.SYS_BENCH_STOP
+
+    mov r0, #hi(.scalar_dot)
+    add r0, #lo(.scalar_dot)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.signal)
+    add r0, #lo(.signal)
+    mov r1, #hi(.window)
+    add r1, #lo(.window)
+    ldw r2, [r13, #0]
+    bl .scalar_dot
+    swi #.SYS_BENCH_STOP
+
+    mov r0, #hi(.f16_sum)
+    add r0, #lo(.f16_sum)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.signal)
+    add r0, #lo(.signal)
+    ldw r1, [r13, #0]
+    bl .call_sum
+    swi #.SYS_BENCH_STOP
+
+    mov r0, #hi(.scalar_sum)
+    add r0, #lo(.scalar_sum)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.signal)
+    add r0, #lo(.signal)
+    ldw r1, [r13, #0]
+    bl .scalar_sum
+    swi #.SYS_BENCH_STOP
+
+    mov r1, #hi(.signal)
+    add r1, #lo(.signal)
+    bl .copy_to_work
+    mov r0, #hi(.f16_scale)
+    add r0, #lo(.f16_scale)
+    swi #.SYS_BENCH_START
+    mov r0, #.BENCH_SCALE
+    mov r1, #.BENCH_WORK
+    ldw r2, [r13, #0]
+    bl .call_scale
+    swi #.SYS_BENCH_STOP
+
+    mov r1, #hi(.signal)
+    add r1, #lo(.signal)
+    bl .copy_to_work
+    mov r0, #hi(.scalar_scale)
+    add r0, #lo(.scalar_scale)
+    swi #.SYS_BENCH_START
+    mov r0, #.BENCH_SCALE
+    mov r1, #.BENCH_WORK
+    ldw r2, [r13, #0]
+    bl .scalar_scale
+    swi #.SYS_BENCH_STOP
+
+    mov r1, #hi(.window)
+    add r1, #lo(.window)
+    bl .copy_to_work
+    mov r0, #hi(.f16_axpy)
+    add r0, #lo(.f16_axpy)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.BENCH_AXPY)
+    add r0, #lo(.BENCH_AXPY)
+    mov r1, #hi(.signal)
+    add r1, #lo(.signal)
+    mov r2, #.BENCH_WORK
+    ldw r3, [r13, #0]
+    bl .call_axpy
+    swi #.SYS_BENCH_STOP
+
+    mov r1, #hi(.window)
+    add r1, #lo(.window)
+    bl .copy_to_work
+    mov r0, #hi(.scalar_axpy)
+    add r0, #lo(.scalar_axpy)
+    swi #.SYS_BENCH_START
+    mov r0, #hi(.BENCH_AXPY)
+    add r0, #lo(.BENCH_AXPY)
+    mov r1, #hi(.signal)
+    add r1, #lo(.signal)
+    mov r2, #.BENCH_WORK
+    ldw r3, [r13, #0]
+    bl .scalar_axpy
+    swi #.SYS_BENCH_STOP
+
+    ldw r0, [r13, #0]
+    add r0, #4
+    stw r0, [r13, #0]
+    mov r1, #64
+    cmp r0, r1
+    prls
+    bra .loop
+
+    mov r0, #0
+    swi #.SYS_EXIT
+}
+
+; Copies the first n elements of the array at r1 to BENCH_WORK.
+.copy_to_work
+{
+    ldw r0, [r13, #0]
+    mov r2, #.BENCH_WORK
+.loop
+    ldw r3, [r1]
+    stw r3, [r2]
+    add r1, #2
+    add r2, #2
+    sub r0, #1
+    prne
+    bra .loop
+    mov r15, r14
+}
+
+; As .f16_dot, by .f16_mul and .f16_add, rounding each product and sum.
+.scalar_dot
+{
+    alias r10 x
+    alias r11 y
+
+    sub r13, #6
+    stw r14, [r13, #0]
+    mov x, r0
+    mov y, r1
+    lsl r2, #1
+    add r2, x
+    stw r2, [r13, #2]           ; the end of x
+    mov r2, #0
+    stw r2, [r13, #4]           ; the sum
+
+.loop
+    ldw r0, [x]
+    ldw r1, [y]
+    add x, #2
+    add y, #2
+    bl .call_mul
+    mov r1, r2
+    ldw r0, [r13, #4]
+    bl .call_add
+    stw r2, [r13, #4]
+    ldw r12, [r13, #2]
+    cmp x, r12
+    prne
+    bra .loop
+
+    ldw r14, [r13, #0]
+    add r13, #6
+    mov r15, r14
+}
+
+; As .f16_sum, by .f16_add.
+.scalar_sum
+{
+    alias r10 x
+    alias r11 end
+
+    sub r13, #2
+    stw r14, [r13, #0]
+    mov x, r0
+    mov end, r1
+    lsl end, #1
+    add end, x
+    mov r2, #0
+
+.loop
+    mov r0, r2
+    ldw r1, [x]
+    add x, #2
+    bl .call_add
+    cmp x, end
+    prne
+    bra .loop
+
+    ldw r14, [r13, #0]
+    add r13, #2
+    mov r15, r14
+}
+
+; As .f16_scale, by .f16_mul.
+.scalar_scale
+{
+    alias r9 s
+    alias r10 x
+    alias r11 end
+
+    sub r13, #2
+    stw r14, [r13, #0]
+    mov s, r0
+    mov x, r1
+    mov end, r2
+    lsl end, #1
+    add end, x
+
+.loop
+    mov r0, s
+    ldw r1, [x]
+    bl .call_mul
+    stw r2, [x]
+    add x, #2
+    cmp x, end
+    prne
+    bra .loop
+
+    ldw r14, [r13, #0]
+    add r13, #2
+    mov r15, r14
+}
+
+; As .f16_axpy, by .f16_mul and .f16_add, rounding each product and sum.
+.scalar_axpy
+{
+    alias r10 x
+    alias r11 y
+
+    sub r13, #6
+    stw r14, [r13, #0]
+    stw r0, [r13, #2]           ; a
+    mov x, r1
+    mov y, r2
+    lsl r3, #1
+    add r3, x
+    stw r3, [r13, #4]           ; the end of x
+
+.loop
+    ldw r0, [r13, #2]
+    ldw r1, [x]
+    bl .call_mul
+    mov r0, r2
+    ldw r1, [y]
+    bl .call_add
+    stw r2, [y]
+    add x, #2
+    add y, #2
+    ldw r12, [r13, #4]
+    cmp x, r12
+    prne
+    bra .loop
+
+    ldw r14, [r13, #0]
+    add r13, #6
+    mov r15, r14
+}
+
+; 0.75 sin(2 pi 3i/64) + 0.2 cos(2 pi 11i/64), and a Hann window, as f16
+.signal
+    dw 0x3266, 0x34fe, 0x34e4, 0x3617, 0x38ee, 0x3afc, 0x3b74, 0x39c2
+    dw 0x3639, 0x3130, 0x2ede, 0x2d31, 0xae8b, 0xb74d, 0xba52, 0xbb27
+    dw 0xba00, 0xb855, 0xb751, 0xb7ed, 0xb78c, 0xb34d, 0x31ee, 0x385c
+    dw 0x3960, 0x38d4, 0x3851, 0x38f5, 0x3a28, 0x3a3b, 0x3839, 0x2fe6
+    dw 0xb266, 0xb4fe, 0xb4e4, 0xb617, 0xb8ee, 0xbafc, 0xbb74, 0xb9c2
+    dw 0xb639, 0xb130, 0xaede, 0xad31, 0x2e8b, 0x374d, 0x3a52, 0x3b27
+    dw 0x3a00, 0x3855, 0x3751, 0x37ed, 0x378c, 0x334d, 0xb1ee, 0xb85c
+    dw 0xb960, 0xb8d4, 0xb851, 0xb8f5, 0xba28, 0xba3b, 0xb839, 0xafe6
+.window
+    dw 0x0000, 0x1917, 0x2113, 0x25b0, 0x2907, 0x2bcb, 0x2d8f, 0x2f7d
+    dw 0x30d4, 0x3206, 0x3352, 0x345a, 0x3514, 0x35d5, 0x369c, 0x3767
+    dw 0x381a, 0x387f, 0x38e4, 0x3946, 0x39a5, 0x3a00, 0x3a56, 0x3aa6
+    dw 0x3aef, 0x3b30, 0x3b6a, 0x3b9b, 0x3bc2, 0x3be0, 0x3bf5, 0x3bff
+    dw 0x3bff, 0x3bf5, 0x3be0, 0x3bc2, 0x3b9b, 0x3b6a, 0x3b30, 0x3aef
+    dw 0x3aa6, 0x3a56, 0x3a00, 0x39a5, 0x3946, 0x38e4, 0x387f, 0x381a
+    dw 0x3767, 0x369c, 0x35d5, 0x3514, 0x345a, 0x3352, 0x3206, 0x30d4
+    dw 0x2f7d, 0x2d8f, 0x2bcb, 0x2907, 0x25b0, 0x2113, 0x1917, 0x0000
+
+; The libraries are beyond the reach of bl.
+.call_mul
+    mov r12, #hi(.f16_mul)
+    add r12, #lo(.f16_mul)
+    mov r15, r12
+.call_add
+    mov r12, #hi(.f16_add)
+    add r12, #lo(.f16_add)
+    mov r15, r12
+.call_dot
+    mov r12, #hi(.f16_dot)
+    add r12, #lo(.f16_dot)
+    mov r15, r12
+.call_sum
+    mov r12, #hi(.f16_sum)
+    add r12, #lo(.f16_sum)
+    mov r15, r12
+.call_scale
+    mov r12, #hi(.f16_scale)
+    add r12, #lo(.f16_scale)
+    mov r15, r12
+.call_axpy
+    mov r12, #hi(.f16_axpy)
+    add r12, #lo(.f16_axpy)
+    mov r15, r12
+
+org 0x1000
@@ -0,0 +1,80 @@
+; Benchmark of the graphics routines in programs/test_card.asm - list
+; after programs/semihost.asm and programs/test_card.asm, e.g.
+;
+;       ./asm.pl programs/semihost.asm programs/test_card.asm \
+;           programs/bench/gfx.asm > out/asm.log
+;       ./out/sim -q -A out/asm.log --entry .bench --bench -
+;
+; .memset clears a range of sizes of screen memory, and .gfx_line draws a
+; star of lines from the centre of the screen, in mode 2 (256x200 4bpp).
+align
+.bench
+{
+    alias r4 ptr
+    alias r5 end
+
+    def CX 128
+    def CY 100
+
+    mov sp, #hi(.USER_TOS)
+    add sp, #lo(.USER_TOS)
+
+    mov r0, #2
+    bl .video_set_mode
+
+    mov ptr, #hi(.sizes)
+    add ptr, #lo(.sizes)
+    mov end, #hi(.sizes_end)
+    add end, #lo(.sizes_end)
+.memset_loop
+    mov r0, #hi(.memset)
+    add r0, #lo(.memset)
+    swi #.SYS_BENCH_START
+    mov tmp, #hi(.WS_VINFO)
+    add tmp, #lo(.WS_VINFO)
+    ldw r0, [tmp, #.VINFO_BASE]
+    mov r1, #0x55
+    ldw r2, [ptr]
+    bl .memset
+    swi #.SYS_BENCH_STOP
+    add ptr, #2
+    cmp ptr, end
+    prne
+    bra .memset_loop
+
+    mov ptr, #hi(.lines)
+    add ptr, #lo(.lines)
+    mov end, #hi(.lines_end)
+    add end, #lo(.lines_end)
+.line_loop
+    mov r0, #.CX
+    mov r1, #.CY
+    bl .gfx_move_to
+    mov r0, #hi(.gfx_line)
+    add r0, #lo(.gfx_line)
+    swi #.SYS_BENCH_START
+    ldw r0, [ptr, #0]
+    ldw r1, [ptr, #2]
+    bl .gfx_line
+    swi #.SYS_BENCH_STOP
+    add ptr, #4
+    cmp ptr, end
+    prne
+    bra .line_loop
+
+    mov r0, #0
+    swi #.SYS_EXIT
+
+.sizes
+    dw 1, 2, 7, 16, 33, 64, 255, 1000, 4096, 25600
+.sizes_end
+
+.lines
+    ;;  dx   dy
+    dw  90,   0,    83,  34,    64,  64,    34,  83
+    dw   0,  90,   -34,  83,   -64,  64,   -83,  34
+    dw -90,   0,   -83, -34,   -64, -64,   -34, -83
+    dw   0, -90,    34, -83,    64, -64,    83, -34
+    dw 200, 150                 ; clipped
+.lines_end
+}
@@ -0,0 +1,52 @@
+; Benchmark of the 32 bit arithmetic in programs/math.asm - list after
+; programs/semihost.asm and programs/math.asm, e.g.
+;
+;       ./asm.pl programs/semihost.asm programs/math.asm \
+;           programs/bench/math.asm > out/asm.log
+;       ./out/sim -q -A out/asm.log --entry .bench --bench -
+;
+; .math_udiv32 and .math_mul32x32 are each run over the operands of
+; .udiv32_test_vectors.
+.bench
+{
+    alias r13 ptr
+
+    mov ptr, #hi(.udiv32_test_vectors)
+    add ptr, #lo(.udiv32_test_vectors)
+
+.loop
+    ldw r2, [ptr, #4]
+    ldw r3, [ptr, #6]
+    orr r2, r2
+    preq
+    orr r3, r3
+    preq
+    bra .done                   ; zero divisor ends the vectors
+
+    mov r0, #hi(.math_udiv32)
+    add r0, #lo(.math_udiv32)
+    swi #.SYS_BENCH_START
+    ldw r0, [ptr, #0]
+    ldw r1, [ptr, #2]
+    ldw r2, [ptr, #4]
+    ldw r3, [ptr, #6]
+    bl .math_udiv32
+    swi #.SYS_BENCH_STOP
+
+    mov r0, #hi(.math_mul32x32)
+    add r0, #lo(.math_mul32x32)
+    swi #.SYS_BENCH_START
+    ldw r0, [ptr, #0]
+    ldw r1, [ptr, #2]
+    ldw r2, [ptr, #4]
+    ldw r3, [ptr, #6]
+    bl .math_mul32x32
+    swi #.SYS_BENCH_STOP
+
+    add ptr, #16
+    bra .loop
+
+.done
+    mov r0, #0
+    swi #.SYS_EXIT
+}
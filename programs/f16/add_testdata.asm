@@ -679,1329 +679,1335 @@
     dw 0x02a2, 0xffff, 0xfe00, 0x7e00   ;   -max_nan   -qnan
     dw 0x02a3, 0xffff, 0xffff, 0x7e00   ;   -max_nan   -max_nan
 
-    ; Random values
-    dw 0x02a4, 0x2069, 0x091a, 0x207d
-    dw 0x02a5, 0xc971, 0x26a5, 0xc96e
-    dw 0x02a6, 0x2dbf, 0x5607, 0x5608
-    dw 0x02a7, 0x51e1, 0xd944, 0xd798
-    dw 0x02a8, 0xecaf, 0xb6ee, 0xecaf
-    dw 0x02a9, 0x5078, 0xeb19, 0xeb07
-    dw 0x02aa, 0xb77f, 0x9517, 0xb784
-    dw 0x02ab, 0xa673, 0x93f2, 0xa6b3
-    dw 0x02ac, 0x9c17, 0xc5bf, 0xc5c0
-    dw 0x02ad, 0x859a, 0x4ae8, 0x4ae8
-    dw 0x02ae, 0x2518, 0xa825, 0xa264
-    dw 0x02af, 0x1b9b, 0xd66f, 0xd66f
-    dw 0x02b0, 0x1dd3, 0xc1f7, 0xc1f4
-    dw 0x02b1, 0x1dcb, 0x827d, 0x1dc1
-    dw 0x02b2, 0x9cd6, 0xb6b8, 0xb6cb
-    dw 0x02b3, 0xa2e6, 0xa5f1, 0xa8b2
-    dw 0x02b4, 0x802a, 0xa12b, 0xa12b
-    dw 0x02b5, 0xcc96, 0xade9, 0xcc9c
-    dw 0x02b6, 0xf733, 0x1e77, 0xf733
-    dw 0x02b7, 0x872e, 0xe3e2, 0xe3e2
-    dw 0x02b8, 0xd565, 0xd7a6, 0xda86
-    dw 0x02b9, 0xcefb, 0x8ce5, 0xcefb
-    dw 0x02ba, 0x6cbd, 0x756e, 0x769d
-    dw 0x02bb, 0x20d7, 0x08d5, 0x20ea
-    dw 0x02bc, 0x3b2e, 0xa671, 0x3afa
-    dw 0x02bd, 0x53bd, 0x6046, 0x60c2
-    dw 0x02be, 0x4e96, 0x6f59, 0x6f60
-    dw 0x02bf, 0x36b6, 0x6c69, 0x6c69
-    dw 0x02c0, 0x3150, 0x5481, 0x5484
-    dw 0x02c1, 0xeee6, 0xce26, 0xeeec
-    dw 0x02c2, 0x0b3a, 0x91cc, 0x8ffb
-    dw 0x02c3, 0x7417, 0x8b64, 0x7417
-    dw 0x02c4, 0x32f7, 0x40ad, 0x411c
-    dw 0x02c5, 0x394d, 0x2a2a, 0x39b0
-    dw 0x02c6, 0x5f25, 0xc07b, 0x5f1c
-    dw 0x02c7, 0x0e0c, 0x348a, 0x348c
-    dw 0x02c8, 0x9822, 0xdd07, 0xdd07
-    dw 0x02c9, 0xc16f, 0x04df, 0xc16f
-    dw 0x02ca, 0x5276, 0xe246, 0xe1df
-    dw 0x02cb, 0x0db4, 0x8da4, 0x0040
-    dw 0x02cc, 0x88b7, 0x6172, 0x6172
-    dw 0x02cd, 0xedea, 0xd74d, 0xee07
-    dw 0x02ce, 0xd0cb, 0x24a0, 0xd0ca
-    dw 0x02cf, 0x43b6, 0x021b, 0x43b6
-    dw 0x02d0, 0x7922, 0x329c, 0x7922
-    dw 0x02d1, 0xd041, 0x845c, 0xd041
-    dw 0x02d2, 0xc468, 0x4459, 0xab80
-    dw 0x02d3, 0x0fc0, 0xf760, 0xf760
-    dw 0x02d4, 0x8506, 0x490d, 0x490d
-    dw 0x02d5, 0x218a, 0xe42b, 0xe42b
-    dw 0x02d6, 0x0989, 0x2f97, 0x2f9a
-    dw 0x02d7, 0x18b6, 0xa1ab, 0xa07e
-    dw 0x02d8, 0x0c9e, 0xda25, 0xda25
-    dw 0x02d9, 0xa68a, 0x5f14, 0x5f14
-    dw 0x02da, 0xbc6c, 0xb43f, 0xbd7c
-    dw 0x02db, 0xecb8, 0x4523, 0xecb7
-    dw 0x02dc, 0x15b1, 0xdaa3, 0xdaa3
-    dw 0x02dd, 0x1c71, 0xe67c, 0xe67c
-    dw 0x02de, 0x6027, 0xe897, 0xe71a
-    dw 0x02df, 0x7865, 0x92c4, 0x7865
-    dw 0x02e0, 0xb8d8, 0x572c, 0x5722
-    dw 0x02e1, 0x0c81, 0x4e8c, 0x4e8c
-    dw 0x02e2, 0x8238, 0x558f, 0x558f
-    dw 0x02e3, 0x7017, 0x6663, 0x70e3
-    dw 0x02e4, 0x5f18, 0x9fae, 0x5f18
-    dw 0x02e5, 0x00c3, 0xac4c, 0xac4c
-    dw 0x02e6, 0x593f, 0xa74d, 0x593f
-    dw 0x02e7, 0x0b61, 0x15ab, 0x1697
-    dw 0x02e8, 0x5b8c, 0xf819, 0xf811
-    dw 0x02e9, 0x5ace, 0x713d, 0x7158
-    dw 0x02ea, 0xd2bc, 0x773f, 0x773c
-    dw 0x02eb, 0x57b9, 0xd200, 0x54b9
-    dw 0x02ec, 0xd767, 0x4050, 0xd744
-    dw 0x02ed, 0x4a65, 0x6a2b, 0x6a31
-    dw 0x02ee, 0xf929, 0x4727, 0xf929
-    dw 0x02ef, 0xc157, 0xf65a, 0xf65a
-    dw 0x02f0, 0x53a8, 0x0fe4, 0x53a8
-    dw 0x02f1, 0x7892, 0xa937, 0x7892
-    dw 0x02f2, 0xdef6, 0x084f, 0xdef6
-    dw 0x02f3, 0x1fa9, 0x5e0f, 0x5e0f
-    dw 0x02f4, 0x0912, 0xcbf5, 0xcbf5
-    dw 0x02f5, 0xb74e, 0xb060, 0xb8bf
-    dw 0x02f6, 0xd756, 0xccf9, 0xd84a
-    dw 0x02f7, 0x0bec, 0xcf70, 0xcf70
-    dw 0x02f8, 0x27c8, 0xa22c, 0x24b2
-    dw 0x02f9, 0x9f07, 0xd4e3, 0xd4e3
-    dw 0x02fa, 0x742c, 0x766e, 0x794d
-    dw 0x02fb, 0x1534, 0xbe92, 0xbe91
-    dw 0x02fc, 0xe099, 0x0e5d, 0xe099
-    dw 0x02fd, 0x05b9, 0xa1f1, 0xa1e6
-    dw 0x02fe, 0x04b7, 0x5961, 0x5961
-    dw 0x02ff, 0xb1d5, 0x0299, 0xb1d5
-    dw 0x0300, 0x31d0, 0x5c40, 0x5c41
-    dw 0x0301, 0x0ae8, 0x5179, 0x5179
-    dw 0x0302, 0xba4f, 0x13fb, 0xba4d
-    dw 0x0303, 0x1d6e, 0x719e, 0x719e
-    dw 0x0304, 0xc45b, 0xf4c5, 0xf4c5
-    dw 0x0305, 0x3e97, 0xd047, 0xd012
-    dw 0x0306, 0xc435, 0x665f, 0x665b
-    dw 0x0307, 0x4d71, 0x6661, 0x6677
-    dw 0x0308, 0x0567, 0x2255, 0x2260
-    dw 0x0309, 0xda8e, 0x7bd5, 0x7bce
-    dw 0x030a, 0x3789, 0x9920, 0x377f
-    dw 0x030b, 0x5c6f, 0x45e6, 0x5c87
-    dw 0x030c, 0x9ed9, 0x4a9d, 0x4a9c
-    dw 0x030d, 0xf83a, 0xb035, 0xf83a
-    dw 0x030e, 0xc7e7, 0xfad3, 0xfad3
-    dw 0x030f, 0xe205, 0x2427, 0xe205
-    dw 0x0310, 0x05bc, 0x337e, 0x337f
-    dw 0x0311, 0xde77, 0x19b7, 0xde77
-    dw 0x0312, 0x50ec, 0x5015, 0x5480
-    dw 0x0313, 0xde12, 0x45b1, 0xddfb
-    dw 0x0314, 0x8eac, 0xae59, 0xae60
-    dw 0x0315, 0x09e6, 0xf50c, 0xf50c
-    dw 0x0316, 0xfbcb, 0x7048, 0xfab9
-    dw 0x0317, 0xfa73, 0x1e20, 0xfa73
-    dw 0x0318, 0x4ad6, 0x7648, 0x7649
-    dw 0x0319, 0x55a9, 0xe3f6, 0xe341
-    dw 0x031a, 0xd2b7, 0x9b8f, 0xd2b7
-    dw 0x031b, 0x82cf, 0xd117, 0xd117
-    dw 0x031c, 0xe62c, 0x7b09, 0x7ad8
-    dw 0x031d, 0x814c, 0xae14, 0xae14
-    dw 0x031e, 0x75dd, 0x6351, 0x7618
-    dw 0x031f, 0xd23b, 0x7b99, 0x7b97
-    dw 0x0320, 0x96cf, 0xb0b2, 0xb0c0
-    dw 0x0321, 0x9550, 0xe7bc, 0xe7bc
-    dw 0x0322, 0x00c7, 0x7362, 0x7362
-    dw 0x0323, 0x2d6d, 0x8f74, 0x2d66
-    dw 0x0324, 0x21bb, 0x3754, 0x3782
-    dw 0x0325, 0x8480, 0x1d86, 0x1d74
-    dw 0x0326, 0xa79c, 0x3ba6, 0x3b69
-    dw 0x0327, 0xf272, 0xf53b, 0xf83a
-    dw 0x0328, 0x914f, 0xd668, 0xd668
-    dw 0x0329, 0xc7f3, 0x2cde, 0xc7e0
-    dw 0x032a, 0x5937, 0x990a, 0x5937
-    dw 0x032b, 0x130b, 0xd440, 0xd440
-    dw 0x032c, 0x1a57, 0xc11f, 0xc11d
-    dw 0x032d, 0x4a1d, 0x935a, 0x4a1d
-    dw 0x032e, 0xc5b6, 0x1478, 0xc5b6
-    dw 0x032f, 0x440d, 0x5b06, 0x5b26
-    dw 0x0330, 0x44d4, 0xce68, 0xcd33
-    dw 0x0331, 0x29a1, 0xd448, 0xd447
-    dw 0x0332, 0xf024, 0x60f5, 0xefa9
-    dw 0x0333, 0x58c8, 0x0daa, 0x58c8
-    dw 0x0334, 0x0891, 0xd7bb, 0xd7bb
-    dw 0x0335, 0x4951, 0xfb03, 0xfb03
-    dw 0x0336, 0xccf7, 0xdaa0, 0xdb3f
-    dw 0x0337, 0xd16b, 0x94ea, 0xd16b
-    dw 0x0338, 0x077f, 0x2aa2, 0x2aa6
-    dw 0x0339, 0x2df4, 0x1a8a, 0x2e28
-    dw 0x033a, 0x484b, 0xdba9, 0xdb64
-    dw 0x033b, 0x4900, 0xc5f4, 0x440c
-    dw 0x033c, 0x6f03, 0x0eb7, 0x6f03
-    dw 0x033d, 0xda6c, 0xb310, 0xda6e
-    dw 0x033e, 0x69bd, 0xd6a0, 0x6988
-    dw 0x033f, 0xf7e5, 0x3826, 0xf7e5
-    dw 0x0340, 0x0041, 0xcc2d, 0xcc2d
-    dw 0x0341, 0x284a, 0x6137, 0x6137
-    dw 0x0342, 0x24f6, 0x35f4, 0x3643
-    dw 0x0343, 0x69c8, 0x64cc, 0x6c17
-    dw 0x0344, 0xc9a8, 0x59e6, 0x598c
-    dw 0x0345, 0x3637, 0x5e92, 0x5e94
-    dw 0x0346, 0x6165, 0x60da, 0x6520
-    dw 0x0347, 0x8c87, 0x7bef, 0x7bef
-    dw 0x0348, 0x5fbd, 0xd4d2, 0x5e88
-    dw 0x0349, 0x5798, 0xa8bd, 0x5797
-    dw 0x034a, 0x9ac6, 0xc69b, 0xc69c
-    dw 0x034b, 0xb774, 0x7532, 0x7532
-    dw 0x034c, 0x79ac, 0x2132, 0x79ac
-    dw 0x034d, 0x4bd2, 0x7191, 0x7193
-    dw 0x034e, 0x5958, 0x4c14, 0x59da
-    dw 0x034f, 0x3dbe, 0x81a2, 0x3dbe
-    dw 0x0350, 0xad4b, 0x62b4, 0x62b4
-    dw 0x0351, 0xb796, 0x1713, 0xb78f
-    dw 0x0352, 0x5f66, 0x36dc, 0x5f68
-    dw 0x0353, 0x7bdf, 0x290e, 0x7bdf
-    dw 0x0354, 0x90c2, 0xb217, 0xb21c
-    dw 0x0355, 0x87a1, 0xf227, 0xf227
-    dw 0x0356, 0x12f1, 0x1428, 0x17a0
-    dw 0x0357, 0x6e16, 0x72ae, 0x74dc
-    dw 0x0358, 0xe8fa, 0xc5ae, 0xe8fd
-    dw 0x0359, 0x1b6b, 0x83c1, 0x1b4d
-    dw 0x035a, 0x8c49, 0xd2e0, 0xd2e0
-    dw 0x035b, 0xf8f3, 0x05f5, 0xf8f3
-    dw 0x035c, 0xf412, 0x44c6, 0xf412
-    dw 0x035d, 0x7786, 0x4d6a, 0x7787
-    dw 0x035e, 0x90da, 0xb545, 0xb547
-    dw 0x035f, 0xcf0c, 0x3e25, 0xceaa
-    dw 0x0360, 0x17f9, 0x86a2, 0x178f
-    dw 0x0361, 0x5538, 0x775f, 0x7764
-    dw 0x0362, 0xbd7e, 0xd118, 0xd144
-    dw 0x0363, 0xa06e, 0x4e40, 0x4e3f
-    dw 0x0364, 0x832f, 0x280f, 0x280d
-    dw 0x0365, 0x4067, 0x9620, 0x4066
-    dw 0x0366, 0x3c37, 0xae7d, 0x3b9e
-    dw 0x0367, 0x08ce, 0x2531, 0x253b
-    dw 0x0368, 0x742b, 0x2439, 0x742b
-    dw 0x0369, 0xa8f2, 0x0075, 0xa8f2
-    dw 0x036a, 0xf719, 0xa1e6, 0xf719
-    dw 0x036b, 0x066a, 0xeb2b, 0xeb2b
-    dw 0x036c, 0xe6ac, 0x3895, 0xe6ab
-    dw 0x036d, 0x7786, 0x3336, 0x7786
-    dw 0x036e, 0x07a1, 0xb5ab, 0xb5ab
-    dw 0x036f, 0x4b2f, 0x8e44, 0x4b2f
-    dw 0x0370, 0x0ae3, 0xc28f, 0xc28f
-    dw 0x0371, 0x4bc2, 0xdbfb, 0xdb7f
-    dw 0x0372, 0x62fd, 0x9a03, 0x62fd
-    dw 0x0373, 0x5f2a, 0x8b0c, 0x5f2a
-    dw 0x0374, 0xda6a, 0xf54a, 0xf557
-    dw 0x0375, 0xc743, 0x88e8, 0xc743
-    dw 0x0376, 0xec74, 0x2252, 0xec74
-    dw 0x0377, 0x9567, 0x196b, 0x156f
-    dw 0x0378, 0x374d, 0x03f3, 0x374d
-    dw 0x0379, 0x0497, 0x1df9, 0x1e0b
-    dw 0x037a, 0x81e4, 0x3d2c, 0x3d2c
-    dw 0x037b, 0x957f, 0xb51a, 0xb51f
-    dw 0x037c, 0x44ce, 0x4b2a, 0x4cc8
-    dw 0x037d, 0x0049, 0xd312, 0xd312
-    dw 0x037e, 0x560d, 0xc2d8, 0x55d6
-    dw 0x037f, 0x1ed4, 0x3209, 0x3240
-    dw 0x0380, 0x25d5, 0xb8d7, 0xb8a8
-    dw 0x0381, 0x9133, 0xb0e1, 0xb0e6
-    dw 0x0382, 0x9342, 0x867e, 0x9409
-    dw 0x0383, 0x7824, 0x1c2a, 0x7824
-    dw 0x0384, 0x8496, 0x6499, 0x6499
-    dw 0x0385, 0x193d, 0xa6e8, 0xa640
-    dw 0x0386, 0xfa00, 0x16c6, 0xfa00
-    dw 0x0387, 0xc054, 0x314d, 0xbffe
-    dw 0x0388, 0x1ab9, 0xc4eb, 0xc4ea
-    dw 0x0389, 0x4f46, 0x9c9d, 0x4f46
-    dw 0x038a, 0x0217, 0xe4c5, 0xe4c5
-    dw 0x038b, 0x51b7, 0x46e5, 0x5294
-    dw 0x038c, 0x2fef, 0x5200, 0x5204
-    dw 0x038d, 0x19f7, 0x85fc, 0x19c7
-    dw 0x038e, 0x14d9, 0x38cc, 0x38ce
-    dw 0x038f, 0xb805, 0x3aae, 0x3552
-    dw 0x0390, 0xf1a3, 0x4939, 0xf1a2
-    dw 0x0391, 0xeb90, 0x84e5, 0xeb90
-    dw 0x0392, 0xcfb7, 0x63b4, 0x6376
-    dw 0x0393, 0xa10f, 0x544d, 0x544d
-    dw 0x0394, 0xc84d, 0xba4d, 0xc8b2
-    dw 0x0395, 0xfb36, 0xc24d, 0xfb36
-    dw 0x0396, 0xd113, 0xbb8a, 0xd131
-    dw 0x0397, 0xf39a, 0xebcc, 0xf4c6
-    dw 0x0398, 0x8075, 0x42e0, 0x42e0
-    dw 0x0399, 0x8869, 0x828c, 0x89af
-    dw 0x039a, 0x27a5, 0xda20, 0xda20
-    dw 0x039b, 0xc972, 0x5794, 0x56e6
-    dw 0x039c, 0x2c20, 0xe369, 0xe369
-    dw 0x039d, 0xdd91, 0x40f9, 0xdd87
-    dw 0x039e, 0x1c35, 0x9596, 0x199f
-    dw 0x039f, 0x7ba8, 0x0dd9, 0x7ba8
-    dw 0x03a0, 0xdecf, 0x6738, 0x6584
-    dw 0x03a1, 0x92be, 0xae86, 0xae93
-    dw 0x03a2, 0xcaec, 0x33ce, 0xcacd
-    dw 0x03a3, 0x02d4, 0x933a, 0x92e0
-    dw 0x03a4, 0xee1b, 0x5587, 0xee05
-    dw 0x03a5, 0xbf2e, 0xb994, 0xc0fc
-    dw 0x03a6, 0x4922, 0xaafa, 0x491b
-    dw 0x03a7, 0x3a09, 0x8c02, 0x3a08
-    dw 0x03a8, 0x3363, 0xbc95, 0xbb51
-    dw 0x03a9, 0xb3a8, 0x0d83, 0xb3a5
-    dw 0x03aa, 0x8607, 0x0b3c, 0x0838
-    dw 0x03ab, 0x39a3, 0x6971, 0x6971
-    dw 0x03ac, 0xe8cd, 0x7a9d, 0x7a50
-    dw 0x03ad, 0x85a6, 0xf645, 0xf645
-    dw 0x03ae, 0x937f, 0x5d33, 0x5d33
-    dw 0x03af, 0x5d7d, 0x263e, 0x5d7d
-    dw 0x03b0, 0x0bba, 0x2869, 0x2871
-    dw 0x03b1, 0x5a0c, 0x0e8e, 0x5a0c
-    dw 0x03b2, 0xbba3, 0x4827, 0x475a
-    dw 0x03b3, 0x0c98, 0x112b, 0x1377
-    dw 0x03b4, 0x0755, 0xc62c, 0xc62c
-    dw 0x03b5, 0x5a4d, 0xb24f, 0x5a4b
-    dw 0x03b6, 0x0035, 0xe64f, 0xe64f
-    dw 0x03b7, 0xe5b2, 0xbcca, 0xe5b3
-    dw 0x03b8, 0x99f7, 0xf335, 0xf335
-    dw 0x03b9, 0x42d2, 0xa534, 0x42c8
-    dw 0x03ba, 0x2cd8, 0xac43, 0x20a8
-    dw 0x03bb, 0x8e01, 0xa775, 0xa78d
-    dw 0x03bc, 0x31e9, 0x0c65, 0x31eb
-    dw 0x03bd, 0x9dba, 0xc569, 0xc56a
-    dw 0x03be, 0x6999, 0xfb37, 0xfadd
-    dw 0x03bf, 0xeba7, 0x7553, 0x745e
-    dw 0x03c0, 0x23a1, 0x45b3, 0x45b7
-    dw 0x03c1, 0x83e1, 0xdf44, 0xdf44
-    dw 0x03c2, 0x8dda, 0x9079, 0x9366
-    dw 0x03c3, 0xf06f, 0x952f, 0xf06f
-    dw 0x03c4, 0x56a5, 0x4abc, 0x577c
-    dw 0x03c5, 0x477e, 0x56da, 0x5752
-    dw 0x03c6, 0x310c, 0x2d30, 0x33a4
-    dw 0x03c7, 0x13a4, 0xcb03, 0xcb03
-    dw 0x03c8, 0x2065, 0x5676, 0x5676
-    dw 0x03c9, 0x7037, 0x4d3d, 0x703a
-    dw 0x03ca, 0x02b9, 0xf4b3, 0xf4b3
-    dw 0x03cb, 0x34a3, 0x0a9e, 0x34a4
-    dw 0x03cc, 0x926d, 0xfa0c, 0xfa0c
-    dw 0x03cd, 0x7437, 0x8da5, 0x7437
-    dw 0x03ce, 0xe5b3, 0xe98a, 0xec32
-    dw 0x03cf, 0xb146, 0x2b66, 0xaed9
-    dw 0x03d0, 0x6d6b, 0x908a, 0x6d6b
-    dw 0x03d1, 0xb940, 0x80fa, 0xb940
-    dw 0x03d2, 0x4e6f, 0x5489, 0x5625
-    dw 0x03d3, 0xcbb6, 0x95ed, 0xcbb6
-    dw 0x03d4, 0xab63, 0xc31d, 0xc33b
-    dw 0x03d5, 0xbf08, 0xc7c6, 0xc8c4
-    dw 0x03d6, 0xe382, 0x157e, 0xe382
-    dw 0x03d7, 0x37fd, 0x30bf, 0x392e
-    dw 0x03d8, 0x1838, 0x3636, 0x363e
-    dw 0x03d9, 0x2572, 0x4cdb, 0x4cdc
-    dw 0x03da, 0x40d5, 0xb7e0, 0x3fb2
-    dw 0x03db, 0x46e7, 0xb50c, 0x4696
-    dw 0x03dc, 0x4585, 0x2c9a, 0x4597
-    dw 0x03dd, 0x9e97, 0xf6cb, 0xf6cb
-    dw 0x03de, 0x5800, 0x0c02, 0x5800
-    dw 0x03df, 0x8755, 0x1140, 0x1055
-    dw 0x03e0, 0x09e7, 0x084f, 0x0d1b
-    dw 0x03e1, 0x5faf, 0x5e70, 0x6310
-    dw 0x03e2, 0xd406, 0xf59c, 0xf5a0
-    dw 0x03e3, 0x09d4, 0xd0c8, 0xd0c8
-    dw 0x03e4, 0xb8b9, 0xc8dc, 0xc928
-    dw 0x03e5, 0x988e, 0x9c3b, 0x9e82
-    dw 0x03e6, 0xde5a, 0xd08c, 0xdeec
-    dw 0x03e7, 0xccfa, 0xf692, 0xf693
-    dw 0x03e8, 0x06c2, 0xf26d, 0xf26d
-    dw 0x03e9, 0x436d, 0x4797, 0x49a7
-    dw 0x03ea, 0xaa4d, 0x8a54, 0xaa53
-    dw 0x03eb, 0xefd2, 0xb6ee, 0xefd2
-    dw 0x03ec, 0x9b3b, 0xe69d, 0xe69d
-    dw 0x03ed, 0x0eee, 0xa73d, 0xa721
-    dw 0x03ee, 0x6df2, 0x202e, 0x6df2
-    dw 0x03ef, 0xb124, 0x7642, 0x7642
-    dw 0x03f0, 0x0f95, 0x4a48, 0x4a48
-    dw 0x03f1, 0x7579, 0x1969, 0x7579
-    dw 0x03f2, 0x1b10, 0x2e32, 0x2e6a
-    dw 0x03f3, 0xe245, 0xb39f, 0xe245
-    dw 0x03f4, 0xca6d, 0xc09f, 0xcb95
-    dw 0x03f5, 0x842b, 0x9768, 0x97ab
-    dw 0x03f6, 0xb732, 0x8aed, 0xb733
-    dw 0x03f7, 0x89d5, 0xfa9f, 0xfa9f
-    dw 0x03f8, 0xd285, 0x3422, 0xd27d
-    dw 0x03f9, 0x84f4, 0xcf29, 0xcf29
-    dw 0x03fa, 0x23f4, 0x3be2, 0x3c01
-    dw 0x03fb, 0x6a64, 0x0a91, 0x6a64
-    dw 0x03fc, 0x4ad1, 0x11a1, 0x4ad1
-    dw 0x03fd, 0x7883, 0x6aff, 0x78f3
-    dw 0x03fe, 0xc2c6, 0xeec5, 0xeec6
-    dw 0x03ff, 0xeadd, 0xd25b, 0xeaf6
-    dw 0x0400, 0x390d, 0x6056, 0x6057
-    dw 0x0401, 0xebc4, 0x541e, 0xeba3
-    dw 0x0402, 0x8e89, 0xce09, 0xce09
-    dw 0x0403, 0x07bd, 0x58f6, 0x58f6
-    dw 0x0404, 0x8ea8, 0x8be8, 0x914e
-    dw 0x0405, 0xf05e, 0x45da, 0xf05d
-    dw 0x0406, 0x16d5, 0x7a33, 0x7a33
-    dw 0x0407, 0x407a, 0xe95a, 0xe959
-    dw 0x0408, 0xae55, 0xc56e, 0xc587
-    dw 0x0409, 0xb883, 0xd249, 0xd25b
-    dw 0x040a, 0x0150, 0x22e7, 0x22ea
-    dw 0x040b, 0xdcda, 0x4c21, 0xdc98
-    dw 0x040c, 0x3489, 0x555e, 0x5563
-    dw 0x040d, 0xb721, 0xf74f, 0xf74f
-    dw 0x040e, 0x4423, 0xa1fe, 0x4420
-    dw 0x040f, 0xc9aa, 0x0254, 0xc9aa
-    dw 0x0410, 0xb56e, 0xd14f, 0xd15a
-    dw 0x0411, 0x90dd, 0x8377, 0x914c
-    dw 0x0412, 0xd90c, 0xe9d4, 0xea25
-    dw 0x0413, 0x121f, 0x64f4, 0x64f4
-    dw 0x0414, 0xda32, 0x57fa, 0xd46a
-    dw 0x0415, 0x7bc9, 0x5466, 0x7bcb
-    dw 0x0416, 0x9874, 0x6524, 0x6524
-    dw 0x0417, 0x02bb, 0x5de2, 0x5de2
-    dw 0x0418, 0x1da7, 0xd505, 0xd505
-    dw 0x0419, 0x5f32, 0x408f, 0x5f3b
-    dw 0x041a, 0xb1df, 0xab54, 0xb3b4
-    dw 0x041b, 0x7518, 0x073d, 0x7518
-    dw 0x041c, 0x6275, 0x6c67, 0x6d36
-    dw 0x041d, 0x4b61, 0x0473, 0x4b61
-    dw 0x041e, 0x3611, 0xc892, 0xc861
-    dw 0x041f, 0x06c7, 0xeb7f, 0xeb7f
-    dw 0x0420, 0x99e1, 0x97a5, 0x9cda
-    dw 0x0421, 0x6ef6, 0x72ed, 0x7534
-    dw 0x0422, 0x8179, 0x8115, 0x828e
-    dw 0x0423, 0xd7e1, 0x5bab, 0x5775
-    dw 0x0424, 0xd90f, 0x53aa, 0xd649
-    dw 0x0425, 0xb011, 0x7183, 0x7183
-    dw 0x0426, 0xb8ce, 0xb2cd, 0xba81
-    dw 0x0427, 0xcf65, 0xd676, 0xd828
-    dw 0x0428, 0x87d2, 0x2e98, 0x2e96
-    dw 0x0429, 0x1705, 0x39b1, 0x39b5
-    dw 0x042a, 0xd9ec, 0x8c1d, 0xd9ec
-    dw 0x042b, 0x40ef, 0x3c61, 0x4320
-    dw 0x042c, 0xf884, 0x8c50, 0xf884
-    dw 0x042d, 0x40d4, 0x2e95, 0x4109
-    dw 0x042e, 0x54e2, 0x479b, 0x555c
-    dw 0x042f, 0x1a14, 0xeec3, 0xeec3
-    dw 0x0430, 0xdf40, 0x890a, 0xdf40
-    dw 0x0431, 0x61b0, 0x60b9, 0x6534
-    dw 0x0432, 0x0a1f, 0x3991, 0x3991
-    dw 0x0433, 0xbc65, 0xe32f, 0xe331
-    dw 0x0434, 0x8d3b, 0x6c76, 0x6c76
-    dw 0x0435, 0x54b2, 0x460a, 0x5513
-    dw 0x0436, 0x1f43, 0x2418, 0x25e9
-    dw 0x0437, 0x1c80, 0xa715, 0xa5f5
-    dw 0x0438, 0x52b0, 0x3385, 0x52b8
-    dw 0x0439, 0xe0c7, 0x2c9c, 0xe0c7
-    dw 0x043a, 0xbfa2, 0x21b6, 0xbf97
-    dw 0x043b, 0x68fd, 0xb826, 0x68fd
-    dw 0x043c, 0xae06, 0xa9d1, 0xb077
-    dw 0x043d, 0xe6bb, 0x02e8, 0xe6bb
-    dw 0x043e, 0xf16c, 0x00cf, 0xf16c
-    dw 0x043f, 0xf1ab, 0xd0ad, 0xf1b0
-    dw 0x0440, 0x89d9, 0x535b, 0x535b
-    dw 0x0441, 0x3166, 0x93f8, 0x315e
-    dw 0x0442, 0x8cec, 0xedcb, 0xedcb
-    dw 0x0443, 0x7727, 0x1a27, 0x7727
-    dw 0x0444, 0x5a42, 0xcbda, 0x59c4
-    dw 0x0445, 0x6031, 0x7985, 0x7996
-    dw 0x0446, 0xeff2, 0x209b, 0xeff2
-    dw 0x0447, 0x42a2, 0xb036, 0x425f
-    dw 0x0448, 0x0162, 0x6f3e, 0x6f3e
-    dw 0x0449, 0x6fd8, 0x2318, 0x6fd8
-    dw 0x044a, 0xd83b, 0x27fe, 0xd83b
-    dw 0x044b, 0xd11e, 0x820c, 0xd11e
-    dw 0x044c, 0x0eb9, 0xd406, 0xd406
-    dw 0x044d, 0x7378, 0x0f88, 0x7378
-    dw 0x044e, 0xc5b1, 0x4425, 0xbe30
-    dw 0x044f, 0x9961, 0x190c, 0x8950
-    dw 0x0450, 0x758c, 0x2d5a, 0x758c
-    dw 0x0451, 0xa5f8, 0x6357, 0x6357
-    dw 0x0452, 0xa481, 0xc01f, 0xc028
-    dw 0x0453, 0xbd99, 0x705b, 0x705b
-    dw 0x0454, 0x2051, 0x371f, 0x3742
-    dw 0x0455, 0x604d, 0x9d02, 0x604d
-    dw 0x0456, 0x57ba, 0xa2ef, 0x57ba
-    dw 0x0457, 0x4d39, 0x591c, 0x59c3
-    dw 0x0458, 0x122d, 0xbd11, 0xbd10
-    dw 0x0459, 0xea68, 0xe510, 0xec78
-    dw 0x045a, 0x4d52, 0x6c74, 0x6c79
-    dw 0x045b, 0xf3c9, 0x2158, 0xf3c9
-    dw 0x045c, 0xdfed, 0x0352, 0xdfed
-    dw 0x045d, 0xe709, 0x2412, 0xe709
-    dw 0x045e, 0x9cb3, 0x0015, 0x9cb3
-    dw 0x045f, 0x999e, 0xca0d, 0xca0d
-    dw 0x0460, 0xa60d, 0x6e8f, 0x6e8f
-    dw 0x0461, 0x662c, 0xba8f, 0x662b
-    dw 0x0462, 0xdeea, 0x867d, 0xdeea
-    dw 0x0463, 0xf1ae, 0x3f38, 0xf1ae
-    dw 0x0464, 0x2380, 0x4968, 0x496a
-    dw 0x0465, 0xe227, 0x70b9, 0x7057
-    dw 0x0466, 0xa284, 0xf455, 0xf455
-    dw 0x0467, 0x2dca, 0x1eb8, 0x2e36
-    dw 0x0468, 0xdebd, 0x12da, 0xdebd
-    dw 0x0469, 0x6c0a, 0x4b32, 0x6c0e
-    dw 0x046a, 0x06a4, 0x8d62, 0x8b72
-    dw 0x046b, 0x2b1f, 0x09f6, 0x2b25
-    dw 0x046c, 0x746b, 0x4f31, 0x746d
-    dw 0x046d, 0xa6a9, 0x7480, 0x7480
-    dw 0x046e, 0xe8d0, 0x70b7, 0x6f06
-    dw 0x046f, 0x1a8d, 0xe5c6, 0xe5c6
-    dw 0x0470, 0xdf46, 0x80ba, 0xdf46
-    dw 0x0471, 0xa055, 0xbe30, 0xbe39
-    dw 0x0472, 0x0737, 0x9204, 0x911d
-    dw 0x0473, 0x2ab7, 0xdb6c, 0xdb6c
-    dw 0x0474, 0xdf90, 0x9b70, 0xdf90
-    dw 0x0475, 0xd3e5, 0xc93b, 0xd49a
-    dw 0x0476, 0x9ca9, 0xb2a2, 0xb2c7
-    dw 0x0477, 0xdc15, 0x08b4, 0xdc15
-    dw 0x0478, 0xe2b9, 0x9616, 0xe2b9
-    dw 0x0479, 0x28f3, 0xecaf, 0xecaf
-    dw 0x047a, 0x0a82, 0x7825, 0x7825
-    dw 0x047b, 0x9359, 0x60f5, 0x60f5
-    dw 0x047c, 0x0410, 0x9990, 0x9970
-    dw 0x047d, 0x46bb, 0xe356, 0xe349
-    dw 0x047e, 0x1a4a, 0xe710, 0xe710
-    dw 0x047f, 0xa186, 0x2181, 0x8280
-    dw 0x0480, 0x7914, 0x9eef, 0x7914
-    dw 0x0481, 0x4c39, 0x5481, 0x558f
-    dw 0x0482, 0xe7a9, 0xd272, 0xe7dd
-    dw 0x0483, 0x5264, 0xb0e4, 0x525f
-    dw 0x0484, 0x6f1b, 0x0506, 0x6f1b
-    dw 0x0485, 0x8cfa, 0x77cf, 0x77cf
-    dw 0x0486, 0x02db, 0x6fb3, 0x6fb3
-    dw 0x0487, 0x0de6, 0x2bce, 0x2bda
-    dw 0x0488, 0x5c63, 0x1868, 0x5c63
-    dw 0x0489, 0xa3f3, 0xefbc, 0xefbc
-    dw 0x048a, 0x976a, 0x04e8, 0x971c
-    dw 0x048b, 0xf3cc, 0x30fa, 0xf3cc
-    dw 0x048c, 0x4ba3, 0xd722, 0xd62e
-    dw 0x048d, 0x4b44, 0x32b4, 0x4b5f
-    dw 0x048e, 0x78a8, 0x6cc6, 0x7941
-    dw 0x048f, 0xabc8, 0x1797, 0xab8b
-    dw 0x0490, 0xb8ff, 0x0049, 0xb8ff
-    dw 0x0491, 0x9616, 0xa0a8, 0xa16b
-    dw 0x0492, 0xd2bb, 0xe87a, 0xe895
-    dw 0x0493, 0x518d, 0x41d7, 0x51ea
-    dw 0x0494, 0xed81, 0xde87, 0xede9
-    dw 0x0495, 0xb9a6, 0xf05c, 0xf05c
-    dw 0x0496, 0x4e3a, 0xc78c, 0x4c57
-    dw 0x0497, 0x1c2a, 0xaa9d, 0xaa18
-    dw 0x0498, 0xdff4, 0xc01e, 0xdffc
-    dw 0x0499, 0x9a59, 0x775f, 0x775f
-    dw 0x049a, 0xc506, 0x8e25, 0xc506
-    dw 0x049b, 0xa859, 0x10aa, 0xa846
-    dw 0x049c, 0x6547, 0xf39e, 0xf2f5
-    dw 0x049d, 0x435e, 0xddf0, 0xdde1
-    dw 0x049e, 0x6064, 0xef26, 0xee9a
-    dw 0x049f, 0xf587, 0x1963, 0xf587
-    dw 0x04a0, 0xef70, 0x8b9e, 0xef70
-    dw 0x04a1, 0xba0b, 0xc22b, 0xc3ae
-    dw 0x04a2, 0x7418, 0x0b98, 0x7418
-    dw 0x04a3, 0x0402, 0x6199, 0x6199
-    dw 0x04a4, 0xea1f, 0xbda9, 0xea20
-    dw 0x04a5, 0x51f5, 0x385a, 0x5206
-    dw 0x04a6, 0x8535, 0x6e20, 0x6e20
-    dw 0x04a7, 0xe2f7, 0x652a, 0x5eba
-    dw 0x04a8, 0x2e3e, 0xdc89, 0xdc89
-    dw 0x04a9, 0xf344, 0x0b76, 0xf344
-    dw 0x04aa, 0x84e2, 0x03ee, 0x80f4
-    dw 0x04ab, 0x70be, 0x7880, 0x79b0
-    dw 0x04ac, 0x474c, 0x4eae, 0x5040
-    dw 0x04ad, 0xd8e4, 0x3673, 0xd8e1
-    dw 0x04ae, 0x4435, 0xf247, 0xf246
-    dw 0x04af, 0x25e3, 0xcfd3, 0xcfd2
-    dw 0x04b0, 0xac53, 0xe80e, 0xe80e
-    dw 0x04b1, 0x43ec, 0xb7eb, 0x42ef
-    dw 0x04b2, 0xec11, 0xa585, 0xec11
-    dw 0x04b3, 0xa20b, 0xa9ba, 0xab3d
-    dw 0x04b4, 0xf77b, 0xda65, 0xf788
-    dw 0x04b5, 0x2eef, 0x659b, 0x659b
-    dw 0x04b6, 0xbd5c, 0x9419, 0xbd5d
-    dw 0x04b7, 0x93d9, 0x3aad, 0x3aab
-    dw 0x04b8, 0x70a2, 0x871d, 0x70a2
-    dw 0x04b9, 0x4624, 0xf585, 0xf585
-    dw 0x04ba, 0x8b0c, 0xb6e2, 0xb6e3
-    dw 0x04bb, 0x6e05, 0xd258, 0x6df8
-    dw 0x04bc, 0x0590, 0x46ea, 0x46ea
-    dw 0x04bd, 0x08cb, 0x49c5, 0x49c5
-    dw 0x04be, 0x3931, 0x2eae, 0x3a07
-    dw 0x04bf, 0x1999, 0xe584, 0xe584
-    dw 0x04c0, 0x16bd, 0x5d85, 0x5d85
-    dw 0x04c1, 0x9d70, 0x02ce, 0x9d65
-    dw 0x04c2, 0x030a, 0x3f7b, 0x3f7b
-    dw 0x04c3, 0xac88, 0xfa85, 0xfa85
-    dw 0x04c4, 0x19e0, 0xdb77, 0xdb77
-    dw 0x04c5, 0x6020, 0xd73c, 0x5e71
-    dw 0x04c6, 0x6f91, 0xf3f9, 0xf030
-    dw 0x04c7, 0x11ea, 0xe033, 0xe033
-    dw 0x04c8, 0x7b17, 0x580e, 0x7b1b
-    dw 0x04c9, 0xd5b8, 0x0623, 0xd5b8
-    dw 0x04ca, 0x0ef0, 0x43be, 0x43be
-    dw 0x04cb, 0xd87b, 0x1480, 0xd87b
-    dw 0x04cc, 0x8aa8, 0xe147, 0xe147
-    dw 0x04cd, 0x5e45, 0xc3d9, 0x5e35
-    dw 0x04ce, 0x0ff5, 0x77de, 0x77de
-    dw 0x04cf, 0xa95e, 0x26b2, 0xa40a
-    dw 0x04d0, 0xd563, 0x46ce, 0xd4f6
-    dw 0x04d1, 0x2980, 0xd86e, 0xd86e
-    dw 0x04d2, 0x8649, 0xd608, 0xd608
-    dw 0x04d3, 0xd2f3, 0xa029, 0xd2f3
-    dw 0x04d4, 0xb180, 0x3314, 0x2a50
-    dw 0x04d5, 0x7765, 0x2111, 0x7765
-    dw 0x04d6, 0x270d, 0x894f, 0x2702
-    dw 0x04d7, 0x0144, 0xa224, 0xa221
-    dw 0x04d8, 0xe15d, 0xd6fd, 0xe23d
-    dw 0x04d9, 0xa847, 0xf04d, 0xf04d
-    dw 0x04da, 0x1abb, 0x80c3, 0x1ab5
-    dw 0x04db, 0x04cd, 0xa563, 0xa55e
-    dw 0x04dc, 0x620a, 0x6313, 0x668e
-    dw 0x04dd, 0x693c, 0x71ff, 0x734e
-    dw 0x04de, 0xdaf1, 0x129a, 0xdaf1
-    dw 0x04df, 0x98b2, 0xb055, 0xb068
-    dw 0x04e0, 0x5968, 0xc232, 0x594f
-    dw 0x04e1, 0x88c3, 0xdfb1, 0xdfb1
-    dw 0x04e2, 0x983b, 0x5bb6, 0x5bb6
-    dw 0x04e3, 0x49bb, 0x8eca, 0x49bb
-    dw 0x04e4, 0xf740, 0x6acc, 0xf666
-    dw 0x04e5, 0xb5d8, 0x808f, 0xb5d8
-    dw 0x04e6, 0x6c10, 0x57fc, 0x6c30
-    dw 0x04e7, 0x61ed, 0x430d, 0x61f4
-    dw 0x04e8, 0x0044, 0x523a, 0x523a
-    dw 0x04e9, 0x5dc8, 0x8107, 0x5dc8
-    dw 0x04ea, 0x5708, 0x032b, 0x5708
-    dw 0x04eb, 0xe311, 0xba1b, 0xe313
-    dw 0x04ec, 0x6c68, 0x5510, 0x6c7c
-    dw 0x04ed, 0x950c, 0xedc2, 0xedc2
-    dw 0x04ee, 0x4561, 0xd86b, 0xd840
-    dw 0x04ef, 0xaff5, 0xce24, 0xce2c
-    dw 0x04f0, 0xb81c, 0x4830, 0x47dc
-    dw 0x04f1, 0x29db, 0x37f7, 0x3859
-    dw 0x04f2, 0x91eb, 0xb8a5, 0xb8a6
-    dw 0x04f3, 0x2f37, 0x6e7d, 0x6e7d
-    dw 0x04f4, 0xafc6, 0x68c7, 0x68c7
-    dw 0x04f5, 0xc67a, 0x11b3, 0xc67a
-    dw 0x04f6, 0xabd5, 0xc6be, 0xc6ce
-    dw 0x04f7, 0x63ee, 0x099d, 0x63ee
-    dw 0x04f8, 0x47c5, 0xbaf6, 0x46e6
-    dw 0x04f9, 0x0cc9, 0x2ad6, 0x2ae0
-    dw 0x04fa, 0x7511, 0x7931, 0x7bba
-    dw 0x04fb, 0x0a1d, 0xf833, 0xf833
-    dw 0x04fc, 0x6da9, 0x4f7f, 0x6db0
-    dw 0x04fd, 0xd09e, 0x1d9e, 0xd09e
-    dw 0x04fe, 0x1da3, 0x88bb, 0x1d7d
-    dw 0x04ff, 0x65ce, 0x477e, 0x65d5
-    dw 0x0500, 0xc0b2, 0xf7b9, 0xf7b9
-    dw 0x0501, 0x0024, 0xefe9, 0xefe9
-    dw 0x0502, 0xf470, 0x6ea1, 0xf190
-    dw 0x0503, 0x9faf, 0x5d37, 0x5d37
-    dw 0x0504, 0x351b, 0xb163, 0x30d3
-    dw 0x0505, 0x090c, 0xfbd9, 0xfbd9
-    dw 0x0506, 0x1551, 0x12aa, 0x1853
-    dw 0x0507, 0x439e, 0xd047, 0xcf9a
-    dw 0x0508, 0x1f73, 0x6e74, 0x6e74
-    dw 0x0509, 0x4558, 0x98a4, 0x4557
-    dw 0x050a, 0xee5b, 0x4f75, 0xee54
-    dw 0x050b, 0x90d7, 0x5c04, 0x5c04
-    dw 0x050c, 0x9ef4, 0x6176, 0x6176
-    dw 0x050d, 0x79a2, 0xbc98, 0x79a2
-    dw 0x050e, 0xea31, 0xdf70, 0xeb1f
-    dw 0x050f, 0x0416, 0xaae3, 0xaae1
-    dw 0x0510, 0xd729, 0x043a, 0xd729
-    dw 0x0511, 0x9acc, 0xcb99, 0xcb99
-    dw 0x0512, 0x72dc, 0x3a7b, 0x72dc
-    dw 0x0513, 0x28d0, 0xa7f7, 0x1ea4
-    dw 0x0514, 0xebde, 0x31dd, 0xebde
-    dw 0x0515, 0xa3d1, 0x012f, 0xa3cf
-    dw 0x0516, 0x4487, 0xe76f, 0xe76a
-    dw 0x0517, 0xd176, 0x63fa, 0x63a3
-    dw 0x0518, 0x55e4, 0x16ce, 0x55e4
-    dw 0x0519, 0x443f, 0x6644, 0x6648
-    dw 0x051a, 0x8d75, 0xa043, 0xa06f
-    dw 0x051b, 0x0538, 0xeeeb, 0xeeeb
-    dw 0x051c, 0x19e5, 0xc1d0, 0xc1cf
-    dw 0x051d, 0xd91c, 0xf955, 0xf95a
-    dw 0x051e, 0xc5e7, 0x83ff, 0xc5e7
-    dw 0x051f, 0xd07e, 0xca21, 0xd206
-    dw 0x0520, 0x1ecb, 0x9c17, 0x1968
-    dw 0x0521, 0x3cfd, 0x5947, 0x5951
-    dw 0x0522, 0xc4e7, 0xe4f5, 0xe4fa
-    dw 0x0523, 0x4525, 0xf6c4, 0xf6c4
-    dw 0x0524, 0x88c6, 0x4655, 0x4655
-    dw 0x0525, 0x3b4b, 0x7035, 0x7035
-    dw 0x0526, 0x17cb, 0x9f45, 0x9d52
-    dw 0x0527, 0xc619, 0x2e9a, 0xc5ff
-    dw 0x0528, 0x9be3, 0x0a58, 0x9b7e
-    dw 0x0529, 0x94de, 0x2959, 0x2932
-    dw 0x052a, 0xaa9b, 0x9a16, 0xaafc
-    dw 0x052b, 0x1844, 0xc480, 0xc47f
-    dw 0x052c, 0x5be7, 0xf161, 0xf141
-    dw 0x052d, 0xbdd5, 0x21ce, 0xbdc9
-    dw 0x052e, 0x7560, 0x8e53, 0x7560
-    dw 0x052f, 0xebef, 0x942c, 0xebef
-    dw 0x0530, 0x2a6a, 0x28ed, 0x2dac
-    dw 0x0531, 0xed73, 0xef52, 0xf262
-    dw 0x0532, 0x0de2, 0x3298, 0x329b
-    dw 0x0533, 0xe616, 0x96a8, 0xe616
-    dw 0x0534, 0x78ed, 0x2162, 0x78ed
-    dw 0x0535, 0x06dd, 0x90b9, 0x8fbb
-    dw 0x0536, 0xc0a7, 0xccf7, 0xcd8c
-    dw 0x0537, 0xbf53, 0x5c8b, 0x5c84
-    dw 0x0538, 0xd74f, 0x5431, 0xd23c
-    dw 0x0539, 0x85e4, 0x81eb, 0x87cf
-    dw 0x053a, 0xee47, 0x9e28, 0xee47
-    dw 0x053b, 0x466b, 0x4a2e, 0x4cb2
-    dw 0x053c, 0x8f89, 0x0441, 0x8e79
-    dw 0x053d, 0x6bfc, 0x04ea, 0x6bfc
-    dw 0x053e, 0x9294, 0x57ec, 0x57ec
-    dw 0x053f, 0x9916, 0xbcff, 0xbd02
-    dw 0x0540, 0x80d9, 0x8689, 0x8762
-    dw 0x0541, 0xac51, 0x8ebb, 0xac58
-    dw 0x0542, 0xb921, 0x9267, 0xb923
-    dw 0x0543, 0x2563, 0x320f, 0x32bb
-    dw 0x0544, 0xb3c9, 0x2c40, 0xb1a9
-    dw 0x0545, 0xc2c8, 0x7471, 0x7471
-    dw 0x0546, 0xf937, 0x821b, 0xf937
-    dw 0x0547, 0xd0fc, 0xd087, 0xd4c2
-    dw 0x0548, 0xd64c, 0x56e0, 0x48a0
-    dw 0x0549, 0x5272, 0xc493, 0x51e0
-    dw 0x054a, 0xf508, 0x98dd, 0xf508
-    dw 0x054b, 0x0ec2, 0x8492, 0x0d9e
-    dw 0x054c, 0x9d1e, 0x7abe, 0x7abe
-    dw 0x054d, 0x897c, 0x2fb3, 0x2fb0
-    dw 0x054e, 0xd2aa, 0x2292, 0xd2aa
-    dw 0x054f, 0xecb2, 0x5383, 0xeca3
-    dw 0x0550, 0xa91b, 0x9903, 0xa96b
-    dw 0x0551, 0xe23e, 0x623c, 0xbc00
-    dw 0x0552, 0x2b6a, 0x07a1, 0x2b6e
-    dw 0x0553, 0x944b, 0xdf34, 0xdf34
-    dw 0x0554, 0x33e2, 0x5713, 0x5717
-    dw 0x0555, 0x53a5, 0x2d19, 0x53a8
-    dw 0x0556, 0xd92e, 0x24a1, 0xd92e
-    dw 0x0557, 0xaf7a, 0x7b81, 0x7b81
-    dw 0x0558, 0x5012, 0x740e, 0x7410
-    dw 0x0559, 0x7089, 0xe8f0, 0x6e9a
-    dw 0x055a, 0x82d0, 0xf51b, 0xf51b
-    dw 0x055b, 0x860e, 0xb5c1, 0xb5c1
-    dw 0x055c, 0xd039, 0xa129, 0xd039
-    dw 0x055d, 0xa273, 0x23bc, 0x1924
-    dw 0x055e, 0x4a44, 0x3b76, 0x4abb
-    dw 0x055f, 0x05fb, 0xac81, 0xac80
-    dw 0x0560, 0x66e1, 0x0d9c, 0x66e1
-    dw 0x0561, 0x40cc, 0x4615, 0x483e
-    dw 0x0562, 0x417e, 0x97e0, 0x417d
-    dw 0x0563, 0x99ba, 0x6e98, 0x6e98
-    dw 0x0564, 0x710e, 0xbe5b, 0x710e
-    dw 0x0565, 0x6c38, 0x2089, 0x6c38
-    dw 0x0566, 0x39dc, 0xbc4b, 0xb574
-    dw 0x0567, 0x9497, 0xaa65, 0xaa8a
-    dw 0x0568, 0xa53b, 0x1767, 0xa4c5
-    dw 0x0569, 0x9f81, 0x2b49, 0x2a59
-    dw 0x056a, 0x14f5, 0x1e18, 0x1f55
-    dw 0x056b, 0xe10b, 0xe52e, 0xe7b4
-    dw 0x056c, 0xbf42, 0x837e, 0xbf42
-    dw 0x056d, 0x08eb, 0x0986, 0x0d38
-    dw 0x056e, 0xbef5, 0x0ee6, 0xbef5
-    dw 0x056f, 0xb607, 0x25d6, 0xb5aa
-    dw 0x0570, 0x1c82, 0xf6d4, 0xf6d4
-    dw 0x0571, 0x6beb, 0x5e01, 0x6c56
-    dw 0x0572, 0x8eb4, 0x05a5, 0x8d4b
-    dw 0x0573, 0xcc99, 0xc400, 0xcd99
-    dw 0x0574, 0x38d1, 0x204b, 0x38e2
-    dw 0x0575, 0xf51c, 0xb4e2, 0xf51c
-    dw 0x0576, 0xa841, 0x9a57, 0xa8a6
-    dw 0x0577, 0xcc49, 0x47c2, 0xc8b1
-    dw 0x0578, 0xc5a1, 0xe13f, 0xe14a
-    dw 0x0579, 0x65db, 0xa6ac, 0x65db
-    dw 0x057a, 0xc66d, 0x251d, 0xc668
-    dw 0x057b, 0x2a2a, 0xcf58, 0xcf55
-    dw 0x057c, 0x2ea3, 0xe91f, 0xe91f
-    dw 0x057d, 0xde3e, 0xe4ab, 0xe63a
-    dw 0x057e, 0x0ef5, 0xfac1, 0xfac1
-    dw 0x057f, 0xdb7f, 0x7ae0, 0x7ad9
-    dw 0x0580, 0x58c2, 0x6a33, 0x6a7f
-    dw 0x0581, 0x8085, 0x255b, 0x255a
-    dw 0x0582, 0x69f5, 0x4485, 0x69f7
-    dw 0x0583, 0x5e2c, 0x8a41, 0x5e2c
-    dw 0x0584, 0x4261, 0x5349, 0x53af
-    dw 0x0585, 0x3f23, 0xeaa3, 0xeaa2
-    dw 0x0586, 0xeda0, 0x0b6d, 0xeda0
-    dw 0x0587, 0x3265, 0xb341, 0xa6e0
-    dw 0x0588, 0xecac, 0x9840, 0xecac
-    dw 0x0589, 0x59ed, 0xb319, 0x59eb
-    dw 0x058a, 0xbd5d, 0x8418, 0xbd5d
-    dw 0x058b, 0x8272, 0xec01, 0xec01
-    dw 0x058c, 0x6d37, 0x60b0, 0x6dcd
-    dw 0x058d, 0xd0ac, 0x5b71, 0x5a46
-    dw 0x058e, 0xac2b, 0xf70d, 0xf70d
-    dw 0x058f, 0xb433, 0x165e, 0xb42d
-    dw 0x0590, 0x7793, 0xd98e, 0x7788
-    dw 0x0591, 0x8053, 0xbc18, 0xbc18
-    dw 0x0592, 0x37bb, 0x0a94, 0x37bc
-    dw 0x0593, 0x8b04, 0x49b8, 0x49b8
-    dw 0x0594, 0xe91d, 0x78a4, 0x7852
-    dw 0x0595, 0x5525, 0x1b82, 0x5525
-    dw 0x0596, 0x2be6, 0x41d1, 0x41f1
-    dw 0x0597, 0xb3c3, 0x85d3, 0xb3c4
-    dw 0x0598, 0xf4ea, 0x7120, 0xf0b4
-    dw 0x0599, 0x09eb, 0x775c, 0x775c
-    dw 0x059a, 0x5d21, 0x7723, 0x7738
-    dw 0x059b, 0xd80d, 0x2dcd, 0xd80c
-    dw 0x059c, 0xf350, 0x337e, 0xf350
-    dw 0x059d, 0xd9f8, 0xea5d, 0xeabc
-    dw 0x059e, 0xe7b2, 0xf056, 0xf14c
-    dw 0x059f, 0x61f0, 0xc140, 0x61eb
-    dw 0x05a0, 0x70aa, 0x1e09, 0x70aa
-    dw 0x05a1, 0xf8fb, 0x7b3e, 0x7486
-    dw 0x05a2, 0x1c83, 0x83ff, 0x1c73
-    dw 0x05a3, 0xc4f6, 0x05a0, 0xc4f6
-    dw 0x05a4, 0x1a1b, 0x2122, 0x22a9
-    dw 0x05a5, 0x288a, 0x5bec, 0x5bec
-    dw 0x05a6, 0xd4e5, 0xae5d, 0xd4e7
-    dw 0x05a7, 0x50d7, 0x4606, 0x5198
-    dw 0x05a8, 0xb849, 0xc833, 0xc878
-    dw 0x05a9, 0xa327, 0x2f6c, 0x2e87
-    dw 0x05aa, 0xa040, 0xd0f5, 0xd0f5
-    dw 0x05ab, 0x22bc, 0xd3bf, 0xd3bf
-    dw 0x05ac, 0xaaed, 0x0d19, 0xaae3
-    dw 0x05ad, 0xbb71, 0x9b44, 0xbb78
-    dw 0x05ae, 0x6f0a, 0x0bee, 0x6f0a
-    dw 0x05af, 0x8d13, 0x75ad, 0x75ad
-    dw 0x05b0, 0x872c, 0xa996, 0xa99a
-    dw 0x05b1, 0xf9ac, 0x4c23, 0xf9ab
-    dw 0x05b2, 0xaf36, 0xf650, 0xf650
-    dw 0x05b3, 0x663e, 0xd058, 0x661b
-    dw 0x05b4, 0x1eda, 0xc22b, 0xc228
-    dw 0x05b5, 0xa53e, 0xcd38, 0xcd39
-    dw 0x05b6, 0x1302, 0xeb44, 0xeb44
-    dw 0x05b7, 0x8581, 0xdb35, 0xdb35
-    dw 0x05b8, 0x8e6b, 0xb4ed, 0xb4ef
-    dw 0x05b9, 0x7b76, 0x5f60, 0x7b85
-    dw 0x05ba, 0xd7a9, 0x4f35, 0xd5dc
-    dw 0x05bb, 0x0a4e, 0xe4c2, 0xe4c2
-    dw 0x05bc, 0x0aa6, 0xa592, 0xa585
-    dw 0x05bd, 0x53cc, 0x8757, 0x53cc
-    dw 0x05be, 0xb180, 0xe0df, 0xe0df
-    dw 0x05bf, 0x38ac, 0x8a75, 0x38ac
-    dw 0x05c0, 0xf6b1, 0x84cf, 0xf6b1
-    dw 0x05c1, 0x39ab, 0xed01, 0xed01
-    dw 0x05c2, 0xeb0e, 0x0a04, 0xeb0e
-    dw 0x05c3, 0x0bdc, 0xad39, 0xad35
-    dw 0x05c4, 0xaf42, 0xd914, 0xd915
-    dw 0x05c5, 0xc03b, 0x9a86, 0xc03d
-    dw 0x05c6, 0x5e95, 0x9b70, 0x5e95
-    dw 0x05c7, 0x28f1, 0x1382, 0x290f
-    dw 0x05c8, 0x16e6, 0x8852, 0x165c
-    dw 0x05c9, 0xeb2b, 0x661b, 0xe81e
-    dw 0x05ca, 0x92a0, 0xcfed, 0xcfed
-    dw 0x05cb, 0x70c1, 0x3832, 0x70c1
-    dw 0x05cc, 0x23ba, 0xf819, 0xf819
-    dw 0x05cd, 0xe9b2, 0x0499, 0xe9b2
-    dw 0x05ce, 0xf51d, 0x225e, 0xf51d
-    dw 0x05cf, 0x8f0f, 0xebce, 0xebce
-    dw 0x05d0, 0xa72e, 0xc8ba, 0xc8be
-    dw 0x05d1, 0xd8d0, 0x923c, 0xd8d0
-    dw 0x05d2, 0xd2be, 0xe4ac, 0xe4e2
-    dw 0x05d3, 0x3f75, 0x8200, 0x3f75
-    dw 0x05d4, 0xbdc0, 0x1c86, 0xbdbb
-    dw 0x05d5, 0x1c55, 0x9b20, 0x1228
-    dw 0x05d6, 0x4578, 0x2fd7, 0x4597
-    dw 0x05d7, 0xb207, 0xcdca, 0xcdd6
-    dw 0x05d8, 0x1b02, 0x1822, 0x1d92
-    dw 0x05d9, 0x606a, 0xeaef, 0xe9d4
-    dw 0x05da, 0x88e4, 0x989c, 0x98ea
-    dw 0x05db, 0x0ea9, 0x80fd, 0x0e6a
-    dw 0x05dc, 0x824e, 0x1343, 0x12f9
-    dw 0x05dd, 0x761a, 0xa4ac, 0x761a
-    dw 0x05de, 0xa252, 0x61e9, 0x61e9
-    dw 0x05df, 0x4bda, 0x6b0c, 0x6b14
-    dw 0x05e0, 0x3ab9, 0xde16, 0xde13
-    dw 0x05e1, 0x3dcb, 0x1f65, 0x3dd2
-    dw 0x05e2, 0x1d8b, 0xbfcb, 0xbfc5
-    dw 0x05e3, 0xdd25, 0x1d3b, 0xdd25
-    dw 0x05e4, 0xdc52, 0xf97a, 0xf983
-    dw 0x05e5, 0xb85c, 0x21ca, 0xb845
-    dw 0x05e6, 0x2951, 0x6a63, 0x6a63
-    dw 0x05e7, 0xef94, 0x4453, 0xef93
-    dw 0x05e8, 0x8285, 0x4ffe, 0x4ffe
-    dw 0x05e9, 0x2f42, 0x0b69, 0x2f46
-    dw 0x05ea, 0xe89a, 0x3dec, 0xe899
-    dw 0x05eb, 0x8c66, 0x6ae8, 0x6ae8
-    dw 0x05ec, 0x512f, 0x0281, 0x512f
-    dw 0x05ed, 0x0f94, 0xf381, 0xf381
-    dw 0x05ee, 0x646a, 0x5b6f, 0x6558
-    dw 0x05ef, 0x5e8d, 0x9f23, 0x5e8d
-    dw 0x05f0, 0x3985, 0x9c58, 0x397c
-    dw 0x05f1, 0xbe88, 0x5711, 0x56f7
-    dw 0x05f2, 0x5c24, 0x9bad, 0x5c24
-    dw 0x05f3, 0x744c, 0x3876, 0x744c
-    dw 0x05f4, 0x9527, 0x2ca8, 0x2c93
-    dw 0x05f5, 0x5a40, 0xbe78, 0x5a33
-    dw 0x05f6, 0x970b, 0x49d4, 0x49d4
-    dw 0x05f7, 0x02cb, 0x1991, 0x19a7
-    dw 0x05f8, 0x99d2, 0x320d, 0x31f6
-    dw 0x05f9, 0x24fa, 0x826c, 0x24f8
-    dw 0x05fa, 0x6ff9, 0xb161, 0x6ff9
-    dw 0x05fb, 0xed54, 0xc128, 0xed55
-    dw 0x05fc, 0xb3e2, 0xb4a9, 0xb84d
-    dw 0x05fd, 0x184c, 0x5857, 0x5857
-    dw 0x05fe, 0x1337, 0xb76f, 0xb76b
-    dw 0x05ff, 0x91dd, 0xaf8f, 0xaf9b
-    dw 0x0600, 0x75f7, 0xe8ee, 0x7559
-    dw 0x0601, 0x0bb3, 0x11a4, 0x1391
-    dw 0x0602, 0x5d3a, 0x4429, 0x5d4b
-    dw 0x0603, 0xa6cb, 0x89e3, 0xa6d7
-    dw 0x0604, 0x9e69, 0x6543, 0x6543
-    dw 0x0605, 0x20ee, 0xe83d, 0xe83d
-    dw 0x0606, 0x680e, 0x3a7f, 0x680e
-    dw 0x0607, 0x820f, 0x9a1b, 0x9a2b
-    dw 0x0608, 0x5f7a, 0x047b, 0x5f7a
-    dw 0x0609, 0x0a15, 0x10db, 0x1260
-    dw 0x060a, 0xf1cf, 0xcb3d, 0xf1d1
-    dw 0x060b, 0xc4bd, 0xeeb8, 0xeeb9
-    dw 0x060c, 0xdd09, 0x470f, 0xdced
-    dw 0x060d, 0x931e, 0x9478, 0x9804
-    dw 0x060e, 0xd8ec, 0x42ad, 0xd8d1
-    dw 0x060f, 0x0a6f, 0xc1da, 0xc1da
-    dw 0x0610, 0x4e61, 0x1c13, 0x4e61
-    dw 0x0611, 0x1f15, 0x928a, 0x1e44
-    dw 0x0612, 0xc2de, 0xa8f8, 0xc2f2
-    dw 0x0613, 0x30f4, 0x2821, 0x31fc
-    dw 0x0614, 0xc9e6, 0x1931, 0xc9e6
-    dw 0x0615, 0x902f, 0x0466, 0x8f44
-    dw 0x0616, 0x9b41, 0x2a4a, 0x29d6
-    dw 0x0617, 0x63e0, 0x9fbc, 0x63e0
-    dw 0x0618, 0x345f, 0x74bb, 0x74bb
-    dw 0x0619, 0x918c, 0x3978, 0x3977
-    dw 0x061a, 0x8044, 0x1681, 0x167d
-    dw 0x061b, 0xc753, 0x12a2, 0xc753
-    dw 0x061c, 0xaaf9, 0xa040, 0xac04
-    dw 0x061d, 0x554f, 0xb568, 0x554a
-    dw 0x061e, 0x621a, 0xa3b0, 0x621a
-    dw 0x061f, 0xd17b, 0x812f, 0xd17b
-    dw 0x0620, 0x363b, 0x9459, 0x3637
-    dw 0x0621, 0x2a27, 0x672f, 0x672f
-    dw 0x0622, 0xbc7a, 0xf40e, 0xf40e
-    dw 0x0623, 0x8060, 0x4ca9, 0x4ca9
-    dw 0x0624, 0xf874, 0x1ba1, 0xf874
-    dw 0x0625, 0x76f3, 0x5c54, 0x7704
-    dw 0x0626, 0xbb5e, 0xab53, 0xbbd3
-    dw 0x0627, 0xd10f, 0x4cea, 0xcd34
-    dw 0x0628, 0xaaf0, 0x0a87, 0xaae9
-    dw 0x0629, 0xcd2e, 0x2a74, 0xcd2b
-    dw 0x062a, 0x2108, 0x9481, 0x2078
-    dw 0x062b, 0x3d16, 0xcc01, 0xcb5f
-    dw 0x062c, 0x34c1, 0x9265, 0x34be
-    dw 0x062d, 0x8169, 0x96dc, 0x96f3
-    dw 0x062e, 0x3616, 0x52e4, 0x52f0
-    dw 0x062f, 0x180b, 0x6c51, 0x6c51
-    dw 0x0630, 0xe73d, 0x4233, 0xe73a
-    dw 0x0631, 0xd380, 0xa3b7, 0xd380
-    dw 0x0632, 0x3641, 0x53e0, 0x53ed
-    dw 0x0633, 0xf060, 0x2eb5, 0xf060
-    dw 0x0634, 0x6f82, 0x6753, 0x70ab
-    dw 0x0635, 0x8b09, 0x2ae0, 0x2ad9
-    dw 0x0636, 0x12a6, 0x5c18, 0x5c18
-    dw 0x0637, 0x77ca, 0xbd96, 0x77ca
-    dw 0x0638, 0x669f, 0x44f8, 0x66a4
-    dw 0x0639, 0xe80a, 0x87a7, 0xe80a
-    dw 0x063a, 0xd979, 0x2520, 0xd979
-    dw 0x063b, 0x53a8, 0x0e3b, 0x53a8
-    dw 0x063c, 0xb786, 0xd511, 0xd519
-    dw 0x063d, 0xa517, 0xed9c, 0xed9c
-    dw 0x063e, 0x27f5, 0xbd22, 0xbd02
-    dw 0x063f, 0x59ed, 0x0f32, 0x59ed
-    dw 0x0640, 0x2d6d, 0xb2e9, 0xb032
-    dw 0x0641, 0x3596, 0x814d, 0x3596
-    dw 0x0642, 0xa349, 0x644b, 0x644b
-    dw 0x0643, 0xf0cf, 0x0a9c, 0xf0cf
-    dw 0x0644, 0xef54, 0x1baf, 0xef54
-    dw 0x0645, 0x1d43, 0x4b6c, 0x4b6d
-    dw 0x0646, 0x9379, 0xdad9, 0xdad9
-    dw 0x0647, 0xb20b, 0xd871, 0xd873
-    dw 0x0648, 0xc2e4, 0x39b2, 0xc178
-    dw 0x0649, 0xb1eb, 0xe804, 0xe804
-    dw 0x064a, 0x8d5a, 0xc026, 0xc026
-    dw 0x064b, 0x9f8a, 0x626b, 0x626b
-    dw 0x064c, 0x653d, 0x8d26, 0x653d
-    dw 0x064d, 0x8a60, 0x225f, 0x2246
-    dw 0x064e, 0xe713, 0x9992, 0xe713
-    dw 0x064f, 0x21b5, 0x1480, 0x2245
-    dw 0x0650, 0x4c7b, 0x574b, 0x5835
-    dw 0x0651, 0x95ce, 0xefc4, 0xefc4
-    dw 0x0652, 0xbb97, 0x869d, 0xbb97
-    dw 0x0653, 0xfa61, 0xaaeb, 0xfa61
-    dw 0x0654, 0xa24d, 0x17a4, 0xa158
-    dw 0x0655, 0xf658, 0x35c6, 0xf658
-    dw 0x0656, 0xf27d, 0xa863, 0xf27d
-    dw 0x0657, 0x0e38, 0xb561, 0xb55f
-    dw 0x0658, 0xe216, 0xc023, 0xe21a
-    dw 0x0659, 0x9d66, 0x6f70, 0x6f70
-    dw 0x065a, 0x8049, 0x3cf0, 0x3cf0
-    dw 0x065b, 0xd1dc, 0xe586, 0xe5b5
-    dw 0x065c, 0xca17, 0x5c3c, 0x5c0b
-    dw 0x065d, 0x07e5, 0xb12a, 0xb129
-    dw 0x065e, 0xf5cf, 0x299a, 0xf5cf
-    dw 0x065f, 0xc5ab, 0x424a, 0xc10c
-    dw 0x0660, 0x80e6, 0x5b79, 0x5b79
-    dw 0x0661, 0x320f, 0x3c7d, 0x3d3f
-    dw 0x0662, 0xe216, 0x2c70, 0xe216
-    dw 0x0663, 0xe768, 0x8463, 0xe768
-    dw 0x0664, 0x4414, 0xddc0, 0xddb0
-    dw 0x0665, 0xba2a, 0x3691, 0xb5c3
-    dw 0x0666, 0x8624, 0xc862, 0xc862
-    dw 0x0667, 0xebf3, 0x683a, 0xe772
-    dw 0x0668, 0x8885, 0x8959, 0x8cef
-    dw 0x0669, 0xd7aa, 0x08ce, 0xd7aa
-    dw 0x066a, 0xc649, 0xa986, 0xc654
-    dw 0x066b, 0xee54, 0x9060, 0xee54
-    dw 0x066c, 0x05c3, 0xf639, 0xf639
-    dw 0x066d, 0x418b, 0xfb92, 0xfb92
-    dw 0x066e, 0x1fd4, 0x0736, 0x1ff1
-    dw 0x066f, 0x3ddc, 0xa0ba, 0x3dd3
-    dw 0x0670, 0x62af, 0x6feb, 0x7060
-    dw 0x0671, 0xdd37, 0x44c5, 0xdd24
-    dw 0x0672, 0x9c5b, 0xc49f, 0xc4a0
-    dw 0x0673, 0xc929, 0xe06f, 0xe084
-    dw 0x0674, 0xa260, 0x8353, 0xa267
-    dw 0x0675, 0x1701, 0x2884, 0x28bc
-    dw 0x0676, 0x4bb5, 0x02f4, 0x4bb5
-    dw 0x0677, 0x90be, 0xd43a, 0xd43a
-    dw 0x0678, 0x8c4d, 0x6868, 0x6868
-    dw 0x0679, 0xdd08, 0x5296, 0xdc35
-    dw 0x067a, 0x11ef, 0xcb5c, 0xcb5c
-    dw 0x067b, 0xe2f7, 0x17b2, 0xe2f7
-    dw 0x067c, 0xc195, 0x2482, 0xc18c
-    dw 0x067d, 0x1344, 0xe169, 0xe169
-    dw 0x067e, 0x2bb8, 0x5120, 0x5122
-    dw 0x067f, 0x8223, 0x8e67, 0x8ef0
-    dw 0x0680, 0xc10c, 0x5f5a, 0x5f50
-    dw 0x0681, 0xd32c, 0x5d67, 0x5c82
-    dw 0x0682, 0x23fa, 0x9c55, 0x21d0
-    dw 0x0683, 0x3dd7, 0xc65a, 0xc4e4
-    dw 0x0684, 0x1fa8, 0x54d8, 0x54d8
-    dw 0x0685, 0xeede, 0x6b5d, 0xea5f
-    dw 0x0686, 0x57cc, 0x3f97, 0x57ea
-    dw 0x0687, 0xe419, 0xe804, 0xea10
-    dw 0x0688, 0x1c9f, 0x36af, 0x36c1
-    dw 0x0689, 0xf9f3, 0xe7fb, 0xfa33
-    dw 0x068a, 0x19a6, 0x11a5, 0x1b0f
-    dw 0x068b, 0xa991, 0x3e28, 0x3dfb
-    dw 0x068c, 0x24e9, 0x8afa, 0x24db
-    dw 0x068d, 0x69e0, 0x760a, 0x76c6
-    dw 0x068e, 0x0d1e, 0xf847, 0xf847
-    dw 0x068f, 0x3716, 0x6c78, 0x6c78
-    dw 0x0690, 0xcb74, 0x947d, 0xcb74
-    dw 0x0691, 0x9072, 0x67c9, 0x67c9
-    dw 0x0692, 0xd254, 0x56cc, 0x5344
-    dw 0x0693, 0x8772, 0x272c, 0x2725
-    dw 0x0694, 0x45aa, 0xf2cf, 0xf2ce
-    dw 0x0695, 0xc546, 0x3267, 0xc513
-    dw 0x0696, 0x6311, 0xad4b, 0x6311
-    dw 0x0697, 0x4f06, 0x99c1, 0x4f06
-    dw 0x0698, 0xa73e, 0x3702, 0x368e
-    dw 0x0699, 0xb367, 0xb8e4, 0xbabe
-    dw 0x069a, 0xe093, 0xf190, 0xf1d9
-    dw 0x069b, 0xddcd, 0x6b8d, 0x6ad3
-    dw 0x069c, 0x5b70, 0x53d7, 0x5cb3
-    dw 0x069d, 0x78ab, 0x53b8, 0x78ad
-    dw 0x069e, 0x8aed, 0xe524, 0xe524
-    dw 0x069f, 0x1f2c, 0x1f6b, 0x234c
-    dw 0x06a0, 0x7596, 0x86f5, 0x7596
-    dw 0x06a1, 0xf1bf, 0xcc63, 0xf1c1
-    dw 0x06a2, 0x0e67, 0x18ec, 0x19b9
-    dw 0x06a3, 0x120d, 0x0137, 0x1234
-    dw 0x06a4, 0x97e4, 0xd754, 0xd754
-    dw 0x06a5, 0x339e, 0xfaf6, 0xfaf6
-    dw 0x06a6, 0x849f, 0x82a4, 0x8743
-    dw 0x06a7, 0x94b7, 0x2bdd, 0x2bb7
-    dw 0x06a8, 0xb9a6, 0x481e, 0x4787
-    dw 0x06a9, 0xe4c1, 0x9a39, 0xe4c1
-    dw 0x06aa, 0x39ae, 0xc28f, 0xc124
-    dw 0x06ab, 0x05c7, 0x951f, 0x94c3
-    dw 0x06ac, 0x1666, 0xe8d7, 0xe8d7
-    dw 0x06ad, 0xa154, 0x6396, 0x6396
-    dw 0x06ae, 0x0803, 0xc0bf, 0xc0bf
-    dw 0x06af, 0xd92d, 0x8ef8, 0xd92d
-    dw 0x06b0, 0xb27e, 0xa590, 0xb330
-    dw 0x06b1, 0x9d60, 0xcb6a, 0xcb6b
-    dw 0x06b2, 0xb79d, 0x9e97, 0xb7b7
-    dw 0x06b3, 0x634f, 0x8ef1, 0x634f
-    dw 0x06b4, 0xd235, 0x5e45, 0x5d7e
-    dw 0x06b5, 0x1390, 0x54d9, 0x54d9
-    dw 0x06b6, 0xf2fc, 0x3f6e, 0xf2fc
-    dw 0x06b7, 0x0e80, 0x3b1a, 0x3b1b
-    dw 0x06b8, 0x242f, 0xa8b9, 0xa543
-    dw 0x06b9, 0x74c9, 0xe6be, 0x745d
-    dw 0x06ba, 0xae80, 0x09e8, 0xae7d
-    dw 0x06bb, 0x2cf3, 0xf2bf, 0xf2bf
-    dw 0x06bc, 0x9e79, 0x9089, 0x9f0a
-    dw 0x06bd, 0xfac2, 0x5f38, 0xfab4
-    dw 0x06be, 0x69b6, 0x89ba, 0x69b6
-    dw 0x06bf, 0x11b6, 0x0f46, 0x14ac
-    dw 0x06c0, 0x271a, 0xdd21, 0xdd21
-    dw 0x06c1, 0xc6e4, 0xc5b1, 0xca4a
-    dw 0x06c2, 0x4070, 0x55d5, 0x55f8
-    dw 0x06c3, 0x97e6, 0x9eb5, 0xa057
-    dw 0x06c4, 0x6966, 0xecc0, 0xe81a
-    dw 0x06c5, 0x91b1, 0xa8d4, 0xa8eb
-    dw 0x06c6, 0xfb40, 0xcccb, 0xfb41
-    dw 0x06c7, 0xcd03, 0xa3f9, 0xcd04
-    dw 0x06c8, 0x4194, 0xb3c2, 0x4118
-    dw 0x06c9, 0x527a, 0x4b7c, 0x542c
-    dw 0x06ca, 0xb0e7, 0x3e3b, 0x3d9e
-    dw 0x06cb, 0x4f60, 0x0ff6, 0x4f60
-    dw 0x06cc, 0x38fd, 0xae98, 0x382a
-    dw 0x06cd, 0x79ad, 0xc2b8, 0x79ad
-    dw 0x06ce, 0xc04e, 0x88f3, 0xc04e
-    dw 0x06cf, 0xe9d2, 0x9d6f, 0xe9d2
-    dw 0x06d0, 0x4fd7, 0xaf84, 0x4fcf
-    dw 0x06d1, 0xdddf, 0xa5ad, 0xdddf
-    dw 0x06d2, 0x476a, 0x0f13, 0x476a
-    dw 0x06d3, 0x342a, 0x0e45, 0x342c
-    dw 0x06d4, 0xb7e7, 0x2f6a, 0xb60c
-    dw 0x06d5, 0xdb11, 0x84ea, 0xdb11
-    dw 0x06d6, 0xd364, 0x1ca5, 0xd364
-    dw 0x06d7, 0x38ac, 0x25de, 0x38db
-    dw 0x06d8, 0x6822, 0xe993, 0xe1c4
-    dw 0x06d9, 0xa54b, 0xa65d, 0xa9d4
-    dw 0x06da, 0x38f3, 0xb541, 0x34a5
-    dw 0x06db, 0xdf5b, 0xe78b, 0xe8b1
-    dw 0x06dc, 0x2eee, 0xa213, 0x2e2c
-    dw 0x06dd, 0xa7da, 0xb7e2, 0xb830
-    dw 0x06de, 0x8be5, 0x4549, 0x4549
-    dw 0x06df, 0x07b9, 0x3b69, 0x3b69
-    dw 0x06e0, 0x2329, 0xad66, 0xac81
-    dw 0x06e1, 0x82d4, 0x9fbd, 0x9fc8
-    dw 0x06e2, 0xbc79, 0xb6fe, 0xbe38
-    dw 0x06e3, 0xae03, 0x7460, 0x7460
-    dw 0x06e4, 0xe669, 0x8914, 0xe669
-    dw 0x06e5, 0xf94b, 0xb9cd, 0xf94b
-    dw 0x06e6, 0xa5b9, 0x31f7, 0x3140
-    dw 0x06e7, 0xdfab, 0x0ddb, 0xdfab
-    dw 0x06e8, 0x1b8b, 0x84f6, 0x1b63
-    dw 0x06e9, 0xb439, 0x547e, 0x547a
-    dw 0x06ea, 0x3a37, 0x9394, 0x3a35
-    dw 0x06eb, 0x3c0a, 0x6926, 0x6927
-    dw 0x06ec, 0x35a7, 0xe3e4, 0xe3e3
-    dw 0x06ed, 0x2108, 0xc18c, 0xc187
-    dw 0x06ee, 0x292d, 0x28c1, 0x2cf7
-    dw 0x06ef, 0x4c56, 0xd628, 0xd512
-    dw 0x06f0, 0xec14, 0x92a1, 0xec14
-    dw 0x06f1, 0x36c8, 0x9a17, 0x36bc
-    dw 0x06f2, 0x0702, 0x1d31, 0x1d4d
-    dw 0x06f3, 0x232b, 0x004d, 0x232c
-    dw 0x06f4, 0xd6fe, 0xc8e4, 0xd79a
-    dw 0x06f5, 0x3244, 0xb6a9, 0xb30e
-    dw 0x06f6, 0xd6c0, 0x4dcf, 0xd54c
-    dw 0x06f7, 0x3b9f, 0x8af9, 0x3b9f
-    dw 0x06f8, 0xa24e, 0x75d7, 0x75d7
-    dw 0x06f9, 0x1e8d, 0xde58, 0xde58
-    dw 0x06fa, 0xdefd, 0x5434, 0xddf0
-    dw 0x06fb, 0xc23c, 0x0005, 0xc23c
-    dw 0x06fc, 0x15c0, 0xeb69, 0xeb69
-    dw 0x06fd, 0x28c6, 0x12b6, 0x28e1
-    dw 0x06fe, 0x37c0, 0x9280, 0x37bd
-    dw 0x06ff, 0x23d4, 0x9190, 0x237b
-    dw 0x0700, 0xc949, 0xbdeb, 0xca06
-    dw 0x0701, 0x9892, 0xe67a, 0xe67a
-    dw 0x0702, 0xe116, 0x98df, 0xe116
-    dw 0x0703, 0xbd79, 0xa9fa, 0xbda9
-    dw 0x0704, 0xcb23, 0x7422, 0x7421
-    dw 0x0705, 0x80ba, 0x18f3, 0x18ed
-    dw 0x0706, 0xafc2, 0x0bb3, 0xafbe
-    dw 0x0707, 0xbb41, 0x2599, 0xbb14
-    dw 0x0708, 0x2a40, 0x9999, 0x29e6
-    dw 0x0709, 0x0496, 0x5bd5, 0x5bd5
-    dw 0x070a, 0x049b, 0x9435, 0x93d7
-    dw 0x070b, 0x473e, 0x2d61, 0x4754
-    dw 0x070c, 0xa6eb, 0x2c50, 0x292a
-    dw 0x070d, 0x396c, 0xa2d2, 0x3951
-    dw 0x070e, 0xbde0, 0x02b5, 0xbde0
-    dw 0x070f, 0x60bd, 0x5672, 0x618b
-    dw 0x0710, 0xe92f, 0x41d3, 0xe92e
-    dw 0x0711, 0xef51, 0xa6a8, 0xef51
-    dw 0x0712, 0xebce, 0xba74, 0xebce
-    dw 0x0713, 0x1acb, 0x6c88, 0x6c88
-    dw 0x0714, 0xd367, 0xca8d, 0xd485
-    dw 0x0715, 0x783c, 0x8ea8, 0x783c
-    dw 0x0716, 0xf026, 0xa27c, 0xf026
-    dw 0x0717, 0x2841, 0xf4bc, 0xf4bc
-    dw 0x0718, 0x20f1, 0x8416, 0x20e9
-    dw 0x0719, 0xf957, 0xb526, 0xf957
-    dw 0x071a, 0xcb55, 0x26b8, 0xcb52
-    dw 0x071b, 0x5c11, 0x4a53, 0x5c44
-    dw 0x071c, 0x5308, 0x957d, 0x5308
-    dw 0x071d, 0xed26, 0x10e8, 0xed26
-    dw 0x071e, 0x9832, 0x4de3, 0x4de3
-    dw 0x071f, 0x675a, 0x8162, 0x675a
-    dw 0x0720, 0x8fb7, 0x56ab, 0x56ab
-    dw 0x0721, 0x280a, 0x7b85, 0x7b85
-    dw 0x0722, 0x1120, 0x42d5, 0x42d5
-    dw 0x0723, 0xe80d, 0xe487, 0xea50
-    dw 0x0724, 0x0d62, 0x6049, 0x6049
-    dw 0x0725, 0x7330, 0x02c6, 0x7330
-    dw 0x0726, 0x9b71, 0xf244, 0xf244
-    dw 0x0727, 0x23b7, 0x1f88, 0x25be
-    dw 0x0728, 0xeb9b, 0xd8dd, 0xebe9
-    dw 0x0729, 0xeadd, 0x1254, 0xeadd
-    dw 0x072a, 0x34ee, 0x3530, 0x390f
-    dw 0x072b, 0x655c, 0xca6c, 0x654f
-    dw 0x072c, 0x2256, 0x7645, 0x7645
-    dw 0x072d, 0x629e, 0x703a, 0x70a4
-    dw 0x072e, 0xdd9f, 0xe400, 0xe568
-    dw 0x072f, 0x344b, 0x0c0b, 0x344c
-    dw 0x0730, 0x7b76, 0x456b, 0x7b76
-    dw 0x0731, 0x4ee0, 0x6383, 0x63ba
-    dw 0x0732, 0x29f2, 0x5c43, 0x5c43
-    dw 0x0733, 0xc3cd, 0x9d22, 0xc3d0
-    dw 0x0734, 0x59cb, 0xc693, 0x5996
-    dw 0x0735, 0x3894, 0x4c10, 0x4c35
-    dw 0x0736, 0xea4a, 0x581c, 0xea08
-    dw 0x0737, 0x37ab, 0xc327, 0xc232
-    dw 0x0738, 0x42f9, 0x49ff, 0x4bbd
-    dw 0x0739, 0xf815, 0x7829, 0x6100
-    dw 0x073a, 0xaf5c, 0xc281, 0xc2bc
-    dw 0x073b, 0x9a80, 0x25a1, 0x24d1
-    dw 0x073c, 0x2520, 0x0aba, 0x252d
-    dw 0x073d, 0x0340, 0x0920, 0x0ac0
-    dw 0x073e, 0x0aab, 0x378b, 0x378c
-    dw 0x073f, 0x152b, 0x8621, 0x14c9
-    dw 0x0740, 0x640c, 0xe9a4, 0xe73c
-    dw 0x0741, 0xa6e9, 0xc04f, 0xc05d
-    dw 0x0742, 0xad71, 0x440b, 0x43ea
-    dw 0x0743, 0x1a1a, 0x7404, 0x7404
-    dw 0x0744, 0x662a, 0x5e4e, 0x67be
-    dw 0x0745, 0xd4bb, 0x9dd6, 0xd4bb
-    dw 0x0746, 0x2175, 0x17b4, 0x226c
-    dw 0x0747, 0xe7d5, 0x198b, 0xe7d5
-    dw 0x0748, 0x8fde, 0x9731, 0x9894
-    dw 0x0749, 0xdc0c, 0x2a5e, 0xdc0c
-    dw 0x074a, 0xbcd2, 0x012c, 0xbcd2
-    dw 0x074b, 0x3518, 0xc013, 0xbee0
-    dw 0x074c, 0x0a4d, 0x3fc3, 0x3fc3
-    dw 0x074d, 0xf79e, 0x1f78, 0xf79e
-    dw 0x074e, 0xc5e4, 0x7495, 0x7495
-    dw 0x074f, 0x8384, 0xaf88, 0xaf89
-    dw 0x0750, 0x1b7e, 0x43d3, 0x43d5
-    dw 0x0751, 0x5cfa, 0x5f89, 0x6242
-    dw 0x0752, 0x5dee, 0xd0fe, 0x5d4e
-    dw 0x0753, 0xdc29, 0xc418, 0xdc39
-    dw 0x0754, 0x2f4d, 0xb0e4, 0xa8f6
-    dw 0x0755, 0x61ee, 0x50c2, 0x623a
-    dw 0x0756, 0xc899, 0x49c4, 0x40ac
-    dw 0x0757, 0x6a4d, 0x5877, 0x6a94
-    dw 0x0758, 0xe0f5, 0x465a, 0xe0e8
-    dw 0x0759, 0x82d5, 0x9dc8, 0x9dd3
-    dw 0x075a, 0x4786, 0xb7ed, 0x4707
-    dw 0x075b, 0x5ddb, 0x51d3, 0x5e95
-    dw 0x075c, 0xf7b0, 0x5579, 0xf7ab
-    dw 0x075d, 0x714c, 0xbd94, 0x714c
-    dw 0x075e, 0xca0e, 0xf4d0, 0xf4d1
-    dw 0x075f, 0x6d1c, 0xe58c, 0x6b72
-    dw 0x0760, 0x38a4, 0xca16, 0xc9cc
-    dw 0x0761, 0x4516, 0x9692, 0x4516
-    dw 0x0762, 0x9b15, 0x213f, 0x1ef4
-    dw 0x0763, 0x5aaa, 0xca62, 0x5a44
-    dw 0x0764, 0xd223, 0xbc99, 0xd248
-    dw 0x0765, 0x1b24, 0x9abc, 0x0a80
-    dw 0x0766, 0x065d, 0x8572, 0x00eb
-    dw 0x0767, 0xf333, 0xe752, 0xf40f
-    dw 0x0768, 0xcbcc, 0x7608, 0x7607
-    dw 0x0769, 0x851a, 0x1352, 0x12af
-    dw 0x076a, 0x2df5, 0xe2f5, 0xe2f5
-    dw 0x076b, 0x6526, 0x25a5, 0x6526
-    dw 0x076c, 0x386f, 0xd672, 0xd669
-    dw 0x076d, 0xe339, 0x027d, 0xe339
-    dw 0x076e, 0xcb42, 0x5056, 0x4d0b
-    dw 0x076f, 0xe80a, 0x03e6, 0xe80a
-    dw 0x0770, 0x1a6c, 0x2d20, 0x2d53
-    dw 0x0771, 0x9a78, 0xb581, 0xb58e
-    dw 0x0772, 0x4e5f, 0xf523, 0xf521
-    dw 0x0773, 0x2082, 0xb1bc, 0xb174
-    dw 0x0774, 0x9b08, 0xbb3f, 0xbb46
-    dw 0x0775, 0xb819, 0x207a, 0xb807
-    dw 0x0776, 0xae72, 0x9f6b, 0xaee9
-    dw 0x0777, 0xec46, 0x247b, 0xec46
-    dw 0x0778, 0x2486, 0x5270, 0x5271
-    dw 0x0779, 0x077b, 0x64be, 0x64be
-    dw 0x077a, 0x7816, 0x3fea, 0x7816
-    dw 0x077b, 0x3b30, 0x5b4f, 0x5b56
-    dw 0x077c, 0x4268, 0x0673, 0x4268
-    dw 0x077d, 0xaba5, 0x2a72, 0xa0cc
-    dw 0x077e, 0x0a59, 0xc612, 0xc612
-    dw 0x077f, 0x5792, 0xa4d2, 0x5792
-    dw 0x0780, 0x7b93, 0xa5f1, 0x7b93
-    dw 0x0781, 0x99f5, 0xfb77, 0xfb77
-    dw 0x0782, 0xc673, 0x4bb1, 0x4878
-    dw 0x0783, 0x967f, 0x81b2, 0x969a
-    dw 0x0784, 0x03ca, 0xb6f9, 0xb6f9
-    dw 0x0785, 0x3025, 0xa335, 0x2f63
-    dw 0x0786, 0xa33f, 0x54a0, 0x54a0
-    dw 0x0787, 0xc7bb, 0xa2d7, 0xc7be
-    dw 0x0788, 0xa710, 0xcf37, 0xcf39
-    dw 0x0789, 0x0796, 0x1f26, 0x1f44
-    dw 0x078a, 0x0f21, 0x42c6, 0x42c6
-    dw 0x078b, 0x7a76, 0x5189, 0x7a77
-    dw 0x078c, 0x4939, 0x261b, 0x493c
-    dw 0x078d, 0x7bfb, 0x5393, 0x7bfd
-    dw 0x078e, 0xec2d, 0xd38d, 0xec3c
-    dw 0x078f, 0xf865, 0x67c1, 0xf827
-    dw 0x0790, 0x797e, 0x925a, 0x797e
-    dw 0x0791, 0x6338, 0x3ff2, 0x633c
-    dw 0x0792, 0xde0b, 0xf9b7, 0xf9c3
-    dw 0x0793, 0xc1a4, 0xe1d5, 0xe1db
-    dw 0x0794, 0xb0b0, 0xf1c9, 0xf1c9
-    dw 0x0795, 0x850a, 0x53ef, 0x53ef
-    dw 0x0796, 0x4669, 0x4cc6, 0x4e60
-    dw 0x0797, 0xf6c6, 0xed7a, 0xf812
-    dw 0x0798, 0x1bfd, 0x0ca0, 0x1c48
-    dw 0x0799, 0x2b1e, 0x4123, 0x413f
-    dw 0x079a, 0x8716, 0x8a5c, 0x8cf4
-    dw 0x079b, 0xad32, 0xf8a3, 0xf8a3
-    dw 0x079c, 0xddef, 0x995f, 0xddef
-    dw 0x079d, 0xcc31, 0xd654, 0xd760
-    dw 0x079e, 0x0120, 0x45af, 0x45af
-    dw 0x079f, 0x68ae, 0x6458, 0x6ada
-    dw 0x07a0, 0x85a1, 0x46b9, 0x46b9
-    dw 0x07a1, 0x5e0f, 0x4746, 0x5e2c
-    dw 0x07a2, 0x288e, 0x0ebf, 0x289b
-    dw 0x07a3, 0x390f, 0xad99, 0x385c
-    dw 0x07a4, 0x62ae, 0xfa5f, 0xfa44
-    dw 0x07a5, 0x5975, 0x6cf3, 0x6d1f
-    dw 0x07a6, 0x165c, 0x57d1, 0x57d1
-    dw 0x07a7, 0x7993, 0x417a, 0x7993
-    dw 0x07a8, 0x98f4, 0x00aa, 0x98ef
-    dw 0x07a9, 0xbe22, 0x2351, 0xbe13
-    dw 0x07aa, 0xaddc, 0xb6c6, 0xb81e
-    dw 0x07ab, 0x0140, 0x473b, 0x473b
-    dw 0x07ac, 0x82f7, 0xd795, 0xd795
-    dw 0x07ad, 0x485c, 0xc8a6, 0xb8a0
-    dw 0x07ae, 0x4043, 0xacb4, 0x401d
-    dw 0x07af, 0x4e48, 0x86fd, 0x4e48
-    dw 0x07b0, 0x0ac4, 0x958e, 0x94b6
-    dw 0x07b1, 0xaf8b, 0x1983, 0xaf5f
-    dw 0x07b2, 0xce9d, 0x5d24, 0x5cba
-    dw 0x07b3, 0x4e16, 0x5783, 0x5884
-    dw 0x07b4, 0xd5a7, 0xbb09, 0xd5b5
-    dw 0x07b5, 0x6ddf, 0x2d78, 0x6ddf
-    dw 0x07b6, 0x349d, 0xaf5a, 0x318d
-    dw 0x07b7, 0xc66d, 0x3547, 0xc619
-    dw 0x07b8, 0x6d7c, 0xe9be, 0x693a
-    dw 0x07b9, 0xe323, 0x2442, 0xe323
-    dw 0x07ba, 0xeafe, 0x2a5e, 0xeafe
-    dw 0x07bb, 0xa739, 0xc293, 0xc2a1
-    dw 0x07bc, 0x72ba, 0x6fe0, 0x7555
-    dw 0x07bd, 0x02d7, 0x1f6f, 0x1f7a
-    dw 0x07be, 0xbe28, 0x89d4, 0xbe28
-    dw 0x07bf, 0x2a33, 0x53b6, 0x53b8
-    dw 0x07c0, 0x395f, 0x43b6, 0x4487
-    dw 0x07c1, 0x2253, 0x9684, 0x2182
-    dw 0x07c2, 0xbfe8, 0x706a, 0x706a
-    dw 0x07c3, 0xee07, 0x958f, 0xee07
-    dw 0x07c4, 0x2b73, 0x5be7, 0x5be7
-    dw 0x07c5, 0xc308, 0x6010, 0x6009
-    dw 0x07c6, 0x0b41, 0x8975, 0x0398
-    dw 0x07c7, 0x9557, 0x78bd, 0x78bd
-    dw 0x07c8, 0x7333, 0x787a, 0x7a47
-    dw 0x07c9, 0x9d00, 0x5e31, 0x5e31
-    dw 0x07ca, 0xa2d9, 0x4439, 0x4436
-    dw 0x07cb, 0x20c5, 0x1593, 0x2177
-    dw 0x07cc, 0xb419, 0x239c, 0xb3b8
-    dw 0x07cd, 0x3502, 0x7241, 0x7241
-    dw 0x07ce, 0xad70, 0x5f35, 0x5f35
-    dw 0x07cf, 0xc5f7, 0xe6cf, 0xe6d5
+    ; Uniform random values
+    dw 0x02a4, 0x337e, 0x2729, 0x3432
+    dw 0x02a5, 0xdb63, 0x27a9, 0xdb63
+    dw 0x02a6, 0x8080, 0xe5e4, 0xe5e4
+    dw 0x02a7, 0xf46d, 0xca98, 0xf46e
+    dw 0x02a8, 0xef09, 0xc935, 0xef0c
+    dw 0x02a9, 0xdd75, 0x6acb, 0x6a1c
+    dw 0x02aa, 0x59cb, 0xed72, 0xed44
+    dw 0x02ab, 0x4aef, 0xe22e, 0xe212
+    dw 0x02ac, 0xadea, 0x2dd4, 0x9580
+    dw 0x02ad, 0x9aee, 0x76b4, 0x76b4
+    dw 0x02ae, 0x9e2f, 0xee75, 0xee75
+    dw 0x02af, 0x91b6, 0x0f4c, 0x8c20
+    dw 0x02b0, 0x8e1d, 0x1e9a, 0x1e38
+    dw 0x02b1, 0x8b3e, 0xbdde, 0xbdde
+    dw 0x02b2, 0xbe9e, 0x7447, 0x7447
+    dw 0x02b3, 0xb8e3, 0x40c0, 0x3f0e
+    dw 0x02b4, 0x6de2, 0x03d6, 0x6de2
+    dw 0x02b5, 0x59ac, 0xe2ef, 0xe184
+    dw 0x02b6, 0xda6e, 0xa026, 0xda6e
+    dw 0x02b7, 0x3d85, 0x2e43, 0x3de9
+    dw 0x02b8, 0x6d71, 0x2a9b, 0x6d71
+    dw 0x02b9, 0x0f08, 0xea17, 0xea17
+    dw 0x02ba, 0x5de9, 0x37b6, 0x5deb
+    dw 0x02bb, 0xcf90, 0xb863, 0xcfb3
+    dw 0x02bc, 0x3136, 0x8094, 0x3136
+    dw 0x02bd, 0xe64b, 0xb13b, 0xe64b
+    dw 0x02be, 0x23b5, 0xccde, 0xccdd
+    dw 0x02bf, 0xeede, 0x3324, 0xeede
+    dw 0x02c0, 0xe2c6, 0xf91a, 0xf935
+    dw 0x02c1, 0xf968, 0x84c9, 0xf968
+    dw 0x02c2, 0x07d6, 0xe3d5, 0xe3d5
+    dw 0x02c3, 0xcd05, 0x5063, 0x4b82
+    dw 0x02c4, 0x60ab, 0x6009, 0x645a
+    dw 0x02c5, 0xd1ff, 0x60ef, 0x608f
+    dw 0x02c6, 0xad57, 0xf06d, 0xf06d
+    dw 0x02c7, 0x5645, 0x90f0, 0x5645
+    dw 0x02c8, 0x95bb, 0x1d0f, 0x1b40
+    dw 0x02c9, 0xfa10, 0x56e7, 0xfa0d
+    dw 0x02ca, 0x6369, 0x4677, 0x6376
+    dw 0x02cb, 0x8b80, 0x1432, 0x1284
+    dw 0x02cc, 0xd3e0, 0xea95, 0xeab4
+    dw 0x02cd, 0x5a9a, 0x347d, 0x5a9c
+    dw 0x02ce, 0xd44d, 0xa77a, 0xd44d
+    dw 0x02cf, 0xcc71, 0x3ff3, 0xcbe4
+    dw 0x02d0, 0x23bc, 0x1978, 0x248d
+    dw 0x02d1, 0x6c55, 0x3205, 0x6c55
+    dw 0x02d2, 0x4163, 0x75ae, 0x75ae
+    dw 0x02d3, 0x8419, 0x4e60, 0x4e60
+    dw 0x02d4, 0x718e, 0x0be1, 0x718e
+    dw 0x02d5, 0xefc7, 0xd260, 0xefd4
+    dw 0x02d6, 0x0032, 0x40bc, 0x40bc
+    dw 0x02d7, 0x3a16, 0xea48, 0xea48
+    dw 0x02d8, 0xb822, 0x3bbc, 0x3734
+    dw 0x02d9, 0x3e8f, 0x3af0, 0x4104
+    dw 0x02da, 0xb08c, 0xa8dc, 0xb1c3
+    dw 0x02db, 0xc90d, 0x024c, 0xc90d
+    dw 0x02dc, 0x1354, 0xcc7c, 0xcc7c
+    dw 0x02dd, 0x8eb5, 0x54ae, 0x54ae
+    dw 0x02de, 0x4f4d, 0x9c74, 0x4f4d
+    dw 0x02df, 0xdfb0, 0xcaef, 0xdfe7
+    dw 0x02e0, 0x1833, 0x151a, 0x1ac0
+    dw 0x02e1, 0x15f1, 0x75c0, 0x75c0
+    dw 0x02e2, 0xed6f, 0x0352, 0xed6f
+    dw 0x02e3, 0x1195, 0x9a4c, 0x98e7
+    dw 0x02e4, 0xdcb8, 0xf600, 0xf613
+    dw 0x02e5, 0xbad1, 0x7212, 0x7212
+    dw 0x02e6, 0xf591, 0x3905, 0xf591
+    dw 0x02e7, 0x9116, 0x4283, 0x4283
+    dw 0x02e8, 0xee3c, 0x2f1c, 0xee3c
+    dw 0x02e9, 0xe032, 0x1b05, 0xe032
+    dw 0x02ea, 0x00a0, 0x1e70, 0x1e72
+    dw 0x02eb, 0x527d, 0x2891, 0x527e
+    dw 0x02ec, 0xd6bf, 0x0da0, 0xd6bf
+    dw 0x02ed, 0x864d, 0xe04d, 0xe04d
+    dw 0x02ee, 0xdbda, 0xf879, 0xf881
+    dw 0x02ef, 0x5aa1, 0xacbb, 0x5aa0
+    dw 0x02f0, 0xed84, 0x4999, 0xed81
+    dw 0x02f1, 0xe7de, 0x63e8, 0xe3d4
+    dw 0x02f2, 0x359e, 0x1815, 0x35a6
+    dw 0x02f3, 0xa5df, 0x7041, 0x7041
+    dw 0x02f4, 0x4e2a, 0x1653, 0x4e2a
+    dw 0x02f5, 0x6b01, 0xc3b4, 0x6aff
+    dw 0x02f6, 0x58f7, 0x81a3, 0x58f7
+    dw 0x02f7, 0x5f21, 0x6966, 0x6a4a
+    dw 0x02f8, 0x5b0e, 0x19e4, 0x5b0e
+    dw 0x02f9, 0x9f8d, 0x62e8, 0x62e8
+    dw 0x02fa, 0xd786, 0x8bfa, 0xd786
+    dw 0x02fb, 0x70da, 0x0634, 0x70da
+    dw 0x02fc, 0x6382, 0x07ff, 0x6382
+    dw 0x02fd, 0x8012, 0xc566, 0xc566
+    dw 0x02fe, 0x3b19, 0xa51f, 0x3af0
+    dw 0x02ff, 0x109b, 0xc60c, 0xc60c
+    dw 0x0300, 0xe15f, 0x412d, 0xe15a
+    dw 0x0301, 0x0f29, 0x300b, 0x300f
+    dw 0x0302, 0x1f6e, 0x4d40, 0x4d40
+    dw 0x0303, 0xf9b6, 0x2f1b, 0xf9b6
+    dw 0x0304, 0xd4d3, 0x4004, 0xd4b3
+    dw 0x0305, 0x5b51, 0x35db, 0x5b54
+    dw 0x0306, 0x91b6, 0xb666, 0xb669
+    dw 0x0307, 0x67a6, 0x3f12, 0x67a8
+    dw 0x0308, 0xa4af, 0xf966, 0xf966
+    dw 0x0309, 0x31f7, 0xbff5, 0xbf36
+    dw 0x030a, 0xca4f, 0x2eb7, 0xca42
+    dw 0x030b, 0xa40e, 0x9df2, 0xa58a
+    dw 0x030c, 0x17cf, 0x2e6a, 0x2e89
+    dw 0x030d, 0xc8e9, 0xabaf, 0xc8f1
+    dw 0x030e, 0x725c, 0x1f44, 0x725c
+    dw 0x030f, 0xae48, 0x37b7, 0x3625
+    dw 0x0310, 0x6c7d, 0xf319, 0xf0da
+    dw 0x0311, 0xe8ae, 0x9005, 0xe8ae
+    dw 0x0312, 0xf222, 0x21f1, 0xf222
+    dw 0x0313, 0x4cf1, 0xa24a, 0x4cf0
+    dw 0x0314, 0x5245, 0x4c6a, 0x543d
+    dw 0x0315, 0xcb72, 0x5a44, 0x59cd
+    dw 0x0316, 0xb345, 0x2b4b, 0xb172
+    dw 0x0317, 0xf8e2, 0xab82, 0xf8e2
+    dw 0x0318, 0x5ae7, 0x9e0a, 0x5ae7
+    dw 0x0319, 0x2761, 0x6428, 0x6428
+    dw 0x031a, 0xc64d, 0x5725, 0x56c0
+    dw 0x031b, 0x91c4, 0xbb8a, 0xbb8b
+    dw 0x031c, 0x0bf8, 0x9d1b, 0x9cdb
+    dw 0x031d, 0x2fbd, 0xec34, 0xec34
+    dw 0x031e, 0xacbc, 0xfbb7, 0xfbb7
+    dw 0x031f, 0xe9b5, 0x812e, 0xe9b5
+    dw 0x0320, 0xa75f, 0x12a5, 0xa72a
+    dw 0x0321, 0x9fb6, 0xbd42, 0xbd4a
+    dw 0x0322, 0xd50d, 0x89e2, 0xd50d
+    dw 0x0323, 0xf84a, 0x4585, 0xf84a
+    dw 0x0324, 0xf3e2, 0xfb8a, 0xfc00
+    dw 0x0325, 0xea16, 0xb664, 0xea16
+    dw 0x0326, 0x24ed, 0xbeb9, 0xbea5
+    dw 0x0327, 0xb220, 0xf9dd, 0xf9dd
+    dw 0x0328, 0x6c4c, 0x6fdc, 0x7214
+    dw 0x0329, 0x3647, 0x1a89, 0x3654
+    dw 0x032a, 0x4999, 0x9b88, 0x4999
+    dw 0x032b, 0x0b56, 0x12d3, 0x1454
+    dw 0x032c, 0x24da, 0x2646, 0x2990
+    dw 0x032d, 0xea10, 0x1480, 0xea10
+    dw 0x032e, 0xedfe, 0x1694, 0xedfe
+    dw 0x032f, 0x5881, 0x50bb, 0x59b0
+    dw 0x0330, 0x2cc6, 0xc634, 0xc621
+    dw 0x0331, 0x8d9c, 0x862a, 0x8f26
+    dw 0x0332, 0x2cb4, 0x6b34, 0x6b34
+    dw 0x0333, 0xc39b, 0xd386, 0xd400
+    dw 0x0334, 0x0e9c, 0x3f1f, 0x3f1f
+    dw 0x0335, 0x427c, 0x80a9, 0x427c
+    dw 0x0336, 0xad85, 0x6aa3, 0x6aa3
+    dw 0x0337, 0x6192, 0xb224, 0x6192
+    dw 0x0338, 0x0d9c, 0xd22e, 0xd22e
+    dw 0x0339, 0x959c, 0x3daf, 0x3dae
+    dw 0x033a, 0x861a, 0xb9e7, 0xb9e7
+    dw 0x033b, 0x9cd1, 0x4851, 0x4850
+    dw 0x033c, 0x54a4, 0x4b74, 0x5592
+    dw 0x033d, 0x4dcc, 0xc683, 0x4c2b
+    dw 0x033e, 0xcc91, 0x8434, 0xcc91
+    dw 0x033f, 0x594f, 0xbec0, 0x5942
+    dw 0x0340, 0x77cb, 0xdd6c, 0x77b5
+    dw 0x0341, 0x0694, 0x68b5, 0x68b5
+    dw 0x0342, 0x0bbd, 0x7b79, 0x7b79
+    dw 0x0343, 0x726e, 0x659a, 0x7321
+    dw 0x0344, 0x7777, 0xb4e3, 0x7777
+    dw 0x0345, 0x3563, 0x4b16, 0x4b41
+    dw 0x0346, 0x44e0, 0xba6c, 0x4412
+    dw 0x0347, 0x8595, 0xf269, 0xf269
+    dw 0x0348, 0x4a06, 0x1644, 0x4a06
+    dw 0x0349, 0x3b58, 0xfa9a, 0xfa9a
+    dw 0x034a, 0x2551, 0xaeb5, 0xad61
+    dw 0x034b, 0x45f3, 0x62c1, 0x62cd
+    dw 0x034c, 0xa60c, 0x3316, 0x3254
+    dw 0x034d, 0x9a98, 0x41d7, 0x41d5
+    dw 0x034e, 0x6681, 0xd986, 0x65d0
+    dw 0x034f, 0xe2e2, 0x361a, 0xe2e1
+    dw 0x0350, 0x50b3, 0xaebb, 0x50b0
+    dw 0x0351, 0x9eb6, 0x47ea, 0x47e8
+    dw 0x0352, 0x1d78, 0xcb94, 0xcb93
+    dw 0x0353, 0xd710, 0x18a3, 0xd710
+    dw 0x0354, 0x750b, 0x3567, 0x750b
+    dw 0x0355, 0x908c, 0x8a4f, 0x9220
+    dw 0x0356, 0xe566, 0x395c, 0xe565
+    dw 0x0357, 0xb103, 0x4f1b, 0x4f11
+    dw 0x0358, 0xbdc8, 0x02dd, 0xbdc8
+    dw 0x0359, 0xdcb2, 0xd7f9, 0xdeb0
+    dw 0x035a, 0xf84d, 0x1014, 0xf84d
+    dw 0x035b, 0x443a, 0x0db6, 0x443a
+    dw 0x035c, 0x63f4, 0x8b6f, 0x63f4
+    dw 0x035d, 0x3af0, 0xd932, 0xd92b
+    dw 0x035e, 0x402c, 0x902c, 0x402c
+    dw 0x035f, 0x0dc8, 0x9134, 0x8ca0
+    dw 0x0360, 0x177b, 0x0234, 0x179e
+    dw 0x0361, 0x1d53, 0x0040, 0x1d54
+    dw 0x0362, 0x1fa4, 0x135b, 0x2048
+    dw 0x0363, 0x953a, 0xa041, 0xa0e8
+    dw 0x0364, 0x1f92, 0xcd2c, 0xcd2c
+    dw 0x0365, 0x2edd, 0xd61c, 0xd61a
+    dw 0x0366, 0x5e3c, 0x63ae, 0x6566
+    dw 0x0367, 0x072f, 0x6ad2, 0x6ad2
+    dw 0x0368, 0xa7d3, 0xd40c, 0xd40c
+    dw 0x0369, 0x277e, 0xbad0, 0xba94
+    dw 0x036a, 0x5ed2, 0xc79a, 0x5eb4
+    dw 0x036b, 0x3222, 0x8f3a, 0x321e
+    dw 0x036c, 0x8479, 0x35eb, 0x35eb
+    dw 0x036d, 0x9622, 0x718e, 0x718e
+    dw 0x036e, 0xafcd, 0x8fa3, 0xafd5
+    dw 0x036f, 0x2b0c, 0xdc8d, 0xdc8d
+    dw 0x0370, 0xdcc1, 0xc2f2, 0xdccf
+    dw 0x0371, 0x31fd, 0xa922, 0x30b4
+    dw 0x0372, 0x960d, 0xf9c0, 0xf9c0
+    dw 0x0373, 0xbea0, 0x0bc8, 0xbea0
+    dw 0x0374, 0x75c0, 0xb2d8, 0x75c0
+    dw 0x0375, 0x0d46, 0xbd00, 0xbd00
+    dw 0x0376, 0xebbc, 0xbdf7, 0xebbd
+    dw 0x0377, 0xb6e9, 0xbb1f, 0xbd4a
+    dw 0x0378, 0x0905, 0x58ba, 0x58ba
+    dw 0x0379, 0xc199, 0xd67d, 0xd6aa
+    dw 0x037a, 0x210b, 0x04ac, 0x2114
+    dw 0x037b, 0x086b, 0x42c5, 0x42c5
+    dw 0x037c, 0xbd94, 0x5529, 0x5513
+    dw 0x037d, 0xa41c, 0x19a7, 0xa2ce
+    dw 0x037e, 0xbbb5, 0x1fce, 0xbba5
+    dw 0x037f, 0xe285, 0x8e28, 0xe285
+    dw 0x0380, 0xac2e, 0x5295, 0x5293
+    dw 0x0381, 0x2a24, 0xd2fb, 0xd2f9
+    dw 0x0382, 0xf2dd, 0x01d4, 0xf2dd
+    dw 0x0383, 0xb578, 0xb53e, 0xb95b
+    dw 0x0384, 0xd2b3, 0xa1ce, 0xd2b3
+    dw 0x0385, 0x85c2, 0x357b, 0x357b
+    dw 0x0386, 0xae77, 0x4fc1, 0x4fbb
+    dw 0x0387, 0x46c8, 0x8057, 0x46c8
+    dw 0x0388, 0x4269, 0x70e7, 0x70e7
+    dw 0x0389, 0x658e, 0x6fae, 0x7089
+    dw 0x038a, 0x868e, 0xb084, 0xb085
+    dw 0x038b, 0x047d, 0x0aeb, 0x0c95
+    dw 0x038c, 0xcbf5, 0x3d1f, 0xcb51
+    dw 0x038d, 0x3f9a, 0x38b7, 0x40fb
+    dw 0x038e, 0x0763, 0xd084, 0xd084
+    dw 0x038f, 0x951b, 0x9320, 0x9856
+    dw 0x0390, 0xcf48, 0x2f09, 0xcf41
+    dw 0x0391, 0x478c, 0xac76, 0x477a
+    dw 0x0392, 0xc308, 0xa430, 0xc310
+    dw 0x0393, 0x8257, 0x2816, 0x2815
+    dw 0x0394, 0x9df8, 0x73d5, 0x73d5
+    dw 0x0395, 0x0d7a, 0x0e82, 0x11fe
+    dw 0x0396, 0x3c7f, 0x46e8, 0x4804
+    dw 0x0397, 0x22ba, 0xb69e, 0xb668
+    dw 0x0398, 0x6e3c, 0xdd22, 0x6dea
+    dw 0x0399, 0xfa90, 0xedfe, 0xfb50
+    dw 0x039a, 0x1847, 0x9642, 0x1098
+    dw 0x039b, 0x1e1c, 0xa370, 0xa062
+    dw 0x039c, 0x53d5, 0xaab4, 0x53d3
+    dw 0x039d, 0x453d, 0x1369, 0x453d
+    dw 0x039e, 0x5ba0, 0x985a, 0x5ba0
+    dw 0x039f, 0x26d8, 0x1194, 0x2705
+    dw 0x03a0, 0xe7d2, 0x104f, 0xe7d2
+    dw 0x03a1, 0x5ca1, 0xf882, 0xf879
+    dw 0x03a2, 0xa51e, 0x65fe, 0x65fe
+    dw 0x03a3, 0x9b29, 0xb7ed, 0xb7fb
+    dw 0x03a4, 0x7362, 0xc34c, 0x7362
+    dw 0x03a5, 0xc9b6, 0xafa2, 0xc9c5
+    dw 0x03a6, 0xed7b, 0x09c6, 0xed7b
+    dw 0x03a7, 0xd56e, 0xccdf, 0xd6a6
+    dw 0x03a8, 0x48b1, 0x3cce, 0x494b
+    dw 0x03a9, 0xb8c3, 0xa4e6, 0xb8ea
+    dw 0x03aa, 0x0114, 0x4056, 0x4056
+    dw 0x03ab, 0xbcf5, 0x162c, 0xbcf3
+    dw 0x03ac, 0x4f55, 0x5d0b, 0x5d80
+    dw 0x03ad, 0x0c66, 0xe640, 0xe640
+    dw 0x03ae, 0xe6f9, 0x8c32, 0xe6f9
+    dw 0x03af, 0xd8a9, 0x57f8, 0xcd68
+    dw 0x03b0, 0xfbfc, 0xc5eb, 0xfbfc
+    dw 0x03b1, 0x39d0, 0x0794, 0x39d0
+    dw 0x03b2, 0x7726, 0x6065, 0x7749
+    dw 0x03b3, 0x25ce, 0xfb0d, 0xfb0d
+    dw 0x03b4, 0xc6be, 0xa26d, 0xc6c1
+    dw 0x03b5, 0x0eb2, 0xf255, 0xf255
+    dw 0x03b6, 0xd27c, 0xb839, 0xd28d
+    dw 0x03b7, 0xe70a, 0xd080, 0xe72e
+    dw 0x03b8, 0x453f, 0xf8cc, 0xf8cc
+    dw 0x03b9, 0xec5d, 0x781d, 0x7723
+    dw 0x03ba, 0x4d93, 0x4d05, 0x514c
+    dw 0x03bb, 0x8282, 0x03da, 0x0158
+    dw 0x03bc, 0xb87e, 0x3112, 0xb673
+    dw 0x03bd, 0x2061, 0xe740, 0xe740
+    dw 0x03be, 0x3c1c, 0x46f1, 0x47f8
+    dw 0x03bf, 0xaba6, 0xc40c, 0xc41b
+    dw 0x03c0, 0xb3d3, 0x9878, 0xb3e5
+    dw 0x03c1, 0x12b7, 0x60b1, 0x60b1
+    dw 0x03c2, 0x4b17, 0x453e, 0x4cdb
+    dw 0x03c3, 0x2455, 0x8edb, 0x243a
+    dw 0x03c4, 0x6a00, 0xe2bc, 0x6851
+    dw 0x03c5, 0x8669, 0xec38, 0xec38
+    dw 0x03c6, 0x5bf4, 0x0ed6, 0x5bf4
+    dw 0x03c7, 0x12e1, 0x3d92, 0x3d93
+    dw 0x03c8, 0xc483, 0x7421, 0x7421
+    dw 0x03c9, 0x6894, 0x3b63, 0x6894
+    dw 0x03ca, 0x3d8b, 0xf202, 0xf202
+    dw 0x03cb, 0x8fe0, 0x8eab, 0x9346
+    dw 0x03cc, 0xa1b4, 0x2f72, 0x2ebc
+    dw 0x03cd, 0x4078, 0x4b34, 0x4c29
+    dw 0x03ce, 0xda67, 0x140d, 0xda67
+    dw 0x03cf, 0xc150, 0x547f, 0x5454
+    dw 0x03d0, 0xd6d4, 0x8c40, 0xd6d4
+    dw 0x03d1, 0xa503, 0x188b, 0xa472
+    dw 0x03d2, 0xa6d4, 0x27c3, 0x1b78
+    dw 0x03d3, 0x416f, 0x6a4d, 0x6a4e
+    dw 0x03d4, 0x0584, 0xe85e, 0xe85e
+    dw 0x03d5, 0x05db, 0xd4e3, 0xd4e3
+    dw 0x03d6, 0x33ab, 0x6d99, 0x6d99
+    dw 0x03d7, 0x8bc2, 0xf671, 0xf671
+    dw 0x03d8, 0x29ee, 0xda97, 0xda97
+    dw 0x03d9, 0x0435, 0xb909, 0xb909
+    dw 0x03da, 0x1ea6, 0x23e3, 0x259b
+    dw 0x03db, 0xe879, 0xd7e3, 0xe8b8
+    dw 0x03dc, 0x3bf8, 0x6710, 0x6711
+    dw 0x03dd, 0xcdc8, 0xbfa0, 0xce42
+    dw 0x03de, 0x8f1a, 0xdbfe, 0xdbfe
+    dw 0x03df, 0x6ce3, 0x9d08, 0x6ce3
+    dw 0x03e0, 0x55a1, 0x0c5f, 0x55a1
+    dw 0x03e1, 0x2c98, 0x0257, 0x2c99
+    dw 0x03e2, 0x4451, 0xf7ee, 0xf7ee
+    dw 0x03e3, 0x16cb, 0xe447, 0xe447
+    dw 0x03e4, 0x830b, 0x432a, 0x432a
+    dw 0x03e5, 0x0093, 0x6163, 0x6163
+    dw 0x03e6, 0xde39, 0x6484, 0x61ec
+    dw 0x03e7, 0x8c67, 0x4e54, 0x4e54
+    dw 0x03e8, 0xc98e, 0xa3a0, 0xc990
+    dw 0x03e9, 0x80e8, 0x3558, 0x3558
+    dw 0x03ea, 0xda6a, 0x46b8, 0xda34
+    dw 0x03eb, 0x9291, 0x8e31, 0x94d5
+    dw 0x03ec, 0x6133, 0xe497, 0xdff6
+    dw 0x03ed, 0x3823, 0xc6ca, 0xc646
+    dw 0x03ee, 0x865b, 0x9e71, 0x9e8a
+
+    ; Results near the exponent boundaries
+    dw 0x03ef, 0x0b17, 0x8bf6, 0x81be
+    dw 0x03f0, 0x87ae, 0x05b4, 0x81fa
+    dw 0x03f1, 0xf544, 0xf04d, 0xf76a
+    dw 0x03f2, 0x786f, 0x78a1, 0x7c00
+    dw 0x03f3, 0x7804, 0x77e0, 0x7bf4
+    dw 0x03f4, 0xf54b, 0xf050, 0xf773
+    dw 0x03f5, 0x0bd1, 0x8b47, 0x0114
+    dw 0x03f6, 0x8434, 0x062e, 0x01fa
+    dw 0x03f7, 0x8137, 0x004d, 0x80ea
+    dw 0x03f8, 0x079a, 0x8730, 0x006a
+    dw 0x03f9, 0x0448, 0x86b2, 0x826a
+    dw 0x03fa, 0x08ee, 0x87d6, 0x0206
+    dw 0x03fb, 0xf6dc, 0xf32c, 0xf939
+    dw 0x03fc, 0x788b, 0x75cc, 0x7b71
+    dw 0x03fd, 0xfa5e, 0xfbdc, 0xfc00
+    dw 0x03fe, 0x0121, 0x8195, 0x8074
+    dw 0x03ff, 0xfb57, 0xf4ca, 0xfc00
+    dw 0x0400, 0x0706, 0x85f2, 0x0114
+    dw 0x0401, 0x00f8, 0x8274, 0x817c
+    dw 0x0402, 0xfa3c, 0xfbf6, 0xfc00
+    dw 0x0403, 0x8ba7, 0x09d7, 0x83a0
+    dw 0x0404, 0x892e, 0x095d, 0x005e
+    dw 0x0405, 0x7657, 0x775f, 0x7adb
+    dw 0x0406, 0x7794, 0x7472, 0x7a03
+    dw 0x0407, 0x815f, 0x036c, 0x020d
+    dw 0x0408, 0x85a3, 0x01e8, 0x83bb
+    dw 0x0409, 0xf632, 0xf4e0, 0xf989
+    dw 0x040a, 0xfb77, 0xfb4e, 0xfc00
+    dw 0x040b, 0x8a03, 0x0bb5, 0x0364
+    dw 0x040c, 0xf4d1, 0xf2a2, 0xf811
+    dw 0x040d, 0xfb52, 0xf659, 0xfc00
+    dw 0x040e, 0x048e, 0x80b9, 0x03d5
+    dw 0x040f, 0xf4db, 0xf2f3, 0xf82a
+    dw 0x0410, 0x02c3, 0x83c9, 0x8106
+    dw 0x0411, 0x0695, 0x87d5, 0x8140
+    dw 0x0412, 0x8ae4, 0x06cf, 0x86f9
+    dw 0x0413, 0x778f, 0x74ab, 0x7a1d
+    dw 0x0414, 0xf715, 0xf73b, 0xfb28
+    dw 0x0415, 0x8181, 0x0076, 0x810b
+    dw 0x0416, 0x0671, 0x865e, 0x0013
+    dw 0x0417, 0x808d, 0x0071, 0x801c
+    dw 0x0418, 0x0318, 0x83bb, 0x80a3
+    dw 0x0419, 0x82e7, 0x023a, 0x80ad
+    dw 0x041a, 0x0710, 0x84a1, 0x026f
+    dw 0x041b, 0xf457, 0xf592, 0xf8f4
+    dw 0x041c, 0x77a8, 0x756e, 0x7a8b
+    dw 0x041d, 0x7aec, 0x7985, 0x7c00
+    dw 0x041e, 0x0a11, 0x8a5b, 0x8094
+    dw 0x041f, 0x82e6, 0x02fb, 0x0015
+    dw 0x0420, 0x89b9, 0x08fc, 0x817a
+    dw 0x0421, 0x0a0a, 0x8983, 0x010e
+    dw 0x0422, 0x79e7, 0x7a74, 0x7c00
+    dw 0x0423, 0x01d1, 0x824c, 0x807b
+    dw 0x0424, 0xf5de, 0xf287, 0xf891
+    dw 0x0425, 0x0bdb, 0x86c0, 0x087b
+    dw 0x0426, 0xfbd6, 0xf672, 0xfc00
+    dw 0x0427, 0xfa9c, 0xf824, 0xfc00
+    dw 0x0428, 0x0288, 0x8262, 0x0026
+    dw 0x0429, 0xf667, 0xf77d, 0xfaf2
+    dw 0x042a, 0x028f, 0x8224, 0x006b
+    dw 0x042b, 0x039c, 0x83a5, 0x8009
+    dw 0x042c, 0xf74e, 0xf3b0, 0xf993
+    dw 0x042d, 0x8a4b, 0x0b00, 0x016a
+    dw 0x042e, 0x78c5, 0x75b4, 0x7b9f
+    dw 0x042f, 0x778c, 0x7606, 0x7ac9
+    dw 0x0430, 0xfbbe, 0xf46b, 0xfc00
+    dw 0x0431, 0x0455, 0x82c3, 0x0192
+    dw 0x0432, 0x79cf, 0x7bb9, 0x7c00
+    dw 0x0433, 0x09a5, 0x8665, 0x04e5
+    dw 0x0434, 0xf8d4, 0xf939, 0xfc00
+    dw 0x0435, 0x8a24, 0x0a1a, 0x8014
+    dw 0x0436, 0xfb0f, 0xf484, 0xfc00
+    dw 0x0437, 0x837b, 0x026c, 0x810f
+    dw 0x0438, 0x79fc, 0x7623, 0x7c00
+    dw 0x0439, 0xfbeb, 0xf78c, 0xfc00
+    dw 0x043a, 0x0564, 0x86e7, 0x8183
+    dw 0x043b, 0x8577, 0x00cd, 0x84aa
+    dw 0x043c, 0x7453, 0x7651, 0x7952
+    dw 0x043d, 0xf567, 0xf1a4, 0xf81c
+    dw 0x043e, 0x7b22, 0x7b3c, 0x7c00
+    dw 0x043f, 0x75ae, 0x70d4, 0x780c
+    dw 0x0440, 0x05ac, 0x861f, 0x8073
+    dw 0x0441, 0x7ab0, 0x78b3, 0x7c00
+    dw 0x0442, 0x8361, 0x00c2, 0x829f
+    dw 0x0443, 0xf6ee, 0xf269, 0xf911
+    dw 0x0444, 0x88ad, 0x068d, 0x82cd
+    dw 0x0445, 0xf807, 0xf4eb, 0xfa7c
+    dw 0x0446, 0x7b45, 0x748f, 0x7c00
+    dw 0x0447, 0x0769, 0x8326, 0x0443
+    dw 0x0448, 0x896a, 0x078a, 0x834a
+    dw 0x0449, 0x7b36, 0x78f5, 0x7c00
+    dw 0x044a, 0x074b, 0x832c, 0x041f
+    dw 0x044b, 0xf82e, 0xf833, 0xfc00
+    dw 0x044c, 0xf6ac, 0xf40f, 0xf95e
+    dw 0x044d, 0xf464, 0xf7dd, 0xfa20
+    dw 0x044e, 0xfa75, 0xf8d2, 0xfc00
+    dw 0x044f, 0x7bd9, 0x7589, 0x7c00
+    dw 0x0450, 0x7ac8, 0x79dc, 0x7c00
+    dw 0x0451, 0x0bcb, 0x8760, 0x081b
+    dw 0x0452, 0x837e, 0x01f1, 0x818d
+    dw 0x0453, 0x0831, 0x8be2, 0x8762
+    dw 0x0454, 0x0af9, 0x8579, 0x083c
+    dw 0x0455, 0xfa35, 0xf6fb, 0xfc00
+    dw 0x0456, 0x03d0, 0x83b0, 0x0020
+    dw 0x0457, 0x7508, 0x761d, 0x7992
+    dw 0x0458, 0xf463, 0xf386, 0xf813
+    dw 0x0459, 0x7559, 0x732e, 0x7878
+    dw 0x045a, 0x06a1, 0x80f3, 0x05ae
+    dw 0x045b, 0x766e, 0x763d, 0x7a56
+    dw 0x045c, 0x0687, 0x81f3, 0x0494
+    dw 0x045d, 0x8736, 0x0260, 0x84d6
+    dw 0x045e, 0x09be, 0x845f, 0x071d
+    dw 0x045f, 0x0b3d, 0x88be, 0x04fe
+    dw 0x0460, 0x0b69, 0x86f6, 0x07dc
+    dw 0x0461, 0x893a, 0x0ae7, 0x035a
+    dw 0x0462, 0x0628, 0x832c, 0x02fc
+    dw 0x0463, 0x8367, 0x02d4, 0x8093
+    dw 0x0464, 0x7948, 0x7a46, 0x7c00
+    dw 0x0465, 0x0132, 0x8230, 0x80fe
+    dw 0x0466, 0x0588, 0x8084, 0x0504
+    dw 0x0467, 0x0895, 0x8a2f, 0x8334
+    dw 0x0468, 0x77d7, 0x742c, 0x7a02
+    dw 0x0469, 0xf8d0, 0xf934, 0xfc00
+    dw 0x046a, 0xf8df, 0xfbe4, 0xfc00
+    dw 0x046b, 0x7482, 0x7761, 0x79f2
+    dw 0x046c, 0xfa6b, 0xfa59, 0xfc00
+    dw 0x046d, 0x04fd, 0x8701, 0x8204
+    dw 0x046e, 0x8bbb, 0x0886, 0x866a
+    dw 0x046f, 0x74ce, 0x74ff, 0x78e6
+    dw 0x0470, 0xf9dc, 0xf9c3, 0xfc00
+    dw 0x0471, 0x04ae, 0x8128, 0x0386
+    dw 0x0472, 0x8bc6, 0x044b, 0x89a0
+    dw 0x0473, 0x7649, 0x7606, 0x7a28
+    dw 0x0474, 0x0b97, 0x8954, 0x0486
+    dw 0x0475, 0x7aaf, 0x75e0, 0x7c00
+    dw 0x0476, 0x79d8, 0x7562, 0x7c00
+    dw 0x0477, 0x790d, 0x7477, 0x7b48
+    dw 0x0478, 0x88c9, 0x0854, 0x80ea
+    dw 0x0479, 0x0427, 0x811e, 0x0309
+    dw 0x047a, 0x0215, 0x8082, 0x0193
+    dw 0x047b, 0x8475, 0x068a, 0x0215
+    dw 0x047c, 0x787f, 0x79f3, 0x7c00
+    dw 0x047d, 0x0331, 0x81cf, 0x0162
+    dw 0x047e, 0x798d, 0x7861, 0x7c00
+    dw 0x047f, 0x015f, 0x8172, 0x8013
+    dw 0x0480, 0x830b, 0x0331, 0x0026
+    dw 0x0481, 0xf40f, 0xf44a, 0xf82c
+    dw 0x0482, 0xf695, 0xf17b, 0xf8a9
+    dw 0x0483, 0xf723, 0xf42c, 0xf9a8
+    dw 0x0484, 0x0ac2, 0x8950, 0x02e4
+    dw 0x0485, 0x028b, 0x8124, 0x0167
+    dw 0x0486, 0x8829, 0x091c, 0x01e6
+    dw 0x0487, 0x8771, 0x055a, 0x8217
+    dw 0x0488, 0x0553, 0x84a6, 0x00ad
+    dw 0x0489, 0x0149, 0x8260, 0x8117
+    dw 0x048a, 0x7bfc, 0x79d7, 0x7c00
+    dw 0x048b, 0x75ec, 0x7562, 0x79a7
+    dw 0x048c, 0xf78a, 0xf5ac, 0xfa9b
+    dw 0x048d, 0x00be, 0x8052, 0x006c
+    dw 0x048e, 0xf9dd, 0xf8cf, 0xfc00
+    dw 0x048f, 0x08b2, 0x8a05, 0x82a6
+    dw 0x0490, 0x8733, 0x0081, 0x86b2
+    dw 0x0491, 0x7542, 0x7372, 0x787e
+    dw 0x0492, 0xf93e, 0xf9cb, 0xfc00
+    dw 0x0493, 0x84c7, 0x0404, 0x80c3
+    dw 0x0494, 0x0681, 0x84d1, 0x01b0
+    dw 0x0495, 0x819e, 0x0381, 0x01e3
+    dw 0x0496, 0x889f, 0x0623, 0x831b
+    dw 0x0497, 0xf7e3, 0xf65b, 0xfb1f
+    dw 0x0498, 0x78a0, 0x7814, 0x7c00
+    dw 0x0499, 0xfba2, 0xf443, 0xfc00
+    dw 0x049a, 0x81c2, 0x00ac, 0x8116
+    dw 0x049b, 0xf585, 0xf1f5, 0xf840
+    dw 0x049c, 0xfa95, 0xf624, 0xfc00
+    dw 0x049d, 0x849e, 0x042f, 0x806f
+    dw 0x049e, 0x7a2e, 0x78e8, 0x7c00
+    dw 0x049f, 0x79ff, 0x76be, 0x7c00
+    dw 0x04a0, 0xfa46, 0xfb6d, 0xfc00
+    dw 0x04a1, 0x8a14, 0x0760, 0x84c8
+    dw 0x04a2, 0x81b1, 0x00b2, 0x80ff
+    dw 0x04a3, 0x0134, 0x8262, 0x812e
+    dw 0x04a4, 0x0044, 0x8162, 0x811e
+    dw 0x04a5, 0xf7f4, 0xf0c6, 0xf92c
+    dw 0x04a6, 0xfbd2, 0xfb0a, 0xfc00
+    dw 0x04a7, 0x0adb, 0x8b41, 0x80cc
+    dw 0x04a8, 0x0a13, 0x8a59, 0x808c
+    dw 0x04a9, 0x7464, 0x72cd, 0x77ca
+    dw 0x04aa, 0x0012, 0x81dc, 0x81ca
+    dw 0x04ab, 0x05cb, 0x8229, 0x03a2
+    dw 0x04ac, 0x7566, 0x709c, 0x77b4
+    dw 0x04ad, 0x7838, 0x7aa5, 0x7c00
+    dw 0x04ae, 0x007e, 0x818c, 0x810e
+    dw 0x04af, 0xfb3d, 0xfa61, 0xfc00
+    dw 0x04b0, 0x823a, 0x00e4, 0x8156
+    dw 0x04b1, 0x0429, 0x8324, 0x0105
+    dw 0x04b2, 0x822f, 0x0393, 0x0164
+    dw 0x04b3, 0x8a89, 0x07f9, 0x8519
+    dw 0x04b4, 0x06c4, 0x830d, 0x03b7
+    dw 0x04b5, 0x89ea, 0x0acb, 0x01c2
+    dw 0x04b6, 0x858a, 0x0245, 0x8345
+    dw 0x04b7, 0x0481, 0x84d7, 0x8056
+    dw 0x04b8, 0x7bff, 0x7bcd, 0x7c00
+    dw 0x04b9, 0x0b03, 0x86d4, 0x0732
+    dw 0x04ba, 0x02ad, 0x8129, 0x0184
+    dw 0x04bb, 0xf95a, 0xf945, 0xfc00
+    dw 0x04bc, 0x8af1, 0x043b, 0x88d4
+    dw 0x04bd, 0xf60b, 0xf02e, 0xf811
+    dw 0x04be, 0x7bdf, 0x7827, 0x7c00
+    dw 0x04bf, 0x88ff, 0x043d, 0x85c1
+    dw 0x04c0, 0xfbf4, 0xf56b, 0xfc00
+    dw 0x04c1, 0x7a3d, 0x7939, 0x7c00
+    dw 0x04c2, 0xf499, 0xf5e0, 0xf93c
+    dw 0x04c3, 0x83ea, 0x00ab, 0x833f
+    dw 0x04c4, 0x0443, 0x8643, 0x8200
+    dw 0x04c5, 0xf63d, 0xf4b1, 0xf977
+    dw 0x04c6, 0x7bee, 0x77e5, 0x7c00
+    dw 0x04c7, 0xf8d9, 0xf8d0, 0xfc00
+    dw 0x04c8, 0x0b09, 0x875a, 0x06b8
+    dw 0x04c9, 0x7450, 0x702e, 0x7667
+    dw 0x04ca, 0x77a7, 0x74e1, 0x7a44
+    dw 0x04cb, 0x8ac5, 0x0b75, 0x0160
+    dw 0x04cc, 0xf6ac, 0xf075, 0xf873
+    dw 0x04cd, 0x82c6, 0x0095, 0x8231
+    dw 0x04ce, 0x0a3e, 0x89f7, 0x008e
+    dw 0x04cf, 0x0aa8, 0x8757, 0x05f9
+    dw 0x04d0, 0xf419, 0xf6de, 0xf97c
+    dw 0x04d1, 0x8273, 0x0160, 0x8113
+    dw 0x04d2, 0x750d, 0x73ba, 0x7875
+    dw 0x04d3, 0x7670, 0x76f0, 0x7ab0
+    dw 0x04d4, 0xfbc8, 0xf4da, 0xfc00
+    dw 0x04d5, 0x7973, 0x753a, 0x7c00
+    dw 0x04d6, 0x8b0b, 0x06c6, 0x8750
+    dw 0x04d7, 0x86dc, 0x03fb, 0x82e1
+    dw 0x04d8, 0xf7c8, 0xf428, 0xf9f8
+    dw 0x04d9, 0x0229, 0x81aa, 0x007f
+    dw 0x04da, 0x80bf, 0x01ce, 0x010f
+    dw 0x04db, 0x801e, 0x0095, 0x0077
+    dw 0x04dc, 0xf5d8, 0xf50c, 0xf972
+    dw 0x04dd, 0x050a, 0x8270, 0x029a
+    dw 0x04de, 0x88ff, 0x0a00, 0x0202
+    dw 0x04df, 0x7884, 0x7556, 0x7b2f
+    dw 0x04e0, 0xfb69, 0xf5ba, 0xfc00
+    dw 0x04e1, 0xf97f, 0xf4a3, 0xfbd0
+    dw 0x04e2, 0x8647, 0x021e, 0x8429
+    dw 0x04e3, 0xf775, 0xf3a6, 0xf9a4
+    dw 0x04e4, 0x7710, 0x775b, 0x7b36
+    dw 0x04e5, 0xf718, 0xf313, 0xf951
+    dw 0x04e6, 0x792f, 0x7488, 0x7b73
+    dw 0x04e7, 0x825f, 0x03b2, 0x0153
+    dw 0x04e8, 0xf8c0, 0xf77b, 0xfc00
+    dw 0x04e9, 0xf9ed, 0xf88d, 0xfc00
+    dw 0x04ea, 0x09fc, 0x8b01, 0x820a
+    dw 0x04eb, 0x06d4, 0x8449, 0x028b
+    dw 0x04ec, 0x0894, 0x86de, 0x024a
+    dw 0x04ed, 0xf8ab, 0xfb8c, 0xfc00
+    dw 0x04ee, 0x0600, 0x8531, 0x00cf
+    dw 0x04ef, 0x8665, 0x0053, 0x8612
+    dw 0x04f0, 0xfadf, 0xf8e2, 0xfc00
+    dw 0x04f1, 0xf4d0, 0xf099, 0xf71c
+    dw 0x04f2, 0x8954, 0x095e, 0x0014
+    dw 0x04f3, 0xf90c, 0xfb69, 0xfc00
+    dw 0x04f4, 0x0a9e, 0x88fc, 0x0344
+    dw 0x04f5, 0x7415, 0x755d, 0x78b9
+    dw 0x04f6, 0x00c9, 0x834b, 0x8282
+    dw 0x04f7, 0x74b1, 0x7190, 0x7779
+    dw 0x04f8, 0x7ac9, 0x75d0, 0x7c00
+    dw 0x04f9, 0x034f, 0x83f9, 0x80aa
+    dw 0x04fa, 0x8201, 0x028d, 0x008c
+    dw 0x04fb, 0x809d, 0x0328, 0x028b
+    dw 0x04fc, 0x8422, 0x019a, 0x8288
+    dw 0x04fd, 0xf4ff, 0xf4c6, 0xf8e2
+    dw 0x04fe, 0x87ad, 0x0002, 0x87ab
+    dw 0x04ff, 0xf9c3, 0xf436, 0xfbde
+    dw 0x0500, 0xf6e2, 0xf450, 0xf999
+    dw 0x0501, 0x7b33, 0x7705, 0x7c00
+    dw 0x0502, 0xfbe2, 0xf506, 0xfc00
+    dw 0x0503, 0xfbd7, 0xf420, 0xfc00
+    dw 0x0504, 0x8816, 0x0413, 0x8419
+    dw 0x0505, 0x0077, 0x83a3, 0x832c
+    dw 0x0506, 0x8656, 0x07b6, 0x0160
+    dw 0x0507, 0xf5f1, 0xf037, 0xf806
+    dw 0x0508, 0x0a45, 0x8b20, 0x81b6
+    dw 0x0509, 0x03d6, 0x812a, 0x02ac
+    dw 0x050a, 0xfa03, 0xf744, 0xfc00
+    dw 0x050b, 0x8275, 0x0318, 0x00a3
+    dw 0x050c, 0x8540, 0x0599, 0x0059
+    dw 0x050d, 0xf9fa, 0xf58e, 0xfc00
+    dw 0x050e, 0x85f6, 0x0641, 0x004b
+    dw 0x050f, 0x02a5, 0x8264, 0x0041
+    dw 0x0510, 0x0855, 0x8715, 0x0195
+    dw 0x0511, 0x04b5, 0x879a, 0x82e5
+    dw 0x0512, 0x03ad, 0x8379, 0x0034
+    dw 0x0513, 0x7451, 0x73be, 0x7818
+    dw 0x0514, 0x8172, 0x0157, 0x801b
+    dw 0x0515, 0x8bdb, 0x08f6, 0x85ca
+    dw 0x0516, 0x7985, 0x7423, 0x7b96
+    dw 0x0517, 0x837a, 0x000b, 0x836f
+    dw 0x0518, 0xf48e, 0xf1e8, 0xf782
+    dw 0x0519, 0x816c, 0x02a8, 0x013c
+    dw 0x051a, 0x76e7, 0x7363, 0x794c
+    dw 0x051b, 0x8029, 0x0299, 0x0270
+    dw 0x051c, 0x8200, 0x01ce, 0x8032
+    dw 0x051d, 0x755d, 0x710e, 0x77e4
+    dw 0x051e, 0x897b, 0x0bd0, 0x04aa
+    dw 0x051f, 0x09e2, 0x8998, 0x0094
+    dw 0x0520, 0x7b39, 0x7a26, 0x7c00
+    dw 0x0521, 0xf95b, 0xf40b, 0xfb60
+    dw 0x0522, 0xf518, 0xf037, 0xf734
+    dw 0x0523, 0xfa7e, 0xf989, 0xfc00
+    dw 0x0524, 0x8b9f, 0x08cc, 0x85a6
+    dw 0x0525, 0x7a1c, 0x7b05, 0x7c00
+    dw 0x0526, 0x7697, 0x7138, 0x789a
+    dw 0x0527, 0xfa4d, 0xf46f, 0xfc00
+    dw 0x0528, 0x0126, 0x8191, 0x806b
+    dw 0x0529, 0x060a, 0x806b, 0x059f
+    dw 0x052a, 0xf73c, 0xf18b, 0xf901
+    dw 0x052b, 0xf90e, 0xf4d3, 0xfb78
+    dw 0x052c, 0x78db, 0x7992, 0x7c00
+    dw 0x052d, 0x8388, 0x0201, 0x8187
+    dw 0x052e, 0x806f, 0x0287, 0x0218
+    dw 0x052f, 0x8635, 0x052e, 0x8107
+    dw 0x0530, 0xf5b5, 0xf79c, 0xfaa8
+    dw 0x0531, 0x800e, 0x0393, 0x0385
+    dw 0x0532, 0x76bf, 0x717c, 0x78be
+    dw 0x0533, 0x74c6, 0x71f3, 0x77c0
+    dw 0x0534, 0x8a2b, 0x0bc2, 0x032e
+    dw 0x0535, 0xfacf, 0xf681, 0xfc00
+    dw 0x0536, 0xf979, 0xf99c, 0xfc00
+    dw 0x0537, 0x0165, 0x83ed, 0x8288
+    dw 0x0538, 0x058b, 0x8303, 0x0288
+    dw 0x0539, 0x036c, 0x804d, 0x031f
+
+    ; Mostly subnormal values
+    dw 0x053a, 0x80db, 0x8192, 0x826d
+    dw 0x053b, 0x01b5, 0x819d, 0x0018
+    dw 0x053c, 0x017a, 0x9e77, 0x9e71
+    dw 0x053d, 0x007d, 0x0213, 0x0290
+    dw 0x053e, 0x00b3, 0x022d, 0x02e0
+    dw 0x053f, 0x81b7, 0x02db, 0x0124
+    dw 0x0540, 0x2b8c, 0x0306, 0x2b8e
+    dw 0x0541, 0x007e, 0x82f7, 0x8279
+    dw 0x0542, 0x82ae, 0x0206, 0x80a8
+    dw 0x0543, 0x31b7, 0x8016, 0x31b7
+    dw 0x0544, 0x01c5, 0x82e1, 0x811c
+    dw 0x0545, 0x00ec, 0x66a2, 0x66a2
+    dw 0x0546, 0x0123, 0x019e, 0x02c1
+    dw 0x0547, 0x83bd, 0x83a2, 0x875f
+    dw 0x0548, 0x012e, 0x0206, 0x0334
+    dw 0x0549, 0x8188, 0x8319, 0x84a1
+    dw 0x054a, 0x819e, 0x0127, 0x8077
+    dw 0x054b, 0xb6dc, 0x03e4, 0xb6dc
+    dw 0x054c, 0x29ab, 0x01d8, 0x29ac
+    dw 0x054d, 0x8274, 0xdc9a, 0xdc9a
+    dw 0x054e, 0xfb8b, 0x16ed, 0xfb8b
+    dw 0x054f, 0x7566, 0x02a0, 0x7566
+    dw 0x0550, 0x0020, 0x8285, 0x8265
+    dw 0x0551, 0x8013, 0x0052, 0x003f
+    dw 0x0552, 0x80e0, 0x037e, 0x029e
+    dw 0x0553, 0x60a9, 0x82d1, 0x60a9
+    dw 0x0554, 0x82fa, 0x8018, 0x8312
+    dw 0x0555, 0x013c, 0x03bd, 0x04f9
+    dw 0x0556, 0xd5ad, 0x39ff, 0xd5a1
+    dw 0x0557, 0x804a, 0x8065, 0x80af
+    dw 0x0558, 0xe964, 0x003d, 0xe964
+    dw 0x0559, 0xa768, 0x0039, 0xa768
+    dw 0x055a, 0x026f, 0x03e9, 0x0658
+    dw 0x055b, 0x004e, 0xcbe7, 0xcbe7
+    dw 0x055c, 0xa863, 0x022f, 0xa862
+    dw 0x055d, 0x014b, 0x021a, 0x0365
+    dw 0x055e, 0x81fd, 0x034e, 0x0151
+    dw 0x055f, 0x0032, 0x2542, 0x2542
+    dw 0x0560, 0xf29b, 0x033b, 0xf29b
+    dw 0x0561, 0x0154, 0x80be, 0x0096
+    dw 0x0562, 0x018f, 0x8274, 0x80e5
+    dw 0x0563, 0x012c, 0x832e, 0x8202
+    dw 0x0564, 0x82ff, 0x817f, 0x847e
+    dw 0x0565, 0xe0b6, 0x02f2, 0xe0b6
+    dw 0x0566, 0x0062, 0xd291, 0xd291
+    dw 0x0567, 0x017a, 0x803a, 0x0140
+    dw 0x0568, 0x82ec, 0x814c, 0x8438
+    dw 0x0569, 0x8ad4, 0x2337, 0x231c
+    dw 0x056a, 0x23cb, 0xb9f4, 0xb9d5
+    dw 0x056b, 0x0097, 0x818c, 0x80f5
+    dw 0x056c, 0x00bb, 0x570d, 0x570d
+    dw 0x056d, 0x81ae, 0x8343, 0x84f1
+    dw 0x056e, 0x00d6, 0x83cb, 0x82f5
+    dw 0x056f, 0x8208, 0x0197, 0x8071
+    dw 0x0570, 0x036e, 0x80a0, 0x02ce
+    dw 0x0571, 0x018d, 0x83b1, 0x8224
+    dw 0x0572, 0x832b, 0x5349, 0x5349
+    dw 0x0573, 0x0110, 0x83d2, 0x82c2
+    dw 0x0574, 0x83c6, 0x010a, 0x82bc
+    dw 0x0575, 0x828b, 0x8334, 0x85bf
+    dw 0x0576, 0xf2b6, 0xa5e2, 0xf2b6
+    dw 0x0577, 0x439e, 0x801e, 0x439e
+    dw 0x0578, 0x801d, 0x03af, 0x0392
+    dw 0x0579, 0x835d, 0x819e, 0x84fb
+    dw 0x057a, 0x000e, 0xb519, 0xb519
+    dw 0x057b, 0x28ab, 0xb0fb, 0xafa0
+    dw 0x057c, 0x0181, 0x80ae, 0x00d3
+    dw 0x057d, 0x033d, 0x0229, 0x0566
+    dw 0x057e, 0x00d4, 0x82e0, 0x820c
+    dw 0x057f, 0x822b, 0x8334, 0x855f
+    dw 0x0580, 0x8066, 0x80ea, 0x8150
+    dw 0x0581, 0x8722, 0x00ef, 0x8633
+    dw 0x0582, 0x004c, 0x0162, 0x01ae
+    dw 0x0583, 0x802e, 0x0203, 0x01d5
+    dw 0x0584, 0xcc6c, 0x026d, 0xcc6c
+    dw 0x0585, 0x838a, 0x8139, 0x84c3
+    dw 0x0586, 0x8215, 0x804b, 0x8260
+    dw 0x0587, 0x00ed, 0x0288, 0x0375
+    dw 0x0588, 0xd6b8, 0x805c, 0xd6b8
+    dw 0x0589, 0x8072, 0x39ef, 0x39ef
+    dw 0x058a, 0x3068, 0xddad, 0xddac
+    dw 0x058b, 0x0000, 0xba25, 0xba25
+    dw 0x058c, 0x48a1, 0x827b, 0x48a1
+    dw 0x058d, 0xccce, 0x01ef, 0xccce
+    dw 0x058e, 0x7093, 0x0376, 0x7093
+    dw 0x058f, 0x02e3, 0xe8f3, 0xe8f3
+    dw 0x0590, 0x010d, 0x7004, 0x7004
+    dw 0x0591, 0x50cd, 0x2dec, 0x50d0
+    dw 0x0592, 0x82fd, 0x83af, 0x86ac
+    dw 0x0593, 0x007b, 0x9902, 0x98fe
+    dw 0x0594, 0x82b4, 0x818b, 0x843f
+    dw 0x0595, 0x0002, 0xb72e, 0xb72e
+    dw 0x0596, 0x818c, 0x8053, 0x81df
+    dw 0x0597, 0x021e, 0x009b, 0x02b9
+    dw 0x0598, 0x3542, 0x03b3, 0x3542
+    dw 0x0599, 0x615e, 0x02b5, 0x615e
+    dw 0x059a, 0x8301, 0x02a5, 0x805c
+    dw 0x059b, 0x067e, 0x8891, 0x82a4
+    dw 0x059c, 0x00b7, 0x814f, 0x8098
+    dw 0x059d, 0x03fd, 0xa331, 0xa329
+    dw 0x059e, 0x0017, 0x8109, 0x80f2
+    dw 0x059f, 0x039a, 0x822f, 0x016b
+    dw 0x05a0, 0xbbf0, 0x0071, 0xbbf0
+    dw 0x05a1, 0x03c7, 0x67af, 0x67af
+    dw 0x05a2, 0x9b95, 0x027c, 0x9b81
+    dw 0x05a3, 0x811a, 0x79b3, 0x79b3
+    dw 0x05a4, 0x80b1, 0x0342, 0x0291
+    dw 0x05a5, 0x824e, 0x020d, 0x8041
+    dw 0x05a6, 0x8284, 0x72b7, 0x72b7
+    dw 0x05a7, 0x01e3, 0x0023, 0x0206
+    dw 0x05a8, 0x0029, 0x03ec, 0x0415
+    dw 0x05a9, 0x8188, 0x0339, 0x01b1
+    dw 0x05aa, 0xd6b9, 0x0133, 0xd6b9
+    dw 0x05ab, 0x0292, 0x8160, 0x0132
+    dw 0x05ac, 0x80f6, 0x0077, 0x807f
+    dw 0x05ad, 0x3b97, 0x46fd, 0x47f0
+    dw 0x05ae, 0x2047, 0x8120, 0x2045
+    dw 0x05af, 0x03c1, 0x21df, 0x21e7
+    dw 0x05b0, 0xbcf3, 0xf310, 0xf310
+    dw 0x05b1, 0x281b, 0x000e, 0x281b
+    dw 0x05b2, 0x83dd, 0x8271, 0x864e
+    dw 0x05b3, 0x051f, 0x834d, 0x01d2
+    dw 0x05b4, 0x0395, 0x81d1, 0x01c4
+    dw 0x05b5, 0x0125, 0x8a6c, 0x89da
+    dw 0x05b6, 0x00d4, 0x82f4, 0x8220
+    dw 0x05b7, 0x0051, 0xe2fd, 0xe2fd
+    dw 0x05b8, 0x82b6, 0x817d, 0x8433
+    dw 0x05b9, 0x004a, 0x8015, 0x0035
+    dw 0x05ba, 0x814f, 0x5589, 0x5589
+    dw 0x05bb, 0x8376, 0x8091, 0x8407
+    dw 0x05bc, 0x8310, 0x8203, 0x8513
+    dw 0x05bd, 0x823b, 0x0336, 0x00fb
+    dw 0x05be, 0x01ff, 0x018f, 0x038e
+    dw 0x05bf, 0x015e, 0x4029, 0x4029
+    dw 0x05c0, 0x01df, 0x03cb, 0x05aa
+    dw 0x05c1, 0x013f, 0xad81, 0xad81
+    dw 0x05c2, 0xc1c9, 0x8243, 0xc1c9
+    dw 0x05c3, 0x007b, 0x80f1, 0x8076
+    dw 0x05c4, 0x81d2, 0x0290, 0x00be
+    dw 0x05c5, 0x8161, 0x005b, 0x8106
+    dw 0x05c6, 0x82e5, 0xd0c6, 0xd0c6
+    dw 0x05c7, 0x8323, 0x0345, 0x0022
+    dw 0x05c8, 0x0337, 0x0022, 0x0359
+    dw 0x05c9, 0x0181, 0x0277, 0x03f8
+    dw 0x05ca, 0x01f4, 0x8366, 0x8172
+    dw 0x05cb, 0x16e3, 0x6d39, 0x6d39
+    dw 0x05cc, 0x8117, 0x80f6, 0x820d
+    dw 0x05cd, 0x1518, 0x02c0, 0x1544
+    dw 0x05ce, 0x03a9, 0x03c0, 0x0769
+    dw 0x05cf, 0x82ee, 0x8340, 0x862e
+    dw 0x05d0, 0x03af, 0x813f, 0x0270
+    dw 0x05d1, 0x0386, 0xb30e, 0xb30e
+    dw 0x05d2, 0x82cd, 0x0087, 0x8246
+    dw 0x05d3, 0x00b0, 0x830c, 0x825c
+    dw 0x05d4, 0x83cf, 0xd706, 0xd706
+    dw 0x05d5, 0x0339, 0x8198, 0x01a1
+    dw 0x05d6, 0x8306, 0xfaeb, 0xfaeb
+    dw 0x05d7, 0x81bb, 0x0085, 0x8136
+    dw 0x05d8, 0x0090, 0x01ee, 0x027e
+    dw 0x05d9, 0x0351, 0x81a7, 0x01aa
+    dw 0x05da, 0x02a2, 0x830b, 0x8069
+    dw 0x05db, 0x8173, 0xf923, 0xf923
+    dw 0x05dc, 0x80a7, 0x5620, 0x5620
+    dw 0x05dd, 0x6774, 0x00e7, 0x6774
+    dw 0x05de, 0x010d, 0x02a6, 0x03b3
+    dw 0x05df, 0x1635, 0x83a0, 0x15fb
+    dw 0x05e0, 0xd9f4, 0x81d1, 0xd9f4
+    dw 0x05e1, 0x00f9, 0x0329, 0x0422
+    dw 0x05e2, 0x00ac, 0xd8a6, 0xd8a6
+    dw 0x05e3, 0x8218, 0x819d, 0x83b5
+    dw 0x05e4, 0x8325, 0x02eb, 0x803a
+    dw 0x05e5, 0x0239, 0x0087, 0x02c0
+    dw 0x05e6, 0x8388, 0x0319, 0x806f
+    dw 0x05e7, 0x8330, 0x8067, 0x8397
+    dw 0x05e8, 0x00f3, 0x838f, 0x829c
+    dw 0x05e9, 0x81c7, 0x82ef, 0x84b6
+    dw 0x05ea, 0x01e2, 0x03ec, 0x05ce
+    dw 0x05eb, 0x8091, 0x8167, 0x81f8
+    dw 0x05ec, 0x02d7, 0x01b4, 0x048b
+    dw 0x05ed, 0x0106, 0x8357, 0x8251
+    dw 0x05ee, 0x8252, 0xe851, 0xe851
+    dw 0x05ef, 0x81da, 0x03a9, 0x01cf
+    dw 0x05f0, 0xaa1b, 0xc22e, 0xc246
+    dw 0x05f1, 0x5f09, 0xf915, 0xf907
+    dw 0x05f2, 0x1627, 0x5128, 0x5128
+    dw 0x05f3, 0x03e8, 0xa254, 0xa24c
+    dw 0x05f4, 0xe0df, 0x0101, 0xe0df
+    dw 0x05f5, 0x8053, 0x00ab, 0x0058
+    dw 0x05f6, 0x814f, 0x82d3, 0x8422
+    dw 0x05f7, 0x83f8, 0x02a5, 0x8153
+    dw 0x05f8, 0x8596, 0x018f, 0x8407
+    dw 0x05f9, 0x8342, 0xcdb1, 0xcdb1
+    dw 0x05fa, 0xa567, 0xbaa5, 0xbad0
+    dw 0x05fb, 0x80d6, 0x8049, 0x811f
+    dw 0x05fc, 0x80a3, 0x83bb, 0x845e
+    dw 0x05fd, 0x8274, 0x0127, 0x814d
+    dw 0x05fe, 0x9217, 0x82ee, 0x9275
+    dw 0x05ff, 0xdd2d, 0x8023, 0xdd2d
+    dw 0x0600, 0x02a6, 0x0153, 0x03f9
+    dw 0x0601, 0x804c, 0x035c, 0x0310
+    dw 0x0602, 0x80d4, 0x02e6, 0x0212
+    dw 0x0603, 0x032b, 0x82c3, 0x0068
+    dw 0x0604, 0xb11f, 0x0189, 0xb11f
+    dw 0x0605, 0x0353, 0x03f8, 0x074b
+    dw 0x0606, 0x2366, 0x01f3, 0x236a
+    dw 0x0607, 0x447a, 0x83fa, 0x447a
+    dw 0x0608, 0x8186, 0x02fb, 0x0175
+    dw 0x0609, 0xf8ad, 0x8176, 0xf8ad
+    dw 0x060a, 0xc25d, 0x01d0, 0xc25d
+    dw 0x060b, 0x80a1, 0x03e9, 0x0348
+    dw 0x060c, 0xee3c, 0x03a7, 0xee3c
+    dw 0x060d, 0x811c, 0x7b2e, 0x7b2e
+    dw 0x060e, 0xf7e5, 0x0162, 0xf7e5
+    dw 0x060f, 0xe333, 0x07f9, 0xe333
+    dw 0x0610, 0x00cc, 0x8120, 0x8054
+    dw 0x0611, 0x81f7, 0x8150, 0x8347
+    dw 0x0612, 0x00de, 0x0004, 0x00e2
+    dw 0x0613, 0x174a, 0x0a19, 0x1807
+    dw 0x0614, 0x0044, 0x240d, 0x240d
+    dw 0x0615, 0x034f, 0x0019, 0x0368
+    dw 0x0616, 0x80c3, 0x0322, 0x025f
+    dw 0x0617, 0x0082, 0x8195, 0x8113
+    dw 0x0618, 0x80b5, 0x03f3, 0x033e
+    dw 0x0619, 0x2764, 0x010c, 0x2765
+    dw 0x061a, 0xe423, 0xa19c, 0xe423
+    dw 0x061b, 0x8295, 0x016b, 0x812a
+    dw 0x061c, 0x00c2, 0x8370, 0x82ae
+    dw 0x061d, 0x4916, 0x770e, 0x770f
+    dw 0x061e, 0x02e9, 0x495e, 0x495e
+    dw 0x061f, 0x81e4, 0x81a7, 0x838b
+    dw 0x0620, 0x800f, 0x8297, 0x82a6
+    dw 0x0621, 0x0078, 0x02f2, 0x036a
+    dw 0x0622, 0xacad, 0x0331, 0xacac
+    dw 0x0623, 0x03a3, 0x03d6, 0x0779
+    dw 0x0624, 0x9ab4, 0x3a08, 0x3a01
+    dw 0x0625, 0xcfdb, 0x035f, 0xcfdb
+    dw 0x0626, 0x8157, 0x01f0, 0x0099
+    dw 0x0627, 0x5aa7, 0xad54, 0x5aa6
+    dw 0x0628, 0x02c7, 0x0386, 0x064d
+    dw 0x0629, 0x008b, 0x02af, 0x033a
+    dw 0x062a, 0x81d6, 0x82ae, 0x8484
+    dw 0x062b, 0x00a7, 0x3338, 0x3338
+    dw 0x062c, 0x82ac, 0x8262, 0x850e
+    dw 0x062d, 0x8311, 0x83ab, 0x86bc
+    dw 0x062e, 0x0344, 0x80e6, 0x025e
+    dw 0x062f, 0x0022, 0x82ae, 0x828c
+    dw 0x0630, 0x0362, 0x1341, 0x13ad
+    dw 0x0631, 0x34c6, 0x035b, 0x34c6
+    dw 0x0632, 0x0345, 0x8060, 0x02e5
+    dw 0x0633, 0x834c, 0x80b9, 0x8405
+    dw 0x0634, 0x8ddb, 0xb446, 0xb447
+    dw 0x0635, 0x01e4, 0x01b9, 0x039d
+    dw 0x0636, 0x83e0, 0x402e, 0x402e
+    dw 0x0637, 0x12a5, 0x01d6, 0x12e0
+    dw 0x0638, 0x0230, 0x03e4, 0x0614
+    dw 0x0639, 0x011d, 0x739b, 0x739b
+    dw 0x063a, 0x831b, 0x8043, 0x835e
+    dw 0x063b, 0x820f, 0x8158, 0x8367
+    dw 0x063c, 0x022c, 0x001b, 0x0247
+    dw 0x063d, 0x800b, 0x8342, 0x834d
+    dw 0x063e, 0x8301, 0x832a, 0x862b
+    dw 0x063f, 0x6484, 0x0322, 0x6484
+    dw 0x0640, 0x83b9, 0x8143, 0x84fc
+    dw 0x0641, 0x00b3, 0x031b, 0x03ce
+    dw 0x0642, 0x816d, 0x31f1, 0x31f1
+    dw 0x0643, 0x804a, 0x836a, 0x83b4
+    dw 0x0644, 0x0108, 0x0182, 0x028a
+    dw 0x0645, 0x83c5, 0x068c, 0x02c7
+    dw 0x0646, 0x00cb, 0x808e, 0x003d
+    dw 0x0647, 0x815f, 0x01c2, 0x0063
+    dw 0x0648, 0x8b18, 0x834e, 0x8c60
+    dw 0x0649, 0x8161, 0x8323, 0x8484
+    dw 0x064a, 0xaf7a, 0x8201, 0xaf7b
+    dw 0x064b, 0x8a44, 0x01b4, 0x896a
+    dw 0x064c, 0x83be, 0x8288, 0x8646
+    dw 0x064d, 0x8214, 0x8040, 0x8254
+    dw 0x064e, 0x83e3, 0x8367, 0x874a
+    dw 0x064f, 0x8384, 0x026c, 0x8118
+    dw 0x0650, 0x0210, 0x83c1, 0x81b1
+    dw 0x0651, 0x00da, 0x8033, 0x00a7
+    dw 0x0652, 0x5aaf, 0x9e42, 0x5aaf
+    dw 0x0653, 0x24a9, 0x8095, 0x24a8
+    dw 0x0654, 0x0a1e, 0x83ea, 0x0829
+    dw 0x0655, 0x8016, 0x2628, 0x2628
+    dw 0x0656, 0x8004, 0x0303, 0x02ff
+    dw 0x0657, 0x00a5, 0x8261, 0x81bc
+    dw 0x0658, 0x0066, 0x8336, 0x82d0
+    dw 0x0659, 0x01a1, 0x5010, 0x5010
+    dw 0x065a, 0x5a55, 0x82de, 0x5a55
+    dw 0x065b, 0x0c8a, 0x8293, 0x0bca
+    dw 0x065c, 0x82ef, 0x023e, 0x80b1
+    dw 0x065d, 0x01fb, 0x03ab, 0x05a6
+    dw 0x065e, 0x0009, 0x014c, 0x0155
+    dw 0x065f, 0xfbb7, 0x6329, 0xfb9a
+    dw 0x0660, 0x0017, 0x1f43, 0x1f43
+    dw 0x0661, 0xa17c, 0x003c, 0xa17c
+    dw 0x0662, 0x8092, 0x0189, 0x00f7
+    dw 0x0663, 0x33bb, 0x035d, 0x33bb
+    dw 0x0664, 0x80e1, 0x83d5, 0x84b6
+    dw 0x0665, 0x03ca, 0x8041, 0x0389
+    dw 0x0666, 0x8009, 0x010a, 0x0101
+    dw 0x0667, 0x0047, 0xf591, 0xf591
+    dw 0x0668, 0x4ed6, 0x791b, 0x791c
+    dw 0x0669, 0x73fd, 0x02ad, 0x73fd
+    dw 0x066a, 0x0264, 0x82b7, 0x8053
+    dw 0x066b, 0x8161, 0x1a3d, 0x1a32
+    dw 0x066c, 0x4a6f, 0x01c0, 0x4a6f
+    dw 0x066d, 0x0380, 0x80d6, 0x02aa
+    dw 0x066e, 0x803d, 0x8100, 0x813d
+    dw 0x066f, 0x817c, 0x8295, 0x8411
+    dw 0x0670, 0x8039, 0x0062, 0x0029
+    dw 0x0671, 0xaefa, 0x835a, 0xaefb
+    dw 0x0672, 0x83c8, 0x83d1, 0x8799
+    dw 0x0673, 0x8071, 0x03f8, 0x0387
+    dw 0x0674, 0x8271, 0x8299, 0x850a
+    dw 0x0675, 0x826d, 0x8070, 0x82dd
+    dw 0x0676, 0x8394, 0x0120, 0x8274
+    dw 0x0677, 0x70c8, 0x03db, 0x70c8
+    dw 0x0678, 0xe91c, 0x0225, 0xe91c
+    dw 0x0679, 0x0029, 0x0374, 0x039d
+    dw 0x067a, 0x802e, 0x12c1, 0x12bb
+    dw 0x067b, 0x809a, 0x6c01, 0x6c01
+    dw 0x067c, 0x02ae, 0xec54, 0xec54
+    dw 0x067d, 0x83e1, 0x019a, 0x8247
+    dw 0x067e, 0x03b6, 0x8235, 0x0181
+    dw 0x067f, 0x8068, 0x008a, 0x0022
+    dw 0x0680, 0x0048, 0x8f22, 0x8f10
+    dw 0x0681, 0x0385, 0x8230, 0x0155
+    dw 0x0682, 0x1ce2, 0x812d, 0x1cdd
+    dw 0x0683, 0x00e0, 0xaa85, 0xaa85
+    dw 0x0684, 0x01f0, 0x371e, 0x371e
+
+    ; Rounding ties
+    dw 0x0685, 0xfadf, 0xeda4, 0xfb94
+    dw 0x0686, 0x503b, 0x2a00, 0x503c
+    dw 0x0687, 0x3c00, 0x9d40, 0x3bf6
+    dw 0x0688, 0xc91a, 0xc5b1, 0xcbf2
+    dw 0x0689, 0x52ac, 0x3dd0, 0x52da
+    dw 0x068a, 0x5d3b, 0x5334, 0x5e22
+    dw 0x068b, 0xd400, 0x2a00, 0xd3fe
+    dw 0x068c, 0xc600, 0x2840, 0xc5f8
+    dw 0x068d, 0x6d60, 0xcf80, 0x6d58
+    dw 0x068e, 0xf400, 0x5180, 0xf3fa
+    dw 0x068f, 0xa800, 0x0e20, 0xa7e8
+    dw 0x0690, 0x97c0, 0x8318, 0x97f2
+    dw 0x0691, 0xa3f0, 0x0140, 0xa3ee
+    dw 0x0692, 0xe580, 0xc940, 0xe58a
+    dw 0x0693, 0x7800, 0x4c00, 0x7800
+    dw 0x0694, 0x87dc, 0x8147, 0x8892
+    dw 0x0695, 0xf980, 0x6858, 0xf93a
+    dw 0x0696, 0x6400, 0x5834, 0x6486
+    dw 0x0697, 0x4300, 0x2380, 0x4308
+    dw 0x0698, 0x97e9, 0x8e00, 0x98b4
+    dw 0x0699, 0x5200, 0x3640, 0x520c
+    dw 0x069a, 0xe180, 0xbd00, 0xe182
+    dw 0x069b, 0x61e0, 0x5e32, 0x647c
+    dw 0x069c, 0x8e00, 0x8882, 0x9020
+    dw 0x069d, 0x8e20, 0x041a, 0x8d1a
+    dw 0x069e, 0xa400, 0x8780, 0xa408
+    dw 0x069f, 0x9898, 0x98b5, 0x9ca6
+    dw 0x06a0, 0xf7ec, 0xdec0, 0xf804
+    dw 0x06a1, 0x5d00, 0xc3c0, 0x5cf0
+    dw 0x06a2, 0x416f, 0x3f00, 0x4478
+    dw 0x06a3, 0x1b40, 0x0230, 0x1b52
+    dw 0x06a4, 0x2c00, 0x0c80, 0x2c04
+    dw 0x06a5, 0x7bc0, 0xf002, 0x7ac0
+    dw 0x06a6, 0x7300, 0xc400, 0x7300
+    dw 0x06a7, 0x4f20, 0x482a, 0x509a
+    dw 0x06a8, 0x5e0c, 0x4910, 0x5e34
+    dw 0x06a9, 0xb840, 0x2510, 0xb818
+    dw 0x06aa, 0xc210, 0x1a00, 0xc20e
+    dw 0x06ab, 0x6028, 0x5a02, 0x61a8
+    dw 0x06ac, 0xa340, 0x8240, 0xa344
+    dw 0x06ad, 0x2b00, 0x9020, 0x2af0
+    dw 0x06ae, 0x5620, 0x3580, 0x5626
+    dw 0x06af, 0x1000, 0x800e, 0x0ffc
+    dw 0x06b0, 0xad0c, 0x0d80, 0xad06
+    dw 0x06b1, 0xb600, 0x8800, 0xb600
+    dw 0x06b2, 0x208b, 0x0340, 0x2092
+    dw 0x06b3, 0x3213, 0x9380, 0x320c
+    dw 0x06b4, 0xa760, 0x0180, 0xa75e
+    dw 0x06b5, 0x5c00, 0xb700, 0x5bfc
+    dw 0x06b6, 0x2e00, 0x1140, 0x2e0a
+    dw 0x06b7, 0xa4dc, 0x8180, 0xa4de
+    dw 0x06b8, 0x1980, 0x80b0, 0x197a
+    dw 0x06b9, 0xa680, 0x8480, 0xa684
+    dw 0x06ba, 0x0f00, 0x046c, 0x100e
+    dw 0x06bb, 0x2770, 0xa15b, 0x24c2
+    dw 0x06bc, 0x63fb, 0x5d90, 0x6562
+    dw 0x06bd, 0x8f30, 0x00e6, 0x8ef6
+    dw 0x06be, 0xbe00, 0xa720, 0xbe1c
+    dw 0x06bf, 0x227a, 0x80c0, 0x2278
+    dw 0x06c0, 0xb6ee, 0x0800, 0xb6ee
+    dw 0x06c1, 0xa200, 0x8140, 0xa202
+    dw 0x06c2, 0x1080, 0x0b36, 0x124e
+    dw 0x06c3, 0x4706, 0x430a, 0x4946
+    dw 0x06c4, 0xbe00, 0x30bc, 0xbd68
+    dw 0x06c5, 0x8a00, 0x0293, 0x88b6
+    dw 0x06c6, 0x3d80, 0x2620, 0x3d98
+    dw 0x06c7, 0xdec0, 0x4fa8, 0xde46
+    dw 0x06c8, 0x1c80, 0x02e0, 0x1c8c
+    dw 0x06c9, 0x5278, 0x4464, 0x5304
+    dw 0x06ca, 0xfb0c, 0x4c00, 0xfb0c
+    dw 0x06cb, 0xee40, 0xcc80, 0xee44
+    dw 0x06cc, 0x5d80, 0xc990, 0x5d54
+    dw 0x06cd, 0xd567, 0xd600, 0xd9b4
+    dw 0x06ce, 0xb700, 0xb296, 0xb926
+    dw 0x06cf, 0x7710, 0xd300, 0x770c
+    dw 0x06d0, 0x3329, 0x1280, 0x3330
+    dw 0x06d1, 0xba00, 0xb706, 0xbcc2
+    dw 0x06d2, 0x9535, 0x9380, 0x987a
+    dw 0x06d3, 0xdb80, 0xc3a0, 0xdb9e
+    dw 0x06d4, 0x4400, 0x2100, 0x4402
+    dw 0x06d5, 0x9d9c, 0x80e0, 0x9da0
+    dw 0x06d6, 0x4e00, 0xbef8, 0x4d90
+    dw 0x06d7, 0x5080, 0xbf90, 0x5044
+    dw 0x06d8, 0xe800, 0xc700, 0xe804
+    dw 0x06d9, 0x57e8, 0xa800, 0x57e8
+    dw 0x06da, 0xf300, 0x5180, 0xf2fa
+    dw 0x06db, 0xc9cb, 0xbccc, 0xca64
+    dw 0x06dc, 0xa91c, 0x0e40, 0xa910
+    dw 0x06dd, 0xcd70, 0xa900, 0xcd72
+    dw 0x06de, 0x9ca4, 0x11f2, 0x9bcc
+    dw 0x06df, 0x4b06, 0xbba8, 0x4a8c
+    dw 0x06e0, 0x9a70, 0x82f0, 0x9a88
+    dw 0x06e1, 0xa79c, 0xa513, 0xaa58
+    dw 0x06e2, 0xe400, 0x589a, 0xe2da
+    dw 0x06e3, 0xd700, 0xd26e, 0xd91c
+    dw 0x06e4, 0xa600, 0x0940, 0xa5f6
+    dw 0x06e5, 0xe400, 0xe24f, 0xe728
+    dw 0x06e6, 0xc4c0, 0xbe32, 0xc64c
+    dw 0x06e7, 0x7300, 0xcd00, 0x72fe
+    dw 0x06e8, 0x6000, 0x4820, 0x6010
+    dw 0x06e9, 0x4a48, 0x3160, 0x4a5e
+    dw 0x06ea, 0x9587, 0x97c8, 0x9aa8
+    dw 0x06eb, 0xf9c6, 0xf19a, 0xfb2c
+    dw 0x06ec, 0xfa80, 0xdf40, 0xfa8e
+    dw 0x06ed, 0xbe08, 0xb84e, 0xc018
+    dw 0x06ee, 0x8c80, 0x0152, 0x8c2c
+    dw 0x06ef, 0x5ce4, 0xc7e0, 0x5cc4
+    dw 0x06f0, 0x4700, 0x1e00, 0x4702
+    dw 0x06f1, 0x1fe0, 0x0120, 0x1fe4
+    dw 0x06f2, 0xf668, 0xdac0, 0xf676
+    dw 0x06f3, 0x8f09, 0x8372, 0x8fe6
+    dw 0x06f4, 0x95c4, 0x8128, 0x95d6
+    dw 0x06f5, 0x750b, 0xe4e8, 0x74bc
+    dw 0x06f6, 0xdaf0, 0x2c00, 0xdaf0
+    dw 0x06f7, 0xf610, 0xf08e, 0xf82c
+    dw 0x06f8, 0x7a00, 0xeaa8, 0x7996
+    dw 0x06f9, 0x1fc0, 0x8320, 0x1fb4
+    dw 0x06fa, 0x4800, 0x9e00, 0x47fe
+    dw 0x06fb, 0xc590, 0xc523, 0xc95a
+    dw 0x06fc, 0xd100, 0xa400, 0xd100
+    dw 0x06fd, 0x9378, 0x8034, 0x937e
+    dw 0x06fe, 0x4188, 0xa7c0, 0x4178
+    dw 0x06ff, 0xe400, 0x578c, 0xe30e
+    dw 0x0700, 0xb780, 0x1e60, 0xb766
+    dw 0x0701, 0x2400, 0x1bcc, 0x24fa
+    dw 0x0702, 0xf6fd, 0xce00, 0xf6fe
+    dw 0x0703, 0xa800, 0x1dc6, 0xa68e
+    dw 0x0704, 0xee42, 0xcb00, 0xee46
+    dw 0x0705, 0xcc70, 0xcd13, 0xd0c2
+    dw 0x0706, 0x4f80, 0x34a0, 0x4f92
+    dw 0x0707, 0xbb00, 0x1ec0, 0xbaf2
+    dw 0x0708, 0x4fd8, 0x4cf9, 0x5268
+    dw 0x0709, 0xc1d2, 0x9d00, 0xc1d4
+    dw 0x070a, 0x2a38, 0x1cd4, 0x2ad2
+    dw 0x070b, 0x1df0, 0x82a0, 0x1de6
+    dw 0x070c, 0x1d80, 0x135c, 0x1e6c
+    dw 0x070d, 0xc400, 0xa480, 0xc404
+    dw 0x070e, 0xcd00, 0xb1c0, 0xcd0c
+    dw 0x070f, 0x5c00, 0x3600, 0x5c02
+    dw 0x0710, 0x30b0, 0x0a00, 0x30b2
+    dw 0x0711, 0x3f40, 0x9000, 0x3f40
+    dw 0x0712, 0xd9a1, 0xdaa0, 0xde20
+    dw 0x0713, 0x4a68, 0x41be, 0x4bd8
+    dw 0x0714, 0xc3e0, 0x35b4, 0xc32a
+    dw 0x0715, 0x2cb4, 0x8e80, 0x2cae
+    dw 0x0716, 0xc33a, 0xbbfc, 0xc49c
+    dw 0x0717, 0xc880, 0xb450, 0xc8a2
+    dw 0x0718, 0x2a00, 0x8500, 0x29fe
+    dw 0x0719, 0x5e60, 0xcf38, 0x5dec
+    dw 0x071a, 0x5048, 0xb180, 0x5042
+    dw 0x071b, 0xc278, 0x3a36, 0xc0ea
+    dw 0x071c, 0xc400, 0x2d10, 0xc3d8
+    dw 0x071d, 0x3bc0, 0x1700, 0x3bc4
+    dw 0x071e, 0xad00, 0x20bc, 0xac68
+    dw 0x071f, 0x4780, 0x34f8, 0x47d0
+    dw 0x0720, 0xb738, 0x1de0, 0xb720
+    dw 0x0721, 0xf758, 0xc800, 0xf758
+    dw 0x0722, 0xd700, 0x2800, 0xd700
+    dw 0x0723, 0x1c00, 0x143e, 0x1d10
+    dw 0x0724, 0xdd00, 0xdda3, 0xe152
+    dw 0x0725, 0xd000, 0xcbc2, 0xd1f0
+    dw 0x0726, 0x0b43, 0x03cc, 0x0c94
+    dw 0x0727, 0x4c9d, 0x4b80, 0x502e
+    dw 0x0728, 0x7480, 0xd580, 0x747a
+    dw 0x0729, 0xd684, 0xae00, 0xd686
+    dw 0x072a, 0x7000, 0x5cd0, 0x7026
+    dw 0x072b, 0xb000, 0x0200, 0xb000
+    dw 0x072c, 0x8fe7, 0x83e0, 0x9070
+    dw 0x072d, 0x1000, 0x0124, 0x1024
+    dw 0x072e, 0xa857, 0x1790, 0xa81a
+    dw 0x072f, 0x9300, 0x096e, 0x91a4
+    dw 0x0730, 0x9900, 0x03f0, 0x98e0
+    dw 0x0731, 0xf8a0, 0x4c00, 0xf8a0
+    dw 0x0732, 0x2838, 0x8700, 0x2834
+    dw 0x0733, 0xb4e0, 0x0800, 0xb4e0
+    dw 0x0734, 0xa900, 0x8700, 0xa904
+    dw 0x0735, 0x45f6, 0xb618, 0x4594
+    dw 0x0736, 0x047d, 0x0400, 0x083e
+    dw 0x0737, 0x4800, 0xb0f0, 0x47d8
+    dw 0x0738, 0xa980, 0x1c94, 0xa8ee
+    dw 0x0739, 0x3f80, 0x9600, 0x3f7e
+    dw 0x073a, 0x3400, 0xa4e4, 0x3364
+    dw 0x073b, 0xfb00, 0xd700, 0xfb04
+    dw 0x073c, 0x94c0, 0x8128, 0x94d2
+    dw 0x073d, 0xd100, 0xc0d8, 0xd14e
+    dw 0x073e, 0x3800, 0x0c00, 0x3800
+    dw 0x073f, 0xdf80, 0x4140, 0xdf76
+    dw 0x0740, 0x3400, 0x8a00, 0x33fe
+    dw 0x0741, 0x1934, 0x16ea, 0x1c54
+    dw 0x0742, 0xf000, 0xc400, 0xf000
+    dw 0x0743, 0x6e00, 0x5ff8, 0x6e80
+    dw 0x0744, 0x1800, 0x80d8, 0x17f2
+    dw 0x0745, 0x4e70, 0xbd48, 0x4e1c
+    dw 0x0746, 0xb640, 0x1480, 0xb63c
+    dw 0x0747, 0x5580, 0x3da0, 0x5596
+    dw 0x0748, 0x3800, 0x1200, 0x3802
+    dw 0x0749, 0x8740, 0x837d, 0x895e
+    dw 0x074a, 0x9900, 0x83b0, 0x991e
+    dw 0x074b, 0xdcc8, 0xc1c0, 0xdcd4
+    dw 0x074c, 0xd700, 0xc7d8, 0xd77e
+    dw 0x074d, 0x3c00, 0x1600, 0x3c02
+    dw 0x074e, 0xadc8, 0x0b00, 0xadc4
+    dw 0x074f, 0xae00, 0x8600, 0xae02
+    dw 0x0750, 0xb500, 0x1300, 0xb4fc
+    dw 0x0751, 0xab20, 0x8500, 0xab22
+    dw 0x0752, 0x1519, 0x1614, 0x1996
+    dw 0x0753, 0x3900, 0x9980, 0x38fa
+    dw 0x0754, 0x9400, 0x83a8, 0x943a
+    dw 0x0755, 0x44d0, 0x1e00, 0x44d2
+    dw 0x0756, 0x5878, 0x5b37, 0x5dd8
+    dw 0x0757, 0x8d00, 0x013e, 0x8cb0
+    dw 0x0758, 0x9bd0, 0x0710, 0x9b98
+    dw 0x0759, 0x3b04, 0x1dc0, 0x3b10
+    dw 0x075a, 0x9030, 0x015c, 0x9004
+    dw 0x075b, 0x28c0, 0x8980, 0x28ba
+    dw 0x075c, 0x2000, 0x9502, 0x1ec0
+    dw 0x075d, 0xbc80, 0x2bf0, 0xbc40
+    dw 0x075e, 0x36fc, 0x0800, 0x36fc
+    dw 0x075f, 0x101e, 0x8272, 0x0fa0
+    dw 0x0760, 0xa3e3, 0x10f8, 0xa394
+    dw 0x0761, 0x5d80, 0x42c0, 0x5d8e
+    dw 0x0762, 0x5f40, 0x4f68, 0x5fb6
+    dw 0x0763, 0x7000, 0xe492, 0x6edc
+    dw 0x0764, 0xeb00, 0xe1bc, 0xec38
+    dw 0x0765, 0x3500, 0x0e00, 0x3502
+    dw 0x0766, 0x2250, 0x03c0, 0x2258
+    dw 0x0767, 0xf446, 0xe390, 0xf482
+    dw 0x0768, 0x4744, 0xb8dc, 0x46a8
+    dw 0x0769, 0x2080, 0x04c0, 0x208a
+    dw 0x076a, 0x3380, 0x8400, 0x3380
+    dw 0x076b, 0xd200, 0xc41c, 0xd284
+    dw 0x076c, 0x5778, 0x2800, 0x5778
+    dw 0x076d, 0xf5d4, 0x4e00, 0xf5d2
+    dw 0x076e, 0xc570, 0xb210, 0xc5a0
+    dw 0x076f, 0x7220, 0xea1e, 0x7098
+    dw 0x0770, 0x1c00, 0x8a18, 0x1b9e
+    dw 0x0771, 0xd995, 0x3700, 0xd992
+    dw 0x0772, 0x9158, 0x02d4, 0x90fe
+    dw 0x0773, 0x4dc0, 0x2000, 0x4dc0
+    dw 0x0774, 0x5f78, 0xd476, 0x5e5a
+    dw 0x0775, 0xd040, 0x2400, 0xd040
+    dw 0x0776, 0xc030, 0x9400, 0xc030
+    dw 0x0777, 0xe800, 0xebe9, 0xedf4
+    dw 0x0778, 0x7380, 0xdc90, 0x735c
+    dw 0x0779, 0x5e00, 0xbf80, 0x5df8
+    dw 0x077a, 0xc5e0, 0xa300, 0xc5e4
+    dw 0x077b, 0xb0ac, 0x0a00, 0xb0aa
+    dw 0x077c, 0xf200, 0x4a00, 0xf1fe
+    dw 0x077d, 0x4480, 0x434e, 0x4814
+    dw 0x077e, 0x5c00, 0xd1d2, 0x5a8c
+    dw 0x077f, 0x57a3, 0x5600, 0x5ad2
+    dw 0x0780, 0x7900, 0xe670, 0x78cc
+    dw 0x0781, 0xe7d7, 0xd950, 0xe840
+    dw 0x0782, 0x2360, 0x81c0, 0x235c
+    dw 0x0783, 0x19da, 0x8858, 0x1994
+    dw 0x0784, 0x0e00, 0x8202, 0x0d80
+    dw 0x0785, 0xdb00, 0xac00, 0xdb00
+    dw 0x0786, 0xe80b, 0xcb80, 0xe812
+    dw 0x0787, 0x4864, 0x2700, 0x4868
+    dw 0x0788, 0xaf60, 0x8200, 0xaf60
+    dw 0x0789, 0x1e20, 0x03a0, 0x1e2e
+    dw 0x078a, 0x0a80, 0x8335, 0x08e6
+    dw 0x078b, 0x3558, 0x0e00, 0x355a
+    dw 0x078c, 0x873b, 0x8240, 0x88be
+    dw 0x078d, 0x4500, 0x1800, 0x4500
+    dw 0x078e, 0x9400, 0x0244, 0x93b8
+    dw 0x078f, 0x7480, 0xc800, 0x7480
+    dw 0x0790, 0x1250, 0x82bc, 0x11f8
+    dw 0x0791, 0x9300, 0x834c, 0x936a
+    dw 0x0792, 0x3adf, 0x3880, 0x3db0
+    dw 0x0793, 0x9a94, 0x91dc, 0x9c06
+    dw 0x0794, 0x9246, 0x00b4, 0x9230
+    dw 0x0795, 0xe6c3, 0xc680, 0xe6ca
+    dw 0x0796, 0xf602, 0xce00, 0xf604
+    dw 0x0797, 0xae00, 0x25be, 0xac90
+    dw 0x0798, 0xd400, 0xb100, 0xd402
+    dw 0x0799, 0x1c00, 0x8150, 0x1bf6
+    dw 0x079a, 0x7650, 0x5100, 0x7652
+    dw 0x079b, 0x3080, 0x9fb0, 0x3042
+    dw 0x079c, 0xf558, 0xc800, 0xf558
+    dw 0x079d, 0x335b, 0x9180, 0x3356
+    dw 0x079e, 0x2710, 0x9dce, 0x259c
+    dw 0x079f, 0xba94, 0x2cac, 0xb9fe
+    dw 0x07a0, 0x4de0, 0x3b90, 0x4e1c
+    dw 0x07a1, 0x7300, 0x5f70, 0x733c
+    dw 0x07a2, 0xae00, 0x9a50, 0xae32
+    dw 0x07a3, 0xa1d0, 0x1b81, 0x9fe0
+    dw 0x07a4, 0x7390, 0x6994, 0x747a
+    dw 0x07a5, 0xc800, 0x1800, 0xc800
+    dw 0x07a6, 0x3ea0, 0x9000, 0x3ea0
+    dw 0x07a7, 0x4ed0, 0xbbf0, 0x4e90
+    dw 0x07a8, 0xc600, 0x1800, 0xc600
+    dw 0x07a9, 0xf120, 0xcd00, 0xf122
+    dw 0x07aa, 0x9500, 0x05d8, 0x94a2
+    dw 0x07ab, 0xf108, 0x5740, 0xf0fa
+    dw 0x07ac, 0xf1a0, 0x4a00, 0xf19e
+    dw 0x07ad, 0xaec0, 0xa41e, 0xafc8
+    dw 0x07ae, 0x4100, 0x2cb0, 0x4126
+    dw 0x07af, 0x3000, 0x20d8, 0x304e
+    dw 0x07b0, 0xf53b, 0xdde0, 0xf552
+    dw 0x07b1, 0x7ac0, 0x5200, 0x7ac2
+    dw 0x07b2, 0xa300, 0x00c0, 0xa2fe
+    dw 0x07b3, 0x7080, 0x5280, 0x7086
+    dw 0x07b4, 0x2500, 0x9170, 0x24d4
+    dw 0x07b5, 0x15af, 0x0198, 0x15c8
+    dw 0x07b6, 0x5e00, 0x4d58, 0x5e56
+    dw 0x07b7, 0x1788, 0x8008, 0x1788
+    dw 0x07b8, 0x1c00, 0x0bf0, 0x1c40
+    dw 0x07b9, 0x6200, 0xb400, 0x6200
+    dw 0x07ba, 0x1765, 0x1600, 0x1ab2
+    dw 0x07bb, 0xe1e8, 0xdd76, 0xe452
+    dw 0x07bc, 0xce00, 0xce59, 0xd22c
+    dw 0x07bd, 0xce00, 0x2000, 0xce00
+    dw 0x07be, 0x5870, 0x2c00, 0x5870
+    dw 0x07bf, 0xb4de, 0x1b40, 0xb4d0
+    dw 0x07c0, 0x4ac7, 0x4180, 0x4c14
+    dw 0x07c1, 0xa680, 0x0180, 0xa67e
+    dw 0x07c2, 0x915e, 0x01e4, 0x9122
+    dw 0x07c3, 0x6228, 0x5c02, 0x6414
+    dw 0x07c4, 0xc9e0, 0xa700, 0xc9e4
+    dw 0x07c5, 0x0d91, 0x80f6, 0x0d54
+    dw 0x07c6, 0x6500, 0x5230, 0x6532
+    dw 0x07c7, 0xea00, 0xd898, 0xea4a
+    dw 0x07c8, 0x6a58, 0x57d0, 0x6a96
+    dw 0x07c9, 0xc080, 0x9400, 0xc080
+    dw 0x07ca, 0x6000, 0xb900, 0x5ffe
+    dw 0x07cb, 0xd600, 0x4498, 0xd5b6
+    dw 0x07cc, 0xdbb8, 0xac00, 0xdbb8
+    dw 0x07cd, 0xed40, 0xc900, 0xed42
+    dw 0x07ce, 0x2b00, 0x0500, 0x2b02
+    dw 0x07cf, 0xb300, 0x0f00, 0xb2fc
 .unit_test_end
@@ -1,12 +1,10 @@
 ; Parses an ASCII string into a float, stopping at the first
-; invalid character. E.g. "123.5xyz" will be parsed to 123.5,
-; and r0 will be left pointing at the 'x'.
+; invalid character. E.g. "123.5xyz" will be parsed to 123.5.
 ;
 ; Arguments
 ;   r0: pointer to input buffer
 ; 
 ; Returns
-;   r0: points 1 past last valid character
 ;   r2: value, V=0 -- on success
 ;   r2: NaN, V=1   -- on parsing "nan"
 ;   r2: 0, V=1     -- on failure
@@ -49,6 +47,12 @@
     alias r8 shift
     alias r9 exp_value
 
+    ; for the final product, once the above are finished with
+    alias r6 prod_0
+    alias r7 prod_1
+    alias r8 prod_2
+    alias r9 prod_3
+
     alias r12 tmp
     alias r13 sp
     alias r14 link
@@ -117,6 +121,7 @@
     mov z, #0
     mov z_lo, #0
     mov z_exp, #0
+    mov exp_value, #0
 
 .parse_mantissa_loop
     tst flags, #bit .flag_seen_dp
@@ -295,35 +300,51 @@
     lsl z, shift
 
 .done_shift
-    mov tmp, #1<<15
-    add z_lo, tmp
+    ; the top 32 bits of z:z_lo * pow10_mul_hi:pow10_mul_lo, with any bits
+    ; below them jammed into bit 0, so that rounding is correct
+    mov prod_1, z_lo
+    muh prod_1, pow10_mul_lo
+    mov prod_0, z_lo
+    mul prod_0, pow10_mul_lo            ; z_lo * lo
+    mov prod_3, z
+    muh prod_3, pow10_mul_hi
+    mov prod_2, z
+    mul prod_2, pow10_mul_hi            ; + z * hi << 32
+
+    mov tmp, z_lo
+    mul tmp, pow10_mul_hi
+    add prod_1, tmp
+    mov tmp, z_lo
+    muh tmp, pow10_mul_hi
+    adc prod_2, tmp
     mov tmp, #0
-    adc z, tmp
-    prpl
-    bra .drop16
-    lsr z, #1
-    rrx z_lo
-    add z_exp, #1
+    adc prod_3, tmp                     ; + z_lo * hi << 16
 
-.drop16
     mov tmp, z
-
-    muh z, pow10_mul_hi
-    muh pow10_mul_lo, tmp
-    mul tmp, pow10_mul_hi
-
-    add tmp, pow10_mul_lo
+    mul tmp, pow10_mul_lo
+    add prod_1, tmp
+    mov tmp, z
+    muh tmp, pow10_mul_lo
+    adc prod_2, tmp
     mov tmp, #0
-    prmi                ; test bit 15 of intermediate sum
-    mov tmp, #1         ; round up
-    adc z, tmp          ; also incorporate carry from intermediate sum
+    adc prod_3, tmp                     ; + z * lo << 16
+
+    orr prod_1, prod_0
+    mov z, prod_3
+    mov z_lo, prod_2
 
     tst z, #bit 14
     prne
-    bra .f16_round_pack
+    bra .jam
 
-    lsl z, #1
+    lsl z_lo, #1
+    adc z, z
     sub z_exp, #1
+
+.jam
+    orr z_lo, prod_1
+    prne
+    orr z, #bit 0
     bra .f16_round_pack
 
 .error
@@ -679,1329 +679,1335 @@
     dw 0x02a2, 0xffff, 0xfe00, 0x7e00   ;   -max_nan   -qnan
     dw 0x02a3, 0xffff, 0xffff, 0x7e00   ;   -max_nan   -max_nan
 
-    ; Random values
-    dw 0x02a4, 0x2069, 0x091a, 0x52ea
-    dw 0x02a5, 0xc971, 0x26a5, 0xde8d
-    dw 0x02a6, 0x2dbf, 0x5607, 0x13a0
-    dw 0x02a7, 0x51e1, 0xd944, 0xb477
-    dw 0x02a8, 0xecaf, 0xb6ee, 0x7168
-    dw 0x02a9, 0x5078, 0xeb19, 0xa109
-    dw 0x02aa, 0xb77f, 0x9517, 0x5de4
-    dw 0x02ab, 0xa673, 0x93f2, 0x4e7e
-    dw 0x02ac, 0x9c17, 0xc5bf, 0x11b2
-    dw 0x02ad, 0x859a, 0x4ae8, 0x8068
-    dw 0x02ae, 0x2518, 0xa825, 0xb8eb
-    dw 0x02af, 0x1b9b, 0xd66f, 0x825d
-    dw 0x02b0, 0x1dd3, 0xc1f7, 0x97d0
-    dw 0x02b1, 0x1dcb, 0x827d, 0xd8a8
-    dw 0x02b2, 0x9cd6, 0xb6b8, 0x21c2
-    dw 0x02b3, 0xa2e6, 0xa5f1, 0x38a5
-    dw 0x02b4, 0x802a, 0xa12b, 0x0c10
-    dw 0x02b5, 0xcc96, 0xade9, 0x5a35
-    dw 0x02b6, 0xf733, 0x1e77, 0xfc00
-    dw 0x02b7, 0x872e, 0xe3e2, 0x0002
-    dw 0x02b8, 0xd565, 0xd7a6, 0x39a4
-    dw 0x02b9, 0xcefb, 0x8ce5, 0x7c00
-    dw 0x02ba, 0x6cbd, 0x756e, 0x32fb
-    dw 0x02bb, 0x20d7, 0x08d5, 0x5402
-    dw 0x02bc, 0x3b2e, 0xa671, 0xd075
-    dw 0x02bd, 0x53bd, 0x6046, 0x2f3e
-    dw 0x02be, 0x4e96, 0x6f59, 0x1b2c
-    dw 0x02bf, 0x36b6, 0x6c69, 0x0616
-    dw 0x02c0, 0x3150, 0x5481, 0x18b8
-    dw 0x02c1, 0xeee6, 0xce26, 0x5c7d
-    dw 0x02c2, 0x0b3a, 0x91cc, 0xb4fd
-    dw 0x02c3, 0x7417, 0x8b64, 0xfc00
-    dw 0x02c4, 0x32f7, 0x40ad, 0x2df5
-    dw 0x02c5, 0x394d, 0x2a2a, 0x4ae1
-    dw 0x02c6, 0x5f25, 0xc07b, 0xda61
-    dw 0x02c7, 0x0e0c, 0x348a, 0x1554
-    dw 0x02c8, 0x9822, 0xdd07, 0x0069
-    dw 0x02c9, 0xc16f, 0x04df, 0xf876
-    dw 0x02ca, 0x5276, 0xe246, 0xac1f
-    dw 0x02cb, 0x0db4, 0x8da4, 0xbc0b
-    dw 0x02cc, 0x88b7, 0x6172, 0x8003
-    dw 0x02cd, 0xedea, 0xd74d, 0x527b
-    dw 0x02ce, 0xd0cb, 0x24a0, 0xe825
-    dw 0x02cf, 0x43b6, 0x021b, 0x7c00
-    dw 0x02d0, 0x7922, 0x329c, 0x7c00
-    dw 0x02d1, 0xd041, 0x845c, 0x7c00
-    dw 0x02d2, 0xc468, 0x4459, 0xbc0e
-    dw 0x02d3, 0x0fc0, 0xf760, 0x8000
-    dw 0x02d4, 0x8506, 0x490d, 0x807f
-    dw 0x02d5, 0x218a, 0xe42b, 0x80aa
-    dw 0x02d6, 0x0989, 0x2f97, 0x15d6
-    dw 0x02d7, 0x18b6, 0xa1ab, 0xb2a6
-    dw 0x02d8, 0x0c9e, 0xda25, 0x8018
-    dw 0x02d9, 0xa68a, 0x5f14, 0x83b2
-    dw 0x02da, 0xbc6c, 0xb43f, 0x442a
-    dw 0x02db, 0xecb8, 0x4523, 0xe359
-    dw 0x02dc, 0x15b1, 0xdaa3, 0x806e
-    dw 0x02dd, 0x1c71, 0xe67c, 0x802c
-    dw 0x02de, 0x6027, 0xe897, 0xb33d
-    dw 0x02df, 0x7865, 0x92c4, 0xfc00
-    dw 0x02e0, 0xb8d8, 0x572c, 0x9d67
-    dw 0x02e1, 0x0c81, 0x4e8c, 0x00b0
-    dw 0x02e2, 0x8238, 0x558f, 0x8006
-    dw 0x02e3, 0x7017, 0x6663, 0x451f
-    dw 0x02e4, 0x5f18, 0x9fae, 0xfb64
-    dw 0x02e5, 0x00c3, 0xac4c, 0x89ac
-    dw 0x02e6, 0x593f, 0xa74d, 0xedc0
-    dw 0x02e7, 0x0b61, 0x15ab, 0x3135
-    dw 0x02e8, 0x5b8c, 0xf819, 0x9f5e
-    dw 0x02e9, 0x5ace, 0x713d, 0x2532
-    dw 0x02ea, 0xd2bc, 0x773f, 0x976f
-    dw 0x02eb, 0x57b9, 0xd200, 0xc126
-    dw 0x02ec, 0xd767, 0x4050, 0xd2de
-    dw 0x02ed, 0x4a65, 0x6a2b, 0x1c26
-    dw 0x02ee, 0xf929, 0x4727, 0xedc6
-    dw 0x02ef, 0xc157, 0xf65a, 0x06ba
-    dw 0x02f0, 0x53a8, 0x0fe4, 0x7c00
-    dw 0x02f1, 0x7892, 0xa937, 0xfc00
-    dw 0x02f2, 0xdef6, 0x084f, 0xfc00
-    dw 0x02f3, 0x1fa9, 0x5e0f, 0x0144
-    dw 0x02f4, 0x0912, 0xcbf5, 0x80a3
-    dw 0x02f5, 0xb74e, 0xb060, 0x42ae
-    dw 0x02f6, 0xd756, 0xccf9, 0x45e7
-    dw 0x02f7, 0x0bec, 0xcf70, 0x8088
-    dw 0x02f8, 0x27c8, 0xa22c, 0xc10b
-    dw 0x02f9, 0x9f07, 0xd4e3, 0x05c1
-    dw 0x02fa, 0x742c, 0x766e, 0x3931
-    dw 0x02fb, 0x1534, 0xbe92, 0x9256
-    dw 0x02fc, 0xe099, 0x0e5d, 0xfc00
-    dw 0x02fd, 0x05b9, 0xa1f1, 0x9fb5
-    dw 0x02fe, 0x04b7, 0x5961, 0x0007
-    dw 0x02ff, 0xb1d5, 0x0299, 0xec7d
-    dw 0x0300, 0x31d0, 0x5c40, 0x1178
-    dw 0x0301, 0x0ae8, 0x5179, 0x0051
-    dw 0x0302, 0xba4f, 0x13fb, 0xe253
-    dw 0x0303, 0x1d6e, 0x719e, 0x0008
-    dw 0x0304, 0xc45b, 0xf4c5, 0x0b4e
-    dw 0x0305, 0x3e97, 0xd047, 0xaa2a
-    dw 0x0306, 0xc435, 0x665f, 0x9948
-    dw 0x0307, 0x4d71, 0x6661, 0x22d3
-    dw 0x0308, 0x0567, 0x2255, 0x1ed3
-    dw 0x0309, 0xda8e, 0x7bd5, 0x9ab2
-    dw 0x030a, 0x3789, 0x9920, 0xd9e2
-    dw 0x030b, 0x5c6f, 0x45e6, 0x5203
-    dw 0x030c, 0x9ed9, 0x4a9d, 0x9024
-    dw 0x030d, 0xf83a, 0xb035, 0x7c00
-    dw 0x030e, 0xc7e7, 0xfad3, 0x08a2
-    dw 0x030f, 0xe205, 0x2427, 0xf9cc
-    dw 0x0310, 0x05bc, 0x337e, 0x0e1f
-    dw 0x0311, 0xde77, 0x19b7, 0xfc00
-    dw 0x0312, 0x50ec, 0x5015, 0x3cd3
-    dw 0x0313, 0xde12, 0x45b1, 0xd444
-    dw 0x0314, 0x8eac, 0xae59, 0x1c34
-    dw 0x0315, 0x09e6, 0xf50c, 0x8000
-    dw 0x0316, 0xfbcb, 0x7048, 0xc748
-    dw 0x0317, 0xfa73, 0x1e20, 0xfc00
-    dw 0x0318, 0x4ad6, 0x7648, 0x105a
-    dw 0x0319, 0x55a9, 0xe3f6, 0xadb0
-    dw 0x031a, 0xd2b7, 0x9b8f, 0x731b
-    dw 0x031b, 0x82cf, 0xd117, 0x0012
-    dw 0x031c, 0xe62c, 0x7b09, 0xa705
-    dw 0x031d, 0x814c, 0xae14, 0x0ad4
-    dw 0x031e, 0x75dd, 0x6351, 0x4e69
-    dw 0x031f, 0xd23b, 0x7b99, 0x928f
-    dw 0x0320, 0x96cf, 0xb0b2, 0x21cd
-    dw 0x0321, 0x9550, 0xe7bc, 0x000b
-    dw 0x0322, 0x00c7, 0x7362, 0x0000
-    dw 0x0323, 0x2d6d, 0x8f74, 0xd9d3
-    dw 0x0324, 0x21bb, 0x3754, 0x2642
-    dw 0x0325, 0x8480, 0x1d86, 0xa285
-    dw 0x0326, 0xa79c, 0x3ba6, 0xa7f6
-    dw 0x0327, 0xf272, 0xf53b, 0x38ee
-    dw 0x0328, 0x914f, 0xd668, 0x006a
-    dw 0x0329, 0xc7f3, 0x2cde, 0xd688
-    dw 0x032a, 0x5937, 0x990a, 0xfc00
-    dw 0x032b, 0x130b, 0xd440, 0x80d4
-    dw 0x032c, 0x1a57, 0xc11f, 0x94f4
-    dw 0x032d, 0x4a1d, 0x935a, 0xf2a7
-    dw 0x032e, 0xc5b6, 0x1478, 0xed1d
-    dw 0x032f, 0x440d, 0x5b06, 0x249d
-    dw 0x0330, 0x44d4, 0xce68, 0xb207
-    dw 0x0331, 0x29a1, 0xd448, 0x9142
-    dw 0x0332, 0xf024, 0x60f5, 0xcaaf
-    dw 0x0333, 0x58c8, 0x0daa, 0x7c00
-    dw 0x0334, 0x0891, 0xd7bb, 0x8013
-    dw 0x0335, 0x4951, 0xfb03, 0x8a11
-    dw 0x0336, 0xccf7, 0xdaa0, 0x2dff
-    dw 0x0337, 0xd16b, 0x94ea, 0x7869
-    dw 0x0338, 0x077f, 0x2aa2, 0x1885
-    dw 0x0339, 0x2df4, 0x1a8a, 0x4f48
-    dw 0x033a, 0x484b, 0xdba9, 0xa87c
-    dw 0x033b, 0x4900, 0xc5f4, 0xbeb8
-    dw 0x033c, 0x6f03, 0x0eb7, 0x7c00
-    dw 0x033d, 0xda6c, 0xb310, 0x6346
-    dw 0x033e, 0x69bd, 0xd6a0, 0xceee
-    dw 0x033f, 0xf7e5, 0x3826, 0xfb9d
-    dw 0x0340, 0x0041, 0xcc2d, 0x8004
-    dw 0x0341, 0x284a, 0x6137, 0x034a
-    dw 0x0342, 0x24f6, 0x35f4, 0x2aab
-    dw 0x0343, 0x69c8, 0x64cc, 0x40d2
-    dw 0x0344, 0xc9a8, 0x59e6, 0xabac
-    dw 0x0345, 0x3637, 0x5e92, 0x1391
-    dw 0x0346, 0x6165, 0x60da, 0x3c73
-    dw 0x0347, 0x8c87, 0x7bef, 0x8000
-    dw 0x0348, 0x5fbd, 0xd4d2, 0xc66c
-    dw 0x0349, 0x5798, 0xa8bd, 0xea69
-    dw 0x034a, 0x9ac6, 0xc69b, 0x101a
-    dw 0x034b, 0xb774, 0x7532, 0x816f
-    dw 0x034c, 0x79ac, 0x2132, 0x7c00
-    dw 0x034d, 0x4bd2, 0x7191, 0x159f
-    dw 0x034e, 0x5958, 0x4c14, 0x493e
-    dw 0x034f, 0x3dbe, 0x81a2, 0xfb09
-    dw 0x0350, 0xad4b, 0x62b4, 0x8651
-    dw 0x0351, 0xb796, 0x1713, 0xdc4a
-    dw 0x0352, 0x5f66, 0x36dc, 0x6450
-    dw 0x0353, 0x7bdf, 0x290e, 0x7c00
-    dw 0x0354, 0x90c2, 0xb217, 0x1a40
-    dw 0x0355, 0x87a1, 0xf227, 0x0000
-    dw 0x0356, 0x12f1, 0x1428, 0x3aae
-    dw 0x0357, 0x6e16, 0x72ae, 0x374a
-    dw 0x0358, 0xe8fa, 0xc5ae, 0x5f02
-    dw 0x0359, 0x1b6b, 0x83c1, 0xd3e7
-    dw 0x035a, 0x8c49, 0xd2e0, 0x0050
-    dw 0x035b, 0xf8f3, 0x05f5, 0xfc00
-    dw 0x035c, 0xf412, 0x44c6, 0xead2
-    dw 0x035d, 0x7786, 0x4d6a, 0x658f
-    dw 0x035e, 0x90da, 0xb545, 0x175e
-    dw 0x035f, 0xcf0c, 0x3e25, 0xcc96
-    dw 0x0360, 0x17f9, 0x86a2, 0xcccf
-    dw 0x0361, 0x5538, 0x775f, 0x19aa
-    dw 0x0362, 0xbd7e, 0xd118, 0x2850
-    dw 0x0363, 0xa06e, 0x4e40, 0x8dac
-    dw 0x0364, 0x832f, 0x280f, 0x9646
-    dw 0x0365, 0x4067, 0x9620, 0xe5c0
-    dw 0x0366, 0x3c37, 0xae7d, 0xc932
-    dw 0x0367, 0x08ce, 0x2531, 0x1f67
-    dw 0x0368, 0x742b, 0x2439, 0x7c00
-    dw 0x0369, 0xa8f2, 0x0075, 0xed69
-    dw 0x036a, 0xf719, 0xa1e6, 0x7c00
-    dw 0x036b, 0x066a, 0xeb2b, 0x8000
-    dw 0x036c, 0xe6ac, 0x3895, 0xe9d3
-    dw 0x036d, 0x7786, 0x3336, 0x7c00
-    dw 0x036e, 0x07a1, 0xb5ab, 0x8d62
-    dw 0x036f, 0x4b2f, 0x8e44, 0xf896
-    dw 0x0370, 0x0ae3, 0xc28f, 0x8433
-    dw 0x0371, 0x4bc2, 0xdbfb, 0xabc7
-    dw 0x0372, 0x62fd, 0x9a03, 0xfc00
-    dw 0x0373, 0x5f2a, 0x8b0c, 0xfc00
-    dw 0x0374, 0xda6a, 0xf54a, 0x20da
-    dw 0x0375, 0xc743, 0x88e8, 0x79ec
-    dw 0x0376, 0xec74, 0x2252, 0xfc00
-    dw 0x0377, 0x9567, 0x196b, 0xb7fa
-    dw 0x0378, 0x374d, 0x03f3, 0x6f65
-    dw 0x0379, 0x0497, 0x1df9, 0x2226
-    dw 0x037a, 0x81e4, 0x3d2c, 0x8176
-    dw 0x037b, 0x957f, 0xb51a, 0x1c4f
-    dw 0x037c, 0x44ce, 0x4b2a, 0x355e
-    dw 0x037d, 0x0049, 0xd312, 0x8001
-    dw 0x037e, 0x560d, 0xc2d8, 0xcf13
-    dw 0x037f, 0x1ed4, 0x3209, 0x2887
-    dw 0x0380, 0x25d5, 0xb8d7, 0xa8d2
-    dw 0x0381, 0x9133, 0xb0e1, 0x1c43
-    dw 0x0382, 0x9342, 0x867e, 0x4879
-    dw 0x0383, 0x7824, 0x1c2a, 0x7c00
-    dw 0x0384, 0x8496, 0x6499, 0x8001
-    dw 0x0385, 0x193d, 0xa6e8, 0xae11
-    dw 0x0386, 0xfa00, 0x16c6, 0xfc00
-    dw 0x0387, 0xc054, 0x314d, 0xca88
-    dw 0x0388, 0x1ab9, 0xc4eb, 0x9178
-    dw 0x0389, 0x4f46, 0x9c9d, 0xee4e
-    dw 0x038a, 0x0217, 0xe4c5, 0x8000
-    dw 0x038b, 0x51b7, 0x46e5, 0x46a2
-    dw 0x038c, 0x2fef, 0x5200, 0x194a
-    dw 0x038d, 0x19f7, 0x85fc, 0xcff9
-    dw 0x038e, 0x14d9, 0x38cc, 0x180b
-    dw 0x038f, 0xb805, 0x3aae, 0xb8d0
-    dw 0x0390, 0xf1a3, 0x4939, 0xe451
-    dw 0x0391, 0xeb90, 0x84e5, 0x7c00
-    dw 0x0392, 0xcfb7, 0x63b4, 0xa802
-    dw 0x0393, 0xa10f, 0x544d, 0x88b4
-    dw 0x0394, 0xc84d, 0xba4d, 0x4976
-    dw 0x0395, 0xfb36, 0xc24d, 0x7494
-    dw 0x0396, 0xd113, 0xbb8a, 0x5162
-    dw 0x0397, 0xf39a, 0xebcc, 0x43cd
-    dw 0x0398, 0x8075, 0x42e0, 0x8022
-    dw 0x0399, 0x8869, 0x828c, 0x42ed
-    dw 0x039a, 0x27a5, 0xda20, 0x88fe
-    dw 0x039b, 0xc972, 0x5794, 0xadc0
-    dw 0x039c, 0x2c20, 0xe369, 0x8474
-    dw 0x039d, 0xdd91, 0x40f9, 0xd87a
-    dw 0x039e, 0x1c35, 0x9596, 0xc206
-    dw 0x039f, 0x7ba8, 0x0dd9, 0x7c00
-    dw 0x03a0, 0xdecf, 0x6738, 0xb38c
-    dw 0x03a1, 0x92be, 0xae86, 0x2022
-    dw 0x03a2, 0xcaec, 0x33ce, 0xd318
-    dw 0x03a3, 0x02d4, 0x933a, 0xaa43
-    dw 0x03a4, 0xee1b, 0x5587, 0xd46b
-    dw 0x03a5, 0xbf2e, 0xb994, 0x4126
-    dw 0x03a6, 0x4922, 0xaafa, 0xd9e3
-    dw 0x03a7, 0x3a09, 0x8c02, 0xea06
-    dw 0x03a8, 0x3363, 0xbc95, 0xb273
-    dw 0x03a9, 0xb3a8, 0x0d83, 0xe18e
-    dw 0x03aa, 0x8607, 0x0b3c, 0xb6aa
-    dw 0x03ab, 0x39a3, 0x6971, 0x0c25
-    dw 0x03ac, 0xe8cd, 0x7a9d, 0xa9cf
-    dw 0x03ad, 0x85a6, 0xf645, 0x0000
-    dw 0x03ae, 0x937f, 0x5d33, 0x802e
-    dw 0x03af, 0x5d7d, 0x263e, 0x7309
-    dw 0x03b0, 0x0bba, 0x2869, 0x1f02
-    dw 0x03b1, 0x5a0c, 0x0e8e, 0x7c00
-    dw 0x03b2, 0xbba3, 0x4827, 0xaf5b
-    dw 0x03b3, 0x0c98, 0x112b, 0x371c
-    dw 0x03b4, 0x0755, 0xc62c, 0x8130
-    dw 0x03b5, 0x5a4d, 0xb24f, 0xe3fd
-    dw 0x03b6, 0x0035, 0xe64f, 0x8000
-    dw 0x03b7, 0xe5b2, 0xbcca, 0x64c2
-    dw 0x03b8, 0x99f7, 0xf335, 0x0003
-    dw 0x03b9, 0x42d2, 0xa534, 0xd93e
-    dw 0x03ba, 0x2cd8, 0xac43, 0xbc8c
-    dw 0x03bb, 0x8e01, 0xa775, 0x2271
-    dw 0x03bc, 0x31e9, 0x0c65, 0x6161
-    dw 0x03bd, 0x9dba, 0xc569, 0x143c
-    dw 0x03be, 0x6999, 0xfb37, 0xaa35
-    dw 0x03bf, 0xeba7, 0x7553, 0xb1c0
-    dw 0x03c0, 0x23a1, 0x45b3, 0x195b
-    dw 0x03c1, 0x83e1, 0xdf44, 0x0002
-    dw 0x03c2, 0x8dda, 0x9079, 0x393c
-    dw 0x03c3, 0xf06f, 0x952f, 0x7c00
-    dw 0x03c4, 0x56a5, 0x4abc, 0x47e5
-    dw 0x03c5, 0x477e, 0x56da, 0x2c60
-    dw 0x03c6, 0x310c, 0x2d30, 0x3fc8
-    dw 0x03c7, 0x13a4, 0xcb03, 0x845c
-    dw 0x03c8, 0x2065, 0x5676, 0x0571
-    dw 0x03c9, 0x7037, 0x4d3d, 0x5e70
-    dw 0x03ca, 0x02b9, 0xf4b3, 0x8000
-    dw 0x03cb, 0x34a3, 0x0a9e, 0x659b
-    dw 0x03cc, 0x926d, 0xfa0c, 0x0000
-    dw 0x03cd, 0x7437, 0x8da5, 0xfc00
-    dw 0x03ce, 0xe5b3, 0xe98a, 0x381e
-    dw 0x03cf, 0xb146, 0x2b66, 0xc1b4
-    dw 0x03d0, 0x6d6b, 0x908a, 0xfc00
-    dw 0x03d1, 0xb940, 0x80fa, 0x7960
-    dw 0x03d2, 0x4e6f, 0x5489, 0x35ad
-    dw 0x03d3, 0xcbb6, 0x95ed, 0x7134
-    dw 0x03d4, 0xab63, 0xc31d, 0x2427
-    dw 0x03d5, 0xbf08, 0xc7c6, 0x333c
-    dw 0x03d6, 0xe382, 0x157e, 0xfc00
-    dw 0x03d7, 0x37fd, 0x30bf, 0x42bc
-    dw 0x03d8, 0x1838, 0x3636, 0x1d6f
-    dw 0x03d9, 0x2572, 0x4cdb, 0x147c
-    dw 0x03da, 0x40d5, 0xb7e0, 0xc4e9
-    dw 0x03db, 0x46e7, 0xb50c, 0xcd78
-    dw 0x03dc, 0x4585, 0x2c9a, 0x54cc
-    dw 0x03dd, 0x9e97, 0xf6cb, 0x0004
-    dw 0x03de, 0x5800, 0x0c02, 0x7c00
-    dw 0x03df, 0x8755, 0x1140, 0xb196
-    dw 0x03e0, 0x09e7, 0x084f, 0x3d7b
-    dw 0x03e1, 0x5faf, 0x5e70, 0x3cc6
-    dw 0x03e2, 0xd406, 0xf59c, 0x19bd
-    dw 0x03e3, 0x09d4, 0xd0c8, 0x804e
-    dw 0x03e4, 0xb8b9, 0xc8dc, 0x2bc6
-    dw 0x03e5, 0x988e, 0x9c3b, 0x384e
-    dw 0x03e6, 0xde5a, 0xd08c, 0x4996
-    dw 0x03e7, 0xccfa, 0xf692, 0x120f
-    dw 0x03e8, 0x06c2, 0xf26d, 0x8000
-    dw 0x03e9, 0x436d, 0x4797, 0x37d4
-    dw 0x03ea, 0xaa4d, 0x8a54, 0x5bf7
-    dw 0x03eb, 0xefd2, 0xb6ee, 0x7484
-    dw 0x03ec, 0x9b3b, 0xe69d, 0x0023
-    dw 0x03ed, 0x0eee, 0xa73d, 0xa3a9
-    dw 0x03ee, 0x6df2, 0x202e, 0x7c00
-    dw 0x03ef, 0xb124, 0x7642, 0x8069
-    dw 0x03f0, 0x0f95, 0x4a48, 0x026a
-    dw 0x03f1, 0x7579, 0x1969, 0x7c00
-    dw 0x03f2, 0x1b10, 0x2e32, 0x288f
-    dw 0x03f3, 0xe245, 0xb39f, 0x6a95
-    dw 0x03f4, 0xca6d, 0xc09f, 0x4590
-    dw 0x03f5, 0x842b, 0x9768, 0x2881
-    dw 0x03f6, 0xb732, 0x8aed, 0x6828
-    dw 0x03f7, 0x89d5, 0xfa9f, 0x0000
-    dw 0x03f8, 0xd285, 0x3422, 0xda4f
-    dw 0x03f9, 0x84f4, 0xcf29, 0x002c
-    dw 0x03fa, 0x23f4, 0x3be2, 0x2409
-    dw 0x03fb, 0x6a64, 0x0a91, 0x7c00
-    dw 0x03fc, 0x4ad1, 0x11a1, 0x74d8
-    dw 0x03fd, 0x7883, 0x6aff, 0x4929
-    dw 0x03fe, 0xc2c6, 0xeec5, 0x1001
-    dw 0x03ff, 0xeadd, 0xd25b, 0x5452
-    dw 0x0400, 0x390d, 0x6056, 0x14a9
-    dw 0x0401, 0xebc4, 0x541e, 0xd38b
-    dw 0x0402, 0x8e89, 0xce09, 0x0115
-    dw 0x0403, 0x07bd, 0x58f6, 0x000c
-    dw 0x0404, 0x8ea8, 0x8be8, 0x3ebc
-    dw 0x0405, 0xf05e, 0x45da, 0xe5f8
-    dw 0x0406, 0x16d5, 0x7a33, 0x0001
-    dw 0x0407, 0x407a, 0xe95a, 0x92b1
-    dw 0x0408, 0xae55, 0xc56e, 0x24aa
-    dw 0x0409, 0xb883, 0xd249, 0x21be
-    dw 0x040a, 0x0150, 0x22e7, 0x1616
-    dw 0x040b, 0xdcda, 0x4c21, 0xccb3
-    dw 0x040c, 0x3489, 0x555e, 0x1ac3
-    dw 0x040d, 0xb721, 0xf74f, 0x00fa
-    dw 0x040e, 0x4423, 0xa1fe, 0xdd86
-    dw 0x040f, 0xc9aa, 0x0254, 0xfc00
-    dw 0x0410, 0xb56e, 0xd14f, 0x2017
-    dw 0x0411, 0x90dd, 0x8377, 0x499d
-    dw 0x0412, 0xd90c, 0xe9d4, 0x2aed
-    dw 0x0413, 0x121f, 0x64f4, 0x000a
-    dw 0x0414, 0xda32, 0x57fa, 0xbe37
-    dw 0x0415, 0x7bc9, 0x5466, 0x6314
-    dw 0x0416, 0x9874, 0x6524, 0x801c
-    dw 0x0417, 0x02bb, 0x5de2, 0x0002
-    dw 0x0418, 0x1da7, 0xd505, 0x8481
-    dw 0x0419, 0x5f32, 0x408f, 0x5a50
-    dw 0x041a, 0xb1df, 0xab54, 0x4269
-    dw 0x041b, 0x7518, 0x073d, 0x7c00
-    dw 0x041c, 0x6275, 0x6c67, 0x31de
-    dw 0x041d, 0x4b61, 0x0473, 0x7c00
-    dw 0x041e, 0x3611, 0xc892, 0xa94f
-    dw 0x041f, 0x06c7, 0xeb7f, 0x8000
-    dw 0x0420, 0x99e1, 0x97a5, 0x3e27
-    dw 0x0421, 0x6ef6, 0x72ed, 0x3805
-    dw 0x0422, 0x8179, 0x8115, 0x3d72
-    dw 0x0423, 0xd7e1, 0x5bab, 0xb81c
-    dw 0x0424, 0xd90f, 0x53aa, 0xc148
-    dw 0x0425, 0xb011, 0x7183, 0x80bd
-    dw 0x0426, 0xb8ce, 0xb2cd, 0x41a7
-    dw 0x0427, 0xcf65, 0xd676, 0x3494
-    dw 0x0428, 0x87d2, 0x2e98, 0x94be
-    dw 0x0429, 0x1705, 0x39b1, 0x18ef
-    dw 0x042a, 0xd9ec, 0x8c1d, 0x7c00
-    dw 0x042b, 0x40ef, 0x3c61, 0x4082
-    dw 0x042c, 0xf884, 0x8c50, 0x7c00
-    dw 0x042d, 0x40d4, 0x2e95, 0x4dde
-    dw 0x042e, 0x54e2, 0x479b, 0x4923
-    dw 0x042f, 0x1a14, 0xeec3, 0x8007
-    dw 0x0430, 0xdf40, 0x890a, 0x7c00
-    dw 0x0431, 0x61b0, 0x60b9, 0x3cd1
-    dw 0x0432, 0x0a1f, 0x3991, 0x0c66
-    dw 0x0433, 0xbc65, 0xe32f, 0x14e5
-    dw 0x0434, 0x8d3b, 0x6c76, 0x8001
-    dw 0x0435, 0x54b2, 0x460a, 0x4a38
-    dw 0x0436, 0x1f43, 0x2418, 0x3718
-    dw 0x0437, 0x1c80, 0xa715, 0xb115
-    dw 0x0438, 0x52b0, 0x3385, 0x5b1d
-    dw 0x0439, 0xe0c7, 0x2c9c, 0xf025
-    dw 0x043a, 0xbfa2, 0x21b6, 0xd959
-    dw 0x043b, 0x68fd, 0xb826, 0xeccf
-    dw 0x043c, 0xae06, 0xa9d1, 0x4024
-    dw 0x043d, 0xe6bb, 0x02e8, 0xfc00
-    dw 0x043e, 0xf16c, 0x00cf, 0xfc00
-    dw 0x043f, 0xf1ab, 0xd0ad, 0x5cd9
-    dw 0x0440, 0x89d9, 0x535b, 0x8033
-    dw 0x0441, 0x3166, 0x93f8, 0xd96b
-    dw 0x0442, 0x8cec, 0xedcb, 0x0001
-    dw 0x0443, 0x7727, 0x1a27, 0x7c00
-    dw 0x0444, 0x5a42, 0xcbda, 0xca60
-    dw 0x0445, 0x6031, 0x7985, 0x2213
-    dw 0x0446, 0xeff2, 0x209b, 0xfc00
-    dw 0x0447, 0x42a2, 0xb036, 0xce4d
-    dw 0x0448, 0x0162, 0x6f3e, 0x0000
-    dw 0x0449, 0x6fd8, 0x2318, 0x7c00
-    dw 0x044a, 0xd83b, 0x27fe, 0xec3c
-    dw 0x044b, 0xd11e, 0x820c, 0x7c00
-    dw 0x044c, 0x0eb9, 0xd406, 0x806b
-    dw 0x044d, 0x7378, 0x0f88, 0x7c00
-    dw 0x044e, 0xc5b1, 0x4425, 0xbd7e
-    dw 0x044f, 0x9961, 0x190c, 0xbc43
-    dw 0x0450, 0x758c, 0x2d5a, 0x7c00
-    dw 0x0451, 0xa5f8, 0x6357, 0x81a0
-    dw 0x0452, 0xa481, 0xc01f, 0x205f
-    dw 0x0453, 0xbd99, 0x705b, 0x8924
-    dw 0x0454, 0x2051, 0x371f, 0x24d9
-    dw 0x0455, 0x604d, 0x9d02, 0xfc00
-    dw 0x0456, 0x57ba, 0xa2ef, 0xf075
-    dw 0x0457, 0x4d39, 0x591c, 0x3017
-    dw 0x0458, 0x122d, 0xbd11, 0x90e0
-    dw 0x0459, 0xea68, 0xe510, 0x4110
-    dw 0x045a, 0x4d52, 0x6c74, 0x1cc7
-    dw 0x045b, 0xf3c9, 0x2158, 0xfc00
-    dw 0x045c, 0xdfed, 0x0352, 0xfc00
-    dw 0x045d, 0xe709, 0x2412, 0xfc00
-    dw 0x045e, 0x9cb3, 0x0015, 0xeb29
-    dw 0x045f, 0x999e, 0xca0d, 0x0b6d
-    dw 0x0460, 0xa60d, 0x6e8f, 0x803b
-    dw 0x0461, 0x662c, 0xba8f, 0xe787
-    dw 0x0462, 0xdeea, 0x867d, 0x7c00
-    dw 0x0463, 0xf1ae, 0x3f38, 0xee4b
-    dw 0x0464, 0x2380, 0x4968, 0x158d
-    dw 0x0465, 0xe227, 0x70b9, 0xad36
-    dw 0x0466, 0xa284, 0xf455, 0x000c
-    dw 0x0467, 0x2dca, 0x1eb8, 0x4ae5
-    dw 0x0468, 0xdebd, 0x12da, 0xfc00
-    dw 0x0469, 0x6c0a, 0x4b32, 0x5c7e
-    dw 0x046a, 0x06a4, 0x8d62, 0xb4ef
-    dw 0x046b, 0x2b1f, 0x09f6, 0x5cc7
-    dw 0x046c, 0x746b, 0x4f31, 0x60ea
-    dw 0x046d, 0xa6a9, 0x7480, 0x8018
-    dw 0x046e, 0xe8d0, 0x70b7, 0xb415
-    dw 0x046f, 0x1a8d, 0xe5c6, 0x8024
-    dw 0x0470, 0xdf46, 0x80ba, 0x7c00
-    dw 0x0471, 0xa055, 0xbe30, 0x1d9a
-    dw 0x0472, 0x0737, 0x9204, 0xb0cc
-    dw 0x0473, 0x2ab7, 0xdb6c, 0x8b3d
-    dw 0x0474, 0xdf90, 0x9b70, 0x7c00
-    dw 0x0475, 0xd3e5, 0xc93b, 0x460a
-    dw 0x0476, 0x9ca9, 0xb2a2, 0x259f
-    dw 0x0477, 0xdc15, 0x08b4, 0xfc00
-    dw 0x0478, 0xe2b9, 0x9616, 0x7c00
-    dw 0x0479, 0x28f3, 0xecaf, 0x8087
-    dw 0x047a, 0x0a82, 0x7825, 0x0000
-    dw 0x047b, 0x9359, 0x60f5, 0x8018
-    dw 0x047c, 0x0410, 0x9990, 0xa5d8
-    dw 0x047d, 0x46bb, 0xe356, 0x9f57
-    dw 0x047e, 0x1a4a, 0xe710, 0x801c
-    dw 0x047f, 0xa186, 0x2181, 0xbc04
-    dw 0x0480, 0x7914, 0x9eef, 0xfc00
-    dw 0x0481, 0x4c39, 0x5481, 0x3380
-    dw 0x0482, 0xe7a9, 0xd272, 0x50c1
-    dw 0x0483, 0x5264, 0xb0e4, 0xdd3a
-    dw 0x0484, 0x6f1b, 0x0506, 0x7c00
-    dw 0x0485, 0x8cfa, 0x77cf, 0x8000
-    dw 0x0486, 0x02db, 0x6fb3, 0x0000
-    dw 0x0487, 0x0de6, 0x2bce, 0x1e0c
-    dw 0x0488, 0x5c63, 0x1868, 0x7c00
-    dw 0x0489, 0xa3f3, 0xefbc, 0x0021
-    dw 0x048a, 0x976a, 0x04e8, 0xce0b
-    dw 0x048b, 0xf3cc, 0x30fa, 0xfc00
-    dw 0x048c, 0x4ba3, 0xd722, 0xb048
-    dw 0x048d, 0x4b44, 0x32b4, 0x5456
-    dw 0x048e, 0x78a8, 0x6cc6, 0x47ce
-    dw 0x048f, 0xabc8, 0x1797, 0xd01a
-    dw 0x0490, 0xb8ff, 0x0049, 0xfc00
-    dw 0x0491, 0x9616, 0xa0a8, 0x313a
-    dw 0x0492, 0xd2bb, 0xe87a, 0x2604
-    dw 0x0493, 0x518d, 0x41d7, 0x4b9b
-    dw 0x0494, 0xed81, 0xde87, 0x4abf
-    dw 0x0495, 0xb9a6, 0xf05c, 0x052f
-    dw 0x0496, 0x4e3a, 0xc78c, 0xc29a
-    dw 0x0497, 0x1c2a, 0xaa9d, 0xad0a
-    dw 0x0498, 0xdff4, 0xc01e, 0x5bba
-    dw 0x0499, 0x9a59, 0x775f, 0x8002
-    dw 0x049a, 0xc506, 0x8e25, 0x728a
-    dw 0x049b, 0xa859, 0x10aa, 0xd375
-    dw 0x049c, 0x6547, 0xf39e, 0xad8b
-    dw 0x049d, 0x435e, 0xddf0, 0xa0f7
-    dw 0x049e, 0x6064, 0xef26, 0xacea
-    dw 0x049f, 0xf587, 0x1963, 0xfc00
-    dw 0x04a0, 0xef70, 0x8b9e, 0x7c00
-    dw 0x04a1, 0xba0b, 0xc22b, 0x33d6
-    dw 0x04a2, 0x7418, 0x0b98, 0x7c00
-    dw 0x04a3, 0x0402, 0x6199, 0x0001
-    dw 0x04a4, 0xea1f, 0xbda9, 0x6853
-    dw 0x04a5, 0x51f5, 0x385a, 0x557a
-    dw 0x04a6, 0x8535, 0x6e20, 0x8000
-    dw 0x04a7, 0xe2f7, 0x652a, 0xb965
-    dw 0x04a8, 0x2e3e, 0xdc89, 0x8d81
-    dw 0x04a9, 0xf344, 0x0b76, 0xfc00
-    dw 0x04aa, 0x84e2, 0x03ee, 0xbcf8
-    dw 0x04ab, 0x70be, 0x7880, 0x3437
-    dw 0x04ac, 0x474c, 0x4eae, 0x345f
-    dw 0x04ad, 0xd8e4, 0x3673, 0xde11
-    dw 0x04ae, 0x4435, 0xf247, 0x8d5d
-    dw 0x04af, 0x25e3, 0xcfd3, 0x9205
-    dw 0x04b0, 0xac53, 0xe80e, 0x0222
-    dw 0x04b1, 0x43ec, 0xb7eb, 0xc801
-    dw 0x04b2, 0xec11, 0xa585, 0x7c00
-    dw 0x04b3, 0xa20b, 0xa9ba, 0x3439
-    dw 0x04b4, 0xf77b, 0xda65, 0x58ae
-    dw 0x04b5, 0x2eef, 0x659b, 0x04f3
-    dw 0x04b6, 0xbd5c, 0x9419, 0x653b
-    dw 0x04b7, 0x93d9, 0x3aad, 0x94b4
-    dw 0x04b8, 0x70a2, 0x871d, 0xfc00
-    dw 0x04b9, 0x4624, 0xf585, 0x8c73
-    dw 0x04ba, 0x8b0c, 0xb6e2, 0x1018
-    dw 0x04bb, 0x6e05, 0xd258, 0xd797
-    dw 0x04bc, 0x0590, 0x46ea, 0x00ce
-    dw 0x04bd, 0x08cb, 0x49c5, 0x00d5
-    dw 0x04be, 0x3931, 0x2eae, 0x4638
-    dw 0x04bf, 0x1999, 0xe584, 0x8020
-    dw 0x04c0, 0x16bd, 0x5d85, 0x004e
-    dw 0x04c1, 0x9d70, 0x02ce, 0xd7c1
-    dw 0x04c2, 0x030a, 0x3f7b, 0x01a0
-    dw 0x04c3, 0xac88, 0xfa85, 0x0016
-    dw 0x04c4, 0x19e0, 0xdb77, 0x80c9
-    dw 0x04c5, 0x6020, 0xd73c, 0xc490
-    dw 0x04c6, 0x6f91, 0xf3f9, 0xb798
-    dw 0x04c7, 0x11ea, 0xe033, 0x8017
-    dw 0x04c8, 0x7b17, 0x580e, 0x5eff
-    dw 0x04c9, 0xd5b8, 0x0623, 0xfc00
-    dw 0x04ca, 0x0ef0, 0x43be, 0x072b
-    dw 0x04cb, 0xd87b, 0x1480, 0xfc00
-    dw 0x04cc, 0x8aa8, 0xe147, 0x0005
-    dw 0x04cd, 0x5e45, 0xc3d9, 0xd664
-    dw 0x04ce, 0x0ff5, 0x77de, 0x0000
-    dw 0x04cf, 0xa95e, 0x26b2, 0xbe6a
-    dw 0x04d0, 0xd563, 0x46ce, 0xca55
-    dw 0x04d1, 0x2980, 0xd86e, 0x8cf7
-    dw 0x04d2, 0x8649, 0xd608, 0x0011
-    dw 0x04d3, 0xd2f3, 0xa029, 0x6eaf
-    dw 0x04d4, 0xb180, 0x3314, 0xba37
-    dw 0x04d5, 0x7765, 0x2111, 0x7c00
-    dw 0x04d6, 0x270d, 0x894f, 0xd950
-    dw 0x04d7, 0x0144, 0xa224, 0x9698
-    dw 0x04d8, 0xe15d, 0xd6fd, 0x4624
-    dw 0x04d9, 0xa847, 0xf04d, 0x0040
-    dw 0x04da, 0x1abb, 0x80c3, 0xdc6b
-    dw 0x04db, 0x04cd, 0xa563, 0x9b21
-    dw 0x04dc, 0x620a, 0x6313, 0x3ad4
-    dw 0x04dd, 0x693c, 0x71ff, 0x32fc
-    dw 0x04de, 0xdaf1, 0x129a, 0xfc00
-    dw 0x04df, 0x98b2, 0xb055, 0x2456
-    dw 0x04e0, 0x5968, 0xc232, 0xd2fb
-    dw 0x04e1, 0x88c3, 0xdfb1, 0x0005
-    dw 0x04e2, 0x983b, 0x5bb6, 0x808c
-    dw 0x04e3, 0x49bb, 0x8eca, 0xf6c1
-    dw 0x04e4, 0xf740, 0x6acc, 0xc844
-    dw 0x04e5, 0xb5d8, 0x808f, 0x793b
-    dw 0x04e6, 0x6c10, 0x57fc, 0x5012
-    dw 0x04e7, 0x61ed, 0x430d, 0x5ab9
-    dw 0x04e8, 0x0044, 0x523a, 0x0001
-    dw 0x04e9, 0x5dc8, 0x8107, 0xfc00
-    dw 0x04ea, 0x5708, 0x032b, 0x7c00
-    dw 0x04eb, 0xe311, 0xba1b, 0x64a1
-    dw 0x04ec, 0x6c68, 0x5510, 0x52f7
-    dw 0x04ed, 0x950c, 0xedc2, 0x0004
-    dw 0x04ee, 0x4561, 0xd86b, 0xa8df
-    dw 0x04ef, 0xaff5, 0xce24, 0x1d2f
-    dw 0x04f0, 0xb81c, 0x4830, 0xabda
-    dw 0x04f1, 0x29db, 0x37f7, 0x2de2
-    dw 0x04f2, 0x91eb, 0xb8a5, 0x1519
-    dw 0x04f3, 0x2f37, 0x6e7d, 0x011d
-    dw 0x04f4, 0xafc6, 0x68c7, 0x8341
-    dw 0x04f5, 0xc67a, 0x11b3, 0xf08c
-    dw 0x04f6, 0xabd5, 0xc6be, 0x20a6
-    dw 0x04f7, 0x63ee, 0x099d, 0x7c00
-    dw 0x04f8, 0x47c5, 0xbaf6, 0xc877
-    dw 0x04f9, 0x0cc9, 0x2ad6, 0x1d9a
-    dw 0x04fa, 0x7511, 0x7931, 0x37cf
-    dw 0x04fb, 0x0a1d, 0xf833, 0x8000
-    dw 0x04fc, 0x6da9, 0x4f7f, 0x5a0a
-    dw 0x04fd, 0xd09e, 0x1d9e, 0xee93
-    dw 0x04fe, 0x1da3, 0x88bb, 0xd0c4
-    dw 0x04ff, 0x65ce, 0x477e, 0x5a33
-    dw 0x0500, 0xc0b2, 0xf7b9, 0x04dd
-    dw 0x0501, 0x0024, 0xefe9, 0x8000
-    dw 0x0502, 0xf470, 0x6ea1, 0xc15b
-    dw 0x0503, 0x9faf, 0x5d37, 0x8179
-    dw 0x0504, 0x351b, 0xb163, 0xbf95
-    dw 0x0505, 0x090c, 0xfbd9, 0x8000
-    dw 0x0506, 0x1551, 0x12aa, 0x3e62
-    dw 0x0507, 0x439e, 0xd047, 0xaf20
-    dw 0x0508, 0x1f73, 0x6e74, 0x0012
-    dw 0x0509, 0x4558, 0x98a4, 0xe89b
-    dw 0x050a, 0xee5b, 0x4f75, 0xdad1
-    dw 0x050b, 0x90d7, 0x5c04, 0x8027
-    dw 0x050c, 0x9ef4, 0x6176, 0x80a3
-    dw 0x050d, 0x79a2, 0xbc98, 0xf8e8
-    dw 0x050e, 0xea31, 0xdf70, 0x46a9
-    dw 0x050f, 0x0416, 0xaae3, 0x94bf
-    dw 0x0510, 0xd729, 0x043a, 0xfc00
-    dw 0x0511, 0x9acc, 0xcb99, 0x0b28
-    dw 0x0512, 0x72dc, 0x3a7b, 0x743c
-    dw 0x0513, 0x28d0, 0xa7f7, 0xbcd5
-    dw 0x0514, 0xebde, 0x31dd, 0xf55e
-    dw 0x0515, 0xa3d1, 0x012f, 0xe29b
-    dw 0x0516, 0x4487, 0xe76f, 0x98df
-    dw 0x0517, 0xd176, 0x63fa, 0xa97a
-    dw 0x0518, 0x55e4, 0x16ce, 0x7aed
-    dw 0x0519, 0x443f, 0x6644, 0x196c
-    dw 0x051a, 0x8d75, 0xa043, 0x291f
-    dw 0x051b, 0x0538, 0xeeeb, 0x8000
-    dw 0x051c, 0x19e5, 0xc1d0, 0x940e
-    dw 0x051d, 0xd91c, 0xf955, 0x1baa
-    dw 0x051e, 0xc5e7, 0x83ff, 0x7c00
-    dw 0x051f, 0xd07e, 0xca21, 0x41dd
-    dw 0x0520, 0x1ecb, 0x9c17, 0xbea5
-    dw 0x0521, 0x3cfd, 0x5947, 0x1f90
-    dw 0x0522, 0xc4e7, 0xe4f5, 0x1be9
-    dw 0x0523, 0x4525, 0xf6c4, 0x8a15
-    dw 0x0524, 0x88c6, 0x4655, 0x8182
-    dw 0x0525, 0x3b4b, 0x7035, 0x06ef
-    dw 0x0526, 0x17cb, 0x9f45, 0xb44a
-    dw 0x0527, 0xc619, 0x2e9a, 0xd364
-    dw 0x0528, 0x9be3, 0x0a58, 0xccf9
-    dw 0x0529, 0x94de, 0x2959, 0xa748
-    dw 0x052a, 0xaa9b, 0x9a16, 0x4c57
-    dw 0x052b, 0x1844, 0xc480, 0x8f95
-    dw 0x052c, 0x5be7, 0xf161, 0xa5e0
-    dw 0x052d, 0xbdd5, 0x21ce, 0xd805
-    dw 0x052e, 0x7560, 0x8e53, 0xfc00
-    dw 0x052f, 0xebef, 0x942c, 0x7c00
-    dw 0x0530, 0x2a6a, 0x28ed, 0x3d35
-    dw 0x0531, 0xed73, 0xef52, 0x39f5
-    dw 0x0532, 0x0de2, 0x3298, 0x1723
-    dw 0x0533, 0xe616, 0x96a8, 0x7c00
-    dw 0x0534, 0x78ed, 0x2162, 0x7c00
-    dw 0x0535, 0x06dd, 0x90b9, 0xb1d0
-    dw 0x0536, 0xc0a7, 0xccf7, 0x2f7f
-    dw 0x0537, 0xbf53, 0x5c8b, 0x9e73
-    dw 0x0538, 0xd74f, 0x5431, 0xbefa
-    dw 0x0539, 0x85e4, 0x81eb, 0x4224
-    dw 0x053a, 0xee47, 0x9e28, 0x7c00
-    dw 0x053b, 0x466b, 0x4a2e, 0x3827
-    dw 0x053c, 0x8f89, 0x0441, 0xc716
-    dw 0x053d, 0x6bfc, 0x04ea, 0x7c00
-    dw 0x053e, 0x9294, 0x57ec, 0x806a
-    dw 0x053f, 0x9916, 0xbcff, 0x1812
-    dw 0x0540, 0x80d9, 0x8689, 0x3027
-    dw 0x0541, 0xac51, 0x8ebb, 0x5921
-    dw 0x0542, 0xb921, 0x9267, 0x6269
-    dw 0x0543, 0x2563, 0x320f, 0x2f1d
-    dw 0x0544, 0xb3c9, 0x2c40, 0xc354
-    dw 0x0545, 0xc2c8, 0x7471, 0x8a1b
-    dw 0x0546, 0xf937, 0x821b, 0x7c00
-    dw 0x0547, 0xd0fc, 0xd087, 0x3c67
-    dw 0x0548, 0xd64c, 0x56e0, 0xbb54
-    dw 0x0549, 0x5272, 0xc493, 0xc9a3
-    dw 0x054a, 0xf508, 0x98dd, 0x7c00
-    dw 0x054b, 0x0ec2, 0x8492, 0xc5ea
-    dw 0x054c, 0x9d1e, 0x7abe, 0x8002
-    dw 0x054d, 0x897c, 0x2fb3, 0x95b3
-    dw 0x054e, 0xd2aa, 0x2292, 0xec0f
-    dw 0x054f, 0xecb2, 0x5383, 0xd500
-    dw 0x0550, 0xa91b, 0x9903, 0x4c13
-    dw 0x0551, 0xe23e, 0x623c, 0xbc01
-    dw 0x0552, 0x2b6a, 0x07a1, 0x5fc6
-    dw 0x0553, 0x944b, 0xdf34, 0x0026
-    dw 0x0554, 0x33e2, 0x5713, 0x1875
-    dw 0x0555, 0x53a5, 0x2d19, 0x6200
-    dw 0x0556, 0xd92e, 0x24a1, 0xf07a
-    dw 0x0557, 0xaf7a, 0x7b81, 0x8020
-    dw 0x0558, 0x5012, 0x740e, 0x1804
-    dw 0x0559, 0x7089, 0xe8f0, 0xc359
-    dw 0x055a, 0x82d0, 0xf51b, 0x0000
-    dw 0x055b, 0x860e, 0xb5c1, 0x0c36
-    dw 0x055c, 0xd039, 0xa129, 0x6a8c
-    dw 0x055d, 0xa273, 0x23bc, 0xbaac
-    dw 0x055e, 0x4a44, 0x3b76, 0x4ab8
-    dw 0x055f, 0x05fb, 0xac81, 0x9550
-    dw 0x0560, 0x66e1, 0x0d9c, 0x7c00
-    dw 0x0561, 0x40cc, 0x4615, 0x364f
-    dw 0x0562, 0x417e, 0x97e0, 0xe594
-    dw 0x0563, 0x99ba, 0x6e98, 0x8007
-    dw 0x0564, 0x710e, 0xbe5b, 0xee5d
-    dw 0x0565, 0x6c38, 0x2089, 0x7c00
-    dw 0x0566, 0x39dc, 0xbc4b, 0xb976
-    dw 0x0567, 0x9497, 0xaa65, 0x25be
-    dw 0x0568, 0xa53b, 0x1767, 0xc9a7
-    dw 0x0569, 0x9f81, 0x2b49, 0xb01f
-    dw 0x056a, 0x14f5, 0x1e18, 0x3282
-    dw 0x056b, 0xe10b, 0xe52e, 0x37ca
-    dw 0x056c, 0xbf42, 0x837e, 0x7828
-    dw 0x056d, 0x08eb, 0x0986, 0x3b20
-    dw 0x056e, 0xbef5, 0x0ee6, 0xec09
-    dw 0x056f, 0xb607, 0x25d6, 0xcc22
-    dw 0x0570, 0x1c82, 0xf6d4, 0x8003
-    dw 0x0571, 0x6beb, 0x5e01, 0x4946
-    dw 0x0572, 0x8eb4, 0x05a5, 0xc4c0
-    dw 0x0573, 0xcc99, 0xc400, 0x4499
-    dw 0x0574, 0x38d1, 0x204b, 0x547d
-    dw 0x0575, 0xf51c, 0xb4e2, 0x7c00
-    dw 0x0576, 0xa841, 0x9a57, 0x495e
-    dw 0x0577, 0xcc49, 0x47c2, 0xc06b
-    dw 0x0578, 0xc5a1, 0xe13f, 0x204b
-    dw 0x0579, 0x65db, 0xa6ac, 0xfb05
-    dw 0x057a, 0xc66d, 0x251d, 0xdd07
-    dw 0x057b, 0x2a2a, 0xcf58, 0x96b7
-    dw 0x057c, 0x2ea3, 0xe91f, 0x8298
-    dw 0x057d, 0xde3e, 0xe4ab, 0x3559
-    dw 0x057e, 0x0ef5, 0xfac1, 0x8000
-    dw 0x057f, 0xdb7f, 0x7ae0, 0x9c5d
-    dw 0x0580, 0x58c2, 0x6a33, 0x2a24
-    dw 0x0581, 0x8085, 0x255b, 0x8e35
-    dw 0x0582, 0x69f5, 0x4485, 0x6146
-    dw 0x0583, 0x5e2c, 0x8a41, 0xfc00
-    dw 0x0584, 0x4261, 0x5349, 0x2b01
-    dw 0x0585, 0x3f23, 0xeaa3, 0x904d
-    dw 0x0586, 0xeda0, 0x0b6d, 0xfc00
-    dw 0x0587, 0x3265, 0xb341, 0xbb0d
-    dw 0x0588, 0xecac, 0x9840, 0x7c00
-    dw 0x0589, 0x59ed, 0xb319, 0xe2ae
-    dw 0x058a, 0xbd5d, 0x8418, 0x753e
-    dw 0x058b, 0x8272, 0xec01, 0x0000
-    dw 0x058c, 0x6d37, 0x60b0, 0x4873
-    dw 0x058d, 0xd0ac, 0x5b71, 0xb106
-    dw 0x058e, 0xac2b, 0xf70d, 0x0026
-    dw 0x058f, 0xb433, 0x165e, 0xd947
-    dw 0x0590, 0x7793, 0xd98e, 0xd974
-    dw 0x0591, 0x8053, 0xbc18, 0x0051
-    dw 0x0592, 0x37bb, 0x0a94, 0x68b3
-    dw 0x0593, 0x8b04, 0x49b8, 0x813a
-    dw 0x0594, 0xe91d, 0x78a4, 0xac68
-    dw 0x0595, 0x5525, 0x1b82, 0x757b
-    dw 0x0596, 0x2be6, 0x41d1, 0x256f
-    dw 0x0597, 0xb3c3, 0x85d3, 0x6955
-    dw 0x0598, 0xf4ea, 0x7120, 0xbfac
-    dw 0x0599, 0x09eb, 0x775c, 0x0000
-    dw 0x059a, 0x5d21, 0x7723, 0x21c0
-    dw 0x059b, 0xd80d, 0x2dcd, 0xe596
-    dw 0x059c, 0xf350, 0x337e, 0xfbcf
-    dw 0x059d, 0xd9f8, 0xea5d, 0x2b81
-    dw 0x059e, 0xe7b2, 0xf056, 0x3319
-    dw 0x059f, 0x61f0, 0xc140, 0xdc86
-    dw 0x05a0, 0x70aa, 0x1e09, 0x7c00
-    dw 0x05a1, 0xf8fb, 0x7b3e, 0xb980
-    dw 0x05a2, 0x1c83, 0x83ff, 0xd484
-    dw 0x05a3, 0xc4f6, 0x05a0, 0xfb0e
-    dw 0x05a4, 0x1a1b, 0x2122, 0x34c2
-    dw 0x05a5, 0x288a, 0x5bec, 0x0895
-    dw 0x05a6, 0xd4e5, 0xae5d, 0x6227
-    dw 0x05a7, 0x50d7, 0x4606, 0x466e
-    dw 0x05a8, 0xb849, 0xc833, 0x2c15
-    dw 0x05a9, 0xa327, 0x2f6c, 0xafb6
-    dw 0x05aa, 0xa040, 0xd0f5, 0x0adc
-    dw 0x05ab, 0x22bc, 0xd3bf, 0x8af5
-    dw 0x05ac, 0xaaed, 0x0d19, 0xd96f
-    dw 0x05ad, 0xbb71, 0x9b44, 0x5c19
-    dw 0x05ae, 0x6f0a, 0x0bee, 0x7c00
-    dw 0x05af, 0x8d13, 0x75ad, 0x8000
-    dw 0x05b0, 0x872c, 0xa996, 0x1923
-    dw 0x05b1, 0xf9ac, 0x4c23, 0xe97c
-    dw 0x05b2, 0xaf36, 0xf650, 0x0049
-    dw 0x05b3, 0x663e, 0xd058, 0xd1c0
-    dw 0x05b4, 0x1eda, 0xc22b, 0x9871
-    dw 0x05b5, 0xa53e, 0xcd38, 0x1405
-    dw 0x05b6, 0x1302, 0xeb44, 0x8004
-    dw 0x05b7, 0x8581, 0xdb35, 0x0006
-    dw 0x05b8, 0x8e6b, 0xb4ed, 0x1536
-    dw 0x05b9, 0x7b76, 0x5f60, 0x580c
-    dw 0x05ba, 0xd7a9, 0x4f35, 0xc440
-    dw 0x05bb, 0x0a4e, 0xe4c2, 0x8003
-    dw 0x05bc, 0x0aa6, 0xa592, 0xa0c6
-    dw 0x05bd, 0x53cc, 0x8757, 0xfc00
-    dw 0x05be, 0xb180, 0xe0df, 0x0c84
-    dw 0x05bf, 0x38ac, 0x8a75, 0xe9ca
-    dw 0x05c0, 0xf6b1, 0x84cf, 0x7c00
-    dw 0x05c1, 0x39ab, 0xed01, 0x8888
-    dw 0x05c2, 0xeb0e, 0x0a04, 0xfc00
-    dw 0x05c3, 0x0bdc, 0xad39, 0x9a05
-    dw 0x05c4, 0xaf42, 0xd914, 0x11b8
-    dw 0x05c5, 0xc03b, 0x9a86, 0x6130
-    dw 0x05c6, 0x5e95, 0x9b70, 0xfc00
-    dw 0x05c7, 0x28f1, 0x1382, 0x5144
-    dw 0x05c8, 0x16e6, 0x8852, 0xca63
-    dw 0x05c9, 0xeb2b, 0x661b, 0xc0b2
-    dw 0x05ca, 0x92a0, 0xcfed, 0x01ac
-    dw 0x05cb, 0x70c1, 0x3832, 0x7488
-    dw 0x05cc, 0x23ba, 0xf819, 0x8008
-    dw 0x05cd, 0xe9b2, 0x0499, 0xfc00
-    dw 0x05ce, 0xf51d, 0x225e, 0xfc00
-    dw 0x05cf, 0x8f0f, 0xebce, 0x0002
-    dw 0x05d0, 0xa72e, 0xc8ba, 0x1a13
-    dw 0x05d1, 0xd8d0, 0x923c, 0x7c00
-    dw 0x05d2, 0xd2be, 0xe4ac, 0x29c6
-    dw 0x05d3, 0x3f75, 0x8200, 0xfb75
-    dw 0x05d4, 0xbdc0, 0x1c86, 0xdd16
-    dw 0x05d5, 0x1c55, 0x9b20, 0xbcdd
-    dw 0x05d6, 0x4578, 0x2fd7, 0x5195
-    dw 0x05d7, 0xb207, 0xcdca, 0x202a
-    dw 0x05d8, 0x1b02, 0x1822, 0x3ec8
-    dw 0x05d9, 0x606a, 0xeaef, 0xb118
-    dw 0x05da, 0x88e4, 0x989c, 0x2c3e
-    dw 0x05db, 0x0ea9, 0x80fd, 0xcebd
-    dw 0x05dc, 0x824e, 0x1343, 0xa914
-    dw 0x05dd, 0x761a, 0xa4ac, 0xfc00
-    dw 0x05de, 0xa252, 0x61e9, 0x8112
-    dw 0x05df, 0x4bda, 0x6b0c, 0x1c75
-    dw 0x05e0, 0x3ab9, 0xde16, 0x986b
-    dw 0x05e1, 0x3dcb, 0x1f65, 0x5a44
-    dw 0x05e2, 0x1d8b, 0xbfcb, 0x99b1
-    dw 0x05e3, 0xdd25, 0x1d3b, 0xfbde
-    dw 0x05e4, 0xdc52, 0xf97a, 0x1e50
-    dw 0x05e5, 0xb85c, 0x21ca, 0xd206
-    dw 0x05e6, 0x2951, 0x6a63, 0x00d5
-    dw 0x05e7, 0xef94, 0x4453, 0xe703
-    dw 0x05e8, 0x8285, 0x4ffe, 0x8014
-    dw 0x05e9, 0x2f42, 0x0b69, 0x5fd6
-    dw 0x05ea, 0xe89a, 0x3dec, 0xe637
-    dw 0x05eb, 0x8c66, 0x6ae8, 0x8001
-    dw 0x05ec, 0x512f, 0x0281, 0x7c00
-    dw 0x05ed, 0x0f94, 0xf381, 0x8001
-    dw 0x05ee, 0x646a, 0x5b6f, 0x44c0
-    dw 0x05ef, 0x5e8d, 0x9f23, 0xfb58
-    dw 0x05f0, 0x3985, 0x9c58, 0xd915
-    dw 0x05f1, 0xbe88, 0x5711, 0xa365
-    dw 0x05f2, 0x5c24, 0x9bad, 0xfc00
-    dw 0x05f3, 0x744c, 0x3876, 0x77b5
-    dw 0x05f4, 0x9527, 0x2ca8, 0xa46d
-    dw 0x05f5, 0x5a40, 0xbe78, 0xd7bb
-    dw 0x05f6, 0x970b, 0x49d4, 0x88d5
-    dw 0x05f7, 0x02cb, 0x1991, 0x2404
-    dw 0x05f8, 0x99d2, 0x320d, 0xa3b2
-    dw 0x05f9, 0x24fa, 0x826c, 0xe01c
-    dw 0x05fa, 0x6ff9, 0xb161, 0xf9ee
-    dw 0x05fb, 0xed54, 0xc128, 0x6822
-    dw 0x05fc, 0xb3e2, 0xb4a9, 0x3ac4
-    dw 0x05fd, 0x184c, 0x5857, 0x00fd
-    dw 0x05fe, 0x1337, 0xb76f, 0x97c4
-    dw 0x05ff, 0x91dd, 0xaf8f, 0x1e35
-    dw 0x0600, 0x75f7, 0xe8ee, 0xc8d7
-    dw 0x0601, 0x0bb3, 0x11a4, 0x3576
-    dw 0x0602, 0x5d3a, 0x4429, 0x5506
-    dw 0x0603, 0xa6cb, 0x89e3, 0x589e
-    dw 0x0604, 0x9e69, 0x6543, 0x804e
-    dw 0x0605, 0x20ee, 0xe83d, 0x804a
-    dw 0x0606, 0x680e, 0x3a7f, 0x68fe
-    dw 0x0607, 0x820f, 0x9a1b, 0x2165
-    dw 0x0608, 0x5f7a, 0x047b, 0x7c00
-    dw 0x0609, 0x0a15, 0x10db, 0x3503
-    dw 0x060a, 0xf1cf, 0xcb3d, 0x626b
-    dw 0x060b, 0xc4bd, 0xeeb8, 0x11a4
-    dw 0x060c, 0xdd09, 0x470f, 0xd1b5
-    dw 0x060d, 0x931e, 0x9478, 0x3a5f
-    dw 0x060e, 0xd8ec, 0x42ad, 0xd1e6
-    dw 0x060f, 0x0a6f, 0xc1da, 0x8466
-    dw 0x0610, 0x4e61, 0x1c13, 0x6e43
-    dw 0x0611, 0x1f15, 0x928a, 0xc855
-    dw 0x0612, 0xc2de, 0xa8f8, 0x5587
-    dw 0x0613, 0x30f4, 0x2821, 0x44cc
-    dw 0x0614, 0xc9e6, 0x1931, 0xec8b
-    dw 0x0615, 0x902f, 0x0466, 0xc79c
-    dw 0x0616, 0x9b41, 0x2a4a, 0xac9d
-    dw 0x0617, 0x63e0, 0x9fbc, 0xfc00
-    dw 0x0618, 0x345f, 0x74bb, 0x00ed
-    dw 0x0619, 0x918c, 0x3978, 0x940f
-    dw 0x061a, 0x8044, 0x1681, 0x993a
-    dw 0x061b, 0xc753, 0x12a2, 0xf06b
-    dw 0x061c, 0xaaf9, 0xa040, 0x4690
-    dw 0x061d, 0x554f, 0xb568, 0xdbdb
-    dw 0x061e, 0x621a, 0xa3b0, 0xfa59
-    dw 0x061f, 0xd17b, 0x812f, 0x7c00
-    dw 0x0620, 0x363b, 0x9459, 0xddbb
-    dw 0x0621, 0x2a27, 0x672f, 0x01b6
-    dw 0x0622, 0xbc7a, 0xf40e, 0x046b
-    dw 0x0623, 0x8060, 0x4ca9, 0x8005
-    dw 0x0624, 0xf874, 0x1ba1, 0xfc00
-    dw 0x0625, 0x76f3, 0x5c54, 0x566c
-    dw 0x0626, 0xbb5e, 0xab53, 0x4c06
-    dw 0x0627, 0xd10f, 0x4cea, 0xc01e
-    dw 0x0628, 0xaaf0, 0x0a87, 0xdc40
-    dw 0x0629, 0xcd2e, 0x2a74, 0xde6c
-    dw 0x062a, 0x2108, 0x9481, 0xc878
-    dw 0x062b, 0x3d16, 0xcc01, 0xad15
-    dw 0x062c, 0x34c1, 0x9265, 0xddf3
-    dw 0x062d, 0x8169, 0x96dc, 0x2294
-    dw 0x062e, 0x3616, 0x52e4, 0x1f11
-    dw 0x062f, 0x180b, 0x6c51, 0x0007
-    dw 0x0630, 0xe73d, 0x4233, 0xe0ac
-    dw 0x0631, 0xd380, 0xa3b7, 0x6bc7
-    dw 0x0632, 0x3641, 0x53e0, 0x1e5a
-    dw 0x0633, 0xf060, 0x2eb5, 0xfc00
-    dw 0x0634, 0x6f82, 0x6753, 0x441a
-    dw 0x0635, 0x8b09, 0x2ae0, 0x9c18
-    dw 0x0636, 0x12a6, 0x5c18, 0x0034
-    dw 0x0637, 0x77ca, 0xbd96, 0xf594
-    dw 0x0638, 0x669f, 0x44f8, 0x5d55
-    dw 0x0639, 0xe80a, 0x87a7, 0x7c00
-    dw 0x063a, 0xd979, 0x2520, 0xf045
-    dw 0x063b, 0x53a8, 0x0e3b, 0x7c00
-    dw 0x063c, 0xb786, 0xd511, 0x1df1
-    dw 0x063d, 0xa517, 0xed9c, 0x003a
-    dw 0x063e, 0x27f5, 0xbd22, 0xa633
-    dw 0x063f, 0x59ed, 0x0f32, 0x7c00
-    dw 0x0640, 0x2d6d, 0xb2e9, 0xb648
-    dw 0x0641, 0x3596, 0x814d, 0xf44b
-    dw 0x0642, 0xa349, 0x644b, 0x80d9
-    dw 0x0643, 0xf0cf, 0x0a9c, 0xfc00
-    dw 0x0644, 0xef54, 0x1baf, 0xfc00
-    dw 0x0645, 0x1d43, 0x4b6c, 0x0dac
-    dw 0x0646, 0x9379, 0xdad9, 0x0046
-    dw 0x0647, 0xb20b, 0xd871, 0x1571
-    dw 0x0648, 0xc2e4, 0x39b2, 0xc4d7
-    dw 0x0649, 0xb1eb, 0xe804, 0x05e5
-    dw 0x064a, 0x8d5a, 0xc026, 0x0929
-    dw 0x064b, 0x9f8a, 0x626b, 0x8096
-    dw 0x064c, 0x653d, 0x8d26, 0xfc00
-    dw 0x064d, 0x8a60, 0x225f, 0xa401
-    dw 0x064e, 0xe713, 0x9992, 0x7c00
-    dw 0x064f, 0x21b5, 0x1480, 0x4913
-    dw 0x0650, 0x4c7b, 0x574b, 0x30ea
-    dw 0x0651, 0x95ce, 0xefc4, 0x0003
-    dw 0x0652, 0xbb97, 0x869d, 0x7097
-    dw 0x0653, 0xfa61, 0xaaeb, 0x7c00
-    dw 0x0654, 0xa24d, 0x17a4, 0xc699
-    dw 0x0655, 0xf658, 0x35c6, 0xfc00
-    dw 0x0656, 0xf27d, 0xa863, 0x7c00
-    dw 0x0657, 0x0e38, 0xb561, 0x94a0
-    dw 0x0658, 0xe216, 0xc023, 0x5de3
-    dw 0x0659, 0x9d66, 0x6f70, 0x800c
-    dw 0x065a, 0x8049, 0x3cf0, 0x803b
-    dw 0x065b, 0xd1dc, 0xe586, 0x283e
-    dw 0x065c, 0xca17, 0x5c3c, 0xa9c1
-    dw 0x065d, 0x07e5, 0xb12a, 0x921d
-    dw 0x065e, 0xf5cf, 0x299a, 0xfc00
-    dw 0x065f, 0xc5ab, 0x424a, 0xbf36
-    dw 0x0660, 0x80e6, 0x5b79, 0x8001
-    dw 0x0661, 0x320f, 0x3c7d, 0x3166
-    dw 0x0662, 0xe216, 0x2c70, 0xf17c
-    dw 0x0663, 0xe768, 0x8463, 0x7c00
-    dw 0x0664, 0x4414, 0xddc0, 0xa1ad
-    dw 0x0665, 0xba2a, 0x3691, 0xbf83
-    dw 0x0666, 0x8624, 0xc862, 0x00b3
-    dw 0x0667, 0xebf3, 0x683a, 0xbf86
-    dw 0x0668, 0x8885, 0x8959, 0x3ac3
-    dw 0x0669, 0xd7aa, 0x08ce, 0xfc00
-    dw 0x066a, 0xc649, 0xa986, 0x588d
-    dw 0x066b, 0xee54, 0x9060, 0x7c00
-    dw 0x066c, 0x05c3, 0xf639, 0x8000
-    dw 0x066d, 0x418b, 0xfb92, 0x82ee
-    dw 0x066e, 0x1fd4, 0x0736, 0x5458
-    dw 0x066f, 0x3ddc, 0xa0ba, 0xd8f5
-    dw 0x0670, 0x62af, 0x6feb, 0x2ec1
-    dw 0x0671, 0xdd37, 0x44c5, 0xd460
-    dw 0x0672, 0x9c5b, 0xc49f, 0x138a
-    dw 0x0673, 0xc929, 0xe06f, 0x24a8
-    dw 0x0674, 0xa260, 0x8353, 0x5bac
-    dw 0x0675, 0x1701, 0x2884, 0x2a34
-    dw 0x0676, 0x4bb5, 0x02f4, 0x7c00
-    dw 0x0677, 0x90be, 0xd43a, 0x0090
-    dw 0x0678, 0x8c4d, 0x6868, 0x8002
-    dw 0x0679, 0xdd08, 0x5296, 0xc61d
-    dw 0x067a, 0x11ef, 0xcb5c, 0x833a
-    dw 0x067b, 0xe2f7, 0x17b2, 0xfc00
-    dw 0x067c, 0xc195, 0x2482, 0xd8f4
-    dw 0x067d, 0x1344, 0xe169, 0x8015
-    dw 0x067e, 0x2bb8, 0x5120, 0x1606
-    dw 0x067f, 0x8223, 0x8e67, 0x2d57
-    dw 0x0680, 0xc10c, 0x5f5a, 0x9d7e
-    dw 0x0681, 0xd32c, 0x5d67, 0xb14f
-    dw 0x0682, 0x23fa, 0x9c55, 0xc35d
-    dw 0x0683, 0x3dd7, 0xc65a, 0xb35b
-    dw 0x0684, 0x1fa8, 0x54d8, 0x0653
-    dw 0x0685, 0xeede, 0x6b5d, 0xbf76
-    dw 0x0686, 0x57cc, 0x3f97, 0x541c
-    dw 0x0687, 0xe419, 0xe804, 0x3815
-    dw 0x0688, 0x1c9f, 0x36af, 0x2188
-    dw 0x0689, 0xf9f3, 0xe7fb, 0x4df7
-    dw 0x068a, 0x19a6, 0x11a5, 0x4401
-    dw 0x068b, 0xa991, 0x3e28, 0xa73c
-    dw 0x068c, 0x24e9, 0x8afa, 0xd5a1
-    dw 0x068d, 0x69e0, 0x760a, 0x2fc8
-    dw 0x068e, 0x0d1e, 0xf847, 0x8000
-    dw 0x068f, 0x3716, 0x6c78, 0x0658
-    dw 0x0690, 0xcb74, 0x947d, 0x72a4
-    dw 0x0691, 0x9072, 0x67c9, 0x8005
-    dw 0x0692, 0xd254, 0x56cc, 0xb773
-    dw 0x0693, 0x8772, 0x272c, 0x9c27
-    dw 0x0694, 0x45aa, 0xf2cf, 0x8ea8
-    dw 0x0695, 0xc546, 0x3267, 0xce97
-    dw 0x0696, 0x6311, 0xad4b, 0xf157
-    dw 0x0697, 0x4f06, 0x99c1, 0xf0e2
-    dw 0x0698, 0xa73e, 0x3702, 0xac22
-    dw 0x0699, 0xb367, 0xb8e4, 0x360e
-    dw 0x069a, 0xe093, 0xf190, 0x2a94
-    dw 0x069b, 0xddcd, 0x6b8d, 0xae25
-    dw 0x069c, 0x5b70, 0x53d7, 0x4397
-    dw 0x069d, 0x78ab, 0x53b8, 0x60d7
-    dw 0x069e, 0x8aed, 0xe524, 0x0003
-    dw 0x069f, 0x1f2c, 0x1f6b, 0x3bbc
-    dw 0x06a0, 0x7596, 0x86f5, 0xfc00
-    dw 0x06a1, 0xf1bf, 0xcc63, 0x613d
-    dw 0x06a2, 0x0e67, 0x18ec, 0x3134
-    dw 0x06a3, 0x120d, 0x0137, 0x50fb
-    dw 0x06a4, 0x97e4, 0xd754, 0x0114
-    dw 0x06a5, 0x339e, 0xfaf6, 0x8046
-    dw 0x06a6, 0x849f, 0x82a4, 0x3f00
-    dw 0x06a7, 0x94b7, 0x2bdd, 0xa4cc
-    dw 0x06a8, 0xb9a6, 0x481e, 0xad7d
-    dw 0x06a9, 0xe4c1, 0x9a39, 0x7c00
-    dw 0x06aa, 0x39ae, 0xc28f, 0xb2ee
-    dw 0x06ab, 0x05c7, 0x951f, 0xac83
-    dw 0x06ac, 0x1666, 0xe8d7, 0x800b
-    dw 0x06ad, 0xa154, 0x6396, 0x80b4
-    dw 0x06ae, 0x0803, 0xc0bf, 0x8362
-    dw 0x06af, 0xd92d, 0x8ef8, 0x7c00
-    dw 0x06b0, 0xb27e, 0xa590, 0x48ab
-    dw 0x06b1, 0x9d60, 0xcb6a, 0x0dcd
-    dw 0x06b2, 0xb79d, 0x9e97, 0x549f
-    dw 0x06b3, 0x634f, 0x8ef1, 0xfc00
-    dw 0x06b4, 0xd235, 0x5e45, 0xafec
-    dw 0x06b5, 0x1390, 0x54d9, 0x00c8
-    dw 0x06b6, 0xf2fc, 0x3f6e, 0xef85
-    dw 0x06b7, 0x0e80, 0x3b1a, 0x0f53
-    dw 0x06b8, 0x242f, 0xa8b9, 0xb716
-    dw 0x06b9, 0x74c9, 0xe6be, 0xc9ae
-    dw 0x06ba, 0xae80, 0x09e8, 0xe067
-    dw 0x06bb, 0x2cf3, 0xf2bf, 0x805e
-    dw 0x06bc, 0x9e79, 0x9089, 0x49b5
-    dw 0x06bd, 0xfac2, 0x5f38, 0xd77d
-    dw 0x06be, 0x69b6, 0x89ba, 0xfc00
-    dw 0x06bf, 0x11b6, 0x0f46, 0x3e48
-    dw 0x06c0, 0x271a, 0xdd21, 0x858a
-    dw 0x06c1, 0xc6e4, 0xc5b1, 0x3cd8
-    dw 0x06c2, 0x4070, 0x55d5, 0x2616
-    dw 0x06c3, 0x97e6, 0x9eb5, 0x34b6
-    dw 0x06c4, 0x6966, 0xecc0, 0xb88c
-    dw 0x06c5, 0x91b1, 0xa8d4, 0x24b7
-    dw 0x06c6, 0xfb40, 0xcccb, 0x6a0d
-    dw 0x06c7, 0xcd03, 0xa3f9, 0x6507
-    dw 0x06c8, 0x4194, 0xb3c2, 0xc9c1
-    dw 0x06c9, 0x527a, 0x4b7c, 0x42ec
-    dw 0x06ca, 0xb0e7, 0x3e3b, 0xae4b
-    dw 0x06cb, 0x4f60, 0x0ff6, 0x7b69
-    dw 0x06cc, 0x38fd, 0xae98, 0xc60d
-    dw 0x06cd, 0x79ad, 0xc2b8, 0xf2c2
-    dw 0x06ce, 0xc04e, 0x88f3, 0x72f5
-    dw 0x06cf, 0xe9d2, 0x9d6f, 0x7c00
-    dw 0x06d0, 0x4fd7, 0xaf84, 0xdc2c
-    dw 0x06d1, 0xdddf, 0xa5ad, 0x7423
-    dw 0x06d2, 0x476a, 0x0f13, 0x7431
-    dw 0x06d3, 0x342a, 0x0e45, 0x6150
-    dw 0x06d4, 0xb7e7, 0x2f6a, 0xc443
-    dw 0x06d5, 0xdb11, 0x84ea, 0x7c00
-    dw 0x06d6, 0xd364, 0x1ca5, 0xf25d
-    dw 0x06d7, 0x38ac, 0x25de, 0x4e5f
-    dw 0x06d8, 0x6822, 0xe993, 0xb9ee
-    dw 0x06d9, 0xa54b, 0xa65d, 0x3aa8
-    dw 0x06da, 0x38f3, 0xb541, 0xbf89
-    dw 0x06db, 0xdf5b, 0xe78b, 0x33cd
-    dw 0x06dc, 0x2eee, 0xa213, 0xc890
-    dw 0x06dd, 0xa7da, 0xb7e2, 0x2bf8
-    dw 0x06de, 0x8be5, 0x4549, 0x82fd
-    dw 0x06df, 0x07b9, 0x3b69, 0x082b
-    dw 0x06e0, 0x2329, 0xad66, 0xb14e
-    dw 0x06e1, 0x82d4, 0x9fbd, 0x1dd9
-    dw 0x06e2, 0xbc79, 0xb6fe, 0x411e
-    dw 0x06e3, 0xae03, 0x7460, 0x8058
-    dw 0x06e4, 0xe669, 0x8914, 0x7c00
-    dw 0x06e5, 0xf94b, 0xb9cd, 0x7b4d
-    dw 0x06e6, 0xa5b9, 0x31f7, 0xafad
-    dw 0x06e7, 0xdfab, 0x0ddb, 0xfc00
-    dw 0x06e8, 0x1b8b, 0x84f6, 0xd215
-    dw 0x06e9, 0xb439, 0x547e, 0x9b85
-    dw 0x06ea, 0x3a37, 0x9394, 0xe290
-    dw 0x06eb, 0x3c0a, 0x6926, 0x0e47
-    dw 0x06ec, 0x35a7, 0xe3e4, 0x8dbb
-    dw 0x06ed, 0x2108, 0xc18c, 0x9b42
-    dw 0x06ee, 0x292d, 0x28c1, 0x3c5b
-    dw 0x06ef, 0x4c56, 0xd628, 0xb1a2
-    dw 0x06f0, 0xec14, 0x92a1, 0x7c00
-    dw 0x06f1, 0x36c8, 0x9a17, 0xd874
-    dw 0x06f2, 0x0702, 0x1d31, 0x2566
-    dw 0x06f3, 0x232b, 0x004d, 0x69f5
-    dw 0x06f4, 0xd6fe, 0xc8e4, 0x49b8
-    dw 0x06f5, 0x3244, 0xb6a9, 0xb787
-    dw 0x06f6, 0xd6c0, 0x4dcf, 0xc4a6
-    dw 0x06f7, 0x3b9f, 0x8af9, 0xec5f
-    dw 0x06f8, 0xa24e, 0x75d7, 0x8009
-    dw 0x06f9, 0x1e8d, 0xde58, 0x8108
-    dw 0x06fa, 0xdefd, 0x5434, 0xc6a7
-    dw 0x06fb, 0xc23c, 0x0005, 0xfc00
-    dw 0x06fc, 0x15c0, 0xeb69, 0x8006
-    dw 0x06fd, 0x28c6, 0x12b6, 0x51b1
-    dw 0x06fe, 0x37c0, 0x9280, 0xe0c5
-    dw 0x06ff, 0x23d4, 0x9190, 0xcda1
-    dw 0x0700, 0xc949, 0xbdeb, 0x4725
-    dw 0x0701, 0x9892, 0xe67a, 0x0017
-    dw 0x0702, 0xe116, 0x98df, 0x7c00
-    dw 0x0703, 0xbd79, 0xa9fa, 0x4f53
-    dw 0x0704, 0xcb23, 0x7422, 0x92e8
-    dw 0x0705, 0x80ba, 0x18f3, 0x9cb3
-    dw 0x0706, 0xafc2, 0x0bb3, 0xe008
-    dw 0x0707, 0xbb41, 0x2599, 0xd12f
-    dw 0x0708, 0x2a40, 0x9999, 0xcc77
-    dw 0x0709, 0x0496, 0x5bd5, 0x0005
-    dw 0x070a, 0x049b, 0x9435, 0xac61
-    dw 0x070b, 0x473e, 0x2d61, 0x5563
-    dw 0x070c, 0xa6eb, 0x2c50, 0xb66b
-    dw 0x070d, 0x396c, 0xa2d2, 0xd25c
-    dw 0x070e, 0xbde0, 0x02b5, 0xf857
-    dw 0x070f, 0x60bd, 0x5672, 0x45e2
-    dw 0x0710, 0xe92f, 0x41d3, 0xe31f
-    dw 0x0711, 0xef51, 0xa6a8, 0x7c00
-    dw 0x0712, 0xebce, 0xba74, 0x6cd6
-    dw 0x0713, 0x1acb, 0x6c88, 0x000c
-    dw 0x0714, 0xd367, 0xca8d, 0x4485
-    dw 0x0715, 0x783c, 0x8ea8, 0xfc00
-    dw 0x0716, 0xf026, 0xa27c, 0x7c00
-    dw 0x0717, 0x2841, 0xf4bc, 0x801d
-    dw 0x0718, 0x20f1, 0x8416, 0xd8d6
-    dw 0x0719, 0xf957, 0xb526, 0x7c00
-    dw 0x071a, 0xcb55, 0x26b8, 0xe05d
-    dw 0x071b, 0x5c11, 0x4a53, 0x4d25
-    dw 0x071c, 0x5308, 0x957d, 0xf920
-    dw 0x071d, 0xed26, 0x10e8, 0xfc00
-    dw 0x071e, 0x9832, 0x4de3, 0x85b4
-    dw 0x071f, 0x675a, 0x8162, 0xfc00
-    dw 0x0720, 0x8fb7, 0x56ab, 0x804a
-    dw 0x0721, 0x280a, 0x7b85, 0x0009
-    dw 0x0722, 0x1120, 0x42d5, 0x0a00
-    dw 0x0723, 0xe80d, 0xe487, 0x3f28
-    dw 0x0724, 0x0d62, 0x6049, 0x000a
-    dw 0x0725, 0x7330, 0x02c6, 0x7c00
-    dw 0x0726, 0x9b71, 0xf244, 0x0005
-    dw 0x0727, 0x23b7, 0x1f88, 0x4019
-    dw 0x0728, 0xeb9b, 0xd8dd, 0x4e41
-    dw 0x0729, 0xeadd, 0x1254, 0xfc00
-    dw 0x072a, 0x34ee, 0x3530, 0x3b9a
-    dw 0x072b, 0x655c, 0xca6c, 0xd6ad
-    dw 0x072c, 0x2256, 0x7645, 0x0008
-    dw 0x072d, 0x629e, 0x703a, 0x2e43
-    dw 0x072e, 0xdd9f, 0xe400, 0x359f
-    dw 0x072f, 0x344b, 0x0c0b, 0x643f
-    dw 0x0730, 0x7b76, 0x456b, 0x7182
-    dw 0x0731, 0x4ee0, 0x6383, 0x2752
-    dw 0x0732, 0x29f2, 0x5c43, 0x0995
-    dw 0x0733, 0xc3cd, 0x9d22, 0x6214
-    dw 0x0734, 0x59cb, 0xc693, 0xcf0d
-    dw 0x0735, 0x3894, 0x4c10, 0x2882
-    dw 0x0736, 0xea4a, 0x581c, 0xce1f
-    dw 0x0737, 0x37ab, 0xc327, 0xb04a
-    dw 0x0738, 0x42f9, 0x49ff, 0x34a7
-    dw 0x0739, 0xf815, 0x7829, 0xbbda
-    dw 0x073a, 0xaf5c, 0xc281, 0x2887
-    dw 0x073b, 0x9a80, 0x25a1, 0xb09e
-    dw 0x073c, 0x2520, 0x0aba, 0x5618
-    dw 0x073d, 0x0340, 0x0920, 0x3513
-    dw 0x073e, 0x0aab, 0x378b, 0x0f12
-    dw 0x073f, 0x152b, 0x8621, 0xcabf
-    dw 0x0740, 0x640c, 0xe9a4, 0xb5bd
-    dw 0x0741, 0xa6e9, 0xc04f, 0x226a
-    dw 0x0742, 0xad71, 0x440b, 0xa562
-    dw 0x0743, 0x1a1a, 0x7404, 0x0003
-    dw 0x0744, 0x662a, 0x5e4e, 0x43d2
-    dw 0x0745, 0xd4bb, 0x9dd6, 0x727c
-    dw 0x0746, 0x2175, 0x17b4, 0x45ab
-    dw 0x0747, 0xe7d5, 0x198b, 0xfc00
-    dw 0x0748, 0x8fde, 0x9731, 0x3460
-    dw 0x0749, 0xdc0c, 0x2a5e, 0xed16
-    dw 0x074a, 0xbcd2, 0x012c, 0xfc00
-    dw 0x074b, 0x3518, 0xc013, 0xb100
-    dw 0x074c, 0x0a4d, 0x3fc3, 0x067f
-    dw 0x074d, 0xf79e, 0x1f78, 0xfc00
-    dw 0x074e, 0xc5e4, 0x7495, 0x8d24
-    dw 0x074f, 0x8384, 0xaf88, 0x0f78
-    dw 0x0750, 0x1b7e, 0x43d3, 0x13a9
-    dw 0x0751, 0x5cfa, 0x5f89, 0x3949
-    dw 0x0752, 0x5dee, 0xd0fe, 0xc8c0
-    dw 0x0753, 0xdc29, 0xc418, 0x5411
-    dw 0x0754, 0x2f4d, 0xb0e4, 0xb9f9
-    dw 0x0755, 0x61ee, 0x50c2, 0x4cfc
-    dw 0x0756, 0xc899, 0x49c4, 0xba61
-    dw 0x0757, 0x6a4d, 0x5877, 0x4da5
-    dw 0x0758, 0xe0f5, 0x465a, 0xd63e
-    dw 0x0759, 0x82d5, 0x9dc8, 0x1fd6
-    dw 0x075a, 0x4786, 0xb7ed, 0xcb98
-    dw 0x075b, 0x5ddb, 0x51d3, 0x4805
-    dw 0x075c, 0xf7b0, 0x5579, 0xdd9e
-    dw 0x075d, 0x714c, 0xbd94, 0xef99
-    dw 0x075e, 0xca0e, 0xf4d0, 0x1108
-    dw 0x075f, 0x6d1c, 0xe58c, 0xc35e
-    dw 0x0760, 0x38a4, 0xca16, 0xaa1a
-    dw 0x0761, 0x4516, 0x9692, 0xea31
-    dw 0x0762, 0x9b15, 0x213f, 0xb566
-    dw 0x0763, 0x5aaa, 0xca62, 0xcc2d
-    dw 0x0764, 0xd223, 0xbc99, 0x5157
-    dw 0x0765, 0x1b24, 0x9abc, 0xbc3e
-    dw 0x0766, 0x065d, 0x8572, 0xbcad
-    dw 0x0767, 0xf333, 0xe752, 0x47de
-    dw 0x0768, 0xcbcc, 0x7608, 0x912c
-    dw 0x0769, 0x851a, 0x1352, 0xad93
-    dw 0x076a, 0x2df5, 0xe2f5, 0x86da
-    dw 0x076b, 0x6526, 0x25a5, 0x7b4c
-    dw 0x076c, 0x386f, 0xd672, 0x9d81
-    dw 0x076d, 0xe339, 0x027d, 0xfc00
-    dw 0x076e, 0xcb42, 0x5056, 0xb6b2
-    dw 0x076f, 0xe80a, 0x03e6, 0xfc00
-    dw 0x0770, 0x1a6c, 0x2d20, 0x2903
-    dw 0x0771, 0x9a78, 0xb581, 0x20b4
-    dw 0x0772, 0x4e5f, 0xf523, 0x94f6
-    dw 0x0773, 0x2082, 0xb1bc, 0xaa4a
-    dw 0x0774, 0x9b08, 0xbb3f, 0x1bc3
-    dw 0x0775, 0xb819, 0x207a, 0xd353
-    dw 0x0776, 0xae72, 0x9f6b, 0x4af3
-    dw 0x0777, 0xec46, 0x247b, 0xfc00
-    dw 0x0778, 0x2486, 0x5270, 0x0d9f
-    dw 0x0779, 0x077b, 0x64be, 0x0002
-    dw 0x077a, 0x7816, 0x3fea, 0x7421
-    dw 0x077b, 0x3b30, 0x5b4f, 0x1bde
-    dw 0x077c, 0x4268, 0x0673, 0x77f2
-    dw 0x077d, 0xaba5, 0x2a72, 0xbcbf
-    dw 0x077e, 0x0a59, 0xc612, 0x8217
-    dw 0x077f, 0x5792, 0xa4d2, 0xee48
-    dw 0x0780, 0x7b93, 0xa5f1, 0xfc00
-    dw 0x0781, 0x99f5, 0xfb77, 0x0001
-    dw 0x0782, 0xc673, 0x4bb1, 0xb6b5
-    dw 0x0783, 0x967f, 0x81b2, 0x53aa
-    dw 0x0784, 0x03ca, 0xb6f9, 0x8859
-    dw 0x0785, 0x3025, 0xa335, 0xc89a
-    dw 0x0786, 0xa33f, 0x54a0, 0x8a44
-    dw 0x0787, 0xc7bb, 0xa2d7, 0x6085
-    dw 0x0788, 0xa710, 0xcf37, 0x13d5
-    dw 0x0789, 0x0796, 0x1f26, 0x243f
-    dw 0x078a, 0x0f21, 0x42c6, 0x0836
-    dw 0x078b, 0x7a76, 0x5189, 0x64ab
-    dw 0x078c, 0x4939, 0x261b, 0x5ed8
-    dw 0x078d, 0x7bfb, 0x5393, 0x6437
-    dw 0x078e, 0xec2d, 0xd38d, 0x546d
-    dw 0x078f, 0xf865, 0x67c1, 0xcc89
-    dw 0x0790, 0x797e, 0x925a, 0xfc00
-    dw 0x0791, 0x6338, 0x3ff2, 0x5f45
-    dw 0x0792, 0xde0b, 0xf9b7, 0x203b
-    dw 0x0793, 0xc1a4, 0xe1d5, 0x1bbd
-    dw 0x0794, 0xb0b0, 0xf1c9, 0x00cf
-    dw 0x0795, 0x850a, 0x53ef, 0x8014
-    dw 0x0796, 0x4669, 0x4cc6, 0x355f
-    dw 0x0797, 0xf6c6, 0xed7a, 0x44f2
-    dw 0x0798, 0x1bfd, 0x0ca0, 0x4ae9
-    dw 0x0799, 0x2b1e, 0x4123, 0x258b
-    dw 0x079a, 0x8716, 0x8a5c, 0x3875
-    dw 0x079b, 0xad32, 0xf8a3, 0x0024
-    dw 0x079c, 0xddef, 0x995f, 0x7c00
-    dw 0x079d, 0xcc31, 0xd654, 0x314c
-    dw 0x079e, 0x0120, 0x45af, 0x0033
-    dw 0x079f, 0x68ae, 0x6458, 0x404f
-    dw 0x07a0, 0x85a1, 0x46b9, 0x80d6
-    dw 0x07a1, 0x5e0f, 0x4746, 0x52aa
-    dw 0x07a2, 0x288e, 0x0ebf, 0x5567
-    dw 0x07a3, 0x390f, 0xad99, 0xc73b
-    dw 0x07a4, 0x62ae, 0xfa5f, 0xa432
-    dw 0x07a5, 0x5975, 0x6cf3, 0x2869
-    dw 0x07a6, 0x165c, 0x57d1, 0x00d0
-    dw 0x07a7, 0x7993, 0x417a, 0x7412
-    dw 0x07a8, 0x98f4, 0x00aa, 0xdb75
-    dw 0x07a9, 0xbe22, 0x2351, 0xd6b5
-    dw 0x07aa, 0xaddc, 0xb6c6, 0x32ec
-    dw 0x07ab, 0x0140, 0x473b, 0x002c
-    dw 0x07ac, 0x82f7, 0xd795, 0x0006
-    dw 0x07ad, 0x485c, 0xc8a6, 0xbb81
-    dw 0x07ae, 0x4043, 0xacb4, 0xcf40
-    dw 0x07af, 0x4e48, 0x86fd, 0xfc00
-    dw 0x07b0, 0x0ac4, 0x958e, 0xb0df
-    dw 0x07b1, 0xaf8b, 0x1983, 0xd179
-    dw 0x07b2, 0xce9d, 0x5d24, 0xad25
-    dw 0x07b3, 0x4e16, 0x5783, 0x327b
-    dw 0x07b4, 0xd5a7, 0xbb09, 0x566d
-    dw 0x07b5, 0x6ddf, 0x2d78, 0x7c00
-    dw 0x07b6, 0x349d, 0xaf5a, 0xc105
-    dw 0x07b7, 0xc66d, 0x3547, 0xccdf
-    dw 0x07b8, 0x6d7c, 0xe9be, 0xbfa4
-    dw 0x07b9, 0xe323, 0x2442, 0xfab4
-    dw 0x07ba, 0xeafe, 0x2a5e, 0xfc00
-    dw 0x07bb, 0xa739, 0xc293, 0x2065
-    dw 0x07bc, 0x72ba, 0x6fe0, 0x3ed5
-    dw 0x07bd, 0x02d7, 0x1f6f, 0x1e1d
-    dw 0x07be, 0xbe28, 0x89d4, 0x703a
-    dw 0x07bf, 0x2a33, 0x53b6, 0x126e
-    dw 0x07c0, 0x395f, 0x43b6, 0x3193
-    dw 0x07c1, 0x2253, 0x9684, 0xc7c4
-    dw 0x07c2, 0xbfe8, 0x706a, 0x8b2a
-    dw 0x07c3, 0xee07, 0x958f, 0x7c00
-    dw 0x07c4, 0x2b73, 0x5be7, 0x0b8b
-    dw 0x07c5, 0xc308, 0x6010, 0x9eec
-    dw 0x07c6, 0x0b41, 0x8975, 0xbd51
-    dw 0x07c7, 0x9557, 0x78bd, 0x8001
-    dw 0x07c8, 0x7333, 0x787a, 0x366f
-    dw 0x07c9, 0x9d00, 0x5e31, 0x80cf
-    dw 0x07ca, 0xa2d9, 0x4439, 0x9a7d
-    dw 0x07cb, 0x20c5, 0x1593, 0x46d8
-    dw 0x07cc, 0xb419, 0x239c, 0xcc4f
-    dw 0x07cd, 0x3502, 0x7241, 0x019a
-    dw 0x07ce, 0xad70, 0x5f35, 0x8a09
-    dw 0x07cf, 0xc5f7, 0xe6cf, 0x1b02
+    ; Uniform random values
+    dw 0x02a4, 0xd41a, 0xa56f, 0x6a0a
+    dw 0x02a5, 0x283b, 0x42cd, 0x20fa
+    dw 0x02a6, 0xbe40, 0x9969, 0x609f
+    dw 0x02a7, 0xb859, 0x30a6, 0xc37b
+    dw 0x02a8, 0xfbbe, 0x6a44, 0xccf1
+    dw 0x02a9, 0x526b, 0x9a86, 0xf3df
+    dw 0x02aa, 0x3fa2, 0x54fa, 0x2623
+    dw 0x02ab, 0xc80f, 0xe42a, 0x1fcc
+    dw 0x02ac, 0xbd74, 0x3732, 0xc210
+    dw 0x02ad, 0xf64f, 0x5761, 0xdad7
+    dw 0x02ae, 0x01a2, 0x8969, 0xb0d4
+    dw 0x02af, 0xd30b, 0x94ba, 0x79f6
+    dw 0x02b0, 0xe8fc, 0x2c2b, 0xf8c9
+    dw 0x02b1, 0x410f, 0xd8c8, 0xa43b
+    dw 0x02b2, 0x718e, 0x4d0a, 0x6069
+    dw 0x02b3, 0x1126, 0x53d5, 0x00a8
+    dw 0x02b4, 0x65bb, 0xf0fa, 0xb09b
+    dw 0x02b5, 0x4923, 0x0515, 0x7c00
+    dw 0x02b6, 0x97e0, 0x3d48, 0x95f7
+    dw 0x02b7, 0xaac5, 0xb3c4, 0x32f9
+    dw 0x02b8, 0x88cb, 0xa92c, 0x1b6a
+    dw 0x02b9, 0xca2b, 0xa974, 0x5c86
+    dw 0x02ba, 0xc7f3, 0x81cd, 0x7c00
+    dw 0x02bb, 0x3614, 0x11e4, 0x6021
+    dw 0x02bc, 0x62b1, 0x5ef3, 0x3fb4
+    dw 0x02bd, 0x4057, 0xddc5, 0x9e05
+    dw 0x02be, 0xe355, 0x005f, 0xfc00
+    dw 0x02bf, 0xb0c6, 0x6de4, 0x819f
+    dw 0x02c0, 0x395f, 0xcb36, 0xa9f5
+    dw 0x02c1, 0x799a, 0x3c23, 0x796b
+    dw 0x02c2, 0xdc13, 0x6c3d, 0xabb1
+    dw 0x02c3, 0x5002, 0xd5b4, 0xb59f
+    dw 0x02c4, 0x9ea7, 0x9cc9, 0x3d90
+    dw 0x02c5, 0x1ca5, 0xa543, 0xb310
+    dw 0x02c6, 0xf8ee, 0x6c35, 0xc8b0
+    dw 0x02c7, 0x1a6c, 0xf194, 0x8005
+    dw 0x02c8, 0x186f, 0xdf38, 0x804f
+    dw 0x02c9, 0x6ba5, 0x164e, 0x7c00
+    dw 0x02ca, 0x97a2, 0xd710, 0x0115
+    dw 0x02cb, 0x622d, 0x98fd, 0xfc00
+    dw 0x02cc, 0x7316, 0x93d7, 0xfc00
+    dw 0x02cd, 0xf63e, 0xd489, 0x5d81
+    dw 0x02ce, 0x3183, 0x5dc2, 0x0fa8
+    dw 0x02cf, 0x005c, 0xd946, 0x8001
+    dw 0x02d0, 0xf456, 0xd275, 0x5d5f
+    dw 0x02d1, 0xb217, 0x842b, 0x69d8
+    dw 0x02d2, 0xf415, 0x4810, 0xe805
+    dw 0x02d3, 0x2da6, 0x9e73, 0xcb02
+    dw 0x02d4, 0x8661, 0x27d0, 0x9a88
+    dw 0x02d5, 0x7a54, 0xd5c5, 0xe063
+    dw 0x02d6, 0xf29d, 0x2c35, 0xfc00
+    dw 0x02d7, 0xb3df, 0xc653, 0x28fa
+    dw 0x02d8, 0xe353, 0xc0cc, 0x5e1c
+    dw 0x02d9, 0x4fa5, 0x0867, 0x7c00
+    dw 0x02da, 0x5faa, 0x61de, 0x393a
+    dw 0x02db, 0xcc50, 0xd915, 0x2eca
+    dw 0x02dc, 0x1073, 0xcb61, 0x8269
+    dw 0x02dd, 0x7673, 0x1b29, 0x7c00
+    dw 0x02de, 0x8349, 0x3dbd, 0x824a
+    dw 0x02df, 0xf38e, 0x25ca, 0xfc00
+    dw 0x02e0, 0xe1cc, 0x253f, 0xf86c
+    dw 0x02e1, 0x9d1e, 0x47c2, 0x9147
+    dw 0x02e2, 0x3219, 0x506e, 0x1d82
+    dw 0x02e3, 0x5a23, 0xee0c, 0xa80f
+    dw 0x02e4, 0x4224, 0x29bf, 0x5446
+    dw 0x02e5, 0x2a05, 0x6566, 0x023b
+    dw 0x02e6, 0x9ef5, 0x1309, 0xc7e9
+    dw 0x02e7, 0xb4c9, 0x3f48, 0xb142
+    dw 0x02e8, 0x3414, 0xecfd, 0x8345
+    dw 0x02e9, 0xc668, 0x87d4, 0x7a8c
+    dw 0x02ea, 0xbd8d, 0x6047, 0x9931
+    dw 0x02eb, 0x009b, 0xd158, 0x8004
+    dw 0x02ec, 0xc02e, 0x628e, 0x991a
+    dw 0x02ed, 0x641b, 0xa518, 0xfa73
+    dw 0x02ee, 0x15a3, 0xf094, 0x8002
+    dw 0x02ef, 0xeadd, 0x39f7, 0xec9a
+    dw 0x02f0, 0xf58e, 0xf935, 0x3844
+    dw 0x02f1, 0x58cf, 0x8bcd, 0xfc00
+    dw 0x02f2, 0xe6ef, 0x4cc3, 0xd5d3
+    dw 0x02f3, 0xe0d9, 0x226c, 0xfa0a
+    dw 0x02f4, 0x2c7b, 0x16da, 0x513b
+    dw 0x02f5, 0x1d48, 0x42ef, 0x1618
+    dw 0x02f6, 0x4c19, 0xa65f, 0xe125
+    dw 0x02f7, 0x8736, 0x4bab, 0x8078
+    dw 0x02f8, 0x6e90, 0x0d1c, 0x7c00
+    dw 0x02f9, 0x4c63, 0x8073, 0xfc00
+    dw 0x02fa, 0x81af, 0xc8e0, 0x002c
+    dw 0x02fb, 0xc5bf, 0x611c, 0xa080
+    dw 0x02fc, 0xc42d, 0x9d89, 0x6209
+    dw 0x02fd, 0x0614, 0xa1e9, 0xa01d
+    dw 0x02fe, 0x7acb, 0x2f7c, 0x7c00
+    dw 0x02ff, 0x99b5, 0x858f, 0x501b
+    dw 0x0300, 0x559d, 0x768c, 0x1adc
+    dw 0x0301, 0xd1d0, 0xc3ba, 0x4a05
+    dw 0x0302, 0x75f4, 0xd02d, 0xe1b4
+    dw 0x0303, 0x9530, 0xbbcd, 0x1552
+    dw 0x0304, 0x253a, 0xf48c, 0x8012
+    dw 0x0305, 0x2d17, 0xc1ad, 0xa72d
+    dw 0x0306, 0xc408, 0x85c8, 0x7994
+    dw 0x0307, 0x4918, 0x2b2a, 0x59b0
+    dw 0x0308, 0x5868, 0x2391, 0x70a9
+    dw 0x0309, 0x4b66, 0x684f, 0x1ede
+    dw 0x030a, 0x6320, 0x0dd1, 0x7c00
+    dw 0x030b, 0xb893, 0x82d4, 0x7278
+    dw 0x030c, 0xf2c2, 0xba6b, 0x7436
+    dw 0x030d, 0xb557, 0x6bc8, 0x857d
+    dw 0x030e, 0x0dde, 0x0132, 0x4ce9
+    dw 0x030f, 0x321d, 0x61e2, 0x0c28
+    dw 0x0310, 0x97ad, 0xb8c9, 0x1a6b
+    dw 0x0311, 0xd4e4, 0x9096, 0x7c00
+    dw 0x0312, 0xc58d, 0x0b52, 0xf611
+    dw 0x0313, 0xdde9, 0xa610, 0x73cd
+    dw 0x0314, 0xcc40, 0xc9ff, 0x3dac
+    dw 0x0315, 0xa406, 0x6f20, 0x8024
+    dw 0x0316, 0xb777, 0x3adc, 0xb85a
+    dw 0x0317, 0xdfa4, 0xe113, 0x3a06
+    dw 0x0318, 0x5103, 0x9fa2, 0xed41
+    dw 0x0319, 0xe74d, 0x3798, 0xebb1
+    dw 0x031a, 0x9301, 0x6bf8, 0x8004
+    dw 0x031b, 0x11e4, 0xede2, 0x8002
+    dw 0x031c, 0xf835, 0xba26, 0x7979
+    dw 0x031d, 0x287f, 0x1749, 0x4cf0
+    dw 0x031e, 0xb1e8, 0x8544, 0x687d
+    dw 0x031f, 0x5d49, 0x9608, 0xfc00
+    dw 0x0320, 0xb253, 0xc580, 0x2899
+    dw 0x0321, 0x5eef, 0x1775, 0x7c00
+    dw 0x0322, 0xf12f, 0xeb00, 0x41ed
+    dw 0x0323, 0xdb08, 0x9f18, 0x77ee
+    dw 0x0324, 0x1e90, 0x5770, 0x0388
+    dw 0x0325, 0x2cd1, 0x2bce, 0x3cf0
+    dw 0x0326, 0xba4c, 0xa9f2, 0x4c3d
+    dw 0x0327, 0x4d3f, 0x011c, 0x7c00
+    dw 0x0328, 0x0aad, 0x9e7d, 0xa81e
+    dw 0x0329, 0xa83b, 0xf3c7, 0x0023
+    dw 0x032a, 0x18b6, 0xf4b4, 0x8002
+    dw 0x032b, 0xc66f, 0x5a3c, 0xa821
+    dw 0x032c, 0x6e65, 0x87d9, 0xfc00
+    dw 0x032d, 0x26c1, 0x7609, 0x0012
+    dw 0x032e, 0x5489, 0x823f, 0xfc00
+    dw 0x032f, 0xce16, 0x5562, 0xb486
+    dw 0x0330, 0x7a14, 0xfb06, 0xbaec
+    dw 0x0331, 0xf99e, 0x328f, 0xfc00
+    dw 0x0332, 0x11c4, 0x6866, 0x0005
+    dw 0x0333, 0x9633, 0x5b25, 0x806f
+    dw 0x0334, 0x9d7f, 0x6b45, 0x8018
+    dw 0x0335, 0x5eb1, 0x6727, 0x337c
+    dw 0x0336, 0x52f3, 0xef99, 0x9f51
+    dw 0x0337, 0xe4f7, 0xa72f, 0x7987
+    dw 0x0338, 0xe2fc, 0x182d, 0xfc00
+    dw 0x0339, 0x66dc, 0x7043, 0x3270
+    dw 0x033a, 0x2802, 0x3c3d, 0x2791
+    dw 0x033b, 0x3bfc, 0xf1af, 0x859f
+    dw 0x033c, 0x83bf, 0xc6e4, 0x008b
+    dw 0x033d, 0x0cd4, 0x396b, 0x0f21
+    dw 0x033e, 0x5054, 0x22b0, 0x692d
+    dw 0x033f, 0xe6d7, 0x6f26, 0xb3a8
+    dw 0x0340, 0x82b8, 0x1935, 0xa42d
+    dw 0x0341, 0x4b8c, 0x4c0e, 0x3b72
+    dw 0x0342, 0x151a, 0x03ae, 0x4d8c
+    dw 0x0343, 0x4f75, 0xc8fd, 0xc1fb
+    dw 0x0344, 0x4e76, 0xbe20, 0xcc38
+    dw 0x0345, 0x10e6, 0xa4e0, 0xa805
+    dw 0x0346, 0xe057, 0x9aa2, 0x7c00
+    dw 0x0347, 0xce38, 0x37e5, 0xd24d
+    dw 0x0348, 0xf61a, 0x3bc7, 0xf647
+    dw 0x0349, 0xda9f, 0x0ae3, 0xfc00
+    dw 0x034a, 0x8474, 0xbce6, 0x03a3
+    dw 0x034b, 0x67bf, 0x2541, 0x7c00
+    dw 0x034c, 0x51dc, 0xe198, 0xac31
+    dw 0x034d, 0x0c99, 0x2fd2, 0x18b4
+    dw 0x034e, 0x4ce8, 0xd0ee, 0xb7f6
+    dw 0x034f, 0x7ba9, 0x9db6, 0xfc00
+    dw 0x0350, 0xbc3e, 0x9fd1, 0x5858
+    dw 0x0351, 0x4c14, 0x33e4, 0x5422
+    dw 0x0352, 0x94f6, 0xecce, 0x0004
+    dw 0x0353, 0x10a8, 0x276a, 0x2506
+    dw 0x0354, 0x87eb, 0xa6e8, 0x1c96
+    dw 0x0355, 0x3b03, 0x0a1c, 0x6c97
+    dw 0x0356, 0x147a, 0xded3, 0x802a
+    dw 0x0357, 0xaeeb, 0xbd5e, 0x2d28
+    dw 0x0358, 0x5df2, 0x389b, 0x612a
+    dw 0x0359, 0xcae4, 0xbe02, 0x4896
+    dw 0x035a, 0x32f2, 0xfb39, 0x803e
+    dw 0x035b, 0xaf24, 0x5214, 0x98b3
+    dw 0x035c, 0x75b0, 0x51ea, 0x5fb2
+    dw 0x035d, 0x9b45, 0x0a7b, 0xcc7d
+    dw 0x035e, 0x1ca7, 0xb93f, 0x9f18
+    dw 0x035f, 0x29c1, 0xd538, 0x9069
+    dw 0x0360, 0x8fa8, 0x5889, 0x8036
+    dw 0x0361, 0x311b, 0xd8d6, 0x9439
+    dw 0x0362, 0xaadf, 0xa36b, 0x4369
+    dw 0x0363, 0xa9f8, 0x5344, 0x9292
+    dw 0x0364, 0xa05f, 0x335e, 0xa8bf
+    dw 0x0365, 0x8d77, 0x9244, 0x36fa
+    dw 0x0366, 0x86fc, 0xe5c5, 0x0001
+    dw 0x0367, 0xe319, 0x91c8, 0x7c00
+    dw 0x0368, 0x6765, 0x0133, 0x7c00
+    dw 0x0369, 0x9e54, 0x2b8c, 0xaeb5
+    dw 0x036a, 0xc6da, 0x57ba, 0xab18
+    dw 0x036b, 0x4d2c, 0x244d, 0x64cf
+    dw 0x036c, 0x52e5, 0x443a, 0x4a86
+    dw 0x036d, 0x8556, 0x6a89, 0x8000
+    dw 0x036e, 0x3914, 0xc9ec, 0xaadc
+    dw 0x036f, 0xfb61, 0x85e7, 0x7c00
+    dw 0x0370, 0xeefb, 0xa579, 0x7c00
+    dw 0x0371, 0xac6d, 0x2ca6, 0xbb9e
+    dw 0x0372, 0x4141, 0x6997, 0x1385
+    dw 0x0373, 0xb7a1, 0x85e3, 0x6d2f
+    dw 0x0374, 0x3997, 0xe474, 0x9105
+    dw 0x0375, 0xbd89, 0xb5ef, 0x4376
+    dw 0x0376, 0xd507, 0x5d04, 0xb402
+    dw 0x0377, 0x5ae9, 0x7a60, 0x1c56
+    dw 0x0378, 0x324b, 0xd949, 0x94c3
+    dw 0x0379, 0x1202, 0xe56e, 0x8009
+    dw 0x037a, 0x793b, 0x0b9a, 0x7c00
+    dw 0x037b, 0x325c, 0x9fce, 0xce85
+    dw 0x037c, 0x2073, 0x76d2, 0x0005
+    dw 0x037d, 0xbfa9, 0xfa13, 0x0286
+    dw 0x037e, 0x213d, 0x8a71, 0xd281
+    dw 0x037f, 0xca0f, 0x8c59, 0x7993
+    dw 0x0380, 0xf1e1, 0x4c3d, 0xe18c
+    dw 0x0381, 0x3643, 0x5840, 0x19e5
+    dw 0x0382, 0x88b2, 0x2d0a, 0x9774
+    dw 0x0383, 0x26a7, 0xd934, 0x891d
+    dw 0x0384, 0xafd6, 0x6838, 0x83b7
+    dw 0x0385, 0x54a2, 0x5432, 0x3c6b
+    dw 0x0386, 0x1f44, 0xba35, 0xa0af
+    dw 0x0387, 0xef5e, 0xd478, 0x5698
+    dw 0x0388, 0xd33e, 0xf7fd, 0x1741
+    dw 0x0389, 0x6de0, 0x1bbc, 0x7c00
+    dw 0x038a, 0x20c4, 0xd0dc, 0x8bd8
+    dw 0x038b, 0x736f, 0x13cf, 0x7c00
+    dw 0x038c, 0xb614, 0xf095, 0x02a7
+    dw 0x038d, 0x02e7, 0xaeaf, 0x8ef3
+    dw 0x038e, 0x124e, 0xdde1, 0x8022
+    dw 0x038f, 0x0741, 0xe66a, 0x8001
+    dw 0x0390, 0x17fa, 0xea05, 0x800b
+    dw 0x0391, 0x7184, 0x8099, 0xfc00
+    dw 0x0392, 0x4d85, 0x9a17, 0xef40
+    dw 0x0393, 0x22f2, 0x5d34, 0x02ab
+    dw 0x0394, 0xd129, 0xc1b4, 0x4b3d
+    dw 0x0395, 0xa5d8, 0xe37d, 0x0190
+    dw 0x0396, 0x189c, 0x618a, 0x0035
+    dw 0x0397, 0x251c, 0xc632, 0x9a99
+    dw 0x0398, 0x02ed, 0xdda9, 0x8002
+    dw 0x0399, 0x3ca8, 0x4654, 0x31e3
+    dw 0x039a, 0x9f69, 0xdb77, 0x01fc
+    dw 0x039b, 0x9782, 0x5160, 0x82cb
+    dw 0x039c, 0x9e4f, 0xf17b, 0x0009
+    dw 0x039d, 0x17ec, 0x6f0e, 0x0004
+    dw 0x039e, 0xac47, 0xe68d, 0x029d
+    dw 0x039f, 0x16a0, 0x4d65, 0x04ea
+    dw 0x03a0, 0xcd2f, 0x04a8, 0xfc00
+    dw 0x03a1, 0x32c3, 0x217e, 0x4ced
+    dw 0x03a2, 0xa456, 0x841e, 0x5c36
+    dw 0x03a3, 0xd3f8, 0x9f97, 0x7033
+    dw 0x03a4, 0xa311, 0x0af1, 0xd412
+    dw 0x03a5, 0xb9e2, 0x048f, 0xf129
+    dw 0x03a6, 0x57ed, 0x6520, 0x2e30
+    dw 0x03a7, 0x75d0, 0x3101, 0x7c00
+    dw 0x03a8, 0xde2a, 0x87b6, 0x7c00
+    dw 0x03a9, 0xcee8, 0xb7d0, 0x5312
+    dw 0x03aa, 0x91aa, 0x1f5c, 0xae28
+    dw 0x03ab, 0x62d4, 0x1cb9, 0x7c00
+    dw 0x03ac, 0xf839, 0x0db9, 0xfc00
+    dw 0x03ad, 0x3734, 0xd91c, 0x99a4
+    dw 0x03ae, 0x2929, 0x6a0b, 0x00db
+    dw 0x03af, 0x1713, 0xa6f4, 0xac12
+    dw 0x03b0, 0xeab3, 0xe40d, 0x429e
+    dw 0x03b1, 0xf463, 0x9f59, 0x7c00
+    dw 0x03b2, 0x3a01, 0x751d, 0x0259
+    dw 0x03b3, 0x37f9, 0xe73e, 0x8c67
+    dw 0x03b4, 0x722c, 0xddc1, 0xd04a
+    dw 0x03b5, 0x75e5, 0x509e, 0x611b
+    dw 0x03b6, 0xcc58, 0xc4b7, 0x435f
+    dw 0x03b7, 0x7175, 0x6ba0, 0x41ba
+    dw 0x03b8, 0x1066, 0x9f4b, 0xacd3
+    dw 0x03b9, 0xcc93, 0x96e9, 0x714c
+    dw 0x03ba, 0x9097, 0x2150, 0xaae9
+    dw 0x03bb, 0xfa8a, 0x448a, 0xf1c3
+    dw 0x03bc, 0x8016, 0xb686, 0x0036
+    dw 0x03bd, 0xeeb1, 0x63cc, 0xc6de
+    dw 0x03be, 0xeeb2, 0x7a1a, 0xb064
+    dw 0x03bf, 0x0dc2, 0x2006, 0x29b9
+    dw 0x03c0, 0xb1e8, 0xdb88, 0x1246
+    dw 0x03c1, 0x1a3c, 0xec19, 0x800c
+    dw 0x03c2, 0x5bd6, 0x5002, 0x47d2
+    dw 0x03c3, 0x710f, 0x7a50, 0x3269
+    dw 0x03c4, 0x38f4, 0x4de4, 0x26ba
+    dw 0x03c5, 0x4d56, 0x619e, 0x2799
+    dw 0x03c6, 0x5a49, 0xd84a, 0xbddd
+    dw 0x03c7, 0xd4e4, 0xe556, 0x2b55
+    dw 0x03c8, 0x3e50, 0x5bf3, 0x1e5a
+    dw 0x03c9, 0x0ddc, 0x147d, 0x3539
+    dw 0x03ca, 0xc9f8, 0x23be, 0xe22b
+    dw 0x03cb, 0x2b2b, 0x9e92, 0xc85d
+    dw 0x03cc, 0xbae9, 0x0b70, 0xeb6f
+    dw 0x03cd, 0x46da, 0x4004, 0x42d3
+    dw 0x03ce, 0xc83b, 0x912c, 0x728b
+    dw 0x03cf, 0x4b30, 0x4726, 0x4006
+    dw 0x03d0, 0xaa9b, 0x8f91, 0x56fc
+    dw 0x03d1, 0x35f2, 0x3c04, 0x35ec
+    dw 0x03d2, 0xe730, 0xee84, 0x346a
+    dw 0x03d3, 0x66af, 0x100d, 0x7c00
+    dw 0x03d4, 0xe24f, 0x7621, 0xa81e
+    dw 0x03d5, 0xee40, 0x4be4, 0xde56
+    dw 0x03d6, 0xe391, 0xaefc, 0x7055
+    dw 0x03d7, 0x702a, 0x213c, 0x7c00
+    dw 0x03d8, 0xef1d, 0x648d, 0xc641
+    dw 0x03d9, 0xb985, 0x0214, 0xf550
+    dw 0x03da, 0x4dd6, 0x7aba, 0x0ef1
+    dw 0x03db, 0xf65e, 0xc411, 0x6e43
+    dw 0x03dc, 0xa5ae, 0xf123, 0x0023
+    dw 0x03dd, 0xe5ac, 0xd485, 0x4d05
+    dw 0x03de, 0x2c78, 0x5160, 0x16a7
+    dw 0x03df, 0x9335, 0x9c52, 0x32ac
+    dw 0x03e0, 0xdb11, 0x5ae0, 0xbc1d
+    dw 0x03e1, 0x88b3, 0x35a1, 0x8eae
+    dw 0x03e2, 0xe655, 0xcf45, 0x52f8
+    dw 0x03e3, 0xb06e, 0x27b0, 0xc49c
+    dw 0x03e4, 0x78ba, 0x0852, 0x7c00
+    dw 0x03e5, 0xe916, 0x8f90, 0x7c00
+    dw 0x03e6, 0xc06a, 0x0aaf, 0xf149
+    dw 0x03e7, 0x4001, 0xf2c6, 0x88bb
+    dw 0x03e8, 0xcf3d, 0xc78f, 0x43a9
+    dw 0x03e9, 0x1077, 0xbfaa, 0x8ca9
+    dw 0x03ea, 0x260a, 0xb736, 0xaab3
+    dw 0x03eb, 0x2e74, 0x3dfb, 0x2c51
+    dw 0x03ec, 0xfb02, 0xe360, 0x539a
+    dw 0x03ed, 0x85ab, 0x3858, 0x8938
+    dw 0x03ee, 0x7021, 0x94a8, 0xfc00
+
+    ; Results near the exponent boundaries
+    dw 0x03ef, 0xe47f, 0xfae7, 0x2536
+    dw 0x03f0, 0xd33b, 0x998a, 0x7539
+    dw 0x03f1, 0xd296, 0x127f, 0xfc00
+    dw 0x03f2, 0x9126, 0xcaf3, 0x02f7
+    dw 0x03f3, 0x96f7, 0xcee9, 0x0408
+    dw 0x03f4, 0xc54f, 0x7ab7, 0x8653
+    dw 0x03f5, 0x94e3, 0x4808, 0x88d9
+    dw 0x03f6, 0x0f0d, 0xceee, 0x8104
+    dw 0x03f7, 0xb1f9, 0x833b, 0x6b65
+    dw 0x03f8, 0x2ca7, 0x6ffa, 0x0095
+    dw 0x03f9, 0x513a, 0x7919, 0x141a
+    dw 0x03fa, 0x0409, 0x8145, 0xc25b
+    dw 0x03fb, 0xd8dd, 0x7b96, 0x9921
+    dw 0x03fc, 0x0cee, 0xc927, 0x81ea
+    dw 0x03fd, 0x20af, 0x0123, 0x601f
+    dw 0x03fe, 0x112e, 0x47f5, 0x0535
+    dw 0x03ff, 0xab6e, 0x809b, 0x6e23
+    dw 0x0400, 0x7125, 0x78bd, 0x3458
+    dw 0x0401, 0xb882, 0x824f, 0x73cf
+    dw 0x0402, 0xf325, 0x300d, 0xfc00
+    dw 0x0403, 0x0c0c, 0x819b, 0xc90b
+    dw 0x0404, 0x9778, 0x4a31, 0x88d3
+    dw 0x0405, 0x1128, 0x014d, 0x4fee
+    dw 0x0406, 0x0bc1, 0x4527, 0x0303
+    dw 0x0407, 0x56cb, 0x7aa9, 0x1814
+    dw 0x0408, 0xd8d1, 0xfb80, 0x1923
+    dw 0x0409, 0xb43a, 0x8232, 0x6fb3
+    dw 0x040a, 0xa6c7, 0xe19f, 0x0269
+    dw 0x040b, 0x15d2, 0x83e5, 0xcdfa
+    dw 0x040c, 0x2b76, 0x5d79, 0x0974
+    dw 0x040d, 0x5168, 0xf9df, 0x935e
+    dw 0x040e, 0xc0f1, 0x06f5, 0xf5af
+    dw 0x040f, 0xb09f, 0xecc6, 0x01f0
+    dw 0x0410, 0x54b6, 0xf997, 0x96be
+    dw 0x0411, 0xd3fc, 0x1bbf, 0xf41f
+    dw 0x0412, 0xe3e2, 0x20f3, 0xfc00
+    dw 0x0413, 0x4051, 0x8569, 0xf662
+    dw 0x0414, 0xe96b, 0x7b24, 0xaa12
+    dw 0x0415, 0xcfcd, 0x17de, 0xf3ef
+    dw 0x0416, 0xe498, 0x7bd3, 0xa4b2
+    dw 0x0417, 0xa467, 0x61dc, 0x8181
+    dw 0x0418, 0x26a2, 0x01ec, 0x62e7
+    dw 0x0419, 0x8b83, 0x01a3, 0xc897
+    dw 0x041a, 0x2cd0, 0x6313, 0x0571
+    dw 0x041b, 0x05b1, 0x0080, 0x49b1
+    dw 0x041c, 0xdb4b, 0x9be4, 0x7b65
+    dw 0x041d, 0x39f1, 0x00da, 0x7afa
+    dw 0x041e, 0x0918, 0x4a85, 0x00c8
+    dw 0x041f, 0xcd89, 0x94f4, 0x7478
+    dw 0x0420, 0xfab7, 0x7b5f, 0xbb4a
+    dw 0x0421, 0x8401, 0xb93d, 0x061d
+    dw 0x0422, 0xab76, 0x831f, 0x64c8
+    dw 0x0423, 0x4477, 0x8d06, 0xf31c
+    dw 0x0424, 0x66aa, 0x7891, 0x29d6
+    dw 0x0425, 0x93ca, 0x002e, 0xdd6b
+    dw 0x0426, 0x4566, 0x0cc5, 0x7487
+    dw 0x0427, 0x37b1, 0xeeff, 0x8466
+    dw 0x0428, 0x9b8a, 0x4d61, 0x899b
+    dw 0x0429, 0x1346, 0x0079, 0x57b2
+    dw 0x042a, 0x34a9, 0xee85, 0x82dc
+    dw 0x042b, 0xc4b1, 0x7bce, 0x84cf
+    dw 0x042c, 0x42f6, 0x054b, 0x7943
+    dw 0x042d, 0x43ed, 0x87ab, 0xf822
+    dw 0x042e, 0x8929, 0x03dd, 0xc158
+    dw 0x042f, 0xe70a, 0xf960, 0x293d
+    dw 0x0430, 0x27a7, 0xdee0, 0x8474
+    dw 0x0431, 0xe843, 0x2c75, 0xf7a6
+    dw 0x0432, 0x6e95, 0xb259, 0xf826
+    dw 0x0433, 0x0eb9, 0x82c9, 0xc8d4
+    dw 0x0434, 0x9ab6, 0x0235, 0xd615
+    dw 0x0435, 0xd787, 0x9ae1, 0x7861
+    dw 0x0436, 0x2c96, 0x6d6c, 0x00d9
+    dw 0x0437, 0x88bd, 0x0374, 0xc17d
+    dw 0x0438, 0xd92f, 0x7aa7, 0x9a3c
+    dw 0x0439, 0x8533, 0x831a, 0x3eb5
+    dw 0x043a, 0x1723, 0x54a3, 0x018a
+    dw 0x043b, 0x8a31, 0x01fb, 0xc641
+    dw 0x043c, 0xea0c, 0xfa15, 0x2bf4
+    dw 0x043d, 0x9a7e, 0xd6d2, 0x01e7
+    dw 0x043e, 0xdc6f, 0xa5b2, 0x723a
+    dw 0x043f, 0x78ea, 0x41c0, 0x72d6
+    dw 0x0440, 0x0911, 0x030b, 0x42a9
+    dw 0x0441, 0x6185, 0xa15f, 0xfc00
+    dw 0x0442, 0x9015, 0xcbd3, 0x0216
+    dw 0x0443, 0x131e, 0x8073, 0xd7ec
+    dw 0x0444, 0x6a44, 0xabc9, 0xfa70
+    dw 0x0445, 0xf0e1, 0xbab3, 0x71d4
+    dw 0x0446, 0x0ff2, 0x443d, 0x0780
+    dw 0x0447, 0x1a27, 0x00e9, 0x5ac2
+    dw 0x0448, 0x5e4e, 0x7a8e, 0x1fb2
+    dw 0x0449, 0x3895, 0x743c, 0x022a
+    dw 0x044a, 0x3987, 0x82e7, 0xf39e
+    dw 0x044b, 0x68d5, 0xfbf0, 0xa8df
+    dw 0x044c, 0x9637, 0x4cf2, 0x8507
+    dw 0x044d, 0x2543, 0xde8c, 0x8337
+    dw 0x044e, 0x567f, 0x9746, 0xfb25
+    dw 0x044f, 0xb1d9, 0x6a39, 0x83c2
+    dw 0x0450, 0xa463, 0xe619, 0x00b8
+    dw 0x0451, 0xb5f1, 0x6da9, 0x8433
+    dw 0x0452, 0xb1d6, 0x82bf, 0x6c40
+    dw 0x0453, 0xf3b9, 0xb72a, 0x7850
+    dw 0x0454, 0x443f, 0x099e, 0x760c
+    dw 0x0455, 0xd2b0, 0x10b8, 0xfc00
+    dw 0x0456, 0xc146, 0x8454, 0x78e0
+    dw 0x0457, 0xc82b, 0x13fe, 0xf02c
+    dw 0x0458, 0x49ba, 0x93aa, 0xf1fa
+    dw 0x0459, 0xc411, 0x7950, 0x8620
+    dw 0x045a, 0x1b9a, 0x03bf, 0x540f
+    dw 0x045b, 0xfbaf, 0x78e7, 0xbe45
+    dw 0x045c, 0x8c19, 0x48bf, 0x81ba
+    dw 0x045d, 0x0dcb, 0x01cd, 0x4a6f
+    dw 0x045e, 0xbb68, 0x7b08, 0x810e
+    dw 0x045f, 0x9e42, 0xd83f, 0x02f3
+    dw 0x0460, 0x74e8, 0xf923, 0xb7a4
+    dw 0x0461, 0x3e3a, 0x8203, 0xfa31
+    dw 0x0462, 0x72dd, 0x3749, 0x7789
+    dw 0x0463, 0xdb23, 0x205e, 0xf689
+    dw 0x0464, 0xe6c5, 0x2436, 0xfc00
+    dw 0x0465, 0xc822, 0x0bab, 0xf850
+    dw 0x0466, 0x572f, 0x78bc, 0x1a12
+    dw 0x0467, 0xc572, 0xf838, 0x092a
+    dw 0x0468, 0xb0a7, 0x0246, 0xec18
+    dw 0x0469, 0x1b87, 0xd388, 0x83ff
+    dw 0x046a, 0x0d81, 0x0064, 0x530c
+    dw 0x046b, 0x1ebe, 0x0112, 0x5e4d
+    dw 0x046c, 0xc954, 0xfa8d, 0x0a82
+    dw 0x046d, 0x090c, 0x0224, 0x44b7
+    dw 0x046e, 0x9752, 0x803f, 0x5f70
+    dw 0x046f, 0x5f13, 0xf8e8, 0xa1c4
+    dw 0x0470, 0xc92d, 0x0f0e, 0xf5df
+    dw 0x0471, 0xea69, 0x7b43, 0xab10
+    dw 0x0472, 0x5c7a, 0xfac5, 0x9d4a
+    dw 0x0473, 0xaf47, 0xe422, 0x070b
+    dw 0x0474, 0x30af, 0xebea, 0x825e
+    dw 0x0475, 0x658a, 0xfb83, 0xa5e6
+    dw 0x0476, 0x3ee8, 0x79e4, 0x0258
+    dw 0x0477, 0x88f3, 0x4889, 0x8117
+    dw 0x0478, 0x2d05, 0xee63, 0x80c9
+    dw 0x0479, 0xab9e, 0x81d5, 0x6828
+    dw 0x047a, 0xf3f2, 0x7a24, 0xb52d
+    dw 0x047b, 0x469e, 0x0b6e, 0x7720
+    dw 0x047c, 0xbb5a, 0x775e, 0x81ff
+    dw 0x047d, 0x3627, 0xea6d, 0x87a9
+    dw 0x047e, 0x1423, 0x578e, 0x008c
+    dw 0x047f, 0xcabd, 0x0a6c, 0xfc00
+    dw 0x0480, 0x907c, 0x007e, 0xd48e
+    dw 0x0481, 0x3d92, 0xf911, 0x8233
+    dw 0x0482, 0x4d46, 0x7a00, 0x0f08
+    dw 0x0483, 0xc3c1, 0x8bd4, 0x73ed
+    dw 0x0484, 0xe60b, 0xfb5e, 0x2690
+    dw 0x0485, 0xc11e, 0x789b, 0x8472
+    dw 0x0486, 0x5135, 0x1656, 0x7693
+    dw 0x0487, 0x67ba, 0x78b4, 0x2a92
+    dw 0x0488, 0x9af3, 0x02fa, 0xd4ab
+    dw 0x0489, 0x3ab3, 0x70d4, 0x058d
+    dw 0x048a, 0x952e, 0x5054, 0x8265
+    dw 0x048b, 0xec38, 0xfb5f, 0x2c94
+    dw 0x048c, 0x2ea9, 0x8377, 0xe7b0
+    dw 0x048d, 0x7b0b, 0xf932, 0xbd6c
+    dw 0x048e, 0x4d2d, 0x16fb, 0x71ef
+    dw 0x048f, 0xc72b, 0x8ce0, 0x75e2
+    dw 0x0490, 0x262d, 0x0085, 0x69f2
+    dw 0x0491, 0xc870, 0xfacf, 0x0937
+    dw 0x0492, 0xef72, 0x336c, 0xf803
+    dw 0x0493, 0x848e, 0x41b0, 0x819a
+    dw 0x0494, 0xef3b, 0xb556, 0x756c
+    dw 0x0495, 0xeee8, 0x7926, 0xb15e
+    dw 0x0496, 0xa405, 0x639a, 0x810f
+    dw 0x0497, 0xa1ff, 0xd413, 0x09e3
+    dw 0x0498, 0xea28, 0x7bac, 0xaa6b
+    dw 0x0499, 0xd864, 0x2066, 0xf3fc
+    dw 0x049a, 0x88f3, 0x00c5, 0xca6e
+    dw 0x049b, 0xb283, 0x6ba7, 0x8367
+    dw 0x049c, 0x6992, 0xb297, 0xf2c3
+    dw 0x049d, 0xa6fb, 0xe419, 0x01b4
+    dw 0x049e, 0xbe15, 0xfa73, 0x01e3
+    dw 0x049f, 0x4991, 0xf855, 0x8d24
+    dw 0x04a0, 0x631c, 0xf99c, 0xa512
+    dw 0x04a1, 0xccbe, 0x95df, 0x7276
+    dw 0x04a2, 0x985e, 0xdb23, 0x009d
+    dw 0x04a3, 0x9310, 0xd22b, 0x0125
+    dw 0x04a4, 0xd228, 0x9725, 0x76e5
+    dw 0x04a5, 0xe3eb, 0xa22c, 0x7c00
+    dw 0x04a6, 0x9b18, 0x80f9, 0x5b4b
+    dw 0x04a7, 0xc38a, 0x8719, 0x7840
+    dw 0x04a8, 0x0cce, 0x4a6b, 0x017f
+    dw 0x04a9, 0x9a49, 0x0195, 0xd7f2
+    dw 0x04aa, 0xd44a, 0x97ea, 0x7856
+    dw 0x04ab, 0xc1ce, 0xf88c, 0x051b
+    dw 0x04ac, 0x5698, 0x7a12, 0x1858
+    dw 0x04ad, 0xceef, 0x0c1d, 0xfc00
+    dw 0x04ae, 0x2276, 0xd91e, 0x850d
+    dw 0x04af, 0x9eec, 0x82a4, 0x593e
+    dw 0x04b0, 0x7354, 0xb583, 0xf951
+    dw 0x04b1, 0xf1d4, 0x79b8, 0xb414
+    dw 0x04b2, 0xba8b, 0x7359, 0x8390
+    dw 0x04b3, 0x9ba5, 0xd3c2, 0x03f1
+    dw 0x04b4, 0x0db1, 0x02d2, 0x4809
+    dw 0x04b5, 0x1b28, 0x030b, 0x54b4
+    dw 0x04b6, 0x3bd0, 0x805f, 0xfc00
+    dw 0x04b7, 0x5dee, 0x242b, 0x75b1
+    dw 0x04b8, 0xbe8e, 0x078d, 0xf2f2
+    dw 0x04b9, 0x4388, 0x02ac, 0x7c00
+    dw 0x04ba, 0x2f13, 0x67cc, 0x03a1
+    dw 0x04bb, 0x5c08, 0x9c12, 0xfbec
+    dw 0x04bc, 0x8447, 0xbeac, 0x0290
+    dw 0x04bd, 0xb5ab, 0xf69f, 0x00db
+    dw 0x04be, 0xc8b6, 0x0a62, 0xf9e8
+    dw 0x04bf, 0x7234, 0xbb5e, 0xf2bc
+    dw 0x04c0, 0x20fe, 0x8060, 0xe6a8
+    dw 0x04c1, 0x2d08, 0x0152, 0x6b9f
+    dw 0x04c2, 0x584d, 0x79d3, 0x19e8
+    dw 0x04c3, 0x9176, 0xcd4e, 0x020f
+    dw 0x04c4, 0xf663, 0x79ed, 0xb850
+    dw 0x04c5, 0x585d, 0x7816, 0x1c46
+    dw 0x04c6, 0x319f, 0x02b9, 0x6c21
+    dw 0x04c7, 0x3daf, 0x009f, 0x7c00
+    dw 0x04c8, 0x0f0c, 0x83c4, 0xc77c
+    dw 0x04c9, 0x8622, 0x03a6, 0xbeb9
+    dw 0x04ca, 0xd89d, 0x9881, 0x7c00
+    dw 0x04cb, 0x596a, 0x7b47, 0x19f4
+    dw 0x04cc, 0x1771, 0x012d, 0x5654
+    dw 0x04cd, 0x1a37, 0xd8bb, 0x8150
+    dw 0x04ce, 0x97c3, 0x020d, 0xd392
+    dw 0x04cf, 0xc9e9, 0x7bee, 0x89f6
+    dw 0x04d0, 0xb028, 0x691e, 0x8340
+    dw 0x04d1, 0xb294, 0x6ccc, 0x82be
+    dw 0x04d2, 0xc290, 0x034a, 0xfbfb
+    dw 0x04d3, 0xb899, 0x7607, 0x8187
+    dw 0x04d4, 0x2c73, 0x0312, 0x65cc
+    dw 0x04d5, 0x6d78, 0x2c0e, 0x7c00
+    dw 0x04d6, 0x1c40, 0x8258, 0xd741
+    dw 0x04d7, 0xd07a, 0x98ff, 0x732b
+    dw 0x04d8, 0x3920, 0xed23, 0x87fb
+    dw 0x04d9, 0x6860, 0xf880, 0xabc7
+    dw 0x04da, 0x3457, 0x71b6, 0x0185
+    dw 0x04db, 0x419b, 0x8358, 0xfab5
+    dw 0x04dc, 0x3df2, 0x7842, 0x02cb
+    dw 0x04dd, 0xaf4a, 0xeba7, 0x01e8
+    dw 0x04de, 0x60a9, 0x7a43, 0x21f4
+    dw 0x04df, 0xd29f, 0x7880, 0x95e3
+    dw 0x04e0, 0xd75c, 0x7a2c, 0x98c5
+    dw 0x04e1, 0xdc53, 0x20d8, 0xf724
+    dw 0x04e2, 0xd7e0, 0x9e29, 0x751d
+    dw 0x04e3, 0x88e0, 0xc79e, 0x0148
+    dw 0x04e4, 0x1470, 0x50ae, 0x01e6
+    dw 0x04e5, 0x6cf2, 0x34f8, 0x73f6
+    dw 0x04e6, 0x3299, 0x037f, 0x6b8c
+    dw 0x04e7, 0x50ca, 0x9b80, 0xf11c
+    dw 0x04e8, 0xd71c, 0x7ac1, 0x9836
+    dw 0x04e9, 0xba40, 0x73b1, 0x8340
+    dw 0x04ea, 0xb880, 0x822c, 0x7425
+    dw 0x04eb, 0xc311, 0x801a, 0x7c00
+    dw 0x04ec, 0x4fca, 0x799c, 0x118e
+    dw 0x04ed, 0x0600, 0x4204, 0x01ff
+    dw 0x04ee, 0x3c98, 0x0234, 0x782c
+    dw 0x04ef, 0x2ad0, 0x5e62, 0x0845
+    dw 0x04f0, 0x27c1, 0x64cc, 0x019e
+    dw 0x04f1, 0xe0e4, 0x79e8, 0xa2a0
+    dw 0x04f2, 0x7120, 0xb1bc, 0xfb26
+    dw 0x04f3, 0x5fbe, 0xf9a5, 0xa17d
+    dw 0x04f4, 0x6869, 0x7a10, 0x29d2
+    dw 0x04f5, 0x70c3, 0x7aa3, 0x31bd
+    dw 0x04f6, 0x9c6f, 0x580e, 0x8230
+    dw 0x04f7, 0xb3b4, 0xf1c8, 0x0155
+    dw 0x04f8, 0x7060, 0x7a66, 0x3178
+    dw 0x04f9, 0x88d3, 0x833f, 0x41f2
+    dw 0x04fa, 0x67f0, 0xa7fd, 0xfbf3
+    dw 0x04fb, 0xf450, 0x7863, 0xb7dd
+    dw 0x04fc, 0xaa48, 0x8160, 0x6891
+    dw 0x04fd, 0xa26f, 0xe0be, 0x015b
+    dw 0x04fe, 0x966f, 0x81e6, 0x52c7
+    dw 0x04ff, 0xc7a0, 0xf905, 0x0a14
+    dw 0x0500, 0x0441, 0x00d1, 0x4536
+    dw 0x0501, 0x505b, 0x1581, 0x7655
+    dw 0x0502, 0xb9b0, 0xfa09, 0x00f1
+    dw 0x0503, 0x9b79, 0x024f, 0xd679
+    dw 0x0504, 0x543c, 0x782e, 0x180d
+    dw 0x0505, 0xd465, 0x1e3a, 0xf1a5
+    dw 0x0506, 0xb880, 0x0039, 0xfc00
+    dw 0x0507, 0x56c0, 0x7a32, 0x185c
+    dw 0x0508, 0x597f, 0x7997, 0x1bde
+    dw 0x0509, 0xd8e0, 0x9d5e, 0x7744
+    dw 0x050a, 0xa086, 0x0206, 0xdc79
+    dw 0x050b, 0x62f8, 0xa326, 0xfbcd
+    dw 0x050c, 0x2159, 0x8050, 0xe847
+    dw 0x050d, 0xc41b, 0x0a2f, 0xf550
+    dw 0x050e, 0x202d, 0x5eaa, 0x0141
+    dw 0x050f, 0x3166, 0x0048, 0x78cc
+    dw 0x0510, 0xb919, 0x0119, 0xf8a5
+    dw 0x0511, 0x16bb, 0x4fb7, 0x037d
+    dw 0x0512, 0x6738, 0xa5df, 0xfc00
+    dw 0x0513, 0x43c9, 0x0641, 0x78fb
+    dw 0x0514, 0xf3ac, 0x7a26, 0xb4fe
+    dw 0x0515, 0xcdec, 0xfafb, 0x0ec9
+    dw 0x0516, 0x4421, 0x883d, 0xf7cb
+    dw 0x0517, 0x3f4c, 0xf5aa, 0x8527
+    dw 0x0518, 0x8e51, 0x461f, 0x8421
+    dw 0x0519, 0xb1ec, 0x01d1, 0xee85
+    dw 0x051a, 0x473e, 0x7844, 0x0acb
+    dw 0x051b, 0x5716, 0x7bb4, 0x175c
+    dw 0x051c, 0xcde6, 0x782f, 0x91a4
+    dw 0x051d, 0x34ba, 0x6b88, 0x0505
+    dw 0x051e, 0xaaaf, 0x01bd, 0xe7b1
+    dw 0x051f, 0x6f52, 0x34d9, 0x760a
+    dw 0x0520, 0xf1f4, 0xfb16, 0x32b9
+    dw 0x0521, 0xadd7, 0x66ea, 0x8361
+    dw 0x0522, 0x6bff, 0x7b16, 0x2c84
+    dw 0x0523, 0x3e94, 0x0517, 0x752b
+    dw 0x0524, 0x6db5, 0xb531, 0xf466
+    dw 0x0525, 0x0dcb, 0x0342, 0x471d
+    dw 0x0526, 0xc89b, 0x882f, 0x7c00
+    dw 0x0527, 0x9672, 0xd53a, 0x013c
+    dw 0x0528, 0x554f, 0x151e, 0x7c00
+    dw 0x0529, 0xc9a7, 0x8f66, 0x761d
+    dw 0x052a, 0xb5e6, 0xefda, 0x0301
+    dw 0x052b, 0x75ba, 0xf967, 0xb83d
+    dw 0x052c, 0x0c4e, 0x490a, 0x01b5
+    dw 0x052d, 0xf772, 0x3c26, 0xf72e
+    dw 0x052e, 0x4dca, 0x794e, 0x105e
+    dw 0x052f, 0x73fb, 0x3160, 0x7c00
+    dw 0x0530, 0x6637, 0xa538, 0xfc00
+    dw 0x0531, 0x0cc5, 0xc94e, 0x81cc
+    dw 0x0532, 0x93a9, 0x4493, 0x8ab3
+    dw 0x0533, 0xcc62, 0x79ae, 0x8e2c
+    dw 0x0534, 0x3ee4, 0xfa97, 0x8217
+    dw 0x0535, 0xbd69, 0x0166, 0xfbbd
+    dw 0x0536, 0xafbd, 0x0044, 0xf748
+    dw 0x0537, 0x1056, 0x48b9, 0x03ac
+    dw 0x0538, 0xdf78, 0x7931, 0xa1c1
+    dw 0x0539, 0x7678, 0xf972, 0xb8c0
+
+    ; Mostly subnormal values
+    dw 0x053a, 0x8240, 0x023c, 0xbc07
+    dw 0x053b, 0xd27b, 0x0142, 0xfc00
+    dw 0x053c, 0x8149, 0x000f, 0xcd7c
+    dw 0x053d, 0x8197, 0x5266, 0x8008
+    dw 0x053e, 0x002b, 0x8071, 0xb617
+    dw 0x053f, 0x6eaa, 0x8170, 0xfc00
+    dw 0x0540, 0x6e2c, 0x8026, 0xfc00
+    dw 0x0541, 0xd1f4, 0x017c, 0xfc00
+    dw 0x0542, 0x8389, 0x0294, 0xbd7c
+    dw 0x0543, 0x82c0, 0x8161, 0x3ffa
+    dw 0x0544, 0x8065, 0xb37e, 0x01af
+    dw 0x0545, 0x0ecc, 0x8122, 0xce00
+    dw 0x0546, 0xb46f, 0x2f22, 0xc0f9
+    dw 0x0547, 0x833e, 0x0108, 0xc24a
+    dw 0x0548, 0x015c, 0x8262, 0xb890
+    dw 0x0549, 0xc89a, 0x543a, 0xb05b
+    dw 0x054a, 0x82a6, 0xa0e9, 0x1c51
+    dw 0x054b, 0x1a70, 0x802d, 0xe494
+    dw 0x054c, 0x834b, 0xa393, 0x1af5
+    dw 0x054d, 0x0235, 0xcc1e, 0x8022
+    dw 0x054e, 0x81cd, 0x1929, 0xa195
+    dw 0x054f, 0x83ac, 0x6ad3, 0x8000
+    dw 0x0550, 0x8346, 0x813b, 0x4152
+    dw 0x0551, 0x1c85, 0x3d63, 0x1ab6
+    dw 0x0552, 0x8004, 0x0011, 0xb388
+    dw 0x0553, 0x80f1, 0x025b, 0xb665
+    dw 0x0554, 0x02d5, 0x036d, 0x3a9d
+    dw 0x0555, 0x01c0, 0x0058, 0x4517
+    dw 0x0556, 0x03a2, 0x808d, 0xc699
+    dw 0x0557, 0x0086, 0x03d7, 0x305d
+    dw 0x0558, 0x827c, 0x80e4, 0x4194
+    dw 0x0559, 0xa6ac, 0xf1b8, 0x0025
+    dw 0x055a, 0x00fd, 0xbed2, 0x8094
+    dw 0x055b, 0x827b, 0x83de, 0x3922
+    dw 0x055c, 0x82ed, 0x006e, 0xc6cf
+    dw 0x055d, 0x8280, 0x023d, 0xbc78
+    dw 0x055e, 0xa314, 0x0215, 0xdecd
+    dw 0x055f, 0x8051, 0x8369, 0x2df0
+    dw 0x0560, 0x832a, 0x002b, 0xccb6
+    dw 0x0561, 0xdcc8, 0x8304, 0x7c00
+    dw 0x0562, 0x0167, 0x3e13, 0x00ec
+    dw 0x0563, 0x02c4, 0x0087, 0x453f
+    dw 0x0564, 0x80ab, 0x42d8, 0x8032
+    dw 0x0565, 0x9617, 0xea5b, 0x0008
+    dw 0x0566, 0x0029, 0x2d88, 0x01da
+    dw 0x0567, 0x80cb, 0xa07b, 0x15aa
+    dw 0x0568, 0x027a, 0x769a, 0x0000
+    dw 0x0569, 0x0151, 0x81fe, 0xb949
+    dw 0x056a, 0x0083, 0x0160, 0x35f4
+    dw 0x056b, 0x2074, 0x031b, 0x59bc
+    dw 0x056c, 0x8283, 0x031f, 0xba70
+    dw 0x056d, 0x8359, 0x02b9, 0xbceb
+    dw 0x056e, 0x0395, 0x020a, 0x3f07
+    dw 0x056f, 0x02e2, 0x0ac6, 0x32cf
+    dw 0x0570, 0x835c, 0x8022, 0x4e53
+    dw 0x0571, 0x20fe, 0xf8b5, 0x8004
+    dw 0x0572, 0x4d29, 0x0336, 0x7c00
+    dw 0x0573, 0x07d1, 0x0363, 0x409e
+    dw 0x0574, 0x81b6, 0xaf96, 0x0b38
+    dw 0x0575, 0x809c, 0x812c, 0x3829
+    dw 0x0576, 0x8032, 0x83e6, 0x2a6a
+    dw 0x0577, 0x8204, 0x8143, 0x3e64
+    dw 0x0578, 0x03b6, 0x006f, 0x4847
+    dw 0x0579, 0x82a7, 0x81b2, 0x3e42
+    dw 0x057a, 0x8bcc, 0x0037, 0xd489
+    dw 0x057b, 0x82d8, 0x8373, 0x3a98
+    dw 0x057c, 0xdf9d, 0x8178, 0x7c00
+    dw 0x057d, 0x82cf, 0x80b2, 0x440a
+    dw 0x057e, 0xa6a2, 0x83c9, 0x5f02
+    dw 0x057f, 0x3fdb, 0x0223, 0x7b5a
+    dw 0x0580, 0x006a, 0x02f8, 0x3077
+    dw 0x0581, 0x0044, 0x819d, 0xb145
+    dw 0x0582, 0x8159, 0x0023, 0xc8ee
+    dw 0x0583, 0x0273, 0xc58f, 0x8071
+    dw 0x0584, 0x313a, 0x0127, 0x7089
+    dw 0x0585, 0x028d, 0x80da, 0xc1fe
+    dw 0x0586, 0x0372, 0x01a7, 0x402c
+    dw 0x0587, 0x021e, 0x837f, 0xb8d8
+    dw 0x0588, 0x22f0, 0x4837, 0x1695
+    dw 0x0589, 0x813a, 0xb5ab, 0x0376
+    dw 0x058a, 0xde9e, 0x8128, 0x7c00
+    dw 0x058b, 0x80d3, 0x02cc, 0xb4b7
+    dw 0x058c, 0x8039, 0x0143, 0xb1a6
+    dw 0x058d, 0xeca6, 0x81b1, 0x7c00
+    dw 0x058e, 0x83ec, 0x0340, 0xbcd4
+    dw 0x058f, 0x0003, 0x0382, 0x1ad8
+    dw 0x0590, 0x02ca, 0x824e, 0xbcd7
+    dw 0x0591, 0x830f, 0x01e3, 0xbe7c
+    dw 0x0592, 0x03c1, 0x259b, 0x195c
+    dw 0x0593, 0x80af, 0x037c, 0xb247
+    dw 0x0594, 0xc3e5, 0x1591, 0xe9ac
+    dw 0x0595, 0x80d3, 0x01d3, 0xb73b
+    dw 0x0596, 0x838a, 0x820d, 0x3ee7
+    dw 0x0597, 0x01f9, 0x01f1, 0x3c10
+    dw 0x0598, 0x1686, 0x81f8, 0xd2a1
+    dw 0x0599, 0x83d7, 0x03a1, 0xbc3c
+    dw 0x059a, 0x83b9, 0x0286, 0xbde7
+    dw 0x059b, 0x8058, 0x6cd3, 0x8000
+    dw 0x059c, 0x0058, 0xece9, 0x8000
+    dw 0x059d, 0x024a, 0x0331, 0x39bd
+    dw 0x059e, 0x0141, 0x82b9, 0xb75e
+    dw 0x059f, 0x009c, 0x8031, 0xc25e
+    dw 0x05a0, 0xf586, 0x0390, 0xfc00
+    dw 0x05a1, 0x8084, 0x00af, 0xba09
+    dw 0x05a2, 0x01e3, 0x80d0, 0xc0a5
+    dw 0x05a3, 0x822d, 0x8206, 0x3c4d
+    dw 0x05a4, 0x031c, 0x8071, 0xc70b
+    dw 0x05a5, 0x035e, 0x8298, 0xbd31
+    dw 0x05a6, 0x83d5, 0x81a5, 0x40a9
+    dw 0x05a7, 0x036e, 0xe403, 0x8001
+    dw 0x05a8, 0x0349, 0x3e6d, 0x020c
+    dw 0x05a9, 0x9710, 0x83df, 0x4f4c
+    dw 0x05aa, 0x812a, 0x8280, 0x3773
+    dw 0x05ab, 0x81ae, 0x000a, 0xd160
+    dw 0x05ac, 0x024a, 0x81db, 0xbcef
+    dw 0x05ad, 0x835a, 0x83ea, 0x3ada
+    dw 0x05ae, 0x29b0, 0x02bb, 0x642a
+    dw 0x05af, 0x83d8, 0x80e8, 0x443e
+    dw 0x05b0, 0x031a, 0x838b, 0xbb01
+    dw 0x05b1, 0x80bd, 0x036a, 0xb2eb
+    dw 0x05b2, 0x2e27, 0x7549, 0x004b
+    dw 0x05b3, 0x00ac, 0x8250, 0xb4a6
+    dw 0x05b4, 0x005e, 0x00fa, 0x3604
+    dw 0x05b5, 0x02e3, 0x0001, 0x61c6
+    dw 0x05b6, 0x0731, 0x8226, 0xc2b2
+    dw 0x05b7, 0x8280, 0x0336, 0xba3b
+    dw 0x05b8, 0xd1d2, 0x99ed, 0x73dc
+    dw 0x05b9, 0x83bf, 0x0181, 0xc0fb
+    dw 0x05ba, 0x8a38, 0x87a8, 0x3e7f
+    dw 0x05bb, 0x81cb, 0x829e, 0x397b
+    dw 0x05bc, 0x826c, 0x4ff9, 0x8013
+    dw 0x05bd, 0x810c, 0x8144, 0x3a9e
+    dw 0x05be, 0x80a7, 0x8144, 0x3820
+    dw 0x05bf, 0x83c3, 0x00d2, 0xc496
+    dw 0x05c0, 0x4347, 0xed31, 0x919b
+    dw 0x05c1, 0x001c, 0x00af, 0x311f
+    dw 0x05c2, 0xcbd1, 0x8046, 0x7c00
+    dw 0x05c3, 0x5db6, 0x8071, 0xfc00
+    dw 0x05c4, 0x031f, 0x835a, 0xbb73
+    dw 0x05c5, 0x825b, 0x017b, 0xbe5d
+    dw 0x05c6, 0x82f5, 0x0160, 0xc04d
+    dw 0x05c7, 0x8196, 0x7506, 0x8000
+    dw 0x05c8, 0x02cb, 0x014f, 0x4045
+    dw 0x05c9, 0x01d2, 0x007b, 0x4394
+    dw 0x05ca, 0x82ac, 0xafaf, 0x0d90
+    dw 0x05cb, 0x009e, 0x012c, 0x3837
+    dw 0x05cc, 0x0316, 0x0111, 0x41ca
+    dw 0x05cd, 0x036a, 0x0032, 0x4c5f
+    dw 0x05ce, 0xa849, 0x03c9, 0xe087
+    dw 0x05cf, 0x8325, 0x047f, 0xb998
+    dw 0x05d0, 0x83ff, 0xdd86, 0x0003
+    dw 0x05d1, 0x5d38, 0x00f3, 0x7c00
+    dw 0x05d2, 0xa203, 0xdfc4, 0x018c
+    dw 0x05d3, 0x02de, 0x831f, 0xbb59
+    dw 0x05d4, 0x00f5, 0x0032, 0x44e6
+    dw 0x05d5, 0xcba8, 0x83a8, 0x7c00
+    dw 0x05d6, 0x9512, 0x8091, 0x587a
+    dw 0x05d7, 0x023c, 0x039a, 0x38f7
+    dw 0x05d8, 0x81e7, 0x02cd, 0xb96f
+    dw 0x05d9, 0x8124, 0x828d, 0x3728
+    dw 0x05da, 0x721c, 0x2ed8, 0x7c00
+    dw 0x05db, 0xe601, 0x0023, 0xfc00
+    dw 0x05dc, 0x0077, 0x81ae, 0xb46e
+    dw 0x05dd, 0x2abc, 0x0025, 0x75d3
+    dw 0x05de, 0xab94, 0x83cb, 0x63fe
+    dw 0x05df, 0x0305, 0x0397, 0x3abb
+    dw 0x05e0, 0xd0a4, 0x00af, 0xfc00
+    dw 0x05e1, 0x84f6, 0x82f4, 0x3eb8
+    dw 0x05e2, 0x808f, 0x8378, 0x3127
+    dw 0x05e3, 0x8197, 0x82b0, 0x38bc
+    dw 0x05e4, 0x0eb4, 0x82ff, 0xc879
+    dw 0x05e5, 0x80e4, 0x036d, 0xb429
+    dw 0x05e6, 0xa145, 0x0307, 0xdaf6
+    dw 0x05e7, 0xa3d7, 0x836e, 0x5c92
+    dw 0x05e8, 0x4110, 0x8065, 0xfc00
+    dw 0x05e9, 0xa3f9, 0x03c9, 0xdc36
+    dw 0x05ea, 0x0124, 0x01f9, 0x38a0
+    dw 0x05eb, 0x028c, 0x812b, 0xc05c
+    dw 0x05ec, 0x030c, 0x0060, 0x4810
+    dw 0x05ed, 0x8122, 0x95bc, 0x2252
+    dw 0x05ee, 0xcf3a, 0x0342, 0xfc00
+    dw 0x05ef, 0xd497, 0x8323, 0x7c00
+    dw 0x05f0, 0xb699, 0xceb1, 0x23e3
+    dw 0x05f1, 0x0044, 0x8355, 0xad1a
+    dw 0x05f2, 0x01c3, 0x0334, 0x3866
+    dw 0x05f3, 0x821c, 0x8363, 0x38fc
+    dw 0x05f4, 0x6a29, 0x015a, 0x7c00
+    dw 0x05f5, 0x31c8, 0x02db, 0x6c0d
+    dw 0x05f6, 0x42cb, 0x03ba, 0x7b4b
+    dw 0x05f7, 0x014c, 0x822b, 0xb8c9
+    dw 0x05f8, 0x0356, 0x2240, 0x1c45
+    dw 0x05f9, 0x00ee, 0x40a7, 0x0066
+    dw 0x05fa, 0x8084, 0x0066, 0xbd2d
+    dw 0x05fb, 0x8361, 0x0273, 0xbd85
+    dw 0x05fc, 0x79ac, 0x8036, 0xfc00
+    dw 0x05fd, 0x8026, 0x02bc, 0xaaf3
+    dw 0x05fe, 0x8235, 0x03a2, 0xb8dc
+    dw 0x05ff, 0x0228, 0x0174, 0x3def
+    dw 0x0600, 0x0060, 0x6df1, 0x0000
+    dw 0x0601, 0x019d, 0x8053, 0xc4fa
+    dw 0x0602, 0xf169, 0x03ef, 0xfc00
+    dw 0x0603, 0x81cb, 0x655f, 0x8000
+    dw 0x0604, 0x8063, 0x832d, 0x2fcb
+    dw 0x0605, 0xe52e, 0x83de, 0x7c00
+    dw 0x0606, 0x811b, 0x834b, 0x355f
+    dw 0x0607, 0x8228, 0x02d0, 0xba22
+    dw 0x0608, 0x8033, 0x81aa, 0x2fa9
+    dw 0x0609, 0x01a5, 0x80b2, 0xc0bb
+    dw 0x060a, 0x80b6, 0x7554, 0x8000
+    dw 0x060b, 0x80eb, 0x800e, 0x4c32
+    dw 0x060c, 0x82a3, 0x0168, 0xbf80
+    dw 0x060d, 0x013c, 0x29b3, 0x0eee
+    dw 0x060e, 0x00a2, 0x800f, 0xc966
+    dw 0x060f, 0x032c, 0x8274, 0xbd2c
+    dw 0x0610, 0xc0cb, 0x01fe, 0xfc00
+    dw 0x0611, 0x005e, 0xe5a7, 0x8000
+    dw 0x0612, 0x00d7, 0x031c, 0x3452
+    dw 0x0613, 0x01ba, 0x0134, 0x3dbe
+    dw 0x0614, 0x020e, 0xc3b0, 0x8089
+    dw 0x0615, 0x8162, 0x9991, 0x1ff3
+    dw 0x0616, 0x81f0, 0x830a, 0x391a
+    dw 0x0617, 0x8174, 0x828d, 0x388f
+    dw 0x0618, 0x432d, 0x02d4, 0x7c00
+    dw 0x0619, 0x824c, 0x8125, 0x4003
+    dw 0x061a, 0x8335, 0x0369, 0xbb86
+    dw 0x061b, 0x005c, 0x827f, 0xb09b
+    dw 0x061c, 0x81af, 0x81f7, 0x3adb
+    dw 0x061d, 0x81c5, 0xc72c, 0x003f
+    dw 0x061e, 0x82d5, 0xdaf9, 0x0003
+    dw 0x061f, 0x0386, 0x0228, 0x3e89
+    dw 0x0620, 0x012f, 0x42ee, 0x0057
+    dw 0x0621, 0x85c0, 0x8204, 0x41b5
+    dw 0x0622, 0x82eb, 0x81c3, 0x3ea0
+    dw 0x0623, 0x0246, 0x8385, 0xb92b
+    dw 0x0624, 0x8205, 0x803c, 0x484f
+    dw 0x0625, 0x62f2, 0x60fd, 0x3d92
+    dw 0x0626, 0x0365, 0x8332, 0xbc40
+    dw 0x0627, 0x83a0, 0xfb15, 0x0000
+    dw 0x0628, 0xccdd, 0x9da1, 0x6ae9
+    dw 0x0629, 0x8315, 0xbfde, 0x0191
+    dw 0x062a, 0xdf3c, 0x82c5, 0x7c00
+    dw 0x062b, 0x80b6, 0x81d5, 0x3635
+    dw 0x062c, 0x008e, 0x8361, 0xb141
+    dw 0x062d, 0x0314, 0x001c, 0x4f09
+    dw 0x062e, 0x01ff, 0x9cde, 0x9e90
+    dw 0x062f, 0xc0bc, 0x00cd, 0xfc00
+    dw 0x0630, 0x2697, 0x2cf7, 0x354f
+    dw 0x0631, 0x83f2, 0x0337, 0xbce9
+    dw 0x0632, 0x00ad, 0x01d8, 0x35dd
+    dw 0x0633, 0x130c, 0x83d0, 0xcb65
+    dw 0x0634, 0x0379, 0x8154, 0xc13b
+    dw 0x0635, 0x8276, 0x0160, 0xbf29
+    dw 0x0636, 0x8203, 0x8365, 0x38be
+    dw 0x0637, 0x031e, 0x006f, 0x4730
+    dw 0x0638, 0x004d, 0x0289, 0x2f98
+    dw 0x0639, 0x8105, 0x0199, 0xb91b
+    dw 0x063a, 0x8034, 0x80dc, 0x3390
+    dw 0x063b, 0x0189, 0x0372, 0x3721
+    dw 0x063c, 0x8226, 0x8303, 0x39b5
+    dw 0x063d, 0xa609, 0x817a, 0x6416
+    dw 0x063e, 0x8215, 0x8041, 0x481a
+    dw 0x063f, 0x759a, 0x8392, 0xfc00
+    dw 0x0640, 0x81a8, 0x022f, 0xba11
+    dw 0x0641, 0x802d, 0x8045, 0x3938
+    dw 0x0642, 0x037b, 0x01bc, 0x4003
+    dw 0x0643, 0x00a0, 0x037b, 0x31bf
+    dw 0x0644, 0x8229, 0x8195, 0x3d76
+    dw 0x0645, 0x0231, 0x001d, 0x4cd6
+    dw 0x0646, 0x00e3, 0x014e, 0x3970
+    dw 0x0647, 0x287c, 0x022b, 0x6423
+    dw 0x0648, 0xf069, 0x03e3, 0xfc00
+    dw 0x0649, 0x83a1, 0xdc96, 0x0003
+    dw 0x064a, 0x029e, 0x0016, 0x4f9d
+    dw 0x064b, 0x8328, 0x00e9, 0xc2f0
+    dw 0x064c, 0x02c9, 0x82b1, 0xbc24
+    dw 0x064d, 0x12e4, 0x8043, 0xda95
+    dw 0x064e, 0x0090, 0x00dd, 0x3936
+    dw 0x064f, 0x02d6, 0x8127, 0xc0ec
+    dw 0x0650, 0x007e, 0x11fc, 0x2144
+    dw 0x0651, 0x02f5, 0xf652, 0x8000
+    dw 0x0652, 0x5781, 0x81bb, 0xfc00
+    dw 0x0653, 0x804e, 0x81d2, 0x315b
+    dw 0x0654, 0x007e, 0x0170, 0x357a
+    dw 0x0655, 0x0077, 0x8274, 0xb210
+    dw 0x0656, 0x0377, 0x0282, 0x3d87
+    dw 0x0657, 0x034e, 0x822e, 0xbe11
+    dw 0x0658, 0x1819, 0x00f5, 0x5848
+    dw 0x0659, 0x0379, 0x0350, 0x3c32
+    dw 0x065a, 0x389a, 0xbdf7, 0xb62c
+    dw 0x065b, 0x8190, 0x5cff, 0x8001
+    dw 0x065c, 0xc6ec, 0x43a9, 0xbf3b
+    dw 0x065d, 0x004a, 0x036b, 0x2d6a
+    dw 0x065e, 0x8245, 0xba79, 0x02ce
+    dw 0x065f, 0x810f, 0x0093, 0xbf60
+    dw 0x0660, 0x0048, 0x025b, 0x2fa4
+    dw 0x0661, 0x81e8, 0xa189, 0x1983
+    dw 0x0662, 0x0257, 0x017a, 0x3e57
+    dw 0x0663, 0x013d, 0x801c, 0xc9a9
+    dw 0x0664, 0xa81a, 0x03d6, 0xe047
+    dw 0x0665, 0x1951, 0x0286, 0x5437
+    dw 0x0666, 0x83c9, 0x81d4, 0x4024
+    dw 0x0667, 0x00af, 0x82fa, 0xb359
+    dw 0x0668, 0x9f83, 0x80d3, 0x608f
+    dw 0x0669, 0x010e, 0x82fb, 0xb5a9
+    dw 0x066a, 0x6989, 0x02b6, 0x7c00
+    dw 0x066b, 0x0363, 0x0358, 0x3c0d
+    dw 0x066c, 0x5a57, 0x83c9, 0xfc00
+    dw 0x066d, 0x83d1, 0x806b, 0x4891
+    dw 0x066e, 0x810a, 0x816e, 0x39d0
+    dw 0x066f, 0x8126, 0x01c0, 0xb940
+    dw 0x0670, 0x0103, 0x80ec, 0xbc64
+    dw 0x0671, 0x83c3, 0x4165, 0x8165
+    dw 0x0672, 0xd540, 0xbb6c, 0x55a9
+    dw 0x0673, 0x03da, 0x01df, 0x401e
+    dw 0x0674, 0x805a, 0x02a3, 0xb044
+    dw 0x0675, 0x8277, 0x8067, 0x4620
+    dw 0x0676, 0xcaaf, 0x0222, 0xfc00
+    dw 0x0677, 0x0387, 0x83bf, 0xbb88
+    dw 0x0678, 0x0297, 0x8023, 0xccbc
+    dw 0x0679, 0x03e7, 0x9e40, 0xa0ff
+    dw 0x067a, 0x1f9f, 0x03d8, 0x57ee
+    dw 0x067b, 0x02a4, 0x0263, 0x3c6d
+    dw 0x067c, 0x8174, 0xc4d6, 0x004d
+    dw 0x067d, 0x818d, 0x823d, 0x398b
+    dw 0x067e, 0x53bc, 0x8074, 0xfc00
+    dw 0x067f, 0x00ea, 0x84ba, 0xb230
+    dw 0x0680, 0x816b, 0x013b, 0xbc9c
+    dw 0x0681, 0x6db2, 0x0018, 0x7c00
+    dw 0x0682, 0x8175, 0x023b, 0xb93a
+    dw 0x0683, 0x6d37, 0xf58a, 0xb388
+    dw 0x0684, 0x0121, 0x8320, 0xb5c8
+
+    ; Rounding ties
+    dw 0x0685, 0xbb72, 0x7800, 0x81dc
+    dw 0x0686, 0xb82b, 0x7400, 0x8216
+    dw 0x0687, 0x3e6f, 0xf800, 0x8338
+    dw 0x0688, 0x09e1, 0x4400, 0x02f0
+    dw 0x0689, 0x3ce3, 0x7800, 0x0272
+    dw 0x068a, 0xa554, 0x6800, 0x80aa
+    dw 0x068b, 0xa707, 0x6000, 0x8384
+    dw 0x068c, 0x1d9c, 0x6000, 0x00b4
+    dw 0x068d, 0x3422, 0xf400, 0x8108
+    dw 0x068e, 0x3dd7, 0xf800, 0x82ec
+    dw 0x068f, 0x89fc, 0x4c00, 0x80c0
+    dw 0x0690, 0x96b5, 0xd000, 0x035a
+    dw 0x0691, 0x0d76, 0x4c00, 0x015e
+    dw 0x0692, 0x382a, 0x7800, 0x010a
+    dw 0x0693, 0x3d8d, 0xf800, 0x82c6
+    dw 0x0694, 0xa7d8, 0xec00, 0x007e
+    dw 0x0695, 0xb932, 0x7800, 0x814c
+    dw 0x0696, 0xb7f4, 0x7800, 0x80fe
+    dw 0x0697, 0xa2c7, 0xdc00, 0x0364
+    dw 0x0698, 0xb5fc, 0xf800, 0x00c0
+    dw 0x0699, 0xbc45, 0xf800, 0x0222
+    dw 0x069a, 0x38c7, 0x7400, 0x0264
+    dw 0x069b, 0x84c5, 0xc000, 0x0262
+    dw 0x069c, 0xacac, 0xf000, 0x0096
+    dw 0x069d, 0xbce5, 0xf800, 0x0272
+    dw 0x069e, 0xa98e, 0xe800, 0x0164
+    dw 0x069f, 0x8fa6, 0xcc00, 0x01ea
+    dw 0x06a0, 0x9462, 0xd400, 0x0118
+    dw 0x06a1, 0x9e94, 0xe000, 0x00d2
+    dw 0x06a2, 0x3a02, 0x7800, 0x0180
+    dw 0x06a3, 0x1b34, 0xdc00, 0x80e6
+    dw 0x06a4, 0x8aea, 0xc800, 0x01ba
+    dw 0x06a5, 0xbd6b, 0x7800, 0x82b6
+    dw 0x06a6, 0x2a28, 0xf000, 0x8062
+    dw 0x06a7, 0xb02e, 0xf000, 0x010c
+    dw 0x06a8, 0xaa1c, 0x6c00, 0x80c4
+    dw 0x06a9, 0x3094, 0x7400, 0x0092
+    dw 0x06aa, 0x15bd, 0xd000, 0x82de
+    dw 0x06ab, 0x3ad2, 0xf800, 0x81b4
+    dw 0x06ac, 0x2389, 0x5c00, 0x03c4
+    dw 0x06ad, 0x3eef, 0xf800, 0x8378
+    dw 0x06ae, 0x2e6f, 0xe800, 0x8338
+    dw 0x06af, 0x3158, 0xf800, 0x8056
+    dw 0x06b0, 0x35bc, 0x7800, 0x00b8
+    dw 0x06b1, 0xa1fe, 0xe000, 0x0180
+    dw 0x06b2, 0x8dcf, 0xc800, 0x02e8
+    dw 0x06b3, 0xb8d2, 0xf800, 0x0134
+    dw 0x06b4, 0x32b8, 0xf800, 0x806c
+    dw 0x06b5, 0x37fc, 0xf800, 0x8100
+    dw 0x06b6, 0xb326, 0xf000, 0x01ca
+    dw 0x06b7, 0x961c, 0x5800, 0x80c4
+    dw 0x06b8, 0x3d17, 0x7800, 0x028c
+    dw 0x06b9, 0xac68, 0xf400, 0x0046
+    dw 0x06ba, 0x16d1, 0x5000, 0x0368
+    dw 0x06bb, 0x3bd2, 0x7800, 0x01f4
+    dw 0x06bc, 0xbc47, 0x7800, 0x8224
+    dw 0x06bd, 0x0fac, 0xd000, 0x80f6
+    dw 0x06be, 0xb82e, 0x7800, 0x810c
+    dw 0x06bf, 0xbcd1, 0x7800, 0x8268
+    dw 0x06c0, 0x1096, 0x5000, 0x0126
+    dw 0x06c1, 0x350c, 0xf800, 0x80a2
+    dw 0x06c2, 0x878d, 0x4000, 0x83c6
+    dw 0x06c3, 0xb966, 0xf800, 0x015a
+    dw 0x06c4, 0x0a39, 0xc400, 0x831c
+    dw 0x06c5, 0x3148, 0xf800, 0x8054
+    dw 0x06c6, 0x3f77, 0xf800, 0x83bc
+    dw 0x06c7, 0xa509, 0x6000, 0x8284
+    dw 0x06c8, 0xbe6b, 0x7800, 0x8336
+    dw 0x06c9, 0x37d4, 0x7800, 0x00fa
+    dw 0x06ca, 0xb91a, 0xf800, 0x0146
+    dw 0x06cb, 0x37c4, 0x7800, 0x00f8
+    dw 0x06cc, 0xba66, 0x7800, 0x819a
+    dw 0x06cd, 0x966d, 0xd000, 0x0336
+    dw 0x06ce, 0x15b6, 0xd400, 0x816e
+    dw 0x06cf, 0x9bc3, 0xd400, 0x03e2
+    dw 0x06d0, 0x8e33, 0x4800, 0x831a
+    dw 0x06d1, 0xa986, 0xe800, 0x0162
+    dw 0x06d2, 0xaaa0, 0x7800, 0x801a
+    dw 0x06d3, 0xad67, 0xe800, 0x02b4
+    dw 0x06d4, 0x3ebd, 0x7800, 0x035e
+    dw 0x06d5, 0xa2e2, 0xe000, 0x01b8
+    dw 0x06d6, 0xbda9, 0xf800, 0x02d4
+    dw 0x06d7, 0xbf5d, 0xf800, 0x03ae
+    dw 0x06d8, 0x914c, 0xd400, 0x00aa
+    dw 0x06d9, 0xb1c8, 0xf800, 0x005c
+    dw 0x06da, 0xac71, 0xe800, 0x0238
+    dw 0x06db, 0xbf9b, 0xf800, 0x03ce
+    dw 0x06dc, 0x8a9f, 0x4400, 0x8350
+    dw 0x06dd, 0x185a, 0xd800, 0x8116
+    dw 0x06de, 0x13a4, 0x5400, 0x00f4
+    dw 0x06df, 0x93fc, 0xd400, 0x0100
+    dw 0x06e0, 0x331d, 0x6c00, 0x038e
+    dw 0x06e1, 0x3d83, 0x7800, 0x02c2
+    dw 0x06e2, 0xb235, 0x6c00, 0x831a
+    dw 0x06e3, 0x3d69, 0x7800, 0x02b4
+    dw 0x06e4, 0x9850, 0x6400, 0x8022
+    dw 0x06e5, 0x3238, 0x7800, 0x0064
+    dw 0x06e6, 0x3d81, 0x7800, 0x02c0
+    dw 0x06e7, 0xb9e6, 0x7800, 0x817a
+    dw 0x06e8, 0xbaea, 0xf800, 0x01ba
+    dw 0x06e9, 0x2fd2, 0x6c00, 0x01f4
+    dw 0x06ea, 0xbffb, 0xf800, 0x03fe
+    dw 0x06eb, 0x270b, 0x6000, 0x0386
+    dw 0x06ec, 0x917a, 0x5000, 0x815e
+    dw 0x06ed, 0xa750, 0x7000, 0x803a
+    dw 0x06ee, 0x31dc, 0xf400, 0x80bc
+    dw 0x06ef, 0xb4ec, 0xf800, 0x009e
+    dw 0x06f0, 0xb16a, 0x7000, 0x815a
+    dw 0x06f1, 0x9d6b, 0x5800, 0x82b6
+    dw 0x06f2, 0x3ce9, 0x7800, 0x0274
+    dw 0x06f3, 0x3ced, 0xf800, 0x8276
+    dw 0x06f4, 0x9134, 0xd400, 0x00a6
+    dw 0x06f5, 0xbff9, 0xf800, 0x03fc
+    dw 0x06f6, 0x860d, 0xc000, 0x0306
+    dw 0x06f7, 0xb358, 0xf800, 0x0076
+    dw 0x06f8, 0xbcab, 0x7800, 0x8256
+    dw 0x06f9, 0x39fe, 0x7800, 0x0180
+    dw 0x06fa, 0x2a20, 0x7800, 0x0018
+    dw 0x06fb, 0xa372, 0xe000, 0x01dc
+    dw 0x06fc, 0x3b12, 0x7800, 0x01c4
+    dw 0x06fd, 0x84f4, 0x4800, 0x809e
+    dw 0x06fe, 0x1e3f, 0x5800, 0x0320
+    dw 0x06ff, 0x8b84, 0xcc00, 0x00f0
+    dw 0x0700, 0x3d0d, 0xf800, 0x8286
+    dw 0x0701, 0x0889, 0x4400, 0x0244
+    dw 0x0702, 0x2705, 0xe000, 0x8382
+    dw 0x0703, 0xbe8f, 0x7800, 0x8348
+    dw 0x0704, 0xb1f5, 0x6c00, 0x82fa
+    dw 0x0705, 0xbdb3, 0xf800, 0x02da
+    dw 0x0706, 0xa9df, 0xe400, 0x02f0
+    dw 0x0707, 0xbcdd, 0xf800, 0x026e
+    dw 0x0708, 0x353d, 0x7000, 0x029e
+    dw 0x0709, 0xb7bc, 0x7800, 0x80f8
+    dw 0x070a, 0x3802, 0xf800, 0x8100
+    dw 0x070b, 0xba9a, 0x7800, 0x81a6
+    dw 0x070c, 0x3e6d, 0x7800, 0x0336
+    dw 0x070d, 0x116a, 0x5000, 0x015a
+    dw 0x070e, 0xb44c, 0x7800, 0x808a
+    dw 0x070f, 0xa1a4, 0x6400, 0x80b4
+    dw 0x0710, 0x2325, 0x5c00, 0x0392
+    dw 0x0711, 0x25a4, 0xe800, 0x80b4
+    dw 0x0712, 0xad7d, 0x6800, 0x82be
+    dw 0x0713, 0x1df0, 0x6800, 0x0030
+    dw 0x0714, 0x1c29, 0xd800, 0x8214
+    dw 0x0715, 0x26f3, 0xe000, 0x837a
+    dw 0x0716, 0x25d0, 0x7000, 0x002e
+    dw 0x0717, 0x9a44, 0x5c00, 0x80c8
+    dw 0x0718, 0x88c8, 0xd000, 0x004c
+    dw 0x0719, 0xb331, 0xec00, 0x0398
+    dw 0x071a, 0xad11, 0xe800, 0x0288
+    dw 0x071b, 0x2c01, 0x6800, 0x0200
+    dw 0x071c, 0xbc7b, 0xf800, 0x023e
+    dw 0x071d, 0x0e00, 0xec00, 0x8002
+    dw 0x071e, 0xbbd5, 0x7400, 0x83ea
+    dw 0x071f, 0xa4b3, 0xe000, 0x025a
+    dw 0x0720, 0x3ed5, 0x7800, 0x036a
+    dw 0x0721, 0x1ee9, 0xd800, 0x8374
+    dw 0x0722, 0x1b81, 0xd400, 0x83c0
+    dw 0x0723, 0x356c, 0x7800, 0x00ae
+    dw 0x0724, 0x3fdd, 0x7800, 0x03ee
+    dw 0x0725, 0xba41, 0x7400, 0x8320
+    dw 0x0726, 0x3c2b, 0x7800, 0x0216
+    dw 0x0727, 0xb369, 0xec00, 0x03b4
+    dw 0x0728, 0xb642, 0xf400, 0x0190
+    dw 0x0729, 0xb28f, 0xec00, 0x0348
+    dw 0x072a, 0x0429, 0xc000, 0x8214
+    dw 0x072b, 0xa28f, 0x5c00, 0x8348
+    dw 0x072c, 0x9540, 0x6800, 0x800a
+    dw 0x072d, 0x38de, 0x7800, 0x0138
+    dw 0x072e, 0x9a06, 0xd800, 0x0182
+    dw 0x072f, 0x0961, 0x4400, 0x02b0
+    dw 0x0730, 0xa27e, 0x6000, 0x81a0
+    dw 0x0731, 0x1069, 0x4c00, 0x0234
+    dw 0x0732, 0x17c1, 0xd000, 0x83e0
+    dw 0x0733, 0x90c3, 0xcc00, 0x0262
+    dw 0x0734, 0x8415, 0xc000, 0x020a
+    dw 0x0735, 0xbc75, 0x7800, 0x823a
+    dw 0x0736, 0xb714, 0xf800, 0x00e2
+    dw 0x0737, 0xb6ca, 0x7400, 0x81b2
+    dw 0x0738, 0x9613, 0x5000, 0x830a
+    dw 0x0739, 0x3469, 0x7000, 0x0234
+    dw 0x073a, 0x22fc, 0xe400, 0x80e0
+    dw 0x073b, 0x39e2, 0x7800, 0x0178
+    dw 0x073c, 0xbfbb, 0xf800, 0x03de
+    dw 0x073d, 0x2c3d, 0x6800, 0x021e
+    dw 0x073e, 0x08bf, 0xc400, 0x8260
+    dw 0x073f, 0xa3df, 0xdc00, 0x03f0
+    dw 0x0740, 0x0d99, 0x4800, 0x02cc
+    dw 0x0741, 0xbfe7, 0x7800, 0x83f4
+    dw 0x0742, 0x35bf, 0x7000, 0x02e0
+    dw 0x0743, 0xbfab, 0x7800, 0x83d6
+    dw 0x0744, 0x0af3, 0x4400, 0x037a
+    dw 0x0745, 0x166f, 0xd000, 0x8338
+    dw 0x0746, 0x2ce3, 0xe800, 0x8272
+    dw 0x0747, 0xbf0b, 0x7800, 0x8386
+    dw 0x0748, 0x0f9a, 0xcc00, 0x81e6
+    dw 0x0749, 0x1f66, 0x5c00, 0x01da
+    dw 0x074a, 0x3cb9, 0x7800, 0x025c
+    dw 0x074b, 0x94f3, 0x5000, 0x827a
+    dw 0x074c, 0xb0c8, 0x7800, 0x804c
+    dw 0x074d, 0xbee3, 0xf800, 0x0372
+    dw 0x074e, 0x31af, 0x6c00, 0x02d8
+    dw 0x074f, 0x9d00, 0xf800, 0x0002
+    dw 0x0750, 0x3e67, 0x7800, 0x0334
+    dw 0x0751, 0x1687, 0x5000, 0x0344
+    dw 0x0752, 0x0ca2, 0x4c00, 0x0128
+    dw 0x0753, 0x26c8, 0xec00, 0x806c
+    dw 0x0754, 0xbc93, 0x7800, 0x824a
+    dw 0x0755, 0x3b32, 0xf800, 0x81cc
+    dw 0x0756, 0xbc93, 0x7800, 0x824a
+    dw 0x0757, 0xb258, 0x7800, 0x8066
+    dw 0x0758, 0x3e35, 0x7800, 0x031a
+    dw 0x0759, 0x2430, 0x7000, 0x0022
+    dw 0x075a, 0xb4c2, 0xf400, 0x0130
+    dw 0x075b, 0x3e79, 0x7800, 0x033c
+    dw 0x075c, 0x12c9, 0x4c00, 0x0364
+    dw 0x075d, 0xa103, 0x5c00, 0x8282
+    dw 0x075e, 0x3ca1, 0xf800, 0x8250
+    dw 0x075f, 0xbf21, 0xf800, 0x0390
+    dw 0x0760, 0x398a, 0x7800, 0x0162
+    dw 0x0761, 0xb208, 0x7800, 0x8060
+    dw 0x0762, 0x9cc3, 0xd800, 0x0262
+    dw 0x0763, 0x3de7, 0x7800, 0x02f4
+    dw 0x0764, 0x2ca3, 0xe800, 0x8252
+    dw 0x0765, 0x313f, 0x6c00, 0x02a0
+    dw 0x0766, 0xb5f2, 0xf400, 0x017c
+    dw 0x0767, 0xae98, 0x7400, 0x806a
+    dw 0x0768, 0x1b59, 0x5400, 0x03ac
+    dw 0x0769, 0x1077, 0x4c00, 0x023c
+    dw 0x076a, 0x1f99, 0xd800, 0x83cc
+    dw 0x076b, 0xb813, 0xf400, 0x020a
+    dw 0x076c, 0x352d, 0xf000, 0x8296
+    dw 0x076d, 0xb695, 0x7000, 0x834a
+    dw 0x076e, 0x34c1, 0x7000, 0x0260
+    dw 0x076f, 0x85c2, 0x4400, 0x8170
+    dw 0x0770, 0x390a, 0xf800, 0x8142
+    dw 0x0771, 0x9120, 0x6000, 0x8014
+    dw 0x0772, 0x0da7, 0x4800, 0x02d4
+    dw 0x0773, 0xbd69, 0xf800, 0x02b4
+    dw 0x0774, 0x3cf5, 0x7800, 0x027a
+    dw 0x0775, 0xbfdb, 0xf800, 0x03ee
+    dw 0x0776, 0x9782, 0x5400, 0x81e0
+    dw 0x0777, 0x06e3, 0x4000, 0x0372
+    dw 0x0778, 0xa0b9, 0xdc00, 0x025c
+    dw 0x0779, 0x1202, 0xd000, 0x8180
+    dw 0x077a, 0x8dc2, 0x4c00, 0x8170
+    dw 0x077b, 0xb8e2, 0xf800, 0x0138
+    dw 0x077c, 0x3712, 0x7400, 0x01c4
+    dw 0x077d, 0x3aee, 0x7800, 0x01bc
+    dw 0x077e, 0xb3f8, 0x7800, 0x8080
+    dw 0x077f, 0x3182, 0x7000, 0x0160
+    dw 0x0780, 0x3fb5, 0x7800, 0x03da
+    dw 0x0781, 0x8a76, 0xc800, 0x019e
+    dw 0x0782, 0x8b8d, 0xc400, 0x03c6
+    dw 0x0783, 0x106a, 0x5000, 0x011a
+    dw 0x0784, 0x8800, 0xec00, 0x0000
+    dw 0x0785, 0x90d5, 0xcc00, 0x026a
+    dw 0x0786, 0xbd9f, 0xf800, 0x02d0
+    dw 0x0787, 0x3cfb, 0x7800, 0x027e
+    dw 0x0788, 0x9e9a, 0x5c00, 0x81a6
+    dw 0x0789, 0x3ade, 0x7800, 0x01b8
+    dw 0x078a, 0x95be, 0xd400, 0x0170
+    dw 0x078b, 0x299d, 0xe400, 0x82ce
+    dw 0x078c, 0xbcf5, 0xf800, 0x027a
+    dw 0x078d, 0x8843, 0xc400, 0x0222
+    dw 0x078e, 0xbd71, 0x7800, 0x82b8
+    dw 0x078f, 0xbbca, 0xf800, 0x01f2
+    dw 0x0790, 0x34f9, 0xf000, 0x827c
+    dw 0x0791, 0x1e52, 0xdc00, 0x8194
+    dw 0x0792, 0xb338, 0x7800, 0x8074
+    dw 0x0793, 0x9106, 0xd000, 0x0142
+    dw 0x0794, 0x15a2, 0xd400, 0x8168
+    dw 0x0795, 0x305c, 0xf400, 0x808c
+    dw 0x0796, 0x3654, 0xf800, 0x80ca
+    dw 0x0797, 0xb734, 0xf800, 0x00e6
+    dw 0x0798, 0xb745, 0x7000, 0x83a2
+    dw 0x0799, 0x8633, 0x4000, 0x831a
+    dw 0x079a, 0xbb3d, 0x7400, 0x839e
+    dw 0x079b, 0x3fa3, 0xf800, 0x83d2
+    dw 0x079c, 0xa133, 0x5c00, 0x829a
+    dw 0x079d, 0xb875, 0x7400, 0x823a
+    dw 0x079e, 0xbca1, 0x7800, 0x8250
+    dw 0x079f, 0x95f7, 0xd000, 0x02fc
+    dw 0x07a0, 0xb2d4, 0xf400, 0x00da
+    dw 0x07a1, 0xba61, 0xf400, 0x0330
+    dw 0x07a2, 0xb2d8, 0x7800, 0x806e
+    dw 0x07a3, 0x12d9, 0x4c00, 0x036c
+    dw 0x07a4, 0xbbde, 0xf800, 0x01f8
+    dw 0x07a5, 0xbe99, 0x7800, 0x834c
+    dw 0x07a6, 0x21d8, 0x6800, 0x005e
+    dw 0x07a7, 0x8b4d, 0xc400, 0x03a6
+    dw 0x07a8, 0x9896, 0xd800, 0x0126
+    dw 0x07a9, 0x3e21, 0xf800, 0x8310
+    dw 0x07aa, 0xa53e, 0x6400, 0x8150
+    dw 0x07ab, 0x17f0, 0x6000, 0x0040
+    dw 0x07ac, 0xbd5b, 0xf800, 0x02ae
+    dw 0x07ad, 0x98a7, 0x5400, 0x8254
+    dw 0x07ae, 0x3c35, 0xf800, 0x821a
+    dw 0x07af, 0x3388, 0xf800, 0x8078
+    dw 0x07b0, 0x3704, 0xf800, 0x80e0
+    dw 0x07b1, 0x2fdf, 0xe800, 0x83f0
+    dw 0x07b2, 0x0cb0, 0x5800, 0x0026
+    dw 0x07b3, 0x0671, 0x4000, 0x0338
+    dw 0x07b4, 0x3e51, 0x7800, 0x0328
+    dw 0x07b5, 0x0f81, 0xc800, 0x83c0
+    dw 0x07b6, 0x1070, 0x5c00, 0x0024
+    dw 0x07b7, 0x3c6f, 0x7800, 0x0238
+    dw 0x07b8, 0x8852, 0xc800, 0x0114
+    dw 0x07b9, 0x9913, 0xd400, 0x028a
+    dw 0x07ba, 0xbfe5, 0x7800, 0x83f2
+    dw 0x07bb, 0x3e03, 0xf800, 0x8302
+    dw 0x07bc, 0x88ab, 0x4400, 0x8256
+    dw 0x07bd, 0x9dff, 0xd800, 0x0300
+    dw 0x07be, 0xac5e, 0x6c00, 0x8118
+    dw 0x07bf, 0x3f5d, 0x7800, 0x03ae
+    dw 0x07c0, 0x1e06, 0x5c00, 0x0182
+    dw 0x07c1, 0xbce7, 0x7800, 0x8274
+    dw 0x07c2, 0x0801, 0x4400, 0x0200
+    dw 0x07c3, 0xbf3b, 0x7800, 0x839e
+    dw 0x07c4, 0x3f8b, 0xf800, 0x83c6
+    dw 0x07c5, 0xaddc, 0xf000, 0x00bc
+    dw 0x07c6, 0xbad7, 0xf400, 0x036c
+    dw 0x07c7, 0x363c, 0xf800, 0x80c8
+    dw 0x07c8, 0xae64, 0x7000, 0x80cc
+    dw 0x07c9, 0x9247, 0x4c00, 0x8324
+    dw 0x07ca, 0x2f7f, 0xe800, 0x83c0
+    dw 0x07cb, 0x3378, 0xf800, 0x8078
+    dw 0x07cc, 0x1633, 0xd000, 0x831a
+    dw 0x07cd, 0x99ff, 0xd400, 0x0300
+    dw 0x07ce, 0xa62f, 0xe000, 0x0318
+    dw 0x07cf, 0xb118, 0xf800, 0x0052
 .unit_test_end
@@ -0,0 +1,375 @@
+;; Adapted from the softfloat library by John R Hauser.
+;; See https://github.com/ucb-bar/berkeley-softfloat-3
+
+; Requires f16_internal.asm
+
+; Computes a * b + c, rounded once.
+;
+; The product of the significands is exact in 22 bits, so it is added to c
+; as a 32-bit pair of words, and only the sum is normalised and rounded -
+; rather than the product as well, as .f16_mul then .f16_add would.
+;
+; Arguments
+;   r0: a
+;   r1: b
+;   r2: c
+;
+; Results
+;   r2: a * b + c; V=1 on NaN
+;
+.f16_fma {
+    alias r0 p_lo               ; once the product is formed
+    alias r1 c_lo
+    alias r5 a_exp
+    alias r6 b_exp
+    alias r7 c_exp
+    alias r8 c_hi
+    alias r9 p_hi
+    alias r10 c_sign
+
+    mov tmp, #.f16_sign_mask
+    mov z_sign, a
+    eor z_sign, b
+    and z_sign, tmp             ; sign of the product
+    mov c_sign, z
+    and c_sign, tmp
+
+    mov tmp, #.f16_sign_mask|.f16_exp_mask
+    mov a_exp, a                ; extract exponents
+    lsl a_exp, #1
+    lsr a_exp, #11
+    mov b_exp, b
+    lsl b_exp, #1
+    lsr b_exp, #11
+    mov c_exp, z
+    lsl c_exp, #1
+    lsr c_exp, #11
+    bic a, tmp                  ; isolate fractions
+    bic b, tmp
+    mov c_hi, z                 ; c is kept in z, to be returned as it is
+    bic c_hi, tmp
+
+    ; Less 1, the exponents of normal numbers are 0 to 29, unsigned;
+    ; anything else is handled by .unusual, which returns to .significands
+    ; for subnormals.
+    sub a_exp, #1
+    sub b_exp, #1
+    sub c_exp, #1
+    mov tmp, #30
+    cmp a_exp, tmp
+    prhs
+    bra .unusual
+    cmp b_exp, tmp
+    prhs
+    bra .unusual
+    cmp c_exp, tmp
+    prhs
+    bra .unusual
+
+    orr a, #0x400               ; make the leading 1s explicit
+    orr b, #0x400
+    orr c_hi, #0x400
+
+.significands
+    ; The product, as [p_hi:p_lo] * 2^(z_exp-44), with its leading 1 at
+    ; bit 28 or 29 of the pair, and c likewise as [c_hi:c_lo] * 2^(c_exp-44),
+    ; at bit 29 - leaving room for a carry
+    lsl a, #4
+    lsl b, #4
+    mov p_hi, a
+    muh p_hi, b
+    mul p_lo, b                 ; exact
+
+    mov z_exp, a_exp
+    add z_exp, b_exp
+    sub z_exp, #12
+    add c_exp, #1
+    lsl c_hi, #3
+
+    alias r7 shift
+    rsb shift, z_exp            ; shift = z_exp - c_exp
+    prlt
+    bra .c_larger
+
+{
+    ; Shift c right to align it with the product, into c_lo, which was 0;
+    ; and if it goes further, with any bits shifted out or-ed into its
+    ; lowest bit - c is then so much smaller that only whether it was
+    ; there at all can matter.
+    mov tmp, #16
+    cmp shift, tmp
+    prhs
+    bra .far
+
+    mov c_lo, c_hi
+    rsb shift, tmp
+    lsl c_lo, shift
+    rsb shift, tmp
+    lsr c_hi, shift
+    bra .aligned
+
+.far
+    sub shift, #16
+    mov c_lo, c_hi
+    lsr c_lo, shift
+    mov tmp, c_lo
+    lsl tmp, shift
+    cmp tmp, c_hi               ; any bits shifted out?
+    prne
+    orr c_lo, #bit 0
+    mov c_hi, #0
+
+.aligned
+    cmp z_sign, c_sign
+    prne
+    bra .subtract
+
+    add p_lo, c_lo
+    adc p_hi, c_hi              ; leading 1 at bit 28 to 30
+    bra .normalise
+
+.subtract
+    sub p_lo, c_lo
+    sbc p_hi, c_hi
+    bra .subtracted
+}
+
+.c_larger
+{
+    ; c's exponent is the greater, so it is the larger, the product's
+    ; leading 1 being no higher than c's: shift the product right to align
+    ; it, with any bits shifted out or-ed into its lowest bit.
+    alias r5 spill
+    alias r6 spill_test
+
+    sub z_exp, shift            ; c's exponent
+    mov tmp, #0
+    rsb shift, tmp              ; 1 or more
+    mov tmp, #16
+    cmp shift, tmp
+    prhs
+    bra .far
+
+    mov spill, p_lo
+    lsr p_lo, shift
+    mov spill_test, p_lo
+    lsl spill_test, shift
+    cmp spill_test, spill       ; any bits shifted out?
+    prne
+    orr p_lo, #bit 0
+    mov spill, p_hi             ; bits shifted into p_lo
+    rsb shift, tmp
+    lsl spill, shift
+    orr p_lo, spill
+    rsb shift, tmp
+    lsr p_hi, shift
+    bra .aligned
+
+.far
+    sub shift, #16
+    mov spill, p_hi
+    lsr spill, shift
+    mov spill_test, spill
+    lsl spill_test, shift
+    eor spill_test, p_hi        ; the bits shifted out of p_hi
+    orr spill_test, p_lo        ; and all of p_lo
+    mov p_lo, spill
+    mov p_hi, #0
+    and spill_test, spill_test
+    prne
+    orr p_lo, #bit 0
+
+.aligned
+    ; [p_hi:p_lo] = c +/- the product
+    cmp z_sign, c_sign
+    mov z_sign, c_sign          ; the result takes c's sign
+    prne
+    bra .subtract
+
+    add p_hi, c_hi              ; leading 1 at bit 29 or 30
+    bra .normalise
+
+.subtract
+    mov tmp, #0
+    rsb p_lo, tmp
+    rsc p_hi, c_hi
+}
+
+.subtracted
+    prcs
+    bra .positive
+
+    mov tmp, #0                 ; negate, and flip the result sign
+    rsb p_lo, tmp
+    rsc p_hi, tmp
+    eor z_sign, #.f16_sign_mask
+
+.positive
+    and p_hi, p_hi
+    prne
+    bra .normalise
+
+    ; after cancellation, which was exact
+    and p_lo, p_lo
+    preq
+    bra .f16_return_pos_zero
+    mov p_hi, p_lo
+    lsr p_hi, #1
+    lsl p_lo, #15
+    sub z_exp, #15
+
+.normalise
+{
+    ; Bring the leading 1 of [p_hi:p_lo] up to bit 14 of z, as
+    ; .f16_round_pack wants it, with any bits left over as a sticky bit
+    ; at the end of the retained bits.
+    alias r5 shift
+    alias r6 carry
+
+    clz shift, p_hi
+    sub shift, #1
+    sub z_exp, shift
+    mov z, p_hi
+    lsl z, shift
+    mov carry, p_lo
+    mov tmp, #16
+    sub tmp, shift
+    lsr carry, tmp
+    orr z, carry
+    lsl p_lo, shift
+    prne
+    orr z, #bit 0
+    bra .f16_round_pack
+}
+
+.unusual
+{
+    ; Any NaN or inf, or zero or subnormal, with the exponents less 1
+    mov tmp, #30
+    cmp c_exp, tmp
+    prne
+    bra .c_not_nan
+    and c_hi, c_hi
+    prne
+    bra .f16_return_nan         ; c is NaN
+
+.c_not_nan
+    cmp a_exp, tmp
+    preq
+    bra .product_special
+    cmp b_exp, tmp
+    preq
+    bra .product_special
+    cmp c_exp, tmp
+    preq
+    bra .return_c               ; finite + inf => inf
+
+    and a_exp, a_exp            ; zero or subnormal?
+    prpl
+    bra .a_normal
+    and a, a
+    preq
+    bra .product_zero
+
+    clz tmp, a                  ; normalise a
+    sub tmp, #5
+    lsl a, tmp
+    mov a_exp, #0
+    sub a_exp, tmp
+    bra .a_done
+.a_normal
+    orr a, #0x400
+.a_done
+
+    and b_exp, b_exp            ; zero or subnormal?
+    prpl
+    bra .b_normal
+    and b, b
+    preq
+    bra .product_zero
+
+    clz tmp, b                  ; normalise b
+    sub tmp, #5
+    lsl b, tmp
+    mov b_exp, #0
+    sub b_exp, tmp
+    bra .b_done
+.b_normal
+    orr b, #0x400
+.b_done
+
+    and c_exp, c_exp            ; zero or subnormal?
+    prpl
+    bra .c_normal
+    and c_hi, c_hi
+    preq
+    bra .c_zero
+
+    clz tmp, c_hi               ; normalise c
+    sub tmp, #5
+    lsl c_hi, tmp
+    mov c_exp, #0
+    sub c_exp, tmp
+    bra .significands
+.c_normal
+    orr c_hi, #0x400
+    bra .significands
+
+.c_zero
+    mov c_exp, #0xc000          ; far below any product, which is only rounded
+    bra .significands
+
+.product_special
+    ; a or b is NaN or inf
+    cmp a_exp, tmp
+    prne
+    bra .a_not_nan
+    and a, a
+    prne
+    bra .f16_return_nan         ; a is NaN
+
+.a_not_nan
+    cmp b_exp, tmp
+    prne
+    bra .b_not_nan
+    and b, b
+    prne
+    bra .f16_return_nan         ; b is NaN
+
+.b_not_nan
+    mov tmp, a_exp              ; isZero(a) ?
+    add tmp, #1
+    orr tmp, a
+    preq
+    bra .f16_return_nan         ; zero * inf => nan
+    mov tmp, b_exp              ; isZero(b) ?
+    add tmp, #1
+    orr tmp, b
+    preq
+    bra .f16_return_nan         ; inf * zero => nan
+
+    mov tmp, #30                ; the product is inf...
+    cmp c_exp, tmp
+    prne
+    bra .f16_return_inf         ; inf + finite => inf
+    cmp c_sign, z_sign
+    prne
+    bra .f16_return_nan         ; inf - inf => nan
+    bra .f16_return_inf
+
+.product_zero
+    and c_hi, c_hi              ; isZero(c) ?
+    prne
+    bra .return_c               ; zero + c => c
+    mov tmp, c_exp
+    add tmp, #1
+    prne
+    bra .return_c
+    and z_sign, c_sign          ; zero + zero is -0 only if both are
+    bra .f16_return_zero
+
+.return_c
+    add z, #0                   ; clear V
+    mov pc, link
+}
+}
@@ -0,0 +1,3534 @@
+.unit_test_data
+    dw .f16_fma
+
+    ; Special values
+    dw 0x0000, 0x0000, 0x0000, 0x0000, 0x0000   ;   +zero      +zero      +zero
+    dw 0x0001, 0x0000, 0x0000, 0x8000, 0x0000   ;   +zero      +zero      -zero
+    dw 0x0002, 0x0000, 0x0000, 0x0001, 0x0001   ;   +zero      +zero      +min_sub
+    dw 0x0003, 0x0000, 0x0000, 0x8400, 0x8400   ;   +zero      +zero      -min_norm
+    dw 0x0004, 0x0000, 0x0000, 0x3c00, 0x3c00   ;   +zero      +zero      +one
+    dw 0x0005, 0x0000, 0x0000, 0xbc00, 0xbc00   ;   +zero      +zero      -one
+    dw 0x0006, 0x0000, 0x0000, 0x3c01, 0x3c01   ;   +zero      +zero      +one_eps
+    dw 0x0007, 0x0000, 0x0000, 0xc200, 0xc200   ;   +zero      +zero      -three
+    dw 0x0008, 0x0000, 0x0000, 0x7bff, 0x7bff   ;   +zero      +zero      +max
+    dw 0x0009, 0x0000, 0x0000, 0xfbff, 0xfbff   ;   +zero      +zero      -max
+    dw 0x000a, 0x0000, 0x0000, 0x7c00, 0x7c00   ;   +zero      +zero      +inf
+    dw 0x000b, 0x0000, 0x0000, 0xfc00, 0xfc00   ;   +zero      +zero      -inf
+    dw 0x000c, 0x0000, 0x0000, 0x7e00, 0x7e00   ;   +zero      +zero      +qnan
+    dw 0x000d, 0x0000, 0x8000, 0x0000, 0x0000   ;   +zero      -zero      +zero
+    dw 0x000e, 0x0000, 0x8000, 0x8000, 0x8000   ;   +zero      -zero      -zero
+    dw 0x000f, 0x0000, 0x8000, 0x0001, 0x0001   ;   +zero      -zero      +min_sub
+    dw 0x0010, 0x0000, 0x8000, 0x8400, 0x8400   ;   +zero      -zero      -min_norm
+    dw 0x0011, 0x0000, 0x8000, 0x3c00, 0x3c00   ;   +zero      -zero      +one
+    dw 0x0012, 0x0000, 0x8000, 0xbc00, 0xbc00   ;   +zero      -zero      -one
+    dw 0x0013, 0x0000, 0x8000, 0x3c01, 0x3c01   ;   +zero      -zero      +one_eps
+    dw 0x0014, 0x0000, 0x8000, 0xc200, 0xc200   ;   +zero      -zero      -three
+    dw 0x0015, 0x0000, 0x8000, 0x7bff, 0x7bff   ;   +zero      -zero      +max
+    dw 0x0016, 0x0000, 0x8000, 0xfbff, 0xfbff   ;   +zero      -zero      -max
+    dw 0x0017, 0x0000, 0x8000, 0x7c00, 0x7c00   ;   +zero      -zero      +inf
+    dw 0x0018, 0x0000, 0x8000, 0xfc00, 0xfc00   ;   +zero      -zero      -inf
+    dw 0x0019, 0x0000, 0x8000, 0x7e00, 0x7e00   ;   +zero      -zero      +qnan
+    dw 0x001a, 0x0000, 0x0001, 0x0000, 0x0000   ;   +zero      +min_sub   +zero
+    dw 0x001b, 0x0000, 0x0001, 0x8000, 0x0000   ;   +zero      +min_sub   -zero
+    dw 0x001c, 0x0000, 0x0001, 0x0001, 0x0001   ;   +zero      +min_sub   +min_sub
+    dw 0x001d, 0x0000, 0x0001, 0x8400, 0x8400   ;   +zero      +min_sub   -min_norm
+    dw 0x001e, 0x0000, 0x0001, 0x3c00, 0x3c00   ;   +zero      +min_sub   +one
+    dw 0x001f, 0x0000, 0x0001, 0xbc00, 0xbc00   ;   +zero      +min_sub   -one
+    dw 0x0020, 0x0000, 0x0001, 0x3c01, 0x3c01   ;   +zero      +min_sub   +one_eps
+    dw 0x0021, 0x0000, 0x0001, 0xc200, 0xc200   ;   +zero      +min_sub   -three
+    dw 0x0022, 0x0000, 0x0001, 0x7bff, 0x7bff   ;   +zero      +min_sub   +max
+    dw 0x0023, 0x0000, 0x0001, 0xfbff, 0xfbff   ;   +zero      +min_sub   -max
+    dw 0x0024, 0x0000, 0x0001, 0x7c00, 0x7c00   ;   +zero      +min_sub   +inf
+    dw 0x0025, 0x0000, 0x0001, 0xfc00, 0xfc00   ;   +zero      +min_sub   -inf
+    dw 0x0026, 0x0000, 0x0001, 0x7e00, 0x7e00   ;   +zero      +min_sub   +qnan
+    dw 0x0027, 0x0000, 0x8400, 0x0000, 0x0000   ;   +zero      -min_norm  +zero
+    dw 0x0028, 0x0000, 0x8400, 0x8000, 0x8000   ;   +zero      -min_norm  -zero
+    dw 0x0029, 0x0000, 0x8400, 0x0001, 0x0001   ;   +zero      -min_norm  +min_sub
+    dw 0x002a, 0x0000, 0x8400, 0x8400, 0x8400   ;   +zero      -min_norm  -min_norm
+    dw 0x002b, 0x0000, 0x8400, 0x3c00, 0x3c00   ;   +zero      -min_norm  +one
+    dw 0x002c, 0x0000, 0x8400, 0xbc00, 0xbc00   ;   +zero      -min_norm  -one
+    dw 0x002d, 0x0000, 0x8400, 0x3c01, 0x3c01   ;   +zero      -min_norm  +one_eps
+    dw 0x002e, 0x0000, 0x8400, 0xc200, 0xc200   ;   +zero      -min_norm  -three
+    dw 0x002f, 0x0000, 0x8400, 0x7bff, 0x7bff   ;   +zero      -min_norm  +max
+    dw 0x0030, 0x0000, 0x8400, 0xfbff, 0xfbff   ;   +zero      -min_norm  -max
+    dw 0x0031, 0x0000, 0x8400, 0x7c00, 0x7c00   ;   +zero      -min_norm  +inf
+    dw 0x0032, 0x0000, 0x8400, 0xfc00, 0xfc00   ;   +zero      -min_norm  -inf
+    dw 0x0033, 0x0000, 0x8400, 0x7e00, 0x7e00   ;   +zero      -min_norm  +qnan
+    dw 0x0034, 0x0000, 0x3c00, 0x0000, 0x0000   ;   +zero      +one       +zero
+    dw 0x0035, 0x0000, 0x3c00, 0x8000, 0x0000   ;   +zero      +one       -zero
+    dw 0x0036, 0x0000, 0x3c00, 0x0001, 0x0001   ;   +zero      +one       +min_sub
+    dw 0x0037, 0x0000, 0x3c00, 0x8400, 0x8400   ;   +zero      +one       -min_norm
+    dw 0x0038, 0x0000, 0x3c00, 0x3c00, 0x3c00   ;   +zero      +one       +one
+    dw 0x0039, 0x0000, 0x3c00, 0xbc00, 0xbc00   ;   +zero      +one       -one
+    dw 0x003a, 0x0000, 0x3c00, 0x3c01, 0x3c01   ;   +zero      +one       +one_eps
+    dw 0x003b, 0x0000, 0x3c00, 0xc200, 0xc200   ;   +zero      +one       -three
+    dw 0x003c, 0x0000, 0x3c00, 0x7bff, 0x7bff   ;   +zero      +one       +max
+    dw 0x003d, 0x0000, 0x3c00, 0xfbff, 0xfbff   ;   +zero      +one       -max
+    dw 0x003e, 0x0000, 0x3c00, 0x7c00, 0x7c00   ;   +zero      +one       +inf
+    dw 0x003f, 0x0000, 0x3c00, 0xfc00, 0xfc00   ;   +zero      +one       -inf
+    dw 0x0040, 0x0000, 0x3c00, 0x7e00, 0x7e00   ;   +zero      +one       +qnan
+    dw 0x0041, 0x0000, 0xbc00, 0x0000, 0x0000   ;   +zero      -one       +zero
+    dw 0x0042, 0x0000, 0xbc00, 0x8000, 0x8000   ;   +zero      -one       -zero
+    dw 0x0043, 0x0000, 0xbc00, 0x0001, 0x0001   ;   +zero      -one       +min_sub
+    dw 0x0044, 0x0000, 0xbc00, 0x8400, 0x8400   ;   +zero      -one       -min_norm
+    dw 0x0045, 0x0000, 0xbc00, 0x3c00, 0x3c00   ;   +zero      -one       +one
+    dw 0x0046, 0x0000, 0xbc00, 0xbc00, 0xbc00   ;   +zero      -one       -one
+    dw 0x0047, 0x0000, 0xbc00, 0x3c01, 0x3c01   ;   +zero      -one       +one_eps
+    dw 0x0048, 0x0000, 0xbc00, 0xc200, 0xc200   ;   +zero      -one       -three
+    dw 0x0049, 0x0000, 0xbc00, 0x7bff, 0x7bff   ;   +zero      -one       +max
+    dw 0x004a, 0x0000, 0xbc00, 0xfbff, 0xfbff   ;   +zero      -one       -max
+    dw 0x004b, 0x0000, 0xbc00, 0x7c00, 0x7c00   ;   +zero      -one       +inf
+    dw 0x004c, 0x0000, 0xbc00, 0xfc00, 0xfc00   ;   +zero      -one       -inf
+    dw 0x004d, 0x0000, 0xbc00, 0x7e00, 0x7e00   ;   +zero      -one       +qnan
+    dw 0x004e, 0x0000, 0x3c01, 0x0000, 0x0000   ;   +zero      +one_eps   +zero
+    dw 0x004f, 0x0000, 0x3c01, 0x8000, 0x0000   ;   +zero      +one_eps   -zero
+    dw 0x0050, 0x0000, 0x3c01, 0x0001, 0x0001   ;   +zero      +one_eps   +min_sub
+    dw 0x0051, 0x0000, 0x3c01, 0x8400, 0x8400   ;   +zero      +one_eps   -min_norm
+    dw 0x0052, 0x0000, 0x3c01, 0x3c00, 0x3c00   ;   +zero      +one_eps   +one
+    dw 0x0053, 0x0000, 0x3c01, 0xbc00, 0xbc00   ;   +zero      +one_eps   -one
+    dw 0x0054, 0x0000, 0x3c01, 0x3c01, 0x3c01   ;   +zero      +one_eps   +one_eps
+    dw 0x0055, 0x0000, 0x3c01, 0xc200, 0xc200   ;   +zero      +one_eps   -three
+    dw 0x0056, 0x0000, 0x3c01, 0x7bff, 0x7bff   ;   +zero      +one_eps   +max
+    dw 0x0057, 0x0000, 0x3c01, 0xfbff, 0xfbff   ;   +zero      +one_eps   -max
+    dw 0x0058, 0x0000, 0x3c01, 0x7c00, 0x7c00   ;   +zero      +one_eps   +inf
+    dw 0x0059, 0x0000, 0x3c01, 0xfc00, 0xfc00   ;   +zero      +one_eps   -inf
+    dw 0x005a, 0x0000, 0x3c01, 0x7e00, 0x7e00   ;   +zero      +one_eps   +qnan
+    dw 0x005b, 0x0000, 0xc200, 0x0000, 0x0000   ;   +zero      -three     +zero
+    dw 0x005c, 0x0000, 0xc200, 0x8000, 0x8000   ;   +zero      -three     -zero
+    dw 0x005d, 0x0000, 0xc200, 0x0001, 0x0001   ;   +zero      -three     +min_sub
+    dw 0x005e, 0x0000, 0xc200, 0x8400, 0x8400   ;   +zero      -three     -min_norm
+    dw 0x005f, 0x0000, 0xc200, 0x3c00, 0x3c00   ;   +zero      -three     +one
+    dw 0x0060, 0x0000, 0xc200, 0xbc00, 0xbc00   ;   +zero      -three     -one
+    dw 0x0061, 0x0000, 0xc200, 0x3c01, 0x3c01   ;   +zero      -three     +one_eps
+    dw 0x0062, 0x0000, 0xc200, 0xc200, 0xc200   ;   +zero      -three     -three
+    dw 0x0063, 0x0000, 0xc200, 0x7bff, 0x7bff   ;   +zero      -three     +max
+    dw 0x0064, 0x0000, 0xc200, 0xfbff, 0xfbff   ;   +zero      -three     -max
+    dw 0x0065, 0x0000, 0xc200, 0x7c00, 0x7c00   ;   +zero      -three     +inf
+    dw 0x0066, 0x0000, 0xc200, 0xfc00, 0xfc00   ;   +zero      -three     -inf
+    dw 0x0067, 0x0000, 0xc200, 0x7e00, 0x7e00   ;   +zero      -three     +qnan
+    dw 0x0068, 0x0000, 0x7bff, 0x0000, 0x0000   ;   +zero      +max       +zero
+    dw 0x0069, 0x0000, 0x7bff, 0x8000, 0x0000   ;   +zero      +max       -zero
+    dw 0x006a, 0x0000, 0x7bff, 0x0001, 0x0001   ;   +zero      +max       +min_sub
+    dw 0x006b, 0x0000, 0x7bff, 0x8400, 0x8400   ;   +zero      +max       -min_norm
+    dw 0x006c, 0x0000, 0x7bff, 0x3c00, 0x3c00   ;   +zero      +max       +one
+    dw 0x006d, 0x0000, 0x7bff, 0xbc00, 0xbc00   ;   +zero      +max       -one
+    dw 0x006e, 0x0000, 0x7bff, 0x3c01, 0x3c01   ;   +zero      +max       +one_eps
+    dw 0x006f, 0x0000, 0x7bff, 0xc200, 0xc200   ;   +zero      +max       -three
+    dw 0x0070, 0x0000, 0x7bff, 0x7bff, 0x7bff   ;   +zero      +max       +max
+    dw 0x0071, 0x0000, 0x7bff, 0xfbff, 0xfbff   ;   +zero      +max       -max
+    dw 0x0072, 0x0000, 0x7bff, 0x7c00, 0x7c00   ;   +zero      +max       +inf
+    dw 0x0073, 0x0000, 0x7bff, 0xfc00, 0xfc00   ;   +zero      +max       -inf
+    dw 0x0074, 0x0000, 0x7bff, 0x7e00, 0x7e00   ;   +zero      +max       +qnan
+    dw 0x0075, 0x0000, 0xfbff, 0x0000, 0x0000   ;   +zero      -max       +zero
+    dw 0x0076, 0x0000, 0xfbff, 0x8000, 0x8000   ;   +zero      -max       -zero
+    dw 0x0077, 0x0000, 0xfbff, 0x0001, 0x0001   ;   +zero      -max       +min_sub
+    dw 0x0078, 0x0000, 0xfbff, 0x8400, 0x8400   ;   +zero      -max       -min_norm
+    dw 0x0079, 0x0000, 0xfbff, 0x3c00, 0x3c00   ;   +zero      -max       +one
+    dw 0x007a, 0x0000, 0xfbff, 0xbc00, 0xbc00   ;   +zero      -max       -one
+    dw 0x007b, 0x0000, 0xfbff, 0x3c01, 0x3c01   ;   +zero      -max       +one_eps
+    dw 0x007c, 0x0000, 0xfbff, 0xc200, 0xc200   ;   +zero      -max       -three
+    dw 0x007d, 0x0000, 0xfbff, 0x7bff, 0x7bff   ;   +zero      -max       +max
+    dw 0x007e, 0x0000, 0xfbff, 0xfbff, 0xfbff   ;   +zero      -max       -max
+    dw 0x007f, 0x0000, 0xfbff, 0x7c00, 0x7c00   ;   +zero      -max       +inf
+    dw 0x0080, 0x0000, 0xfbff, 0xfc00, 0xfc00   ;   +zero      -max       -inf
+    dw 0x0081, 0x0000, 0xfbff, 0x7e00, 0x7e00   ;   +zero      -max       +qnan
+    dw 0x0082, 0x0000, 0x7c00, 0x0000, 0x7e00   ;   +zero      +inf       +zero
+    dw 0x0083, 0x0000, 0x7c00, 0x8000, 0x7e00   ;   +zero      +inf       -zero
+    dw 0x0084, 0x0000, 0x7c00, 0x0001, 0x7e00   ;   +zero      +inf       +min_sub
+    dw 0x0085, 0x0000, 0x7c00, 0x8400, 0x7e00   ;   +zero      +inf       -min_norm
+    dw 0x0086, 0x0000, 0x7c00, 0x3c00, 0x7e00   ;   +zero      +inf       +one
+    dw 0x0087, 0x0000, 0x7c00, 0xbc00, 0x7e00   ;   +zero      +inf       -one
+    dw 0x0088, 0x0000, 0x7c00, 0x3c01, 0x7e00   ;   +zero      +inf       +one_eps
+    dw 0x0089, 0x0000, 0x7c00, 0xc200, 0x7e00   ;   +zero      +inf       -three
+    dw 0x008a, 0x0000, 0x7c00, 0x7bff, 0x7e00   ;   +zero      +inf       +max
+    dw 0x008b, 0x0000, 0x7c00, 0xfbff, 0x7e00   ;   +zero      +inf       -max
+    dw 0x008c, 0x0000, 0x7c00, 0x7c00, 0x7e00   ;   +zero      +inf       +inf
+    dw 0x008d, 0x0000, 0x7c00, 0xfc00, 0x7e00   ;   +zero      +inf       -inf
+    dw 0x008e, 0x0000, 0x7c00, 0x7e00, 0x7e00   ;   +zero      +inf       +qnan
+    dw 0x008f, 0x0000, 0xfc00, 0x0000, 0x7e00   ;   +zero      -inf       +zero
+    dw 0x0090, 0x0000, 0xfc00, 0x8000, 0x7e00   ;   +zero      -inf       -zero
+    dw 0x0091, 0x0000, 0xfc00, 0x0001, 0x7e00   ;   +zero      -inf       +min_sub
+    dw 0x0092, 0x0000, 0xfc00, 0x8400, 0x7e00   ;   +zero      -inf       -min_norm
+    dw 0x0093, 0x0000, 0xfc00, 0x3c00, 0x7e00   ;   +zero      -inf       +one
+    dw 0x0094, 0x0000, 0xfc00, 0xbc00, 0x7e00   ;   +zero      -inf       -one
+    dw 0x0095, 0x0000, 0xfc00, 0x3c01, 0x7e00   ;   +zero      -inf       +one_eps
+    dw 0x0096, 0x0000, 0xfc00, 0xc200, 0x7e00   ;   +zero      -inf       -three
+    dw 0x0097, 0x0000, 0xfc00, 0x7bff, 0x7e00   ;   +zero      -inf       +max
+    dw 0x0098, 0x0000, 0xfc00, 0xfbff, 0x7e00   ;   +zero      -inf       -max
+    dw 0x0099, 0x0000, 0xfc00, 0x7c00, 0x7e00   ;   +zero      -inf       +inf
+    dw 0x009a, 0x0000, 0xfc00, 0xfc00, 0x7e00   ;   +zero      -inf       -inf
+    dw 0x009b, 0x0000, 0xfc00, 0x7e00, 0x7e00   ;   +zero      -inf       +qnan
+    dw 0x009c, 0x0000, 0x7e00, 0x0000, 0x7e00   ;   +zero      +qnan      +zero
+    dw 0x009d, 0x0000, 0x7e00, 0x8000, 0x7e00   ;   +zero      +qnan      -zero
+    dw 0x009e, 0x0000, 0x7e00, 0x0001, 0x7e00   ;   +zero      +qnan      +min_sub
+    dw 0x009f, 0x0000, 0x7e00, 0x8400, 0x7e00   ;   +zero      +qnan      -min_norm
+    dw 0x00a0, 0x0000, 0x7e00, 0x3c00, 0x7e00   ;   +zero      +qnan      +one
+    dw 0x00a1, 0x0000, 0x7e00, 0xbc00, 0x7e00   ;   +zero      +qnan      -one
+    dw 0x00a2, 0x0000, 0x7e00, 0x3c01, 0x7e00   ;   +zero      +qnan      +one_eps
+    dw 0x00a3, 0x0000, 0x7e00, 0xc200, 0x7e00   ;   +zero      +qnan      -three
+    dw 0x00a4, 0x0000, 0x7e00, 0x7bff, 0x7e00   ;   +zero      +qnan      +max
+    dw 0x00a5, 0x0000, 0x7e00, 0xfbff, 0x7e00   ;   +zero      +qnan      -max
+    dw 0x00a6, 0x0000, 0x7e00, 0x7c00, 0x7e00   ;   +zero      +qnan      +inf
+    dw 0x00a7, 0x0000, 0x7e00, 0xfc00, 0x7e00   ;   +zero      +qnan      -inf
+    dw 0x00a8, 0x0000, 0x7e00, 0x7e00, 0x7e00   ;   +zero      +qnan      +qnan
+    dw 0x00a9, 0x8000, 0x0000, 0x0000, 0x0000   ;   -zero      +zero      +zero
+    dw 0x00aa, 0x8000, 0x0000, 0x8000, 0x8000   ;   -zero      +zero      -zero
+    dw 0x00ab, 0x8000, 0x0000, 0x0001, 0x0001   ;   -zero      +zero      +min_sub
+    dw 0x00ac, 0x8000, 0x0000, 0x8400, 0x8400   ;   -zero      +zero      -min_norm
+    dw 0x00ad, 0x8000, 0x0000, 0x3c00, 0x3c00   ;   -zero      +zero      +one
+    dw 0x00ae, 0x8000, 0x0000, 0xbc00, 0xbc00   ;   -zero      +zero      -one
+    dw 0x00af, 0x8000, 0x0000, 0x3c01, 0x3c01   ;   -zero      +zero      +one_eps
+    dw 0x00b0, 0x8000, 0x0000, 0xc200, 0xc200   ;   -zero      +zero      -three
+    dw 0x00b1, 0x8000, 0x0000, 0x7bff, 0x7bff   ;   -zero      +zero      +max
+    dw 0x00b2, 0x8000, 0x0000, 0xfbff, 0xfbff   ;   -zero      +zero      -max
+    dw 0x00b3, 0x8000, 0x0000, 0x7c00, 0x7c00   ;   -zero      +zero      +inf
+    dw 0x00b4, 0x8000, 0x0000, 0xfc00, 0xfc00   ;   -zero      +zero      -inf
+    dw 0x00b5, 0x8000, 0x0000, 0x7e00, 0x7e00   ;   -zero      +zero      +qnan
+    dw 0x00b6, 0x8000, 0x8000, 0x0000, 0x0000   ;   -zero      -zero      +zero
+    dw 0x00b7, 0x8000, 0x8000, 0x8000, 0x0000   ;   -zero      -zero      -zero
+    dw 0x00b8, 0x8000, 0x8000, 0x0001, 0x0001   ;   -zero      -zero      +min_sub
+    dw 0x00b9, 0x8000, 0x8000, 0x8400, 0x8400   ;   -zero      -zero      -min_norm
+    dw 0x00ba, 0x8000, 0x8000, 0x3c00, 0x3c00   ;   -zero      -zero      +one
+    dw 0x00bb, 0x8000, 0x8000, 0xbc00, 0xbc00   ;   -zero      -zero      -one
+    dw 0x00bc, 0x8000, 0x8000, 0x3c01, 0x3c01   ;   -zero      -zero      +one_eps
+    dw 0x00bd, 0x8000, 0x8000, 0xc200, 0xc200   ;   -zero      -zero      -three
+    dw 0x00be, 0x8000, 0x8000, 0x7bff, 0x7bff   ;   -zero      -zero      +max
+    dw 0x00bf, 0x8000, 0x8000, 0xfbff, 0xfbff   ;   -zero      -zero      -max
+    dw 0x00c0, 0x8000, 0x8000, 0x7c00, 0x7c00   ;   -zero      -zero      +inf
+    dw 0x00c1, 0x8000, 0x8000, 0xfc00, 0xfc00   ;   -zero      -zero      -inf
+    dw 0x00c2, 0x8000, 0x8000, 0x7e00, 0x7e00   ;   -zero      -zero      +qnan
+    dw 0x00c3, 0x8000, 0x0001, 0x0000, 0x0000   ;   -zero      +min_sub   +zero
+    dw 0x00c4, 0x8000, 0x0001, 0x8000, 0x8000   ;   -zero      +min_sub   -zero
+    dw 0x00c5, 0x8000, 0x0001, 0x0001, 0x0001   ;   -zero      +min_sub   +min_sub
+    dw 0x00c6, 0x8000, 0x0001, 0x8400, 0x8400   ;   -zero      +min_sub   -min_norm
+    dw 0x00c7, 0x8000, 0x0001, 0x3c00, 0x3c00   ;   -zero      +min_sub   +one
+    dw 0x00c8, 0x8000, 0x0001, 0xbc00, 0xbc00   ;   -zero      +min_sub   -one
+    dw 0x00c9, 0x8000, 0x0001, 0x3c01, 0x3c01   ;   -zero      +min_sub   +one_eps
+    dw 0x00ca, 0x8000, 0x0001, 0xc200, 0xc200   ;   -zero      +min_sub   -three
+    dw 0x00cb, 0x8000, 0x0001, 0x7bff, 0x7bff   ;   -zero      +min_sub   +max
+    dw 0x00cc, 0x8000, 0x0001, 0xfbff, 0xfbff   ;   -zero      +min_sub   -max
+    dw 0x00cd, 0x8000, 0x0001, 0x7c00, 0x7c00   ;   -zero      +min_sub   +inf
+    dw 0x00ce, 0x8000, 0x0001, 0xfc00, 0xfc00   ;   -zero      +min_sub   -inf
+    dw 0x00cf, 0x8000, 0x0001, 0x7e00, 0x7e00   ;   -zero      +min_sub   +qnan
+    dw 0x00d0, 0x8000, 0x8400, 0x0000, 0x0000   ;   -zero      -min_norm  +zero
+    dw 0x00d1, 0x8000, 0x8400, 0x8000, 0x0000   ;   -zero      -min_norm  -zero
+    dw 0x00d2, 0x8000, 0x8400, 0x0001, 0x0001   ;   -zero      -min_norm  +min_sub
+    dw 0x00d3, 0x8000, 0x8400, 0x8400, 0x8400   ;   -zero      -min_norm  -min_norm
+    dw 0x00d4, 0x8000, 0x8400, 0x3c00, 0x3c00   ;   -zero      -min_norm  +one
+    dw 0x00d5, 0x8000, 0x8400, 0xbc00, 0xbc00   ;   -zero      -min_norm  -one
+    dw 0x00d6, 0x8000, 0x8400, 0x3c01, 0x3c01   ;   -zero      -min_norm  +one_eps
+    dw 0x00d7, 0x8000, 0x8400, 0xc200, 0xc200   ;   -zero      -min_norm  -three
+    dw 0x00d8, 0x8000, 0x8400, 0x7bff, 0x7bff   ;   -zero      -min_norm  +max
+    dw 0x00d9, 0x8000, 0x8400, 0xfbff, 0xfbff   ;   -zero      -min_norm  -max
+    dw 0x00da, 0x8000, 0x8400, 0x7c00, 0x7c00   ;   -zero      -min_norm  +inf
+    dw 0x00db, 0x8000, 0x8400, 0xfc00, 0xfc00   ;   -zero      -min_norm  -inf
+    dw 0x00dc, 0x8000, 0x8400, 0x7e00, 0x7e00   ;   -zero      -min_norm  +qnan
+    dw 0x00dd, 0x8000, 0x3c00, 0x0000, 0x0000   ;   -zero      +one       +zero
+    dw 0x00de, 0x8000, 0x3c00, 0x8000, 0x8000   ;   -zero      +one       -zero
+    dw 0x00df, 0x8000, 0x3c00, 0x0001, 0x0001   ;   -zero      +one       +min_sub
+    dw 0x00e0, 0x8000, 0x3c00, 0x8400, 0x8400   ;   -zero      +one       -min_norm
+    dw 0x00e1, 0x8000, 0x3c00, 0x3c00, 0x3c00   ;   -zero      +one       +one
+    dw 0x00e2, 0x8000, 0x3c00, 0xbc00, 0xbc00   ;   -zero      +one       -one
+    dw 0x00e3, 0x8000, 0x3c00, 0x3c01, 0x3c01   ;   -zero      +one       +one_eps
+    dw 0x00e4, 0x8000, 0x3c00, 0xc200, 0xc200   ;   -zero      +one       -three
+    dw 0x00e5, 0x8000, 0x3c00, 0x7bff, 0x7bff   ;   -zero      +one       +max
+    dw 0x00e6, 0x8000, 0x3c00, 0xfbff, 0xfbff   ;   -zero      +one       -max
+    dw 0x00e7, 0x8000, 0x3c00, 0x7c00, 0x7c00   ;   -zero      +one       +inf
+    dw 0x00e8, 0x8000, 0x3c00, 0xfc00, 0xfc00   ;   -zero      +one       -inf
+    dw 0x00e9, 0x8000, 0x3c00, 0x7e00, 0x7e00   ;   -zero      +one       +qnan
+    dw 0x00ea, 0x8000, 0xbc00, 0x0000, 0x0000   ;   -zero      -one       +zero
+    dw 0x00eb, 0x8000, 0xbc00, 0x8000, 0x0000   ;   -zero      -one       -zero
+    dw 0x00ec, 0x8000, 0xbc00, 0x0001, 0x0001   ;   -zero      -one       +min_sub
+    dw 0x00ed, 0x8000, 0xbc00, 0x8400, 0x8400   ;   -zero      -one       -min_norm
+    dw 0x00ee, 0x8000, 0xbc00, 0x3c00, 0x3c00   ;   -zero      -one       +one
+    dw 0x00ef, 0x8000, 0xbc00, 0xbc00, 0xbc00   ;   -zero      -one       -one
+    dw 0x00f0, 0x8000, 0xbc00, 0x3c01, 0x3c01   ;   -zero      -one       +one_eps
+    dw 0x00f1, 0x8000, 0xbc00, 0xc200, 0xc200   ;   -zero      -one       -three
+    dw 0x00f2, 0x8000, 0xbc00, 0x7bff, 0x7bff   ;   -zero      -one       +max
+    dw 0x00f3, 0x8000, 0xbc00, 0xfbff, 0xfbff   ;   -zero      -one       -max
+    dw 0x00f4, 0x8000, 0xbc00, 0x7c00, 0x7c00   ;   -zero      -one       +inf
+    dw 0x00f5, 0x8000, 0xbc00, 0xfc00, 0xfc00   ;   -zero      -one       -inf
+    dw 0x00f6, 0x8000, 0xbc00, 0x7e00, 0x7e00   ;   -zero      -one       +qnan
+    dw 0x00f7, 0x8000, 0x3c01, 0x0000, 0x0000   ;   -zero      +one_eps   +zero
+    dw 0x00f8, 0x8000, 0x3c01, 0x8000, 0x8000   ;   -zero      +one_eps   -zero
+    dw 0x00f9, 0x8000, 0x3c01, 0x0001, 0x0001   ;   -zero      +one_eps   +min_sub
+    dw 0x00fa, 0x8000, 0x3c01, 0x8400, 0x8400   ;   -zero      +one_eps   -min_norm
+    dw 0x00fb, 0x8000, 0x3c01, 0x3c00, 0x3c00   ;   -zero      +one_eps   +one
+    dw 0x00fc, 0x8000, 0x3c01, 0xbc00, 0xbc00   ;   -zero      +one_eps   -one
+    dw 0x00fd, 0x8000, 0x3c01, 0x3c01, 0x3c01   ;   -zero      +one_eps   +one_eps
+    dw 0x00fe, 0x8000, 0x3c01, 0xc200, 0xc200   ;   -zero      +one_eps   -three
+    dw 0x00ff, 0x8000, 0x3c01, 0x7bff, 0x7bff   ;   -zero      +one_eps   +max
+    dw 0x0100, 0x8000, 0x3c01, 0xfbff, 0xfbff   ;   -zero      +one_eps   -max
+    dw 0x0101, 0x8000, 0x3c01, 0x7c00, 0x7c00   ;   -zero      +one_eps   +inf
+    dw 0x0102, 0x8000, 0x3c01, 0xfc00, 0xfc00   ;   -zero      +one_eps   -inf
+    dw 0x0103, 0x8000, 0x3c01, 0x7e00, 0x7e00   ;   -zero      +one_eps   +qnan
+    dw 0x0104, 0x8000, 0xc200, 0x0000, 0x0000   ;   -zero      -three     +zero
+    dw 0x0105, 0x8000, 0xc200, 0x8000, 0x0000   ;   -zero      -three     -zero
+    dw 0x0106, 0x8000, 0xc200, 0x0001, 0x0001   ;   -zero      -three     +min_sub
+    dw 0x0107, 0x8000, 0xc200, 0x8400, 0x8400   ;   -zero      -three     -min_norm
+    dw 0x0108, 0x8000, 0xc200, 0x3c00, 0x3c00   ;   -zero      -three     +one
+    dw 0x0109, 0x8000, 0xc200, 0xbc00, 0xbc00   ;   -zero      -three     -one
+    dw 0x010a, 0x8000, 0xc200, 0x3c01, 0x3c01   ;   -zero      -three     +one_eps
+    dw 0x010b, 0x8000, 0xc200, 0xc200, 0xc200   ;   -zero      -three     -three
+    dw 0x010c, 0x8000, 0xc200, 0x7bff, 0x7bff   ;   -zero      -three     +max
+    dw 0x010d, 0x8000, 0xc200, 0xfbff, 0xfbff   ;   -zero      -three     -max
+    dw 0x010e, 0x8000, 0xc200, 0x7c00, 0x7c00   ;   -zero      -three     +inf
+    dw 0x010f, 0x8000, 0xc200, 0xfc00, 0xfc00   ;   -zero      -three     -inf
+    dw 0x0110, 0x8000, 0xc200, 0x7e00, 0x7e00   ;   -zero      -three     +qnan
+    dw 0x0111, 0x8000, 0x7bff, 0x0000, 0x0000   ;   -zero      +max       +zero
+    dw 0x0112, 0x8000, 0x7bff, 0x8000, 0x8000   ;   -zero      +max       -zero
+    dw 0x0113, 0x8000, 0x7bff, 0x0001, 0x0001   ;   -zero      +max       +min_sub
+    dw 0x0114, 0x8000, 0x7bff, 0x8400, 0x8400   ;   -zero      +max       -min_norm
+    dw 0x0115, 0x8000, 0x7bff, 0x3c00, 0x3c00   ;   -zero      +max       +one
+    dw 0x0116, 0x8000, 0x7bff, 0xbc00, 0xbc00   ;   -zero      +max       -one
+    dw 0x0117, 0x8000, 0x7bff, 0x3c01, 0x3c01   ;   -zero      +max       +one_eps
+    dw 0x0118, 0x8000, 0x7bff, 0xc200, 0xc200   ;   -zero      +max       -three
+    dw 0x0119, 0x8000, 0x7bff, 0x7bff, 0x7bff   ;   -zero      +max       +max
+    dw 0x011a, 0x8000, 0x7bff, 0xfbff, 0xfbff   ;   -zero      +max       -max
+    dw 0x011b, 0x8000, 0x7bff, 0x7c00, 0x7c00   ;   -zero      +max       +inf
+    dw 0x011c, 0x8000, 0x7bff, 0xfc00, 0xfc00   ;   -zero      +max       -inf
+    dw 0x011d, 0x8000, 0x7bff, 0x7e00, 0x7e00   ;   -zero      +max       +qnan
+    dw 0x011e, 0x8000, 0xfbff, 0x0000, 0x0000   ;   -zero      -max       +zero
+    dw 0x011f, 0x8000, 0xfbff, 0x8000, 0x0000   ;   -zero      -max       -zero
+    dw 0x0120, 0x8000, 0xfbff, 0x0001, 0x0001   ;   -zero      -max       +min_sub
+    dw 0x0121, 0x8000, 0xfbff, 0x8400, 0x8400   ;   -zero      -max       -min_norm
+    dw 0x0122, 0x8000, 0xfbff, 0x3c00, 0x3c00   ;   -zero      -max       +one
+    dw 0x0123, 0x8000, 0xfbff, 0xbc00, 0xbc00   ;   -zero      -max       -one
+    dw 0x0124, 0x8000, 0xfbff, 0x3c01, 0x3c01   ;   -zero      -max       +one_eps
+    dw 0x0125, 0x8000, 0xfbff, 0xc200, 0xc200   ;   -zero      -max       -three
+    dw 0x0126, 0x8000, 0xfbff, 0x7bff, 0x7bff   ;   -zero      -max       +max
+    dw 0x0127, 0x8000, 0xfbff, 0xfbff, 0xfbff   ;   -zero      -max       -max
+    dw 0x0128, 0x8000, 0xfbff, 0x7c00, 0x7c00   ;   -zero      -max       +inf
+    dw 0x0129, 0x8000, 0xfbff, 0xfc00, 0xfc00   ;   -zero      -max       -inf
+    dw 0x012a, 0x8000, 0xfbff, 0x7e00, 0x7e00   ;   -zero      -max       +qnan
+    dw 0x012b, 0x8000, 0x7c00, 0x0000, 0x7e00   ;   -zero      +inf       +zero
+    dw 0x012c, 0x8000, 0x7c00, 0x8000, 0x7e00   ;   -zero      +inf       -zero
+    dw 0x012d, 0x8000, 0x7c00, 0x0001, 0x7e00   ;   -zero      +inf       +min_sub
+    dw 0x012e, 0x8000, 0x7c00, 0x8400, 0x7e00   ;   -zero      +inf       -min_norm
+    dw 0x012f, 0x8000, 0x7c00, 0x3c00, 0x7e00   ;   -zero      +inf       +one
+    dw 0x0130, 0x8000, 0x7c00, 0xbc00, 0x7e00   ;   -zero      +inf       -one
+    dw 0x0131, 0x8000, 0x7c00, 0x3c01, 0x7e00   ;   -zero      +inf       +one_eps
+    dw 0x0132, 0x8000, 0x7c00, 0xc200, 0x7e00   ;   -zero      +inf       -three
+    dw 0x0133, 0x8000, 0x7c00, 0x7bff, 0x7e00   ;   -zero      +inf       +max
+    dw 0x0134, 0x8000, 0x7c00, 0xfbff, 0x7e00   ;   -zero      +inf       -max
+    dw 0x0135, 0x8000, 0x7c00, 0x7c00, 0x7e00   ;   -zero      +inf       +inf
+    dw 0x0136, 0x8000, 0x7c00, 0xfc00, 0x7e00   ;   -zero      +inf       -inf
+    dw 0x0137, 0x8000, 0x7c00, 0x7e00, 0x7e00   ;   -zero      +inf       +qnan
+    dw 0x0138, 0x8000, 0xfc00, 0x0000, 0x7e00   ;   -zero      -inf       +zero
+    dw 0x0139, 0x8000, 0xfc00, 0x8000, 0x7e00   ;   -zero      -inf       -zero
+    dw 0x013a, 0x8000, 0xfc00, 0x0001, 0x7e00   ;   -zero      -inf       +min_sub
+    dw 0x013b, 0x8000, 0xfc00, 0x8400, 0x7e00   ;   -zero      -inf       -min_norm
+    dw 0x013c, 0x8000, 0xfc00, 0x3c00, 0x7e00   ;   -zero      -inf       +one
+    dw 0x013d, 0x8000, 0xfc00, 0xbc00, 0x7e00   ;   -zero      -inf       -one
+    dw 0x013e, 0x8000, 0xfc00, 0x3c01, 0x7e00   ;   -zero      -inf       +one_eps
+    dw 0x013f, 0x8000, 0xfc00, 0xc200, 0x7e00   ;   -zero      -inf       -three
+    dw 0x0140, 0x8000, 0xfc00, 0x7bff, 0x7e00   ;   -zero      -inf       +max
+    dw 0x0141, 0x8000, 0xfc00, 0xfbff, 0x7e00   ;   -zero      -inf       -max
+    dw 0x0142, 0x8000, 0xfc00, 0x7c00, 0x7e00   ;   -zero      -inf       +inf
+    dw 0x0143, 0x8000, 0xfc00, 0xfc00, 0x7e00   ;   -zero      -inf       -inf
+    dw 0x0144, 0x8000, 0xfc00, 0x7e00, 0x7e00   ;   -zero      -inf       +qnan
+    dw 0x0145, 0x8000, 0x7e00, 0x0000, 0x7e00   ;   -zero      +qnan      +zero
+    dw 0x0146, 0x8000, 0x7e00, 0x8000, 0x7e00   ;   -zero      +qnan      -zero
+    dw 0x0147, 0x8000, 0x7e00, 0x0001, 0x7e00   ;   -zero      +qnan      +min_sub
+    dw 0x0148, 0x8000, 0x7e00, 0x8400, 0x7e00   ;   -zero      +qnan      -min_norm
+    dw 0x0149, 0x8000, 0x7e00, 0x3c00, 0x7e00   ;   -zero      +qnan      +one
+    dw 0x014a, 0x8000, 0x7e00, 0xbc00, 0x7e00   ;   -zero      +qnan      -one
+    dw 0x014b, 0x8000, 0x7e00, 0x3c01, 0x7e00   ;   -zero      +qnan      +one_eps
+    dw 0x014c, 0x8000, 0x7e00, 0xc200, 0x7e00   ;   -zero      +qnan      -three
+    dw 0x014d, 0x8000, 0x7e00, 0x7bff, 0x7e00   ;   -zero      +qnan      +max
+    dw 0x014e, 0x8000, 0x7e00, 0xfbff, 0x7e00   ;   -zero      +qnan      -max
+    dw 0x014f, 0x8000, 0x7e00, 0x7c00, 0x7e00   ;   -zero      +qnan      +inf
+    dw 0x0150, 0x8000, 0x7e00, 0xfc00, 0x7e00   ;   -zero      +qnan      -inf
+    dw 0x0151, 0x8000, 0x7e00, 0x7e00, 0x7e00   ;   -zero      +qnan      +qnan
+    dw 0x0152, 0x0001, 0x0000, 0x0000, 0x0000   ;   +min_sub   +zero      +zero
+    dw 0x0153, 0x0001, 0x0000, 0x8000, 0x0000   ;   +min_sub   +zero      -zero
+    dw 0x0154, 0x0001, 0x0000, 0x0001, 0x0001   ;   +min_sub   +zero      +min_sub
+    dw 0x0155, 0x0001, 0x0000, 0x8400, 0x8400   ;   +min_sub   +zero      -min_norm
+    dw 0x0156, 0x0001, 0x0000, 0x3c00, 0x3c00   ;   +min_sub   +zero      +one
+    dw 0x0157, 0x0001, 0x0000, 0xbc00, 0xbc00   ;   +min_sub   +zero      -one
+    dw 0x0158, 0x0001, 0x0000, 0x3c01, 0x3c01   ;   +min_sub   +zero      +one_eps
+    dw 0x0159, 0x0001, 0x0000, 0xc200, 0xc200   ;   +min_sub   +zero      -three
+    dw 0x015a, 0x0001, 0x0000, 0x7bff, 0x7bff   ;   +min_sub   +zero      +max
+    dw 0x015b, 0x0001, 0x0000, 0xfbff, 0xfbff   ;   +min_sub   +zero      -max
+    dw 0x015c, 0x0001, 0x0000, 0x7c00, 0x7c00   ;   +min_sub   +zero      +inf
+    dw 0x015d, 0x0001, 0x0000, 0xfc00, 0xfc00   ;   +min_sub   +zero      -inf
+    dw 0x015e, 0x0001, 0x0000, 0x7e00, 0x7e00   ;   +min_sub   +zero      +qnan
+    dw 0x015f, 0x0001, 0x8000, 0x0000, 0x0000   ;   +min_sub   -zero      +zero
+    dw 0x0160, 0x0001, 0x8000, 0x8000, 0x8000   ;   +min_sub   -zero      -zero
+    dw 0x0161, 0x0001, 0x8000, 0x0001, 0x0001   ;   +min_sub   -zero      +min_sub
+    dw 0x0162, 0x0001, 0x8000, 0x8400, 0x8400   ;   +min_sub   -zero      -min_norm
+    dw 0x0163, 0x0001, 0x8000, 0x3c00, 0x3c00   ;   +min_sub   -zero      +one
+    dw 0x0164, 0x0001, 0x8000, 0xbc00, 0xbc00   ;   +min_sub   -zero      -one
+    dw 0x0165, 0x0001, 0x8000, 0x3c01, 0x3c01   ;   +min_sub   -zero      +one_eps
+    dw 0x0166, 0x0001, 0x8000, 0xc200, 0xc200   ;   +min_sub   -zero      -three
+    dw 0x0167, 0x0001, 0x8000, 0x7bff, 0x7bff   ;   +min_sub   -zero      +max
+    dw 0x0168, 0x0001, 0x8000, 0xfbff, 0xfbff   ;   +min_sub   -zero      -max
+    dw 0x0169, 0x0001, 0x8000, 0x7c00, 0x7c00   ;   +min_sub   -zero      +inf
+    dw 0x016a, 0x0001, 0x8000, 0xfc00, 0xfc00   ;   +min_sub   -zero      -inf
+    dw 0x016b, 0x0001, 0x8000, 0x7e00, 0x7e00   ;   +min_sub   -zero      +qnan
+    dw 0x016c, 0x0001, 0x0001, 0x0000, 0x0000   ;   +min_sub   +min_sub   +zero
+    dw 0x016d, 0x0001, 0x0001, 0x8000, 0x0000   ;   +min_sub   +min_sub   -zero
+    dw 0x016e, 0x0001, 0x0001, 0x0001, 0x0001   ;   +min_sub   +min_sub   +min_sub
+    dw 0x016f, 0x0001, 0x0001, 0x8400, 0x8400   ;   +min_sub   +min_sub   -min_norm
+    dw 0x0170, 0x0001, 0x0001, 0x3c00, 0x3c00   ;   +min_sub   +min_sub   +one
+    dw 0x0171, 0x0001, 0x0001, 0xbc00, 0xbc00   ;   +min_sub   +min_sub   -one
+    dw 0x0172, 0x0001, 0x0001, 0x3c01, 0x3c01   ;   +min_sub   +min_sub   +one_eps
+    dw 0x0173, 0x0001, 0x0001, 0xc200, 0xc200   ;   +min_sub   +min_sub   -three
+    dw 0x0174, 0x0001, 0x0001, 0x7bff, 0x7bff   ;   +min_sub   +min_sub   +max
+    dw 0x0175, 0x0001, 0x0001, 0xfbff, 0xfbff   ;   +min_sub   +min_sub   -max
+    dw 0x0176, 0x0001, 0x0001, 0x7c00, 0x7c00   ;   +min_sub   +min_sub   +inf
+    dw 0x0177, 0x0001, 0x0001, 0xfc00, 0xfc00   ;   +min_sub   +min_sub   -inf
+    dw 0x0178, 0x0001, 0x0001, 0x7e00, 0x7e00   ;   +min_sub   +min_sub   +qnan
+    dw 0x0179, 0x0001, 0x8400, 0x0000, 0x8000   ;   +min_sub   -min_norm  +zero
+    dw 0x017a, 0x0001, 0x8400, 0x8000, 0x8000   ;   +min_sub   -min_norm  -zero
+    dw 0x017b, 0x0001, 0x8400, 0x0001, 0x0001   ;   +min_sub   -min_norm  +min_sub
+    dw 0x017c, 0x0001, 0x8400, 0x8400, 0x8400   ;   +min_sub   -min_norm  -min_norm
+    dw 0x017d, 0x0001, 0x8400, 0x3c00, 0x3c00   ;   +min_sub   -min_norm  +one
+    dw 0x017e, 0x0001, 0x8400, 0xbc00, 0xbc00   ;   +min_sub   -min_norm  -one
+    dw 0x017f, 0x0001, 0x8400, 0x3c01, 0x3c01   ;   +min_sub   -min_norm  +one_eps
+    dw 0x0180, 0x0001, 0x8400, 0xc200, 0xc200   ;   +min_sub   -min_norm  -three
+    dw 0x0181, 0x0001, 0x8400, 0x7bff, 0x7bff   ;   +min_sub   -min_norm  +max
+    dw 0x0182, 0x0001, 0x8400, 0xfbff, 0xfbff   ;   +min_sub   -min_norm  -max
+    dw 0x0183, 0x0001, 0x8400, 0x7c00, 0x7c00   ;   +min_sub   -min_norm  +inf
+    dw 0x0184, 0x0001, 0x8400, 0xfc00, 0xfc00   ;   +min_sub   -min_norm  -inf
+    dw 0x0185, 0x0001, 0x8400, 0x7e00, 0x7e00   ;   +min_sub   -min_norm  +qnan
+    dw 0x0186, 0x0001, 0x3c00, 0x0000, 0x0001   ;   +min_sub   +one       +zero
+    dw 0x0187, 0x0001, 0x3c00, 0x8000, 0x0001   ;   +min_sub   +one       -zero
+    dw 0x0188, 0x0001, 0x3c00, 0x0001, 0x0002   ;   +min_sub   +one       +min_sub
+    dw 0x0189, 0x0001, 0x3c00, 0x8400, 0x83ff   ;   +min_sub   +one       -min_norm
+    dw 0x018a, 0x0001, 0x3c00, 0x3c00, 0x3c00   ;   +min_sub   +one       +one
+    dw 0x018b, 0x0001, 0x3c00, 0xbc00, 0xbc00   ;   +min_sub   +one       -one
+    dw 0x018c, 0x0001, 0x3c00, 0x3c01, 0x3c01   ;   +min_sub   +one       +one_eps
+    dw 0x018d, 0x0001, 0x3c00, 0xc200, 0xc200   ;   +min_sub   +one       -three
+    dw 0x018e, 0x0001, 0x3c00, 0x7bff, 0x7bff   ;   +min_sub   +one       +max
+    dw 0x018f, 0x0001, 0x3c00, 0xfbff, 0xfbff   ;   +min_sub   +one       -max
+    dw 0x0190, 0x0001, 0x3c00, 0x7c00, 0x7c00   ;   +min_sub   +one       +inf
+    dw 0x0191, 0x0001, 0x3c00, 0xfc00, 0xfc00   ;   +min_sub   +one       -inf
+    dw 0x0192, 0x0001, 0x3c00, 0x7e00, 0x7e00   ;   +min_sub   +one       +qnan
+    dw 0x0193, 0x0001, 0xbc00, 0x0000, 0x8001   ;   +min_sub   -one       +zero
+    dw 0x0194, 0x0001, 0xbc00, 0x8000, 0x8001   ;   +min_sub   -one       -zero
+    dw 0x0195, 0x0001, 0xbc00, 0x0001, 0x0000   ;   +min_sub   -one       +min_sub
+    dw 0x0196, 0x0001, 0xbc00, 0x8400, 0x8401   ;   +min_sub   -one       -min_norm
+    dw 0x0197, 0x0001, 0xbc00, 0x3c00, 0x3c00   ;   +min_sub   -one       +one
+    dw 0x0198, 0x0001, 0xbc00, 0xbc00, 0xbc00   ;   +min_sub   -one       -one
+    dw 0x0199, 0x0001, 0xbc00, 0x3c01, 0x3c01   ;   +min_sub   -one       +one_eps
+    dw 0x019a, 0x0001, 0xbc00, 0xc200, 0xc200   ;   +min_sub   -one       -three
+    dw 0x019b, 0x0001, 0xbc00, 0x7bff, 0x7bff   ;   +min_sub   -one       +max
+    dw 0x019c, 0x0001, 0xbc00, 0xfbff, 0xfbff   ;   +min_sub   -one       -max
+    dw 0x019d, 0x0001, 0xbc00, 0x7c00, 0x7c00   ;   +min_sub   -one       +inf
+    dw 0x019e, 0x0001, 0xbc00, 0xfc00, 0xfc00   ;   +min_sub   -one       -inf
+    dw 0x019f, 0x0001, 0xbc00, 0x7e00, 0x7e00   ;   +min_sub   -one       +qnan
+    dw 0x01a0, 0x0001, 0x3c01, 0x0000, 0x0001   ;   +min_sub   +one_eps   +zero
+    dw 0x01a1, 0x0001, 0x3c01, 0x8000, 0x0001   ;   +min_sub   +one_eps   -zero
+    dw 0x01a2, 0x0001, 0x3c01, 0x0001, 0x0002   ;   +min_sub   +one_eps   +min_sub
+    dw 0x01a3, 0x0001, 0x3c01, 0x8400, 0x83ff   ;   +min_sub   +one_eps   -min_norm
+    dw 0x01a4, 0x0001, 0x3c01, 0x3c00, 0x3c00   ;   +min_sub   +one_eps   +one
+    dw 0x01a5, 0x0001, 0x3c01, 0xbc00, 0xbc00   ;   +min_sub   +one_eps   -one
+    dw 0x01a6, 0x0001, 0x3c01, 0x3c01, 0x3c01   ;   +min_sub   +one_eps   +one_eps
+    dw 0x01a7, 0x0001, 0x3c01, 0xc200, 0xc200   ;   +min_sub   +one_eps   -three
+    dw 0x01a8, 0x0001, 0x3c01, 0x7bff, 0x7bff   ;   +min_sub   +one_eps   +max
+    dw 0x01a9, 0x0001, 0x3c01, 0xfbff, 0xfbff   ;   +min_sub   +one_eps   -max
+    dw 0x01aa, 0x0001, 0x3c01, 0x7c00, 0x7c00   ;   +min_sub   +one_eps   +inf
+    dw 0x01ab, 0x0001, 0x3c01, 0xfc00, 0xfc00   ;   +min_sub   +one_eps   -inf
+    dw 0x01ac, 0x0001, 0x3c01, 0x7e00, 0x7e00   ;   +min_sub   +one_eps   +qnan
+    dw 0x01ad, 0x0001, 0xc200, 0x0000, 0x8003   ;   +min_sub   -three     +zero
+    dw 0x01ae, 0x0001, 0xc200, 0x8000, 0x8003   ;   +min_sub   -three     -zero
+    dw 0x01af, 0x0001, 0xc200, 0x0001, 0x8002   ;   +min_sub   -three     +min_sub
+    dw 0x01b0, 0x0001, 0xc200, 0x8400, 0x8403   ;   +min_sub   -three     -min_norm
+    dw 0x01b1, 0x0001, 0xc200, 0x3c00, 0x3c00   ;   +min_sub   -three     +one
+    dw 0x01b2, 0x0001, 0xc200, 0xbc00, 0xbc00   ;   +min_sub   -three     -one
+    dw 0x01b3, 0x0001, 0xc200, 0x3c01, 0x3c01   ;   +min_sub   -three     +one_eps
+    dw 0x01b4, 0x0001, 0xc200, 0xc200, 0xc200   ;   +min_sub   -three     -three
+    dw 0x01b5, 0x0001, 0xc200, 0x7bff, 0x7bff   ;   +min_sub   -three     +max
+    dw 0x01b6, 0x0001, 0xc200, 0xfbff, 0xfbff   ;   +min_sub   -three     -max
+    dw 0x01b7, 0x0001, 0xc200, 0x7c00, 0x7c00   ;   +min_sub   -three     +inf
+    dw 0x01b8, 0x0001, 0xc200, 0xfc00, 0xfc00   ;   +min_sub   -three     -inf
+    dw 0x01b9, 0x0001, 0xc200, 0x7e00, 0x7e00   ;   +min_sub   -three     +qnan
+    dw 0x01ba, 0x0001, 0x7bff, 0x0000, 0x1bff   ;   +min_sub   +max       +zero
+    dw 0x01bb, 0x0001, 0x7bff, 0x8000, 0x1bff   ;   +min_sub   +max       -zero
+    dw 0x01bc, 0x0001, 0x7bff, 0x0001, 0x1bff   ;   +min_sub   +max       +min_sub
+    dw 0x01bd, 0x0001, 0x7bff, 0x8400, 0x1bdf   ;   +min_sub   +max       -min_norm
+    dw 0x01be, 0x0001, 0x7bff, 0x3c00, 0x3c04   ;   +min_sub   +max       +one
+    dw 0x01bf, 0x0001, 0x7bff, 0xbc00, 0xbbf8   ;   +min_sub   +max       -one
+    dw 0x01c0, 0x0001, 0x7bff, 0x3c01, 0x3c05   ;   +min_sub   +max       +one_eps
+    dw 0x01c1, 0x0001, 0x7bff, 0xc200, 0xc1fe   ;   +min_sub   +max       -three
+    dw 0x01c2, 0x0001, 0x7bff, 0x7bff, 0x7bff   ;   +min_sub   +max       +max
+    dw 0x01c3, 0x0001, 0x7bff, 0xfbff, 0xfbff   ;   +min_sub   +max       -max
+    dw 0x01c4, 0x0001, 0x7bff, 0x7c00, 0x7c00   ;   +min_sub   +max       +inf
+    dw 0x01c5, 0x0001, 0x7bff, 0xfc00, 0xfc00   ;   +min_sub   +max       -inf
+    dw 0x01c6, 0x0001, 0x7bff, 0x7e00, 0x7e00   ;   +min_sub   +max       +qnan
+    dw 0x01c7, 0x0001, 0xfbff, 0x0000, 0x9bff   ;   +min_sub   -max       +zero
+    dw 0x01c8, 0x0001, 0xfbff, 0x8000, 0x9bff   ;   +min_sub   -max       -zero
+    dw 0x01c9, 0x0001, 0xfbff, 0x0001, 0x9bff   ;   +min_sub   -max       +min_sub
+    dw 0x01ca, 0x0001, 0xfbff, 0x8400, 0x9c10   ;   +min_sub   -max       -min_norm
+    dw 0x01cb, 0x0001, 0xfbff, 0x3c00, 0x3bf8   ;   +min_sub   -max       +one
+    dw 0x01cc, 0x0001, 0xfbff, 0xbc00, 0xbc04   ;   +min_sub   -max       -one
+    dw 0x01cd, 0x0001, 0xfbff, 0x3c01, 0x3bfa   ;   +min_sub   -max       +one_eps
+    dw 0x01ce, 0x0001, 0xfbff, 0xc200, 0xc202   ;   +min_sub   -max       -three
+    dw 0x01cf, 0x0001, 0xfbff, 0x7bff, 0x7bff   ;   +min_sub   -max       +max
+    dw 0x01d0, 0x0001, 0xfbff, 0xfbff, 0xfbff   ;   +min_sub   -max       -max
+    dw 0x01d1, 0x0001, 0xfbff, 0x7c00, 0x7c00   ;   +min_sub   -max       +inf
+    dw 0x01d2, 0x0001, 0xfbff, 0xfc00, 0xfc00   ;   +min_sub   -max       -inf
+    dw 0x01d3, 0x0001, 0xfbff, 0x7e00, 0x7e00   ;   +min_sub   -max       +qnan
+    dw 0x01d4, 0x0001, 0x7c00, 0x0000, 0x7c00   ;   +min_sub   +inf       +zero
+    dw 0x01d5, 0x0001, 0x7c00, 0x8000, 0x7c00   ;   +min_sub   +inf       -zero
+    dw 0x01d6, 0x0001, 0x7c00, 0x0001, 0x7c00   ;   +min_sub   +inf       +min_sub
+    dw 0x01d7, 0x0001, 0x7c00, 0x8400, 0x7c00   ;   +min_sub   +inf       -min_norm
+    dw 0x01d8, 0x0001, 0x7c00, 0x3c00, 0x7c00   ;   +min_sub   +inf       +one
+    dw 0x01d9, 0x0001, 0x7c00, 0xbc00, 0x7c00   ;   +min_sub   +inf       -one
+    dw 0x01da, 0x0001, 0x7c00, 0x3c01, 0x7c00   ;   +min_sub   +inf       +one_eps
+    dw 0x01db, 0x0001, 0x7c00, 0xc200, 0x7c00   ;   +min_sub   +inf       -three
+    dw 0x01dc, 0x0001, 0x7c00, 0x7bff, 0x7c00   ;   +min_sub   +inf       +max
+    dw 0x01dd, 0x0001, 0x7c00, 0xfbff, 0x7c00   ;   +min_sub   +inf       -max
+    dw 0x01de, 0x0001, 0x7c00, 0x7c00, 0x7c00   ;   +min_sub   +inf       +inf
+    dw 0x01df, 0x0001, 0x7c00, 0xfc00, 0x7e00   ;   +min_sub   +inf       -inf
+    dw 0x01e0, 0x0001, 0x7c00, 0x7e00, 0x7e00   ;   +min_sub   +inf       +qnan
+    dw 0x01e1, 0x0001, 0xfc00, 0x0000, 0xfc00   ;   +min_sub   -inf       +zero
+    dw 0x01e2, 0x0001, 0xfc00, 0x8000, 0xfc00   ;   +min_sub   -inf       -zero
+    dw 0x01e3, 0x0001, 0xfc00, 0x0001, 0xfc00   ;   +min_sub   -inf       +min_sub
+    dw 0x01e4, 0x0001, 0xfc00, 0x8400, 0xfc00   ;   +min_sub   -inf       -min_norm
+    dw 0x01e5, 0x0001, 0xfc00, 0x3c00, 0xfc00   ;   +min_sub   -inf       +one
+    dw 0x01e6, 0x0001, 0xfc00, 0xbc00, 0xfc00   ;   +min_sub   -inf       -one
+    dw 0x01e7, 0x0001, 0xfc00, 0x3c01, 0xfc00   ;   +min_sub   -inf       +one_eps
+    dw 0x01e8, 0x0001, 0xfc00, 0xc200, 0xfc00   ;   +min_sub   -inf       -three
+    dw 0x01e9, 0x0001, 0xfc00, 0x7bff, 0xfc00   ;   +min_sub   -inf       +max
+    dw 0x01ea, 0x0001, 0xfc00, 0xfbff, 0xfc00   ;   +min_sub   -inf       -max
+    dw 0x01eb, 0x0001, 0xfc00, 0x7c00, 0x7e00   ;   +min_sub   -inf       +inf
+    dw 0x01ec, 0x0001, 0xfc00, 0xfc00, 0xfc00   ;   +min_sub   -inf       -inf
+    dw 0x01ed, 0x0001, 0xfc00, 0x7e00, 0x7e00   ;   +min_sub   -inf       +qnan
+    dw 0x01ee, 0x0001, 0x7e00, 0x0000, 0x7e00   ;   +min_sub   +qnan      +zero
+    dw 0x01ef, 0x0001, 0x7e00, 0x8000, 0x7e00   ;   +min_sub   +qnan      -zero
+    dw 0x01f0, 0x0001, 0x7e00, 0x0001, 0x7e00   ;   +min_sub   +qnan      +min_sub
+    dw 0x01f1, 0x0001, 0x7e00, 0x8400, 0x7e00   ;   +min_sub   +qnan      -min_norm
+    dw 0x01f2, 0x0001, 0x7e00, 0x3c00, 0x7e00   ;   +min_sub   +qnan      +one
+    dw 0x01f3, 0x0001, 0x7e00, 0xbc00, 0x7e00   ;   +min_sub   +qnan      -one
+    dw 0x01f4, 0x0001, 0x7e00, 0x3c01, 0x7e00   ;   +min_sub   +qnan      +one_eps
+    dw 0x01f5, 0x0001, 0x7e00, 0xc200, 0x7e00   ;   +min_sub   +qnan      -three
+    dw 0x01f6, 0x0001, 0x7e00, 0x7bff, 0x7e00   ;   +min_sub   +qnan      +max
+    dw 0x01f7, 0x0001, 0x7e00, 0xfbff, 0x7e00   ;   +min_sub   +qnan      -max
+    dw 0x01f8, 0x0001, 0x7e00, 0x7c00, 0x7e00   ;   +min_sub   +qnan      +inf
+    dw 0x01f9, 0x0001, 0x7e00, 0xfc00, 0x7e00   ;   +min_sub   +qnan      -inf
+    dw 0x01fa, 0x0001, 0x7e00, 0x7e00, 0x7e00   ;   +min_sub   +qnan      +qnan
+    dw 0x01fb, 0x8400, 0x0000, 0x0000, 0x0000   ;   -min_norm  +zero      +zero
+    dw 0x01fc, 0x8400, 0x0000, 0x8000, 0x8000   ;   -min_norm  +zero      -zero
+    dw 0x01fd, 0x8400, 0x0000, 0x0001, 0x0001   ;   -min_norm  +zero      +min_sub
+    dw 0x01fe, 0x8400, 0x0000, 0x8400, 0x8400   ;   -min_norm  +zero      -min_norm
+    dw 0x01ff, 0x8400, 0x0000, 0x3c00, 0x3c00   ;   -min_norm  +zero      +one
+    dw 0x0200, 0x8400, 0x0000, 0xbc00, 0xbc00   ;   -min_norm  +zero      -one
+    dw 0x0201, 0x8400, 0x0000, 0x3c01, 0x3c01   ;   -min_norm  +zero      +one_eps
+    dw 0x0202, 0x8400, 0x0000, 0xc200, 0xc200   ;   -min_norm  +zero      -three
+    dw 0x0203, 0x8400, 0x0000, 0x7bff, 0x7bff   ;   -min_norm  +zero      +max
+    dw 0x0204, 0x8400, 0x0000, 0xfbff, 0xfbff   ;   -min_norm  +zero      -max
+    dw 0x0205, 0x8400, 0x0000, 0x7c00, 0x7c00   ;   -min_norm  +zero      +inf
+    dw 0x0206, 0x8400, 0x0000, 0xfc00, 0xfc00   ;   -min_norm  +zero      -inf
+    dw 0x0207, 0x8400, 0x0000, 0x7e00, 0x7e00   ;   -min_norm  +zero      +qnan
+    dw 0x0208, 0x8400, 0x8000, 0x0000, 0x0000   ;   -min_norm  -zero      +zero
+    dw 0x0209, 0x8400, 0x8000, 0x8000, 0x0000   ;   -min_norm  -zero      -zero
+    dw 0x020a, 0x8400, 0x8000, 0x0001, 0x0001   ;   -min_norm  -zero      +min_sub
+    dw 0x020b, 0x8400, 0x8000, 0x8400, 0x8400   ;   -min_norm  -zero      -min_norm
+    dw 0x020c, 0x8400, 0x8000, 0x3c00, 0x3c00   ;   -min_norm  -zero      +one
+    dw 0x020d, 0x8400, 0x8000, 0xbc00, 0xbc00   ;   -min_norm  -zero      -one
+    dw 0x020e, 0x8400, 0x8000, 0x3c01, 0x3c01   ;   -min_norm  -zero      +one_eps
+    dw 0x020f, 0x8400, 0x8000, 0xc200, 0xc200   ;   -min_norm  -zero      -three
+    dw 0x0210, 0x8400, 0x8000, 0x7bff, 0x7bff   ;   -min_norm  -zero      +max
+    dw 0x0211, 0x8400, 0x8000, 0xfbff, 0xfbff   ;   -min_norm  -zero      -max
+    dw 0x0212, 0x8400, 0x8000, 0x7c00, 0x7c00   ;   -min_norm  -zero      +inf
+    dw 0x0213, 0x8400, 0x8000, 0xfc00, 0xfc00   ;   -min_norm  -zero      -inf
+    dw 0x0214, 0x8400, 0x8000, 0x7e00, 0x7e00   ;   -min_norm  -zero      +qnan
+    dw 0x0215, 0x8400, 0x0001, 0x0000, 0x8000   ;   -min_norm  +min_sub   +zero
+    dw 0x0216, 0x8400, 0x0001, 0x8000, 0x8000   ;   -min_norm  +min_sub   -zero
+    dw 0x0217, 0x8400, 0x0001, 0x0001, 0x0001   ;   -min_norm  +min_sub   +min_sub
+    dw 0x0218, 0x8400, 0x0001, 0x8400, 0x8400   ;   -min_norm  +min_sub   -min_norm
+    dw 0x0219, 0x8400, 0x0001, 0x3c00, 0x3c00   ;   -min_norm  +min_sub   +one
+    dw 0x021a, 0x8400, 0x0001, 0xbc00, 0xbc00   ;   -min_norm  +min_sub   -one
+    dw 0x021b, 0x8400, 0x0001, 0x3c01, 0x3c01   ;   -min_norm  +min_sub   +one_eps
+    dw 0x021c, 0x8400, 0x0001, 0xc200, 0xc200   ;   -min_norm  +min_sub   -three
+    dw 0x021d, 0x8400, 0x0001, 0x7bff, 0x7bff   ;   -min_norm  +min_sub   +max
+    dw 0x021e, 0x8400, 0x0001, 0xfbff, 0xfbff   ;   -min_norm  +min_sub   -max
+    dw 0x021f, 0x8400, 0x0001, 0x7c00, 0x7c00   ;   -min_norm  +min_sub   +inf
+    dw 0x0220, 0x8400, 0x0001, 0xfc00, 0xfc00   ;   -min_norm  +min_sub   -inf
+    dw 0x0221, 0x8400, 0x0001, 0x7e00, 0x7e00   ;   -min_norm  +min_sub   +qnan
+    dw 0x0222, 0x8400, 0x8400, 0x0000, 0x0000   ;   -min_norm  -min_norm  +zero
+    dw 0x0223, 0x8400, 0x8400, 0x8000, 0x0000   ;   -min_norm  -min_norm  -zero
+    dw 0x0224, 0x8400, 0x8400, 0x0001, 0x0001   ;   -min_norm  -min_norm  +min_sub
+    dw 0x0225, 0x8400, 0x8400, 0x8400, 0x8400   ;   -min_norm  -min_norm  -min_norm
+    dw 0x0226, 0x8400, 0x8400, 0x3c00, 0x3c00   ;   -min_norm  -min_norm  +one
+    dw 0x0227, 0x8400, 0x8400, 0xbc00, 0xbc00   ;   -min_norm  -min_norm  -one
+    dw 0x0228, 0x8400, 0x8400, 0x3c01, 0x3c01   ;   -min_norm  -min_norm  +one_eps
+    dw 0x0229, 0x8400, 0x8400, 0xc200, 0xc200   ;   -min_norm  -min_norm  -three
+    dw 0x022a, 0x8400, 0x8400, 0x7bff, 0x7bff   ;   -min_norm  -min_norm  +max
+    dw 0x022b, 0x8400, 0x8400, 0xfbff, 0xfbff   ;   -min_norm  -min_norm  -max
+    dw 0x022c, 0x8400, 0x8400, 0x7c00, 0x7c00   ;   -min_norm  -min_norm  +inf
+    dw 0x022d, 0x8400, 0x8400, 0xfc00, 0xfc00   ;   -min_norm  -min_norm  -inf
+    dw 0x022e, 0x8400, 0x8400, 0x7e00, 0x7e00   ;   -min_norm  -min_norm  +qnan
+    dw 0x022f, 0x8400, 0x3c00, 0x0000, 0x8400   ;   -min_norm  +one       +zero
+    dw 0x0230, 0x8400, 0x3c00, 0x8000, 0x8400   ;   -min_norm  +one       -zero
+    dw 0x0231, 0x8400, 0x3c00, 0x0001, 0x83ff   ;   -min_norm  +one       +min_sub
+    dw 0x0232, 0x8400, 0x3c00, 0x8400, 0x8800   ;   -min_norm  +one       -min_norm
+    dw 0x0233, 0x8400, 0x3c00, 0x3c00, 0x3c00   ;   -min_norm  +one       +one
+    dw 0x0234, 0x8400, 0x3c00, 0xbc00, 0xbc00   ;   -min_norm  +one       -one
+    dw 0x0235, 0x8400, 0x3c00, 0x3c01, 0x3c01   ;   -min_norm  +one       +one_eps
+    dw 0x0236, 0x8400, 0x3c00, 0xc200, 0xc200   ;   -min_norm  +one       -three
+    dw 0x0237, 0x8400, 0x3c00, 0x7bff, 0x7bff   ;   -min_norm  +one       +max
+    dw 0x0238, 0x8400, 0x3c00, 0xfbff, 0xfbff   ;   -min_norm  +one       -max
+    dw 0x0239, 0x8400, 0x3c00, 0x7c00, 0x7c00   ;   -min_norm  +one       +inf
+    dw 0x023a, 0x8400, 0x3c00, 0xfc00, 0xfc00   ;   -min_norm  +one       -inf
+    dw 0x023b, 0x8400, 0x3c00, 0x7e00, 0x7e00   ;   -min_norm  +one       +qnan
+    dw 0x023c, 0x8400, 0xbc00, 0x0000, 0x0400   ;   -min_norm  -one       +zero
+    dw 0x023d, 0x8400, 0xbc00, 0x8000, 0x0400   ;   -min_norm  -one       -zero
+    dw 0x023e, 0x8400, 0xbc00, 0x0001, 0x0401   ;   -min_norm  -one       +min_sub
+    dw 0x023f, 0x8400, 0xbc00, 0x8400, 0x0000   ;   -min_norm  -one       -min_norm
+    dw 0x0240, 0x8400, 0xbc00, 0x3c00, 0x3c00   ;   -min_norm  -one       +one
+    dw 0x0241, 0x8400, 0xbc00, 0xbc00, 0xbc00   ;   -min_norm  -one       -one
+    dw 0x0242, 0x8400, 0xbc00, 0x3c01, 0x3c01   ;   -min_norm  -one       +one_eps
+    dw 0x0243, 0x8400, 0xbc00, 0xc200, 0xc200   ;   -min_norm  -one       -three
+    dw 0x0244, 0x8400, 0xbc00, 0x7bff, 0x7bff   ;   -min_norm  -one       +max
+    dw 0x0245, 0x8400, 0xbc00, 0xfbff, 0xfbff   ;   -min_norm  -one       -max
+    dw 0x0246, 0x8400, 0xbc00, 0x7c00, 0x7c00   ;   -min_norm  -one       +inf
+    dw 0x0247, 0x8400, 0xbc00, 0xfc00, 0xfc00   ;   -min_norm  -one       -inf
+    dw 0x0248, 0x8400, 0xbc00, 0x7e00, 0x7e00   ;   -min_norm  -one       +qnan
+    dw 0x0249, 0x8400, 0x3c01, 0x0000, 0x8401   ;   -min_norm  +one_eps   +zero
+    dw 0x024a, 0x8400, 0x3c01, 0x8000, 0x8401   ;   -min_norm  +one_eps   -zero
+    dw 0x024b, 0x8400, 0x3c01, 0x0001, 0x8400   ;   -min_norm  +one_eps   +min_sub
+    dw 0x024c, 0x8400, 0x3c01, 0x8400, 0x8800   ;   -min_norm  +one_eps   -min_norm
+    dw 0x024d, 0x8400, 0x3c01, 0x3c00, 0x3c00   ;   -min_norm  +one_eps   +one
+    dw 0x024e, 0x8400, 0x3c01, 0xbc00, 0xbc00   ;   -min_norm  +one_eps   -one
+    dw 0x024f, 0x8400, 0x3c01, 0x3c01, 0x3c01   ;   -min_norm  +one_eps   +one_eps
+    dw 0x0250, 0x8400, 0x3c01, 0xc200, 0xc200   ;   -min_norm  +one_eps   -three
+    dw 0x0251, 0x8400, 0x3c01, 0x7bff, 0x7bff   ;   -min_norm  +one_eps   +max
+    dw 0x0252, 0x8400, 0x3c01, 0xfbff, 0xfbff   ;   -min_norm  +one_eps   -max
+    dw 0x0253, 0x8400, 0x3c01, 0x7c00, 0x7c00   ;   -min_norm  +one_eps   +inf
+    dw 0x0254, 0x8400, 0x3c01, 0xfc00, 0xfc00   ;   -min_norm  +one_eps   -inf
+    dw 0x0255, 0x8400, 0x3c01, 0x7e00, 0x7e00   ;   -min_norm  +one_eps   +qnan
+    dw 0x0256, 0x8400, 0xc200, 0x0000, 0x0a00   ;   -min_norm  -three     +zero
+    dw 0x0257, 0x8400, 0xc200, 0x8000, 0x0a00   ;   -min_norm  -three     -zero
+    dw 0x0258, 0x8400, 0xc200, 0x0001, 0x0a00   ;   -min_norm  -three     +min_sub
+    dw 0x0259, 0x8400, 0xc200, 0x8400, 0x0800   ;   -min_norm  -three     -min_norm
+    dw 0x025a, 0x8400, 0xc200, 0x3c00, 0x3c00   ;   -min_norm  -three     +one
+    dw 0x025b, 0x8400, 0xc200, 0xbc00, 0xbc00   ;   -min_norm  -three     -one
+    dw 0x025c, 0x8400, 0xc200, 0x3c01, 0x3c01   ;   -min_norm  -three     +one_eps
+    dw 0x025d, 0x8400, 0xc200, 0xc200, 0xc200   ;   -min_norm  -three     -three
+    dw 0x025e, 0x8400, 0xc200, 0x7bff, 0x7bff   ;   -min_norm  -three     +max
+    dw 0x025f, 0x8400, 0xc200, 0xfbff, 0xfbff   ;   -min_norm  -three     -max
+    dw 0x0260, 0x8400, 0xc200, 0x7c00, 0x7c00   ;   -min_norm  -three     +inf
+    dw 0x0261, 0x8400, 0xc200, 0xfc00, 0xfc00   ;   -min_norm  -three     -inf
+    dw 0x0262, 0x8400, 0xc200, 0x7e00, 0x7e00   ;   -min_norm  -three     +qnan
+    dw 0x0263, 0x8400, 0x7bff, 0x0000, 0xc3ff   ;   -min_norm  +max       +zero
+    dw 0x0264, 0x8400, 0x7bff, 0x8000, 0xc3ff   ;   -min_norm  +max       -zero
+    dw 0x0265, 0x8400, 0x7bff, 0x0001, 0xc3ff   ;   -min_norm  +max       +min_sub
+    dw 0x0266, 0x8400, 0x7bff, 0x8400, 0xc3ff   ;   -min_norm  +max       -min_norm
+    dw 0x0267, 0x8400, 0x7bff, 0x3c00, 0xc1ff   ;   -min_norm  +max       +one
+    dw 0x0268, 0x8400, 0x7bff, 0xbc00, 0xc500   ;   -min_norm  +max       -one
+    dw 0x0269, 0x8400, 0x7bff, 0x3c01, 0xc1fe   ;   -min_norm  +max       +one_eps
+    dw 0x026a, 0x8400, 0x7bff, 0xc200, 0xc700   ;   -min_norm  +max       -three
+    dw 0x026b, 0x8400, 0x7bff, 0x7bff, 0x7bff   ;   -min_norm  +max       +max
+    dw 0x026c, 0x8400, 0x7bff, 0xfbff, 0xfbff   ;   -min_norm  +max       -max
+    dw 0x026d, 0x8400, 0x7bff, 0x7c00, 0x7c00   ;   -min_norm  +max       +inf
+    dw 0x026e, 0x8400, 0x7bff, 0xfc00, 0xfc00   ;   -min_norm  +max       -inf
+    dw 0x026f, 0x8400, 0x7bff, 0x7e00, 0x7e00   ;   -min_norm  +max       +qnan
+    dw 0x0270, 0x8400, 0xfbff, 0x0000, 0x43ff   ;   -min_norm  -max       +zero
+    dw 0x0271, 0x8400, 0xfbff, 0x8000, 0x43ff   ;   -min_norm  -max       -zero
+    dw 0x0272, 0x8400, 0xfbff, 0x0001, 0x43ff   ;   -min_norm  -max       +min_sub
+    dw 0x0273, 0x8400, 0xfbff, 0x8400, 0x43ff   ;   -min_norm  -max       -min_norm
+    dw 0x0274, 0x8400, 0xfbff, 0x3c00, 0x4500   ;   -min_norm  -max       +one
+    dw 0x0275, 0x8400, 0xfbff, 0xbc00, 0x41ff   ;   -min_norm  -max       -one
+    dw 0x0276, 0x8400, 0xfbff, 0x3c01, 0x4500   ;   -min_norm  -max       +one_eps
+    dw 0x0277, 0x8400, 0xfbff, 0xc200, 0x3bfc   ;   -min_norm  -max       -three
+    dw 0x0278, 0x8400, 0xfbff, 0x7bff, 0x7bff   ;   -min_norm  -max       +max
+    dw 0x0279, 0x8400, 0xfbff, 0xfbff, 0xfbff   ;   -min_norm  -max       -max
+    dw 0x027a, 0x8400, 0xfbff, 0x7c00, 0x7c00   ;   -min_norm  -max       +inf
+    dw 0x027b, 0x8400, 0xfbff, 0xfc00, 0xfc00   ;   -min_norm  -max       -inf
+    dw 0x027c, 0x8400, 0xfbff, 0x7e00, 0x7e00   ;   -min_norm  -max       +qnan
+    dw 0x027d, 0x8400, 0x7c00, 0x0000, 0xfc00   ;   -min_norm  +inf       +zero
+    dw 0x027e, 0x8400, 0x7c00, 0x8000, 0xfc00   ;   -min_norm  +inf       -zero
+    dw 0x027f, 0x8400, 0x7c00, 0x0001, 0xfc00   ;   -min_norm  +inf       +min_sub
+    dw 0x0280, 0x8400, 0x7c00, 0x8400, 0xfc00   ;   -min_norm  +inf       -min_norm
+    dw 0x0281, 0x8400, 0x7c00, 0x3c00, 0xfc00   ;   -min_norm  +inf       +one
+    dw 0x0282, 0x8400, 0x7c00, 0xbc00, 0xfc00   ;   -min_norm  +inf       -one
+    dw 0x0283, 0x8400, 0x7c00, 0x3c01, 0xfc00   ;   -min_norm  +inf       +one_eps
+    dw 0x0284, 0x8400, 0x7c00, 0xc200, 0xfc00   ;   -min_norm  +inf       -three
+    dw 0x0285, 0x8400, 0x7c00, 0x7bff, 0xfc00   ;   -min_norm  +inf       +max
+    dw 0x0286, 0x8400, 0x7c00, 0xfbff, 0xfc00   ;   -min_norm  +inf       -max
+    dw 0x0287, 0x8400, 0x7c00, 0x7c00, 0x7e00   ;   -min_norm  +inf       +inf
+    dw 0x0288, 0x8400, 0x7c00, 0xfc00, 0xfc00   ;   -min_norm  +inf       -inf
+    dw 0x0289, 0x8400, 0x7c00, 0x7e00, 0x7e00   ;   -min_norm  +inf       +qnan
+    dw 0x028a, 0x8400, 0xfc00, 0x0000, 0x7c00   ;   -min_norm  -inf       +zero
+    dw 0x028b, 0x8400, 0xfc00, 0x8000, 0x7c00   ;   -min_norm  -inf       -zero
+    dw 0x028c, 0x8400, 0xfc00, 0x0001, 0x7c00   ;   -min_norm  -inf       +min_sub
+    dw 0x028d, 0x8400, 0xfc00, 0x8400, 0x7c00   ;   -min_norm  -inf       -min_norm
+    dw 0x028e, 0x8400, 0xfc00, 0x3c00, 0x7c00   ;   -min_norm  -inf       +one
+    dw 0x028f, 0x8400, 0xfc00, 0xbc00, 0x7c00   ;   -min_norm  -inf       -one
+    dw 0x0290, 0x8400, 0xfc00, 0x3c01, 0x7c00   ;   -min_norm  -inf       +one_eps
+    dw 0x0291, 0x8400, 0xfc00, 0xc200, 0x7c00   ;   -min_norm  -inf       -three
+    dw 0x0292, 0x8400, 0xfc00, 0x7bff, 0x7c00   ;   -min_norm  -inf       +max
+    dw 0x0293, 0x8400, 0xfc00, 0xfbff, 0x7c00   ;   -min_norm  -inf       -max
+    dw 0x0294, 0x8400, 0xfc00, 0x7c00, 0x7c00   ;   -min_norm  -inf       +inf
+    dw 0x0295, 0x8400, 0xfc00, 0xfc00, 0x7e00   ;   -min_norm  -inf       -inf
+    dw 0x0296, 0x8400, 0xfc00, 0x7e00, 0x7e00   ;   -min_norm  -inf       +qnan
+    dw 0x0297, 0x8400, 0x7e00, 0x0000, 0x7e00   ;   -min_norm  +qnan      +zero
+    dw 0x0298, 0x8400, 0x7e00, 0x8000, 0x7e00   ;   -min_norm  +qnan      -zero
+    dw 0x0299, 0x8400, 0x7e00, 0x0001, 0x7e00   ;   -min_norm  +qnan      +min_sub
+    dw 0x029a, 0x8400, 0x7e00, 0x8400, 0x7e00   ;   -min_norm  +qnan      -min_norm
+    dw 0x029b, 0x8400, 0x7e00, 0x3c00, 0x7e00   ;   -min_norm  +qnan      +one
+    dw 0x029c, 0x8400, 0x7e00, 0xbc00, 0x7e00   ;   -min_norm  +qnan      -one
+    dw 0x029d, 0x8400, 0x7e00, 0x3c01, 0x7e00   ;   -min_norm  +qnan      +one_eps
+    dw 0x029e, 0x8400, 0x7e00, 0xc200, 0x7e00   ;   -min_norm  +qnan      -three
+    dw 0x029f, 0x8400, 0x7e00, 0x7bff, 0x7e00   ;   -min_norm  +qnan      +max
+    dw 0x02a0, 0x8400, 0x7e00, 0xfbff, 0x7e00   ;   -min_norm  +qnan      -max
+    dw 0x02a1, 0x8400, 0x7e00, 0x7c00, 0x7e00   ;   -min_norm  +qnan      +inf
+    dw 0x02a2, 0x8400, 0x7e00, 0xfc00, 0x7e00   ;   -min_norm  +qnan      -inf
+    dw 0x02a3, 0x8400, 0x7e00, 0x7e00, 0x7e00   ;   -min_norm  +qnan      +qnan
+    dw 0x02a4, 0x3c00, 0x0000, 0x0000, 0x0000   ;   +one       +zero      +zero
+    dw 0x02a5, 0x3c00, 0x0000, 0x8000, 0x0000   ;   +one       +zero      -zero
+    dw 0x02a6, 0x3c00, 0x0000, 0x0001, 0x0001   ;   +one       +zero      +min_sub
+    dw 0x02a7, 0x3c00, 0x0000, 0x8400, 0x8400   ;   +one       +zero      -min_norm
+    dw 0x02a8, 0x3c00, 0x0000, 0x3c00, 0x3c00   ;   +one       +zero      +one
+    dw 0x02a9, 0x3c00, 0x0000, 0xbc00, 0xbc00   ;   +one       +zero      -one
+    dw 0x02aa, 0x3c00, 0x0000, 0x3c01, 0x3c01   ;   +one       +zero      +one_eps
+    dw 0x02ab, 0x3c00, 0x0000, 0xc200, 0xc200   ;   +one       +zero      -three
+    dw 0x02ac, 0x3c00, 0x0000, 0x7bff, 0x7bff   ;   +one       +zero      +max
+    dw 0x02ad, 0x3c00, 0x0000, 0xfbff, 0xfbff   ;   +one       +zero      -max
+    dw 0x02ae, 0x3c00, 0x0000, 0x7c00, 0x7c00   ;   +one       +zero      +inf
+    dw 0x02af, 0x3c00, 0x0000, 0xfc00, 0xfc00   ;   +one       +zero      -inf
+    dw 0x02b0, 0x3c00, 0x0000, 0x7e00, 0x7e00   ;   +one       +zero      +qnan
+    dw 0x02b1, 0x3c00, 0x8000, 0x0000, 0x0000   ;   +one       -zero      +zero
+    dw 0x02b2, 0x3c00, 0x8000, 0x8000, 0x8000   ;   +one       -zero      -zero
+    dw 0x02b3, 0x3c00, 0x8000, 0x0001, 0x0001   ;   +one       -zero      +min_sub
+    dw 0x02b4, 0x3c00, 0x8000, 0x8400, 0x8400   ;   +one       -zero      -min_norm
+    dw 0x02b5, 0x3c00, 0x8000, 0x3c00, 0x3c00   ;   +one       -zero      +one
+    dw 0x02b6, 0x3c00, 0x8000, 0xbc00, 0xbc00   ;   +one       -zero      -one
+    dw 0x02b7, 0x3c00, 0x8000, 0x3c01, 0x3c01   ;   +one       -zero      +one_eps
+    dw 0x02b8, 0x3c00, 0x8000, 0xc200, 0xc200   ;   +one       -zero      -three
+    dw 0x02b9, 0x3c00, 0x8000, 0x7bff, 0x7bff   ;   +one       -zero      +max
+    dw 0x02ba, 0x3c00, 0x8000, 0xfbff, 0xfbff   ;   +one       -zero      -max
+    dw 0x02bb, 0x3c00, 0x8000, 0x7c00, 0x7c00   ;   +one       -zero      +inf
+    dw 0x02bc, 0x3c00, 0x8000, 0xfc00, 0xfc00   ;   +one       -zero      -inf
+    dw 0x02bd, 0x3c00, 0x8000, 0x7e00, 0x7e00   ;   +one       -zero      +qnan
+    dw 0x02be, 0x3c00, 0x0001, 0x0000, 0x0001   ;   +one       +min_sub   +zero
+    dw 0x02bf, 0x3c00, 0x0001, 0x8000, 0x0001   ;   +one       +min_sub   -zero
+    dw 0x02c0, 0x3c00, 0x0001, 0x0001, 0x0002   ;   +one       +min_sub   +min_sub
+    dw 0x02c1, 0x3c00, 0x0001, 0x8400, 0x83ff   ;   +one       +min_sub   -min_norm
+    dw 0x02c2, 0x3c00, 0x0001, 0x3c00, 0x3c00   ;   +one       +min_sub   +one
+    dw 0x02c3, 0x3c00, 0x0001, 0xbc00, 0xbc00   ;   +one       +min_sub   -one
+    dw 0x02c4, 0x3c00, 0x0001, 0x3c01, 0x3c01   ;   +one       +min_sub   +one_eps
+    dw 0x02c5, 0x3c00, 0x0001, 0xc200, 0xc200   ;   +one       +min_sub   -three
+    dw 0x02c6, 0x3c00, 0x0001, 0x7bff, 0x7bff   ;   +one       +min_sub   +max
+    dw 0x02c7, 0x3c00, 0x0001, 0xfbff, 0xfbff   ;   +one       +min_sub   -max
+    dw 0x02c8, 0x3c00, 0x0001, 0x7c00, 0x7c00   ;   +one       +min_sub   +inf
+    dw 0x02c9, 0x3c00, 0x0001, 0xfc00, 0xfc00   ;   +one       +min_sub   -inf
+    dw 0x02ca, 0x3c00, 0x0001, 0x7e00, 0x7e00   ;   +one       +min_sub   +qnan
+    dw 0x02cb, 0x3c00, 0x8400, 0x0000, 0x8400   ;   +one       -min_norm  +zero
+    dw 0x02cc, 0x3c00, 0x8400, 0x8000, 0x8400   ;   +one       -min_norm  -zero
+    dw 0x02cd, 0x3c00, 0x8400, 0x0001, 0x83ff   ;   +one       -min_norm  +min_sub
+    dw 0x02ce, 0x3c00, 0x8400, 0x8400, 0x8800   ;   +one       -min_norm  -min_norm
+    dw 0x02cf, 0x3c00, 0x8400, 0x3c00, 0x3c00   ;   +one       -min_norm  +one
+    dw 0x02d0, 0x3c00, 0x8400, 0xbc00, 0xbc00   ;   +one       -min_norm  -one
+    dw 0x02d1, 0x3c00, 0x8400, 0x3c01, 0x3c01   ;   +one       -min_norm  +one_eps
+    dw 0x02d2, 0x3c00, 0x8400, 0xc200, 0xc200   ;   +one       -min_norm  -three
+    dw 0x02d3, 0x3c00, 0x8400, 0x7bff, 0x7bff   ;   +one       -min_norm  +max
+    dw 0x02d4, 0x3c00, 0x8400, 0xfbff, 0xfbff   ;   +one       -min_norm  -max
+    dw 0x02d5, 0x3c00, 0x8400, 0x7c00, 0x7c00   ;   +one       -min_norm  +inf
+    dw 0x02d6, 0x3c00, 0x8400, 0xfc00, 0xfc00   ;   +one       -min_norm  -inf
+    dw 0x02d7, 0x3c00, 0x8400, 0x7e00, 0x7e00   ;   +one       -min_norm  +qnan
+    dw 0x02d8, 0x3c00, 0x3c00, 0x0000, 0x3c00   ;   +one       +one       +zero
+    dw 0x02d9, 0x3c00, 0x3c00, 0x8000, 0x3c00   ;   +one       +one       -zero
+    dw 0x02da, 0x3c00, 0x3c00, 0x0001, 0x3c00   ;   +one       +one       +min_sub
+    dw 0x02db, 0x3c00, 0x3c00, 0x8400, 0x3c00   ;   +one       +one       -min_norm
+    dw 0x02dc, 0x3c00, 0x3c00, 0x3c00, 0x4000   ;   +one       +one       +one
+    dw 0x02dd, 0x3c00, 0x3c00, 0xbc00, 0x0000   ;   +one       +one       -one
+    dw 0x02de, 0x3c00, 0x3c00, 0x3c01, 0x4000   ;   +one       +one       +one_eps
+    dw 0x02df, 0x3c00, 0x3c00, 0xc200, 0xc000   ;   +one       +one       -three
+    dw 0x02e0, 0x3c00, 0x3c00, 0x7bff, 0x7bff   ;   +one       +one       +max
+    dw 0x02e1, 0x3c00, 0x3c00, 0xfbff, 0xfbff   ;   +one       +one       -max
+    dw 0x02e2, 0x3c00, 0x3c00, 0x7c00, 0x7c00   ;   +one       +one       +inf
+    dw 0x02e3, 0x3c00, 0x3c00, 0xfc00, 0xfc00   ;   +one       +one       -inf
+    dw 0x02e4, 0x3c00, 0x3c00, 0x7e00, 0x7e00   ;   +one       +one       +qnan
+    dw 0x02e5, 0x3c00, 0xbc00, 0x0000, 0xbc00   ;   +one       -one       +zero
+    dw 0x02e6, 0x3c00, 0xbc00, 0x8000, 0xbc00   ;   +one       -one       -zero
+    dw 0x02e7, 0x3c00, 0xbc00, 0x0001, 0xbc00   ;   +one       -one       +min_sub
+    dw 0x02e8, 0x3c00, 0xbc00, 0x8400, 0xbc00   ;   +one       -one       -min_norm
+    dw 0x02e9, 0x3c00, 0xbc00, 0x3c00, 0x0000   ;   +one       -one       +one
+    dw 0x02ea, 0x3c00, 0xbc00, 0xbc00, 0xc000   ;   +one       -one       -one
+    dw 0x02eb, 0x3c00, 0xbc00, 0x3c01, 0x1400   ;   +one       -one       +one_eps
+    dw 0x02ec, 0x3c00, 0xbc00, 0xc200, 0xc400   ;   +one       -one       -three
+    dw 0x02ed, 0x3c00, 0xbc00, 0x7bff, 0x7bff   ;   +one       -one       +max
+    dw 0x02ee, 0x3c00, 0xbc00, 0xfbff, 0xfbff   ;   +one       -one       -max
+    dw 0x02ef, 0x3c00, 0xbc00, 0x7c00, 0x7c00   ;   +one       -one       +inf
+    dw 0x02f0, 0x3c00, 0xbc00, 0xfc00, 0xfc00   ;   +one       -one       -inf
+    dw 0x02f1, 0x3c00, 0xbc00, 0x7e00, 0x7e00   ;   +one       -one       +qnan
+    dw 0x02f2, 0x3c00, 0x3c01, 0x0000, 0x3c01   ;   +one       +one_eps   +zero
+    dw 0x02f3, 0x3c00, 0x3c01, 0x8000, 0x3c01   ;   +one       +one_eps   -zero
+    dw 0x02f4, 0x3c00, 0x3c01, 0x0001, 0x3c01   ;   +one       +one_eps   +min_sub
+    dw 0x02f5, 0x3c00, 0x3c01, 0x8400, 0x3c01   ;   +one       +one_eps   -min_norm
+    dw 0x02f6, 0x3c00, 0x3c01, 0x3c00, 0x4000   ;   +one       +one_eps   +one
+    dw 0x02f7, 0x3c00, 0x3c01, 0xbc00, 0x1400   ;   +one       +one_eps   -one
+    dw 0x02f8, 0x3c00, 0x3c01, 0x3c01, 0x4001   ;   +one       +one_eps   +one_eps
+    dw 0x02f9, 0x3c00, 0x3c01, 0xc200, 0xbfff   ;   +one       +one_eps   -three
+    dw 0x02fa, 0x3c00, 0x3c01, 0x7bff, 0x7bff   ;   +one       +one_eps   +max
+    dw 0x02fb, 0x3c00, 0x3c01, 0xfbff, 0xfbff   ;   +one       +one_eps   -max
+    dw 0x02fc, 0x3c00, 0x3c01, 0x7c00, 0x7c00   ;   +one       +one_eps   +inf
+    dw 0x02fd, 0x3c00, 0x3c01, 0xfc00, 0xfc00   ;   +one       +one_eps   -inf
+    dw 0x02fe, 0x3c00, 0x3c01, 0x7e00, 0x7e00   ;   +one       +one_eps   +qnan
+    dw 0x02ff, 0x3c00, 0xc200, 0x0000, 0xc200   ;   +one       -three     +zero
+    dw 0x0300, 0x3c00, 0xc200, 0x8000, 0xc200   ;   +one       -three     -zero
+    dw 0x0301, 0x3c00, 0xc200, 0x0001, 0xc200   ;   +one       -three     +min_sub
+    dw 0x0302, 0x3c00, 0xc200, 0x8400, 0xc200   ;   +one       -three     -min_norm
+    dw 0x0303, 0x3c00, 0xc200, 0x3c00, 0xc000   ;   +one       -three     +one
+    dw 0x0304, 0x3c00, 0xc200, 0xbc00, 0xc400   ;   +one       -three     -one
+    dw 0x0305, 0x3c00, 0xc200, 0x3c01, 0xbfff   ;   +one       -three     +one_eps
+    dw 0x0306, 0x3c00, 0xc200, 0xc200, 0xc600   ;   +one       -three     -three
+    dw 0x0307, 0x3c00, 0xc200, 0x7bff, 0x7bff   ;   +one       -three     +max
+    dw 0x0308, 0x3c00, 0xc200, 0xfbff, 0xfbff   ;   +one       -three     -max
+    dw 0x0309, 0x3c00, 0xc200, 0x7c00, 0x7c00   ;   +one       -three     +inf
+    dw 0x030a, 0x3c00, 0xc200, 0xfc00, 0xfc00   ;   +one       -three     -inf
+    dw 0x030b, 0x3c00, 0xc200, 0x7e00, 0x7e00   ;   +one       -three     +qnan
+    dw 0x030c, 0x3c00, 0x7bff, 0x0000, 0x7bff   ;   +one       +max       +zero
+    dw 0x030d, 0x3c00, 0x7bff, 0x8000, 0x7bff   ;   +one       +max       -zero
+    dw 0x030e, 0x3c00, 0x7bff, 0x0001, 0x7bff   ;   +one       +max       +min_sub
+    dw 0x030f, 0x3c00, 0x7bff, 0x8400, 0x7bff   ;   +one       +max       -min_norm
+    dw 0x0310, 0x3c00, 0x7bff, 0x3c00, 0x7bff   ;   +one       +max       +one
+    dw 0x0311, 0x3c00, 0x7bff, 0xbc00, 0x7bff   ;   +one       +max       -one
+    dw 0x0312, 0x3c00, 0x7bff, 0x3c01, 0x7bff   ;   +one       +max       +one_eps
+    dw 0x0313, 0x3c00, 0x7bff, 0xc200, 0x7bff   ;   +one       +max       -three
+    dw 0x0314, 0x3c00, 0x7bff, 0x7bff, 0x7c00   ;   +one       +max       +max
+    dw 0x0315, 0x3c00, 0x7bff, 0xfbff, 0x0000   ;   +one       +max       -max
+    dw 0x0316, 0x3c00, 0x7bff, 0x7c00, 0x7c00   ;   +one       +max       +inf
+    dw 0x0317, 0x3c00, 0x7bff, 0xfc00, 0xfc00   ;   +one       +max       -inf
+    dw 0x0318, 0x3c00, 0x7bff, 0x7e00, 0x7e00   ;   +one       +max       +qnan
+    dw 0x0319, 0x3c00, 0xfbff, 0x0000, 0xfbff   ;   +one       -max       +zero
+    dw 0x031a, 0x3c00, 0xfbff, 0x8000, 0xfbff   ;   +one       -max       -zero
+    dw 0x031b, 0x3c00, 0xfbff, 0x0001, 0xfbff   ;   +one       -max       +min_sub
+    dw 0x031c, 0x3c00, 0xfbff, 0x8400, 0xfbff   ;   +one       -max       -min_norm
+    dw 0x031d, 0x3c00, 0xfbff, 0x3c00, 0xfbff   ;   +one       -max       +one
+    dw 0x031e, 0x3c00, 0xfbff, 0xbc00, 0xfbff   ;   +one       -max       -one
+    dw 0x031f, 0x3c00, 0xfbff, 0x3c01, 0xfbff   ;   +one       -max       +one_eps
+    dw 0x0320, 0x3c00, 0xfbff, 0xc200, 0xfbff   ;   +one       -max       -three
+    dw 0x0321, 0x3c00, 0xfbff, 0x7bff, 0x0000   ;   +one       -max       +max
+    dw 0x0322, 0x3c00, 0xfbff, 0xfbff, 0xfc00   ;   +one       -max       -max
+    dw 0x0323, 0x3c00, 0xfbff, 0x7c00, 0x7c00   ;   +one       -max       +inf
+    dw 0x0324, 0x3c00, 0xfbff, 0xfc00, 0xfc00   ;   +one       -max       -inf
+    dw 0x0325, 0x3c00, 0xfbff, 0x7e00, 0x7e00   ;   +one       -max       +qnan
+    dw 0x0326, 0x3c00, 0x7c00, 0x0000, 0x7c00   ;   +one       +inf       +zero
+    dw 0x0327, 0x3c00, 0x7c00, 0x8000, 0x7c00   ;   +one       +inf       -zero
+    dw 0x0328, 0x3c00, 0x7c00, 0x0001, 0x7c00   ;   +one       +inf       +min_sub
+    dw 0x0329, 0x3c00, 0x7c00, 0x8400, 0x7c00   ;   +one       +inf       -min_norm
+    dw 0x032a, 0x3c00, 0x7c00, 0x3c00, 0x7c00   ;   +one       +inf       +one
+    dw 0x032b, 0x3c00, 0x7c00, 0xbc00, 0x7c00   ;   +one       +inf       -one
+    dw 0x032c, 0x3c00, 0x7c00, 0x3c01, 0x7c00   ;   +one       +inf       +one_eps
+    dw 0x032d, 0x3c00, 0x7c00, 0xc200, 0x7c00   ;   +one       +inf       -three
+    dw 0x032e, 0x3c00, 0x7c00, 0x7bff, 0x7c00   ;   +one       +inf       +max
+    dw 0x032f, 0x3c00, 0x7c00, 0xfbff, 0x7c00   ;   +one       +inf       -max
+    dw 0x0330, 0x3c00, 0x7c00, 0x7c00, 0x7c00   ;   +one       +inf       +inf
+    dw 0x0331, 0x3c00, 0x7c00, 0xfc00, 0x7e00   ;   +one       +inf       -inf
+    dw 0x0332, 0x3c00, 0x7c00, 0x7e00, 0x7e00   ;   +one       +inf       +qnan
+    dw 0x0333, 0x3c00, 0xfc00, 0x0000, 0xfc00   ;   +one       -inf       +zero
+    dw 0x0334, 0x3c00, 0xfc00, 0x8000, 0xfc00   ;   +one       -inf       -zero
+    dw 0x0335, 0x3c00, 0xfc00, 0x0001, 0xfc00   ;   +one       -inf       +min_sub
+    dw 0x0336, 0x3c00, 0xfc00, 0x8400, 0xfc00   ;   +one       -inf       -min_norm
+    dw 0x0337, 0x3c00, 0xfc00, 0x3c00, 0xfc00   ;   +one       -inf       +one
+    dw 0x0338, 0x3c00, 0xfc00, 0xbc00, 0xfc00   ;   +one       -inf       -one
+    dw 0x0339, 0x3c00, 0xfc00, 0x3c01, 0xfc00   ;   +one       -inf       +one_eps
+    dw 0x033a, 0x3c00, 0xfc00, 0xc200, 0xfc00   ;   +one       -inf       -three
+    dw 0x033b, 0x3c00, 0xfc00, 0x7bff, 0xfc00   ;   +one       -inf       +max
+    dw 0x033c, 0x3c00, 0xfc00, 0xfbff, 0xfc00   ;   +one       -inf       -max
+    dw 0x033d, 0x3c00, 0xfc00, 0x7c00, 0x7e00   ;   +one       -inf       +inf
+    dw 0x033e, 0x3c00, 0xfc00, 0xfc00, 0xfc00   ;   +one       -inf       -inf
+    dw 0x033f, 0x3c00, 0xfc00, 0x7e00, 0x7e00   ;   +one       -inf       +qnan
+    dw 0x0340, 0x3c00, 0x7e00, 0x0000, 0x7e00   ;   +one       +qnan      +zero
+    dw 0x0341, 0x3c00, 0x7e00, 0x8000, 0x7e00   ;   +one       +qnan      -zero
+    dw 0x0342, 0x3c00, 0x7e00, 0x0001, 0x7e00   ;   +one       +qnan      +min_sub
+    dw 0x0343, 0x3c00, 0x7e00, 0x8400, 0x7e00   ;   +one       +qnan      -min_norm
+    dw 0x0344, 0x3c00, 0x7e00, 0x3c00, 0x7e00   ;   +one       +qnan      +one
+    dw 0x0345, 0x3c00, 0x7e00, 0xbc00, 0x7e00   ;   +one       +qnan      -one
+    dw 0x0346, 0x3c00, 0x7e00, 0x3c01, 0x7e00   ;   +one       +qnan      +one_eps
+    dw 0x0347, 0x3c00, 0x7e00, 0xc200, 0x7e00   ;   +one       +qnan      -three
+    dw 0x0348, 0x3c00, 0x7e00, 0x7bff, 0x7e00   ;   +one       +qnan      +max
+    dw 0x0349, 0x3c00, 0x7e00, 0xfbff, 0x7e00   ;   +one       +qnan      -max
+    dw 0x034a, 0x3c00, 0x7e00, 0x7c00, 0x7e00   ;   +one       +qnan      +inf
+    dw 0x034b, 0x3c00, 0x7e00, 0xfc00, 0x7e00   ;   +one       +qnan      -inf
+    dw 0x034c, 0x3c00, 0x7e00, 0x7e00, 0x7e00   ;   +one       +qnan      +qnan
+    dw 0x034d, 0xbc00, 0x0000, 0x0000, 0x0000   ;   -one       +zero      +zero
+    dw 0x034e, 0xbc00, 0x0000, 0x8000, 0x8000   ;   -one       +zero      -zero
+    dw 0x034f, 0xbc00, 0x0000, 0x0001, 0x0001   ;   -one       +zero      +min_sub
+    dw 0x0350, 0xbc00, 0x0000, 0x8400, 0x8400   ;   -one       +zero      -min_norm
+    dw 0x0351, 0xbc00, 0x0000, 0x3c00, 0x3c00   ;   -one       +zero      +one
+    dw 0x0352, 0xbc00, 0x0000, 0xbc00, 0xbc00   ;   -one       +zero      -one
+    dw 0x0353, 0xbc00, 0x0000, 0x3c01, 0x3c01   ;   -one       +zero      +one_eps
+    dw 0x0354, 0xbc00, 0x0000, 0xc200, 0xc200   ;   -one       +zero      -three
+    dw 0x0355, 0xbc00, 0x0000, 0x7bff, 0x7bff   ;   -one       +zero      +max
+    dw 0x0356, 0xbc00, 0x0000, 0xfbff, 0xfbff   ;   -one       +zero      -max
+    dw 0x0357, 0xbc00, 0x0000, 0x7c00, 0x7c00   ;   -one       +zero      +inf
+    dw 0x0358, 0xbc00, 0x0000, 0xfc00, 0xfc00   ;   -one       +zero      -inf
+    dw 0x0359, 0xbc00, 0x0000, 0x7e00, 0x7e00   ;   -one       +zero      +qnan
+    dw 0x035a, 0xbc00, 0x8000, 0x0000, 0x0000   ;   -one       -zero      +zero
+    dw 0x035b, 0xbc00, 0x8000, 0x8000, 0x0000   ;   -one       -zero      -zero
+    dw 0x035c, 0xbc00, 0x8000, 0x0001, 0x0001   ;   -one       -zero      +min_sub
+    dw 0x035d, 0xbc00, 0x8000, 0x8400, 0x8400   ;   -one       -zero      -min_norm
+    dw 0x035e, 0xbc00, 0x8000, 0x3c00, 0x3c00   ;   -one       -zero      +one
+    dw 0x035f, 0xbc00, 0x8000, 0xbc00, 0xbc00   ;   -one       -zero      -one
+    dw 0x0360, 0xbc00, 0x8000, 0x3c01, 0x3c01   ;   -one       -zero      +one_eps
+    dw 0x0361, 0xbc00, 0x8000, 0xc200, 0xc200   ;   -one       -zero      -three
+    dw 0x0362, 0xbc00, 0x8000, 0x7bff, 0x7bff   ;   -one       -zero      +max
+    dw 0x0363, 0xbc00, 0x8000, 0xfbff, 0xfbff   ;   -one       -zero      -max
+    dw 0x0364, 0xbc00, 0x8000, 0x7c00, 0x7c00   ;   -one       -zero      +inf
+    dw 0x0365, 0xbc00, 0x8000, 0xfc00, 0xfc00   ;   -one       -zero      -inf
+    dw 0x0366, 0xbc00, 0x8000, 0x7e00, 0x7e00   ;   -one       -zero      +qnan
+    dw 0x0367, 0xbc00, 0x0001, 0x0000, 0x8001   ;   -one       +min_sub   +zero
+    dw 0x0368, 0xbc00, 0x0001, 0x8000, 0x8001   ;   -one       +min_sub   -zero
+    dw 0x0369, 0xbc00, 0x0001, 0x0001, 0x0000   ;   -one       +min_sub   +min_sub
+    dw 0x036a, 0xbc00, 0x0001, 0x8400, 0x8401   ;   -one       +min_sub   -min_norm
+    dw 0x036b, 0xbc00, 0x0001, 0x3c00, 0x3c00   ;   -one       +min_sub   +one
+    dw 0x036c, 0xbc00, 0x0001, 0xbc00, 0xbc00   ;   -one       +min_sub   -one
+    dw 0x036d, 0xbc00, 0x0001, 0x3c01, 0x3c01   ;   -one       +min_sub   +one_eps
+    dw 0x036e, 0xbc00, 0x0001, 0xc200, 0xc200   ;   -one       +min_sub   -three
+    dw 0x036f, 0xbc00, 0x0001, 0x7bff, 0x7bff   ;   -one       +min_sub   +max
+    dw 0x0370, 0xbc00, 0x0001, 0xfbff, 0xfbff   ;   -one       +min_sub   -max
+    dw 0x0371, 0xbc00, 0x0001, 0x7c00, 0x7c00   ;   -one       +min_sub   +inf
+    dw 0x0372, 0xbc00, 0x0001, 0xfc00, 0xfc00   ;   -one       +min_sub   -inf
+    dw 0x0373, 0xbc00, 0x0001, 0x7e00, 0x7e00   ;   -one       +min_sub   +qnan
+    dw 0x0374, 0xbc00, 0x8400, 0x0000, 0x0400   ;   -one       -min_norm  +zero
+    dw 0x0375, 0xbc00, 0x8400, 0x8000, 0x0400   ;   -one       -min_norm  -zero
+    dw 0x0376, 0xbc00, 0x8400, 0x0001, 0x0401   ;   -one       -min_norm  +min_sub
+    dw 0x0377, 0xbc00, 0x8400, 0x8400, 0x0000   ;   -one       -min_norm  -min_norm
+    dw 0x0378, 0xbc00, 0x8400, 0x3c00, 0x3c00   ;   -one       -min_norm  +one
+    dw 0x0379, 0xbc00, 0x8400, 0xbc00, 0xbc00   ;   -one       -min_norm  -one
+    dw 0x037a, 0xbc00, 0x8400, 0x3c01, 0x3c01   ;   -one       -min_norm  +one_eps
+    dw 0x037b, 0xbc00, 0x8400, 0xc200, 0xc200   ;   -one       -min_norm  -three
+    dw 0x037c, 0xbc00, 0x8400, 0x7bff, 0x7bff   ;   -one       -min_norm  +max
+    dw 0x037d, 0xbc00, 0x8400, 0xfbff, 0xfbff   ;   -one       -min_norm  -max
+    dw 0x037e, 0xbc00, 0x8400, 0x7c00, 0x7c00   ;   -one       -min_norm  +inf
+    dw 0x037f, 0xbc00, 0x8400, 0xfc00, 0xfc00   ;   -one       -min_norm  -inf
+    dw 0x0380, 0xbc00, 0x8400, 0x7e00, 0x7e00   ;   -one       -min_norm  +qnan
+    dw 0x0381, 0xbc00, 0x3c00, 0x0000, 0xbc00   ;   -one       +one       +zero
+    dw 0x0382, 0xbc00, 0x3c00, 0x8000, 0xbc00   ;   -one       +one       -zero
+    dw 0x0383, 0xbc00, 0x3c00, 0x0001, 0xbc00   ;   -one       +one       +min_sub
+    dw 0x0384, 0xbc00, 0x3c00, 0x8400, 0xbc00   ;   -one       +one       -min_norm
+    dw 0x0385, 0xbc00, 0x3c00, 0x3c00, 0x0000   ;   -one       +one       +one
+    dw 0x0386, 0xbc00, 0x3c00, 0xbc00, 0xc000   ;   -one       +one       -one
+    dw 0x0387, 0xbc00, 0x3c00, 0x3c01, 0x1400   ;   -one       +one       +one_eps
+    dw 0x0388, 0xbc00, 0x3c00, 0xc200, 0xc400   ;   -one       +one       -three
+    dw 0x0389, 0xbc00, 0x3c00, 0x7bff, 0x7bff   ;   -one       +one       +max
+    dw 0x038a, 0xbc00, 0x3c00, 0xfbff, 0xfbff   ;   -one       +one       -max
+    dw 0x038b, 0xbc00, 0x3c00, 0x7c00, 0x7c00   ;   -one       +one       +inf
+    dw 0x038c, 0xbc00, 0x3c00, 0xfc00, 0xfc00   ;   -one       +one       -inf
+    dw 0x038d, 0xbc00, 0x3c00, 0x7e00, 0x7e00   ;   -one       +one       +qnan
+    dw 0x038e, 0xbc00, 0xbc00, 0x0000, 0x3c00   ;   -one       -one       +zero
+    dw 0x038f, 0xbc00, 0xbc00, 0x8000, 0x3c00   ;   -one       -one       -zero
+    dw 0x0390, 0xbc00, 0xbc00, 0x0001, 0x3c00   ;   -one       -one       +min_sub
+    dw 0x0391, 0xbc00, 0xbc00, 0x8400, 0x3c00   ;   -one       -one       -min_norm
+    dw 0x0392, 0xbc00, 0xbc00, 0x3c00, 0x4000   ;   -one       -one       +one
+    dw 0x0393, 0xbc00, 0xbc00, 0xbc00, 0x0000   ;   -one       -one       -one
+    dw 0x0394, 0xbc00, 0xbc00, 0x3c01, 0x4000   ;   -one       -one       +one_eps
+    dw 0x0395, 0xbc00, 0xbc00, 0xc200, 0xc000   ;   -one       -one       -three
+    dw 0x0396, 0xbc00, 0xbc00, 0x7bff, 0x7bff   ;   -one       -one       +max
+    dw 0x0397, 0xbc00, 0xbc00, 0xfbff, 0xfbff   ;   -one       -one       -max
+    dw 0x0398, 0xbc00, 0xbc00, 0x7c00, 0x7c00   ;   -one       -one       +inf
+    dw 0x0399, 0xbc00, 0xbc00, 0xfc00, 0xfc00   ;   -one       -one       -inf
+    dw 0x039a, 0xbc00, 0xbc00, 0x7e00, 0x7e00   ;   -one       -one       +qnan
+    dw 0x039b, 0xbc00, 0x3c01, 0x0000, 0xbc01   ;   -one       +one_eps   +zero
+    dw 0x039c, 0xbc00, 0x3c01, 0x8000, 0xbc01   ;   -one       +one_eps   -zero
+    dw 0x039d, 0xbc00, 0x3c01, 0x0001, 0xbc01   ;   -one       +one_eps   +min_sub
+    dw 0x039e, 0xbc00, 0x3c01, 0x8400, 0xbc01   ;   -one       +one_eps   -min_norm
+    dw 0x039f, 0xbc00, 0x3c01, 0x3c00, 0x9400   ;   -one       +one_eps   +one
+    dw 0x03a0, 0xbc00, 0x3c01, 0xbc00, 0xc000   ;   -one       +one_eps   -one
+    dw 0x03a1, 0xbc00, 0x3c01, 0x3c01, 0x0000   ;   -one       +one_eps   +one_eps
+    dw 0x03a2, 0xbc00, 0x3c01, 0xc200, 0xc400   ;   -one       +one_eps   -three
+    dw 0x03a3, 0xbc00, 0x3c01, 0x7bff, 0x7bff   ;   -one       +one_eps   +max
+    dw 0x03a4, 0xbc00, 0x3c01, 0xfbff, 0xfbff   ;   -one       +one_eps   -max
+    dw 0x03a5, 0xbc00, 0x3c01, 0x7c00, 0x7c00   ;   -one       +one_eps   +inf
+    dw 0x03a6, 0xbc00, 0x3c01, 0xfc00, 0xfc00   ;   -one       +one_eps   -inf
+    dw 0x03a7, 0xbc00, 0x3c01, 0x7e00, 0x7e00   ;   -one       +one_eps   +qnan
+    dw 0x03a8, 0xbc00, 0xc200, 0x0000, 0x4200   ;   -one       -three     +zero
+    dw 0x03a9, 0xbc00, 0xc200, 0x8000, 0x4200   ;   -one       -three     -zero
+    dw 0x03aa, 0xbc00, 0xc200, 0x0001, 0x4200   ;   -one       -three     +min_sub
+    dw 0x03ab, 0xbc00, 0xc200, 0x8400, 0x4200   ;   -one       -three     -min_norm
+    dw 0x03ac, 0xbc00, 0xc200, 0x3c00, 0x4400   ;   -one       -three     +one
+    dw 0x03ad, 0xbc00, 0xc200, 0xbc00, 0x4000   ;   -one       -three     -one
+    dw 0x03ae, 0xbc00, 0xc200, 0x3c01, 0x4400   ;   -one       -three     +one_eps
+    dw 0x03af, 0xbc00, 0xc200, 0xc200, 0x0000   ;   -one       -three     -three
+    dw 0x03b0, 0xbc00, 0xc200, 0x7bff, 0x7bff   ;   -one       -three     +max
+    dw 0x03b1, 0xbc00, 0xc200, 0xfbff, 0xfbff   ;   -one       -three     -max
+    dw 0x03b2, 0xbc00, 0xc200, 0x7c00, 0x7c00   ;   -one       -three     +inf
+    dw 0x03b3, 0xbc00, 0xc200, 0xfc00, 0xfc00   ;   -one       -three     -inf
+    dw 0x03b4, 0xbc00, 0xc200, 0x7e00, 0x7e00   ;   -one       -three     +qnan
+    dw 0x03b5, 0xbc00, 0x7bff, 0x0000, 0xfbff   ;   -one       +max       +zero
+    dw 0x03b6, 0xbc00, 0x7bff, 0x8000, 0xfbff   ;   -one       +max       -zero
+    dw 0x03b7, 0xbc00, 0x7bff, 0x0001, 0xfbff   ;   -one       +max       +min_sub
+    dw 0x03b8, 0xbc00, 0x7bff, 0x8400, 0xfbff   ;   -one       +max       -min_norm
+    dw 0x03b9, 0xbc00, 0x7bff, 0x3c00, 0xfbff   ;   -one       +max       +one
+    dw 0x03ba, 0xbc00, 0x7bff, 0xbc00, 0xfbff   ;   -one       +max       -one
+    dw 0x03bb, 0xbc00, 0x7bff, 0x3c01, 0xfbff   ;   -one       +max       +one_eps
+    dw 0x03bc, 0xbc00, 0x7bff, 0xc200, 0xfbff   ;   -one       +max       -three
+    dw 0x03bd, 0xbc00, 0x7bff, 0x7bff, 0x0000   ;   -one       +max       +max
+    dw 0x03be, 0xbc00, 0x7bff, 0xfbff, 0xfc00   ;   -one       +max       -max
+    dw 0x03bf, 0xbc00, 0x7bff, 0x7c00, 0x7c00   ;   -one       +max       +inf
+    dw 0x03c0, 0xbc00, 0x7bff, 0xfc00, 0xfc00   ;   -one       +max       -inf
+    dw 0x03c1, 0xbc00, 0x7bff, 0x7e00, 0x7e00   ;   -one       +max       +qnan
+    dw 0x03c2, 0xbc00, 0xfbff, 0x0000, 0x7bff   ;   -one       -max       +zero
+    dw 0x03c3, 0xbc00, 0xfbff, 0x8000, 0x7bff   ;   -one       -max       -zero
+    dw 0x03c4, 0xbc00, 0xfbff, 0x0001, 0x7bff   ;   -one       -max       +min_sub
+    dw 0x03c5, 0xbc00, 0xfbff, 0x8400, 0x7bff   ;   -one       -max       -min_norm
+    dw 0x03c6, 0xbc00, 0xfbff, 0x3c00, 0x7bff   ;   -one       -max       +one
+    dw 0x03c7, 0xbc00, 0xfbff, 0xbc00, 0x7bff   ;   -one       -max       -one
+    dw 0x03c8, 0xbc00, 0xfbff, 0x3c01, 0x7bff   ;   -one       -max       +one_eps
+    dw 0x03c9, 0xbc00, 0xfbff, 0xc200, 0x7bff   ;   -one       -max       -three
+    dw 0x03ca, 0xbc00, 0xfbff, 0x7bff, 0x7c00   ;   -one       -max       +max
+    dw 0x03cb, 0xbc00, 0xfbff, 0xfbff, 0x0000   ;   -one       -max       -max
+    dw 0x03cc, 0xbc00, 0xfbff, 0x7c00, 0x7c00   ;   -one       -max       +inf
+    dw 0x03cd, 0xbc00, 0xfbff, 0xfc00, 0xfc00   ;   -one       -max       -inf
+    dw 0x03ce, 0xbc00, 0xfbff, 0x7e00, 0x7e00   ;   -one       -max       +qnan
+    dw 0x03cf, 0xbc00, 0x7c00, 0x0000, 0xfc00   ;   -one       +inf       +zero
+    dw 0x03d0, 0xbc00, 0x7c00, 0x8000, 0xfc00   ;   -one       +inf       -zero
+    dw 0x03d1, 0xbc00, 0x7c00, 0x0001, 0xfc00   ;   -one       +inf       +min_sub
+    dw 0x03d2, 0xbc00, 0x7c00, 0x8400, 0xfc00   ;   -one       +inf       -min_norm
+    dw 0x03d3, 0xbc00, 0x7c00, 0x3c00, 0xfc00   ;   -one       +inf       +one
+    dw 0x03d4, 0xbc00, 0x7c00, 0xbc00, 0xfc00   ;   -one       +inf       -one
+    dw 0x03d5, 0xbc00, 0x7c00, 0x3c01, 0xfc00   ;   -one       +inf       +one_eps
+    dw 0x03d6, 0xbc00, 0x7c00, 0xc200, 0xfc00   ;   -one       +inf       -three
+    dw 0x03d7, 0xbc00, 0x7c00, 0x7bff, 0xfc00   ;   -one       +inf       +max
+    dw 0x03d8, 0xbc00, 0x7c00, 0xfbff, 0xfc00   ;   -one       +inf       -max
+    dw 0x03d9, 0xbc00, 0x7c00, 0x7c00, 0x7e00   ;   -one       +inf       +inf
+    dw 0x03da, 0xbc00, 0x7c00, 0xfc00, 0xfc00   ;   -one       +inf       -inf
+    dw 0x03db, 0xbc00, 0x7c00, 0x7e00, 0x7e00   ;   -one       +inf       +qnan
+    dw 0x03dc, 0xbc00, 0xfc00, 0x0000, 0x7c00   ;   -one       -inf       +zero
+    dw 0x03dd, 0xbc00, 0xfc00, 0x8000, 0x7c00   ;   -one       -inf       -zero
+    dw 0x03de, 0xbc00, 0xfc00, 0x0001, 0x7c00   ;   -one       -inf       +min_sub
+    dw 0x03df, 0xbc00, 0xfc00, 0x8400, 0x7c00   ;   -one       -inf       -min_norm
+    dw 0x03e0, 0xbc00, 0xfc00, 0x3c00, 0x7c00   ;   -one       -inf       +one
+    dw 0x03e1, 0xbc00, 0xfc00, 0xbc00, 0x7c00   ;   -one       -inf       -one
+    dw 0x03e2, 0xbc00, 0xfc00, 0x3c01, 0x7c00   ;   -one       -inf       +one_eps
+    dw 0x03e3, 0xbc00, 0xfc00, 0xc200, 0x7c00   ;   -one       -inf       -three
+    dw 0x03e4, 0xbc00, 0xfc00, 0x7bff, 0x7c00   ;   -one       -inf       +max
+    dw 0x03e5, 0xbc00, 0xfc00, 0xfbff, 0x7c00   ;   -one       -inf       -max
+    dw 0x03e6, 0xbc00, 0xfc00, 0x7c00, 0x7c00   ;   -one       -inf       +inf
+    dw 0x03e7, 0xbc00, 0xfc00, 0xfc00, 0x7e00   ;   -one       -inf       -inf
+    dw 0x03e8, 0xbc00, 0xfc00, 0x7e00, 0x7e00   ;   -one       -inf       +qnan
+    dw 0x03e9, 0xbc00, 0x7e00, 0x0000, 0x7e00   ;   -one       +qnan      +zero
+    dw 0x03ea, 0xbc00, 0x7e00, 0x8000, 0x7e00   ;   -one       +qnan      -zero
+    dw 0x03eb, 0xbc00, 0x7e00, 0x0001, 0x7e00   ;   -one       +qnan      +min_sub
+    dw 0x03ec, 0xbc00, 0x7e00, 0x8400, 0x7e00   ;   -one       +qnan      -min_norm
+    dw 0x03ed, 0xbc00, 0x7e00, 0x3c00, 0x7e00   ;   -one       +qnan      +one
+    dw 0x03ee, 0xbc00, 0x7e00, 0xbc00, 0x7e00   ;   -one       +qnan      -one
+    dw 0x03ef, 0xbc00, 0x7e00, 0x3c01, 0x7e00   ;   -one       +qnan      +one_eps
+    dw 0x03f0, 0xbc00, 0x7e00, 0xc200, 0x7e00   ;   -one       +qnan      -three
+    dw 0x03f1, 0xbc00, 0x7e00, 0x7bff, 0x7e00   ;   -one       +qnan      +max
+    dw 0x03f2, 0xbc00, 0x7e00, 0xfbff, 0x7e00   ;   -one       +qnan      -max
+    dw 0x03f3, 0xbc00, 0x7e00, 0x7c00, 0x7e00   ;   -one       +qnan      +inf
+    dw 0x03f4, 0xbc00, 0x7e00, 0xfc00, 0x7e00   ;   -one       +qnan      -inf
+    dw 0x03f5, 0xbc00, 0x7e00, 0x7e00, 0x7e00   ;   -one       +qnan      +qnan
+    dw 0x03f6, 0x3c01, 0x0000, 0x0000, 0x0000   ;   +one_eps   +zero      +zero
+    dw 0x03f7, 0x3c01, 0x0000, 0x8000, 0x0000   ;   +one_eps   +zero      -zero
+    dw 0x03f8, 0x3c01, 0x0000, 0x0001, 0x0001   ;   +one_eps   +zero      +min_sub
+    dw 0x03f9, 0x3c01, 0x0000, 0x8400, 0x8400   ;   +one_eps   +zero      -min_norm
+    dw 0x03fa, 0x3c01, 0x0000, 0x3c00, 0x3c00   ;   +one_eps   +zero      +one
+    dw 0x03fb, 0x3c01, 0x0000, 0xbc00, 0xbc00   ;   +one_eps   +zero      -one
+    dw 0x03fc, 0x3c01, 0x0000, 0x3c01, 0x3c01   ;   +one_eps   +zero      +one_eps
+    dw 0x03fd, 0x3c01, 0x0000, 0xc200, 0xc200   ;   +one_eps   +zero      -three
+    dw 0x03fe, 0x3c01, 0x0000, 0x7bff, 0x7bff   ;   +one_eps   +zero      +max
+    dw 0x03ff, 0x3c01, 0x0000, 0xfbff, 0xfbff   ;   +one_eps   +zero      -max
+    dw 0x0400, 0x3c01, 0x0000, 0x7c00, 0x7c00   ;   +one_eps   +zero      +inf
+    dw 0x0401, 0x3c01, 0x0000, 0xfc00, 0xfc00   ;   +one_eps   +zero      -inf
+    dw 0x0402, 0x3c01, 0x0000, 0x7e00, 0x7e00   ;   +one_eps   +zero      +qnan
+    dw 0x0403, 0x3c01, 0x8000, 0x0000, 0x0000   ;   +one_eps   -zero      +zero
+    dw 0x0404, 0x3c01, 0x8000, 0x8000, 0x8000   ;   +one_eps   -zero      -zero
+    dw 0x0405, 0x3c01, 0x8000, 0x0001, 0x0001   ;   +one_eps   -zero      +min_sub
+    dw 0x0406, 0x3c01, 0x8000, 0x8400, 0x8400   ;   +one_eps   -zero      -min_norm
+    dw 0x0407, 0x3c01, 0x8000, 0x3c00, 0x3c00   ;   +one_eps   -zero      +one
+    dw 0x0408, 0x3c01, 0x8000, 0xbc00, 0xbc00   ;   +one_eps   -zero      -one
+    dw 0x0409, 0x3c01, 0x8000, 0x3c01, 0x3c01   ;   +one_eps   -zero      +one_eps
+    dw 0x040a, 0x3c01, 0x8000, 0xc200, 0xc200   ;   +one_eps   -zero      -three
+    dw 0x040b, 0x3c01, 0x8000, 0x7bff, 0x7bff   ;   +one_eps   -zero      +max
+    dw 0x040c, 0x3c01, 0x8000, 0xfbff, 0xfbff   ;   +one_eps   -zero      -max
+    dw 0x040d, 0x3c01, 0x8000, 0x7c00, 0x7c00   ;   +one_eps   -zero      +inf
+    dw 0x040e, 0x3c01, 0x8000, 0xfc00, 0xfc00   ;   +one_eps   -zero      -inf
+    dw 0x040f, 0x3c01, 0x8000, 0x7e00, 0x7e00   ;   +one_eps   -zero      +qnan
+    dw 0x0410, 0x3c01, 0x0001, 0x0000, 0x0001   ;   +one_eps   +min_sub   +zero
+    dw 0x0411, 0x3c01, 0x0001, 0x8000, 0x0001   ;   +one_eps   +min_sub   -zero
+    dw 0x0412, 0x3c01, 0x0001, 0x0001, 0x0002   ;   +one_eps   +min_sub   +min_sub
+    dw 0x0413, 0x3c01, 0x0001, 0x8400, 0x83ff   ;   +one_eps   +min_sub   -min_norm
+    dw 0x0414, 0x3c01, 0x0001, 0x3c00, 0x3c00   ;   +one_eps   +min_sub   +one
+    dw 0x0415, 0x3c01, 0x0001, 0xbc00, 0xbc00   ;   +one_eps   +min_sub   -one
+    dw 0x0416, 0x3c01, 0x0001, 0x3c01, 0x3c01   ;   +one_eps   +min_sub   +one_eps
+    dw 0x0417, 0x3c01, 0x0001, 0xc200, 0xc200   ;   +one_eps   +min_sub   -three
+    dw 0x0418, 0x3c01, 0x0001, 0x7bff, 0x7bff   ;   +one_eps   +min_sub   +max
+    dw 0x0419, 0x3c01, 0x0001, 0xfbff, 0xfbff   ;   +one_eps   +min_sub   -max
+    dw 0x041a, 0x3c01, 0x0001, 0x7c00, 0x7c00   ;   +one_eps   +min_sub   +inf
+    dw 0x041b, 0x3c01, 0x0001, 0xfc00, 0xfc00   ;   +one_eps   +min_sub   -inf
+    dw 0x041c, 0x3c01, 0x0001, 0x7e00, 0x7e00   ;   +one_eps   +min_sub   +qnan
+    dw 0x041d, 0x3c01, 0x8400, 0x0000, 0x8401   ;   +one_eps   -min_norm  +zero
+    dw 0x041e, 0x3c01, 0x8400, 0x8000, 0x8401   ;   +one_eps   -min_norm  -zero
+    dw 0x041f, 0x3c01, 0x8400, 0x0001, 0x8400   ;   +one_eps   -min_norm  +min_sub
+    dw 0x0420, 0x3c01, 0x8400, 0x8400, 0x8800   ;   +one_eps   -min_norm  -min_norm
+    dw 0x0421, 0x3c01, 0x8400, 0x3c00, 0x3c00   ;   +one_eps   -min_norm  +one
+    dw 0x0422, 0x3c01, 0x8400, 0xbc00, 0xbc00   ;   +one_eps   -min_norm  -one
+    dw 0x0423, 0x3c01, 0x8400, 0x3c01, 0x3c01   ;   +one_eps   -min_norm  +one_eps
+    dw 0x0424, 0x3c01, 0x8400, 0xc200, 0xc200   ;   +one_eps   -min_norm  -three
+    dw 0x0425, 0x3c01, 0x8400, 0x7bff, 0x7bff   ;   +one_eps   -min_norm  +max
+    dw 0x0426, 0x3c01, 0x8400, 0xfbff, 0xfbff   ;   +one_eps   -min_norm  -max
+    dw 0x0427, 0x3c01, 0x8400, 0x7c00, 0x7c00   ;   +one_eps   -min_norm  +inf
+    dw 0x0428, 0x3c01, 0x8400, 0xfc00, 0xfc00   ;   +one_eps   -min_norm  -inf
+    dw 0x0429, 0x3c01, 0x8400, 0x7e00, 0x7e00   ;   +one_eps   -min_norm  +qnan
+    dw 0x042a, 0x3c01, 0x3c00, 0x0000, 0x3c01   ;   +one_eps   +one       +zero
+    dw 0x042b, 0x3c01, 0x3c00, 0x8000, 0x3c01   ;   +one_eps   +one       -zero
+    dw 0x042c, 0x3c01, 0x3c00, 0x0001, 0x3c01   ;   +one_eps   +one       +min_sub
+    dw 0x042d, 0x3c01, 0x3c00, 0x8400, 0x3c01   ;   +one_eps   +one       -min_norm
+    dw 0x042e, 0x3c01, 0x3c00, 0x3c00, 0x4000   ;   +one_eps   +one       +one
+    dw 0x042f, 0x3c01, 0x3c00, 0xbc00, 0x1400   ;   +one_eps   +one       -one
+    dw 0x0430, 0x3c01, 0x3c00, 0x3c01, 0x4001   ;   +one_eps   +one       +one_eps
+    dw 0x0431, 0x3c01, 0x3c00, 0xc200, 0xbfff   ;   +one_eps   +one       -three
+    dw 0x0432, 0x3c01, 0x3c00, 0x7bff, 0x7bff   ;   +one_eps   +one       +max
+    dw 0x0433, 0x3c01, 0x3c00, 0xfbff, 0xfbff   ;   +one_eps   +one       -max
+    dw 0x0434, 0x3c01, 0x3c00, 0x7c00, 0x7c00   ;   +one_eps   +one       +inf
+    dw 0x0435, 0x3c01, 0x3c00, 0xfc00, 0xfc00   ;   +one_eps   +one       -inf
+    dw 0x0436, 0x3c01, 0x3c00, 0x7e00, 0x7e00   ;   +one_eps   +one       +qnan
+    dw 0x0437, 0x3c01, 0xbc00, 0x0000, 0xbc01   ;   +one_eps   -one       +zero
+    dw 0x0438, 0x3c01, 0xbc00, 0x8000, 0xbc01   ;   +one_eps   -one       -zero
+    dw 0x0439, 0x3c01, 0xbc00, 0x0001, 0xbc01   ;   +one_eps   -one       +min_sub
+    dw 0x043a, 0x3c01, 0xbc00, 0x8400, 0xbc01   ;   +one_eps   -one       -min_norm
+    dw 0x043b, 0x3c01, 0xbc00, 0x3c00, 0x9400   ;   +one_eps   -one       +one
+    dw 0x043c, 0x3c01, 0xbc00, 0xbc00, 0xc000   ;   +one_eps   -one       -one
+    dw 0x043d, 0x3c01, 0xbc00, 0x3c01, 0x0000   ;   +one_eps   -one       +one_eps
+    dw 0x043e, 0x3c01, 0xbc00, 0xc200, 0xc400   ;   +one_eps   -one       -three
+    dw 0x043f, 0x3c01, 0xbc00, 0x7bff, 0x7bff   ;   +one_eps   -one       +max
+    dw 0x0440, 0x3c01, 0xbc00, 0xfbff, 0xfbff   ;   +one_eps   -one       -max
+    dw 0x0441, 0x3c01, 0xbc00, 0x7c00, 0x7c00   ;   +one_eps   -one       +inf
+    dw 0x0442, 0x3c01, 0xbc00, 0xfc00, 0xfc00   ;   +one_eps   -one       -inf
+    dw 0x0443, 0x3c01, 0xbc00, 0x7e00, 0x7e00   ;   +one_eps   -one       +qnan
+    dw 0x0444, 0x3c01, 0x3c01, 0x0000, 0x3c02   ;   +one_eps   +one_eps   +zero
+    dw 0x0445, 0x3c01, 0x3c01, 0x8000, 0x3c02   ;   +one_eps   +one_eps   -zero
+    dw 0x0446, 0x3c01, 0x3c01, 0x0001, 0x3c02   ;   +one_eps   +one_eps   +min_sub
+    dw 0x0447, 0x3c01, 0x3c01, 0x8400, 0x3c02   ;   +one_eps   +one_eps   -min_norm
+    dw 0x0448, 0x3c01, 0x3c01, 0x3c00, 0x4001   ;   +one_eps   +one_eps   +one
+    dw 0x0449, 0x3c01, 0x3c01, 0xbc00, 0x1800   ;   +one_eps   +one_eps   -one
+    dw 0x044a, 0x3c01, 0x3c01, 0x3c01, 0x4002   ;   +one_eps   +one_eps   +one_eps
+    dw 0x044b, 0x3c01, 0x3c01, 0xc200, 0xbffe   ;   +one_eps   +one_eps   -three
+    dw 0x044c, 0x3c01, 0x3c01, 0x7bff, 0x7bff   ;   +one_eps   +one_eps   +max
+    dw 0x044d, 0x3c01, 0x3c01, 0xfbff, 0xfbff   ;   +one_eps   +one_eps   -max
+    dw 0x044e, 0x3c01, 0x3c01, 0x7c00, 0x7c00   ;   +one_eps   +one_eps   +inf
+    dw 0x044f, 0x3c01, 0x3c01, 0xfc00, 0xfc00   ;   +one_eps   +one_eps   -inf
+    dw 0x0450, 0x3c01, 0x3c01, 0x7e00, 0x7e00   ;   +one_eps   +one_eps   +qnan
+    dw 0x0451, 0x3c01, 0xc200, 0x0000, 0xc202   ;   +one_eps   -three     +zero
+    dw 0x0452, 0x3c01, 0xc200, 0x8000, 0xc202   ;   +one_eps   -three     -zero
+    dw 0x0453, 0x3c01, 0xc200, 0x0001, 0xc201   ;   +one_eps   -three     +min_sub
+    dw 0x0454, 0x3c01, 0xc200, 0x8400, 0xc202   ;   +one_eps   -three     -min_norm
+    dw 0x0455, 0x3c01, 0xc200, 0x3c00, 0xc002   ;   +one_eps   -three     +one
+    dw 0x0456, 0x3c01, 0xc200, 0xbc00, 0xc401   ;   +one_eps   -three     -one
+    dw 0x0457, 0x3c01, 0xc200, 0x3c01, 0xc001   ;   +one_eps   -three     +one_eps
+    dw 0x0458, 0x3c01, 0xc200, 0xc200, 0xc601   ;   +one_eps   -three     -three
+    dw 0x0459, 0x3c01, 0xc200, 0x7bff, 0x7bff   ;   +one_eps   -three     +max
+    dw 0x045a, 0x3c01, 0xc200, 0xfbff, 0xfbff   ;   +one_eps   -three     -max
+    dw 0x045b, 0x3c01, 0xc200, 0x7c00, 0x7c00   ;   +one_eps   -three     +inf
+    dw 0x045c, 0x3c01, 0xc200, 0xfc00, 0xfc00   ;   +one_eps   -three     -inf
+    dw 0x045d, 0x3c01, 0xc200, 0x7e00, 0x7e00   ;   +one_eps   -three     +qnan
+    dw 0x045e, 0x3c01, 0x7bff, 0x0000, 0x7c00   ;   +one_eps   +max       +zero
+    dw 0x045f, 0x3c01, 0x7bff, 0x8000, 0x7c00   ;   +one_eps   +max       -zero
+    dw 0x0460, 0x3c01, 0x7bff, 0x0001, 0x7c00   ;   +one_eps   +max       +min_sub
+    dw 0x0461, 0x3c01, 0x7bff, 0x8400, 0x7c00   ;   +one_eps   +max       -min_norm
+    dw 0x0462, 0x3c01, 0x7bff, 0x3c00, 0x7c00   ;   +one_eps   +max       +one
+    dw 0x0463, 0x3c01, 0x7bff, 0xbc00, 0x7c00   ;   +one_eps   +max       -one
+    dw 0x0464, 0x3c01, 0x7bff, 0x3c01, 0x7c00   ;   +one_eps   +max       +one_eps
+    dw 0x0465, 0x3c01, 0x7bff, 0xc200, 0x7c00   ;   +one_eps   +max       -three
+    dw 0x0466, 0x3c01, 0x7bff, 0x7bff, 0x7c00   ;   +one_eps   +max       +max
+    dw 0x0467, 0x3c01, 0x7bff, 0xfbff, 0x53ff   ;   +one_eps   +max       -max
+    dw 0x0468, 0x3c01, 0x7bff, 0x7c00, 0x7c00   ;   +one_eps   +max       +inf
+    dw 0x0469, 0x3c01, 0x7bff, 0xfc00, 0xfc00   ;   +one_eps   +max       -inf
+    dw 0x046a, 0x3c01, 0x7bff, 0x7e00, 0x7e00   ;   +one_eps   +max       +qnan
+    dw 0x046b, 0x3c01, 0xfbff, 0x0000, 0xfc00   ;   +one_eps   -max       +zero
+    dw 0x046c, 0x3c01, 0xfbff, 0x8000, 0xfc00   ;   +one_eps   -max       -zero
+    dw 0x046d, 0x3c01, 0xfbff, 0x0001, 0xfc00   ;   +one_eps   -max       +min_sub
+    dw 0x046e, 0x3c01, 0xfbff, 0x8400, 0xfc00   ;   +one_eps   -max       -min_norm
+    dw 0x046f, 0x3c01, 0xfbff, 0x3c00, 0xfc00   ;   +one_eps   -max       +one
+    dw 0x0470, 0x3c01, 0xfbff, 0xbc00, 0xfc00   ;   +one_eps   -max       -one
+    dw 0x0471, 0x3c01, 0xfbff, 0x3c01, 0xfc00   ;   +one_eps   -max       +one_eps
+    dw 0x0472, 0x3c01, 0xfbff, 0xc200, 0xfc00   ;   +one_eps   -max       -three
+    dw 0x0473, 0x3c01, 0xfbff, 0x7bff, 0xd3ff   ;   +one_eps   -max       +max
+    dw 0x0474, 0x3c01, 0xfbff, 0xfbff, 0xfc00   ;   +one_eps   -max       -max
+    dw 0x0475, 0x3c01, 0xfbff, 0x7c00, 0x7c00   ;   +one_eps   -max       +inf
+    dw 0x0476, 0x3c01, 0xfbff, 0xfc00, 0xfc00   ;   +one_eps   -max       -inf
+    dw 0x0477, 0x3c01, 0xfbff, 0x7e00, 0x7e00   ;   +one_eps   -max       +qnan
+    dw 0x0478, 0x3c01, 0x7c00, 0x0000, 0x7c00   ;   +one_eps   +inf       +zero
+    dw 0x0479, 0x3c01, 0x7c00, 0x8000, 0x7c00   ;   +one_eps   +inf       -zero
+    dw 0x047a, 0x3c01, 0x7c00, 0x0001, 0x7c00   ;   +one_eps   +inf       +min_sub
+    dw 0x047b, 0x3c01, 0x7c00, 0x8400, 0x7c00   ;   +one_eps   +inf       -min_norm
+    dw 0x047c, 0x3c01, 0x7c00, 0x3c00, 0x7c00   ;   +one_eps   +inf       +one
+    dw 0x047d, 0x3c01, 0x7c00, 0xbc00, 0x7c00   ;   +one_eps   +inf       -one
+    dw 0x047e, 0x3c01, 0x7c00, 0x3c01, 0x7c00   ;   +one_eps   +inf       +one_eps
+    dw 0x047f, 0x3c01, 0x7c00, 0xc200, 0x7c00   ;   +one_eps   +inf       -three
+    dw 0x0480, 0x3c01, 0x7c00, 0x7bff, 0x7c00   ;   +one_eps   +inf       +max
+    dw 0x0481, 0x3c01, 0x7c00, 0xfbff, 0x7c00   ;   +one_eps   +inf       -max
+    dw 0x0482, 0x3c01, 0x7c00, 0x7c00, 0x7c00   ;   +one_eps   +inf       +inf
+    dw 0x0483, 0x3c01, 0x7c00, 0xfc00, 0x7e00   ;   +one_eps   +inf       -inf
+    dw 0x0484, 0x3c01, 0x7c00, 0x7e00, 0x7e00   ;   +one_eps   +inf       +qnan
+    dw 0x0485, 0x3c01, 0xfc00, 0x0000, 0xfc00   ;   +one_eps   -inf       +zero
+    dw 0x0486, 0x3c01, 0xfc00, 0x8000, 0xfc00   ;   +one_eps   -inf       -zero
+    dw 0x0487, 0x3c01, 0xfc00, 0x0001, 0xfc00   ;   +one_eps   -inf       +min_sub
+    dw 0x0488, 0x3c01, 0xfc00, 0x8400, 0xfc00   ;   +one_eps   -inf       -min_norm
+    dw 0x0489, 0x3c01, 0xfc00, 0x3c00, 0xfc00   ;   +one_eps   -inf       +one
+    dw 0x048a, 0x3c01, 0xfc00, 0xbc00, 0xfc00   ;   +one_eps   -inf       -one
+    dw 0x048b, 0x3c01, 0xfc00, 0x3c01, 0xfc00   ;   +one_eps   -inf       +one_eps
+    dw 0x048c, 0x3c01, 0xfc00, 0xc200, 0xfc00   ;   +one_eps   -inf       -three
+    dw 0x048d, 0x3c01, 0xfc00, 0x7bff, 0xfc00   ;   +one_eps   -inf       +max
+    dw 0x048e, 0x3c01, 0xfc00, 0xfbff, 0xfc00   ;   +one_eps   -inf       -max
+    dw 0x048f, 0x3c01, 0xfc00, 0x7c00, 0x7e00   ;   +one_eps   -inf       +inf
+    dw 0x0490, 0x3c01, 0xfc00, 0xfc00, 0xfc00   ;   +one_eps   -inf       -inf
+    dw 0x0491, 0x3c01, 0xfc00, 0x7e00, 0x7e00   ;   +one_eps   -inf       +qnan
+    dw 0x0492, 0x3c01, 0x7e00, 0x0000, 0x7e00   ;   +one_eps   +qnan      +zero
+    dw 0x0493, 0x3c01, 0x7e00, 0x8000, 0x7e00   ;   +one_eps   +qnan      -zero
+    dw 0x0494, 0x3c01, 0x7e00, 0x0001, 0x7e00   ;   +one_eps   +qnan      +min_sub
+    dw 0x0495, 0x3c01, 0x7e00, 0x8400, 0x7e00   ;   +one_eps   +qnan      -min_norm
+    dw 0x0496, 0x3c01, 0x7e00, 0x3c00, 0x7e00   ;   +one_eps   +qnan      +one
+    dw 0x0497, 0x3c01, 0x7e00, 0xbc00, 0x7e00   ;   +one_eps   +qnan      -one
+    dw 0x0498, 0x3c01, 0x7e00, 0x3c01, 0x7e00   ;   +one_eps   +qnan      +one_eps
+    dw 0x0499, 0x3c01, 0x7e00, 0xc200, 0x7e00   ;   +one_eps   +qnan      -three
+    dw 0x049a, 0x3c01, 0x7e00, 0x7bff, 0x7e00   ;   +one_eps   +qnan      +max
+    dw 0x049b, 0x3c01, 0x7e00, 0xfbff, 0x7e00   ;   +one_eps   +qnan      -max
+    dw 0x049c, 0x3c01, 0x7e00, 0x7c00, 0x7e00   ;   +one_eps   +qnan      +inf
+    dw 0x049d, 0x3c01, 0x7e00, 0xfc00, 0x7e00   ;   +one_eps   +qnan      -inf
+    dw 0x049e, 0x3c01, 0x7e00, 0x7e00, 0x7e00   ;   +one_eps   +qnan      +qnan
+    dw 0x049f, 0xc200, 0x0000, 0x0000, 0x0000   ;   -three     +zero      +zero
+    dw 0x04a0, 0xc200, 0x0000, 0x8000, 0x8000   ;   -three     +zero      -zero
+    dw 0x04a1, 0xc200, 0x0000, 0x0001, 0x0001   ;   -three     +zero      +min_sub
+    dw 0x04a2, 0xc200, 0x0000, 0x8400, 0x8400   ;   -three     +zero      -min_norm
+    dw 0x04a3, 0xc200, 0x0000, 0x3c00, 0x3c00   ;   -three     +zero      +one
+    dw 0x04a4, 0xc200, 0x0000, 0xbc00, 0xbc00   ;   -three     +zero      -one
+    dw 0x04a5, 0xc200, 0x0000, 0x3c01, 0x3c01   ;   -three     +zero      +one_eps
+    dw 0x04a6, 0xc200, 0x0000, 0xc200, 0xc200   ;   -three     +zero      -three
+    dw 0x04a7, 0xc200, 0x0000, 0x7bff, 0x7bff   ;   -three     +zero      +max
+    dw 0x04a8, 0xc200, 0x0000, 0xfbff, 0xfbff   ;   -three     +zero      -max
+    dw 0x04a9, 0xc200, 0x0000, 0x7c00, 0x7c00   ;   -three     +zero      +inf
+    dw 0x04aa, 0xc200, 0x0000, 0xfc00, 0xfc00   ;   -three     +zero      -inf
+    dw 0x04ab, 0xc200, 0x0000, 0x7e00, 0x7e00   ;   -three     +zero      +qnan
+    dw 0x04ac, 0xc200, 0x8000, 0x0000, 0x0000   ;   -three     -zero      +zero
+    dw 0x04ad, 0xc200, 0x8000, 0x8000, 0x0000   ;   -three     -zero      -zero
+    dw 0x04ae, 0xc200, 0x8000, 0x0001, 0x0001   ;   -three     -zero      +min_sub
+    dw 0x04af, 0xc200, 0x8000, 0x8400, 0x8400   ;   -three     -zero      -min_norm
+    dw 0x04b0, 0xc200, 0x8000, 0x3c00, 0x3c00   ;   -three     -zero      +one
+    dw 0x04b1, 0xc200, 0x8000, 0xbc00, 0xbc00   ;   -three     -zero      -one
+    dw 0x04b2, 0xc200, 0x8000, 0x3c01, 0x3c01   ;   -three     -zero      +one_eps
+    dw 0x04b3, 0xc200, 0x8000, 0xc200, 0xc200   ;   -three     -zero      -three
+    dw 0x04b4, 0xc200, 0x8000, 0x7bff, 0x7bff   ;   -three     -zero      +max
+    dw 0x04b5, 0xc200, 0x8000, 0xfbff, 0xfbff   ;   -three     -zero      -max
+    dw 0x04b6, 0xc200, 0x8000, 0x7c00, 0x7c00   ;   -three     -zero      +inf
+    dw 0x04b7, 0xc200, 0x8000, 0xfc00, 0xfc00   ;   -three     -zero      -inf
+    dw 0x04b8, 0xc200, 0x8000, 0x7e00, 0x7e00   ;   -three     -zero      +qnan
+    dw 0x04b9, 0xc200, 0x0001, 0x0000, 0x8003   ;   -three     +min_sub   +zero
+    dw 0x04ba, 0xc200, 0x0001, 0x8000, 0x8003   ;   -three     +min_sub   -zero
+    dw 0x04bb, 0xc200, 0x0001, 0x0001, 0x8002   ;   -three     +min_sub   +min_sub
+    dw 0x04bc, 0xc200, 0x0001, 0x8400, 0x8403   ;   -three     +min_sub   -min_norm
+    dw 0x04bd, 0xc200, 0x0001, 0x3c00, 0x3c00   ;   -three     +min_sub   +one
+    dw 0x04be, 0xc200, 0x0001, 0xbc00, 0xbc00   ;   -three     +min_sub   -one
+    dw 0x04bf, 0xc200, 0x0001, 0x3c01, 0x3c01   ;   -three     +min_sub   +one_eps
+    dw 0x04c0, 0xc200, 0x0001, 0xc200, 0xc200   ;   -three     +min_sub   -three
+    dw 0x04c1, 0xc200, 0x0001, 0x7bff, 0x7bff   ;   -three     +min_sub   +max
+    dw 0x04c2, 0xc200, 0x0001, 0xfbff, 0xfbff   ;   -three     +min_sub   -max
+    dw 0x04c3, 0xc200, 0x0001, 0x7c00, 0x7c00   ;   -three     +min_sub   +inf
+    dw 0x04c4, 0xc200, 0x0001, 0xfc00, 0xfc00   ;   -three     +min_sub   -inf
+    dw 0x04c5, 0xc200, 0x0001, 0x7e00, 0x7e00   ;   -three     +min_sub   +qnan
+    dw 0x04c6, 0xc200, 0x8400, 0x0000, 0x0a00   ;   -three     -min_norm  +zero
+    dw 0x04c7, 0xc200, 0x8400, 0x8000, 0x0a00   ;   -three     -min_norm  -zero
+    dw 0x04c8, 0xc200, 0x8400, 0x0001, 0x0a00   ;   -three     -min_norm  +min_sub
+    dw 0x04c9, 0xc200, 0x8400, 0x8400, 0x0800   ;   -three     -min_norm  -min_norm
+    dw 0x04ca, 0xc200, 0x8400, 0x3c00, 0x3c00   ;   -three     -min_norm  +one
+    dw 0x04cb, 0xc200, 0x8400, 0xbc00, 0xbc00   ;   -three     -min_norm  -one
+    dw 0x04cc, 0xc200, 0x8400, 0x3c01, 0x3c01   ;   -three     -min_norm  +one_eps
+    dw 0x04cd, 0xc200, 0x8400, 0xc200, 0xc200   ;   -three     -min_norm  -three
+    dw 0x04ce, 0xc200, 0x8400, 0x7bff, 0x7bff   ;   -three     -min_norm  +max
+    dw 0x04cf, 0xc200, 0x8400, 0xfbff, 0xfbff   ;   -three     -min_norm  -max
+    dw 0x04d0, 0xc200, 0x8400, 0x7c00, 0x7c00   ;   -three     -min_norm  +inf
+    dw 0x04d1, 0xc200, 0x8400, 0xfc00, 0xfc00   ;   -three     -min_norm  -inf
+    dw 0x04d2, 0xc200, 0x8400, 0x7e00, 0x7e00   ;   -three     -min_norm  +qnan
+    dw 0x04d3, 0xc200, 0x3c00, 0x0000, 0xc200   ;   -three     +one       +zero
+    dw 0x04d4, 0xc200, 0x3c00, 0x8000, 0xc200   ;   -three     +one       -zero
+    dw 0x04d5, 0xc200, 0x3c00, 0x0001, 0xc200   ;   -three     +one       +min_sub
+    dw 0x04d6, 0xc200, 0x3c00, 0x8400, 0xc200   ;   -three     +one       -min_norm
+    dw 0x04d7, 0xc200, 0x3c00, 0x3c00, 0xc000   ;   -three     +one       +one
+    dw 0x04d8, 0xc200, 0x3c00, 0xbc00, 0xc400   ;   -three     +one       -one
+    dw 0x04d9, 0xc200, 0x3c00, 0x3c01, 0xbfff   ;   -three     +one       +one_eps
+    dw 0x04da, 0xc200, 0x3c00, 0xc200, 0xc600   ;   -three     +one       -three
+    dw 0x04db, 0xc200, 0x3c00, 0x7bff, 0x7bff   ;   -three     +one       +max
+    dw 0x04dc, 0xc200, 0x3c00, 0xfbff, 0xfbff   ;   -three     +one       -max
+    dw 0x04dd, 0xc200, 0x3c00, 0x7c00, 0x7c00   ;   -three     +one       +inf
+    dw 0x04de, 0xc200, 0x3c00, 0xfc00, 0xfc00   ;   -three     +one       -inf
+    dw 0x04df, 0xc200, 0x3c00, 0x7e00, 0x7e00   ;   -three     +one       +qnan
+    dw 0x04e0, 0xc200, 0xbc00, 0x0000, 0x4200   ;   -three     -one       +zero
+    dw 0x04e1, 0xc200, 0xbc00, 0x8000, 0x4200   ;   -three     -one       -zero
+    dw 0x04e2, 0xc200, 0xbc00, 0x0001, 0x4200   ;   -three     -one       +min_sub
+    dw 0x04e3, 0xc200, 0xbc00, 0x8400, 0x4200   ;   -three     -one       -min_norm
+    dw 0x04e4, 0xc200, 0xbc00, 0x3c00, 0x4400   ;   -three     -one       +one
+    dw 0x04e5, 0xc200, 0xbc00, 0xbc00, 0x4000   ;   -three     -one       -one
+    dw 0x04e6, 0xc200, 0xbc00, 0x3c01, 0x4400   ;   -three     -one       +one_eps
+    dw 0x04e7, 0xc200, 0xbc00, 0xc200, 0x0000   ;   -three     -one       -three
+    dw 0x04e8, 0xc200, 0xbc00, 0x7bff, 0x7bff   ;   -three     -one       +max
+    dw 0x04e9, 0xc200, 0xbc00, 0xfbff, 0xfbff   ;   -three     -one       -max
+    dw 0x04ea, 0xc200, 0xbc00, 0x7c00, 0x7c00   ;   -three     -one       +inf
+    dw 0x04eb, 0xc200, 0xbc00, 0xfc00, 0xfc00   ;   -three     -one       -inf
+    dw 0x04ec, 0xc200, 0xbc00, 0x7e00, 0x7e00   ;   -three     -one       +qnan
+    dw 0x04ed, 0xc200, 0x3c01, 0x0000, 0xc202   ;   -three     +one_eps   +zero
+    dw 0x04ee, 0xc200, 0x3c01, 0x8000, 0xc202   ;   -three     +one_eps   -zero
+    dw 0x04ef, 0xc200, 0x3c01, 0x0001, 0xc201   ;   -three     +one_eps   +min_sub
+    dw 0x04f0, 0xc200, 0x3c01, 0x8400, 0xc202   ;   -three     +one_eps   -min_norm
+    dw 0x04f1, 0xc200, 0x3c01, 0x3c00, 0xc002   ;   -three     +one_eps   +one
+    dw 0x04f2, 0xc200, 0x3c01, 0xbc00, 0xc401   ;   -three     +one_eps   -one
+    dw 0x04f3, 0xc200, 0x3c01, 0x3c01, 0xc001   ;   -three     +one_eps   +one_eps
+    dw 0x04f4, 0xc200, 0x3c01, 0xc200, 0xc601   ;   -three     +one_eps   -three
+    dw 0x04f5, 0xc200, 0x3c01, 0x7bff, 0x7bff   ;   -three     +one_eps   +max
+    dw 0x04f6, 0xc200, 0x3c01, 0xfbff, 0xfbff   ;   -three     +one_eps   -max
+    dw 0x04f7, 0xc200, 0x3c01, 0x7c00, 0x7c00   ;   -three     +one_eps   +inf
+    dw 0x04f8, 0xc200, 0x3c01, 0xfc00, 0xfc00   ;   -three     +one_eps   -inf
+    dw 0x04f9, 0xc200, 0x3c01, 0x7e00, 0x7e00   ;   -three     +one_eps   +qnan
+    dw 0x04fa, 0xc200, 0xc200, 0x0000, 0x4880   ;   -three     -three     +zero
+    dw 0x04fb, 0xc200, 0xc200, 0x8000, 0x4880   ;   -three     -three     -zero
+    dw 0x04fc, 0xc200, 0xc200, 0x0001, 0x4880   ;   -three     -three     +min_sub
+    dw 0x04fd, 0xc200, 0xc200, 0x8400, 0x4880   ;   -three     -three     -min_norm
+    dw 0x04fe, 0xc200, 0xc200, 0x3c00, 0x4900   ;   -three     -three     +one
+    dw 0x04ff, 0xc200, 0xc200, 0xbc00, 0x4800   ;   -three     -three     -one
+    dw 0x0500, 0xc200, 0xc200, 0x3c01, 0x4900   ;   -three     -three     +one_eps
+    dw 0x0501, 0xc200, 0xc200, 0xc200, 0x4600   ;   -three     -three     -three
+    dw 0x0502, 0xc200, 0xc200, 0x7bff, 0x7bff   ;   -three     -three     +max
+    dw 0x0503, 0xc200, 0xc200, 0xfbff, 0xfbff   ;   -three     -three     -max
+    dw 0x0504, 0xc200, 0xc200, 0x7c00, 0x7c00   ;   -three     -three     +inf
+    dw 0x0505, 0xc200, 0xc200, 0xfc00, 0xfc00   ;   -three     -three     -inf
+    dw 0x0506, 0xc200, 0xc200, 0x7e00, 0x7e00   ;   -three     -three     +qnan
+    dw 0x0507, 0xc200, 0x7bff, 0x0000, 0xfc00   ;   -three     +max       +zero
+    dw 0x0508, 0xc200, 0x7bff, 0x8000, 0xfc00   ;   -three     +max       -zero
+    dw 0x0509, 0xc200, 0x7bff, 0x0001, 0xfc00   ;   -three     +max       +min_sub
+    dw 0x050a, 0xc200, 0x7bff, 0x8400, 0xfc00   ;   -three     +max       -min_norm
+    dw 0x050b, 0xc200, 0x7bff, 0x3c00, 0xfc00   ;   -three     +max       +one
+    dw 0x050c, 0xc200, 0x7bff, 0xbc00, 0xfc00   ;   -three     +max       -one
+    dw 0x050d, 0xc200, 0x7bff, 0x3c01, 0xfc00   ;   -three     +max       +one_eps
+    dw 0x050e, 0xc200, 0x7bff, 0xc200, 0xfc00   ;   -three     +max       -three
+    dw 0x050f, 0xc200, 0x7bff, 0x7bff, 0xfc00   ;   -three     +max       +max
+    dw 0x0510, 0xc200, 0x7bff, 0xfbff, 0xfc00   ;   -three     +max       -max
+    dw 0x0511, 0xc200, 0x7bff, 0x7c00, 0x7c00   ;   -three     +max       +inf
+    dw 0x0512, 0xc200, 0x7bff, 0xfc00, 0xfc00   ;   -three     +max       -inf
+    dw 0x0513, 0xc200, 0x7bff, 0x7e00, 0x7e00   ;   -three     +max       +qnan
+    dw 0x0514, 0xc200, 0xfbff, 0x0000, 0x7c00   ;   -three     -max       +zero
+    dw 0x0515, 0xc200, 0xfbff, 0x8000, 0x7c00   ;   -three     -max       -zero
+    dw 0x0516, 0xc200, 0xfbff, 0x0001, 0x7c00   ;   -three     -max       +min_sub
+    dw 0x0517, 0xc200, 0xfbff, 0x8400, 0x7c00   ;   -three     -max       -min_norm
+    dw 0x0518, 0xc200, 0xfbff, 0x3c00, 0x7c00   ;   -three     -max       +one
+    dw 0x0519, 0xc200, 0xfbff, 0xbc00, 0x7c00   ;   -three     -max       -one
+    dw 0x051a, 0xc200, 0xfbff, 0x3c01, 0x7c00   ;   -three     -max       +one_eps
+    dw 0x051b, 0xc200, 0xfbff, 0xc200, 0x7c00   ;   -three     -max       -three
+    dw 0x051c, 0xc200, 0xfbff, 0x7bff, 0x7c00   ;   -three     -max       +max
+    dw 0x051d, 0xc200, 0xfbff, 0xfbff, 0x7c00   ;   -three     -max       -max
+    dw 0x051e, 0xc200, 0xfbff, 0x7c00, 0x7c00   ;   -three     -max       +inf
+    dw 0x051f, 0xc200, 0xfbff, 0xfc00, 0xfc00   ;   -three     -max       -inf
+    dw 0x0520, 0xc200, 0xfbff, 0x7e00, 0x7e00   ;   -three     -max       +qnan
+    dw 0x0521, 0xc200, 0x7c00, 0x0000, 0xfc00   ;   -three     +inf       +zero
+    dw 0x0522, 0xc200, 0x7c00, 0x8000, 0xfc00   ;   -three     +inf       -zero
+    dw 0x0523, 0xc200, 0x7c00, 0x0001, 0xfc00   ;   -three     +inf       +min_sub
+    dw 0x0524, 0xc200, 0x7c00, 0x8400, 0xfc00   ;   -three     +inf       -min_norm
+    dw 0x0525, 0xc200, 0x7c00, 0x3c00, 0xfc00   ;   -three     +inf       +one
+    dw 0x0526, 0xc200, 0x7c00, 0xbc00, 0xfc00   ;   -three     +inf       -one
+    dw 0x0527, 0xc200, 0x7c00, 0x3c01, 0xfc00   ;   -three     +inf       +one_eps
+    dw 0x0528, 0xc200, 0x7c00, 0xc200, 0xfc00   ;   -three     +inf       -three
+    dw 0x0529, 0xc200, 0x7c00, 0x7bff, 0xfc00   ;   -three     +inf       +max
+    dw 0x052a, 0xc200, 0x7c00, 0xfbff, 0xfc00   ;   -three     +inf       -max
+    dw 0x052b, 0xc200, 0x7c00, 0x7c00, 0x7e00   ;   -three     +inf       +inf
+    dw 0x052c, 0xc200, 0x7c00, 0xfc00, 0xfc00   ;   -three     +inf       -inf
+    dw 0x052d, 0xc200, 0x7c00, 0x7e00, 0x7e00   ;   -three     +inf       +qnan
+    dw 0x052e, 0xc200, 0xfc00, 0x0000, 0x7c00   ;   -three     -inf       +zero
+    dw 0x052f, 0xc200, 0xfc00, 0x8000, 0x7c00   ;   -three     -inf       -zero
+    dw 0x0530, 0xc200, 0xfc00, 0x0001, 0x7c00   ;   -three     -inf       +min_sub
+    dw 0x0531, 0xc200, 0xfc00, 0x8400, 0x7c00   ;   -three     -inf       -min_norm
+    dw 0x0532, 0xc200, 0xfc00, 0x3c00, 0x7c00   ;   -three     -inf       +one
+    dw 0x0533, 0xc200, 0xfc00, 0xbc00, 0x7c00   ;   -three     -inf       -one
+    dw 0x0534, 0xc200, 0xfc00, 0x3c01, 0x7c00   ;   -three     -inf       +one_eps
+    dw 0x0535, 0xc200, 0xfc00, 0xc200, 0x7c00   ;   -three     -inf       -three
+    dw 0x0536, 0xc200, 0xfc00, 0x7bff, 0x7c00   ;   -three     -inf       +max
+    dw 0x0537, 0xc200, 0xfc00, 0xfbff, 0x7c00   ;   -three     -inf       -max
+    dw 0x0538, 0xc200, 0xfc00, 0x7c00, 0x7c00   ;   -three     -inf       +inf
+    dw 0x0539, 0xc200, 0xfc00, 0xfc00, 0x7e00   ;   -three     -inf       -inf
+    dw 0x053a, 0xc200, 0xfc00, 0x7e00, 0x7e00   ;   -three     -inf       +qnan
+    dw 0x053b, 0xc200, 0x7e00, 0x0000, 0x7e00   ;   -three     +qnan      +zero
+    dw 0x053c, 0xc200, 0x7e00, 0x8000, 0x7e00   ;   -three     +qnan      -zero
+    dw 0x053d, 0xc200, 0x7e00, 0x0001, 0x7e00   ;   -three     +qnan      +min_sub
+    dw 0x053e, 0xc200, 0x7e00, 0x8400, 0x7e00   ;   -three     +qnan      -min_norm
+    dw 0x053f, 0xc200, 0x7e00, 0x3c00, 0x7e00   ;   -three     +qnan      +one
+    dw 0x0540, 0xc200, 0x7e00, 0xbc00, 0x7e00   ;   -three     +qnan      -one
+    dw 0x0541, 0xc200, 0x7e00, 0x3c01, 0x7e00   ;   -three     +qnan      +one_eps
+    dw 0x0542, 0xc200, 0x7e00, 0xc200, 0x7e00   ;   -three     +qnan      -three
+    dw 0x0543, 0xc200, 0x7e00, 0x7bff, 0x7e00   ;   -three     +qnan      +max
+    dw 0x0544, 0xc200, 0x7e00, 0xfbff, 0x7e00   ;   -three     +qnan      -max
+    dw 0x0545, 0xc200, 0x7e00, 0x7c00, 0x7e00   ;   -three     +qnan      +inf
+    dw 0x0546, 0xc200, 0x7e00, 0xfc00, 0x7e00   ;   -three     +qnan      -inf
+    dw 0x0547, 0xc200, 0x7e00, 0x7e00, 0x7e00   ;   -three     +qnan      +qnan
+    dw 0x0548, 0x7bff, 0x0000, 0x0000, 0x0000   ;   +max       +zero      +zero
+    dw 0x0549, 0x7bff, 0x0000, 0x8000, 0x0000   ;   +max       +zero      -zero
+    dw 0x054a, 0x7bff, 0x0000, 0x0001, 0x0001   ;   +max       +zero      +min_sub
+    dw 0x054b, 0x7bff, 0x0000, 0x8400, 0x8400   ;   +max       +zero      -min_norm
+    dw 0x054c, 0x7bff, 0x0000, 0x3c00, 0x3c00   ;   +max       +zero      +one
+    dw 0x054d, 0x7bff, 0x0000, 0xbc00, 0xbc00   ;   +max       +zero      -one
+    dw 0x054e, 0x7bff, 0x0000, 0x3c01, 0x3c01   ;   +max       +zero      +one_eps
+    dw 0x054f, 0x7bff, 0x0000, 0xc200, 0xc200   ;   +max       +zero      -three
+    dw 0x0550, 0x7bff, 0x0000, 0x7bff, 0x7bff   ;   +max       +zero      +max
+    dw 0x0551, 0x7bff, 0x0000, 0xfbff, 0xfbff   ;   +max       +zero      -max
+    dw 0x0552, 0x7bff, 0x0000, 0x7c00, 0x7c00   ;   +max       +zero      +inf
+    dw 0x0553, 0x7bff, 0x0000, 0xfc00, 0xfc00   ;   +max       +zero      -inf
+    dw 0x0554, 0x7bff, 0x0000, 0x7e00, 0x7e00   ;   +max       +zero      +qnan
+    dw 0x0555, 0x7bff, 0x8000, 0x0000, 0x0000   ;   +max       -zero      +zero
+    dw 0x0556, 0x7bff, 0x8000, 0x8000, 0x8000   ;   +max       -zero      -zero
+    dw 0x0557, 0x7bff, 0x8000, 0x0001, 0x0001   ;   +max       -zero      +min_sub
+    dw 0x0558, 0x7bff, 0x8000, 0x8400, 0x8400   ;   +max       -zero      -min_norm
+    dw 0x0559, 0x7bff, 0x8000, 0x3c00, 0x3c00   ;   +max       -zero      +one
+    dw 0x055a, 0x7bff, 0x8000, 0xbc00, 0xbc00   ;   +max       -zero      -one
+    dw 0x055b, 0x7bff, 0x8000, 0x3c01, 0x3c01   ;   +max       -zero      +one_eps
+    dw 0x055c, 0x7bff, 0x8000, 0xc200, 0xc200   ;   +max       -zero      -three
+    dw 0x055d, 0x7bff, 0x8000, 0x7bff, 0x7bff   ;   +max       -zero      +max
+    dw 0x055e, 0x7bff, 0x8000, 0xfbff, 0xfbff   ;   +max       -zero      -max
+    dw 0x055f, 0x7bff, 0x8000, 0x7c00, 0x7c00   ;   +max       -zero      +inf
+    dw 0x0560, 0x7bff, 0x8000, 0xfc00, 0xfc00   ;   +max       -zero      -inf
+    dw 0x0561, 0x7bff, 0x8000, 0x7e00, 0x7e00   ;   +max       -zero      +qnan
+    dw 0x0562, 0x7bff, 0x0001, 0x0000, 0x1bff   ;   +max       +min_sub   +zero
+    dw 0x0563, 0x7bff, 0x0001, 0x8000, 0x1bff   ;   +max       +min_sub   -zero
+    dw 0x0564, 0x7bff, 0x0001, 0x0001, 0x1bff   ;   +max       +min_sub   +min_sub
+    dw 0x0565, 0x7bff, 0x0001, 0x8400, 0x1bdf   ;   +max       +min_sub   -min_norm
+    dw 0x0566, 0x7bff, 0x0001, 0x3c00, 0x3c04   ;   +max       +min_sub   +one
+    dw 0x0567, 0x7bff, 0x0001, 0xbc00, 0xbbf8   ;   +max       +min_sub   -one
+    dw 0x0568, 0x7bff, 0x0001, 0x3c01, 0x3c05   ;   +max       +min_sub   +one_eps
+    dw 0x0569, 0x7bff, 0x0001, 0xc200, 0xc1fe   ;   +max       +min_sub   -three
+    dw 0x056a, 0x7bff, 0x0001, 0x7bff, 0x7bff   ;   +max       +min_sub   +max
+    dw 0x056b, 0x7bff, 0x0001, 0xfbff, 0xfbff   ;   +max       +min_sub   -max
+    dw 0x056c, 0x7bff, 0x0001, 0x7c00, 0x7c00   ;   +max       +min_sub   +inf
+    dw 0x056d, 0x7bff, 0x0001, 0xfc00, 0xfc00   ;   +max       +min_sub   -inf
+    dw 0x056e, 0x7bff, 0x0001, 0x7e00, 0x7e00   ;   +max       +min_sub   +qnan
+    dw 0x056f, 0x7bff, 0x8400, 0x0000, 0xc3ff   ;   +max       -min_norm  +zero
+    dw 0x0570, 0x7bff, 0x8400, 0x8000, 0xc3ff   ;   +max       -min_norm  -zero
+    dw 0x0571, 0x7bff, 0x8400, 0x0001, 0xc3ff   ;   +max       -min_norm  +min_sub
+    dw 0x0572, 0x7bff, 0x8400, 0x8400, 0xc3ff   ;   +max       -min_norm  -min_norm
+    dw 0x0573, 0x7bff, 0x8400, 0x3c00, 0xc1ff   ;   +max       -min_norm  +one
+    dw 0x0574, 0x7bff, 0x8400, 0xbc00, 0xc500   ;   +max       -min_norm  -one
+    dw 0x0575, 0x7bff, 0x8400, 0x3c01, 0xc1fe   ;   +max       -min_norm  +one_eps
+    dw 0x0576, 0x7bff, 0x8400, 0xc200, 0xc700   ;   +max       -min_norm  -three
+    dw 0x0577, 0x7bff, 0x8400, 0x7bff, 0x7bff   ;   +max       -min_norm  +max
+    dw 0x0578, 0x7bff, 0x8400, 0xfbff, 0xfbff   ;   +max       -min_norm  -max
+    dw 0x0579, 0x7bff, 0x8400, 0x7c00, 0x7c00   ;   +max       -min_norm  +inf
+    dw 0x057a, 0x7bff, 0x8400, 0xfc00, 0xfc00   ;   +max       -min_norm  -inf
+    dw 0x057b, 0x7bff, 0x8400, 0x7e00, 0x7e00   ;   +max       -min_norm  +qnan
+    dw 0x057c, 0x7bff, 0x3c00, 0x0000, 0x7bff   ;   +max       +one       +zero
+    dw 0x057d, 0x7bff, 0x3c00, 0x8000, 0x7bff   ;   +max       +one       -zero
+    dw 0x057e, 0x7bff, 0x3c00, 0x0001, 0x7bff   ;   +max       +one       +min_sub
+    dw 0x057f, 0x7bff, 0x3c00, 0x8400, 0x7bff   ;   +max       +one       -min_norm
+    dw 0x0580, 0x7bff, 0x3c00, 0x3c00, 0x7bff   ;   +max       +one       +one
+    dw 0x0581, 0x7bff, 0x3c00, 0xbc00, 0x7bff   ;   +max       +one       -one
+    dw 0x0582, 0x7bff, 0x3c00, 0x3c01, 0x7bff   ;   +max       +one       +one_eps
+    dw 0x0583, 0x7bff, 0x3c00, 0xc200, 0x7bff   ;   +max       +one       -three
+    dw 0x0584, 0x7bff, 0x3c00, 0x7bff, 0x7c00   ;   +max       +one       +max
+    dw 0x0585, 0x7bff, 0x3c00, 0xfbff, 0x0000   ;   +max       +one       -max
+    dw 0x0586, 0x7bff, 0x3c00, 0x7c00, 0x7c00   ;   +max       +one       +inf
+    dw 0x0587, 0x7bff, 0x3c00, 0xfc00, 0xfc00   ;   +max       +one       -inf
+    dw 0x0588, 0x7bff, 0x3c00, 0x7e00, 0x7e00   ;   +max       +one       +qnan
+    dw 0x0589, 0x7bff, 0xbc00, 0x0000, 0xfbff   ;   +max       -one       +zero
+    dw 0x058a, 0x7bff, 0xbc00, 0x8000, 0xfbff   ;   +max       -one       -zero
+    dw 0x058b, 0x7bff, 0xbc00, 0x0001, 0xfbff   ;   +max       -one       +min_sub
+    dw 0x058c, 0x7bff, 0xbc00, 0x8400, 0xfbff   ;   +max       -one       -min_norm
+    dw 0x058d, 0x7bff, 0xbc00, 0x3c00, 0xfbff   ;   +max       -one       +one
+    dw 0x058e, 0x7bff, 0xbc00, 0xbc00, 0xfbff   ;   +max       -one       -one
+    dw 0x058f, 0x7bff, 0xbc00, 0x3c01, 0xfbff   ;   +max       -one       +one_eps
+    dw 0x0590, 0x7bff, 0xbc00, 0xc200, 0xfbff   ;   +max       -one       -three
+    dw 0x0591, 0x7bff, 0xbc00, 0x7bff, 0x0000   ;   +max       -one       +max
+    dw 0x0592, 0x7bff, 0xbc00, 0xfbff, 0xfc00   ;   +max       -one       -max
+    dw 0x0593, 0x7bff, 0xbc00, 0x7c00, 0x7c00   ;   +max       -one       +inf
+    dw 0x0594, 0x7bff, 0xbc00, 0xfc00, 0xfc00   ;   +max       -one       -inf
+    dw 0x0595, 0x7bff, 0xbc00, 0x7e00, 0x7e00   ;   +max       -one       +qnan
+    dw 0x0596, 0x7bff, 0x3c01, 0x0000, 0x7c00   ;   +max       +one_eps   +zero
+    dw 0x0597, 0x7bff, 0x3c01, 0x8000, 0x7c00   ;   +max       +one_eps   -zero
+    dw 0x0598, 0x7bff, 0x3c01, 0x0001, 0x7c00   ;   +max       +one_eps   +min_sub
+    dw 0x0599, 0x7bff, 0x3c01, 0x8400, 0x7c00   ;   +max       +one_eps   -min_norm
+    dw 0x059a, 0x7bff, 0x3c01, 0x3c00, 0x7c00   ;   +max       +one_eps   +one
+    dw 0x059b, 0x7bff, 0x3c01, 0xbc00, 0x7c00   ;   +max       +one_eps   -one
+    dw 0x059c, 0x7bff, 0x3c01, 0x3c01, 0x7c00   ;   +max       +one_eps   +one_eps
+    dw 0x059d, 0x7bff, 0x3c01, 0xc200, 0x7c00   ;   +max       +one_eps   -three
+    dw 0x059e, 0x7bff, 0x3c01, 0x7bff, 0x7c00   ;   +max       +one_eps   +max
+    dw 0x059f, 0x7bff, 0x3c01, 0xfbff, 0x53ff   ;   +max       +one_eps   -max
+    dw 0x05a0, 0x7bff, 0x3c01, 0x7c00, 0x7c00   ;   +max       +one_eps   +inf
+    dw 0x05a1, 0x7bff, 0x3c01, 0xfc00, 0xfc00   ;   +max       +one_eps   -inf
+    dw 0x05a2, 0x7bff, 0x3c01, 0x7e00, 0x7e00   ;   +max       +one_eps   +qnan
+    dw 0x05a3, 0x7bff, 0xc200, 0x0000, 0xfc00   ;   +max       -three     +zero
+    dw 0x05a4, 0x7bff, 0xc200, 0x8000, 0xfc00   ;   +max       -three     -zero
+    dw 0x05a5, 0x7bff, 0xc200, 0x0001, 0xfc00   ;   +max       -three     +min_sub
+    dw 0x05a6, 0x7bff, 0xc200, 0x8400, 0xfc00   ;   +max       -three     -min_norm
+    dw 0x05a7, 0x7bff, 0xc200, 0x3c00, 0xfc00   ;   +max       -three     +one
+    dw 0x05a8, 0x7bff, 0xc200, 0xbc00, 0xfc00   ;   +max       -three     -one
+    dw 0x05a9, 0x7bff, 0xc200, 0x3c01, 0xfc00   ;   +max       -three     +one_eps
+    dw 0x05aa, 0x7bff, 0xc200, 0xc200, 0xfc00   ;   +max       -three     -three
+    dw 0x05ab, 0x7bff, 0xc200, 0x7bff, 0xfc00   ;   +max       -three     +max
+    dw 0x05ac, 0x7bff, 0xc200, 0xfbff, 0xfc00   ;   +max       -three     -max
+    dw 0x05ad, 0x7bff, 0xc200, 0x7c00, 0x7c00   ;   +max       -three     +inf
+    dw 0x05ae, 0x7bff, 0xc200, 0xfc00, 0xfc00   ;   +max       -three     -inf
+    dw 0x05af, 0x7bff, 0xc200, 0x7e00, 0x7e00   ;   +max       -three     +qnan
+    dw 0x05b0, 0x7bff, 0x7bff, 0x0000, 0x7c00   ;   +max       +max       +zero
+    dw 0x05b1, 0x7bff, 0x7bff, 0x8000, 0x7c00   ;   +max       +max       -zero
+    dw 0x05b2, 0x7bff, 0x7bff, 0x0001, 0x7c00   ;   +max       +max       +min_sub
+    dw 0x05b3, 0x7bff, 0x7bff, 0x8400, 0x7c00   ;   +max       +max       -min_norm
+    dw 0x05b4, 0x7bff, 0x7bff, 0x3c00, 0x7c00   ;   +max       +max       +one
+    dw 0x05b5, 0x7bff, 0x7bff, 0xbc00, 0x7c00   ;   +max       +max       -one
+    dw 0x05b6, 0x7bff, 0x7bff, 0x3c01, 0x7c00   ;   +max       +max       +one_eps
+    dw 0x05b7, 0x7bff, 0x7bff, 0xc200, 0x7c00   ;   +max       +max       -three
+    dw 0x05b8, 0x7bff, 0x7bff, 0x7bff, 0x7c00   ;   +max       +max       +max
+    dw 0x05b9, 0x7bff, 0x7bff, 0xfbff, 0x7c00   ;   +max       +max       -max
+    dw 0x05ba, 0x7bff, 0x7bff, 0x7c00, 0x7c00   ;   +max       +max       +inf
+    dw 0x05bb, 0x7bff, 0x7bff, 0xfc00, 0xfc00   ;   +max       +max       -inf
+    dw 0x05bc, 0x7bff, 0x7bff, 0x7e00, 0x7e00   ;   +max       +max       +qnan
+    dw 0x05bd, 0x7bff, 0xfbff, 0x0000, 0xfc00   ;   +max       -max       +zero
+    dw 0x05be, 0x7bff, 0xfbff, 0x8000, 0xfc00   ;   +max       -max       -zero
+    dw 0x05bf, 0x7bff, 0xfbff, 0x0001, 0xfc00   ;   +max       -max       +min_sub
+    dw 0x05c0, 0x7bff, 0xfbff, 0x8400, 0xfc00   ;   +max       -max       -min_norm
+    dw 0x05c1, 0x7bff, 0xfbff, 0x3c00, 0xfc00   ;   +max       -max       +one
+    dw 0x05c2, 0x7bff, 0xfbff, 0xbc00, 0xfc00   ;   +max       -max       -one
+    dw 0x05c3, 0x7bff, 0xfbff, 0x3c01, 0xfc00   ;   +max       -max       +one_eps
+    dw 0x05c4, 0x7bff, 0xfbff, 0xc200, 0xfc00   ;   +max       -max       -three
+    dw 0x05c5, 0x7bff, 0xfbff, 0x7bff, 0xfc00   ;   +max       -max       +max
+    dw 0x05c6, 0x7bff, 0xfbff, 0xfbff, 0xfc00   ;   +max       -max       -max
+    dw 0x05c7, 0x7bff, 0xfbff, 0x7c00, 0x7c00   ;   +max       -max       +inf
+    dw 0x05c8, 0x7bff, 0xfbff, 0xfc00, 0xfc00   ;   +max       -max       -inf
+    dw 0x05c9, 0x7bff, 0xfbff, 0x7e00, 0x7e00   ;   +max       -max       +qnan
+    dw 0x05ca, 0x7bff, 0x7c00, 0x0000, 0x7c00   ;   +max       +inf       +zero
+    dw 0x05cb, 0x7bff, 0x7c00, 0x8000, 0x7c00   ;   +max       +inf       -zero
+    dw 0x05cc, 0x7bff, 0x7c00, 0x0001, 0x7c00   ;   +max       +inf       +min_sub
+    dw 0x05cd, 0x7bff, 0x7c00, 0x8400, 0x7c00   ;   +max       +inf       -min_norm
+    dw 0x05ce, 0x7bff, 0x7c00, 0x3c00, 0x7c00   ;   +max       +inf       +one
+    dw 0x05cf, 0x7bff, 0x7c00, 0xbc00, 0x7c00   ;   +max       +inf       -one
+    dw 0x05d0, 0x7bff, 0x7c00, 0x3c01, 0x7c00   ;   +max       +inf       +one_eps
+    dw 0x05d1, 0x7bff, 0x7c00, 0xc200, 0x7c00   ;   +max       +inf       -three
+    dw 0x05d2, 0x7bff, 0x7c00, 0x7bff, 0x7c00   ;   +max       +inf       +max
+    dw 0x05d3, 0x7bff, 0x7c00, 0xfbff, 0x7c00   ;   +max       +inf       -max
+    dw 0x05d4, 0x7bff, 0x7c00, 0x7c00, 0x7c00   ;   +max       +inf       +inf
+    dw 0x05d5, 0x7bff, 0x7c00, 0xfc00, 0x7e00   ;   +max       +inf       -inf
+    dw 0x05d6, 0x7bff, 0x7c00, 0x7e00, 0x7e00   ;   +max       +inf       +qnan
+    dw 0x05d7, 0x7bff, 0xfc00, 0x0000, 0xfc00   ;   +max       -inf       +zero
+    dw 0x05d8, 0x7bff, 0xfc00, 0x8000, 0xfc00   ;   +max       -inf       -zero
+    dw 0x05d9, 0x7bff, 0xfc00, 0x0001, 0xfc00   ;   +max       -inf       +min_sub
+    dw 0x05da, 0x7bff, 0xfc00, 0x8400, 0xfc00   ;   +max       -inf       -min_norm
+    dw 0x05db, 0x7bff, 0xfc00, 0x3c00, 0xfc00   ;   +max       -inf       +one
+    dw 0x05dc, 0x7bff, 0xfc00, 0xbc00, 0xfc00   ;   +max       -inf       -one
+    dw 0x05dd, 0x7bff, 0xfc00, 0x3c01, 0xfc00   ;   +max       -inf       +one_eps
+    dw 0x05de, 0x7bff, 0xfc00, 0xc200, 0xfc00   ;   +max       -inf       -three
+    dw 0x05df, 0x7bff, 0xfc00, 0x7bff, 0xfc00   ;   +max       -inf       +max
+    dw 0x05e0, 0x7bff, 0xfc00, 0xfbff, 0xfc00   ;   +max       -inf       -max
+    dw 0x05e1, 0x7bff, 0xfc00, 0x7c00, 0x7e00   ;   +max       -inf       +inf
+    dw 0x05e2, 0x7bff, 0xfc00, 0xfc00, 0xfc00   ;   +max       -inf       -inf
+    dw 0x05e3, 0x7bff, 0xfc00, 0x7e00, 0x7e00   ;   +max       -inf       +qnan
+    dw 0x05e4, 0x7bff, 0x7e00, 0x0000, 0x7e00   ;   +max       +qnan      +zero
+    dw 0x05e5, 0x7bff, 0x7e00, 0x8000, 0x7e00   ;   +max       +qnan      -zero
+    dw 0x05e6, 0x7bff, 0x7e00, 0x0001, 0x7e00   ;   +max       +qnan      +min_sub
+    dw 0x05e7, 0x7bff, 0x7e00, 0x8400, 0x7e00   ;   +max       +qnan      -min_norm
+    dw 0x05e8, 0x7bff, 0x7e00, 0x3c00, 0x7e00   ;   +max       +qnan      +one
+    dw 0x05e9, 0x7bff, 0x7e00, 0xbc00, 0x7e00   ;   +max       +qnan      -one
+    dw 0x05ea, 0x7bff, 0x7e00, 0x3c01, 0x7e00   ;   +max       +qnan      +one_eps
+    dw 0x05eb, 0x7bff, 0x7e00, 0xc200, 0x7e00   ;   +max       +qnan      -three
+    dw 0x05ec, 0x7bff, 0x7e00, 0x7bff, 0x7e00   ;   +max       +qnan      +max
+    dw 0x05ed, 0x7bff, 0x7e00, 0xfbff, 0x7e00   ;   +max       +qnan      -max
+    dw 0x05ee, 0x7bff, 0x7e00, 0x7c00, 0x7e00   ;   +max       +qnan      +inf
+    dw 0x05ef, 0x7bff, 0x7e00, 0xfc00, 0x7e00   ;   +max       +qnan      -inf
+    dw 0x05f0, 0x7bff, 0x7e00, 0x7e00, 0x7e00   ;   +max       +qnan      +qnan
+    dw 0x05f1, 0xfbff, 0x0000, 0x0000, 0x0000   ;   -max       +zero      +zero
+    dw 0x05f2, 0xfbff, 0x0000, 0x8000, 0x8000   ;   -max       +zero      -zero
+    dw 0x05f3, 0xfbff, 0x0000, 0x0001, 0x0001   ;   -max       +zero      +min_sub
+    dw 0x05f4, 0xfbff, 0x0000, 0x8400, 0x8400   ;   -max       +zero      -min_norm
+    dw 0x05f5, 0xfbff, 0x0000, 0x3c00, 0x3c00   ;   -max       +zero      +one
+    dw 0x05f6, 0xfbff, 0x0000, 0xbc00, 0xbc00   ;   -max       +zero      -one
+    dw 0x05f7, 0xfbff, 0x0000, 0x3c01, 0x3c01   ;   -max       +zero      +one_eps
+    dw 0x05f8, 0xfbff, 0x0000, 0xc200, 0xc200   ;   -max       +zero      -three
+    dw 0x05f9, 0xfbff, 0x0000, 0x7bff, 0x7bff   ;   -max       +zero      +max
+    dw 0x05fa, 0xfbff, 0x0000, 0xfbff, 0xfbff   ;   -max       +zero      -max
+    dw 0x05fb, 0xfbff, 0x0000, 0x7c00, 0x7c00   ;   -max       +zero      +inf
+    dw 0x05fc, 0xfbff, 0x0000, 0xfc00, 0xfc00   ;   -max       +zero      -inf
+    dw 0x05fd, 0xfbff, 0x0000, 0x7e00, 0x7e00   ;   -max       +zero      +qnan
+    dw 0x05fe, 0xfbff, 0x8000, 0x0000, 0x0000   ;   -max       -zero      +zero
+    dw 0x05ff, 0xfbff, 0x8000, 0x8000, 0x0000   ;   -max       -zero      -zero
+    dw 0x0600, 0xfbff, 0x8000, 0x0001, 0x0001   ;   -max       -zero      +min_sub
+    dw 0x0601, 0xfbff, 0x8000, 0x8400, 0x8400   ;   -max       -zero      -min_norm
+    dw 0x0602, 0xfbff, 0x8000, 0x3c00, 0x3c00   ;   -max       -zero      +one
+    dw 0x0603, 0xfbff, 0x8000, 0xbc00, 0xbc00   ;   -max       -zero      -one
+    dw 0x0604, 0xfbff, 0x8000, 0x3c01, 0x3c01   ;   -max       -zero      +one_eps
+    dw 0x0605, 0xfbff, 0x8000, 0xc200, 0xc200   ;   -max       -zero      -three
+    dw 0x0606, 0xfbff, 0x8000, 0x7bff, 0x7bff   ;   -max       -zero      +max
+    dw 0x0607, 0xfbff, 0x8000, 0xfbff, 0xfbff   ;   -max       -zero      -max
+    dw 0x0608, 0xfbff, 0x8000, 0x7c00, 0x7c00   ;   -max       -zero      +inf
+    dw 0x0609, 0xfbff, 0x8000, 0xfc00, 0xfc00   ;   -max       -zero      -inf
+    dw 0x060a, 0xfbff, 0x8000, 0x7e00, 0x7e00   ;   -max       -zero      +qnan
+    dw 0x060b, 0xfbff, 0x0001, 0x0000, 0x9bff   ;   -max       +min_sub   +zero
+    dw 0x060c, 0xfbff, 0x0001, 0x8000, 0x9bff   ;   -max       +min_sub   -zero
+    dw 0x060d, 0xfbff, 0x0001, 0x0001, 0x9bff   ;   -max       +min_sub   +min_sub
+    dw 0x060e, 0xfbff, 0x0001, 0x8400, 0x9c10   ;   -max       +min_sub   -min_norm
+    dw 0x060f, 0xfbff, 0x0001, 0x3c00, 0x3bf8   ;   -max       +min_sub   +one
+    dw 0x0610, 0xfbff, 0x0001, 0xbc00, 0xbc04   ;   -max       +min_sub   -one
+    dw 0x0611, 0xfbff, 0x0001, 0x3c01, 0x3bfa   ;   -max       +min_sub   +one_eps
+    dw 0x0612, 0xfbff, 0x0001, 0xc200, 0xc202   ;   -max       +min_sub   -three
+    dw 0x0613, 0xfbff, 0x0001, 0x7bff, 0x7bff   ;   -max       +min_sub   +max
+    dw 0x0614, 0xfbff, 0x0001, 0xfbff, 0xfbff   ;   -max       +min_sub   -max
+    dw 0x0615, 0xfbff, 0x0001, 0x7c00, 0x7c00   ;   -max       +min_sub   +inf
+    dw 0x0616, 0xfbff, 0x0001, 0xfc00, 0xfc00   ;   -max       +min_sub   -inf
+    dw 0x0617, 0xfbff, 0x0001, 0x7e00, 0x7e00   ;   -max       +min_sub   +qnan
+    dw 0x0618, 0xfbff, 0x8400, 0x0000, 0x43ff   ;   -max       -min_norm  +zero
+    dw 0x0619, 0xfbff, 0x8400, 0x8000, 0x43ff   ;   -max       -min_norm  -zero
+    dw 0x061a, 0xfbff, 0x8400, 0x0001, 0x43ff   ;   -max       -min_norm  +min_sub
+    dw 0x061b, 0xfbff, 0x8400, 0x8400, 0x43ff   ;   -max       -min_norm  -min_norm
+    dw 0x061c, 0xfbff, 0x8400, 0x3c00, 0x4500   ;   -max       -min_norm  +one
+    dw 0x061d, 0xfbff, 0x8400, 0xbc00, 0x41ff   ;   -max       -min_norm  -one
+    dw 0x061e, 0xfbff, 0x8400, 0x3c01, 0x4500   ;   -max       -min_norm  +one_eps
+    dw 0x061f, 0xfbff, 0x8400, 0xc200, 0x3bfc   ;   -max       -min_norm  -three
+    dw 0x0620, 0xfbff, 0x8400, 0x7bff, 0x7bff   ;   -max       -min_norm  +max
+    dw 0x0621, 0xfbff, 0x8400, 0xfbff, 0xfbff   ;   -max       -min_norm  -max
+    dw 0x0622, 0xfbff, 0x8400, 0x7c00, 0x7c00   ;   -max       -min_norm  +inf
+    dw 0x0623, 0xfbff, 0x8400, 0xfc00, 0xfc00   ;   -max       -min_norm  -inf
+    dw 0x0624, 0xfbff, 0x8400, 0x7e00, 0x7e00   ;   -max       -min_norm  +qnan
+    dw 0x0625, 0xfbff, 0x3c00, 0x0000, 0xfbff   ;   -max       +one       +zero
+    dw 0x0626, 0xfbff, 0x3c00, 0x8000, 0xfbff   ;   -max       +one       -zero
+    dw 0x0627, 0xfbff, 0x3c00, 0x0001, 0xfbff   ;   -max       +one       +min_sub
+    dw 0x0628, 0xfbff, 0x3c00, 0x8400, 0xfbff   ;   -max       +one       -min_norm
+    dw 0x0629, 0xfbff, 0x3c00, 0x3c00, 0xfbff   ;   -max       +one       +one
+    dw 0x062a, 0xfbff, 0x3c00, 0xbc00, 0xfbff   ;   -max       +one       -one
+    dw 0x062b, 0xfbff, 0x3c00, 0x3c01, 0xfbff   ;   -max       +one       +one_eps
+    dw 0x062c, 0xfbff, 0x3c00, 0xc200, 0xfbff   ;   -max       +one       -three
+    dw 0x062d, 0xfbff, 0x3c00, 0x7bff, 0x0000   ;   -max       +one       +max
+    dw 0x062e, 0xfbff, 0x3c00, 0xfbff, 0xfc00   ;   -max       +one       -max
+    dw 0x062f, 0xfbff, 0x3c00, 0x7c00, 0x7c00   ;   -max       +one       +inf
+    dw 0x0630, 0xfbff, 0x3c00, 0xfc00, 0xfc00   ;   -max       +one       -inf
+    dw 0x0631, 0xfbff, 0x3c00, 0x7e00, 0x7e00   ;   -max       +one       +qnan
+    dw 0x0632, 0xfbff, 0xbc00, 0x0000, 0x7bff   ;   -max       -one       +zero
+    dw 0x0633, 0xfbff, 0xbc00, 0x8000, 0x7bff   ;   -max       -one       -zero
+    dw 0x0634, 0xfbff, 0xbc00, 0x0001, 0x7bff   ;   -max       -one       +min_sub
+    dw 0x0635, 0xfbff, 0xbc00, 0x8400, 0x7bff   ;   -max       -one       -min_norm
+    dw 0x0636, 0xfbff, 0xbc00, 0x3c00, 0x7bff   ;   -max       -one       +one
+    dw 0x0637, 0xfbff, 0xbc00, 0xbc00, 0x7bff   ;   -max       -one       -one
+    dw 0x0638, 0xfbff, 0xbc00, 0x3c01, 0x7bff   ;   -max       -one       +one_eps
+    dw 0x0639, 0xfbff, 0xbc00, 0xc200, 0x7bff   ;   -max       -one       -three
+    dw 0x063a, 0xfbff, 0xbc00, 0x7bff, 0x7c00   ;   -max       -one       +max
+    dw 0x063b, 0xfbff, 0xbc00, 0xfbff, 0x0000   ;   -max       -one       -max
+    dw 0x063c, 0xfbff, 0xbc00, 0x7c00, 0x7c00   ;   -max       -one       +inf
+    dw 0x063d, 0xfbff, 0xbc00, 0xfc00, 0xfc00   ;   -max       -one       -inf
+    dw 0x063e, 0xfbff, 0xbc00, 0x7e00, 0x7e00   ;   -max       -one       +qnan
+    dw 0x063f, 0xfbff, 0x3c01, 0x0000, 0xfc00   ;   -max       +one_eps   +zero
+    dw 0x0640, 0xfbff, 0x3c01, 0x8000, 0xfc00   ;   -max       +one_eps   -zero
+    dw 0x0641, 0xfbff, 0x3c01, 0x0001, 0xfc00   ;   -max       +one_eps   +min_sub
+    dw 0x0642, 0xfbff, 0x3c01, 0x8400, 0xfc00   ;   -max       +one_eps   -min_norm
+    dw 0x0643, 0xfbff, 0x3c01, 0x3c00, 0xfc00   ;   -max       +one_eps   +one
+    dw 0x0644, 0xfbff, 0x3c01, 0xbc00, 0xfc00   ;   -max       +one_eps   -one
+    dw 0x0645, 0xfbff, 0x3c01, 0x3c01, 0xfc00   ;   -max       +one_eps   +one_eps
+    dw 0x0646, 0xfbff, 0x3c01, 0xc200, 0xfc00   ;   -max       +one_eps   -three
+    dw 0x0647, 0xfbff, 0x3c01, 0x7bff, 0xd3ff   ;   -max       +one_eps   +max
+    dw 0x0648, 0xfbff, 0x3c01, 0xfbff, 0xfc00   ;   -max       +one_eps   -max
+    dw 0x0649, 0xfbff, 0x3c01, 0x7c00, 0x7c00   ;   -max       +one_eps   +inf
+    dw 0x064a, 0xfbff, 0x3c01, 0xfc00, 0xfc00   ;   -max       +one_eps   -inf
+    dw 0x064b, 0xfbff, 0x3c01, 0x7e00, 0x7e00   ;   -max       +one_eps   +qnan
+    dw 0x064c, 0xfbff, 0xc200, 0x0000, 0x7c00   ;   -max       -three     +zero
+    dw 0x064d, 0xfbff, 0xc200, 0x8000, 0x7c00   ;   -max       -three     -zero
+    dw 0x064e, 0xfbff, 0xc200, 0x0001, 0x7c00   ;   -max       -three     +min_sub
+    dw 0x064f, 0xfbff, 0xc200, 0x8400, 0x7c00   ;   -max       -three     -min_norm
+    dw 0x0650, 0xfbff, 0xc200, 0x3c00, 0x7c00   ;   -max       -three     +one
+    dw 0x0651, 0xfbff, 0xc200, 0xbc00, 0x7c00   ;   -max       -three     -one
+    dw 0x0652, 0xfbff, 0xc200, 0x3c01, 0x7c00   ;   -max       -three     +one_eps
+    dw 0x0653, 0xfbff, 0xc200, 0xc200, 0x7c00   ;   -max       -three     -three
+    dw 0x0654, 0xfbff, 0xc200, 0x7bff, 0x7c00   ;   -max       -three     +max
+    dw 0x0655, 0xfbff, 0xc200, 0xfbff, 0x7c00   ;   -max       -three     -max
+    dw 0x0656, 0xfbff, 0xc200, 0x7c00, 0x7c00   ;   -max       -three     +inf
+    dw 0x0657, 0xfbff, 0xc200, 0xfc00, 0xfc00   ;   -max       -three     -inf
+    dw 0x0658, 0xfbff, 0xc200, 0x7e00, 0x7e00   ;   -max       -three     +qnan
+    dw 0x0659, 0xfbff, 0x7bff, 0x0000, 0xfc00   ;   -max       +max       +zero
+    dw 0x065a, 0xfbff, 0x7bff, 0x8000, 0xfc00   ;   -max       +max       -zero
+    dw 0x065b, 0xfbff, 0x7bff, 0x0001, 0xfc00   ;   -max       +max       +min_sub
+    dw 0x065c, 0xfbff, 0x7bff, 0x8400, 0xfc00   ;   -max       +max       -min_norm
+    dw 0x065d, 0xfbff, 0x7bff, 0x3c00, 0xfc00   ;   -max       +max       +one
+    dw 0x065e, 0xfbff, 0x7bff, 0xbc00, 0xfc00   ;   -max       +max       -one
+    dw 0x065f, 0xfbff, 0x7bff, 0x3c01, 0xfc00   ;   -max       +max       +one_eps
+    dw 0x0660, 0xfbff, 0x7bff, 0xc200, 0xfc00   ;   -max       +max       -three
+    dw 0x0661, 0xfbff, 0x7bff, 0x7bff, 0xfc00   ;   -max       +max       +max
+    dw 0x0662, 0xfbff, 0x7bff, 0xfbff, 0xfc00   ;   -max       +max       -max
+    dw 0x0663, 0xfbff, 0x7bff, 0x7c00, 0x7c00   ;   -max       +max       +inf
+    dw 0x0664, 0xfbff, 0x7bff, 0xfc00, 0xfc00   ;   -max       +max       -inf
+    dw 0x0665, 0xfbff, 0x7bff, 0x7e00, 0x7e00   ;   -max       +max       +qnan
+    dw 0x0666, 0xfbff, 0xfbff, 0x0000, 0x7c00   ;   -max       -max       +zero
+    dw 0x0667, 0xfbff, 0xfbff, 0x8000, 0x7c00   ;   -max       -max       -zero
+    dw 0x0668, 0xfbff, 0xfbff, 0x0001, 0x7c00   ;   -max       -max       +min_sub
+    dw 0x0669, 0xfbff, 0xfbff, 0x8400, 0x7c00   ;   -max       -max       -min_norm
+    dw 0x066a, 0xfbff, 0xfbff, 0x3c00, 0x7c00   ;   -max       -max       +one
+    dw 0x066b, 0xfbff, 0xfbff, 0xbc00, 0x7c00   ;   -max       -max       -one
+    dw 0x066c, 0xfbff, 0xfbff, 0x3c01, 0x7c00   ;   -max       -max       +one_eps
+    dw 0x066d, 0xfbff, 0xfbff, 0xc200, 0x7c00   ;   -max       -max       -three
+    dw 0x066e, 0xfbff, 0xfbff, 0x7bff, 0x7c00   ;   -max       -max       +max
+    dw 0x066f, 0xfbff, 0xfbff, 0xfbff, 0x7c00   ;   -max       -max       -max
+    dw 0x0670, 0xfbff, 0xfbff, 0x7c00, 0x7c00   ;   -max       -max       +inf
+    dw 0x0671, 0xfbff, 0xfbff, 0xfc00, 0xfc00   ;   -max       -max       -inf
+    dw 0x0672, 0xfbff, 0xfbff, 0x7e00, 0x7e00   ;   -max       -max       +qnan
+    dw 0x0673, 0xfbff, 0x7c00, 0x0000, 0xfc00   ;   -max       +inf       +zero
+    dw 0x0674, 0xfbff, 0x7c00, 0x8000, 0xfc00   ;   -max       +inf       -zero
+    dw 0x0675, 0xfbff, 0x7c00, 0x0001, 0xfc00   ;   -max       +inf       +min_sub
+    dw 0x0676, 0xfbff, 0x7c00, 0x8400, 0xfc00   ;   -max       +inf       -min_norm
+    dw 0x0677, 0xfbff, 0x7c00, 0x3c00, 0xfc00   ;   -max       +inf       +one
+    dw 0x0678, 0xfbff, 0x7c00, 0xbc00, 0xfc00   ;   -max       +inf       -one
+    dw 0x0679, 0xfbff, 0x7c00, 0x3c01, 0xfc00   ;   -max       +inf       +one_eps
+    dw 0x067a, 0xfbff, 0x7c00, 0xc200, 0xfc00   ;   -max       +inf       -three
+    dw 0x067b, 0xfbff, 0x7c00, 0x7bff, 0xfc00   ;   -max       +inf       +max
+    dw 0x067c, 0xfbff, 0x7c00, 0xfbff, 0xfc00   ;   -max       +inf       -max
+    dw 0x067d, 0xfbff, 0x7c00, 0x7c00, 0x7e00   ;   -max       +inf       +inf
+    dw 0x067e, 0xfbff, 0x7c00, 0xfc00, 0xfc00   ;   -max       +inf       -inf
+    dw 0x067f, 0xfbff, 0x7c00, 0x7e00, 0x7e00   ;   -max       +inf       +qnan
+    dw 0x0680, 0xfbff, 0xfc00, 0x0000, 0x7c00   ;   -max       -inf       +zero
+    dw 0x0681, 0xfbff, 0xfc00, 0x8000, 0x7c00   ;   -max       -inf       -zero
+    dw 0x0682, 0xfbff, 0xfc00, 0x0001, 0x7c00   ;   -max       -inf       +min_sub
+    dw 0x0683, 0xfbff, 0xfc00, 0x8400, 0x7c00   ;   -max       -inf       -min_norm
+    dw 0x0684, 0xfbff, 0xfc00, 0x3c00, 0x7c00   ;   -max       -inf       +one
+    dw 0x0685, 0xfbff, 0xfc00, 0xbc00, 0x7c00   ;   -max       -inf       -one
+    dw 0x0686, 0xfbff, 0xfc00, 0x3c01, 0x7c00   ;   -max       -inf       +one_eps
+    dw 0x0687, 0xfbff, 0xfc00, 0xc200, 0x7c00   ;   -max       -inf       -three
+    dw 0x0688, 0xfbff, 0xfc00, 0x7bff, 0x7c00   ;   -max       -inf       +max
+    dw 0x0689, 0xfbff, 0xfc00, 0xfbff, 0x7c00   ;   -max       -inf       -max
+    dw 0x068a, 0xfbff, 0xfc00, 0x7c00, 0x7c00   ;   -max       -inf       +inf
+    dw 0x068b, 0xfbff, 0xfc00, 0xfc00, 0x7e00   ;   -max       -inf       -inf
+    dw 0x068c, 0xfbff, 0xfc00, 0x7e00, 0x7e00   ;   -max       -inf       +qnan
+    dw 0x068d, 0xfbff, 0x7e00, 0x0000, 0x7e00   ;   -max       +qnan      +zero
+    dw 0x068e, 0xfbff, 0x7e00, 0x8000, 0x7e00   ;   -max       +qnan      -zero
+    dw 0x068f, 0xfbff, 0x7e00, 0x0001, 0x7e00   ;   -max       +qnan      +min_sub
+    dw 0x0690, 0xfbff, 0x7e00, 0x8400, 0x7e00   ;   -max       +qnan      -min_norm
+    dw 0x0691, 0xfbff, 0x7e00, 0x3c00, 0x7e00   ;   -max       +qnan      +one
+    dw 0x0692, 0xfbff, 0x7e00, 0xbc00, 0x7e00   ;   -max       +qnan      -one
+    dw 0x0693, 0xfbff, 0x7e00, 0x3c01, 0x7e00   ;   -max       +qnan      +one_eps
+    dw 0x0694, 0xfbff, 0x7e00, 0xc200, 0x7e00   ;   -max       +qnan      -three
+    dw 0x0695, 0xfbff, 0x7e00, 0x7bff, 0x7e00   ;   -max       +qnan      +max
+    dw 0x0696, 0xfbff, 0x7e00, 0xfbff, 0x7e00   ;   -max       +qnan      -max
+    dw 0x0697, 0xfbff, 0x7e00, 0x7c00, 0x7e00   ;   -max       +qnan      +inf
+    dw 0x0698, 0xfbff, 0x7e00, 0xfc00, 0x7e00   ;   -max       +qnan      -inf
+    dw 0x0699, 0xfbff, 0x7e00, 0x7e00, 0x7e00   ;   -max       +qnan      +qnan
+    dw 0x069a, 0x7c00, 0x0000, 0x0000, 0x7e00   ;   +inf       +zero      +zero
+    dw 0x069b, 0x7c00, 0x0000, 0x8000, 0x7e00   ;   +inf       +zero      -zero
+    dw 0x069c, 0x7c00, 0x0000, 0x0001, 0x7e00   ;   +inf       +zero      +min_sub
+    dw 0x069d, 0x7c00, 0x0000, 0x8400, 0x7e00   ;   +inf       +zero      -min_norm
+    dw 0x069e, 0x7c00, 0x0000, 0x3c00, 0x7e00   ;   +inf       +zero      +one
+    dw 0x069f, 0x7c00, 0x0000, 0xbc00, 0x7e00   ;   +inf       +zero      -one
+    dw 0x06a0, 0x7c00, 0x0000, 0x3c01, 0x7e00   ;   +inf       +zero      +one_eps
+    dw 0x06a1, 0x7c00, 0x0000, 0xc200, 0x7e00   ;   +inf       +zero      -three
+    dw 0x06a2, 0x7c00, 0x0000, 0x7bff, 0x7e00   ;   +inf       +zero      +max
+    dw 0x06a3, 0x7c00, 0x0000, 0xfbff, 0x7e00   ;   +inf       +zero      -max
+    dw 0x06a4, 0x7c00, 0x0000, 0x7c00, 0x7e00   ;   +inf       +zero      +inf
+    dw 0x06a5, 0x7c00, 0x0000, 0xfc00, 0x7e00   ;   +inf       +zero      -inf
+    dw 0x06a6, 0x7c00, 0x0000, 0x7e00, 0x7e00   ;   +inf       +zero      +qnan
+    dw 0x06a7, 0x7c00, 0x8000, 0x0000, 0x7e00   ;   +inf       -zero      +zero
+    dw 0x06a8, 0x7c00, 0x8000, 0x8000, 0x7e00   ;   +inf       -zero      -zero
+    dw 0x06a9, 0x7c00, 0x8000, 0x0001, 0x7e00   ;   +inf       -zero      +min_sub
+    dw 0x06aa, 0x7c00, 0x8000, 0x8400, 0x7e00   ;   +inf       -zero      -min_norm
+    dw 0x06ab, 0x7c00, 0x8000, 0x3c00, 0x7e00   ;   +inf       -zero      +one
+    dw 0x06ac, 0x7c00, 0x8000, 0xbc00, 0x7e00   ;   +inf       -zero      -one
+    dw 0x06ad, 0x7c00, 0x8000, 0x3c01, 0x7e00   ;   +inf       -zero      +one_eps
+    dw 0x06ae, 0x7c00, 0x8000, 0xc200, 0x7e00   ;   +inf       -zero      -three
+    dw 0x06af, 0x7c00, 0x8000, 0x7bff, 0x7e00   ;   +inf       -zero      +max
+    dw 0x06b0, 0x7c00, 0x8000, 0xfbff, 0x7e00   ;   +inf       -zero      -max
+    dw 0x06b1, 0x7c00, 0x8000, 0x7c00, 0x7e00   ;   +inf       -zero      +inf
+    dw 0x06b2, 0x7c00, 0x8000, 0xfc00, 0x7e00   ;   +inf       -zero      -inf
+    dw 0x06b3, 0x7c00, 0x8000, 0x7e00, 0x7e00   ;   +inf       -zero      +qnan
+    dw 0x06b4, 0x7c00, 0x0001, 0x0000, 0x7c00   ;   +inf       +min_sub   +zero
+    dw 0x06b5, 0x7c00, 0x0001, 0x8000, 0x7c00   ;   +inf       +min_sub   -zero
+    dw 0x06b6, 0x7c00, 0x0001, 0x0001, 0x7c00   ;   +inf       +min_sub   +min_sub
+    dw 0x06b7, 0x7c00, 0x0001, 0x8400, 0x7c00   ;   +inf       +min_sub   -min_norm
+    dw 0x06b8, 0x7c00, 0x0001, 0x3c00, 0x7c00   ;   +inf       +min_sub   +one
+    dw 0x06b9, 0x7c00, 0x0001, 0xbc00, 0x7c00   ;   +inf       +min_sub   -one
+    dw 0x06ba, 0x7c00, 0x0001, 0x3c01, 0x7c00   ;   +inf       +min_sub   +one_eps
+    dw 0x06bb, 0x7c00, 0x0001, 0xc200, 0x7c00   ;   +inf       +min_sub   -three
+    dw 0x06bc, 0x7c00, 0x0001, 0x7bff, 0x7c00   ;   +inf       +min_sub   +max
+    dw 0x06bd, 0x7c00, 0x0001, 0xfbff, 0x7c00   ;   +inf       +min_sub   -max
+    dw 0x06be, 0x7c00, 0x0001, 0x7c00, 0x7c00   ;   +inf       +min_sub   +inf
+    dw 0x06bf, 0x7c00, 0x0001, 0xfc00, 0x7e00   ;   +inf       +min_sub   -inf
+    dw 0x06c0, 0x7c00, 0x0001, 0x7e00, 0x7e00   ;   +inf       +min_sub   +qnan
+    dw 0x06c1, 0x7c00, 0x8400, 0x0000, 0xfc00   ;   +inf       -min_norm  +zero
+    dw 0x06c2, 0x7c00, 0x8400, 0x8000, 0xfc00   ;   +inf       -min_norm  -zero
+    dw 0x06c3, 0x7c00, 0x8400, 0x0001, 0xfc00   ;   +inf       -min_norm  +min_sub
+    dw 0x06c4, 0x7c00, 0x8400, 0x8400, 0xfc00   ;   +inf       -min_norm  -min_norm
+    dw 0x06c5, 0x7c00, 0x8400, 0x3c00, 0xfc00   ;   +inf       -min_norm  +one
+    dw 0x06c6, 0x7c00, 0x8400, 0xbc00, 0xfc00   ;   +inf       -min_norm  -one
+    dw 0x06c7, 0x7c00, 0x8400, 0x3c01, 0xfc00   ;   +inf       -min_norm  +one_eps
+    dw 0x06c8, 0x7c00, 0x8400, 0xc200, 0xfc00   ;   +inf       -min_norm  -three
+    dw 0x06c9, 0x7c00, 0x8400, 0x7bff, 0xfc00   ;   +inf       -min_norm  +max
+    dw 0x06ca, 0x7c00, 0x8400, 0xfbff, 0xfc00   ;   +inf       -min_norm  -max
+    dw 0x06cb, 0x7c00, 0x8400, 0x7c00, 0x7e00   ;   +inf       -min_norm  +inf
+    dw 0x06cc, 0x7c00, 0x8400, 0xfc00, 0xfc00   ;   +inf       -min_norm  -inf
+    dw 0x06cd, 0x7c00, 0x8400, 0x7e00, 0x7e00   ;   +inf       -min_norm  +qnan
+    dw 0x06ce, 0x7c00, 0x3c00, 0x0000, 0x7c00   ;   +inf       +one       +zero
+    dw 0x06cf, 0x7c00, 0x3c00, 0x8000, 0x7c00   ;   +inf       +one       -zero
+    dw 0x06d0, 0x7c00, 0x3c00, 0x0001, 0x7c00   ;   +inf       +one       +min_sub
+    dw 0x06d1, 0x7c00, 0x3c00, 0x8400, 0x7c00   ;   +inf       +one       -min_norm
+    dw 0x06d2, 0x7c00, 0x3c00, 0x3c00, 0x7c00   ;   +inf       +one       +one
+    dw 0x06d3, 0x7c00, 0x3c00, 0xbc00, 0x7c00   ;   +inf       +one       -one
+    dw 0x06d4, 0x7c00, 0x3c00, 0x3c01, 0x7c00   ;   +inf       +one       +one_eps
+    dw 0x06d5, 0x7c00, 0x3c00, 0xc200, 0x7c00   ;   +inf       +one       -three
+    dw 0x06d6, 0x7c00, 0x3c00, 0x7bff, 0x7c00   ;   +inf       +one       +max
+    dw 0x06d7, 0x7c00, 0x3c00, 0xfbff, 0x7c00   ;   +inf       +one       -max
+    dw 0x06d8, 0x7c00, 0x3c00, 0x7c00, 0x7c00   ;   +inf       +one       +inf
+    dw 0x06d9, 0x7c00, 0x3c00, 0xfc00, 0x7e00   ;   +inf       +one       -inf
+    dw 0x06da, 0x7c00, 0x3c00, 0x7e00, 0x7e00   ;   +inf       +one       +qnan
+    dw 0x06db, 0x7c00, 0xbc00, 0x0000, 0xfc00   ;   +inf       -one       +zero
+    dw 0x06dc, 0x7c00, 0xbc00, 0x8000, 0xfc00   ;   +inf       -one       -zero
+    dw 0x06dd, 0x7c00, 0xbc00, 0x0001, 0xfc00   ;   +inf       -one       +min_sub
+    dw 0x06de, 0x7c00, 0xbc00, 0x8400, 0xfc00   ;   +inf       -one       -min_norm
+    dw 0x06df, 0x7c00, 0xbc00, 0x3c00, 0xfc00   ;   +inf       -one       +one
+    dw 0x06e0, 0x7c00, 0xbc00, 0xbc00, 0xfc00   ;   +inf       -one       -one
+    dw 0x06e1, 0x7c00, 0xbc00, 0x3c01, 0xfc00   ;   +inf       -one       +one_eps
+    dw 0x06e2, 0x7c00, 0xbc00, 0xc200, 0xfc00   ;   +inf       -one       -three
+    dw 0x06e3, 0x7c00, 0xbc00, 0x7bff, 0xfc00   ;   +inf       -one       +max
+    dw 0x06e4, 0x7c00, 0xbc00, 0xfbff, 0xfc00   ;   +inf       -one       -max
+    dw 0x06e5, 0x7c00, 0xbc00, 0x7c00, 0x7e00   ;   +inf       -one       +inf
+    dw 0x06e6, 0x7c00, 0xbc00, 0xfc00, 0xfc00   ;   +inf       -one       -inf
+    dw 0x06e7, 0x7c00, 0xbc00, 0x7e00, 0x7e00   ;   +inf       -one       +qnan
+    dw 0x06e8, 0x7c00, 0x3c01, 0x0000, 0x7c00   ;   +inf       +one_eps   +zero
+    dw 0x06e9, 0x7c00, 0x3c01, 0x8000, 0x7c00   ;   +inf       +one_eps   -zero
+    dw 0x06ea, 0x7c00, 0x3c01, 0x0001, 0x7c00   ;   +inf       +one_eps   +min_sub
+    dw 0x06eb, 0x7c00, 0x3c01, 0x8400, 0x7c00   ;   +inf       +one_eps   -min_norm
+    dw 0x06ec, 0x7c00, 0x3c01, 0x3c00, 0x7c00   ;   +inf       +one_eps   +one
+    dw 0x06ed, 0x7c00, 0x3c01, 0xbc00, 0x7c00   ;   +inf       +one_eps   -one
+    dw 0x06ee, 0x7c00, 0x3c01, 0x3c01, 0x7c00   ;   +inf       +one_eps   +one_eps
+    dw 0x06ef, 0x7c00, 0x3c01, 0xc200, 0x7c00   ;   +inf       +one_eps   -three
+    dw 0x06f0, 0x7c00, 0x3c01, 0x7bff, 0x7c00   ;   +inf       +one_eps   +max
+    dw 0x06f1, 0x7c00, 0x3c01, 0xfbff, 0x7c00   ;   +inf       +one_eps   -max
+    dw 0x06f2, 0x7c00, 0x3c01, 0x7c00, 0x7c00   ;   +inf       +one_eps   +inf
+    dw 0x06f3, 0x7c00, 0x3c01, 0xfc00, 0x7e00   ;   +inf       +one_eps   -inf
+    dw 0x06f4, 0x7c00, 0x3c01, 0x7e00, 0x7e00   ;   +inf       +one_eps   +qnan
+    dw 0x06f5, 0x7c00, 0xc200, 0x0000, 0xfc00   ;   +inf       -three     +zero
+    dw 0x06f6, 0x7c00, 0xc200, 0x8000, 0xfc00   ;   +inf       -three     -zero
+    dw 0x06f7, 0x7c00, 0xc200, 0x0001, 0xfc00   ;   +inf       -three     +min_sub
+    dw 0x06f8, 0x7c00, 0xc200, 0x8400, 0xfc00   ;   +inf       -three     -min_norm
+    dw 0x06f9, 0x7c00, 0xc200, 0x3c00, 0xfc00   ;   +inf       -three     +one
+    dw 0x06fa, 0x7c00, 0xc200, 0xbc00, 0xfc00   ;   +inf       -three     -one
+    dw 0x06fb, 0x7c00, 0xc200, 0x3c01, 0xfc00   ;   +inf       -three     +one_eps
+    dw 0x06fc, 0x7c00, 0xc200, 0xc200, 0xfc00   ;   +inf       -three     -three
+    dw 0x06fd, 0x7c00, 0xc200, 0x7bff, 0xfc00   ;   +inf       -three     +max
+    dw 0x06fe, 0x7c00, 0xc200, 0xfbff, 0xfc00   ;   +inf       -three     -max
+    dw 0x06ff, 0x7c00, 0xc200, 0x7c00, 0x7e00   ;   +inf       -three     +inf
+    dw 0x0700, 0x7c00, 0xc200, 0xfc00, 0xfc00   ;   +inf       -three     -inf
+    dw 0x0701, 0x7c00, 0xc200, 0x7e00, 0x7e00   ;   +inf       -three     +qnan
+    dw 0x0702, 0x7c00, 0x7bff, 0x0000, 0x7c00   ;   +inf       +max       +zero
+    dw 0x0703, 0x7c00, 0x7bff, 0x8000, 0x7c00   ;   +inf       +max       -zero
+    dw 0x0704, 0x7c00, 0x7bff, 0x0001, 0x7c00   ;   +inf       +max       +min_sub
+    dw 0x0705, 0x7c00, 0x7bff, 0x8400, 0x7c00   ;   +inf       +max       -min_norm
+    dw 0x0706, 0x7c00, 0x7bff, 0x3c00, 0x7c00   ;   +inf       +max       +one
+    dw 0x0707, 0x7c00, 0x7bff, 0xbc00, 0x7c00   ;   +inf       +max       -one
+    dw 0x0708, 0x7c00, 0x7bff, 0x3c01, 0x7c00   ;   +inf       +max       +one_eps
+    dw 0x0709, 0x7c00, 0x7bff, 0xc200, 0x7c00   ;   +inf       +max       -three
+    dw 0x070a, 0x7c00, 0x7bff, 0x7bff, 0x7c00   ;   +inf       +max       +max
+    dw 0x070b, 0x7c00, 0x7bff, 0xfbff, 0x7c00   ;   +inf       +max       -max
+    dw 0x070c, 0x7c00, 0x7bff, 0x7c00, 0x7c00   ;   +inf       +max       +inf
+    dw 0x070d, 0x7c00, 0x7bff, 0xfc00, 0x7e00   ;   +inf       +max       -inf
+    dw 0x070e, 0x7c00, 0x7bff, 0x7e00, 0x7e00   ;   +inf       +max       +qnan
+    dw 0x070f, 0x7c00, 0xfbff, 0x0000, 0xfc00   ;   +inf       -max       +zero
+    dw 0x0710, 0x7c00, 0xfbff, 0x8000, 0xfc00   ;   +inf       -max       -zero
+    dw 0x0711, 0x7c00, 0xfbff, 0x0001, 0xfc00   ;   +inf       -max       +min_sub
+    dw 0x0712, 0x7c00, 0xfbff, 0x8400, 0xfc00   ;   +inf       -max       -min_norm
+    dw 0x0713, 0x7c00, 0xfbff, 0x3c00, 0xfc00   ;   +inf       -max       +one
+    dw 0x0714, 0x7c00, 0xfbff, 0xbc00, 0xfc00   ;   +inf       -max       -one
+    dw 0x0715, 0x7c00, 0xfbff, 0x3c01, 0xfc00   ;   +inf       -max       +one_eps
+    dw 0x0716, 0x7c00, 0xfbff, 0xc200, 0xfc00   ;   +inf       -max       -three
+    dw 0x0717, 0x7c00, 0xfbff, 0x7bff, 0xfc00   ;   +inf       -max       +max
+    dw 0x0718, 0x7c00, 0xfbff, 0xfbff, 0xfc00   ;   +inf       -max       -max
+    dw 0x0719, 0x7c00, 0xfbff, 0x7c00, 0x7e00   ;   +inf       -max       +inf
+    dw 0x071a, 0x7c00, 0xfbff, 0xfc00, 0xfc00   ;   +inf       -max       -inf
+    dw 0x071b, 0x7c00, 0xfbff, 0x7e00, 0x7e00   ;   +inf       -max       +qnan
+    dw 0x071c, 0x7c00, 0x7c00, 0x0000, 0x7c00   ;   +inf       +inf       +zero
+    dw 0x071d, 0x7c00, 0x7c00, 0x8000, 0x7c00   ;   +inf       +inf       -zero
+    dw 0x071e, 0x7c00, 0x7c00, 0x0001, 0x7c00   ;   +inf       +inf       +min_sub
+    dw 0x071f, 0x7c00, 0x7c00, 0x8400, 0x7c00   ;   +inf       +inf       -min_norm
+    dw 0x0720, 0x7c00, 0x7c00, 0x3c00, 0x7c00   ;   +inf       +inf       +one
+    dw 0x0721, 0x7c00, 0x7c00, 0xbc00, 0x7c00   ;   +inf       +inf       -one
+    dw 0x0722, 0x7c00, 0x7c00, 0x3c01, 0x7c00   ;   +inf       +inf       +one_eps
+    dw 0x0723, 0x7c00, 0x7c00, 0xc200, 0x7c00   ;   +inf       +inf       -three
+    dw 0x0724, 0x7c00, 0x7c00, 0x7bff, 0x7c00   ;   +inf       +inf       +max
+    dw 0x0725, 0x7c00, 0x7c00, 0xfbff, 0x7c00   ;   +inf       +inf       -max
+    dw 0x0726, 0x7c00, 0x7c00, 0x7c00, 0x7c00   ;   +inf       +inf       +inf
+    dw 0x0727, 0x7c00, 0x7c00, 0xfc00, 0x7e00   ;   +inf       +inf       -inf
+    dw 0x0728, 0x7c00, 0x7c00, 0x7e00, 0x7e00   ;   +inf       +inf       +qnan
+    dw 0x0729, 0x7c00, 0xfc00, 0x0000, 0xfc00   ;   +inf       -inf       +zero
+    dw 0x072a, 0x7c00, 0xfc00, 0x8000, 0xfc00   ;   +inf       -inf       -zero
+    dw 0x072b, 0x7c00, 0xfc00, 0x0001, 0xfc00   ;   +inf       -inf       +min_sub
+    dw 0x072c, 0x7c00, 0xfc00, 0x8400, 0xfc00   ;   +inf       -inf       -min_norm
+    dw 0x072d, 0x7c00, 0xfc00, 0x3c00, 0xfc00   ;   +inf       -inf       +one
+    dw 0x072e, 0x7c00, 0xfc00, 0xbc00, 0xfc00   ;   +inf       -inf       -one
+    dw 0x072f, 0x7c00, 0xfc00, 0x3c01, 0xfc00   ;   +inf       -inf       +one_eps
+    dw 0x0730, 0x7c00, 0xfc00, 0xc200, 0xfc00   ;   +inf       -inf       -three
+    dw 0x0731, 0x7c00, 0xfc00, 0x7bff, 0xfc00   ;   +inf       -inf       +max
+    dw 0x0732, 0x7c00, 0xfc00, 0xfbff, 0xfc00   ;   +inf       -inf       -max
+    dw 0x0733, 0x7c00, 0xfc00, 0x7c00, 0x7e00   ;   +inf       -inf       +inf
+    dw 0x0734, 0x7c00, 0xfc00, 0xfc00, 0xfc00   ;   +inf       -inf       -inf
+    dw 0x0735, 0x7c00, 0xfc00, 0x7e00, 0x7e00   ;   +inf       -inf       +qnan
+    dw 0x0736, 0x7c00, 0x7e00, 0x0000, 0x7e00   ;   +inf       +qnan      +zero
+    dw 0x0737, 0x7c00, 0x7e00, 0x8000, 0x7e00   ;   +inf       +qnan      -zero
+    dw 0x0738, 0x7c00, 0x7e00, 0x0001, 0x7e00   ;   +inf       +qnan      +min_sub
+    dw 0x0739, 0x7c00, 0x7e00, 0x8400, 0x7e00   ;   +inf       +qnan      -min_norm
+    dw 0x073a, 0x7c00, 0x7e00, 0x3c00, 0x7e00   ;   +inf       +qnan      +one
+    dw 0x073b, 0x7c00, 0x7e00, 0xbc00, 0x7e00   ;   +inf       +qnan      -one
+    dw 0x073c, 0x7c00, 0x7e00, 0x3c01, 0x7e00   ;   +inf       +qnan      +one_eps
+    dw 0x073d, 0x7c00, 0x7e00, 0xc200, 0x7e00   ;   +inf       +qnan      -three
+    dw 0x073e, 0x7c00, 0x7e00, 0x7bff, 0x7e00   ;   +inf       +qnan      +max
+    dw 0x073f, 0x7c00, 0x7e00, 0xfbff, 0x7e00   ;   +inf       +qnan      -max
+    dw 0x0740, 0x7c00, 0x7e00, 0x7c00, 0x7e00   ;   +inf       +qnan      +inf
+    dw 0x0741, 0x7c00, 0x7e00, 0xfc00, 0x7e00   ;   +inf       +qnan      -inf
+    dw 0x0742, 0x7c00, 0x7e00, 0x7e00, 0x7e00   ;   +inf       +qnan      +qnan
+    dw 0x0743, 0xfc00, 0x0000, 0x0000, 0x7e00   ;   -inf       +zero      +zero
+    dw 0x0744, 0xfc00, 0x0000, 0x8000, 0x7e00   ;   -inf       +zero      -zero
+    dw 0x0745, 0xfc00, 0x0000, 0x0001, 0x7e00   ;   -inf       +zero      +min_sub
+    dw 0x0746, 0xfc00, 0x0000, 0x8400, 0x7e00   ;   -inf       +zero      -min_norm
+    dw 0x0747, 0xfc00, 0x0000, 0x3c00, 0x7e00   ;   -inf       +zero      +one
+    dw 0x0748, 0xfc00, 0x0000, 0xbc00, 0x7e00   ;   -inf       +zero      -one
+    dw 0x0749, 0xfc00, 0x0000, 0x3c01, 0x7e00   ;   -inf       +zero      +one_eps
+    dw 0x074a, 0xfc00, 0x0000, 0xc200, 0x7e00   ;   -inf       +zero      -three
+    dw 0x074b, 0xfc00, 0x0000, 0x7bff, 0x7e00   ;   -inf       +zero      +max
+    dw 0x074c, 0xfc00, 0x0000, 0xfbff, 0x7e00   ;   -inf       +zero      -max
+    dw 0x074d, 0xfc00, 0x0000, 0x7c00, 0x7e00   ;   -inf       +zero      +inf
+    dw 0x074e, 0xfc00, 0x0000, 0xfc00, 0x7e00   ;   -inf       +zero      -inf
+    dw 0x074f, 0xfc00, 0x0000, 0x7e00, 0x7e00   ;   -inf       +zero      +qnan
+    dw 0x0750, 0xfc00, 0x8000, 0x0000, 0x7e00   ;   -inf       -zero      +zero
+    dw 0x0751, 0xfc00, 0x8000, 0x8000, 0x7e00   ;   -inf       -zero      -zero
+    dw 0x0752, 0xfc00, 0x8000, 0x0001, 0x7e00   ;   -inf       -zero      +min_sub
+    dw 0x0753, 0xfc00, 0x8000, 0x8400, 0x7e00   ;   -inf       -zero      -min_norm
+    dw 0x0754, 0xfc00, 0x8000, 0x3c00, 0x7e00   ;   -inf       -zero      +one
+    dw 0x0755, 0xfc00, 0x8000, 0xbc00, 0x7e00   ;   -inf       -zero      -one
+    dw 0x0756, 0xfc00, 0x8000, 0x3c01, 0x7e00   ;   -inf       -zero      +one_eps
+    dw 0x0757, 0xfc00, 0x8000, 0xc200, 0x7e00   ;   -inf       -zero      -three
+    dw 0x0758, 0xfc00, 0x8000, 0x7bff, 0x7e00   ;   -inf       -zero      +max
+    dw 0x0759, 0xfc00, 0x8000, 0xfbff, 0x7e00   ;   -inf       -zero      -max
+    dw 0x075a, 0xfc00, 0x8000, 0x7c00, 0x7e00   ;   -inf       -zero      +inf
+    dw 0x075b, 0xfc00, 0x8000, 0xfc00, 0x7e00   ;   -inf       -zero      -inf
+    dw 0x075c, 0xfc00, 0x8000, 0x7e00, 0x7e00   ;   -inf       -zero      +qnan
+    dw 0x075d, 0xfc00, 0x0001, 0x0000, 0xfc00   ;   -inf       +min_sub   +zero
+    dw 0x075e, 0xfc00, 0x0001, 0x8000, 0xfc00   ;   -inf       +min_sub   -zero
+    dw 0x075f, 0xfc00, 0x0001, 0x0001, 0xfc00   ;   -inf       +min_sub   +min_sub
+    dw 0x0760, 0xfc00, 0x0001, 0x8400, 0xfc00   ;   -inf       +min_sub   -min_norm
+    dw 0x0761, 0xfc00, 0x0001, 0x3c00, 0xfc00   ;   -inf       +min_sub   +one
+    dw 0x0762, 0xfc00, 0x0001, 0xbc00, 0xfc00   ;   -inf       +min_sub   -one
+    dw 0x0763, 0xfc00, 0x0001, 0x3c01, 0xfc00   ;   -inf       +min_sub   +one_eps
+    dw 0x0764, 0xfc00, 0x0001, 0xc200, 0xfc00   ;   -inf       +min_sub   -three
+    dw 0x0765, 0xfc00, 0x0001, 0x7bff, 0xfc00   ;   -inf       +min_sub   +max
+    dw 0x0766, 0xfc00, 0x0001, 0xfbff, 0xfc00   ;   -inf       +min_sub   -max
+    dw 0x0767, 0xfc00, 0x0001, 0x7c00, 0x7e00   ;   -inf       +min_sub   +inf
+    dw 0x0768, 0xfc00, 0x0001, 0xfc00, 0xfc00   ;   -inf       +min_sub   -inf
+    dw 0x0769, 0xfc00, 0x0001, 0x7e00, 0x7e00   ;   -inf       +min_sub   +qnan
+    dw 0x076a, 0xfc00, 0x8400, 0x0000, 0x7c00   ;   -inf       -min_norm  +zero
+    dw 0x076b, 0xfc00, 0x8400, 0x8000, 0x7c00   ;   -inf       -min_norm  -zero
+    dw 0x076c, 0xfc00, 0x8400, 0x0001, 0x7c00   ;   -inf       -min_norm  +min_sub
+    dw 0x076d, 0xfc00, 0x8400, 0x8400, 0x7c00   ;   -inf       -min_norm  -min_norm
+    dw 0x076e, 0xfc00, 0x8400, 0x3c00, 0x7c00   ;   -inf       -min_norm  +one
+    dw 0x076f, 0xfc00, 0x8400, 0xbc00, 0x7c00   ;   -inf       -min_norm  -one
+    dw 0x0770, 0xfc00, 0x8400, 0x3c01, 0x7c00   ;   -inf       -min_norm  +one_eps
+    dw 0x0771, 0xfc00, 0x8400, 0xc200, 0x7c00   ;   -inf       -min_norm  -three
+    dw 0x0772, 0xfc00, 0x8400, 0x7bff, 0x7c00   ;   -inf       -min_norm  +max
+    dw 0x0773, 0xfc00, 0x8400, 0xfbff, 0x7c00   ;   -inf       -min_norm  -max
+    dw 0x0774, 0xfc00, 0x8400, 0x7c00, 0x7c00   ;   -inf       -min_norm  +inf
+    dw 0x0775, 0xfc00, 0x8400, 0xfc00, 0x7e00   ;   -inf       -min_norm  -inf
+    dw 0x0776, 0xfc00, 0x8400, 0x7e00, 0x7e00   ;   -inf       -min_norm  +qnan
+    dw 0x0777, 0xfc00, 0x3c00, 0x0000, 0xfc00   ;   -inf       +one       +zero
+    dw 0x0778, 0xfc00, 0x3c00, 0x8000, 0xfc00   ;   -inf       +one       -zero
+    dw 0x0779, 0xfc00, 0x3c00, 0x0001, 0xfc00   ;   -inf       +one       +min_sub
+    dw 0x077a, 0xfc00, 0x3c00, 0x8400, 0xfc00   ;   -inf       +one       -min_norm
+    dw 0x077b, 0xfc00, 0x3c00, 0x3c00, 0xfc00   ;   -inf       +one       +one
+    dw 0x077c, 0xfc00, 0x3c00, 0xbc00, 0xfc00   ;   -inf       +one       -one
+    dw 0x077d, 0xfc00, 0x3c00, 0x3c01, 0xfc00   ;   -inf       +one       +one_eps
+    dw 0x077e, 0xfc00, 0x3c00, 0xc200, 0xfc00   ;   -inf       +one       -three
+    dw 0x077f, 0xfc00, 0x3c00, 0x7bff, 0xfc00   ;   -inf       +one       +max
+    dw 0x0780, 0xfc00, 0x3c00, 0xfbff, 0xfc00   ;   -inf       +one       -max
+    dw 0x0781, 0xfc00, 0x3c00, 0x7c00, 0x7e00   ;   -inf       +one       +inf
+    dw 0x0782, 0xfc00, 0x3c00, 0xfc00, 0xfc00   ;   -inf       +one       -inf
+    dw 0x0783, 0xfc00, 0x3c00, 0x7e00, 0x7e00   ;   -inf       +one       +qnan
+    dw 0x0784, 0xfc00, 0xbc00, 0x0000, 0x7c00   ;   -inf       -one       +zero
+    dw 0x0785, 0xfc00, 0xbc00, 0x8000, 0x7c00   ;   -inf       -one       -zero
+    dw 0x0786, 0xfc00, 0xbc00, 0x0001, 0x7c00   ;   -inf       -one       +min_sub
+    dw 0x0787, 0xfc00, 0xbc00, 0x8400, 0x7c00   ;   -inf       -one       -min_norm
+    dw 0x0788, 0xfc00, 0xbc00, 0x3c00, 0x7c00   ;   -inf       -one       +one
+    dw 0x0789, 0xfc00, 0xbc00, 0xbc00, 0x7c00   ;   -inf       -one       -one
+    dw 0x078a, 0xfc00, 0xbc00, 0x3c01, 0x7c00   ;   -inf       -one       +one_eps
+    dw 0x078b, 0xfc00, 0xbc00, 0xc200, 0x7c00   ;   -inf       -one       -three
+    dw 0x078c, 0xfc00, 0xbc00, 0x7bff, 0x7c00   ;   -inf       -one       +max
+    dw 0x078d, 0xfc00, 0xbc00, 0xfbff, 0x7c00   ;   -inf       -one       -max
+    dw 0x078e, 0xfc00, 0xbc00, 0x7c00, 0x7c00   ;   -inf       -one       +inf
+    dw 0x078f, 0xfc00, 0xbc00, 0xfc00, 0x7e00   ;   -inf       -one       -inf
+    dw 0x0790, 0xfc00, 0xbc00, 0x7e00, 0x7e00   ;   -inf       -one       +qnan
+    dw 0x0791, 0xfc00, 0x3c01, 0x0000, 0xfc00   ;   -inf       +one_eps   +zero
+    dw 0x0792, 0xfc00, 0x3c01, 0x8000, 0xfc00   ;   -inf       +one_eps   -zero
+    dw 0x0793, 0xfc00, 0x3c01, 0x0001, 0xfc00   ;   -inf       +one_eps   +min_sub
+    dw 0x0794, 0xfc00, 0x3c01, 0x8400, 0xfc00   ;   -inf       +one_eps   -min_norm
+    dw 0x0795, 0xfc00, 0x3c01, 0x3c00, 0xfc00   ;   -inf       +one_eps   +one
+    dw 0x0796, 0xfc00, 0x3c01, 0xbc00, 0xfc00   ;   -inf       +one_eps   -one
+    dw 0x0797, 0xfc00, 0x3c01, 0x3c01, 0xfc00   ;   -inf       +one_eps   +one_eps
+    dw 0x0798, 0xfc00, 0x3c01, 0xc200, 0xfc00   ;   -inf       +one_eps   -three
+    dw 0x0799, 0xfc00, 0x3c01, 0x7bff, 0xfc00   ;   -inf       +one_eps   +max
+    dw 0x079a, 0xfc00, 0x3c01, 0xfbff, 0xfc00   ;   -inf       +one_eps   -max
+    dw 0x079b, 0xfc00, 0x3c01, 0x7c00, 0x7e00   ;   -inf       +one_eps   +inf
+    dw 0x079c, 0xfc00, 0x3c01, 0xfc00, 0xfc00   ;   -inf       +one_eps   -inf
+    dw 0x079d, 0xfc00, 0x3c01, 0x7e00, 0x7e00   ;   -inf       +one_eps   +qnan
+    dw 0x079e, 0xfc00, 0xc200, 0x0000, 0x7c00   ;   -inf       -three     +zero
+    dw 0x079f, 0xfc00, 0xc200, 0x8000, 0x7c00   ;   -inf       -three     -zero
+    dw 0x07a0, 0xfc00, 0xc200, 0x0001, 0x7c00   ;   -inf       -three     +min_sub
+    dw 0x07a1, 0xfc00, 0xc200, 0x8400, 0x7c00   ;   -inf       -three     -min_norm
+    dw 0x07a2, 0xfc00, 0xc200, 0x3c00, 0x7c00   ;   -inf       -three     +one
+    dw 0x07a3, 0xfc00, 0xc200, 0xbc00, 0x7c00   ;   -inf       -three     -one
+    dw 0x07a4, 0xfc00, 0xc200, 0x3c01, 0x7c00   ;   -inf       -three     +one_eps
+    dw 0x07a5, 0xfc00, 0xc200, 0xc200, 0x7c00   ;   -inf       -three     -three
+    dw 0x07a6, 0xfc00, 0xc200, 0x7bff, 0x7c00   ;   -inf       -three     +max
+    dw 0x07a7, 0xfc00, 0xc200, 0xfbff, 0x7c00   ;   -inf       -three     -max
+    dw 0x07a8, 0xfc00, 0xc200, 0x7c00, 0x7c00   ;   -inf       -three     +inf
+    dw 0x07a9, 0xfc00, 0xc200, 0xfc00, 0x7e00   ;   -inf       -three     -inf
+    dw 0x07aa, 0xfc00, 0xc200, 0x7e00, 0x7e00   ;   -inf       -three     +qnan
+    dw 0x07ab, 0xfc00, 0x7bff, 0x0000, 0xfc00   ;   -inf       +max       +zero
+    dw 0x07ac, 0xfc00, 0x7bff, 0x8000, 0xfc00   ;   -inf       +max       -zero
+    dw 0x07ad, 0xfc00, 0x7bff, 0x0001, 0xfc00   ;   -inf       +max       +min_sub
+    dw 0x07ae, 0xfc00, 0x7bff, 0x8400, 0xfc00   ;   -inf       +max       -min_norm
+    dw 0x07af, 0xfc00, 0x7bff, 0x3c00, 0xfc00   ;   -inf       +max       +one
+    dw 0x07b0, 0xfc00, 0x7bff, 0xbc00, 0xfc00   ;   -inf       +max       -one
+    dw 0x07b1, 0xfc00, 0x7bff, 0x3c01, 0xfc00   ;   -inf       +max       +one_eps
+    dw 0x07b2, 0xfc00, 0x7bff, 0xc200, 0xfc00   ;   -inf       +max       -three
+    dw 0x07b3, 0xfc00, 0x7bff, 0x7bff, 0xfc00   ;   -inf       +max       +max
+    dw 0x07b4, 0xfc00, 0x7bff, 0xfbff, 0xfc00   ;   -inf       +max       -max
+    dw 0x07b5, 0xfc00, 0x7bff, 0x7c00, 0x7e00   ;   -inf       +max       +inf
+    dw 0x07b6, 0xfc00, 0x7bff, 0xfc00, 0xfc00   ;   -inf       +max       -inf
+    dw 0x07b7, 0xfc00, 0x7bff, 0x7e00, 0x7e00   ;   -inf       +max       +qnan
+    dw 0x07b8, 0xfc00, 0xfbff, 0x0000, 0x7c00   ;   -inf       -max       +zero
+    dw 0x07b9, 0xfc00, 0xfbff, 0x8000, 0x7c00   ;   -inf       -max       -zero
+    dw 0x07ba, 0xfc00, 0xfbff, 0x0001, 0x7c00   ;   -inf       -max       +min_sub
+    dw 0x07bb, 0xfc00, 0xfbff, 0x8400, 0x7c00   ;   -inf       -max       -min_norm
+    dw 0x07bc, 0xfc00, 0xfbff, 0x3c00, 0x7c00   ;   -inf       -max       +one
+    dw 0x07bd, 0xfc00, 0xfbff, 0xbc00, 0x7c00   ;   -inf       -max       -one
+    dw 0x07be, 0xfc00, 0xfbff, 0x3c01, 0x7c00   ;   -inf       -max       +one_eps
+    dw 0x07bf, 0xfc00, 0xfbff, 0xc200, 0x7c00   ;   -inf       -max       -three
+    dw 0x07c0, 0xfc00, 0xfbff, 0x7bff, 0x7c00   ;   -inf       -max       +max
+    dw 0x07c1, 0xfc00, 0xfbff, 0xfbff, 0x7c00   ;   -inf       -max       -max
+    dw 0x07c2, 0xfc00, 0xfbff, 0x7c00, 0x7c00   ;   -inf       -max       +inf
+    dw 0x07c3, 0xfc00, 0xfbff, 0xfc00, 0x7e00   ;   -inf       -max       -inf
+    dw 0x07c4, 0xfc00, 0xfbff, 0x7e00, 0x7e00   ;   -inf       -max       +qnan
+    dw 0x07c5, 0xfc00, 0x7c00, 0x0000, 0xfc00   ;   -inf       +inf       +zero
+    dw 0x07c6, 0xfc00, 0x7c00, 0x8000, 0xfc00   ;   -inf       +inf       -zero
+    dw 0x07c7, 0xfc00, 0x7c00, 0x0001, 0xfc00   ;   -inf       +inf       +min_sub
+    dw 0x07c8, 0xfc00, 0x7c00, 0x8400, 0xfc00   ;   -inf       +inf       -min_norm
+    dw 0x07c9, 0xfc00, 0x7c00, 0x3c00, 0xfc00   ;   -inf       +inf       +one
+    dw 0x07ca, 0xfc00, 0x7c00, 0xbc00, 0xfc00   ;   -inf       +inf       -one
+    dw 0x07cb, 0xfc00, 0x7c00, 0x3c01, 0xfc00   ;   -inf       +inf       +one_eps
+    dw 0x07cc, 0xfc00, 0x7c00, 0xc200, 0xfc00   ;   -inf       +inf       -three
+    dw 0x07cd, 0xfc00, 0x7c00, 0x7bff, 0xfc00   ;   -inf       +inf       +max
+    dw 0x07ce, 0xfc00, 0x7c00, 0xfbff, 0xfc00   ;   -inf       +inf       -max
+    dw 0x07cf, 0xfc00, 0x7c00, 0x7c00, 0x7e00   ;   -inf       +inf       +inf
+    dw 0x07d0, 0xfc00, 0x7c00, 0xfc00, 0xfc00   ;   -inf       +inf       -inf
+    dw 0x07d1, 0xfc00, 0x7c00, 0x7e00, 0x7e00   ;   -inf       +inf       +qnan
+    dw 0x07d2, 0xfc00, 0xfc00, 0x0000, 0x7c00   ;   -inf       -inf       +zero
+    dw 0x07d3, 0xfc00, 0xfc00, 0x8000, 0x7c00   ;   -inf       -inf       -zero
+    dw 0x07d4, 0xfc00, 0xfc00, 0x0001, 0x7c00   ;   -inf       -inf       +min_sub
+    dw 0x07d5, 0xfc00, 0xfc00, 0x8400, 0x7c00   ;   -inf       -inf       -min_norm
+    dw 0x07d6, 0xfc00, 0xfc00, 0x3c00, 0x7c00   ;   -inf       -inf       +one
+    dw 0x07d7, 0xfc00, 0xfc00, 0xbc00, 0x7c00   ;   -inf       -inf       -one
+    dw 0x07d8, 0xfc00, 0xfc00, 0x3c01, 0x7c00   ;   -inf       -inf       +one_eps
+    dw 0x07d9, 0xfc00, 0xfc00, 0xc200, 0x7c00   ;   -inf       -inf       -three
+    dw 0x07da, 0xfc00, 0xfc00, 0x7bff, 0x7c00   ;   -inf       -inf       +max
+    dw 0x07db, 0xfc00, 0xfc00, 0xfbff, 0x7c00   ;   -inf       -inf       -max
+    dw 0x07dc, 0xfc00, 0xfc00, 0x7c00, 0x7c00   ;   -inf       -inf       +inf
+    dw 0x07dd, 0xfc00, 0xfc00, 0xfc00, 0x7e00   ;   -inf       -inf       -inf
+    dw 0x07de, 0xfc00, 0xfc00, 0x7e00, 0x7e00   ;   -inf       -inf       +qnan
+    dw 0x07df, 0xfc00, 0x7e00, 0x0000, 0x7e00   ;   -inf       +qnan      +zero
+    dw 0x07e0, 0xfc00, 0x7e00, 0x8000, 0x7e00   ;   -inf       +qnan      -zero
+    dw 0x07e1, 0xfc00, 0x7e00, 0x0001, 0x7e00   ;   -inf       +qnan      +min_sub
+    dw 0x07e2, 0xfc00, 0x7e00, 0x8400, 0x7e00   ;   -inf       +qnan      -min_norm
+    dw 0x07e3, 0xfc00, 0x7e00, 0x3c00, 0x7e00   ;   -inf       +qnan      +one
+    dw 0x07e4, 0xfc00, 0x7e00, 0xbc00, 0x7e00   ;   -inf       +qnan      -one
+    dw 0x07e5, 0xfc00, 0x7e00, 0x3c01, 0x7e00   ;   -inf       +qnan      +one_eps
+    dw 0x07e6, 0xfc00, 0x7e00, 0xc200, 0x7e00   ;   -inf       +qnan      -three
+    dw 0x07e7, 0xfc00, 0x7e00, 0x7bff, 0x7e00   ;   -inf       +qnan      +max
+    dw 0x07e8, 0xfc00, 0x7e00, 0xfbff, 0x7e00   ;   -inf       +qnan      -max
+    dw 0x07e9, 0xfc00, 0x7e00, 0x7c00, 0x7e00   ;   -inf       +qnan      +inf
+    dw 0x07ea, 0xfc00, 0x7e00, 0xfc00, 0x7e00   ;   -inf       +qnan      -inf
+    dw 0x07eb, 0xfc00, 0x7e00, 0x7e00, 0x7e00   ;   -inf       +qnan      +qnan
+    dw 0x07ec, 0x7e00, 0x0000, 0x0000, 0x7e00   ;   +qnan      +zero      +zero
+    dw 0x07ed, 0x7e00, 0x0000, 0x8000, 0x7e00   ;   +qnan      +zero      -zero
+    dw 0x07ee, 0x7e00, 0x0000, 0x0001, 0x7e00   ;   +qnan      +zero      +min_sub
+    dw 0x07ef, 0x7e00, 0x0000, 0x8400, 0x7e00   ;   +qnan      +zero      -min_norm
+    dw 0x07f0, 0x7e00, 0x0000, 0x3c00, 0x7e00   ;   +qnan      +zero      +one
+    dw 0x07f1, 0x7e00, 0x0000, 0xbc00, 0x7e00   ;   +qnan      +zero      -one
+    dw 0x07f2, 0x7e00, 0x0000, 0x3c01, 0x7e00   ;   +qnan      +zero      +one_eps
+    dw 0x07f3, 0x7e00, 0x0000, 0xc200, 0x7e00   ;   +qnan      +zero      -three
+    dw 0x07f4, 0x7e00, 0x0000, 0x7bff, 0x7e00   ;   +qnan      +zero      +max
+    dw 0x07f5, 0x7e00, 0x0000, 0xfbff, 0x7e00   ;   +qnan      +zero      -max
+    dw 0x07f6, 0x7e00, 0x0000, 0x7c00, 0x7e00   ;   +qnan      +zero      +inf
+    dw 0x07f7, 0x7e00, 0x0000, 0xfc00, 0x7e00   ;   +qnan      +zero      -inf
+    dw 0x07f8, 0x7e00, 0x0000, 0x7e00, 0x7e00   ;   +qnan      +zero      +qnan
+    dw 0x07f9, 0x7e00, 0x8000, 0x0000, 0x7e00   ;   +qnan      -zero      +zero
+    dw 0x07fa, 0x7e00, 0x8000, 0x8000, 0x7e00   ;   +qnan      -zero      -zero
+    dw 0x07fb, 0x7e00, 0x8000, 0x0001, 0x7e00   ;   +qnan      -zero      +min_sub
+    dw 0x07fc, 0x7e00, 0x8000, 0x8400, 0x7e00   ;   +qnan      -zero      -min_norm
+    dw 0x07fd, 0x7e00, 0x8000, 0x3c00, 0x7e00   ;   +qnan      -zero      +one
+    dw 0x07fe, 0x7e00, 0x8000, 0xbc00, 0x7e00   ;   +qnan      -zero      -one
+    dw 0x07ff, 0x7e00, 0x8000, 0x3c01, 0x7e00   ;   +qnan      -zero      +one_eps
+    dw 0x0800, 0x7e00, 0x8000, 0xc200, 0x7e00   ;   +qnan      -zero      -three
+    dw 0x0801, 0x7e00, 0x8000, 0x7bff, 0x7e00   ;   +qnan      -zero      +max
+    dw 0x0802, 0x7e00, 0x8000, 0xfbff, 0x7e00   ;   +qnan      -zero      -max
+    dw 0x0803, 0x7e00, 0x8000, 0x7c00, 0x7e00   ;   +qnan      -zero      +inf
+    dw 0x0804, 0x7e00, 0x8000, 0xfc00, 0x7e00   ;   +qnan      -zero      -inf
+    dw 0x0805, 0x7e00, 0x8000, 0x7e00, 0x7e00   ;   +qnan      -zero      +qnan
+    dw 0x0806, 0x7e00, 0x0001, 0x0000, 0x7e00   ;   +qnan      +min_sub   +zero
+    dw 0x0807, 0x7e00, 0x0001, 0x8000, 0x7e00   ;   +qnan      +min_sub   -zero
+    dw 0x0808, 0x7e00, 0x0001, 0x0001, 0x7e00   ;   +qnan      +min_sub   +min_sub
+    dw 0x0809, 0x7e00, 0x0001, 0x8400, 0x7e00   ;   +qnan      +min_sub   -min_norm
+    dw 0x080a, 0x7e00, 0x0001, 0x3c00, 0x7e00   ;   +qnan      +min_sub   +one
+    dw 0x080b, 0x7e00, 0x0001, 0xbc00, 0x7e00   ;   +qnan      +min_sub   -one
+    dw 0x080c, 0x7e00, 0x0001, 0x3c01, 0x7e00   ;   +qnan      +min_sub   +one_eps
+    dw 0x080d, 0x7e00, 0x0001, 0xc200, 0x7e00   ;   +qnan      +min_sub   -three
+    dw 0x080e, 0x7e00, 0x0001, 0x7bff, 0x7e00   ;   +qnan      +min_sub   +max
+    dw 0x080f, 0x7e00, 0x0001, 0xfbff, 0x7e00   ;   +qnan      +min_sub   -max
+    dw 0x0810, 0x7e00, 0x0001, 0x7c00, 0x7e00   ;   +qnan      +min_sub   +inf
+    dw 0x0811, 0x7e00, 0x0001, 0xfc00, 0x7e00   ;   +qnan      +min_sub   -inf
+    dw 0x0812, 0x7e00, 0x0001, 0x7e00, 0x7e00   ;   +qnan      +min_sub   +qnan
+    dw 0x0813, 0x7e00, 0x8400, 0x0000, 0x7e00   ;   +qnan      -min_norm  +zero
+    dw 0x0814, 0x7e00, 0x8400, 0x8000, 0x7e00   ;   +qnan      -min_norm  -zero
+    dw 0x0815, 0x7e00, 0x8400, 0x0001, 0x7e00   ;   +qnan      -min_norm  +min_sub
+    dw 0x0816, 0x7e00, 0x8400, 0x8400, 0x7e00   ;   +qnan      -min_norm  -min_norm
+    dw 0x0817, 0x7e00, 0x8400, 0x3c00, 0x7e00   ;   +qnan      -min_norm  +one
+    dw 0x0818, 0x7e00, 0x8400, 0xbc00, 0x7e00   ;   +qnan      -min_norm  -one
+    dw 0x0819, 0x7e00, 0x8400, 0x3c01, 0x7e00   ;   +qnan      -min_norm  +one_eps
+    dw 0x081a, 0x7e00, 0x8400, 0xc200, 0x7e00   ;   +qnan      -min_norm  -three
+    dw 0x081b, 0x7e00, 0x8400, 0x7bff, 0x7e00   ;   +qnan      -min_norm  +max
+    dw 0x081c, 0x7e00, 0x8400, 0xfbff, 0x7e00   ;   +qnan      -min_norm  -max
+    dw 0x081d, 0x7e00, 0x8400, 0x7c00, 0x7e00   ;   +qnan      -min_norm  +inf
+    dw 0x081e, 0x7e00, 0x8400, 0xfc00, 0x7e00   ;   +qnan      -min_norm  -inf
+    dw 0x081f, 0x7e00, 0x8400, 0x7e00, 0x7e00   ;   +qnan      -min_norm  +qnan
+    dw 0x0820, 0x7e00, 0x3c00, 0x0000, 0x7e00   ;   +qnan      +one       +zero
+    dw 0x0821, 0x7e00, 0x3c00, 0x8000, 0x7e00   ;   +qnan      +one       -zero
+    dw 0x0822, 0x7e00, 0x3c00, 0x0001, 0x7e00   ;   +qnan      +one       +min_sub
+    dw 0x0823, 0x7e00, 0x3c00, 0x8400, 0x7e00   ;   +qnan      +one       -min_norm
+    dw 0x0824, 0x7e00, 0x3c00, 0x3c00, 0x7e00   ;   +qnan      +one       +one
+    dw 0x0825, 0x7e00, 0x3c00, 0xbc00, 0x7e00   ;   +qnan      +one       -one
+    dw 0x0826, 0x7e00, 0x3c00, 0x3c01, 0x7e00   ;   +qnan      +one       +one_eps
+    dw 0x0827, 0x7e00, 0x3c00, 0xc200, 0x7e00   ;   +qnan      +one       -three
+    dw 0x0828, 0x7e00, 0x3c00, 0x7bff, 0x7e00   ;   +qnan      +one       +max
+    dw 0x0829, 0x7e00, 0x3c00, 0xfbff, 0x7e00   ;   +qnan      +one       -max
+    dw 0x082a, 0x7e00, 0x3c00, 0x7c00, 0x7e00   ;   +qnan      +one       +inf
+    dw 0x082b, 0x7e00, 0x3c00, 0xfc00, 0x7e00   ;   +qnan      +one       -inf
+    dw 0x082c, 0x7e00, 0x3c00, 0x7e00, 0x7e00   ;   +qnan      +one       +qnan
+    dw 0x082d, 0x7e00, 0xbc00, 0x0000, 0x7e00   ;   +qnan      -one       +zero
+    dw 0x082e, 0x7e00, 0xbc00, 0x8000, 0x7e00   ;   +qnan      -one       -zero
+    dw 0x082f, 0x7e00, 0xbc00, 0x0001, 0x7e00   ;   +qnan      -one       +min_sub
+    dw 0x0830, 0x7e00, 0xbc00, 0x8400, 0x7e00   ;   +qnan      -one       -min_norm
+    dw 0x0831, 0x7e00, 0xbc00, 0x3c00, 0x7e00   ;   +qnan      -one       +one
+    dw 0x0832, 0x7e00, 0xbc00, 0xbc00, 0x7e00   ;   +qnan      -one       -one
+    dw 0x0833, 0x7e00, 0xbc00, 0x3c01, 0x7e00   ;   +qnan      -one       +one_eps
+    dw 0x0834, 0x7e00, 0xbc00, 0xc200, 0x7e00   ;   +qnan      -one       -three
+    dw 0x0835, 0x7e00, 0xbc00, 0x7bff, 0x7e00   ;   +qnan      -one       +max
+    dw 0x0836, 0x7e00, 0xbc00, 0xfbff, 0x7e00   ;   +qnan      -one       -max
+    dw 0x0837, 0x7e00, 0xbc00, 0x7c00, 0x7e00   ;   +qnan      -one       +inf
+    dw 0x0838, 0x7e00, 0xbc00, 0xfc00, 0x7e00   ;   +qnan      -one       -inf
+    dw 0x0839, 0x7e00, 0xbc00, 0x7e00, 0x7e00   ;   +qnan      -one       +qnan
+    dw 0x083a, 0x7e00, 0x3c01, 0x0000, 0x7e00   ;   +qnan      +one_eps   +zero
+    dw 0x083b, 0x7e00, 0x3c01, 0x8000, 0x7e00   ;   +qnan      +one_eps   -zero
+    dw 0x083c, 0x7e00, 0x3c01, 0x0001, 0x7e00   ;   +qnan      +one_eps   +min_sub
+    dw 0x083d, 0x7e00, 0x3c01, 0x8400, 0x7e00   ;   +qnan      +one_eps   -min_norm
+    dw 0x083e, 0x7e00, 0x3c01, 0x3c00, 0x7e00   ;   +qnan      +one_eps   +one
+    dw 0x083f, 0x7e00, 0x3c01, 0xbc00, 0x7e00   ;   +qnan      +one_eps   -one
+    dw 0x0840, 0x7e00, 0x3c01, 0x3c01, 0x7e00   ;   +qnan      +one_eps   +one_eps
+    dw 0x0841, 0x7e00, 0x3c01, 0xc200, 0x7e00   ;   +qnan      +one_eps   -three
+    dw 0x0842, 0x7e00, 0x3c01, 0x7bff, 0x7e00   ;   +qnan      +one_eps   +max
+    dw 0x0843, 0x7e00, 0x3c01, 0xfbff, 0x7e00   ;   +qnan      +one_eps   -max
+    dw 0x0844, 0x7e00, 0x3c01, 0x7c00, 0x7e00   ;   +qnan      +one_eps   +inf
+    dw 0x0845, 0x7e00, 0x3c01, 0xfc00, 0x7e00   ;   +qnan      +one_eps   -inf
+    dw 0x0846, 0x7e00, 0x3c01, 0x7e00, 0x7e00   ;   +qnan      +one_eps   +qnan
+    dw 0x0847, 0x7e00, 0xc200, 0x0000, 0x7e00   ;   +qnan      -three     +zero
+    dw 0x0848, 0x7e00, 0xc200, 0x8000, 0x7e00   ;   +qnan      -three     -zero
+    dw 0x0849, 0x7e00, 0xc200, 0x0001, 0x7e00   ;   +qnan      -three     +min_sub
+    dw 0x084a, 0x7e00, 0xc200, 0x8400, 0x7e00   ;   +qnan      -three     -min_norm
+    dw 0x084b, 0x7e00, 0xc200, 0x3c00, 0x7e00   ;   +qnan      -three     +one
+    dw 0x084c, 0x7e00, 0xc200, 0xbc00, 0x7e00   ;   +qnan      -three     -one
+    dw 0x084d, 0x7e00, 0xc200, 0x3c01, 0x7e00   ;   +qnan      -three     +one_eps
+    dw 0x084e, 0x7e00, 0xc200, 0xc200, 0x7e00   ;   +qnan      -three     -three
+    dw 0x084f, 0x7e00, 0xc200, 0x7bff, 0x7e00   ;   +qnan      -three     +max
+    dw 0x0850, 0x7e00, 0xc200, 0xfbff, 0x7e00   ;   +qnan      -three     -max
+    dw 0x0851, 0x7e00, 0xc200, 0x7c00, 0x7e00   ;   +qnan      -three     +inf
+    dw 0x0852, 0x7e00, 0xc200, 0xfc00, 0x7e00   ;   +qnan      -three     -inf
+    dw 0x0853, 0x7e00, 0xc200, 0x7e00, 0x7e00   ;   +qnan      -three     +qnan
+    dw 0x0854, 0x7e00, 0x7bff, 0x0000, 0x7e00   ;   +qnan      +max       +zero
+    dw 0x0855, 0x7e00, 0x7bff, 0x8000, 0x7e00   ;   +qnan      +max       -zero
+    dw 0x0856, 0x7e00, 0x7bff, 0x0001, 0x7e00   ;   +qnan      +max       +min_sub
+    dw 0x0857, 0x7e00, 0x7bff, 0x8400, 0x7e00   ;   +qnan      +max       -min_norm
+    dw 0x0858, 0x7e00, 0x7bff, 0x3c00, 0x7e00   ;   +qnan      +max       +one
+    dw 0x0859, 0x7e00, 0x7bff, 0xbc00, 0x7e00   ;   +qnan      +max       -one
+    dw 0x085a, 0x7e00, 0x7bff, 0x3c01, 0x7e00   ;   +qnan      +max       +one_eps
+    dw 0x085b, 0x7e00, 0x7bff, 0xc200, 0x7e00   ;   +qnan      +max       -three
+    dw 0x085c, 0x7e00, 0x7bff, 0x7bff, 0x7e00   ;   +qnan      +max       +max
+    dw 0x085d, 0x7e00, 0x7bff, 0xfbff, 0x7e00   ;   +qnan      +max       -max
+    dw 0x085e, 0x7e00, 0x7bff, 0x7c00, 0x7e00   ;   +qnan      +max       +inf
+    dw 0x085f, 0x7e00, 0x7bff, 0xfc00, 0x7e00   ;   +qnan      +max       -inf
+    dw 0x0860, 0x7e00, 0x7bff, 0x7e00, 0x7e00   ;   +qnan      +max       +qnan
+    dw 0x0861, 0x7e00, 0xfbff, 0x0000, 0x7e00   ;   +qnan      -max       +zero
+    dw 0x0862, 0x7e00, 0xfbff, 0x8000, 0x7e00   ;   +qnan      -max       -zero
+    dw 0x0863, 0x7e00, 0xfbff, 0x0001, 0x7e00   ;   +qnan      -max       +min_sub
+    dw 0x0864, 0x7e00, 0xfbff, 0x8400, 0x7e00   ;   +qnan      -max       -min_norm
+    dw 0x0865, 0x7e00, 0xfbff, 0x3c00, 0x7e00   ;   +qnan      -max       +one
+    dw 0x0866, 0x7e00, 0xfbff, 0xbc00, 0x7e00   ;   +qnan      -max       -one
+    dw 0x0867, 0x7e00, 0xfbff, 0x3c01, 0x7e00   ;   +qnan      -max       +one_eps
+    dw 0x0868, 0x7e00, 0xfbff, 0xc200, 0x7e00   ;   +qnan      -max       -three
+    dw 0x0869, 0x7e00, 0xfbff, 0x7bff, 0x7e00   ;   +qnan      -max       +max
+    dw 0x086a, 0x7e00, 0xfbff, 0xfbff, 0x7e00   ;   +qnan      -max       -max
+    dw 0x086b, 0x7e00, 0xfbff, 0x7c00, 0x7e00   ;   +qnan      -max       +inf
+    dw 0x086c, 0x7e00, 0xfbff, 0xfc00, 0x7e00   ;   +qnan      -max       -inf
+    dw 0x086d, 0x7e00, 0xfbff, 0x7e00, 0x7e00   ;   +qnan      -max       +qnan
+    dw 0x086e, 0x7e00, 0x7c00, 0x0000, 0x7e00   ;   +qnan      +inf       +zero
+    dw 0x086f, 0x7e00, 0x7c00, 0x8000, 0x7e00   ;   +qnan      +inf       -zero
+    dw 0x0870, 0x7e00, 0x7c00, 0x0001, 0x7e00   ;   +qnan      +inf       +min_sub
+    dw 0x0871, 0x7e00, 0x7c00, 0x8400, 0x7e00   ;   +qnan      +inf       -min_norm
+    dw 0x0872, 0x7e00, 0x7c00, 0x3c00, 0x7e00   ;   +qnan      +inf       +one
+    dw 0x0873, 0x7e00, 0x7c00, 0xbc00, 0x7e00   ;   +qnan      +inf       -one
+    dw 0x0874, 0x7e00, 0x7c00, 0x3c01, 0x7e00   ;   +qnan      +inf       +one_eps
+    dw 0x0875, 0x7e00, 0x7c00, 0xc200, 0x7e00   ;   +qnan      +inf       -three
+    dw 0x0876, 0x7e00, 0x7c00, 0x7bff, 0x7e00   ;   +qnan      +inf       +max
+    dw 0x0877, 0x7e00, 0x7c00, 0xfbff, 0x7e00   ;   +qnan      +inf       -max
+    dw 0x0878, 0x7e00, 0x7c00, 0x7c00, 0x7e00   ;   +qnan      +inf       +inf
+    dw 0x0879, 0x7e00, 0x7c00, 0xfc00, 0x7e00   ;   +qnan      +inf       -inf
+    dw 0x087a, 0x7e00, 0x7c00, 0x7e00, 0x7e00   ;   +qnan      +inf       +qnan
+    dw 0x087b, 0x7e00, 0xfc00, 0x0000, 0x7e00   ;   +qnan      -inf       +zero
+    dw 0x087c, 0x7e00, 0xfc00, 0x8000, 0x7e00   ;   +qnan      -inf       -zero
+    dw 0x087d, 0x7e00, 0xfc00, 0x0001, 0x7e00   ;   +qnan      -inf       +min_sub
+    dw 0x087e, 0x7e00, 0xfc00, 0x8400, 0x7e00   ;   +qnan      -inf       -min_norm
+    dw 0x087f, 0x7e00, 0xfc00, 0x3c00, 0x7e00   ;   +qnan      -inf       +one
+    dw 0x0880, 0x7e00, 0xfc00, 0xbc00, 0x7e00   ;   +qnan      -inf       -one
+    dw 0x0881, 0x7e00, 0xfc00, 0x3c01, 0x7e00   ;   +qnan      -inf       +one_eps
+    dw 0x0882, 0x7e00, 0xfc00, 0xc200, 0x7e00   ;   +qnan      -inf       -three
+    dw 0x0883, 0x7e00, 0xfc00, 0x7bff, 0x7e00   ;   +qnan      -inf       +max
+    dw 0x0884, 0x7e00, 0xfc00, 0xfbff, 0x7e00   ;   +qnan      -inf       -max
+    dw 0x0885, 0x7e00, 0xfc00, 0x7c00, 0x7e00   ;   +qnan      -inf       +inf
+    dw 0x0886, 0x7e00, 0xfc00, 0xfc00, 0x7e00   ;   +qnan      -inf       -inf
+    dw 0x0887, 0x7e00, 0xfc00, 0x7e00, 0x7e00   ;   +qnan      -inf       +qnan
+    dw 0x0888, 0x7e00, 0x7e00, 0x0000, 0x7e00   ;   +qnan      +qnan      +zero
+    dw 0x0889, 0x7e00, 0x7e00, 0x8000, 0x7e00   ;   +qnan      +qnan      -zero
+    dw 0x088a, 0x7e00, 0x7e00, 0x0001, 0x7e00   ;   +qnan      +qnan      +min_sub
+    dw 0x088b, 0x7e00, 0x7e00, 0x8400, 0x7e00   ;   +qnan      +qnan      -min_norm
+    dw 0x088c, 0x7e00, 0x7e00, 0x3c00, 0x7e00   ;   +qnan      +qnan      +one
+    dw 0x088d, 0x7e00, 0x7e00, 0xbc00, 0x7e00   ;   +qnan      +qnan      -one
+    dw 0x088e, 0x7e00, 0x7e00, 0x3c01, 0x7e00   ;   +qnan      +qnan      +one_eps
+    dw 0x088f, 0x7e00, 0x7e00, 0xc200, 0x7e00   ;   +qnan      +qnan      -three
+    dw 0x0890, 0x7e00, 0x7e00, 0x7bff, 0x7e00   ;   +qnan      +qnan      +max
+    dw 0x0891, 0x7e00, 0x7e00, 0xfbff, 0x7e00   ;   +qnan      +qnan      -max
+    dw 0x0892, 0x7e00, 0x7e00, 0x7c00, 0x7e00   ;   +qnan      +qnan      +inf
+    dw 0x0893, 0x7e00, 0x7e00, 0xfc00, 0x7e00   ;   +qnan      +qnan      -inf
+    dw 0x0894, 0x7e00, 0x7e00, 0x7e00, 0x7e00   ;   +qnan      +qnan      +qnan
+
+    ; Uniform random values
+    dw 0x0895, 0x83c9, 0x28ee, 0x8320, 0x8345
+    dw 0x0896, 0x4465, 0x1b7d, 0x07a4, 0x2425
+    dw 0x0897, 0x3cf4, 0x6993, 0xf8ef, 0xf881
+    dw 0x0898, 0x0ff3, 0x50a5, 0xf771, 0xf771
+    dw 0x0899, 0x154e, 0x2aa8, 0xa29b, 0xa292
+    dw 0x089a, 0x0462, 0xd0b2, 0x71b3, 0x71b3
+    dw 0x089b, 0x4f5d, 0xda32, 0x3d7f, 0xedb3
+    dw 0x089c, 0xdfaa, 0xbb1d, 0x03ff, 0x5ed1
+    dw 0x089d, 0x2198, 0xb758, 0x14b3, 0x9bec
+    dw 0x089e, 0x3b65, 0x6b99, 0xdf17, 0x6a23
+    dw 0x089f, 0x8a27, 0xf159, 0xc4a8, 0xc133
+    dw 0x08a0, 0xb218, 0xf0a9, 0x1d16, 0x6719
+    dw 0x08a1, 0x2a10, 0x254a, 0x8fba, 0x1027
+    dw 0x08a2, 0x1ab5, 0xad5f, 0xce57, 0xce57
+    dw 0x08a3, 0xfab4, 0xf312, 0x2745, 0x7c00
+    dw 0x08a4, 0x10fa, 0x36e3, 0xd855, 0xd855
+    dw 0x08a5, 0x4845, 0x6a82, 0xb9a9, 0x76f2
+    dw 0x08a6, 0x838b, 0x318c, 0xdb97, 0xdb97
+    dw 0x08a7, 0x8091, 0x74bb, 0x55fc, 0x55f9
+    dw 0x08a8, 0xfb17, 0x5fb6, 0xdff0, 0xfc00
+    dw 0x08a9, 0xf85a, 0x69d1, 0x0a05, 0xfc00
+    dw 0x08aa, 0x8e59, 0x5290, 0xe12d, 0xe12d
+    dw 0x08ab, 0x6521, 0x2152, 0x5282, 0x541b
+    dw 0x08ac, 0x805f, 0xcffc, 0xc43d, 0xc43d
+    dw 0x08ad, 0x0cf5, 0x7a4a, 0xbb3c, 0x4b57
+    dw 0x08ae, 0x3b49, 0xe3dc, 0xe982, 0xeb4c
+    dw 0x08af, 0x17d2, 0xf6cf, 0xd173, 0xd60d
+    dw 0x08b0, 0x3940, 0x91be, 0xcbfa, 0xcbfa
+    dw 0x08b1, 0x1ea6, 0x90ef, 0xc132, 0xc132
+    dw 0x08b2, 0x5782, 0xc7b0, 0xe08b, 0xe5e1
+    dw 0x08b3, 0x5a76, 0xbd61, 0x8dac, 0xdc58
+    dw 0x08b4, 0x89dd, 0xf92d, 0x64dc, 0x64e4
+    dw 0x08b5, 0x560d, 0x9a9e, 0x88da, 0xb502
+    dw 0x08b6, 0xb62a, 0xb2a5, 0xcceb, 0xcce6
+    dw 0x08b7, 0x8c76, 0x9966, 0x1846, 0x1846
+    dw 0x08b8, 0x44cd, 0x36e4, 0xd9c9, 0xd9b8
+    dw 0x08b9, 0xc1a5, 0x2730, 0x601b, 0x601b
+    dw 0x08ba, 0xe594, 0xdf6e, 0xc843, 0x7c00
+    dw 0x08bb, 0xdc91, 0x0ca3, 0x0c71, 0xad47
+    dw 0x08bc, 0x4046, 0xd8cd, 0xb3f7, 0xdd22
+    dw 0x08bd, 0x878c, 0x3c54, 0xbfb3, 0xbfb3
+    dw 0x08be, 0xb299, 0x72e6, 0xb724, 0xe9b1
+    dw 0x08bf, 0x58ee, 0xa41b, 0xb570, 0xc1bd
+    dw 0x08c0, 0x072b, 0x1946, 0x427e, 0x427e
+    dw 0x08c1, 0xce89, 0xd568, 0x9569, 0x686b
+    dw 0x08c2, 0x3004, 0x6ab7, 0x153e, 0x5ebe
+    dw 0x08c3, 0x0e60, 0xf27a, 0x9819, 0xc52a
+    dw 0x08c4, 0x7ad8, 0x5514, 0x6997, 0x7c00
+    dw 0x08c5, 0x8e83, 0x78a9, 0x0150, 0xcb96
+    dw 0x08c6, 0x22a3, 0xc6f4, 0x0051, 0xadc5
+    dw 0x08c7, 0x53e4, 0x6699, 0x1465, 0x7c00
+    dw 0x08c8, 0xbfe4, 0xe6a6, 0xe55b, 0x67c2
+    dw 0x08c9, 0x0484, 0x2a59, 0xe4ee, 0xe4ee
+    dw 0x08ca, 0xda57, 0x215c, 0x30bf, 0xbfe7
+    dw 0x08cb, 0x3cc1, 0x63c0, 0xbe44, 0x6499
+    dw 0x08cc, 0xc899, 0xcdbe, 0xaecc, 0x5a99
+    dw 0x08cd, 0xfb7a, 0x39ce, 0x5c24, 0xf964
+    dw 0x08ce, 0xf10d, 0xedcc, 0x07c8, 0x7c00
+    dw 0x08cf, 0x5116, 0xbd8c, 0x9f8c, 0xd30e
+    dw 0x08d0, 0x9523, 0x515c, 0x6d32, 0x6d32
+    dw 0x08d1, 0xea1c, 0xe3d0, 0x0198, 0x7c00
+    dw 0x08d2, 0x875a, 0x8f72, 0xf223, 0xf223
+    dw 0x08d3, 0x36ed, 0xfa64, 0x2cab, 0xf588
+    dw 0x08d4, 0xe402, 0xeed2, 0x3bd7, 0x7c00
+    dw 0x08d5, 0x0e56, 0x0b9f, 0xcb98, 0xcb98
+    dw 0x08d6, 0xe866, 0x043a, 0x4dd4, 0x4dcb
+    dw 0x08d7, 0xa088, 0x3282, 0x3b4c, 0x3b48
+    dw 0x08d8, 0x55f6, 0x8e3e, 0x9515, 0xa8cf
+    dw 0x08d9, 0x97d8, 0x64a2, 0x9d1d, 0xc08d
+    dw 0x08da, 0x65b8, 0x4334, 0xb912, 0x6d26
+    dw 0x08db, 0x3d94, 0xdb3b, 0x2c18, 0xdd0a
+    dw 0x08dc, 0x2c6e, 0x1ba3, 0x200f, 0x2031
+    dw 0x08dd, 0x5b48, 0x8835, 0xe662, 0xe662
+    dw 0x08de, 0x5f47, 0x2426, 0xb320, 0x4753
+    dw 0x08df, 0x6705, 0x017d, 0xc97d, 0xc978
+    dw 0x08e0, 0x0ad7, 0x65de, 0xaa0a, 0x3443
+    dw 0x08e1, 0x4d1c, 0x57ab, 0xf25c, 0xf123
+    dw 0x08e2, 0x0bff, 0xdcc5, 0x9182, 0xaccf
+    dw 0x08e3, 0x2f8e, 0x83fd, 0x0753, 0x06da
+    dw 0x08e4, 0xbbc2, 0xf8f2, 0xd5dc, 0x78c9
+    dw 0x08e5, 0xbc74, 0x2337, 0x6f3e, 0x6f3e
+    dw 0x08e6, 0x4f3e, 0xc934, 0xd132, 0xdd5c
+    dw 0x08e7, 0x320a, 0x9a46, 0x8474, 0x914b
+    dw 0x08e8, 0xd8ad, 0x77ec, 0x56e3, 0xfc00
+    dw 0x08e9, 0xd3cf, 0x6f11, 0xb458, 0xfc00
+    dw 0x08ea, 0x5a08, 0xc810, 0x9baf, 0xe620
+    dw 0x08eb, 0x95d0, 0x2beb, 0x86fa, 0x8a5d
+    dw 0x08ec, 0xd823, 0x944e, 0x216f, 0x30cb
+    dw 0x08ed, 0x642a, 0x3bd3, 0xfb14, 0xfaf3
+    dw 0x08ee, 0xbac5, 0x5228, 0x5ac3, 0x5976
+    dw 0x08ef, 0xb674, 0x4235, 0x5e63, 0x5e5e
+    dw 0x08f0, 0x7a6d, 0xd17d, 0x6add, 0xfc00
+    dw 0x08f1, 0x2da7, 0x4ac4, 0xd302, 0xd2dc
+    dw 0x08f2, 0x73a0, 0xbd31, 0x2405, 0xf4f3
+    dw 0x08f3, 0xb654, 0xeb29, 0xac1f, 0x65aa
+    dw 0x08f4, 0xf0e0, 0x00c4, 0xdc46, 0xdc46
+    dw 0x08f5, 0xa53a, 0x6284, 0xe654, 0xe665
+    dw 0x08f6, 0x4693, 0x1bf4, 0x5cce, 0x5cce
+    dw 0x08f7, 0xde64, 0xa212, 0x56b1, 0x56ff
+    dw 0x08f8, 0x0827, 0x278f, 0x6dab, 0x6dab
+    dw 0x08f9, 0xb749, 0xe5de, 0x2717, 0x6158
+    dw 0x08fa, 0x6f84, 0x07cf, 0x8dc4, 0x3b55
+    dw 0x08fb, 0x5678, 0x415d, 0x29ce, 0x5c56
+    dw 0x08fc, 0x9aad, 0xe4c2, 0xa07d, 0x43ec
+    dw 0x08fd, 0x5f82, 0xf1de, 0xb885, 0xfc00
+    dw 0x08fe, 0x0944, 0x4097, 0x6c55, 0x6c55
+    dw 0x08ff, 0xde72, 0x72db, 0x0bcf, 0xfc00
+    dw 0x0900, 0xdc21, 0x54ab, 0x9b89, 0xf4d2
+    dw 0x0901, 0x4f00, 0xc2bc, 0xa0da, 0xd5e5
+    dw 0x0902, 0x993b, 0x30e2, 0x5b3e, 0x5b3e
+    dw 0x0903, 0x342f, 0x8262, 0xf099, 0xf099
+    dw 0x0904, 0xf017, 0xa722, 0x657f, 0x6668
+    dw 0x0905, 0xc0d7, 0xc97e, 0x1983, 0x4ea5
+    dw 0x0906, 0x0bb7, 0x60c2, 0xbeb3, 0xbe20
+    dw 0x0907, 0xc69b, 0x30f0, 0x2e5f, 0xbb5b
+    dw 0x0908, 0xcdf7, 0xc402, 0xe496, 0xe436
+    dw 0x0909, 0xcf74, 0xc26a, 0x1e42, 0x55fa
+    dw 0x090a, 0x5b1d, 0x1989, 0x0659, 0x38ec
+    dw 0x090b, 0x886a, 0xa486, 0x1631, 0x1633
+    dw 0x090c, 0x692a, 0x5856, 0x97c6, 0x7c00
+    dw 0x090d, 0xd004, 0x324f, 0xc35b, 0xc901
+    dw 0x090e, 0xc56f, 0x6f91, 0x953c, 0xf924
+    dw 0x090f, 0xce5b, 0x1c8f, 0x86df, 0xaf40
+    dw 0x0910, 0xe6bc, 0xe7a3, 0x6aae, 0x7c00
+    dw 0x0911, 0x510d, 0x7228, 0x710d, 0x7c00
+    dw 0x0912, 0x2bfc, 0x4447, 0x7805, 0x7805
+    dw 0x0913, 0x6ca2, 0xa68a, 0x08dc, 0xd793
+    dw 0x0914, 0x2036, 0xbe7b, 0x9ac1, 0xa441
+    dw 0x0915, 0xbf00, 0x4394, 0xbfa6, 0xc846
+    dw 0x0916, 0x397e, 0x5493, 0x91b2, 0x5248
+    dw 0x0917, 0x2607, 0x2600, 0xf10d, 0xf10d
+    dw 0x0918, 0x683e, 0x1a17, 0x7592, 0x7592
+    dw 0x0919, 0xd39e, 0xd14a, 0xb974, 0x6909
+    dw 0x091a, 0xf160, 0x5bdd, 0xfb15, 0xfc00
+    dw 0x091b, 0x83a0, 0x3fc1, 0xc908, 0xc908
+    dw 0x091c, 0xfb36, 0x9c8b, 0xa231, 0x5c18
+    dw 0x091d, 0xb0e6, 0xdb14, 0x04a0, 0x5055
+    dw 0x091e, 0xa0c4, 0x81d6, 0xd2d9, 0xd2d9
+    dw 0x091f, 0xa9a8, 0xee9e, 0x6217, 0x6437
+    dw 0x0920, 0xf75d, 0xd2ab, 0x997b, 0x7c00
+    dw 0x0921, 0xaac2, 0x320a, 0x3511, 0x34e8
+    dw 0x0922, 0xd575, 0x3caa, 0x79e6, 0x79e3
+    dw 0x0923, 0x8057, 0x5552, 0x00ca, 0x8f09
+    dw 0x0924, 0x3677, 0xa554, 0x4da0, 0x4d9f
+    dw 0x0925, 0x4ee2, 0xa390, 0x469a, 0x4632
+    dw 0x0926, 0xef20, 0xbc4c, 0x0e85, 0x6fa7
+    dw 0x0927, 0x9633, 0x73d2, 0xf2ab, 0xf2ae
+    dw 0x0928, 0x7260, 0x9d29, 0x6e98, 0x6e88
+    dw 0x0929, 0xd2ce, 0x4c32, 0x0cf7, 0xe323
+    dw 0x092a, 0xb03d, 0x91bd, 0x790d, 0x790d
+    dw 0x092b, 0xf7a2, 0xbc9a, 0x2e19, 0x7864
+    dw 0x092c, 0x12dc, 0xf4a4, 0x0b9b, 0xcbf5
+    dw 0x092d, 0x6c97, 0x951e, 0x356e, 0xc588
+    dw 0x092e, 0x16f9, 0x963b, 0x1ece, 0x1ecd
+    dw 0x092f, 0xcb78, 0xa845, 0x9121, 0x37f6
+    dw 0x0930, 0x453c, 0x2250, 0x5d8c, 0x5d8c
+    dw 0x0931, 0xd4a2, 0x5a65, 0xf3a9, 0xf788
+    dw 0x0932, 0xd400, 0x26e4, 0x08b0, 0xbee4
+    dw 0x0933, 0x0db7, 0x48f8, 0xcb08, 0xcb08
+    dw 0x0934, 0x86bb, 0xdc2c, 0x3946, 0x397e
+    dw 0x0935, 0xd6b2, 0x92f8, 0x5155, 0x5158
+    dw 0x0936, 0xd97a, 0x630b, 0x2777, 0xfc00
+    dw 0x0937, 0x1813, 0x3e3a, 0xbe15, 0xbe12
+    dw 0x0938, 0xa280, 0xf65f, 0xaa5f, 0x5d2d
+    dw 0x0939, 0x8642, 0xf1cb, 0x23e7, 0x3c98
+    dw 0x093a, 0x4c28, 0x16c4, 0xce6e, 0xce6c
+    dw 0x093b, 0x433c, 0x8507, 0xd8f9, 0xd8f9
+    dw 0x093c, 0x9b27, 0x1df8, 0x5a48, 0x5a48
+    dw 0x093d, 0x774a, 0x949e, 0x2ea4, 0xd032
+    dw 0x093e, 0x5cba, 0x1e4a, 0x611f, 0x6123
+    dw 0x093f, 0x46e2, 0x1265, 0x1354, 0x1e6b
+    dw 0x0940, 0x44d8, 0x057e, 0xf80e, 0xf80e
+    dw 0x0941, 0x3fa2, 0xc843, 0x2785, 0xcc0f
+    dw 0x0942, 0x3615, 0x37d9, 0xf9a9, 0xf9a9
+    dw 0x0943, 0x8ef4, 0x168d, 0x9f85, 0x9f85
+    dw 0x0944, 0x602f, 0x1823, 0x54e8, 0x54f9
+    dw 0x0945, 0x4960, 0x214c, 0xb75a, 0xb592
+    dw 0x0946, 0x97d3, 0x97e1, 0xe17e, 0xe17e
+    dw 0x0947, 0xc24b, 0xda6d, 0x0026, 0x610e
+    dw 0x0948, 0xa260, 0xf182, 0xf0de, 0xf0cc
+    dw 0x0949, 0x9cc8, 0x1503, 0xc486, 0xc486
+    dw 0x094a, 0x33fa, 0xa069, 0x5abc, 0x5abc
+    dw 0x094b, 0xc048, 0xbea4, 0x203e, 0x4320
+    dw 0x094c, 0xc855, 0x3c89, 0x560d, 0x5570
+    dw 0x094d, 0xc520, 0x9923, 0x5adf, 0x5adf
+    dw 0x094e, 0xf5c2, 0x6ad9, 0x37ed, 0xfc00
+    dw 0x094f, 0x2669, 0x0916, 0x30a1, 0x30a1
+    dw 0x0950, 0x8b68, 0x19b7, 0x4078, 0x4078
+    dw 0x0951, 0xd90c, 0x4772, 0xb170, 0xe4b3
+    dw 0x0952, 0x75b6, 0xb8b3, 0xb0c4, 0xf2b6
+    dw 0x0953, 0x04c6, 0x2e9a, 0xe977, 0xe977
+    dw 0x0954, 0x79cc, 0xe13a, 0x5d12, 0xfc00
+    dw 0x0955, 0x6685, 0x0fe3, 0xeb2a, 0xeb2a
+    dw 0x0956, 0xc4a9, 0x2f05, 0x8c9e, 0xb817
+    dw 0x0957, 0xa23f, 0x78d7, 0x5274, 0xdec0
+    dw 0x0958, 0xf37b, 0x5af2, 0x3c41, 0xfc00
+    dw 0x0959, 0x2d3d, 0x8429, 0xebf8, 0xebf8
+    dw 0x095a, 0x6075, 0x78cc, 0xe94d, 0x7c00
+    dw 0x095b, 0x6494, 0x0534, 0x5f43, 0x5f43
+    dw 0x095c, 0x13bd, 0x2979, 0x5a2b, 0x5a2b
+    dw 0x095d, 0xcb97, 0x59e8, 0x6e6a, 0x6b3a
+    dw 0x095e, 0xc33b, 0xe462, 0x3503, 0x6bec
+    dw 0x095f, 0x9963, 0x2135, 0x0980, 0x08a0
+    dw 0x0960, 0x3633, 0x9297, 0xe032, 0xe032
+    dw 0x0961, 0x707a, 0x5a0e, 0x72b1, 0x7c00
+    dw 0x0962, 0x72fd, 0x57d6, 0x3f1a, 0x7c00
+    dw 0x0963, 0x5bcf, 0xcbbc, 0x08e6, 0xeb8d
+    dw 0x0964, 0xf47b, 0x51f1, 0xf04e, 0xfc00
+    dw 0x0965, 0x3725, 0x34f7, 0x8800, 0x306e
+    dw 0x0966, 0x20ab, 0x3c57, 0x1d33, 0x23aa
+    dw 0x0967, 0xb508, 0x330f, 0xf7d7, 0xf7d7
+    dw 0x0968, 0xaaba, 0x312a, 0x9142, 0xa0ac
+    dw 0x0969, 0x7751, 0x129b, 0xe7a7, 0xe78f
+    dw 0x096a, 0x246b, 0x751f, 0xa2cf, 0x5da8
+    dw 0x096b, 0xdc61, 0xa1c5, 0x9ebb, 0x424e
+    dw 0x096c, 0xe458, 0x02cb, 0x29aa, 0x9a6e
+    dw 0x096d, 0xe88f, 0xe74b, 0x1590, 0x7c00
+    dw 0x096e, 0x775b, 0x37e3, 0x4cf4, 0x7343
+    dw 0x096f, 0x6e3b, 0x250f, 0x1604, 0x57e1
+    dw 0x0970, 0xb8f8, 0xf1d4, 0xd9dc, 0x6f0e
+    dw 0x0971, 0xaaf7, 0x8655, 0xe061, 0xe061
+    dw 0x0972, 0x989c, 0x7665, 0x2dea, 0xd35b
+    dw 0x0973, 0xd956, 0xf05a, 0x8053, 0x7c00
+    dw 0x0974, 0x1afc, 0x655a, 0xa7b9, 0x44a4
+    dw 0x0975, 0x0025, 0xd676, 0x1b42, 0x1aca
+    dw 0x0976, 0x12df, 0x6d79, 0x283f, 0x44bc
+    dw 0x0977, 0x4ede, 0xa5e7, 0x78b1, 0x78b1
+    dw 0x0978, 0x1b86, 0x4c60, 0x68c3, 0x68c3
+    dw 0x0979, 0xd61e, 0x235e, 0xd510, 0xd527
+    dw 0x097a, 0x253c, 0xa5ca, 0x679d, 0x679d
+    dw 0x097b, 0xa62b, 0xfbc4, 0x0906, 0x65fd
+    dw 0x097c, 0x6450, 0x8559, 0xdf59, 0xdf59
+    dw 0x097d, 0xb8ac, 0x4052, 0x6d51, 0x6d51
+    dw 0x097e, 0xfbed, 0x7a07, 0x3fcb, 0xfc00
+    dw 0x097f, 0x3fa1, 0x0498, 0x493c, 0x493c
+    dw 0x0980, 0x878d, 0x4744, 0xf55f, 0xf55f
+    dw 0x0981, 0xb8fa, 0xed6a, 0x6f1a, 0x713c
+    dw 0x0982, 0xbd7e, 0x8e1f, 0x3e4e, 0x3e4f
+    dw 0x0983, 0xe731, 0x9198, 0x0bf1, 0x3d08
+    dw 0x0984, 0x0d0a, 0x061c, 0xa493, 0xa493
+    dw 0x0985, 0x3848, 0xb1a9, 0x26f9, 0xac51
+    dw 0x0986, 0x5bf5, 0x0d1f, 0xbf29, 0xbed8
+    dw 0x0987, 0xb2a9, 0xf34e, 0xad7a, 0x6a15
+    dw 0x0988, 0x0fd9, 0x332e, 0xfaa4, 0xfaa4
+    dw 0x0989, 0x0d90, 0xd783, 0x0d5e, 0xa92e
+    dw 0x098a, 0x2633, 0x4ac3, 0xfa27, 0xfa27
+    dw 0x098b, 0x51db, 0xd786, 0xe5ed, 0xeefd
+    dw 0x098c, 0x437c, 0x087f, 0x1457, 0x1671
+    dw 0x098d, 0x0d5d, 0xbaae, 0xe88a, 0xe88a
+    dw 0x098e, 0x974c, 0x3fc5, 0x97a4, 0x9d74
+    dw 0x098f, 0x2810, 0xd1b8, 0x1b3a, 0xbdcb
+    dw 0x0990, 0x2b82, 0x4754, 0xdc62, 0xdc60
+    dw 0x0991, 0xcd24, 0x17ed, 0x2772, 0xa17b
+    dw 0x0992, 0x0f23, 0x8545, 0x86ba, 0x86bb
+    dw 0x0993, 0x632c, 0xe9e8, 0xa848, 0xfc00
+    dw 0x0994, 0x2564, 0x471b, 0x547e, 0x5480
+    dw 0x0995, 0xc5a4, 0x371e, 0xc75f, 0xc8f1
+    dw 0x0996, 0xa70d, 0xdba9, 0xf431, 0xf431
+    dw 0x0997, 0x60fa, 0x281c, 0xe9be, 0xe9b4
+    dw 0x0998, 0xbfdf, 0x35d9, 0x66f9, 0x66f8
+    dw 0x0999, 0x4040, 0x9985, 0xf788, 0xf788
+    dw 0x099a, 0xf5d9, 0xf63b, 0x80e1, 0x7c00
+    dw 0x099b, 0xc724, 0x2c58, 0xe743, 0xe743
+    dw 0x099c, 0x9f99, 0x289e, 0x05a9, 0x89f1
+    dw 0x099d, 0xba5c, 0xc321, 0x2b9e, 0x41c9
+    dw 0x099e, 0x0921, 0x5cf7, 0xc640, 0xc633
+    dw 0x099f, 0x7828, 0x48e8, 0x3f34, 0x7c00
+    dw 0x09a0, 0x76a6, 0xdba3, 0xa41b, 0xfc00
+    dw 0x09a1, 0xcafb, 0xd3a8, 0x8320, 0x62ae
+    dw 0x09a2, 0xc023, 0xbb93, 0xe2a8, 0xe2a4
+    dw 0x09a3, 0xf01f, 0xcfdb, 0x688b, 0x7c00
+    dw 0x09a4, 0x75b0, 0x7223, 0x1a4f, 0x7c00
+    dw 0x09a5, 0xd33b, 0x1d6e, 0xc712, 0xc761
+    dw 0x09a6, 0xc54b, 0xce2c, 0xdb70, 0xd6b5
+    dw 0x09a7, 0x466a, 0x8c00, 0xdbb6, 0xdbb6
+    dw 0x09a8, 0xccc5, 0x7696, 0x92ab, 0xfc00
+    dw 0x09a9, 0x485b, 0x70f2, 0xdf0d, 0x7c00
+    dw 0x09aa, 0xa3d9, 0xf85c, 0x3d73, 0x6049
+    dw 0x09ab, 0xd53d, 0xb62f, 0x2042, 0x500d
+    dw 0x09ac, 0xaf98, 0x666c, 0xa7b6, 0xda19
+    dw 0x09ad, 0xd364, 0x8c09, 0xa0f3, 0x1d03
+    dw 0x09ae, 0x4532, 0x4d21, 0xdfbc, 0xde12
+    dw 0x09af, 0xe098, 0x24ce, 0x7068, 0x7067
+    dw 0x09b0, 0xf520, 0x605f, 0x5293, 0xfc00
+    dw 0x09b1, 0x60ee, 0x45e5, 0x0135, 0x6b44
+    dw 0x09b2, 0xc211, 0x8843, 0x4e71, 0x4e71
+    dw 0x09b3, 0x9662, 0x22c7, 0x0389, 0x022f
+    dw 0x09b4, 0x91e6, 0x2a44, 0xbd6a, 0xbd6a
+    dw 0x09b5, 0x2da7, 0xe175, 0x1aca, 0xd3b6
+    dw 0x09b6, 0xfaf2, 0x0e50, 0x3b32, 0xcd41
+    dw 0x09b7, 0x4b97, 0x8ae3, 0x3b64, 0x3b5d
+    dw 0x09b8, 0x801b, 0x83ee, 0xa027, 0xa027
+    dw 0x09b9, 0x297a, 0xb25f, 0x5b6d, 0x5b6d
+    dw 0x09ba, 0x1c17, 0x59e2, 0xabee, 0x3985
+    dw 0x09bb, 0x7a55, 0xc8a6, 0x51b9, 0xfc00
+    dw 0x09bc, 0x86f2, 0x6001, 0xcd4b, 0xcd4e
+    dw 0x09bd, 0x69ab, 0x4ee5, 0x9689, 0x7c00
+    dw 0x09be, 0x793d, 0x1604, 0xc604, 0x5320
+    dw 0x09bf, 0x477e, 0xc00e, 0x4dd0, 0x4808
+    dw 0x09c0, 0x2e51, 0x6449, 0xd5e6, 0x4af2
+    dw 0x09c1, 0xf4be, 0x8658, 0x363b, 0x408a
+    dw 0x09c2, 0x6292, 0x4783, 0xedb7, 0x5f45
+    dw 0x09c3, 0x23f6, 0x5d0b, 0xb36c, 0x44c9
+    dw 0x09c4, 0x1d27, 0x04d6, 0x96ff, 0x96ff
+    dw 0x09c5, 0x10a7, 0x6190, 0x5e4b, 0x5e4d
+    dw 0x09c6, 0x6543, 0x7221, 0x9e7e, 0x7c00
+    dw 0x09c7, 0x115b, 0x3724, 0xbab4, 0xbab3
+    dw 0x09c8, 0xf524, 0x7bbf, 0xa371, 0xfc00
+    dw 0x09c9, 0xfac5, 0x7af5, 0x91e9, 0xfc00
+    dw 0x09ca, 0xd9da, 0x696c, 0xb713, 0xfc00
+    dw 0x09cb, 0x2d7e, 0x0894, 0x1a8f, 0x1a95
+    dw 0x09cc, 0x891c, 0xe0fa, 0xb58c, 0xb3ea
+    dw 0x09cd, 0xfaca, 0x2d39, 0x8eb1, 0xec6f
+    dw 0x09ce, 0xd596, 0x2a66, 0xd35c, 0xd3eb
+    dw 0x09cf, 0x9ca0, 0xc10c, 0xbed7, 0xbecb
+    dw 0x09d0, 0x1b77, 0x5821, 0x338a, 0x39bd
+    dw 0x09d1, 0x62a3, 0x3198, 0x0141, 0x58a4
+    dw 0x09d2, 0x88f2, 0xcdde, 0xeb19, 0xeb19
+    dw 0x09d3, 0x917c, 0x8b57, 0xbe87, 0xbe87
+    dw 0x09d4, 0x4587, 0x1126, 0x8359, 0x1b02
+    dw 0x09d5, 0x7701, 0x717c, 0xe141, 0x7c00
+    dw 0x09d6, 0x414f, 0x2af3, 0xd2b4, 0xd2af
+    dw 0x09d7, 0x5673, 0x6ad3, 0xaf2a, 0x7c00
+    dw 0x09d8, 0xc0ac, 0x0575, 0xc08d, 0xc08d
+    dw 0x09d9, 0x91e4, 0xb10d, 0x4f18, 0x4f18
+    dw 0x09da, 0xda15, 0xa708, 0xdfee, 0xdfd9
+    dw 0x09db, 0xc76c, 0x66fa, 0x7577, 0x7075
+    dw 0x09dc, 0x7515, 0xf0e6, 0xe474, 0xfc00
+    dw 0x09dd, 0x3336, 0x6bdc, 0x0ffc, 0x6316
+    dw 0x09de, 0x13a2, 0x1a03, 0xf959, 0xf959
+    dw 0x09df, 0xe369, 0x756c, 0xd913, 0xfc00
+
+    ; Results near the exponent boundaries
+    dw 0x09e0, 0xcd54, 0x02cf, 0x8397, 0x93ee
+    dw 0x09e1, 0x4947, 0x0143, 0x88a8, 0x0401
+    dw 0x09e2, 0xb9ee, 0x7b84, 0xf6b9, 0xfc00
+    dw 0x09e3, 0x1746, 0xb0c6, 0x86b5, 0x8e04
+    dw 0x09e4, 0xa11d, 0xa27b, 0x8178, 0x06d1
+    dw 0x09e5, 0xabf5, 0xf9bb, 0xfada, 0xfa7f
+    dw 0x09e6, 0xe47b, 0x527c, 0xf6c2, 0xfc00
+    dw 0x09e7, 0xb0be, 0xfb39, 0x78cd, 0x79df
+    dw 0x09e8, 0xe372, 0xd34c, 0xf0fe, 0x798b
+    dw 0x09e9, 0xebe3, 0xce06, 0x71d1, 0x7c00
+    dw 0x09ea, 0x9774, 0x2572, 0x814f, 0x83d8
+    dw 0x09eb, 0x3fa3, 0x751d, 0xf673, 0x72a0
+    dw 0x09ec, 0x6f26, 0x817d, 0x0025, 0xb152
+    dw 0x09ed, 0x4c8a, 0x0087, 0x0862, 0x0c96
+    dw 0x09ee, 0x1551, 0x7971, 0xf741, 0xf73d
+    dw 0x09ef, 0x6aa5, 0x52e4, 0x78c0, 0x7c00
+    dw 0x09f0, 0x3624, 0x78a9, 0xf48d, 0xebca
+    dw 0x09f1, 0x5b66, 0xe1b7, 0x7ba6, 0xfc00
+    dw 0x09f2, 0xec84, 0x805e, 0x8240, 0x26a0
+    dw 0x09f3, 0xd9c8, 0x8213, 0x8311, 0x1df3
+    dw 0x09f4, 0xee70, 0x0158, 0x8344, 0xb054
+    dw 0x09f5, 0xace3, 0xf986, 0x77bd, 0x784a
+    dw 0x09f6, 0xb9db, 0x78d4, 0xf966, 0xfc00
+    dw 0x09f7, 0x1984, 0xacef, 0x0093, 0x8a84
+    dw 0x09f8, 0xe5f4, 0x01ad, 0x00b2, 0xa8fd
+    dw 0x09f9, 0x74a7, 0x3c28, 0x74be, 0x78ca
+    dw 0x09fa, 0xa89a, 0x1e73, 0x83cd, 0x8ca9
+    dw 0x09fb, 0x2287, 0xf8ce, 0xf822, 0xf832
+    dw 0x09fc, 0x85cd, 0xfa4c, 0x739b, 0x739c
+    dw 0x09fd, 0x3a38, 0x7aad, 0xedad, 0x787b
+    dw 0x09fe, 0x8d90, 0xb4ce, 0x808c, 0x0622
+    dw 0x09ff, 0x08dc, 0xfbfe, 0xee6b, 0xee6d
+    dw 0x0a00, 0xcfd8, 0xebb3, 0xf557, 0x7c00
+    dw 0x0a01, 0xd4f3, 0x01ba, 0x0367, 0x982b
+    dw 0x0a02, 0x4649, 0x8153, 0x010f, 0x8744
+    dw 0x0a03, 0x46e5, 0x0220, 0x8a60, 0x01e7
+    dw 0x0a04, 0x48e6, 0xeebd, 0xf8d1, 0xfc00
+    dw 0x0a05, 0x3fd9, 0x06e1, 0x8122, 0x0a2e
+    dw 0x0a06, 0xf302, 0x03e2, 0x0118, 0xbacd
+    dw 0x0a07, 0x9fa4, 0xa725, 0x030f, 0x0c2d
+    dw 0x0a08, 0x492c, 0x812f, 0x8510, 0x8c54
+    dw 0x0a09, 0xccf1, 0x80d0, 0x812d, 0x0b71
+    dw 0x0a0a, 0x66c1, 0x8120, 0x01a7, 0xa797
+    dw 0x0a0b, 0xc71e, 0x6f2e, 0xf283, 0xfc00
+    dw 0x0a0c, 0xf580, 0x80a6, 0x8791, 0x3321
+    dw 0x0a0d, 0x90e7, 0x7b69, 0x7989, 0x7988
+    dw 0x0a0e, 0x9b2b, 0x7974, 0x6e3b, 0x6e14
+    dw 0x0a0f, 0x96c3, 0x7a98, 0x78bc, 0x78b9
+    dw 0x0a10, 0xdac3, 0xe158, 0x7aed, 0x7c00
+    dw 0x0a11, 0x8d99, 0xb293, 0x0366, 0x0800
+    dw 0x0a12, 0xe513, 0x83f3, 0x80f8, 0x2d02
+    dw 0x0a13, 0xf0a3, 0x402b, 0x7243, 0xeecd
+    dw 0x0a14, 0xf6ce, 0x0335, 0x047d, 0xbd75
+    dw 0x0a15, 0x460f, 0x8094, 0x0a22, 0x0862
+    dw 0x0a16, 0x3311, 0x1116, 0x86ce, 0x022e
+    dw 0x0a17, 0x2ade, 0xfb1f, 0x731a, 0x7193
+    dw 0x0a18, 0x909c, 0xf914, 0x749a, 0x749b
+    dw 0x0a19, 0xdae6, 0x5c9b, 0x7724, 0xf85f
+    dw 0x0a1a, 0xa91d, 0x1b78, 0x8674, 0x8c00
+    dw 0x0a1b, 0x9b47, 0xa312, 0x0340, 0x0677
+    dw 0x0a1c, 0xe1b9, 0xd6e7, 0x7aa1, 0x7c00
+    dw 0x0a1d, 0xf14d, 0x444b, 0x763c, 0xf525
+    dw 0x0a1e, 0x06f6, 0x78bb, 0xf5c1, 0xf5c1
+    dw 0x0a1f, 0x8950, 0x38be, 0x853e, 0x89c5
+    dw 0x0a20, 0xa8a8, 0x1616, 0x82ff, 0x868a
+    dw 0x0a21, 0x9eb0, 0xf955, 0xf51d, 0xf50b
+    dw 0x0a22, 0x4861, 0x8254, 0x017c, 0x8cba
+    dw 0x0a23, 0xbf7b, 0x8b66, 0x05c8, 0x102f
+    dw 0x0a24, 0xddae, 0x8134, 0x83f3, 0x1ec6
+    dw 0x0a25, 0xc8cd, 0x8014, 0x052d, 0x05ed
+    dw 0x0a26, 0xaa93, 0x9ea0, 0x8864, 0x0a7f
+    dw 0x0a27, 0xf3e4, 0x81e6, 0x822b, 0x377d
+    dw 0x0a28, 0x5b1d, 0x5868, 0x7501, 0x7a6b
+    dw 0x0a29, 0xaef3, 0x79b7, 0xf677, 0xf7b5
+    dw 0x0a2a, 0xdbe3, 0x0027, 0x81bb, 0x9106
+    dw 0x0a2b, 0x1dbc, 0x7b8b, 0x75ce, 0x75e4
+    dw 0x0a2c, 0xb64a, 0xf814, 0x71e5, 0x7627
+    dw 0x0a2d, 0xc401, 0x0239, 0x862c, 0x8b89
+    dw 0x0a2e, 0x5ae4, 0x8123, 0x0104, 0x9bcd
+    dw 0x0a2f, 0x2df4, 0x170f, 0x8201, 0x0840
+    dw 0x0a30, 0x8933, 0xb898, 0x8291, 0x0368
+    dw 0x0a31, 0x675c, 0x03e1, 0x8109, 0x2f23
+    dw 0x0a32, 0x521e, 0xe1b2, 0x75cf, 0xf1cd
+    dw 0x0a33, 0x6192, 0xd5ff, 0xf8f4, 0xfc00
+    dw 0x0a34, 0x0a4d, 0x35a1, 0x0264, 0x06d3
+    dw 0x0a35, 0xdd96, 0x5ad5, 0xf76e, 0xfc00
+    dw 0x0a36, 0x4d96, 0x0137, 0x026b, 0x0f64
+    dw 0x0a37, 0xdd8e, 0xd4b3, 0x7552, 0x79ec
+    dw 0x0a38, 0xbf1e, 0x7b8c, 0xf4b5, 0xfc00
+    dw 0x0a39, 0xea56, 0x4a01, 0x7568, 0xf41b
+    dw 0x0a3a, 0xab41, 0x9e5e, 0x05be, 0x0f35
+    dw 0x0a3b, 0x6ffa, 0xc88d, 0x70f1, 0xfbd7
+    dw 0x0a3c, 0x96ed, 0xf9e9, 0x7472, 0x7477
+    dw 0x0a3d, 0xb27d, 0xfbed, 0x6f19, 0x74fd
+    dw 0x0a3e, 0xdaee, 0x003b, 0x849a, 0x92f7
+    dw 0x0a3f, 0x68b0, 0xc824, 0x7041, 0xf173
+    dw 0x0a40, 0x602d, 0x8291, 0x06c1, 0xa555
+    dw 0x0a41, 0x7831, 0x0371, 0x85e3, 0x3f36
+    dw 0x0a42, 0xa87b, 0x9225, 0x0339, 0x04f1
+    dw 0x0a43, 0xeadb, 0x4df3, 0x732f, 0xfc00
+    dw 0x0a44, 0x53ea, 0x015c, 0x0258, 0x1587
+    dw 0x0a45, 0x72f0, 0x811b, 0x0599, 0xb3ab
+    dw 0x0a46, 0xa5f9, 0x94d2, 0x80fb, 0x00d2
+    dw 0x0a47, 0x65ba, 0x00da, 0x8297, 0x24de
+    dw 0x0a48, 0xa43b, 0xf945, 0xfab8, 0xfaa2
+    dw 0x0a49, 0x49c4, 0x83b7, 0x8163, 0x9187
+    dw 0x0a4a, 0x8bea, 0x3bc7, 0x03a5, 0x89df
+    dw 0x0a4b, 0x2e41, 0x0c65, 0x03e9, 0x05a1
+    dw 0x0a4c, 0xe55f, 0x82db, 0x0105, 0x2bac
+    dw 0x0a4d, 0x50b6, 0xe9d1, 0x76cb, 0xfc00
+    dw 0x0a4e, 0xe6d1, 0x56f1, 0xf4e1, 0xfc00
+    dw 0x0a4f, 0x1221, 0xf916, 0x7609, 0x7607
+    dw 0x0a50, 0x7a47, 0x033c, 0x091d, 0x4113
+    dw 0x0a51, 0xd7db, 0x6584, 0x7952, 0xfc00
+    dw 0x0a52, 0xe67b, 0x4ed2, 0xef2e, 0xfa6c
+    dw 0x0a53, 0xc1f3, 0x83d5, 0x80d4, 0x0949
+    dw 0x0a54, 0xbd79, 0x78a3, 0x7ba2, 0x7128
+    dw 0x0a55, 0xdabf, 0x038e, 0x0127, 0xa1fc
+    dw 0x0a56, 0xdb2a, 0x02f6, 0x8284, 0xa153
+    dw 0x0a57, 0xa558, 0x96da, 0x03eb, 0x0635
+    dw 0x0a58, 0xafd0, 0x9b64, 0x0780, 0x108c
+    dw 0x0a59, 0xe2f2, 0x03c9, 0x836c, 0xaa94
+    dw 0x0a5a, 0xc763, 0x73ba, 0xf792, 0xfc00
+    dw 0x0a5b, 0xf493, 0x00ba, 0x0094, 0xb2a6
+    dw 0x0a5c, 0x37d0, 0x0984, 0x037c, 0x086f
+    dw 0x0a5d, 0x9d5e, 0x266e, 0x013f, 0x8762
+    dw 0x0a5e, 0x156a, 0x7900, 0x7613, 0x7616
+    dw 0x0a5f, 0x1d52, 0x7b3c, 0xf580, 0xf56d
+    dw 0x0a60, 0xbb8d, 0x7a0b, 0xf5f2, 0xfc00
+    dw 0x0a61, 0x199f, 0x7a8e, 0xf531, 0xf528
+    dw 0x0a62, 0x1bc0, 0xf8c7, 0xf4b1, 0xf4ba
+    dw 0x0a63, 0x5372, 0x8175, 0x048b, 0x9524
+    dw 0x0a64, 0x2f71, 0x7a2a, 0x78d6, 0x798d
+    dw 0x0a65, 0xc8a2, 0x00d9, 0x03ae, 0x842d
+    dw 0x0a66, 0x4a01, 0x8233, 0x0070, 0x8e7e
+    dw 0x0a67, 0x4415, 0x720b, 0x71a0, 0x7b93
+    dw 0x0a68, 0xa993, 0x783c, 0x7554, 0x74f6
+    dw 0x0a69, 0x91ae, 0xb283, 0x83b7, 0x0588
+    dw 0x0a6a, 0x131e, 0xfa52, 0xf4fb, 0xf4fe
+    dw 0x0a6b, 0x70ee, 0xc593, 0xfb2b, 0xfc00
+    dw 0x0a6c, 0x77d6, 0x0352, 0x827c, 0x3e81
+    dw 0x0a6d, 0xd022, 0xe364, 0x76f3, 0x7b4b
+    dw 0x0a6e, 0xa184, 0x7862, 0xf5f9, 0xf611
+    dw 0x0a6f, 0xb13c, 0x78a4, 0x7696, 0x7511
+    dw 0x0a70, 0x2531, 0x192e, 0x01bd, 0x0519
+    dw 0x0a71, 0x4a98, 0x015b, 0x813c, 0x0c29
+    dw 0x0a72, 0x385a, 0x789c, 0x73e8, 0x787c
+    dw 0x0a73, 0xf3c6, 0x80e5, 0x8399, 0x32f4
+    dw 0x0a74, 0xce9f, 0x816f, 0x0243, 0x1107
+    dw 0x0a75, 0x5b5c, 0x80a4, 0x82f8, 0x98cf
+    dw 0x0a76, 0xaa30, 0xfbd0, 0x73a7, 0x7495
+    dw 0x0a77, 0xa7ab, 0x78ff, 0xf252, 0xf2eb
+    dw 0x0a78, 0xd87c, 0x02b0, 0x025b, 0x9dfd
+    dw 0x0a79, 0x1705, 0xab95, 0x0373, 0x8334
+    dw 0x0a7a, 0xc954, 0x0051, 0x8715, 0x893a
+    dw 0x0a7b, 0x45d1, 0x03d8, 0x815d, 0x0d40
+    dw 0x0a7c, 0xb744, 0x0a24, 0x80b7, 0x864b
+    dw 0x0a7d, 0x4ca5, 0x680d, 0x791a, 0x7c00
+    dw 0x0a7e, 0x918f, 0xfb0f, 0xf2f7, 0xf2f2
+    dw 0x0a7f, 0x383e, 0x0a3d, 0x02be, 0x08ae
+    dw 0x0a80, 0xb727, 0x8e13, 0x84ce, 0x060e
+    dw 0x0a81, 0xc85b, 0x0045, 0x81a9, 0x8402
+    dw 0x0a82, 0x676d, 0x8370, 0x810c, 0xae62
+    dw 0x0a83, 0x0670, 0x7ab5, 0xf115, 0xf114
+    dw 0x0a84, 0x61da, 0x57c3, 0x7402, 0x7c00
+    dw 0x0a85, 0xd1ed, 0x632a, 0x6f61, 0xf862
+    dw 0x0a86, 0x2a22, 0x9f80, 0x88ff, 0x9020
+    dw 0x0a87, 0x23d4, 0x782b, 0x7be4, 0x7bf4
+    dw 0x0a88, 0xcdda, 0x02da, 0x8308, 0x945c
+    dw 0x0a89, 0xf354, 0x8015, 0x0199, 0x24d1
+    dw 0x0a8a, 0x044f, 0x78f2, 0xf016, 0xf016
+    dw 0x0a8b, 0x9fdc, 0xf97a, 0x783b, 0x7846
+    dw 0x0a8c, 0x8894, 0xf8b9, 0x7706, 0x7706
+    dw 0x0a8d, 0x4c27, 0xeada, 0xf242, 0xfc00
+    dw 0x0a8e, 0x3d6d, 0x8713, 0x850c, 0x8b52
+    dw 0x0a8f, 0x0785, 0x3abb, 0x0292, 0x0873
+    dw 0x0a90, 0x23c9, 0x987f, 0x00ac, 0x8184
+    dw 0x0a91, 0x6669, 0x4fd8, 0xeefd, 0x7969
+    dw 0x0a92, 0xd663, 0xe655, 0x75bc, 0x7c00
+    dw 0x0a93, 0xa1ff, 0xf883, 0x7256, 0x728c
+    dw 0x0a94, 0x2fed, 0x14af, 0x8298, 0x06b0
+    dw 0x0a95, 0xaac2, 0x7a01, 0xfa06, 0xfa57
+    dw 0x0a96, 0x8dd4, 0xb2a2, 0x8040, 0x0495
+    dw 0x0a97, 0x607b, 0xd5af, 0x76d6, 0xf5e6
+    dw 0x0a98, 0x109c, 0xaaa9, 0x03a9, 0x01be
+    dw 0x0a99, 0xb6e3, 0x0d2b, 0x04d6, 0x8410
+    dw 0x0a9a, 0xe6a2, 0xd0aa, 0xf8f6, 0x758c
+    dw 0x0a9b, 0xc2d8, 0x02f9, 0x855a, 0x8bc3
+    dw 0x0a9c, 0x10a6, 0xf964, 0xed8d, 0xed93
+    dw 0x0a9d, 0x6b85, 0xcb85, 0xef91, 0xfc00
+    dw 0x0a9e, 0x733e, 0x81a5, 0x8315, 0xb5f5
+    dw 0x0a9f, 0x971b, 0xfa3a, 0x6eac, 0x6ec2
+    dw 0x0aa0, 0xc923, 0x6f08, 0xf334, 0xfc00
+    dw 0x0aa1, 0x0cda, 0x3a77, 0x0897, 0x0e37
+    dw 0x0aa2, 0x3dc7, 0x86ad, 0x8181, 0x8993
+    dw 0x0aa3, 0xd528, 0xe20e, 0x738f, 0x7c00
+    dw 0x0aa4, 0xc911, 0x6d4a, 0xf8e3, 0xfc00
+    dw 0x0aa5, 0x2cd3, 0x8c9f, 0x82bf, 0x8424
+    dw 0x0aa6, 0x6998, 0x49cc, 0xec5d, 0x7704
+    dw 0x0aa7, 0xb1eb, 0x7971, 0xef1d, 0xf395
+    dw 0x0aa8, 0x60ec, 0x81f0, 0x00a5, 0xa4c4
+    dw 0x0aa9, 0x609d, 0x80b9, 0x81eb, 0x9eb3
+    dw 0x0aaa, 0x38f9, 0xfac9, 0xeebb, 0xf90f
+    dw 0x0aab, 0xe361, 0x0279, 0x804f, 0xa890
+    dw 0x0aac, 0x40e4, 0x7809, 0x7b8b, 0x7c00
+    dw 0x0aad, 0x763f, 0x8347, 0x0b51, 0xbd1e
+    dw 0x0aae, 0x1467, 0x78d3, 0xf3b2, 0xf3ad
+    dw 0x0aaf, 0x0fed, 0xb283, 0x80e6, 0x875a
+    dw 0x0ab0, 0x2d08, 0x7b35, 0xf2f4, 0xf0b0
+    dw 0x0ab1, 0xeedf, 0xce6d, 0xf867, 0x7c00
+    dw 0x0ab2, 0x5c38, 0xda56, 0xf885, 0xfc00
+    dw 0x0ab3, 0x709a, 0x4800, 0x7925, 0x7c00
+    dw 0x0ab4, 0x2377, 0xa340, 0x84b4, 0x8c8f
+    dw 0x0ab5, 0x1fc2, 0xf9bd, 0xf647, 0xf65d
+    dw 0x0ab6, 0xa011, 0x7bdb, 0x705b, 0x701b
+    dw 0x0ab7, 0x84c4, 0xc01f, 0x830e, 0x06c4
+    dw 0x0ab8, 0xbf38, 0x07df, 0x8555, 0x8ce2
+    dw 0x0ab9, 0xcc44, 0x83a4, 0x01be, 0x13fc
+    dw 0x0aba, 0xc39b, 0x00e5, 0x8014, 0x837b
+    dw 0x0abb, 0x781b, 0x3d9e, 0x7889, 0x7c00
+    dw 0x0abc, 0x3a34, 0x8668, 0x0113, 0x83e5
+    dw 0x0abd, 0x07fa, 0x7b3e, 0x6c99, 0x6c9b
+    dw 0x0abe, 0xea6e, 0xc9c9, 0x6d7e, 0x7956
+    dw 0x0abf, 0xd84f, 0x80eb, 0x0097, 0x17f2
+    dw 0x0ac0, 0x8512, 0xf8c4, 0x7a44, 0x7a44
+    dw 0x0ac1, 0xce1b, 0x8077, 0x002b, 0x09c3
+    dw 0x0ac2, 0xadbd, 0x15ac, 0x815d, 0x88c0
+    dw 0x0ac3, 0xa341, 0xfae7, 0x75d0, 0x7602
+    dw 0x0ac4, 0xee3a, 0x02bc, 0x00b8, 0xb442
+    dw 0x0ac5, 0xe658, 0x50d7, 0x7176, 0xfa4f
+    dw 0x0ac6, 0x480c, 0x03c2, 0x00b9, 0x0fc9
+    dw 0x0ac7, 0x366c, 0x79c2, 0x6f64, 0x7678
+    dw 0x0ac8, 0xa85d, 0x96f3, 0x8199, 0x0231
+    dw 0x0ac9, 0xa032, 0x7a22, 0x6fa1, 0x6f3a
+    dw 0x0aca, 0x6a84, 0xcbdb, 0x74ef, 0xf7dd
+    dw 0x0acb, 0xb0e0, 0x10ac, 0x02b4, 0x82fe
+    dw 0x0acc, 0xb741, 0x1025, 0x8004, 0x8b86
+    dw 0x0acd, 0x9579, 0xf82a, 0xf36a, 0xf364
+    dw 0x0ace, 0xa9d7, 0xf87c, 0x731c, 0x73ee
+    dw 0x0acf, 0xed6a, 0xcc83, 0xf8a3, 0x7b94
+    dw 0x0ad0, 0x3abf, 0x88f9, 0x8110, 0x88b9
+    dw 0x0ad1, 0x77dd, 0x8124, 0x0390, 0xb87c
+    dw 0x0ad2, 0xc25c, 0x75fd, 0xf160, 0xfc00
+    dw 0x0ad3, 0xda50, 0x5838, 0x750d, 0xee6e
+    dw 0x0ad4, 0x9527, 0xb36d, 0x82e6, 0x0c0f
+    dw 0x0ad5, 0x601c, 0x81c9, 0x000e, 0xa356
+    dw 0x0ad6, 0x793e, 0x03c9, 0x82e6, 0x40f6
+    dw 0x0ad7, 0x2e47, 0x94fc, 0x804f, 0x8811
+    dw 0x0ad8, 0x066f, 0xc0da, 0x8079, 0x8c05
+    dw 0x0ad9, 0xcecf, 0x026b, 0x0198, 0x9404
+    dw 0x0ada, 0x287b, 0x1631, 0x81e9, 0x018f
+    dw 0x0adb, 0xe734, 0x00fd, 0x814b, 0xa720
+    dw 0x0adc, 0x3976, 0x8fbb, 0x845b, 0x8e5e
+    dw 0x0add, 0x3529, 0x7af2, 0xf195, 0x6ec1
+    dw 0x0ade, 0xd27b, 0xe51c, 0x77fb, 0x7c00
+    dw 0x0adf, 0x17dd, 0xf912, 0xf05f, 0xf069
+    dw 0x0ae0, 0x7a27, 0x0032, 0x80ed, 0x30ce
+    dw 0x0ae1, 0xd087, 0x0023, 0x00aa, 0x844a
+    dw 0x0ae2, 0xc344, 0x791a, 0x7a13, 0xfc00
+    dw 0x0ae3, 0xa1cc, 0xf82a, 0xf571, 0xf559
+    dw 0x0ae4, 0xae26, 0x1b3b, 0x085f, 0x8abe
+    dw 0x0ae5, 0x2e48, 0x1510, 0x03a5, 0x09cc
+    dw 0x0ae6, 0x0990, 0x782b, 0xee14, 0xee13
+    dw 0x0ae7, 0xc45b, 0xf658, 0xf9fd, 0x7bd4
+    dw 0x0ae8, 0xe4fe, 0x4cac, 0xee1f, 0xf75c
+    dw 0x0ae9, 0x68d5, 0x4ad6, 0x7058, 0x7937
+    dw 0x0aea, 0x4503, 0x8347, 0x8935, 0x8eb6
+    dw 0x0aeb, 0xd8de, 0x61c2, 0xfaac, 0xfc00
+    dw 0x0aec, 0x3336, 0x0bc0, 0x038e, 0x070c
+    dw 0x0aed, 0x93eb, 0xfa4d, 0x72fe, 0x7304
+    dw 0x0aee, 0xa45f, 0x1b56, 0x0251, 0x81b1
+    dw 0x0aef, 0xef80, 0x8124, 0x0247, 0x3047
+    dw 0x0af0, 0x11e6, 0xb1b8, 0x026f, 0x8600
+    dw 0x0af1, 0x9c7c, 0xf9e5, 0x7a64, 0x7a6b
+    dw 0x0af2, 0x1748, 0xb115, 0x840f, 0x8da4
+    dw 0x0af3, 0x7828, 0xbd2d, 0xf6ee, 0xfc00
+    dw 0x0af4, 0x2cdf, 0x8fbb, 0x0335, 0x00db
+    dw 0x0af5, 0xc743, 0x806c, 0x001a, 0x032a
+    dw 0x0af6, 0x5d1a, 0x5629, 0x758c, 0x7ab4
+    dw 0x0af7, 0xf49a, 0xc40d, 0x7b47, 0x7c00
+    dw 0x0af8, 0x694c, 0x830d, 0x87c0, 0xb00b
+    dw 0x0af9, 0xb7db, 0x8a79, 0x0120, 0x077b
+    dw 0x0afa, 0x306b, 0x9557, 0x8203, 0x8ae7
+    dw 0x0afb, 0x3269, 0xf808, 0xfb4a, 0xfc00
+    dw 0x0afc, 0xc6ff, 0x0196, 0x8377, 0x8b48
+    dw 0x0afd, 0x3eba, 0x8142, 0x03aa, 0x018d
+    dw 0x0afe, 0xe467, 0xd703, 0xf859, 0x7c00
+    dw 0x0aff, 0x33d3, 0x90b8, 0x801f, 0x88ad
+    dw 0x0b00, 0xba1e, 0x8d39, 0x8beb, 0x0023
+    dw 0x0b01, 0xad90, 0x9baf, 0x8931, 0x097e
+    dw 0x0b02, 0x2cb3, 0xf82d, 0x751f, 0x7482
+    dw 0x0b03, 0x8a96, 0xb85d, 0x84f4, 0x023b
+    dw 0x0b04, 0x2078, 0x786b, 0x704b, 0x7072
+    dw 0x0b05, 0x7b5d, 0xba9f, 0x6dc8, 0xf95f
+    dw 0x0b06, 0x9a3c, 0x2a8f, 0x06ae, 0x838b
+    dw 0x0b07, 0x99be, 0xfb2d, 0x77c8, 0x77d2
+    dw 0x0b08, 0x1690, 0xa5f5, 0x824e, 0x84bf
+    dw 0x0b09, 0x3e17, 0xf9bc, 0x7a51, 0xf4d4
+    dw 0x0b0a, 0x2c42, 0x8e8e, 0x03bf, 0x0200
+    dw 0x0b0b, 0x4a27, 0x82ea, 0x0beb, 0x8d01
+    dw 0x0b0c, 0x709d, 0x0046, 0x027d, 0x290d
+    dw 0x0b0d, 0x481b, 0x6d8d, 0xf8de, 0x6ea4
+    dw 0x0b0e, 0x79f1, 0x3a31, 0xf415, 0x751d
+    dw 0x0b0f, 0x1366, 0x2838, 0x8377, 0x8184
+    dw 0x0b10, 0xdadc, 0x809e, 0x8258, 0x1829
+    dw 0x0b11, 0x4641, 0x6e86, 0x77d7, 0x7c00
+    dw 0x0b12, 0x615c, 0x018f, 0x0633, 0x2433
+    dw 0x0b13, 0x9978, 0xa5ff, 0x03f9, 0x0809
+    dw 0x0b14, 0x9c7f, 0xf898, 0xf4e4, 0xf4da
+    dw 0x0b15, 0x0dd8, 0xfad0, 0x7716, 0x7715
+    dw 0x0b16, 0xd2d7, 0x8225, 0x831c, 0x1724
+    dw 0x0b17, 0xd4ce, 0xe1ef, 0x7217, 0x7c00
+    dw 0x0b18, 0x51bf, 0xe24e, 0xf581, 0xfb48
+    dw 0x0b19, 0x46ef, 0x8174, 0x0ba0, 0x052d
+    dw 0x0b1a, 0x415e, 0x02bf, 0x0056, 0x07b5
+    dw 0x0b1b, 0x1b39, 0x2807, 0x8059, 0x06ed
+    dw 0x0b1c, 0x9614, 0x7a01, 0xf7ca, 0xf7cf
+    dw 0x0b1d, 0xb64e, 0xfaba, 0x7485, 0x78e9
+    dw 0x0b1e, 0x59aa, 0x03b6, 0x03cd, 0x2149
+    dw 0x0b1f, 0x3ab1, 0x8f4b, 0x0a6e, 0x89c5
+    dw 0x0b20, 0x5be3, 0x82ff, 0x0399, 0xa1e1
+    dw 0x0b21, 0xeb86, 0xccc7, 0xfb53, 0x72a5
+    dw 0x0b22, 0x8d65, 0xb0da, 0x804a, 0x02fc
+    dw 0x0b23, 0x9197, 0xb60a, 0x06c1, 0x0de8
+    dw 0x0b24, 0x0f09, 0x7b88, 0x791d, 0x791e
+    dw 0x0b25, 0xed50, 0x4e23, 0x7682, 0xfc00
+    dw 0x0b26, 0x4bb8, 0x010d, 0x068f, 0x0db2
+    dw 0x0b27, 0x15d0, 0x2576, 0x0061, 0x025d
+    dw 0x0b28, 0x3b1d, 0x83b7, 0x03a1, 0x0053
+    dw 0x0b29, 0x37d6, 0x79ee, 0x7977, 0x7c00
+    dw 0x0b2a, 0x412e, 0x81c6, 0x067d, 0x01e5
+
+    ; Mostly subnormal values
+    dw 0x0b2b, 0xe74a, 0x027e, 0x8214, 0xac8b
+    dw 0x0b2c, 0x033a, 0x037d, 0x524c, 0x524c
+    dw 0x0b2d, 0x0062, 0x054b, 0x86a5, 0x86a5
+    dw 0x0b2e, 0x03b1, 0x83d0, 0x8157, 0x8157
+    dw 0x0b2f, 0x0199, 0x020a, 0x026c, 0x026c
+    dw 0x0b30, 0x0326, 0x69eb, 0x80ab, 0x30a8
+    dw 0x0b31, 0x80f7, 0x82fb, 0xd307, 0xd307
+    dw 0x0b32, 0x003c, 0x8266, 0x82f9, 0x82f9
+    dw 0x0b33, 0x80c0, 0x0225, 0x806f, 0x806f
+    dw 0x0b34, 0x01d3, 0x0413, 0x80ed, 0x80ed
+    dw 0x0b35, 0x83da, 0x80f7, 0x0100, 0x0100
+    dw 0x0b36, 0x01fe, 0x00ad, 0x7995, 0x7995
+    dw 0x0b37, 0x8057, 0x0044, 0x8123, 0x8123
+    dw 0x0b38, 0xafb0, 0x1103, 0x83ca, 0x884d
+    dw 0x0b39, 0x0174, 0x0072, 0x816c, 0x816c
+    dw 0x0b3a, 0x0123, 0x824f, 0x0162, 0x0162
+    dw 0x0b3b, 0x0398, 0x01cf, 0x25c3, 0x25c3
+    dw 0x0b3c, 0x02ef, 0x0024, 0x0239, 0x0239
+    dw 0x0b3d, 0x8087, 0x83f7, 0x806e, 0x806e
+    dw 0x0b3e, 0x0059, 0x81ba, 0x008d, 0x008d
+    dw 0x0b3f, 0x8264, 0x8051, 0x8219, 0x8219
+    dw 0x0b40, 0x0269, 0xefba, 0x8306, 0xb4a8
+    dw 0x0b41, 0xdce7, 0xdf5a, 0x02f8, 0x7c00
+    dw 0x0b42, 0x8246, 0x82e3, 0x02ca, 0x02ca
+    dw 0x0b43, 0x00c4, 0x01b8, 0x8343, 0x8343
+    dw 0x0b44, 0x8002, 0x8335, 0x0121, 0x0121
+    dw 0x0b45, 0x810b, 0x80e4, 0x01b2, 0x01b2
+    dw 0x0b46, 0x78d4, 0x0389, 0x0096, 0x4044
+    dw 0x0b47, 0x80d1, 0x837a, 0x8266, 0x8266
+    dw 0x0b48, 0x803d, 0x0187, 0x82a5, 0x82a5
+    dw 0x0b49, 0x007a, 0xaa61, 0x42a7, 0x42a7
+    dw 0x0b4a, 0x4baf, 0x000f, 0x810e, 0x8027
+    dw 0x0b4b, 0x0042, 0x81c8, 0x81e5, 0x81e5
+    dw 0x0b4c, 0x0201, 0x55a4, 0x839f, 0x198a
+    dw 0x0b4d, 0x825a, 0x00f2, 0x42e4, 0x42e4
+    dw 0x0b4e, 0x56be, 0x00a8, 0x0382, 0x14a5
+    dw 0x0b4f, 0x81f1, 0x571f, 0x83d7, 0x9b08
+    dw 0x0b50, 0x2c25, 0x6fe5, 0x00ce, 0x6017
+    dw 0x0b51, 0x1615, 0x8276, 0x00c2, 0x00c1
+    dw 0x0b52, 0x01b8, 0x3186, 0x819c, 0x8150
+    dw 0x0b53, 0x03d2, 0x8340, 0x81e2, 0x81e2
+    dw 0x0b54, 0x01d2, 0xed4d, 0x03cf, 0xb0d3
+    dw 0x0b55, 0x00ce, 0x00ab, 0x03cd, 0x03cd
+    dw 0x0b56, 0x804a, 0x0012, 0x82cd, 0x82cd
+    dw 0x0b57, 0xa7df, 0x035a, 0x80e8, 0x8102
+    dw 0x0b58, 0x03b5, 0x81af, 0x0210, 0x0210
+    dw 0x0b59, 0x814d, 0xc6fe, 0x037e, 0x0a4b
+    dw 0x0b5a, 0x024a, 0x0157, 0x0152, 0x0152
+    dw 0x0b5b, 0x00fa, 0x00c3, 0x03f2, 0x03f2
+    dw 0x0b5c, 0x827d, 0x02c1, 0x82b8, 0x82b8
+    dw 0x0b5d, 0x03cb, 0x82a3, 0x8311, 0x8311
+    dw 0x0b5e, 0xf0d2, 0x7269, 0xe5a5, 0xfc00
+    dw 0x0b5f, 0x8045, 0x83a0, 0x815d, 0x815d
+    dw 0x0b60, 0x0325, 0x002c, 0x221d, 0x221d
+    dw 0x0b61, 0x4114, 0x01f7, 0x81ef, 0x030e
+    dw 0x0b62, 0x83d6, 0x8193, 0x5d08, 0x5d08
+    dw 0x0b63, 0x83db, 0x80f5, 0x8317, 0x8317
+    dw 0x0b64, 0xbf18, 0x0222, 0x8031, 0x83f9
+    dw 0x0b65, 0x0326, 0x82d7, 0x00b5, 0x00b5
+    dw 0x0b66, 0x0317, 0x8080, 0x824d, 0x824d
+    dw 0x0b67, 0x83cc, 0x0108, 0x80a1, 0x80a1
+    dw 0x0b68, 0x838a, 0x8170, 0x0020, 0x0020
+    dw 0x0b69, 0x837b, 0x01e0, 0xc67e, 0xc67e
+    dw 0x0b6a, 0x80e4, 0xd09c, 0x00d3, 0x1035
+    dw 0x0b6b, 0x834a, 0x82cd, 0x820b, 0x820b
+    dw 0x0b6c, 0x83e5, 0x001d, 0xc2fa, 0xc2fa
+    dw 0x0b6d, 0x0357, 0x821d, 0x0784, 0x0784
+    dw 0x0b6e, 0x0311, 0x80cd, 0x8282, 0x8282
+    dw 0x0b6f, 0x8394, 0x83d1, 0x0168, 0x0168
+    dw 0x0b70, 0x00be, 0x75d5, 0x8093, 0x3454
+    dw 0x0b71, 0x01e4, 0x01bc, 0x83ab, 0x83ab
+    dw 0x0b72, 0x8278, 0x834d, 0x03a7, 0x03a7
+    dw 0x0b73, 0x82dc, 0x82fb, 0x02ed, 0x02ed
+    dw 0x0b74, 0x00ab, 0x814c, 0x93b1, 0x93b1
+    dw 0x0b75, 0x80ae, 0x0330, 0x81f2, 0x81f2
+    dw 0x0b76, 0x006b, 0x037a, 0xa1e2, 0xa1e2
+    dw 0x0b77, 0x011f, 0x6a6a, 0x01fa, 0x2b32
+    dw 0x0b78, 0x010f, 0x82fc, 0x1435, 0x1435
+    dw 0x0b79, 0x82a0, 0x0028, 0x03fc, 0x03fc
+    dw 0x0b7a, 0x00db, 0x0069, 0xb66a, 0xb66a
+    dw 0x0b7b, 0x4b40, 0x0182, 0x0350, 0x0e4b
+    dw 0x0b7c, 0x84fb, 0x80db, 0x0183, 0x0183
+    dw 0x0b7d, 0x8cad, 0x80dd, 0x8317, 0x8317
+    dw 0x0b7e, 0x800c, 0x8295, 0x009b, 0x009b
+    dw 0x0b7f, 0x80d1, 0x0288, 0x83c9, 0x83c9
+    dw 0x0b80, 0x023d, 0x832b, 0x0093, 0x0093
+    dw 0x0b81, 0x00ea, 0x0058, 0x0012, 0x0012
+    dw 0x0b82, 0x033a, 0x24ab, 0x82c8, 0x82b9
+    dw 0x0b83, 0x802e, 0xe28c, 0x83ce, 0x1896
+    dw 0x0b84, 0x81f9, 0x81de, 0x80b5, 0x80b5
+    dw 0x0b85, 0x02c6, 0x0022, 0x8333, 0x8333
+    dw 0x0b86, 0x8081, 0xb542, 0x0131, 0x015b
+    dw 0x0b87, 0x813c, 0x824a, 0x0283, 0x0283
+    dw 0x0b88, 0x82c8, 0x0258, 0x80ed, 0x80ed
+    dw 0x0b89, 0x282b, 0x318c, 0x8055, 0x1dc6
+    dw 0x0b8a, 0x011a, 0x0214, 0x8135, 0x8135
+    dw 0x0b8b, 0xf4d6, 0x81e3, 0x82c2, 0x3890
+    dw 0x0b8c, 0x02dd, 0x80cc, 0x0052, 0x0052
+    dw 0x0b8d, 0x834f, 0x8039, 0x030c, 0x030c
+    dw 0x0b8e, 0xcaea, 0x62a2, 0x0b10, 0xf1bc
+    dw 0x0b8f, 0x00d5, 0xd783, 0x790b, 0x790b
+    dw 0x0b90, 0x808b, 0x8310, 0x8381, 0x8381
+    dw 0x0b91, 0x2d7c, 0x00d5, 0x03f7, 0x0409
+    dw 0x0b92, 0x4c13, 0x02ae, 0x0107, 0x1196
+    dw 0x0b93, 0x82f7, 0x4734, 0x005b, 0x8d40
+    dw 0x0b94, 0x0011, 0x333b, 0x00f1, 0x00f5
+    dw 0x0b95, 0x9efa, 0x025d, 0x4dc7, 0x4dc7
+    dw 0x0b96, 0x804f, 0x33f9, 0x02a3, 0x028f
+    dw 0x0b97, 0x80a7, 0xf2be, 0x032e, 0x3066
+    dw 0x0b98, 0x02bb, 0x827d, 0x8212, 0x8212
+    dw 0x0b99, 0xcc5d, 0x0050, 0x0297, 0x82dd
+    dw 0x0b9a, 0x0039, 0x811b, 0x038e, 0x038e
+    dw 0x0b9b, 0x028b, 0x0225, 0xb7be, 0xb7be
+    dw 0x0b9c, 0x02a7, 0x012b, 0xd850, 0xd850
+    dw 0x0b9d, 0x8065, 0xb1df, 0x826c, 0x8259
+    dw 0x0b9e, 0xb467, 0x03ec, 0x801e, 0x8132
+    dw 0x0b9f, 0xb640, 0x631c, 0x00ec, 0xdd8e
+    dw 0x0ba0, 0x8366, 0x812f, 0x0305, 0x0305
+    dw 0x0ba1, 0x812c, 0x8386, 0x83b4, 0x83b4
+    dw 0x0ba2, 0x5b54, 0x8369, 0x90c0, 0xa28b
+    dw 0x0ba3, 0x80c7, 0x031d, 0x08cf, 0x08cf
+    dw 0x0ba4, 0x0385, 0xe21c, 0x0173, 0xa95f
+    dw 0x0ba5, 0x03cc, 0x82a5, 0x271e, 0x271e
+    dw 0x0ba6, 0x821d, 0xee16, 0x0eb7, 0x3272
+    dw 0x0ba7, 0x807b, 0x0286, 0x82e1, 0x82e1
+    dw 0x0ba8, 0x82b9, 0x0133, 0x0211, 0x0211
+    dw 0x0ba9, 0xcbc5, 0x0023, 0xf90e, 0xf90e
+    dw 0x0baa, 0x827e, 0x821f, 0x5051, 0x5051
+    dw 0x0bab, 0x6b82, 0x01b4, 0x031d, 0x2e65
+    dw 0x0bac, 0x007a, 0x0160, 0x0332, 0x0332
+    dw 0x0bad, 0x00b9, 0x830e, 0x00c1, 0x00c1
+    dw 0x0bae, 0x83ab, 0x03bd, 0x8061, 0x8061
+    dw 0x0baf, 0xb57a, 0x01ec, 0x8370, 0x8418
+    dw 0x0bb0, 0x0343, 0x02d1, 0x4d19, 0x4d19
+    dw 0x0bb1, 0xdf77, 0x03b1, 0x01fc, 0xa6e2
+    dw 0x0bb2, 0x823a, 0x0391, 0x80c1, 0x80c1
+    dw 0x0bb3, 0x83e6, 0x01e9, 0x8227, 0x8227
+    dw 0x0bb4, 0x81d4, 0x82d1, 0x829d, 0x829d
+    dw 0x0bb5, 0x8252, 0x6600, 0x8333, 0xaaf8
+    dw 0x0bb6, 0x00db, 0x01b7, 0xf4fe, 0xf4fe
+    dw 0x0bb7, 0x83fe, 0x070c, 0xeb85, 0xeb85
+    dw 0x0bb8, 0x03e7, 0x8331, 0x0193, 0x0193
+    dw 0x0bb9, 0x032c, 0x831a, 0xddd4, 0xddd4
+    dw 0x0bba, 0x173d, 0x0004, 0xd263, 0xd263
+    dw 0x0bbb, 0x026f, 0x8390, 0xed9e, 0xed9e
+    dw 0x0bbc, 0x0071, 0x8330, 0xb85c, 0xb85c
+    dw 0x0bbd, 0x79d2, 0x0032, 0x80dd, 0x308c
+    dw 0x0bbe, 0x03cd, 0x8218, 0x0188, 0x0188
+    dw 0x0bbf, 0x92c9, 0x422e, 0x0232, 0x992c
+    dw 0x0bc0, 0x4650, 0x82cd, 0x8195, 0x8cd1
+    dw 0x0bc1, 0x975a, 0x83fc, 0x821f, 0x821d
+    dw 0x0bc2, 0x8109, 0x81af, 0x810e, 0x810e
+    dw 0x0bc3, 0x7377, 0x03a7, 0x81d9, 0x3ad1
+    dw 0x0bc4, 0x0219, 0x831f, 0x0227, 0x0227
+    dw 0x0bc5, 0x83ba, 0x8143, 0x0212, 0x0212
+    dw 0x0bc6, 0x81dc, 0xcaf6, 0x3e00, 0x3e00
+    dw 0x0bc7, 0x0259, 0x8392, 0x038c, 0x038c
+    dw 0x0bc8, 0x81dd, 0x84e5, 0x816c, 0x816c
+    dw 0x0bc9, 0xb943, 0x0239, 0x9679, 0x9690
+    dw 0x0bca, 0xe3f6, 0x0153, 0x834c, 0xa549
+    dw 0x0bcb, 0x812a, 0x01a9, 0x0072, 0x0072
+    dw 0x0bcc, 0xe833, 0xe275, 0x6ee5, 0x7c00
+    dw 0x0bcd, 0x87c2, 0x0177, 0x8149, 0x8149
+    dw 0x0bce, 0x1de7, 0x82ae, 0x02a2, 0x029e
+    dw 0x0bcf, 0xd768, 0x82dc, 0x5578, 0x5578
+    dw 0x0bd0, 0x005f, 0x82d8, 0x8010, 0x8010
+    dw 0x0bd1, 0x030d, 0x83aa, 0x030b, 0x030b
+    dw 0x0bd2, 0x8268, 0x009c, 0x819e, 0x819e
+    dw 0x0bd3, 0x818d, 0x8254, 0x0021, 0x0021
+    dw 0x0bd4, 0x8114, 0x0336, 0x032e, 0x032e
+    dw 0x0bd5, 0xeab0, 0x024b, 0xbf82, 0xbffd
+    dw 0x0bd6, 0x8271, 0x00f8, 0x267a, 0x267a
+    dw 0x0bd7, 0x005c, 0x2e45, 0x03df, 0x03e8
+    dw 0x0bd8, 0x8280, 0x0167, 0x0034, 0x0034
+    dw 0x0bd9, 0x8884, 0x01b6, 0x59fd, 0x59fd
+    dw 0x0bda, 0x01eb, 0x003e, 0x3211, 0x3211
+    dw 0x0bdb, 0x01ca, 0x03f8, 0x00d6, 0x00d6
+    dw 0x0bdc, 0x013f, 0x8323, 0x5839, 0x5839
+    dw 0x0bdd, 0x036b, 0xd893, 0x8068, 0x9fd3
+    dw 0x0bde, 0x00f0, 0x004e, 0x8027, 0x8027
+    dw 0x0bdf, 0x0267, 0x80fd, 0x44c9, 0x44c9
+    dw 0x0be0, 0x8221, 0x10d9, 0x18a5, 0x18a5
+    dw 0x0be1, 0x001b, 0x83b2, 0x8057, 0x8057
+    dw 0x0be2, 0x804b, 0x1cb2, 0x82b2, 0x82b2
+    dw 0x0be3, 0x034f, 0x6011, 0x8116, 0x26b9
+    dw 0x0be4, 0x8236, 0x3848, 0x02c6, 0x0197
+    dw 0x0be5, 0x82d6, 0xe9f7, 0xf8ad, 0xf8ad
+    dw 0x0be6, 0x47f5, 0x0112, 0x81d7, 0x06ad
+    dw 0x0be7, 0x2dfb, 0x00e8, 0x8263, 0x824d
+    dw 0x0be8, 0x8312, 0x82f4, 0x8372, 0x8372
+    dw 0x0be9, 0xa693, 0x82f7, 0xa345, 0xa345
+    dw 0x0bea, 0x81e6, 0x0179, 0x0048, 0x0048
+    dw 0x0beb, 0x81d2, 0x031f, 0x01d8, 0x01d8
+    dw 0x0bec, 0x80a6, 0x8202, 0xd537, 0xd537
+    dw 0x0bed, 0x9748, 0xaf00, 0x012a, 0x0af4
+    dw 0x0bee, 0x8219, 0x0327, 0x0216, 0x0216
+    dw 0x0bef, 0x5c2b, 0x9932, 0x033e, 0xb96a
+    dw 0x0bf0, 0x0252, 0x8332, 0x8278, 0x8278
+    dw 0x0bf1, 0x3dfc, 0x820d, 0x80f5, 0x8406
+    dw 0x0bf2, 0x8354, 0x81ef, 0x0232, 0x0232
+    dw 0x0bf3, 0x8613, 0xa62f, 0x8203, 0x81dd
+    dw 0x0bf4, 0x82d6, 0x52a3, 0x28d1, 0x2886
+    dw 0x0bf5, 0x8223, 0x8142, 0x0179, 0x0179
+    dw 0x0bf6, 0x82f5, 0x8239, 0x8308, 0x8308
+    dw 0x0bf7, 0x03c0, 0x03f0, 0x033e, 0x033e
+    dw 0x0bf8, 0x83fd, 0x8378, 0x83e5, 0x83e5
+    dw 0x0bf9, 0x8366, 0x0122, 0x00ce, 0x00ce
+    dw 0x0bfa, 0x0182, 0x813e, 0xe147, 0xe147
+    dw 0x0bfb, 0x0333, 0x029f, 0x837f, 0x837f
+    dw 0x0bfc, 0x8187, 0x00ae, 0x023a, 0x023a
+    dw 0x0bfd, 0x072b, 0x8243, 0x02b8, 0x02b8
+    dw 0x0bfe, 0x8189, 0x016f, 0xc6ea, 0xc6ea
+    dw 0x0bff, 0x0281, 0x4455, 0xe2e8, 0xe2e8
+    dw 0x0c00, 0x0052, 0x8234, 0x0348, 0x0348
+    dw 0x0c01, 0x9d9e, 0x0136, 0x819b, 0x819d
+    dw 0x0c02, 0xe5fa, 0x02c6, 0x823c, 0xac25
+    dw 0x0c03, 0x83d9, 0x8206, 0x2085, 0x2085
+    dw 0x0c04, 0xe894, 0x0369, 0xcd97, 0xcd9f
+    dw 0x0c05, 0x0114, 0x0307, 0x259a, 0x259a
+    dw 0x0c06, 0x8078, 0x0031, 0xf2e8, 0xf2e8
+    dw 0x0c07, 0x8362, 0x00e9, 0x837d, 0x837d
+    dw 0x0c08, 0x8351, 0x8375, 0x0382, 0x0382
+    dw 0x0c09, 0x0241, 0x0074, 0x80b0, 0x80b0
+    dw 0x0c0a, 0x81b6, 0x0012, 0x82a7, 0x82a7
+    dw 0x0c0b, 0x017b, 0x8260, 0x8232, 0x8232
+    dw 0x0c0c, 0x8e16, 0x0294, 0x01e3, 0x01e3
+    dw 0x0c0d, 0x819b, 0x008a, 0x0265, 0x0265
+    dw 0x0c0e, 0x82a5, 0x82f5, 0x9757, 0x9757
+    dw 0x0c0f, 0x00ef, 0x013a, 0x0186, 0x0186
+    dw 0x0c10, 0x8175, 0x82db, 0x026e, 0x026e
+    dw 0x0c11, 0x0090, 0x8042, 0x81ee, 0x81ee
+    dw 0x0c12, 0xc051, 0x0112, 0x80ad, 0x82fc
+    dw 0x0c13, 0x0393, 0xb607, 0x01bc, 0x0063
+    dw 0x0c14, 0x2eb2, 0x8200, 0x01bc, 0x0186
+    dw 0x0c15, 0xd68d, 0x8081, 0x5d13, 0x5d13
+    dw 0x0c16, 0x82c9, 0x01ad, 0x6ddc, 0x6ddc
+    dw 0x0c17, 0x819c, 0x028e, 0x80dc, 0x80dc
+    dw 0x0c18, 0x0276, 0x0308, 0x8378, 0x8378
+    dw 0x0c19, 0x03a4, 0x8201, 0x039a, 0x039a
+    dw 0x0c1a, 0x805a, 0x1166, 0x1609, 0x1609
+    dw 0x0c1b, 0x8327, 0x8125, 0x82b0, 0x82b0
+    dw 0x0c1c, 0x5ef4, 0x807a, 0x82d7, 0x9ab7
+    dw 0x0c1d, 0x0268, 0x83c6, 0x83be, 0x83be
+    dw 0x0c1e, 0x0251, 0x02e2, 0x837c, 0x837c
+    dw 0x0c1f, 0xd263, 0x801b, 0x02b9, 0x080e
+    dw 0x0c20, 0x01f1, 0x02e1, 0x5d2d, 0x5d2d
+    dw 0x0c21, 0x02b9, 0x130e, 0x01c5, 0x01c6
+    dw 0x0c22, 0xd36f, 0xe86a, 0x83fb, 0x7c00
+    dw 0x0c23, 0x82ff, 0x03a8, 0x0233, 0x0233
+    dw 0x0c24, 0xc8ef, 0x069f, 0x010a, 0x9405
+    dw 0x0c25, 0x0354, 0xb719, 0x80b8, 0x8232
+    dw 0x0c26, 0x01e7, 0x02be, 0x15ba, 0x15ba
+    dw 0x0c27, 0x8006, 0x835a, 0x82c8, 0x82c8
+    dw 0x0c28, 0x4d6f, 0xeca6, 0x82e8, 0xfc00
+    dw 0x0c29, 0x82bf, 0x832b, 0x81a5, 0x81a5
+    dw 0x0c2a, 0x813e, 0x0135, 0x015c, 0x015c
+    dw 0x0c2b, 0x01e0, 0x03c2, 0x0203, 0x0203
+    dw 0x0c2c, 0x026a, 0x8253, 0xe99c, 0xe99c
+    dw 0x0c2d, 0x03a4, 0x8283, 0x3cf6, 0x3cf6
+    dw 0x0c2e, 0x00c5, 0x82ba, 0x802e, 0x802e
+    dw 0x0c2f, 0x83f5, 0x0228, 0x2000, 0x2000
+    dw 0x0c30, 0x81d4, 0x0bea, 0xb395, 0xb395
+    dw 0x0c31, 0x8264, 0x8fda, 0x8223, 0x8223
+    dw 0x0c32, 0x8e3e, 0x8160, 0x5ee9, 0x5ee9
+    dw 0x0c33, 0x8194, 0xe2f4, 0x013f, 0x257e
+    dw 0x0c34, 0x0124, 0x8e0c, 0x0066, 0x0066
+    dw 0x0c35, 0x03ab, 0x039c, 0x0153, 0x0153
+    dw 0x0c36, 0x62c8, 0x02ea, 0x0298, 0x28f2
+    dw 0x0c37, 0x807b, 0x8203, 0x0314, 0x0314
+    dw 0x0c38, 0x821b, 0x03cf, 0x81ac, 0x81ac
+    dw 0x0c39, 0x4f87, 0x8031, 0x6a04, 0x6a04
+    dw 0x0c3a, 0x8196, 0x8051, 0x0007, 0x0007
+    dw 0x0c3b, 0x4867, 0xde13, 0x3997, 0xeaaf
+    dw 0x0c3c, 0x15a8, 0x0149, 0x811b, 0x811b
+    dw 0x0c3d, 0x0107, 0x4c41, 0x0170, 0x0cbb
+    dw 0x0c3e, 0x80fa, 0x000c, 0x82ac, 0x82ac
+    dw 0x0c3f, 0xeb48, 0x0082, 0x8116, 0xa766
+    dw 0x0c40, 0x00ed, 0x62c1, 0x1099, 0x228a
+    dw 0x0c41, 0x8c15, 0x8184, 0x03ce, 0x03ce
+    dw 0x0c42, 0x8259, 0x2d47, 0x8252, 0x8284
+    dw 0x0c43, 0x0093, 0x89de, 0x00b8, 0x00b8
+    dw 0x0c44, 0x83b4, 0x0794, 0x8114, 0x8114
+    dw 0x0c45, 0x80a5, 0x0118, 0x81f0, 0x81f0
+    dw 0x0c46, 0x8206, 0x8120, 0x8b0c, 0x8b0c
+    dw 0x0c47, 0xb735, 0x021b, 0xb961, 0xb961
+    dw 0x0c48, 0xb706, 0x01a0, 0x01ec, 0x0135
+    dw 0x0c49, 0x821f, 0x03d7, 0x9703, 0x9703
+    dw 0x0c4a, 0x0187, 0x8142, 0x9ff6, 0x9ff6
+    dw 0x0c4b, 0x487f, 0x8129, 0x80fd, 0x89b6
+    dw 0x0c4c, 0x0202, 0x0263, 0xd221, 0xd221
+    dw 0x0c4d, 0x030c, 0x8332, 0x7bcc, 0x7bcc
+    dw 0x0c4e, 0x1c2d, 0x819b, 0xe090, 0xe090
+    dw 0x0c4f, 0xea17, 0x82c7, 0x8024, 0x303a
+    dw 0x0c50, 0x8254, 0x030b, 0xf106, 0xf106
+    dw 0x0c51, 0x66d8, 0x0352, 0x81a2, 0x2dae
+    dw 0x0c52, 0x0363, 0x3b4b, 0x03fd, 0x0713
+    dw 0x0c53, 0x73c8, 0x00cd, 0x0276, 0x323b
+    dw 0x0c54, 0x4a01, 0x018f, 0x023c, 0x0d3d
+    dw 0x0c55, 0xf566, 0x81a1, 0x8276, 0x3865
+    dw 0x0c56, 0x8022, 0xed30, 0x0392, 0x218a
+    dw 0x0c57, 0x0035, 0x8292, 0x83c5, 0x83c5
+    dw 0x0c58, 0x81cc, 0x8079, 0x02d7, 0x02d7
+    dw 0x0c59, 0x0138, 0x82da, 0x0215, 0x0215
+    dw 0x0c5a, 0x99bf, 0x0085, 0x834e, 0x834e
+    dw 0x0c5b, 0x0284, 0xa109, 0x82d7, 0x82dd
+    dw 0x0c5c, 0x0371, 0xb689, 0x032a, 0x01c2
+    dw 0x0c5d, 0x019d, 0xd0d8, 0x03e4, 0x9354
+    dw 0x0c5e, 0x8309, 0x8173, 0x004b, 0x004b
+    dw 0x0c5f, 0x821d, 0x83c6, 0x816c, 0x816c
+    dw 0x0c60, 0x81be, 0x8123, 0x01fe, 0x01fe
+    dw 0x0c61, 0x595a, 0x8392, 0x806b, 0xa0c8
+    dw 0x0c62, 0x005d, 0x80fe, 0x640b, 0x640b
+    dw 0x0c63, 0x81bf, 0x95b1, 0xcf34, 0xcf34
+    dw 0x0c64, 0x027b, 0x0313, 0x4107, 0x4107
+    dw 0x0c65, 0x0032, 0x8254, 0x8efc, 0x8efc
+    dw 0x0c66, 0x82a4, 0x7a90, 0x801a, 0xc055
+    dw 0x0c67, 0x8201, 0x8113, 0x801a, 0x801a
+    dw 0x0c68, 0x81c5, 0x81f5, 0x0288, 0x0288
+    dw 0x0c69, 0x81c3, 0x0343, 0x0388, 0x0388
+    dw 0x0c6a, 0x012b, 0x80fc, 0x817e, 0x817e
+    dw 0x0c6b, 0x0041, 0x8172, 0x81b0, 0x81b0
+    dw 0x0c6c, 0x8148, 0xc6d1, 0xd9b6, 0xd9b6
+    dw 0x0c6d, 0x03dc, 0x82e1, 0x801a, 0x801a
+    dw 0x0c6e, 0x011f, 0x0071, 0x18cf, 0x18cf
+    dw 0x0c6f, 0x5e7e, 0x80da, 0x933d, 0x9e6f
+    dw 0x0c70, 0x8109, 0x842c, 0x82d6, 0x82d6
+    dw 0x0c71, 0x83b5, 0x83bc, 0x0223, 0x0223
+    dw 0x0c72, 0x038a, 0x8089, 0xa182, 0xa182
+    dw 0x0c73, 0xde53, 0x8355, 0x80c0, 0x2544
+    dw 0x0c74, 0x8139, 0x8149, 0x02bf, 0x02bf
+    dw 0x0c75, 0x808e, 0x813e, 0xafee, 0xafee
+
+    ; Rounding ties
+    dw 0x0c76, 0xdd60, 0x2ee0, 0x3c00, 0xd07e
+    dw 0x0c77, 0x9880, 0xb6c0, 0x82ec, 0x133a
+    dw 0x0c78, 0x8980, 0xbf28, 0x0a00, 0x0fec
+    dw 0x0c79, 0x2260, 0x4148, 0xa9d0, 0xa26a
+    dw 0x0c7a, 0x0714, 0x3000, 0x8288, 0x81a6
+    dw 0x0c7b, 0xbde0, 0x25a0, 0x9810, 0xa862
+    dw 0x0c7c, 0xcf80, 0x6088, 0xd200, 0xf442
+    dw 0x0c7d, 0x7380, 0xba00, 0xca00, 0xf1a2
+    dw 0x0c7e, 0x44a0, 0x4fa0, 0xb400, 0x5866
+    dw 0x0c7f, 0xd438, 0x1600, 0x13c0, 0xae44
+    dw 0x0c80, 0xb480, 0xd1f8, 0xb160, 0x4aa2
+    dw 0x0c81, 0x3b80, 0x4d7c, 0xca00, 0x4848
+    dw 0x0c82, 0xdb20, 0xa120, 0xaf60, 0x4056
+    dw 0x0c83, 0x01d8, 0xac00, 0x8280, 0x829e
+    dw 0x0c84, 0x87b6, 0xba00, 0x8000, 0x05c8
+    dw 0x0c85, 0xd980, 0x1b68, 0xb3a0, 0xbb00
+    dw 0x0c86, 0xe7f0, 0x4440, 0x5000, 0xf034
+    dw 0x0c87, 0xe033, 0x8600, 0x9f28, 0x2968
+    dw 0x0c88, 0xbc00, 0x59f8, 0xac00, 0xd9f8
+    dw 0x0c89, 0x1ec0, 0xc438, 0x0800, 0xa716
+    dw 0x0c8a, 0x1248, 0x5580, 0x2000, 0x2cd2
+    dw 0x0c8b, 0xb200, 0x8018, 0x82c0, 0x82bc
+    dw 0x0c8c, 0x5880, 0xbec4, 0x5400, 0xd99c
+    dw 0x0c8d, 0xb400, 0xc714, 0xad18, 0x3ec2
+    dw 0x0c8e, 0x6760, 0x87c0, 0xa800, 0xb412
+    dw 0x0c8f, 0x6f40, 0x0d10, 0x2000, 0x409a
+    dw 0x0c90, 0x9658, 0xd600, 0xa048, 0x307e
+    dw 0x0c91, 0x1800, 0xec00, 0xb710, 0xc838
+    dw 0x0c92, 0x1a80, 0x6dc0, 0xbe38, 0x4c48
+    dw 0x0c93, 0xc84f, 0x1e00, 0x0e80, 0xaa6a
+    dw 0x0c94, 0xdf00, 0x8536, 0xa400, 0x251e
+    dw 0x0c95, 0xa800, 0x9c00, 0x0afb, 0x0d7e
+    dw 0x0c96, 0xb500, 0x85e8, 0x0200, 0x03d8
+    dw 0x0c97, 0x839a, 0xf300, 0xaa40, 0x39ea
+    dw 0x0c98, 0x3f00, 0xa710, 0x1630, 0xa9fc
+    dw 0x0c99, 0xb000, 0xce00, 0x38de, 0x4338
+    dw 0x0c9a, 0x519c, 0xe500, 0xcc00, 0xfb04
+    dw 0x0c9b, 0x0d00, 0x426c, 0x0200, 0x1424
+    dw 0x0c9c, 0xf580, 0x27e0, 0xc9a0, 0xe180
+    dw 0x0c9d, 0x8f80, 0x6600, 0x9c40, 0xb9a8
+    dw 0x0c9e, 0x4f80, 0x8400, 0x0b4c, 0x9696
+    dw 0x0c9f, 0x7240, 0x8f30, 0xb650, 0xc602
+    dw 0x0ca0, 0x20b0, 0x3a60, 0xa200, 0x9c88
+    dw 0x0ca1, 0xc100, 0x02e0, 0x83d7, 0x8984
+    dw 0x0ca2, 0x85a0, 0x36c0, 0x0328, 0x00c8
+    dw 0x0ca3, 0x1eca, 0x2800, 0x0d80, 0x1072
+    dw 0x0ca4, 0x1a20, 0x9900, 0x8122, 0x819c
+    dw 0x0ca5, 0xbec0, 0x02c8, 0x02a0, 0x8212
+    dw 0x0ca6, 0x8736, 0x4800, 0x9670, 0x9906
+    dw 0x0ca7, 0x96c0, 0xbc70, 0x1580, 0x1a7e
+    dw 0x0ca8, 0x6000, 0x2200, 0x3170, 0x462c
+    dw 0x0ca9, 0x2720, 0x9380, 0x0060, 0x814c
+    dw 0x0caa, 0x6800, 0x9800, 0x2640, 0xc3f4
+    dw 0x0cab, 0xe100, 0x1970, 0x9000, 0xbecc
+    dw 0x0cac, 0x9760, 0xab20, 0x8100, 0x0592
+    dw 0x0cad, 0x23a8, 0x2080, 0x02f0, 0x09c6
+    dw 0x0cae, 0x8290, 0xb300, 0x82f3, 0x8264
+    dw 0x0caf, 0x1800, 0x8500, 0x0250, 0x024e
+    dw 0x0cb0, 0xbc00, 0x7698, 0x5680, 0xf692
+    dw 0x0cb1, 0x0e40, 0x4800, 0x0390, 0x1a5c
+    dw 0x0cb2, 0x9880, 0x3040, 0x00e2, 0x8c90
+    dw 0x0cb3, 0x2722, 0xf400, 0xe2e4, 0xe53a
+    dw 0x0cb4, 0x8b00, 0x9400, 0x0348, 0x034c
+    dw 0x0cb5, 0x12d2, 0xca00, 0x8200, 0xa122
+    dw 0x0cb6, 0xa0e4, 0x1400, 0x0000, 0x809c
+    dw 0x0cb7, 0x4e00, 0x0b76, 0x0600, 0x1db0
+    dw 0x0cb8, 0x1100, 0xb162, 0x8000, 0x86ba
+    dw 0x0cb9, 0x4700, 0x4bac, 0xba00, 0x56aa
+    dw 0x0cba, 0x5240, 0x2ca0, 0xaa60, 0x4320
+    dw 0x0cbb, 0x7480, 0xad8c, 0x6012, 0xe434
+    dw 0x0cbc, 0xcde0, 0x2000, 0x8400, 0xb1e0
+    dw 0x0cbd, 0xce80, 0xbfa0, 0x2d00, 0x5234
+    dw 0x0cbe, 0xa560, 0xb070, 0x0380, 0x1a12
+    dw 0x0cbf, 0xc848, 0x84c0, 0x0340, 0x117e
+    dw 0x0cc0, 0xda00, 0xcc34, 0x6d40, 0x7034
+    dw 0x0cc1, 0x6380, 0x3dc8, 0xd380, 0x6530
+    dw 0x0cc2, 0x6c24, 0xae80, 0x4480, 0xdea8
+    dw 0x0cc3, 0xad80, 0xcb38, 0x1400, 0x3cf8
+    dw 0x0cc4, 0xbf88, 0xdf00, 0x5ec0, 0x64fc
+    dw 0x0cc5, 0x2ee0, 0x9c00, 0x899a, 0x90d6
+    dw 0x0cc6, 0x667b, 0x9a00, 0x3c00, 0xc3b8
+    dw 0x0cc7, 0x2ae0, 0x2760, 0x0040, 0x165a
+    dw 0x0cc8, 0xacd5, 0xca00, 0x2040, 0x3b50
+    dw 0x0cc9, 0x6e00, 0x9792, 0x4040, 0xc89e
+    dw 0x0cca, 0x99c0, 0x5c00, 0xaeb4, 0xba96
+    dw 0x0ccb, 0x89d0, 0x5ec0, 0xa5c0, 0xae58
+    dw 0x0ccc, 0xac34, 0x6600, 0xda00, 0xdc94
+    dw 0x0ccd, 0x0a00, 0xc292, 0x8100, 0x910e
+    dw 0x0cce, 0x2cc0, 0x1580, 0x028f, 0x088c
+    dw 0x0ccf, 0x2b00, 0x4018, 0x0200, 0x2f2a
+    dw 0x0cd0, 0xa460, 0x32e0, 0x96f0, 0x9d7e
+    dw 0x0cd1, 0xd77c, 0x0400, 0x9694, 0xa090
+    dw 0x0cd2, 0x9000, 0xb080, 0x039f, 0x0810
+    dw 0x0cd3, 0x4380, 0xcc80, 0xa800, 0xd438
+    dw 0x0cd4, 0xab68, 0x8e00, 0x0100, 0x0264
+    dw 0x0cd5, 0x2010, 0xac20, 0x8000, 0x9030
+    dw 0x0cd6, 0x8680, 0xc4c4, 0x8000, 0x0fbe
+    dw 0x0cd7, 0xb8f0, 0xcac0, 0x3d00, 0x48ca
+    dw 0x0cd8, 0x9458, 0x6700, 0x1600, 0xbf98
+    dw 0x0cd9, 0xbdfa, 0x1e00, 0x9da0, 0xa34c
+    dw 0x0cda, 0xe580, 0xb5a0, 0x4d10, 0x6006
+    dw 0x0cdb, 0x3000, 0x5a00, 0x2600, 0x4e02
+    dw 0x0cdc, 0x0a00, 0x709c, 0x2c08, 0x3f2a
+    dw 0x0cdd, 0x4640, 0x3c70, 0x42c0, 0x4928
+    dw 0x0cde, 0xcf80, 0x3200, 0x9800, 0xc5a0
+    dw 0x0cdf, 0x028c, 0x3000, 0x0200, 0x0252
+    dw 0x0ce0, 0x5360, 0x82f0, 0x8300, 0x9982
+    dw 0x0ce1, 0xd693, 0x3c00, 0xb940, 0xd69e
+    dw 0x0ce2, 0x99f0, 0x9400, 0x8348, 0x8318
+    dw 0x0ce3, 0xcb20, 0x5440, 0x58e2, 0xe25a
+    dw 0x0ce4, 0x2018, 0xa280, 0x8324, 0x88e6
+    dw 0x0ce5, 0xa520, 0x4720, 0xaec0, 0xb3f0
+    dw 0x0ce6, 0xce00, 0x1100, 0x09e0, 0xa368
+    dw 0x0ce7, 0x3400, 0xbbc4, 0x24d4, 0xb32a
+    dw 0x0ce8, 0x2d00, 0x0520, 0x80c0, 0x805a
+    dw 0x0ce9, 0x2e00, 0x0690, 0x02d5, 0x0372
+    dw 0x0cea, 0x4400, 0xab38, 0x0d00, 0xb336
+    dw 0x0ceb, 0x73a0, 0x0ca0, 0xa700, 0x4462
+    dw 0x0cec, 0x9800, 0xd400, 0x0400, 0x3000
+    dw 0x0ced, 0x4e60, 0x40c0, 0x5480, 0x5824
+    dw 0x0cee, 0xee00, 0x4800, 0xcc00, 0xfa00
+    dw 0x0cef, 0x3f40, 0xe8b0, 0x6382, 0xea9e
+    dw 0x0cf0, 0x5100, 0xa520, 0x2f74, 0xb97a
+    dw 0x0cf1, 0x8170, 0x6570, 0x9c00, 0xa868
+    dw 0x0cf2, 0x4c00, 0x2980, 0x1700, 0x3984
+    dw 0x0cf3, 0xa200, 0x4b00, 0x1180, 0xb13a
+    dw 0x0cf4, 0x0a80, 0xafa0, 0x01a0, 0x0014
+    dw 0x0cf5, 0x7590, 0x3c20, 0x5c00, 0x75cc
+    dw 0x0cf6, 0x3380, 0x9128, 0x8322, 0x8a66
+    dw 0x0cf7, 0x6c00, 0x856b, 0xb750, 0xba5e
+    dw 0x0cf8, 0xb500, 0xa354, 0x0400, 0x1ca4
+    dw 0x0cf9, 0x93c8, 0x4f10, 0x2791, 0x1994
+    dw 0x0cfa, 0x9ae0, 0xeb60, 0x3140, 0x4a6c
+    dw 0x0cfb, 0x5140, 0x3bd0, 0x49c0, 0x5290
+    dw 0x0cfc, 0xc780, 0x8608, 0x8000, 0x11a8
+    dw 0x0cfd, 0x8818, 0x4150, 0x0e00, 0x0240
+    dw 0x0cfe, 0x3118, 0x9ab0, 0x1000, 0x8210
+    dw 0x0cff, 0xc300, 0xe4ee, 0xe180, 0x6b40
+    dw 0x0d00, 0xe4e0, 0x32e0, 0x4200, 0xdc24
+    dw 0x0d01, 0xec00, 0x3b10, 0xdf1c, 0xebf4
+    dw 0x0d02, 0x4fb8, 0x5710, 0xeb80, 0xdd7c
+    dw 0x0d03, 0xdc80, 0x8456, 0x8ba0, 0x24d2
+    dw 0x0d04, 0xa580, 0xa400, 0x02ba, 0x0e2e
+    dw 0x0d05, 0xc6a5, 0x8c00, 0x0218, 0x16c6
+    dw 0x0d06, 0xce2e, 0xd600, 0x4c00, 0x68aa
+    dw 0x0d07, 0x9b80, 0x5e00, 0x1600, 0xbd9e
+    dw 0x0d08, 0x57a0, 0x4e18, 0xe880, 0x613c
+    dw 0x0d09, 0xbe00, 0x95d2, 0x0f38, 0x1944
+    dw 0x0d0a, 0xca00, 0xa000, 0x0b00, 0x2e04
+    dw 0x0d0b, 0x6300, 0x09c4, 0x0800, 0x310c
+    dw 0x0d0c, 0x9300, 0xa1e0, 0x80d0, 0x802c
+    dw 0x0d0d, 0xaf00, 0x8760, 0x0000, 0x00ce
+    dw 0x0d0e, 0x2ed0, 0x7740, 0x5080, 0x6a3e
+    dw 0x0d0f, 0xda00, 0x07c0, 0x0080, 0xa5d0
+    dw 0x0d10, 0xada0, 0xd600, 0xaf40, 0x482a
+    dw 0x0d11, 0x338a, 0x3600, 0xa600, 0x2c28
+    dw 0x0d12, 0xc400, 0xe980, 0xd5c0, 0x7174
+    dw 0x0d13, 0x3e00, 0x1400, 0x8118, 0x15ee
+    dw 0x0d14, 0x1600, 0x4100, 0x1c61, 0x2010
+    dw 0x0d15, 0xe1e0, 0x89e0, 0x8c00, 0x304e
+    dw 0x0d16, 0x2400, 0x39c2, 0x19b2, 0x232e
+    dw 0x0d17, 0x8152, 0x5840, 0x8760, 0x99d8
+    dw 0x0d18, 0xf6c0, 0xbc98, 0xdc00, 0x77b0
+    dw 0x0d19, 0x2d00, 0xb284, 0x0200, 0xa410
+    dw 0x0d1a, 0xa480, 0x2e84, 0x0500, 0x9704
+    dw 0x0d1b, 0xbd30, 0x2680, 0xab38, 0xadb8
+    dw 0x0d1c, 0x7440, 0x2f48, 0x4800, 0x67c4
+    dw 0x0d1d, 0x8350, 0xa800, 0x80b0, 0x8096
+    dw 0x0d1e, 0x499c, 0x8480, 0x0180, 0x9220
+    dw 0x0d1f, 0x5700, 0x1000, 0x0ec0, 0x2b0e
+    dw 0x0d20, 0x2b80, 0xe550, 0xb480, 0xd500
+    dw 0x0d21, 0x3080, 0x1e1c, 0x83c0, 0x1268
+    dw 0x0d22, 0x93c0, 0x4000, 0x80b8, 0x97cc
+    dw 0x0d23, 0xba00, 0x85b2, 0x0180, 0x05c6
+    dw 0x0d24, 0xabd2, 0x1a00, 0x0180, 0x891e
+    dw 0x0d25, 0x2080, 0x546c, 0xaf80, 0x380a
+    dw 0x0d26, 0xd2e2, 0x0600, 0x0400, 0x9d1a
+    dw 0x0d27, 0x9000, 0xbaa4, 0x09d6, 0x10c8
+    dw 0x0d28, 0x4e00, 0x8f72, 0x0400, 0xa18e
+    dw 0x0d29, 0x1d80, 0x3400, 0x0538, 0x15d4
+    dw 0x0d2a, 0x5fc0, 0xb400, 0xb580, 0xd7c6
+    dw 0x0d2b, 0xda00, 0x9000, 0x8600, 0x2dfe
+    dw 0x0d2c, 0xc380, 0xb508, 0x38b6, 0x3f12
+    dw 0x0d2d, 0x4328, 0x9980, 0x0dc0, 0xa0be
+    dw 0x0d2e, 0x3df0, 0xa000, 0x9986, 0xa352
+    dw 0x0d2f, 0xac25, 0x6200, 0x4380, 0xd1c0
+    dw 0x0d30, 0x4840, 0x11c8, 0x8440, 0x1e14
+    dw 0x0d31, 0x8130, 0xe8e8, 0x9380, 0x29b6
+    dw 0x0d32, 0x24c0, 0xf700, 0xc080, 0xe02c
+    dw 0x0d33, 0x4000, 0x0560, 0x8199, 0x0894
+    dw 0x0d34, 0x6ec6, 0xba00, 0xe700, 0xeed4
+    dw 0x0d35, 0x0c00, 0xa010, 0x0238, 0x0218
+    dw 0x0d36, 0x9b80, 0x3908, 0x0000, 0x98b8
+    dw 0x0d37, 0x9680, 0xd6c8, 0xa140, 0x312e
+    dw 0x0d38, 0x2640, 0xae50, 0x9300, 0x9aae
+    dw 0x0d39, 0x3a70, 0x6000, 0x41c0, 0x5e7c
+    dw 0x0d3a, 0x18c0, 0xaba8, 0x01da, 0x873e
+    dw 0x0d3b, 0x4400, 0x0736, 0x827e, 0x0e96
+    dw 0x0d3c, 0x1000, 0x15c0, 0x806a, 0x805e
+    dw 0x0d3d, 0xf530, 0x1460, 0xa400, 0xcdae
+    dw 0x0d3e, 0x9ce0, 0xa630, 0x8200, 0x058a
+    dw 0x0d3f, 0xf480, 0xab78, 0x5100, 0x645c
+    dw 0x0d40, 0xa2a8, 0x9000, 0x0210, 0x027a
+    dw 0x0d41, 0x64a0, 0x8d40, 0xb9e0, 0xbc74
+    dw 0x0d42, 0x5700, 0x1eb8, 0x3500, 0x3c30
+    dw 0x0d43, 0xa400, 0xa5c0, 0x0a26, 0x106a
+    dw 0x0d44, 0x1fa4, 0xa100, 0x8218, 0x86de
+    dw 0x0d45, 0x1f40, 0x9100, 0x8000, 0x8048
+    dw 0x0d46, 0x9a00, 0xc3e6, 0x18d0, 0x2320
+    dw 0x0d47, 0xd900, 0xda00, 0x5940, 0x778a
+    dw 0x0d48, 0xd8f6, 0x8900, 0x0f00, 0x2650
+    dw 0x0d49, 0xcc00, 0xc060, 0xaf00, 0x505c
+    dw 0x0d4a, 0x4a94, 0x5d00, 0xd200, 0x6c10
+    dw 0x0d4b, 0x0900, 0x31f8, 0x0350, 0x052e
+    dw 0x0d4c, 0xab80, 0x1850, 0x8a00, 0x8d06
+    dw 0x0d4d, 0xa900, 0x00c0, 0x8200, 0x8208
+    dw 0x0d4e, 0xe200, 0x08d4, 0xb300, 0xb550
+    dw 0x0d4f, 0x0900, 0x34e4, 0x0200, 0x050e
+    dw 0x0d50, 0x0a60, 0x6b80, 0x8c00, 0x39fa
+    dw 0x0d51, 0x4840, 0x8500, 0x957f, 0x9814
+    dw 0x0d52, 0xb0b0, 0x4620, 0x9d00, 0xbb38
+    dw 0x0d53, 0xe280, 0x4ec8, 0xf0b8, 0xf7de
+    dw 0x0d54, 0x8180, 0x3898, 0x0080, 0x805c
+    dw 0x0d55, 0x2c30, 0xdae0, 0x4e00, 0x48ce
+    dw 0x0d56, 0x2e00, 0x0d9c, 0x8000, 0x021a
+    dw 0x0d57, 0x4e98, 0xb700, 0xcb00, 0xce62
+    dw 0x0d58, 0x5c00, 0xa800, 0xb9b8, 0xc85c
+    dw 0x0d59, 0x2400, 0x7100, 0x4120, 0x5914
+    dw 0x0d5a, 0xe74c, 0x1100, 0xacf0, 0xbcde
+    dw 0x0d5b, 0x9f00, 0x29f2, 0x8317, 0x8dfa
+    dw 0x0d5c, 0x4ed0, 0x4060, 0xc8c0, 0x5244
+    dw 0x0d5d, 0x64f8, 0xd040, 0xf1f8, 0xfac6
+    dw 0x0d5e, 0xf100, 0xb100, 0x4300, 0x6644
+    dw 0x0d5f, 0x4a80, 0x8100, 0x018f, 0x89b8
+    dw 0x0d60, 0xb77c, 0x9c00, 0x0708, 0x17ec
+    dw 0x0d61, 0x4400, 0xbc00, 0x1a00, 0xc3fe
+    dw 0x0d62, 0x3800, 0x526a, 0xb140, 0x4e60
+    dw 0x0d63, 0xc280, 0x97a8, 0x8380, 0x1e2a
+    dw 0x0d64, 0x2ac6, 0xf600, 0x5200, 0xe4e4
+    dw 0x0d65, 0x9860, 0x4860, 0x0080, 0xa4c8
+    dw 0x0d66, 0xd7d8, 0x0700, 0x9c00, 0xa46e
+    dw 0x0d67, 0x6850, 0x3280, 0x6360, 0x6570
+    dw 0x0d68, 0xdc00, 0x963e, 0x0800, 0x363e
+    dw 0x0d69, 0x4f00, 0x4d00, 0xc7c0, 0x6050
+    dw 0x0d6a, 0xb8c0, 0xcca0, 0x9c00, 0x497e
+    dw 0x0d6b, 0xbd60, 0x91f0, 0x8270, 0x13ac
+    dw 0x0d6c, 0xf400, 0x8400, 0x1000, 0x3c00
+    dw 0x0d6d, 0xacfc, 0x4680, 0x1f40, 0xb7fc
+    dw 0x0d6e, 0x57d0, 0x9c00, 0x9300, 0xb7d4
+    dw 0x0d6f, 0x5e00, 0xd100, 0xc400, 0xf380
+    dw 0x0d70, 0xb780, 0xa0fb, 0x9b76, 0x1382
+    dw 0x0d71, 0x7200, 0x1120, 0x9800, 0x47b0
+    dw 0x0d72, 0x5e80, 0x8200, 0x9b0c, 0xa422
+    dw 0x0d73, 0xbc00, 0xc580, 0x3370, 0x45bc
+    dw 0x0d74, 0xde40, 0xcfc0, 0xd9a0, 0x71f8
+    dw 0x0d75, 0xebe0, 0xb700, 0x665b, 0x6aa0
+    dw 0x0d76, 0x8d00, 0x1000, 0x8380, 0x8382
+    dw 0x0d77, 0x9400, 0xb490, 0x02fe, 0x0d50
+    dw 0x0d78, 0xdf40, 0x0970, 0x8d00, 0xacf2
+    dw 0x0d79, 0x8e00, 0xf35e, 0x4000, 0x4786
+    dw 0x0d7a, 0xbb00, 0x2d7c, 0x9000, 0xacd4
+    dw 0x0d7b, 0xa140, 0xbc00, 0x0040, 0x2140
+    dw 0x0d7c, 0xa390, 0xee00, 0x4f8a, 0x578e
+    dw 0x0d7d, 0xcc00, 0x3fe0, 0x4194, 0xcf2e
+    dw 0x0d7e, 0x5c36, 0x9100, 0x0800, 0xb142
+    dw 0x0d7f, 0x3700, 0xb69c, 0x1980, 0xb1b2
+    dw 0x0d80, 0x85a6, 0x3a00, 0x8000, 0x843c
+    dw 0x0d81, 0xf300, 0x8e84, 0xbd00, 0x4474
+    dw 0x0d82, 0x0f80, 0x5933, 0x02c0, 0x2ce0
+    dw 0x0d83, 0xf800, 0x0e00, 0x39c8, 0xc9a4
+    dw 0x0d84, 0x8ae0, 0x3be0, 0x0000, 0x8ac4
+    dw 0x0d85, 0xb000, 0x5400, 0xc26e, 0xc99c
+    dw 0x0d86, 0xcc80, 0x3dbc, 0xbbc0, 0xceb2
+    dw 0x0d87, 0x4d80, 0x3a00, 0xa000, 0x4c20
+    dw 0x0d88, 0x5c00, 0x9000, 0xb61b, 0xb80e
+    dw 0x0d89, 0x6500, 0x00e7, 0xaac0, 0xa87e
+    dw 0x0d8a, 0x5547, 0x3200, 0xc630, 0x48d2
+    dw 0x0d8b, 0x3500, 0x2f00, 0x8100, 0x2860
+    dw 0x0d8c, 0x9cd0, 0x2760, 0x0300, 0x85e0
+    dw 0x0d8d, 0x2c08, 0x3250, 0xa100, 0x1972
+    dw 0x0d8e, 0x9400, 0xe500, 0xafa8, 0x3c86
+    dw 0x0d8f, 0x4600, 0x9b1c, 0xa4a4, 0xa8fc
+    dw 0x0d90, 0x0718, 0x3c80, 0x0800, 0x0bfe
+    dw 0x0d91, 0x9500, 0x9100, 0x0388, 0x0394
+    dw 0x0d92, 0x1d2c, 0x9e00, 0x8000, 0x81f0
+    dw 0x0d93, 0xf400, 0x3140, 0xdd44, 0xe9e8
+    dw 0x0d94, 0xac00, 0x1e10, 0x0136, 0x8dc2
+    dw 0x0d95, 0xd800, 0xba00, 0x3ee0, 0x561c
+    dw 0x0d96, 0x9b00, 0xec42, 0x3b40, 0x4be8
+    dw 0x0d97, 0x3bfc, 0x3000, 0x9ed8, 0x2f8e
+    dw 0x0d98, 0xf800, 0x3800, 0x5440, 0xf3f8
+    dw 0x0d99, 0x05a0, 0x68e0, 0x8f00, 0x32d8
+    dw 0x0d9a, 0x2a00, 0x5dfe, 0x3f60, 0x4cf4
+    dw 0x0d9b, 0xa718, 0x5520, 0x4200, 0x39d2
+    dw 0x0d9c, 0x5520, 0x43e0, 0xbe00, 0x5d06
+    dw 0x0d9d, 0x3950, 0x3040, 0x8e80, 0x2d9e
+    dw 0x0d9e, 0xb280, 0x5c00, 0x3540, 0xd276
+    dw 0x0d9f, 0x8946, 0xb400, 0x06e8, 0x08c6
+    dw 0x0da0, 0xcf00, 0x4f54, 0x5200, 0xe20a
+    dw 0x0da1, 0x422e, 0x8e00, 0x8000, 0x94a2
+    dw 0x0da2, 0x359c, 0xaf00, 0x0000, 0xa8e8
+    dw 0x0da3, 0xa780, 0x0cc0, 0x80c0, 0x814e
+    dw 0x0da4, 0x2ec2, 0x7600, 0x6500, 0x6b92
+    dw 0x0da5, 0x20a8, 0xa040, 0x8130, 0x8622
+    dw 0x0da6, 0xd150, 0x0f40, 0x9000, 0xa4f0
+    dw 0x0da7, 0x9600, 0xdc78, 0xa4f8, 0x3664
+    dw 0x0da8, 0xa800, 0x2430, 0x09bd, 0x8d82
+    dw 0x0da9, 0x82f0, 0x44e0, 0x8200, 0x8c14
+    dw 0x0daa, 0xc400, 0xa900, 0x9aa0, 0x30e6
+    dw 0x0dab, 0x4e00, 0x9986, 0x8000, 0xac24
+    dw 0x0dac, 0x1840, 0x6770, 0x2b80, 0x4402
+    dw 0x0dad, 0x4600, 0x1180, 0x83e0, 0x1c10
+    dw 0x0dae, 0x9304, 0xcf00, 0x1b50, 0x270e
+    dw 0x0daf, 0x6600, 0xa946, 0xd200, 0xd6f4
+    dw 0x0db0, 0x8bc0, 0xdff0, 0x9500, 0x2f9c
+    dw 0x0db1, 0x1200, 0xaa9c, 0x0060, 0x821a
+    dw 0x0db2, 0x2c00, 0x0a54, 0x8000, 0x00ca
+    dw 0x0db3, 0x99eb, 0x3000, 0x8f1a, 0x9282
+    dw 0x0db4, 0xba80, 0x62a4, 0x5d25, 0xdda6
+    dw 0x0db5, 0xa580, 0x650c, 0xc378, 0xcfe0
+    dw 0x0db6, 0x4176, 0x1200, 0x8000, 0x1818
+    dw 0x0db7, 0xc200, 0x2ff4, 0xb4d0, 0xb964
+    dw 0x0db8, 0x39db, 0x4800, 0x4468, 0x4922
+    dw 0x0db9, 0x3220, 0xc360, 0x9e00, 0xb9b2
+    dw 0x0dba, 0x6e00, 0x9400, 0xcad1, 0xcce8
+    dw 0x0dbb, 0x2f80, 0xf5e8, 0xd880, 0xe9d2
+    dw 0x0dbc, 0x3600, 0x4100, 0xadac, 0x3aca
+    dw 0x0dbd, 0xaba0, 0x1140, 0x00e0, 0x81a0
+    dw 0x0dbe, 0x1800, 0x488c, 0x996a, 0x23be
+    dw 0x0dbf, 0x5ec0, 0x30a8, 0x3600, 0x53e8
+    dw 0x0dc0, 0xf300, 0xbf9c, 0x5800, 0x76b0
+.unit_test_end
@@ -5,7 +5,7 @@
 ;   r1: result buffer
 ;
 ; On return:
-;   r1: points one past the last character written
+;   r1: points one past the terminating \0
 ;
 ; Output conforms to the following format:
 ;
@@ -43,9 +43,9 @@
     bra .non_zero
 
     mov digit, #'0'
-    stw digit, [buf, #0]
+    stb digit, [buf]
     add buf, #1
-    mov pc, link
+    bra .terminate
 
 .non_zero
     mov tmp, #.f16_exp_mask
@@ -64,7 +64,7 @@
     ldb digit, [tmp, #2]
     stb digit, [buf, #2]
     add buf, #3
-    mov pc, link
+    bra .terminate
 
 .numeric
     bic sign, x
@@ -177,6 +177,7 @@
     bra .output_fraction
 
 .fractional
+    mov outputting, #0
     and exp, exp
     prne
     bra .normal
@@ -186,6 +187,14 @@
     bra .widen
 
 .normal
+    ; a power of two, unless in the lowest binade, has its neighbour below
+    ; half as far away as the one above, so only half the margin below
+    mov outputting, x
+    lsl outputting, #6                  ; Z if no fraction bits
+    mov outputting, exp
+    prne
+    mov outputting, #1
+    sub outputting, #1                  ; set if so
     orr x, #bit 10
 
 .widen
@@ -209,7 +218,7 @@
     lsl x_hi, exp
     lsl x_hi, #1
     mov x, #0
-    bra .output_fraction
+    bra .widen_done
 
 .widen_small
     mov x_hi, x
@@ -225,6 +234,13 @@
     lsl x, #1
     adc x_hi, x_hi
 
+.widen_done
+    and outputting, outputting          ; halve the margin for a power of two
+    preq
+    bra .output_fraction
+    lsr hulp_hi, #1
+    rrx hulp_lo
+
 .output_fraction
     and x, x                            ; if (frac != 0) {
     preq
@@ -54,6 +54,9 @@
     mov r12, #hi(.unit_test_data)
     add r12, #lo(.unit_test_data)
     ldw r15, [r12]
+
+.unit_test_operands
+    dw 2                ; a and b, for f16_batch
 }
 
 org 0x1000
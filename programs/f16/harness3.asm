@@ -0,0 +1,67 @@
+; As harness.asm, for an operation of three operands - a, b and c, in r0,
+; r1 and r2 - whose test data are the words test number, a, b, c and the
+; expected result.
+.unit_test
+{
+    mov r13, #hi(.unit_test_data+2)
+    add r13, #lo(.unit_test_data+2)
+
+.loop
+    ldw r0, [r13, #2]
+    ldw r1, [r13, #4]
+    ldw r2, [r13, #6]
+    bl .call
+    ldw r3, [r13, #8]
+    cmp r2, r3
+    prne
+    bra .failure
+.continue
+    add r13, #10
+    mov r12, #hi(.unit_test_end)
+    add r12, #lo(.unit_test_end)
+    cmp r13, r12
+    prne
+    bra .loop
+    bra .success
+
+.success
+    mov r13, #0
+    mov r14, #0
+    add r14, #0
+    hlt
+
+.failure
+    ; On entry:
+    ;       r2=got
+    ;       r3=expected
+    ;       r13=data pointer
+    ;
+    ;   Sets r14=ffff to indicate a failure, with:
+    ;       r0=a
+    ;       r1=b
+    ;       r2=c
+    ;       r3=expected
+    ;       r4=got
+    ;       r5=test number
+    mov r4, r2
+    ldw r0, [r13, #2]
+    ldw r1, [r13, #4]
+    ldw r2, [r13, #6]
+    ldw r5, [r13, #0]
+
+    mov r14, #0
+    sub r14, #1     ; signal that registers can error data
+    mov r14, #0
+    bra .continue
+    hlt
+
+.call
+    mov r12, #hi(.unit_test_data)
+    add r12, #lo(.unit_test_data)
+    ldw r15, [r12]
+
+.unit_test_operands
+    dw 3                ; a, b and c, for f16_batch
+}
+
+org 0x1000
@@ -679,1329 +679,1335 @@
     dw 0x02a2, 0xffff, 0xfe00, 0x7e00   ;   -max_nan   -qnan
     dw 0x02a3, 0xffff, 0xffff, 0x7e00   ;   -max_nan   -max_nan
 
-    ; Random values
-    dw 0x02a4, 0x2069, 0x091a, 0x0016
-    dw 0x02a5, 0xc971, 0x26a5, 0xb485
-    dw 0x02a6, 0x2dbf, 0x5607, 0x4854
-    dw 0x02a7, 0x51e1, 0xd944, 0xefbd
-    dw 0x02a8, 0xecaf, 0xb6ee, 0x680f
-    dw 0x02a9, 0x5078, 0xeb19, 0xfc00
-    dw 0x02aa, 0xb77f, 0x9517, 0x10c5
-    dw 0x02ab, 0xa673, 0x93f2, 0x019a
-    dw 0x02ac, 0x9c17, 0xc5bf, 0x25e0
-    dw 0x02ad, 0x859a, 0x4ae8, 0x94d6
-    dw 0x02ae, 0x2518, 0xa825, 0x9147
-    dw 0x02af, 0x1b9b, 0xd66f, 0xb61e
-    dw 0x02b0, 0x1dd3, 0xc1f7, 0xa458
-    dw 0x02b1, 0x1dcb, 0x827d, 0x8004
-    dw 0x02b2, 0x9cd6, 0xb6b8, 0x1810
-    dw 0x02b3, 0xa2e6, 0xa5f1, 0x0d20
-    dw 0x02b4, 0x802a, 0xa12b, 0x0000
-    dw 0x02b5, 0xcc96, 0xade9, 0x3ec7
-    dw 0x02b6, 0xf733, 0x1e77, 0xd9d1
-    dw 0x02b7, 0x872e, 0xe3e2, 0x2f13
-    dw 0x02b8, 0xd565, 0xd7a6, 0x7128
-    dw 0x02b9, 0xcefb, 0x8ce5, 0x2045
-    dw 0x02ba, 0x6cbd, 0x756e, 0x7c00
-    dw 0x02bb, 0x20d7, 0x08d5, 0x0017
-    dw 0x02bc, 0x3b2e, 0xa671, 0xa5c8
-    dw 0x02bd, 0x53bd, 0x6046, 0x7822
-    dw 0x02be, 0x4e96, 0x6f59, 0x7c00
-    dw 0x02bf, 0x36b6, 0x6c69, 0x6766
-    dw 0x02c0, 0x3150, 0x5481, 0x49fb
-    dw 0x02c1, 0xeee6, 0xce26, 0x7c00
-    dw 0x02c2, 0x0b3a, 0x91cc, 0x8003
-    dw 0x02c3, 0x7417, 0x8b64, 0xc38e
-    dw 0x02c4, 0x32f7, 0x40ad, 0x3812
-    dw 0x02c5, 0x394d, 0x2a2a, 0x2816
-    dw 0x02c6, 0x5f25, 0xc07b, 0xe400
-    dw 0x02c7, 0x0e0c, 0x348a, 0x06dd
-    dw 0x02c8, 0x9822, 0xdd07, 0x3932
-    dw 0x02c9, 0xc16f, 0x04df, 0x8a9e
-    dw 0x02ca, 0x5276, 0xe246, 0xf911
-    dw 0x02cb, 0x0db4, 0x8da4, 0x8002
-    dw 0x02cc, 0x88b7, 0x6172, 0xae6b
-    dw 0x02cd, 0xedea, 0xd74d, 0x7c00
-    dw 0x02ce, 0xd0cb, 0x24a0, 0xb98b
-    dw 0x02cf, 0x43b6, 0x021b, 0x080f
-    dw 0x02d0, 0x7922, 0x329c, 0x703e
-    dw 0x02d1, 0xd041, 0x845c, 0x18a3
-    dw 0x02d2, 0xc468, 0x4459, 0xccca
-    dw 0x02d3, 0x0fc0, 0xf760, 0xcb25
-    dw 0x02d4, 0x8506, 0x490d, 0x9258
-    dw 0x02d5, 0x218a, 0xe42b, 0xc9c6
-    dw 0x02d6, 0x0989, 0x2f97, 0x0150
-    dw 0x02d7, 0x18b6, 0xa1ab, 0x81ab
-    dw 0x02d8, 0x0c9e, 0xda25, 0xab18
-    dw 0x02d9, 0xa68a, 0x5f14, 0xc9c9
-    dw 0x02da, 0xbc6c, 0xb43f, 0x34b2
-    dw 0x02db, 0xecb8, 0x4523, 0xf60f
-    dw 0x02dc, 0x15b1, 0xdaa3, 0xb4b9
-    dw 0x02dd, 0x1c71, 0xe67c, 0xc733
-    dw 0x02de, 0x6027, 0xe897, 0xfc00
-    dw 0x02df, 0x7865, 0x92c4, 0xcf6f
-    dw 0x02e0, 0xb8d8, 0x572c, 0xd458
-    dw 0x02e1, 0x0c81, 0x4e8c, 0x1f5f
-    dw 0x02e2, 0x8238, 0x558f, 0x9a2b
-    dw 0x02e3, 0x7017, 0x6663, 0x7c00
-    dw 0x02e4, 0x5f18, 0x9fae, 0xc2cf
-    dw 0x02e5, 0x00c3, 0xac4c, 0x800d
-    dw 0x02e6, 0x593f, 0xa74d, 0xc4ca
-    dw 0x02e7, 0x0b61, 0x15ab, 0x0005
-    dw 0x02e8, 0x5b8c, 0xf819, 0xfc00
-    dw 0x02e9, 0x5ace, 0x713d, 0x7c00
-    dw 0x02ea, 0xd2bc, 0x773f, 0xfc00
-    dw 0x02eb, 0x57b9, 0xd200, 0xedcb
-    dw 0x02ec, 0xd767, 0x4050, 0xdbfb
-    dw 0x02ed, 0x4a65, 0x6a2b, 0x78ee
-    dw 0x02ee, 0xf929, 0x4727, 0xfc00
-    dw 0x02ef, 0xc157, 0xf65a, 0x7c00
-    dw 0x02f0, 0x53a8, 0x0fe4, 0x278d
-    dw 0x02f1, 0x7892, 0xa937, 0xe5f5
-    dw 0x02f2, 0xdef6, 0x084f, 0xab7f
-    dw 0x02f3, 0x1fa9, 0x5e0f, 0x41cd
-    dw 0x02f4, 0x0912, 0xcbf5, 0x990b
-    dw 0x02f5, 0xb74e, 0xb060, 0x2bfd
-    dw 0x02f6, 0xd756, 0xccf9, 0x688f
-    dw 0x02f7, 0x0bec, 0xcf70, 0x9f5d
-    dw 0x02f8, 0x27c8, 0xa22c, 0x8e01
-    dw 0x02f9, 0x9f07, 0xd4e3, 0x384b
-    dw 0x02fa, 0x742c, 0x766e, 0x7c00
-    dw 0x02fb, 0x1534, 0xbe92, 0x9846
-    dw 0x02fc, 0xe099, 0x0e5d, 0xb350
-    dw 0x02fd, 0x05b9, 0xa1f1, 0x8011
-    dw 0x02fe, 0x04b7, 0x5961, 0x2257
-    dw 0x02ff, 0xb1d5, 0x0299, 0x8079
-    dw 0x0300, 0x31d0, 0x5c40, 0x522d
-    dw 0x0301, 0x0ae8, 0x5179, 0x20b9
-    dw 0x0302, 0xba4f, 0x13fb, 0x924b
-    dw 0x0303, 0x1d6e, 0x719e, 0x53a0
-    dw 0x0304, 0xc45b, 0xf4c5, 0x7c00
-    dw 0x0305, 0x3e97, 0xd047, 0xd30c
-    dw 0x0306, 0xc435, 0x665f, 0xeeb3
-    dw 0x0307, 0x4d71, 0x6661, 0x7857
-    dw 0x0308, 0x0567, 0x2255, 0x0011
-    dw 0x0309, 0xda8e, 0x7bd5, 0xfc00
-    dw 0x030a, 0x3789, 0x9920, 0x94d4
-    dw 0x030b, 0x5c6f, 0x45e6, 0x668a
-    dw 0x030c, 0x9ed9, 0x4a9d, 0xada9
-    dw 0x030d, 0xf83a, 0xb035, 0x6c72
-    dw 0x030e, 0xc7e7, 0xfad3, 0x7c00
-    dw 0x030f, 0xe205, 0x2427, 0xca40
-    dw 0x0310, 0x05bc, 0x337e, 0x0158
-    dw 0x0311, 0xde77, 0x19b7, 0xbc9e
-    dw 0x0312, 0x50ec, 0x5015, 0x6506
-    dw 0x0313, 0xde12, 0x45b1, 0xe852
-    dw 0x0314, 0x8eac, 0xae59, 0x02a6
-    dw 0x0315, 0x09e6, 0xf50c, 0xc371
-    dw 0x0316, 0xfbcb, 0x7048, 0xfc00
-    dw 0x0317, 0xfa73, 0x1e20, 0xdcf0
-    dw 0x0318, 0x4ad6, 0x7648, 0x7c00
-    dw 0x0319, 0x55a9, 0xe3f6, 0xfc00
-    dw 0x031a, 0xd2b7, 0x9b8f, 0x3258
-    dw 0x031b, 0x82cf, 0xd117, 0x1726
-    dw 0x031c, 0xe62c, 0x7b09, 0xfc00
-    dw 0x031d, 0x814c, 0xae14, 0x0020
-    dw 0x031e, 0x75dd, 0x6351, 0x7c00
-    dw 0x031f, 0xd23b, 0x7b99, 0xfc00
-    dw 0x0320, 0x96cf, 0xb0b2, 0x0bfe
-    dw 0x0321, 0x9550, 0xe7bc, 0x4123
-    dw 0x0322, 0x00c7, 0x7362, 0x31bd
-    dw 0x0323, 0x2d6d, 0x8f74, 0x8287
-    dw 0x0324, 0x21bb, 0x3754, 0x1d40
-    dw 0x0325, 0x8480, 0x1d86, 0x8006
-    dw 0x0326, 0xa79c, 0x3ba6, 0xa746
-    dw 0x0327, 0xf272, 0xf53b, 0x7c00
-    dw 0x0328, 0x914f, 0xd668, 0x2c40
-    dw 0x0329, 0xc7f3, 0x2cde, 0xb8d6
-    dw 0x032a, 0x5937, 0x990a, 0xb692
-    dw 0x032b, 0x130b, 0xd440, 0xab7c
-    dw 0x032c, 0x1a57, 0xc11f, 0xa00f
-    dw 0x032d, 0x4a1d, 0x935a, 0xa19e
-    dw 0x032e, 0xc5b6, 0x1478, 0x9e61
-    dw 0x032f, 0x440d, 0x5b06, 0x631d
-    dw 0x0330, 0x44d4, 0xce68, 0xd7bc
-    dw 0x0331, 0x29a1, 0xd448, 0xc206
-    dw 0x0332, 0xf024, 0x60f5, 0xfc00
-    dw 0x0333, 0x58c8, 0x0daa, 0x2ac5
-    dw 0x0334, 0x0891, 0xd7bb, 0xa46a
-    dw 0x0335, 0x4951, 0xfb03, 0xfc00
-    dw 0x0336, 0xccf7, 0xdaa0, 0x6c1d
-    dw 0x0337, 0xd16b, 0x94ea, 0x2aa8
-    dw 0x0338, 0x077f, 0x2aa2, 0x0063
-    dw 0x0339, 0x2df4, 0x1a8a, 0x0cde
-    dw 0x033a, 0x484b, 0xdba9, 0xe81c
-    dw 0x033b, 0x4900, 0xc5f4, 0xd371
-    dw 0x033c, 0x6f03, 0x0eb7, 0x41e3
-    dw 0x033d, 0xda6c, 0xb310, 0x51ab
-    dw 0x033e, 0x69bd, 0xd6a0, 0xfc00
-    dw 0x033f, 0xf7e5, 0x3826, 0xf418
-    dw 0x0340, 0x0041, 0xcc2d, 0x843e
-    dw 0x0341, 0x284a, 0x6137, 0x4d97
-    dw 0x0342, 0x24f6, 0x35f4, 0x1f62
-    dw 0x0343, 0x69c8, 0x64cc, 0x7c00
-    dw 0x0344, 0xc9a8, 0x59e6, 0xe82c
-    dw 0x0345, 0x3637, 0x5e92, 0x591b
-    dw 0x0346, 0x6165, 0x60da, 0x7c00
-    dw 0x0347, 0x8c87, 0x7bef, 0xcc7d
-    dw 0x0348, 0x5fbd, 0xd4d2, 0xf8aa
-    dw 0x0349, 0x5798, 0xa8bd, 0xc47f
-    dw 0x034a, 0x9ac6, 0xc69b, 0x2598
-    dw 0x034b, 0xb774, 0x7532, 0xf0d7
-    dw 0x034c, 0x79ac, 0x2132, 0x5f5e
-    dw 0x034d, 0x4bd2, 0x7191, 0x7c00
-    dw 0x034e, 0x5958, 0x4c14, 0x6973
-    dw 0x034f, 0x3dbe, 0x81a2, 0x8258
-    dw 0x0350, 0xad4b, 0x62b4, 0xd46f
-    dw 0x0351, 0xb796, 0x1713, 0x92b5
-    dw 0x0352, 0x5f66, 0x36dc, 0x5a58
-    dw 0x0353, 0x7bdf, 0x290e, 0x68f9
-    dw 0x0354, 0x90c2, 0xb217, 0x073e
-    dw 0x0355, 0x87a1, 0xf227, 0x3dde
-    dw 0x0356, 0x12f1, 0x1428, 0x000e
-    dw 0x0357, 0x6e16, 0x72ae, 0x7c00
-    dw 0x0358, 0xe8fa, 0xc5ae, 0x7311
-    dw 0x0359, 0x1b6b, 0x83c1, 0x8003
-    dw 0x035a, 0x8c49, 0xd2e0, 0x235d
-    dw 0x035b, 0xf8f3, 0x05f5, 0xc35f
-    dw 0x035c, 0xf412, 0x44c6, 0xfc00
-    dw 0x035d, 0x7786, 0x4d6a, 0x7c00
-    dw 0x035e, 0x90da, 0xb545, 0x0a64
-    dw 0x035f, 0xcf0c, 0x3e25, 0xd16a
-    dw 0x0360, 0x17f9, 0x86a2, 0x8003
-    dw 0x0361, 0x5538, 0x775f, 0x7c00
-    dw 0x0362, 0xbd7e, 0xd118, 0x52fe
-    dw 0x0363, 0xa06e, 0x4e40, 0xb2ec
-    dw 0x0364, 0x832f, 0x280f, 0x801a
-    dw 0x0365, 0x4067, 0x9620, 0x9abe
-    dw 0x0366, 0x3c37, 0xae7d, 0xaed6
-    dw 0x0367, 0x08ce, 0x2531, 0x0032
-    dw 0x0368, 0x742b, 0x2439, 0x5c66
-    dw 0x0369, 0xa8f2, 0x0075, 0x8005
-    dw 0x036a, 0xf719, 0xa1e6, 0x5d3c
-    dw 0x036b, 0x066a, 0xeb2b, 0xb5bf
-    dw 0x036c, 0xe6ac, 0x3895, 0xe3a5
-    dw 0x036d, 0x7786, 0x3336, 0x6ec8
-    dw 0x036e, 0x07a1, 0xb5ab, 0x82b4
-    dw 0x036f, 0x4b2f, 0x8e44, 0x9da0
-    dw 0x0370, 0x0ae3, 0xc28f, 0x91a5
-    dw 0x0371, 0x4bc2, 0xdbfb, 0xebbd
-    dw 0x0372, 0x62fd, 0x9a03, 0xc140
-    dw 0x0373, 0x5f2a, 0x8b0c, 0xae4f
-    dw 0x0374, 0xda6a, 0xf54a, 0x7c00
-    dw 0x0375, 0xc743, 0x88e8, 0x1474
-    dw 0x0376, 0xec74, 0x2252, 0xd309
-    dw 0x0377, 0x9567, 0x196b, 0x803b
-    dw 0x0378, 0x374d, 0x03f3, 0x01cd
-    dw 0x0379, 0x0497, 0x1df9, 0x0007
-    dw 0x037a, 0x81e4, 0x3d2c, 0x8272
-    dw 0x037b, 0x957f, 0xb51a, 0x0f02
-    dw 0x037c, 0x44ce, 0x4b2a, 0x544d
-    dw 0x037d, 0x0049, 0xd312, 0x8c08
-    dw 0x037e, 0x560d, 0xc2d8, 0xdd2d
-    dw 0x037f, 0x1ed4, 0x3209, 0x1527
-    dw 0x0380, 0x25d5, 0xb8d7, 0xa30e
-    dw 0x0381, 0x9133, 0xb0e1, 0x0657
-    dw 0x0382, 0x9342, 0x867e, 0x0001
-    dw 0x0383, 0x7824, 0x1c2a, 0x584f
-    dw 0x0384, 0x8496, 0x6499, 0xad45
-    dw 0x0385, 0x193d, 0xa6e8, 0x8486
-    dw 0x0386, 0xfa00, 0x16c6, 0xd514
-    dw 0x0387, 0xc054, 0x314d, 0xb5bc
-    dw 0x0388, 0x1ab9, 0xc4eb, 0xa422
-    dw 0x0389, 0x4f46, 0x9c9d, 0xb032
-    dw 0x038a, 0x0217, 0xe4c5, 0xa8fc
-    dw 0x038b, 0x51b7, 0x46e5, 0x5ced
-    dw 0x038c, 0x2fef, 0x5200, 0x45f3
-    dw 0x038d, 0x19f7, 0x85fc, 0x8004
-    dw 0x038e, 0x14d9, 0x38cc, 0x11d0
-    dw 0x038f, 0xb805, 0x3aae, 0xb6b6
-    dw 0x0390, 0xf1a3, 0x4939, 0xfc00
-    dw 0x0391, 0xeb90, 0x84e5, 0x34a0
-    dw 0x0392, 0xcfb7, 0x63b4, 0xf76e
-    dw 0x0393, 0xa10f, 0x544d, 0xb970
-    dw 0x0394, 0xc84d, 0xba4d, 0x46c6
-    dw 0x0395, 0xfb36, 0xc24d, 0x7c00
-    dw 0x0396, 0xd113, 0xbb8a, 0x50c8
-    dw 0x0397, 0xf39a, 0xebcc, 0x7c00
-    dw 0x0398, 0x8075, 0x42e0, 0x8192
-    dw 0x0399, 0x8869, 0x828c, 0x0000
-    dw 0x039a, 0x27a5, 0xda20, 0xc5da
-    dw 0x039b, 0xc972, 0x5794, 0xe528
-    dw 0x039c, 0x2c20, 0xe369, 0xd3a4
-    dw 0x039d, 0xdd91, 0x40f9, 0xe2ec
-    dw 0x039e, 0x1c35, 0x9596, 0x805e
-    dw 0x039f, 0x7ba8, 0x0dd9, 0x4d99
-    dw 0x03a0, 0xdecf, 0x6738, 0xfc00
-    dw 0x03a1, 0x92be, 0xae86, 0x057f
-    dw 0x03a2, 0xcaec, 0x33ce, 0xc2c1
-    dw 0x03a3, 0x02d4, 0x933a, 0x8001
-    dw 0x03a4, 0xee1b, 0x5587, 0xfc00
-    dw 0x03a5, 0xbf2e, 0xb994, 0x3d02
-    dw 0x03a6, 0x4922, 0xaafa, 0xb87a
-    dw 0x03a7, 0x3a09, 0x8c02, 0x8a0c
-    dw 0x03a8, 0x3363, 0xbc95, 0xb43b
-    dw 0x03a9, 0xb3a8, 0x0d83, 0x8546
-    dw 0x03aa, 0x8607, 0x0b3c, 0x8000
-    dw 0x03ab, 0x39a3, 0x6971, 0x67ab
-    dw 0x03ac, 0xe8cd, 0x7a9d, 0xfc00
-    dw 0x03ad, 0x85a6, 0xf645, 0x406d
-    dw 0x03ae, 0x937f, 0x5d33, 0xb4df
-    dw 0x03af, 0x5d7d, 0x263e, 0x4848
-    dw 0x03b0, 0x0bba, 0x2869, 0x0088
-    dw 0x03b1, 0x5a0c, 0x0e8e, 0x2cf4
-    dw 0x03b2, 0xbba3, 0x4827, 0xc7ed
-    dw 0x03b3, 0x0c98, 0x112b, 0x0003
-    dw 0x03b4, 0x0755, 0xc62c, 0x91a8
-    dw 0x03b5, 0x5a4d, 0xb24f, 0xd0f8
-    dw 0x03b6, 0x0035, 0xe64f, 0x9d39
-    dw 0x03b7, 0xe5b2, 0xbcca, 0x66d2
-    dw 0x03b8, 0x99f7, 0xf335, 0x5160
-    dw 0x03b9, 0x42d2, 0xa534, 0xac70
-    dw 0x03ba, 0x2cd8, 0xac43, 0x9d29
-    dw 0x03bb, 0x8e01, 0xa775, 0x00b3
-    dw 0x03bc, 0x31e9, 0x0c65, 0x033f
-    dw 0x03bd, 0x9dba, 0xc569, 0x27bf
-    dw 0x03be, 0x6999, 0xfb37, 0xfc00
-    dw 0x03bf, 0xeba7, 0x7553, 0xfc00
-    dw 0x03c0, 0x23a1, 0x45b3, 0x2d6f
-    dw 0x03c1, 0x83e1, 0xdf44, 0x270c
-    dw 0x03c2, 0x8dda, 0x9079, 0x0003
-    dw 0x03c3, 0xf06f, 0x952f, 0x49bf
-    dw 0x03c4, 0x56a5, 0x4abc, 0x6598
-    dw 0x03c5, 0x477e, 0x56da, 0x626b
-    dw 0x03c6, 0x310c, 0x2d30, 0x228c
-    dw 0x03c7, 0x13a4, 0xcb03, 0xa2b2
-    dw 0x03c8, 0x2065, 0x5676, 0x3b19
-    dw 0x03c9, 0x7037, 0x4d3d, 0x7c00
-    dw 0x03ca, 0x02b9, 0xf4b3, 0xba66
-    dw 0x03cb, 0x34a3, 0x0a9e, 0x03d6
-    dw 0x03cc, 0x926d, 0xfa0c, 0x50db
-    dw 0x03cd, 0x7437, 0x8da5, 0xc5f3
-    dw 0x03ce, 0xe5b3, 0xe98a, 0x7c00
-    dw 0x03cf, 0xb146, 0x2b66, 0xa0e0
-    dw 0x03d0, 0x6d6b, 0x908a, 0xc226
-    dw 0x03d1, 0xb940, 0x80fa, 0x00a4
-    dw 0x03d2, 0x4e6f, 0x5489, 0x674b
-    dw 0x03d3, 0xcbb6, 0x95ed, 0x25b6
-    dw 0x03d4, 0xab63, 0xc31d, 0x3291
-    dw 0x03d5, 0xbf08, 0xc7c6, 0x4ad5
-    dw 0x03d6, 0xe382, 0x157e, 0xbd27
-    dw 0x03d7, 0x37fd, 0x30bf, 0x2cbd
-    dw 0x03d8, 0x1838, 0x3636, 0x128d
-    dw 0x03d9, 0x2572, 0x4cdb, 0x369c
-    dw 0x03da, 0x40d5, 0xb7e0, 0xbcc2
-    dw 0x03db, 0x46e7, 0xb50c, 0xc05b
-    dw 0x03dc, 0x4585, 0x2c9a, 0x365a
-    dw 0x03dd, 0x9e97, 0xf6cb, 0x5998
-    dw 0x03de, 0x5800, 0x0c02, 0x2802
-    dw 0x03df, 0x8755, 0x1140, 0x8001
-    dw 0x03e0, 0x09e7, 0x084f, 0x0000
-    dw 0x03e1, 0x5faf, 0x5e70, 0x7c00
-    dw 0x03e2, 0xd406, 0xf59c, 0x7c00
-    dw 0x03e3, 0x09d4, 0xd0c8, 0x9ef7
-    dw 0x03e4, 0xb8b9, 0xc8dc, 0x45bd
-    dw 0x03e5, 0x988e, 0x9c3b, 0x009a
-    dw 0x03e6, 0xde5a, 0xd08c, 0x7338
-    dw 0x03e7, 0xccfa, 0xf692, 0x7c00
-    dw 0x03e8, 0x06c2, 0xf26d, 0xbd6e
-    dw 0x03e9, 0x436d, 0x4797, 0x4f0c
-    dw 0x03ea, 0xaa4d, 0x8a54, 0x009f
-    dw 0x03eb, 0xefd2, 0xb6ee, 0x6ac6
-    dw 0x03ec, 0x9b3b, 0xe69d, 0x45fa
-    dw 0x03ed, 0x0eee, 0xa73d, 0x80c9
-    dw 0x03ee, 0x6df2, 0x202e, 0x5236
-    dw 0x03ef, 0xb124, 0x7642, 0xec05
-    dw 0x03f0, 0x0f95, 0x4a48, 0x1df4
-    dw 0x03f1, 0x7579, 0x1969, 0x5367
-    dw 0x03f2, 0x1b10, 0x2e32, 0x0d78
-    dw 0x03f3, 0xe245, 0xb39f, 0x59f9
-    dw 0x03f4, 0xca6d, 0xc09f, 0x4f6c
-    dw 0x03f5, 0x842b, 0x9768, 0x0002
-    dw 0x03f6, 0xb732, 0x8aed, 0x063b
-    dw 0x03f7, 0x89d5, 0xfa9f, 0x48d4
-    dw 0x03f8, 0xd285, 0x3422, 0xcabc
-    dw 0x03f9, 0x84f4, 0xcf29, 0x186f
-    dw 0x03fa, 0x23f4, 0x3be2, 0x23d6
-    dw 0x03fb, 0x6a64, 0x0a91, 0x393f
-    dw 0x03fc, 0x4ad1, 0x11a1, 0x20cc
-    dw 0x03fd, 0x7883, 0x6aff, 0x7c00
-    dw 0x03fe, 0xc2c6, 0xeec5, 0x75bb
-    dw 0x03ff, 0xeadd, 0xd25b, 0x7c00
-    dw 0x0400, 0x390d, 0x6056, 0x5d7a
-    dw 0x0401, 0xebc4, 0x541e, 0xfc00
-    dw 0x0402, 0x8e89, 0xce09, 0x20ee
-    dw 0x0403, 0x07bd, 0x58f6, 0x24cc
-    dw 0x0404, 0x8ea8, 0x8be8, 0x0002
-    dw 0x0405, 0xf05e, 0x45da, 0xfa64
-    dw 0x0406, 0x16d5, 0x7a33, 0x554b
-    dw 0x0407, 0x407a, 0xe95a, 0xedfd
-    dw 0x0408, 0xae55, 0xc56e, 0x384c
-    dw 0x0409, 0xb883, 0xd249, 0x4f17
-    dw 0x040a, 0x0150, 0x22e7, 0x0005
-    dw 0x040b, 0xdcda, 0x4c21, 0xed02
-    dw 0x040c, 0x3489, 0x555e, 0x4e16
-    dw 0x040d, 0xb721, 0xf74f, 0x7283
-    dw 0x040e, 0x4423, 0xa1fe, 0xaa32
-    dw 0x040f, 0xc9aa, 0x0254, 0x8e98
-    dw 0x0410, 0xb56e, 0xd14f, 0x4b35
-    dw 0x0411, 0x90dd, 0x8377, 0x0001
-    dw 0x0412, 0xd90c, 0xe9d4, 0x7c00
-    dw 0x0413, 0x121f, 0x64f4, 0x3b94
-    dw 0x0414, 0xda32, 0x57fa, 0xf62d
-    dw 0x0415, 0x7bc9, 0x5466, 0x7c00
-    dw 0x0416, 0x9874, 0x6524, 0xc1b9
-    dw 0x0417, 0x02bb, 0x5de2, 0x2404
-    dw 0x0418, 0x1da7, 0xd505, 0xb718
-    dw 0x0419, 0x5f32, 0x408f, 0x641a
-    dw 0x041a, 0xb1df, 0xab54, 0x2161
-    dw 0x041b, 0x7518, 0x073d, 0x409c
-    dw 0x041c, 0x6275, 0x6c67, 0x7c00
-    dw 0x041d, 0x4b61, 0x0473, 0x141b
-    dw 0x041e, 0x3611, 0xc892, 0xc2ee
-    dw 0x041f, 0x06c7, 0xeb7f, 0xb65a
-    dw 0x0420, 0x99e1, 0x97a5, 0x005a
-    dw 0x0421, 0x6ef6, 0x72ed, 0x7c00
-    dw 0x0422, 0x8179, 0x8115, 0x0000
-    dw 0x0423, 0xd7e1, 0x5bab, 0xf78d
-    dw 0x0424, 0xd90f, 0x53aa, 0xf0d9
-    dw 0x0425, 0xb011, 0x7183, 0xe59a
-    dw 0x0426, 0xb8ce, 0xb2cd, 0x3016
-    dw 0x0427, 0xcf65, 0xd676, 0x69f9
-    dw 0x0428, 0x87d2, 0x2e98, 0x80ce
-    dw 0x0429, 0x1705, 0x39b1, 0x14fe
-    dw 0x042a, 0xd9ec, 0x8c1d, 0x2a17
-    dw 0x042b, 0x40ef, 0x3c61, 0x4167
-    dw 0x042c, 0xf884, 0x8c50, 0x48de
-    dw 0x042d, 0x40d4, 0x2e95, 0x33f2
-    dw 0x042e, 0x54e2, 0x479b, 0x60a4
-    dw 0x042f, 0x1a14, 0xeec3, 0xcd23
-    dw 0x0430, 0xdf40, 0x890a, 0x2c91
-    dw 0x0431, 0x61b0, 0x60b9, 0x7c00
-    dw 0x0432, 0x0a1f, 0x3991, 0x0842
-    dw 0x0433, 0xbc65, 0xe32f, 0x63e4
-    dw 0x0434, 0x8d3b, 0x6c76, 0xbdd5
-    dw 0x0435, 0x54b2, 0x460a, 0x5f17
-    dw 0x0436, 0x1f43, 0x2418, 0x076f
-    dw 0x0437, 0x1c80, 0xa715, 0x87f8
-    dw 0x0438, 0x52b0, 0x3385, 0x4a49
-    dw 0x0439, 0xe0c7, 0x2c9c, 0xd181
-    dw 0x043a, 0xbfa2, 0x21b6, 0xa573
-    dw 0x043b, 0x68fd, 0xb826, 0xe52c
-    dw 0x043c, 0xae06, 0xa9d1, 0x1c61
-    dw 0x043d, 0xe6bb, 0x02e8, 0xace4
-    dw 0x043e, 0xf16c, 0x00cf, 0xb062
-    dw 0x043f, 0xf1ab, 0xd0ad, 0x7c00
-    dw 0x0440, 0x89d9, 0x535b, 0xa160
-    dw 0x0441, 0x3166, 0x93f8, 0x8961
-    dw 0x0442, 0x8cec, 0xedcb, 0x3f21
-    dw 0x0443, 0x7727, 0x1a27, 0x5580
-    dw 0x0444, 0x5a42, 0xcbda, 0xea24
-    dw 0x0445, 0x6031, 0x7985, 0x7c00
-    dw 0x0446, 0xeff2, 0x209b, 0xd493
-    dw 0x0447, 0x42a2, 0xb036, 0xb6fc
-    dw 0x0448, 0x0162, 0x6f3e, 0x3102
-    dw 0x0449, 0x6fd8, 0x2318, 0x56f5
-    dw 0x044a, 0xd83b, 0x27fe, 0xc43a
-    dw 0x044b, 0xd11e, 0x820c, 0x153d
-    dw 0x044c, 0x0eb9, 0xd406, 0xa6c3
-    dw 0x044d, 0x7378, 0x0f88, 0x4708
-    dw 0x044e, 0xc5b1, 0x4425, 0xcde6
-    dw 0x044f, 0x9961, 0x190c, 0x806d
-    dw 0x0450, 0x758c, 0x2d5a, 0x676c
-    dw 0x0451, 0xa5f8, 0x6357, 0xcd7a
-    dw 0x0452, 0xa481, 0xc01f, 0x28a4
-    dw 0x0453, 0xbd99, 0x705b, 0xf218
-    dw 0x0454, 0x2051, 0x371f, 0x1baf
-    dw 0x0455, 0x604d, 0x9d02, 0xc162
-    dw 0x0456, 0x57ba, 0xa2ef, 0xbeb2
-    dw 0x0457, 0x4d39, 0x591c, 0x6aac
-    dw 0x0458, 0x122d, 0xbd11, 0x93d2
-    dw 0x0459, 0xea68, 0xe510, 0x7c00
-    dw 0x045a, 0x4d52, 0x6c74, 0x7c00
-    dw 0x045b, 0xf3c9, 0x2158, 0xd933
-    dw 0x045c, 0xdfed, 0x0352, 0xa694
-    dw 0x045d, 0xe709, 0x2412, 0xcf29
-    dw 0x045e, 0x9cb3, 0x0015, 0x8000
-    dw 0x045f, 0x999e, 0xca0d, 0x2840
-    dw 0x0460, 0xa60d, 0x6e8f, 0xd8f6
-    dw 0x0461, 0x662c, 0xba8f, 0xe50f
-    dw 0x0462, 0xdeea, 0x867d, 0x299c
-    dw 0x0463, 0xf1ae, 0x3f38, 0xf520
-    dw 0x0464, 0x2380, 0x4968, 0x3112
-    dw 0x0465, 0xe227, 0x70b9, 0xfc00
-    dw 0x0466, 0xa284, 0xf455, 0x5b0e
-    dw 0x0467, 0x2dca, 0x1eb8, 0x10dd
-    dw 0x0468, 0xdebd, 0x12da, 0xb5c5
-    dw 0x0469, 0x6c0a, 0x4b32, 0x7b44
-    dw 0x046a, 0x06a4, 0x8d62, 0x8001
-    dw 0x046b, 0x2b1f, 0x09f6, 0x00aa
-    dw 0x046c, 0x746b, 0x4f31, 0x7c00
-    dw 0x046d, 0xa6a9, 0x7480, 0xdf7e
-    dw 0x046e, 0xe8d0, 0x70b7, 0xfc00
-    dw 0x046f, 0x1a8d, 0xe5c6, 0xc4ba
-    dw 0x0470, 0xdf46, 0x80ba, 0x1d49
-    dw 0x0471, 0xa055, 0xbe30, 0x22b3
-    dw 0x0472, 0x0737, 0x9204, 0x8001
-    dw 0x0473, 0x2ab7, 0xdb6c, 0xca3b
-    dw 0x0474, 0xdf90, 0x9b70, 0x3f08
-    dw 0x0475, 0xd3e5, 0xc93b, 0x6129
-    dw 0x0476, 0x9ca9, 0xb2a2, 0x13ba
-    dw 0x0477, 0xdc15, 0x08b4, 0xa8cd
-    dw 0x0478, 0xe2b9, 0x9616, 0x3d1d
-    dw 0x0479, 0x28f3, 0xecaf, 0xd9cc
-    dw 0x047a, 0x0a82, 0x7825, 0x46be
-    dw 0x047b, 0x9359, 0x60f5, 0xb88e
-    dw 0x047c, 0x0410, 0x9990, 0x8003
-    dw 0x047d, 0x46bb, 0xe356, 0xee2c
-    dw 0x047e, 0x1a4a, 0xe710, 0xc58d
-    dw 0x047f, 0xa186, 0x2181, 0x879a
-    dw 0x0480, 0x7914, 0x9eef, 0xdc67
-    dw 0x0481, 0x4c39, 0x5481, 0x64c1
-    dw 0x0482, 0xe7a9, 0xd272, 0x7c00
-    dw 0x0483, 0x5264, 0xb0e4, 0xc7d0
-    dw 0x0484, 0x6f1b, 0x0506, 0x3876
-    dw 0x0485, 0x8cfa, 0x77cf, 0xc8dc
-    dw 0x0486, 0x02db, 0x6fb3, 0x357f
-    dw 0x0487, 0x0de6, 0x2bce, 0x0170
-    dw 0x0488, 0x5c63, 0x1868, 0x38d5
-    dw 0x0489, 0xa3f3, 0xefbc, 0x57af
-    dw 0x048a, 0x976a, 0x04e8, 0x8002
-    dw 0x048b, 0xf3cc, 0x30fa, 0xe8da
-    dw 0x048c, 0x4ba3, 0xd722, 0xe6cf
-    dw 0x048d, 0x4b44, 0x32b4, 0x4216
-    dw 0x048e, 0x78a8, 0x6cc6, 0x7c00
-    dw 0x048f, 0xabc8, 0x1797, 0x8762
-    dw 0x0490, 0xb8ff, 0x0049, 0x802e
-    dw 0x0491, 0x9616, 0xa0a8, 0x00e3
-    dw 0x0492, 0xd2bb, 0xe87a, 0x7c00
-    dw 0x0493, 0x518d, 0x41d7, 0x580d
-    dw 0x0494, 0xed81, 0xde87, 0x7c00
-    dw 0x0495, 0xb9a6, 0xf05c, 0x6e28
-    dw 0x0496, 0x4e3a, 0xc78c, 0xd9e0
-    dw 0x0497, 0x1c2a, 0xaa9d, 0x8ae2
-    dw 0x0498, 0xdff4, 0xc01e, 0x6418
-    dw 0x0499, 0x9a59, 0x775f, 0xd5d9
-    dw 0x049a, 0xc506, 0x8e25, 0x17b7
-    dw 0x049b, 0xa859, 0x10aa, 0x8144
-    dw 0x049c, 0x6547, 0xf39e, 0xfc00
-    dw 0x049d, 0x435e, 0xddf0, 0xe578
-    dw 0x049e, 0x6064, 0xef26, 0xfc00
-    dw 0x049f, 0xf587, 0x1963, 0xd372
-    dw 0x04a0, 0xef70, 0x8b9e, 0x3f15
-    dw 0x04a1, 0xba0b, 0xc22b, 0x40a9
-    dw 0x04a2, 0x7418, 0x0b98, 0x43c6
-    dw 0x04a3, 0x0402, 0x6199, 0x299c
-    dw 0x04a4, 0xea1f, 0xbda9, 0x6c55
-    dw 0x04a5, 0x51f5, 0x385a, 0x4e7b
-    dw 0x04a6, 0x8535, 0x6e20, 0xb7f9
-    dw 0x04a7, 0xe2f7, 0x652a, 0xfc00
-    dw 0x04a8, 0x2e3e, 0xdc89, 0xcf14
-    dw 0x04a9, 0xf344, 0x0b76, 0xc2c7
-    dw 0x04aa, 0x84e2, 0x03ee, 0x8000
-    dw 0x04ab, 0x70be, 0x7880, 0x7c00
-    dw 0x04ac, 0x474c, 0x4eae, 0x5a18
-    dw 0x04ad, 0xd8e4, 0x3673, 0xd3e3
-    dw 0x04ae, 0x4435, 0xf247, 0xfa9a
-    dw 0x04af, 0x25e3, 0xcfd3, 0xb9c2
-    dw 0x04b0, 0xac53, 0xe80e, 0x5862
-    dw 0x04b1, 0x43ec, 0xb7eb, 0xbfd7
-    dw 0x04b2, 0xec11, 0xa585, 0x559c
-    dw 0x04b3, 0xa20b, 0xa9ba, 0x1053
-    dw 0x04b4, 0xf77b, 0xda65, 0x7c00
-    dw 0x04b5, 0x2eef, 0x659b, 0x58dc
-    dw 0x04b6, 0xbd5c, 0x9419, 0x157d
-    dw 0x04b7, 0x93d9, 0x3aad, 0x928c
-    dw 0x04b8, 0x70a2, 0x871d, 0xbc1f
-    dw 0x04b9, 0x4624, 0xf585, 0xfc00
-    dw 0x04ba, 0x8b0c, 0xb6e2, 0x0610
-    dw 0x04bb, 0x6e05, 0xd258, 0xfc00
-    dw 0x04bc, 0x0590, 0x46ea, 0x10cf
-    dw 0x04bd, 0x08cb, 0x49c5, 0x16ea
-    dw 0x04be, 0x3931, 0x2eae, 0x2c56
-    dw 0x04bf, 0x1999, 0xe584, 0xc3b8
-    dw 0x04c0, 0x16bd, 0x5d85, 0x38a6
-    dw 0x04c1, 0x9d70, 0x02ce, 0x8004
-    dw 0x04c2, 0x030a, 0x3f7b, 0x05af
-    dw 0x04c3, 0xac88, 0xfa85, 0x6b63
-    dw 0x04c4, 0x19e0, 0xdb77, 0xb97b
-    dw 0x04c5, 0x6020, 0xd73c, 0xfb76
-    dw 0x04c6, 0x6f91, 0xf3f9, 0xfc00
-    dw 0x04c7, 0x11ea, 0xe033, 0xb635
-    dw 0x04c8, 0x7b17, 0x580e, 0x7c00
-    dw 0x04c9, 0xd5b8, 0x0623, 0xa063
-    dw 0x04ca, 0x0ef0, 0x43be, 0x16b7
-    dw 0x04cb, 0xd87b, 0x1480, 0xb10a
-    dw 0x04cc, 0x8aa8, 0xe147, 0x3064
-    dw 0x04cd, 0x5e45, 0xc3d9, 0xe626
-    dw 0x04ce, 0x0ff5, 0x77de, 0x4bd3
-    dw 0x04cf, 0xa95e, 0x26b2, 0x947e
-    dw 0x04d0, 0xd563, 0x46ce, 0xe095
-    dw 0x04d1, 0x2980, 0xd86e, 0xc617
-    dw 0x04d2, 0x8649, 0xd608, 0x20bd
-    dw 0x04d3, 0xd2f3, 0xa029, 0x373a
-    dw 0x04d4, 0xb180, 0x3314, 0xa8de
-    dw 0x04d5, 0x7765, 0x2111, 0x5caf
-    dw 0x04d6, 0x270d, 0x894f, 0x804b
-    dw 0x04d7, 0x0144, 0xa224, 0x8004
-    dw 0x04d8, 0xe15d, 0xd6fd, 0x7c00
-    dw 0x04d9, 0xa847, 0xf04d, 0x5c99
-    dw 0x04da, 0x1abb, 0x80c3, 0x8001
-    dw 0x04db, 0x04cd, 0xa563, 0x801a
-    dw 0x04dc, 0x620a, 0x6313, 0x7c00
-    dw 0x04dd, 0x693c, 0x71ff, 0x7c00
-    dw 0x04de, 0xdaf1, 0x129a, 0xb1ba
-    dw 0x04df, 0x98b2, 0xb055, 0x0d16
-    dw 0x04e0, 0x5968, 0xc232, 0xe030
-    dw 0x04e1, 0x88c3, 0xdfb1, 0x2c94
-    dw 0x04e2, 0x983b, 0x5bb6, 0xb814
-    dw 0x04e3, 0x49bb, 0x8eca, 0x9cdd
-    dw 0x04e4, 0xf740, 0x6acc, 0xfc00
-    dw 0x04e5, 0xb5d8, 0x808f, 0x0034
-    dw 0x04e6, 0x6c10, 0x57fc, 0x7c00
-    dw 0x04e7, 0x61ed, 0x430d, 0x6939
-    dw 0x04e8, 0x0044, 0x523a, 0x0a9e
-    dw 0x04e9, 0x5dc8, 0x8107, 0x9df0
-    dw 0x04ea, 0x5708, 0x032b, 0x1d92
-    dw 0x04eb, 0xe311, 0xba1b, 0x6165
-    dw 0x04ec, 0x6c68, 0x5510, 0x7c00
-    dw 0x04ed, 0x950c, 0xedc2, 0x4744
-    dw 0x04ee, 0x4561, 0xd86b, 0xe1f1
-    dw 0x04ef, 0xaff5, 0xce24, 0x421c
-    dw 0x04f0, 0xb81c, 0x4830, 0xc44d
-    dw 0x04f1, 0x29db, 0x37f7, 0x25d4
-    dw 0x04f2, 0x91eb, 0xb8a5, 0x0edf
-    dw 0x04f3, 0x2f37, 0x6e7d, 0x61da
-    dw 0x04f4, 0xafc6, 0x68c7, 0xdca4
-    dw 0x04f5, 0xc67a, 0x11b3, 0x9c9d
-    dw 0x04f6, 0xabd5, 0xc6be, 0x369a
-    dw 0x04f7, 0x63ee, 0x099d, 0x3190
-    dw 0x04f8, 0x47c5, 0xbaf6, 0xc6c3
-    dw 0x04f9, 0x0cc9, 0x2ad6, 0x0106
-    dw 0x04fa, 0x7511, 0x7931, 0x7c00
-    dw 0x04fb, 0x0a1d, 0xf833, 0xc66b
-    dw 0x04fc, 0x6da9, 0x4f7f, 0x7c00
-    dw 0x04fd, 0xd09e, 0x1d9e, 0xb27c
-    dw 0x04fe, 0x1da3, 0x88bb, 0x800d
-    dw 0x04ff, 0x65ce, 0x477e, 0x7170
-    dw 0x0500, 0xc0b2, 0xf7b9, 0x7c00
-    dw 0x0501, 0x0024, 0xefe9, 0xa473
-    dw 0x0502, 0xf470, 0x6ea1, 0xfc00
-    dw 0x0503, 0x9faf, 0x5d37, 0xc102
-    dw 0x0504, 0x351b, 0xb163, 0xaae0
-    dw 0x0505, 0x090c, 0xfbd9, 0xc8f3
-    dw 0x0506, 0x1551, 0x12aa, 0x0012
-    dw 0x0507, 0x439e, 0xd047, 0xd813
-    dw 0x0508, 0x1f73, 0x6e74, 0x5202
-    dw 0x0509, 0x4558, 0x98a4, 0xa233
-    dw 0x050a, 0xee5b, 0x4f75, 0xfc00
-    dw 0x050b, 0x90d7, 0x5c04, 0xb0dc
-    dw 0x050c, 0x9ef4, 0x6176, 0xc4bf
-    dw 0x050d, 0x79a2, 0xbc98, 0xfa78
-    dw 0x050e, 0xea31, 0xdf70, 0x7c00
-    dw 0x050f, 0x0416, 0xaae3, 0x8038
-    dw 0x0510, 0xd729, 0x043a, 0x9f91
-    dw 0x0511, 0x9acc, 0xcb99, 0x2a74
-    dw 0x0512, 0x72dc, 0x3a7b, 0x718e
-    dw 0x0513, 0x28d0, 0xa7f7, 0x94cb
-    dw 0x0514, 0xebde, 0x31dd, 0xe1c4
-    dw 0x0515, 0xa3d1, 0x012f, 0x8005
-    dw 0x0516, 0x4487, 0xe76f, 0xf035
-    dw 0x0517, 0xd176, 0x63fa, 0xf972
-    dw 0x0518, 0x55e4, 0x16ce, 0x3103
-    dw 0x0519, 0x443f, 0x6644, 0x6ea7
-    dw 0x051a, 0x8d75, 0xa043, 0x002f
-    dw 0x051b, 0x0538, 0xeeeb, 0xb883
-    dw 0x051c, 0x19e5, 0xc1d0, 0xa048
-    dw 0x051d, 0xd91c, 0xf955, 0x7c00
-    dw 0x051e, 0xc5e7, 0x83ff, 0x0de6
-    dw 0x051f, 0xd07e, 0xca21, 0x5ee2
-    dw 0x0520, 0x1ecb, 0x9c17, 0x81bd
-    dw 0x0521, 0x3cfd, 0x5947, 0x5a95
-    dw 0x0522, 0xc4e7, 0xe4f5, 0x6e13
-    dw 0x0523, 0x4525, 0xf6c4, 0xfc00
-    dw 0x0524, 0x88c6, 0x4655, 0x938e
-    dw 0x0525, 0x3b4b, 0x7035, 0x6fac
-    dw 0x0526, 0x17cb, 0x9f45, 0x80e3
-    dw 0x0527, 0xc619, 0x2e9a, 0xb908
-    dw 0x0528, 0x9be3, 0x0a58, 0x800d
-    dw 0x0529, 0x94de, 0x2959, 0x8341
-    dw 0x052a, 0xaa9b, 0x9a16, 0x0906
-    dw 0x052b, 0x1844, 0xc480, 0xa0cc
-    dw 0x052c, 0x5be7, 0xf161, 0xfc00
-    dw 0x052d, 0xbdd5, 0x21ce, 0xa43b
-    dw 0x052e, 0x7560, 0x8e53, 0xc840
-    dw 0x052f, 0xebef, 0x942c, 0x4423
-    dw 0x0530, 0x2a6a, 0x28ed, 0x17e6
-    dw 0x0531, 0xed73, 0xef52, 0x7c00
-    dw 0x0532, 0x0de2, 0x3298, 0x04d9
-    dw 0x0533, 0xe616, 0x96a8, 0x4110
-    dw 0x0534, 0x78ed, 0x2162, 0x5ea1
-    dw 0x0535, 0x06dd, 0x90b9, 0x8001
-    dw 0x0536, 0xc0a7, 0xccf7, 0x51c6
-    dw 0x0537, 0xbf53, 0x5c8b, 0xe029
-    dw 0x0538, 0xd74f, 0x5431, 0xefa9
-    dw 0x0539, 0x85e4, 0x81eb, 0x0000
-    dw 0x053a, 0xee47, 0x9e28, 0x50d5
-    dw 0x053b, 0x466b, 0x4a2e, 0x54f5
-    dw 0x053c, 0x8f89, 0x0441, 0x8001
-    dw 0x053d, 0x6bfc, 0x04ea, 0x34e8
-    dw 0x053e, 0x9294, 0x57ec, 0xae84
-    dw 0x053f, 0x9916, 0xbcff, 0x1a5a
-    dw 0x0540, 0x80d9, 0x8689, 0x0000
-    dw 0x0541, 0xac51, 0x8ebb, 0x01d1
-    dw 0x0542, 0xb921, 0x9267, 0x101b
-    dw 0x0543, 0x2563, 0x320f, 0x1c14
-    dw 0x0544, 0xb3c9, 0x2c40, 0xa423
-    dw 0x0545, 0xc2c8, 0x7471, 0xfb88
-    dw 0x0546, 0xf937, 0x821b, 0x3d7d
-    dw 0x0547, 0xd0fc, 0xd087, 0x65a4
-    dw 0x0548, 0xd64c, 0x56e0, 0xf169
-    dw 0x0549, 0x5272, 0xc493, 0xdb5f
-    dw 0x054a, 0xf508, 0x98dd, 0x521e
-    dw 0x054b, 0x0ec2, 0x8492, 0x8000
-    dw 0x054c, 0x9d1e, 0x7abe, 0xdc50
-    dw 0x054d, 0x897c, 0x2fb3, 0x8152
-    dw 0x054e, 0xd2aa, 0x2292, 0xb979
-    dw 0x054f, 0xecb2, 0x5383, 0xfc00
-    dw 0x0550, 0xa91b, 0x9903, 0x0666
-    dw 0x0551, 0xe23e, 0x623c, 0xfc00
-    dw 0x0552, 0x2b6a, 0x07a1, 0x0071
-    dw 0x0553, 0x944b, 0xdf34, 0x37bb
-    dw 0x0554, 0x33e2, 0x5713, 0x4ef8
-    dw 0x0555, 0x53a5, 0x2d19, 0x44df
-    dw 0x0556, 0xd92e, 0x24a1, 0xc1fe
-    dw 0x0557, 0xaf7a, 0x7b81, 0xef03
-    dw 0x0558, 0x5012, 0x740e, 0x7c00
-    dw 0x0559, 0x7089, 0xe8f0, 0xfc00
-    dw 0x055a, 0x82d0, 0xf51b, 0x3b2e
-    dw 0x055b, 0x860e, 0xb5c1, 0x022d
-    dw 0x055c, 0xd039, 0xa129, 0x3573
-    dw 0x055d, 0xa273, 0x23bc, 0x8a3c
-    dw 0x055e, 0x4a44, 0x3b76, 0x49d8
-    dw 0x055f, 0x05fb, 0xac81, 0x806c
-    dw 0x0560, 0x66e1, 0x0d9c, 0x38d3
-    dw 0x0561, 0x40cc, 0x4615, 0x4b4b
-    dw 0x0562, 0x417e, 0x97e0, 0x9d68
-    dw 0x0563, 0x99ba, 0x6e98, 0xccb8
-    dw 0x0564, 0x710e, 0xbe5b, 0xf404
-    dw 0x0565, 0x6c38, 0x2089, 0x50c8
-    dw 0x0566, 0x39dc, 0xbc4b, 0xba4a
-    dw 0x0567, 0x9497, 0xaa65, 0x03ab
-    dw 0x0568, 0xa53b, 0x1767, 0x826b
-    dw 0x0569, 0x9f81, 0x2b49, 0x8ed5
-    dw 0x056a, 0x14f5, 0x1e18, 0x0079
-    dw 0x056b, 0xe10b, 0xe52e, 0x7c00
-    dw 0x056c, 0xbf42, 0x837e, 0x0656
-    dw 0x056d, 0x08eb, 0x0986, 0x0000
-    dw 0x056e, 0xbef5, 0x0ee6, 0x9200
-    dw 0x056f, 0xb607, 0x25d6, 0xa066
-    dw 0x0570, 0x1c82, 0xf6d4, 0xd7b2
-    dw 0x0571, 0x6beb, 0x5e01, 0x7c00
-    dw 0x0572, 0x8eb4, 0x05a5, 0x8001
-    dw 0x0573, 0xcc99, 0xc400, 0x5499
-    dw 0x0574, 0x38d1, 0x204b, 0x1d2b
-    dw 0x0575, 0xf51c, 0xb4e2, 0x6e3d
-    dw 0x0576, 0xa841, 0x9a57, 0x06be
-    dw 0x0577, 0xcc49, 0x47c2, 0xd828
-    dw 0x0578, 0xc5a1, 0xe13f, 0x6b62
-    dw 0x0579, 0x65db, 0xa6ac, 0xd0e2
-    dw 0x057a, 0xc66d, 0x251d, 0xb01b
-    dw 0x057b, 0x2a2a, 0xcf58, 0xbda9
-    dw 0x057c, 0x2ea3, 0xe91f, 0xdc40
-    dw 0x057d, 0xde3e, 0xe4ab, 0x7c00
-    dw 0x057e, 0x0ef5, 0xfac1, 0xcde0
-    dw 0x057f, 0xdb7f, 0x7ae0, 0xfc00
-    dw 0x0580, 0x58c2, 0x6a33, 0x7c00
-    dw 0x0581, 0x8085, 0x255b, 0x8003
-    dw 0x0582, 0x69f5, 0x4485, 0x72bb
-    dw 0x0583, 0x5e2c, 0x8a41, 0xacd3
-    dw 0x0584, 0x4261, 0x5349, 0x59cf
-    dw 0x0585, 0x3f23, 0xeaa3, 0xedec
-    dw 0x0586, 0xeda0, 0x0b6d, 0xbd39
-    dw 0x0587, 0x3265, 0xb341, 0xa9cc
-    dw 0x0588, 0xecac, 0x9840, 0x48f7
-    dw 0x0589, 0x59ed, 0xb319, 0xd142
-    dw 0x058a, 0xbd5d, 0x8418, 0x057d
-    dw 0x058b, 0x8272, 0xec01, 0x30e5
-    dw 0x058c, 0x6d37, 0x60b0, 0x7c00
-    dw 0x058d, 0xd0ac, 0x5b71, 0xf058
-    dw 0x058e, 0xac2b, 0xf70d, 0x6759
-    dw 0x058f, 0xb433, 0x165e, 0x8eaf
-    dw 0x0590, 0x7793, 0xd98e, 0xfc00
-    dw 0x0591, 0x8053, 0xbc18, 0x0055
-    dw 0x0592, 0x37bb, 0x0a94, 0x065b
-    dw 0x0593, 0x8b04, 0x49b8, 0x9904
-    dw 0x0594, 0xe91d, 0x78a4, 0xfc00
-    dw 0x0595, 0x5525, 0x1b82, 0x34d4
-    dw 0x0596, 0x2be6, 0x41d1, 0x31be
-    dw 0x0597, 0xb3c3, 0x85d3, 0x016a
-    dw 0x0598, 0xf4ea, 0x7120, 0xfc00
-    dw 0x0599, 0x09eb, 0x775c, 0x4572
-    dw 0x059a, 0x5d21, 0x7723, 0x7c00
-    dw 0x059b, 0xd80d, 0x2dcd, 0xc9e0
-    dw 0x059c, 0xf350, 0x337e, 0xead9
-    dw 0x059d, 0xd9f8, 0xea5d, 0x7c00
-    dw 0x059e, 0xe7b2, 0xf056, 0x7c00
-    dw 0x059f, 0x61f0, 0xc140, 0xe7cb
-    dw 0x05a0, 0x70aa, 0x1e09, 0x5309
-    dw 0x05a1, 0xf8fb, 0x7b3e, 0xfc00
-    dw 0x05a2, 0x1c83, 0x83ff, 0x8005
-    dw 0x05a3, 0xc4f6, 0x05a0, 0x8efa
-    dw 0x05a4, 0x1a1b, 0x2122, 0x01f5
-    dw 0x05a5, 0x288a, 0x5bec, 0x487f
-    dw 0x05a6, 0xd4e5, 0xae5d, 0x47c9
-    dw 0x05a7, 0x50d7, 0x4606, 0x5b4a
-    dw 0x05a8, 0xb849, 0xc833, 0x4480
-    dw 0x05a9, 0xa327, 0x2f6c, 0x96a3
-    dw 0x05aa, 0xa040, 0xd0f5, 0x3544
-    dw 0x05ab, 0x22bc, 0xd3bf, 0xba85
-    dw 0x05ac, 0xaaed, 0x0d19, 0x811a
-    dw 0x05ad, 0xbb71, 0x9b44, 0x1ac2
-    dw 0x05ae, 0x6f0a, 0x0bee, 0x3efa
-    dw 0x05af, 0x8d13, 0x75ad, 0xc733
-    dw 0x05b0, 0x872c, 0xa996, 0x0050
-    dw 0x05b1, 0xf9ac, 0x4c23, 0xfc00
-    dw 0x05b2, 0xaf36, 0xf650, 0x69b1
-    dw 0x05b3, 0x663e, 0xd058, 0xfac7
-    dw 0x05b4, 0x1eda, 0xc22b, 0xa548
-    dw 0x05b5, 0xa53e, 0xcd38, 0x36d7
-    dw 0x05b6, 0x1302, 0xeb44, 0xc25d
-    dw 0x05b7, 0x8581, 0xdb35, 0x24f5
-    dw 0x05b8, 0x8e6b, 0xb4ed, 0x07e7
-    dw 0x05b9, 0x7b76, 0x5f60, 0x7c00
-    dw 0x05ba, 0xd7a9, 0x4f35, 0xeae7
-    dw 0x05bb, 0x0a4e, 0xe4c2, 0xb380
-    dw 0x05bc, 0x0aa6, 0xa592, 0x804a
-    dw 0x05bd, 0x53cc, 0x8757, 0x9f27
-    dw 0x05be, 0xb180, 0xe0df, 0x56b3
-    dw 0x05bf, 0x38ac, 0x8a75, 0x878b
-    dw 0x05c0, 0xf6b1, 0x84cf, 0x4006
-    dw 0x05c1, 0x39ab, 0xed01, 0xeb17
-    dw 0x05c2, 0xeb0e, 0x0a04, 0xb94e
-    dw 0x05c3, 0x0bdc, 0xad39, 0x8148
-    dw 0x05c4, 0xaf42, 0xd914, 0x4c9b
-    dw 0x05c5, 0xc03b, 0x9a86, 0x1ee6
-    dw 0x05c6, 0x5e95, 0x9b70, 0xbe1f
-    dw 0x05c7, 0x28f1, 0x1382, 0x0252
-    dw 0x05c8, 0x16e6, 0x8852, 0x8004
-    dw 0x05c9, 0xeb2b, 0x661b, 0xfc00
-    dw 0x05ca, 0x92a0, 0xcfed, 0x2690
-    dw 0x05cb, 0x70c1, 0x3832, 0x6cfc
-    dw 0x05cc, 0x23ba, 0xf819, 0xdfea
-    dw 0x05cd, 0xe9b2, 0x0499, 0xb28c
-    dw 0x05ce, 0xf51d, 0x225e, 0xdc12
-    dw 0x05cf, 0x8f0f, 0xebce, 0x3ee3
-    dw 0x05d0, 0xa72e, 0xc8ba, 0x343e
-    dw 0x05d1, 0xd8d0, 0x923c, 0x2f80
-    dw 0x05d2, 0xd2be, 0xe4ac, 0x7be0
-    dw 0x05d3, 0x3f75, 0x8200, 0x83ba
-    dw 0x05d4, 0xbdc0, 0x1c86, 0x9e81
-    dw 0x05d5, 0x1c55, 0x9b20, 0x80f7
-    dw 0x05d6, 0x4578, 0x2fd7, 0x395c
-    dw 0x05d7, 0xb207, 0xcdca, 0x445d
-    dw 0x05d8, 0x1b02, 0x1822, 0x0074
-    dw 0x05d9, 0x606a, 0xeaef, 0xfc00
-    dw 0x05da, 0x88e4, 0x989c, 0x0006
-    dw 0x05db, 0x0ea9, 0x80fd, 0x8000
-    dw 0x05dc, 0x824e, 0x1343, 0x8001
-    dw 0x05dd, 0x761a, 0xa4ac, 0xdf20
-    dw 0x05de, 0xa252, 0x61e9, 0xc8ab
-    dw 0x05df, 0x4bda, 0x6b0c, 0x7aeb
-    dw 0x05e0, 0x3ab9, 0xde16, 0xdd1d
-    dw 0x05e1, 0x3dcb, 0x1f65, 0x215b
-    dw 0x05e2, 0x1d8b, 0xbfcb, 0xa166
-    dw 0x05e3, 0xdd25, 0x1d3b, 0xbeba
-    dw 0x05e4, 0xdc52, 0xf97a, 0x7c00
-    dw 0x05e5, 0xb85c, 0x21ca, 0x9e4f
-    dw 0x05e6, 0x2951, 0x6a63, 0x583f
-    dw 0x05e7, 0xef94, 0x4453, 0xf819
-    dw 0x05e8, 0x8285, 0x4ffe, 0x9509
-    dw 0x05e9, 0x2f42, 0x0b69, 0x01ae
-    dw 0x05ea, 0xe89a, 0x3dec, 0xead0
-    dw 0x05eb, 0x8c66, 0x6ae8, 0xbb98
-    dw 0x05ec, 0x512f, 0x0281, 0x167d
-    dw 0x05ed, 0x0f94, 0xf381, 0xc71c
-    dw 0x05ee, 0x646a, 0x5b6f, 0x7c00
-    dw 0x05ef, 0x5e8d, 0x9f23, 0xc1d8
-    dw 0x05f0, 0x3985, 0x9c58, 0x99fe
-    dw 0x05f1, 0xbe88, 0x5711, 0xd9c5
-    dw 0x05f2, 0x5c24, 0x9bad, 0xbbf2
-    dw 0x05f3, 0x744c, 0x3876, 0x70cb
-    dw 0x05f4, 0x9527, 0x2ca8, 0x85ff
-    dw 0x05f5, 0x5a40, 0xbe78, 0xdd0e
-    dw 0x05f6, 0x970b, 0x49d4, 0xa522
-    dw 0x05f7, 0x02cb, 0x1991, 0x0002
-    dw 0x05f8, 0x99d2, 0x320d, 0x9067
-    dw 0x05f9, 0x24fa, 0x826c, 0x800c
-    dw 0x05fa, 0x6ff9, 0xb161, 0xe55c
-    dw 0x05fb, 0xed54, 0xc128, 0x72de
-    dw 0x05fc, 0xb3e2, 0xb4a9, 0x2c98
-    dw 0x05fd, 0x184c, 0x5857, 0x34a9
-    dw 0x05fe, 0x1337, 0xb76f, 0x8eb4
-    dw 0x05ff, 0x91dd, 0xaf8f, 0x058a
-    dw 0x0600, 0x75f7, 0xe8ee, 0xfc00
-    dw 0x0601, 0x0bb3, 0x11a4, 0x0003
-    dw 0x0602, 0x5d3a, 0x4429, 0x6570
-    dw 0x0603, 0xa6cb, 0x89e3, 0x0050
-    dw 0x0604, 0x9e69, 0x6543, 0xc837
-    dw 0x0605, 0x20ee, 0xe83d, 0xcd39
-    dw 0x0606, 0x680e, 0x3a7f, 0x6696
-    dw 0x0607, 0x820f, 0x9a1b, 0x0002
-    dw 0x0608, 0x5f7a, 0x047b, 0x2830
-    dw 0x0609, 0x0a15, 0x10db, 0x0002
-    dw 0x060a, 0xf1cf, 0xcb3d, 0x7c00
-    dw 0x060b, 0xc4bd, 0xeeb8, 0x77f5
-    dw 0x060c, 0xdd09, 0x470f, 0xe871
-    dw 0x060d, 0x931e, 0x9478, 0x0010
-    dw 0x060e, 0xd8ec, 0x42ad, 0xe01b
-    dw 0x060f, 0x0a6f, 0xc1da, 0x90b5
-    dw 0x0610, 0x4e61, 0x1c13, 0x2e7f
-    dw 0x0611, 0x1f15, 0x928a, 0x805d
-    dw 0x0612, 0xc2de, 0xa8f8, 0x3044
-    dw 0x0613, 0x30f4, 0x2821, 0x1d1d
-    dw 0x0614, 0xc9e6, 0x1931, 0xa7a8
-    dw 0x0615, 0x902f, 0x0466, 0x8001
-    dw 0x0616, 0x9b41, 0x2a4a, 0x89b4
-    dw 0x0617, 0x63e0, 0x9fbc, 0xc79d
-    dw 0x0618, 0x345f, 0x74bb, 0x6d2b
-    dw 0x0619, 0x918c, 0x3978, 0x8f95
-    dw 0x061a, 0x8044, 0x1681, 0x8000
-    dw 0x061b, 0xc753, 0x12a2, 0x9e13
-    dw 0x061c, 0xaaf9, 0xa040, 0x0f69
-    dw 0x061d, 0x554f, 0xb568, 0xcf2d
-    dw 0x061e, 0x621a, 0xa3b0, 0xc9dd
-    dw 0x061f, 0xd17b, 0x812f, 0x127d
-    dw 0x0620, 0x363b, 0x9459, 0x8ec6
-    dw 0x0621, 0x2a27, 0x672f, 0x5586
-    dw 0x0622, 0xbc7a, 0xf40e, 0x748a
-    dw 0x0623, 0x8060, 0x4ca9, 0x86fe
-    dw 0x0624, 0xf874, 0x1ba1, 0xd83f
-    dw 0x0625, 0x76f3, 0x5c54, 0x7c00
-    dw 0x0626, 0xbb5e, 0xab53, 0x2abf
-    dw 0x0627, 0xd10f, 0x4cea, 0xe237
-    dw 0x0628, 0xaaf0, 0x0a87, 0x80b5
-    dw 0x0629, 0xcd2e, 0x2a74, 0xbc2e
-    dw 0x062a, 0x2108, 0x9481, 0x80b5
-    dw 0x062b, 0x3d16, 0xcc01, 0xcd17
-    dw 0x062c, 0x34c1, 0x9265, 0x8b9a
-    dw 0x062d, 0x8169, 0x96dc, 0x0001
-    dw 0x062e, 0x3616, 0x52e4, 0x4d3e
-    dw 0x062f, 0x180b, 0x6c51, 0x485d
-    dw 0x0630, 0xe73d, 0x4233, 0xed9c
-    dw 0x0631, 0xd380, 0xa3b7, 0x3b3c
-    dw 0x0632, 0x3641, 0x53e0, 0x4e28
-    dw 0x0633, 0xf060, 0x2eb5, 0xe356
-    dw 0x0634, 0x6f82, 0x6753, 0x7c00
-    dw 0x0635, 0x8b09, 0x2ae0, 0x80c1
-    dw 0x0636, 0x12a6, 0x5c18, 0x32ce
-    dw 0x0637, 0x77ca, 0xbd96, 0xf970
-    dw 0x0638, 0x669f, 0x44f8, 0x701d
-    dw 0x0639, 0xe80a, 0x87a7, 0x33ba
-    dw 0x063a, 0xd979, 0x2520, 0xc303
-    dw 0x063b, 0x53a8, 0x0e3b, 0x25f6
-    dw 0x063c, 0xb786, 0xd511, 0x50c4
-    dw 0x063d, 0xa517, 0xed9c, 0x5723
-    dw 0x063e, 0x27f5, 0xbd22, 0xa91b
-    dw 0x063f, 0x59ed, 0x0f32, 0x2d54
-    dw 0x0640, 0x2d6d, 0xb2e9, 0xa4b0
-    dw 0x0641, 0x3596, 0x814d, 0x8074
-    dw 0x0642, 0xa349, 0x644b, 0xcbd2
-    dw 0x0643, 0xf0cf, 0x0a9c, 0xbff2
-    dw 0x0644, 0xef54, 0x1baf, 0xcf0a
-    dw 0x0645, 0x1d43, 0x4b6c, 0x2ce2
-    dw 0x0646, 0x9379, 0xdad9, 0x3265
-    dw 0x0647, 0xb20b, 0xd871, 0x4eb6
-    dw 0x0648, 0xc2e4, 0x39b2, 0xc0e8
-    dw 0x0649, 0xb1eb, 0xe804, 0x5df1
-    dw 0x064a, 0x8d5a, 0xc026, 0x118d
-    dw 0x064b, 0x9f8a, 0x626b, 0xc60c
-    dw 0x064c, 0x653d, 0x8d26, 0xb6be
-    dw 0x064d, 0x8a60, 0x225f, 0x8029
-    dw 0x064e, 0xe713, 0x9992, 0x44ed
-    dw 0x064f, 0x21b5, 0x1480, 0x00cd
-    dw 0x0650, 0x4c7b, 0x574b, 0x6816
-    dw 0x0651, 0x95ce, 0xefc4, 0x49a2
-    dw 0x0652, 0xbb97, 0x869d, 0x0646
-    dw 0x0653, 0xfa61, 0xaaeb, 0x6984
-    dw 0x0654, 0xa24d, 0x17a4, 0x8181
-    dw 0x0655, 0xf658, 0x35c6, 0xf094
-    dw 0x0656, 0xf27d, 0xa863, 0x5f1e
-    dw 0x0657, 0x0e38, 0xb561, 0x882e
-    dw 0x0658, 0xe216, 0xc023, 0x664b
-    dw 0x0659, 0x9d66, 0x6f70, 0xd105
-    dw 0x065a, 0x8049, 0x3cf0, 0x805a
-    dw 0x065b, 0xd1dc, 0xe586, 0x7c00
-    dw 0x065c, 0xca17, 0x5c3c, 0xea72
-    dw 0x065d, 0x07e5, 0xb12a, 0x8146
-    dw 0x065e, 0xf5cf, 0x299a, 0xe411
-    dw 0x065f, 0xc5ab, 0x424a, 0xcc75
-    dw 0x0660, 0x80e6, 0x5b79, 0x9ab7
-    dw 0x0661, 0x320f, 0x3c7d, 0x32cc
-    dw 0x0662, 0xe216, 0x2c70, 0xd2c0
-    dw 0x0663, 0xe768, 0x8463, 0x3010
-    dw 0x0664, 0x4414, 0xddc0, 0xe5dd
-    dw 0x0665, 0xba2a, 0x3691, 0xb50f
-    dw 0x0666, 0x8624, 0xc862, 0x12ba
-    dw 0x0667, 0xebf3, 0x683a, 0xfc00
-    dw 0x0668, 0x8885, 0x8959, 0x0000
-    dw 0x0669, 0xd7aa, 0x08ce, 0xa49a
-    dw 0x066a, 0xc649, 0xa986, 0x3457
-    dw 0x066b, 0xee54, 0x9060, 0x42ec
-    dw 0x066c, 0x05c3, 0xf639, 0xc07b
-    dw 0x066d, 0x418b, 0xfb92, 0xfc00
-    dw 0x066e, 0x1fd4, 0x0736, 0x000e
-    dw 0x066f, 0x3ddc, 0xa0ba, 0xa2ec
-    dw 0x0670, 0x62af, 0x6feb, 0x7c00
-    dw 0x0671, 0xdd37, 0x44c5, 0xe638
-    dw 0x0672, 0x9c5b, 0xc49f, 0x2508
-    dw 0x0673, 0xc929, 0xe06f, 0x6db8
-    dw 0x0674, 0xa260, 0x8353, 0x000b
-    dw 0x0675, 0x1701, 0x2884, 0x03f4
-    dw 0x0676, 0x4bb5, 0x02f4, 0x11b1
-    dw 0x0677, 0x90be, 0xd43a, 0x2903
-    dw 0x0678, 0x8c4d, 0x6868, 0xb8bd
-    dw 0x0679, 0xdd08, 0x5296, 0xf424
-    dw 0x067a, 0x11ef, 0xcb5c, 0xa175
-    dw 0x067b, 0xe2f7, 0x17b2, 0xbeb3
-    dw 0x067c, 0xc195, 0x2482, 0xaa4a
-    dw 0x067d, 0x1344, 0xe169, 0xb8ea
-    dw 0x067e, 0x2bb8, 0x5120, 0x40f2
-    dw 0x067f, 0x8223, 0x8e67, 0x0000
-    dw 0x0680, 0xc10c, 0x5f5a, 0xe4a3
-    dw 0x0681, 0xd32c, 0x5d67, 0xf4d8
-    dw 0x0682, 0x23fa, 0x9c55, 0x8452
-    dw 0x0683, 0x3dd7, 0xc65a, 0xc8a3
-    dw 0x0684, 0x1fa8, 0x54d8, 0x38a3
-    dw 0x0685, 0xeede, 0x6b5d, 0xfc00
-    dw 0x0686, 0x57cc, 0x3f97, 0x5b66
-    dw 0x0687, 0xe419, 0xe804, 0x7c00
-    dw 0x0688, 0x1c9f, 0x36af, 0x17b9
-    dw 0x0689, 0xf9f3, 0xe7fb, 0x7c00
-    dw 0x068a, 0x19a6, 0x11a5, 0x0020
-    dw 0x068b, 0xa991, 0x3e28, 0xac49
-    dw 0x068c, 0x24e9, 0x8afa, 0x8045
-    dw 0x068d, 0x69e0, 0x760a, 0x7c00
-    dw 0x068e, 0x0d1e, 0xf847, 0xc979
-    dw 0x068f, 0x3716, 0x6c78, 0x67eb
-    dw 0x0690, 0xcb74, 0x947d, 0x242e
-    dw 0x0691, 0x9072, 0x67c9, 0xbc53
-    dw 0x0692, 0xd254, 0x56cc, 0xed60
-    dw 0x0693, 0x8772, 0x272c, 0x8035
-    dw 0x0694, 0x45aa, 0xf2cf, 0xfc00
-    dw 0x0695, 0xc546, 0x3267, 0xbc38
-    dw 0x0696, 0x6311, 0xad4b, 0xd4ad
-    dw 0x0697, 0x4f06, 0x99c1, 0xad0d
-    dw 0x0698, 0xa73e, 0x3702, 0xa258
-    dw 0x0699, 0xb367, 0xb8e4, 0x3086
-    dw 0x069a, 0xe093, 0xf190, 0x7c00
-    dw 0x069b, 0xddcd, 0x6b8d, 0xfc00
-    dw 0x069c, 0x5b70, 0x53d7, 0x734a
-    dw 0x069d, 0x78ab, 0x53b8, 0x7c00
-    dw 0x069e, 0x8aed, 0xe524, 0x3473
-    dw 0x069f, 0x1f2c, 0x1f6b, 0x0353
-    dw 0x06a0, 0x7596, 0x86f5, 0xc0dc
-    dw 0x06a1, 0xf1bf, 0xcc63, 0x7c00
-    dw 0x06a2, 0x0e67, 0x18ec, 0x0010
-    dw 0x06a3, 0x120d, 0x0137, 0x0000
-    dw 0x06a4, 0x97e4, 0xd754, 0x333a
-    dw 0x06a5, 0x339e, 0xfaf6, 0xf2a1
-    dw 0x06a6, 0x849f, 0x82a4, 0x0000
-    dw 0x06a7, 0x94b7, 0x2bdd, 0x84a2
-    dw 0x06a8, 0xb9a6, 0x481e, 0xc5d0
-    dw 0x06a9, 0xe4c1, 0x9a39, 0x4365
-    dw 0x06aa, 0x39ae, 0xc28f, 0xc0a8
-    dw 0x06ab, 0x05c7, 0x951f, 0x8002
-    dw 0x06ac, 0x1666, 0xe8d7, 0xc3be
-    dw 0x06ad, 0xa154, 0x6396, 0xc90d
-    dw 0x06ae, 0x0803, 0xc0bf, 0x8cc3
-    dw 0x06af, 0xd92d, 0x8ef8, 0x2c82
-    dw 0x06b0, 0xb27e, 0xa590, 0x1c84
-    dw 0x06b1, 0x9d60, 0xcb6a, 0x2cfb
-    dw 0x06b2, 0xb79d, 0x9e97, 0x1a45
-    dw 0x06b3, 0x634f, 0x8ef1, 0xb657
-    dw 0x06b4, 0xd235, 0x5e45, 0xf4dd
-    dw 0x06b5, 0x1390, 0x54d9, 0x2c95
-    dw 0x06b6, 0xf2fc, 0x3f6e, 0xf67d
-    dw 0x06b7, 0x0e80, 0x3b1a, 0x0dc5
-    dw 0x06b8, 0x242f, 0xa8b9, 0x90f0
-    dw 0x06b9, 0x74c9, 0xe6be, 0xfc00
-    dw 0x06ba, 0xae80, 0x09e8, 0x8133
-    dw 0x06bb, 0x2cf3, 0xf2bf, 0xe42c
-    dw 0x06bc, 0x9e79, 0x9089, 0x003b
-    dw 0x06bd, 0xfac2, 0x5f38, 0xfc00
-    dw 0x06be, 0x69b6, 0x89ba, 0xb817
-    dw 0x06bf, 0x11b6, 0x0f46, 0x0005
-    dw 0x06c0, 0x271a, 0xdd21, 0xc88e
-    dw 0x06c1, 0xc6e4, 0xc5b1, 0x50e7
-    dw 0x06c2, 0x4070, 0x55d5, 0x5a78
-    dw 0x06c3, 0x97e6, 0x9eb5, 0x00d4
-    dw 0x06c4, 0x6966, 0xecc0, 0xfc00
-    dw 0x06c5, 0x91b1, 0xa8d4, 0x01b8
-    dw 0x06c6, 0xfb40, 0xcccb, 0x7c00
-    dw 0x06c7, 0xcd03, 0xa3f9, 0x34ff
-    dw 0x06c8, 0x4194, 0xb3c2, 0xb969
-    dw 0x06c9, 0x527a, 0x4b7c, 0x620f
-    dw 0x06ca, 0xb0e7, 0x3e3b, 0xb3a3
-    dw 0x06cb, 0x4f60, 0x0ff6, 0x2357
-    dw 0x06cc, 0x38fd, 0xae98, 0xac1d
-    dw 0x06cd, 0x79ad, 0xc2b8, 0xfc00
-    dw 0x06ce, 0xc04e, 0x88f3, 0x0d54
-    dw 0x06cf, 0xe9d2, 0x9d6f, 0x4be8
-    dw 0x06d0, 0x4fd7, 0xaf84, 0xc35d
-    dw 0x06d1, 0xdddf, 0xa5ad, 0x482a
-    dw 0x06d2, 0x476a, 0x0f13, 0x1a8e
-    dw 0x06d3, 0x342a, 0x0e45, 0x0687
-    dw 0x06d4, 0xb7e7, 0x2f6a, 0xab53
-    dw 0x06d5, 0xdb11, 0x84ea, 0x2457
-    dw 0x06d6, 0xd364, 0x1ca5, 0xb44a
-    dw 0x06d7, 0x38ac, 0x25de, 0x22da
-    dw 0x06d8, 0x6822, 0xe993, 0xfc00
-    dw 0x06d9, 0xa54b, 0xa65d, 0x1036
-    dw 0x06da, 0x38f3, 0xb541, 0xb280
-    dw 0x06db, 0xdf5b, 0xe78b, 0x7c00
-    dw 0x06dc, 0x2eee, 0xa213, 0x9543
-    dw 0x06dd, 0xa7da, 0xb7e2, 0x23bd
-    dw 0x06de, 0x8be5, 0x4549, 0x9537
-    dw 0x06df, 0x07b9, 0x3b69, 0x0727
-    dw 0x06e0, 0x2329, 0xad66, 0x94d5
-    dw 0x06e1, 0x82d4, 0x9fbd, 0x0005
-    dw 0x06e2, 0xbc79, 0xb6fe, 0x37d2
-    dw 0x06e3, 0xae03, 0x7460, 0xe693
-    dw 0x06e4, 0xe669, 0x8914, 0x3412
-    dw 0x06e5, 0xf94b, 0xb9cd, 0x77ad
-    dw 0x06e6, 0xa5b9, 0x31f7, 0x9c44
-    dw 0x06e7, 0xdfab, 0x0ddb, 0xb19d
-    dw 0x06e8, 0x1b8b, 0x84f6, 0x8005
-    dw 0x06e9, 0xb439, 0x547e, 0xccbe
-    dw 0x06ea, 0x3a37, 0x9394, 0x91e3
-    dw 0x06eb, 0x3c0a, 0x6926, 0x6933
-    dw 0x06ec, 0x35a7, 0xe3e4, 0xdd93
-    dw 0x06ed, 0x2108, 0xc18c, 0xa6fa
-    dw 0x06ee, 0x292d, 0x28c1, 0x1627
-    dw 0x06ef, 0x4c56, 0xd628, 0xe6ac
-    dw 0x06f0, 0xec14, 0x92a1, 0x42c2
-    dw 0x06f1, 0x36c8, 0x9a17, 0x9529
-    dw 0x06f2, 0x0702, 0x1d31, 0x0009
-    dw 0x06f3, 0x232b, 0x004d, 0x0001
-    dw 0x06f4, 0xd6fe, 0xc8e4, 0x6446
-    dw 0x06f5, 0x3244, 0xb6a9, 0xad37
-    dw 0x06f6, 0xd6c0, 0x4dcf, 0xe8e7
-    dw 0x06f7, 0x3b9f, 0x8af9, 0x8aa4
-    dw 0x06f8, 0xa24e, 0x75d7, 0xdc9a
-    dw 0x06f9, 0x1e8d, 0xde58, 0xc132
-    dw 0x06fa, 0xdefd, 0x5434, 0xf758
-    dw 0x06fb, 0xc23c, 0x0005, 0x8010
-    dw 0x06fc, 0x15c0, 0xeb69, 0xc553
-    dw 0x06fd, 0x28c6, 0x12b6, 0x0201
-    dw 0x06fe, 0x37c0, 0x9280, 0x8e4c
-    dw 0x06ff, 0x23d4, 0x9190, 0x80ae
-    dw 0x0700, 0xc949, 0xbdeb, 0x4bd2
-    dw 0x0701, 0x9892, 0xe67a, 0x4366
-    dw 0x0702, 0xe116, 0x98df, 0x3e32
-    dw 0x0703, 0xbd79, 0xa9fa, 0x2c17
-    dw 0x0704, 0xcb23, 0x7422, 0xfc00
-    dw 0x0705, 0x80ba, 0x18f3, 0x8000
-    dw 0x0706, 0xafc2, 0x0bb3, 0x81de
-    dw 0x0707, 0xbb41, 0x2599, 0xa513
-    dw 0x0708, 0x2a40, 0x9999, 0x8860
-    dw 0x0709, 0x0496, 0x5bd5, 0x247d
-    dw 0x070a, 0x049b, 0x9435, 0x8001
-    dw 0x070b, 0x473e, 0x2d61, 0x38df
-    dw 0x070c, 0xa6eb, 0x2c50, 0x9775
-    dw 0x070d, 0x396c, 0xa2d2, 0xa09f
-    dw 0x070e, 0xbde0, 0x02b5, 0x83fa
-    dw 0x070f, 0x60bd, 0x5672, 0x7ba3
-    dw 0x0710, 0xe92f, 0x41d3, 0xef8c
-    dw 0x0711, 0xef51, 0xa6a8, 0x5a16
-    dw 0x0712, 0xebce, 0xba74, 0x6a4c
-    dw 0x0713, 0x1acb, 0x6c88, 0x4bb2
-    dw 0x0714, 0xd367, 0xca8d, 0x6210
-    dw 0x0715, 0x783c, 0x8ea8, 0xcb0c
-    dw 0x0716, 0xf026, 0xa27c, 0x56ba
-    dw 0x0717, 0x2841, 0xf4bc, 0xe109
-    dw 0x0718, 0x20f1, 0x8416, 0x800a
-    dw 0x0719, 0xf957, 0xb526, 0x72df
-    dw 0x071a, 0xcb55, 0x26b8, 0xb628
-    dw 0x071b, 0x5c11, 0x4a53, 0x6a6e
-    dw 0x071c, 0x5308, 0x957d, 0xacd3
-    dw 0x071d, 0xed26, 0x10e8, 0xc251
-    dw 0x071e, 0x9832, 0x4de3, 0xaa2d
-    dw 0x071f, 0x675a, 0x8162, 0xa915
-    dw 0x0720, 0x8fb7, 0x56ab, 0xaa6e
-    dw 0x0721, 0x280a, 0x7b85, 0x6798
-    dw 0x0722, 0x1120, 0x42d5, 0x1860
-    dw 0x0723, 0xe80d, 0xe487, 0x7c00
-    dw 0x0724, 0x0d62, 0x6049, 0x31c4
-    dw 0x0725, 0x7330, 0x02c6, 0x38fc
-    dw 0x0726, 0x9b71, 0xf244, 0x51d4
-    dw 0x0727, 0x23b7, 0x1f88, 0x0743
-    dw 0x0728, 0xeb9b, 0xd8dd, 0x7c00
-    dw 0x0729, 0xeadd, 0x1254, 0xc16e
-    dw 0x072a, 0x34ee, 0x3530, 0x2e65
-    dw 0x072b, 0x655c, 0xca6c, 0xf44d
-    dw 0x072c, 0x2256, 0x7645, 0x5cf7
-    dw 0x072d, 0x629e, 0x703a, 0x7c00
-    dw 0x072e, 0xdd9f, 0xe400, 0x7c00
-    dw 0x072f, 0x344b, 0x0c0b, 0x0457
-    dw 0x0730, 0x7b76, 0x456b, 0x7c00
-    dw 0x0731, 0x4ee0, 0x6383, 0x7675
-    dw 0x0732, 0x29f2, 0x5c43, 0x4a56
-    dw 0x0733, 0xc3cd, 0x9d22, 0x2501
-    dw 0x0734, 0x59cb, 0xc693, 0xe4c3
-    dw 0x0735, 0x3894, 0x4c10, 0x48a6
-    dw 0x0736, 0xea4a, 0x581c, 0xfc00
-    dw 0x0737, 0x37ab, 0xc327, 0xbedb
-    dw 0x0738, 0x42f9, 0x49ff, 0x513a
-    dw 0x0739, 0xf815, 0x7829, 0xfc00
-    dw 0x073a, 0xaf5c, 0xc281, 0x35fc
-    dw 0x073b, 0x9a80, 0x25a1, 0x8493
-    dw 0x073c, 0x2520, 0x0aba, 0x0045
-    dw 0x073d, 0x0340, 0x0920, 0x0000
-    dw 0x073e, 0x0aab, 0x378b, 0x0649
-    dw 0x073f, 0x152b, 0x8621, 0x8002
-    dw 0x0740, 0x640c, 0xe9a4, 0xfc00
-    dw 0x0741, 0xa6e9, 0xc04f, 0x2b71
-    dw 0x0742, 0xad71, 0x440b, 0xb580
-    dw 0x0743, 0x1a1a, 0x7404, 0x5220
-    dw 0x0744, 0x662a, 0x5e4e, 0x7c00
-    dw 0x0745, 0xd4bb, 0x9dd6, 0x36e7
-    dw 0x0746, 0x2175, 0x17b4, 0x0150
-    dw 0x0747, 0xe7d5, 0x198b, 0xc56d
-    dw 0x0748, 0x8fde, 0x9731, 0x000e
-    dw 0x0749, 0xdc0c, 0x2a5e, 0xca71
-    dw 0x074a, 0xbcd2, 0x012c, 0x816a
-    dw 0x074b, 0x3518, 0xc013, 0xb930
-    dw 0x074c, 0x0a4d, 0x3fc3, 0x0e1d
-    dw 0x074d, 0xf79e, 0x1f78, 0xdb1d
-    dw 0x074e, 0xc5e4, 0x7495, 0xfc00
-    dw 0x074f, 0x8384, 0xaf88, 0x006a
-    dw 0x0750, 0x1b7e, 0x43d3, 0x2354
-    dw 0x0751, 0x5cfa, 0x5f89, 0x7c00
-    dw 0x0752, 0x5dee, 0xd0fe, 0xf367
-    dw 0x0753, 0xdc29, 0xc418, 0x6442
-    dw 0x0754, 0x2f4d, 0xb0e4, 0xa477
-    dw 0x0755, 0x61ee, 0x50c2, 0x770e
-    dw 0x0756, 0xc899, 0x49c4, 0xd6a1
-    dw 0x0757, 0x6a4d, 0x5877, 0x7c00
-    dw 0x0758, 0xe0f5, 0x465a, 0xebdf
-    dw 0x0759, 0x82d5, 0x9dc8, 0x0004
-    dw 0x075a, 0x4786, 0xb7ed, 0xc374
-    dw 0x075b, 0x5ddb, 0x51d3, 0x7443
-    dw 0x075c, 0xf7b0, 0x5579, 0xfc00
-    dw 0x075d, 0x714c, 0xbd94, 0xf363
-    dw 0x075e, 0xca0e, 0xf4d0, 0x7c00
-    dw 0x075f, 0x6d1c, 0xe58c, 0xfc00
-    dw 0x0760, 0x38a4, 0xca16, 0xc710
-    dw 0x0761, 0x4516, 0x9692, 0xa02d
-    dw 0x0762, 0x9b15, 0x213f, 0x8252
-    dw 0x0763, 0x5aaa, 0xca62, 0xe951
-    dw 0x0764, 0xd223, 0xbc99, 0x530e
-    dw 0x0765, 0x1b24, 0x9abc, 0x80c0
-    dw 0x0766, 0x065d, 0x8572, 0x8000
-    dw 0x0767, 0xf333, 0xe752, 0x7c00
-    dw 0x0768, 0xcbcc, 0x7608, 0xfc00
-    dw 0x0769, 0x851a, 0x1352, 0x8001
-    dw 0x076a, 0x2df5, 0xe2f5, 0xd52e
-    dw 0x076b, 0x6526, 0x25a5, 0x4f44
-    dw 0x076c, 0x386f, 0xd672, 0xd325
-    dw 0x076d, 0xe339, 0x027d, 0xa87e
-    dw 0x076e, 0xcb42, 0x5056, 0xdfde
-    dw 0x076f, 0xe80a, 0x03e6, 0xafdf
-    dw 0x0770, 0x1a6c, 0x2d20, 0x0c1d
-    dw 0x0771, 0x9a78, 0xb581, 0x1473
-    dw 0x0772, 0x4e5f, 0xf523, 0xfc00
-    dw 0x0773, 0x2082, 0xb1bc, 0x9676
-    dw 0x0774, 0x9b08, 0xbb3f, 0x1a5e
-    dw 0x0775, 0xb819, 0x207a, 0x9c96
-    dw 0x0776, 0xae72, 0x9f6b, 0x11fa
-    dw 0x0777, 0xec46, 0x247b, 0xd4c9
-    dw 0x0778, 0x2486, 0x5270, 0x3b48
-    dw 0x0779, 0x077b, 0x64be, 0x306f
-    dw 0x077a, 0x7816, 0x3fea, 0x7c00
-    dw 0x077b, 0x3b30, 0x5b4f, 0x5a91
-    dw 0x077c, 0x4268, 0x0673, 0x0d2a
-    dw 0x077d, 0xaba5, 0x2a72, 0x9a29
-    dw 0x077e, 0x0a59, 0xc612, 0x94d1
-    dw 0x077f, 0x5792, 0xa4d2, 0xc090
-    dw 0x0780, 0x7b93, 0xa5f1, 0xe5a0
-    dw 0x0781, 0x99f5, 0xfb77, 0x598f
-    dw 0x0782, 0xc673, 0x4bb1, 0xd633
-    dw 0x0783, 0x967f, 0x81b2, 0x0001
-    dw 0x0784, 0x03ca, 0xb6f9, 0x81a7
-    dw 0x0785, 0x3025, 0xa335, 0x9778
-    dw 0x0786, 0xa33f, 0x54a0, 0xbc30
-    dw 0x0787, 0xc7bb, 0xa2d7, 0x2e9c
-    dw 0x0788, 0xa710, 0xcf37, 0x3a5f
-    dw 0x0789, 0x0796, 0x1f26, 0x000e
-    dw 0x078a, 0x0f21, 0x42c6, 0x1609
-    dw 0x078b, 0x7a76, 0x5189, 0x7c00
-    dw 0x078c, 0x4939, 0x261b, 0x33f9
-    dw 0x078d, 0x7bfb, 0x5393, 0x7c00
-    dw 0x078e, 0xec2d, 0xd38d, 0x7c00
-    dw 0x078f, 0xf865, 0x67c1, 0xfc00
-    dw 0x0790, 0x797e, 0x925a, 0xd05c
-    dw 0x0791, 0x6338, 0x3ff2, 0x672b
-    dw 0x0792, 0xde0b, 0xf9b7, 0x7c00
-    dw 0x0793, 0xc1a4, 0xe1d5, 0x681d
-    dw 0x0794, 0xb0b0, 0xf1c9, 0x66c8
-    dw 0x0795, 0x850a, 0x53ef, 0x9cff
-    dw 0x0796, 0x4669, 0x4cc6, 0x57a6
-    dw 0x0797, 0xf6c6, 0xed7a, 0x7c00
-    dw 0x0798, 0x1bfd, 0x0ca0, 0x0012
-    dw 0x0799, 0x2b1e, 0x4123, 0x3092
-    dw 0x079a, 0x8716, 0x8a5c, 0x0000
-    dw 0x079b, 0xad32, 0xf8a3, 0x6a06
-    dw 0x079c, 0xddef, 0x995f, 0x3bf8
-    dw 0x079d, 0xcc31, 0xd654, 0x66a2
-    dw 0x079e, 0x0120, 0x45af, 0x0665
-    dw 0x079f, 0x68ae, 0x6458, 0x7c00
-    dw 0x07a0, 0x85a1, 0x46b9, 0x90bb
-    dw 0x07a1, 0x5e0f, 0x4746, 0x6982
-    dw 0x07a2, 0x288e, 0x0ebf, 0x00f6
-    dw 0x07a3, 0x390f, 0xad99, 0xab14
-    dw 0x07a4, 0x62ae, 0xfa5f, 0xfc00
-    dw 0x07a5, 0x5975, 0x6cf3, 0x7c00
-    dw 0x07a6, 0x165c, 0x57d1, 0x3237
-    dw 0x07a7, 0x7993, 0x417a, 0x7c00
-    dw 0x07a8, 0x98f4, 0x00aa, 0x8000
-    dw 0x07a9, 0xbe22, 0x2351, 0xa59c
-    dw 0x07aa, 0xaddc, 0xb6c6, 0x28f6
-    dw 0x07ab, 0x0140, 0x473b, 0x0885
-    dw 0x07ac, 0x82f7, 0xd795, 0x1d9f
-    dw 0x07ad, 0x485c, 0xc8a6, 0xd511
-    dw 0x07ae, 0x4043, 0xacb4, 0xb103
-    dw 0x07af, 0x4e48, 0x86fd, 0x997d
-    dw 0x07b0, 0x0ac4, 0x958e, 0x8005
-    dw 0x07b1, 0xaf8b, 0x1983, 0x8d32
-    dw 0x07b2, 0xce9d, 0x5d24, 0xf040
-    dw 0x07b3, 0x4e16, 0x5783, 0x69b7
-    dw 0x07b4, 0xd5a7, 0xbb09, 0x54f8
-    dw 0x07b5, 0x6ddf, 0x2d78, 0x6003
-    dw 0x07b6, 0x349d, 0xaf5a, 0xa83d
-    dw 0x07b7, 0xc66d, 0x3547, 0xc03d
-    dw 0x07b8, 0x6d7c, 0xe9be, 0xfc00
-    dw 0x07b9, 0xe323, 0x2442, 0xcb99
-    dw 0x07ba, 0xeafe, 0x2a5e, 0xd991
-    dw 0x07bb, 0xa739, 0xc293, 0x2def
-    dw 0x07bc, 0x72ba, 0x6fe0, 0x7c00
-    dw 0x07bd, 0x02d7, 0x1f6f, 0x0005
-    dw 0x07be, 0xbe28, 0x89d4, 0x0c7c
-    dw 0x07bf, 0x2a33, 0x53b6, 0x41fa
-    dw 0x07c0, 0x395f, 0x43b6, 0x412d
-    dw 0x07c1, 0x2253, 0x9684, 0x814a
-    dw 0x07c2, 0xbfe8, 0x706a, 0xf45d
-    dw 0x07c3, 0xee07, 0x958f, 0x4830
-    dw 0x07c4, 0x2b73, 0x5be7, 0x4b5c
-    dw 0x07c5, 0xc308, 0x6010, 0xe724
-    dw 0x07c6, 0x0b41, 0x8975, 0x8001
-    dw 0x07c7, 0x9557, 0x78bd, 0xd253
-    dw 0x07c8, 0x7333, 0x787a, 0x7c00
-    dw 0x07c9, 0x9d00, 0x5e31, 0xbfbd
-    dw 0x07ca, 0xa2d9, 0x4439, 0xab3b
-    dw 0x07cb, 0x20c5, 0x1593, 0x00d5
-    dw 0x07cc, 0xb419, 0x239c, 0x9bcc
-    dw 0x07cd, 0x3502, 0x7241, 0x6bd4
-    dw 0x07ce, 0xad70, 0x5f35, 0xd0e6
-    dw 0x07cf, 0xc5f7, 0xe6cf, 0x7114
+    ; Uniform random values
+    dw 0x02a4, 0xd039, 0x777b, 0xfc00
+    dw 0x02a5, 0xf0bf, 0x780e, 0xfc00
+    dw 0x02a6, 0x973f, 0x1c44, 0x807c
+    dw 0x02a7, 0xc43d, 0x5d3e, 0xe58e
+    dw 0x02a8, 0xd615, 0xfa30, 0x7c00
+    dw 0x02a9, 0x2b1e, 0x9c9a, 0x8c18
+    dw 0x02aa, 0xc5ca, 0x25fe, 0xb056
+    dw 0x02ab, 0xc07a, 0xdc78, 0x6100
+    dw 0x02ac, 0x4380, 0x7b1b, 0x7c00
+    dw 0x02ad, 0x30dc, 0x6905, 0x5e19
+    dw 0x02ae, 0x6d0a, 0x68c2, 0x7c00
+    dw 0x02af, 0xb242, 0x87b4, 0x0182
+    dw 0x02b0, 0xd7a7, 0x0514, 0xa0dc
+    dw 0x02b1, 0x1b9a, 0x4d1f, 0x2cde
+    dw 0x02b2, 0xa6c7, 0xee79, 0x597c
+    dw 0x02b3, 0xdaa9, 0x03e9, 0xa283
+    dw 0x02b4, 0x677b, 0x5a65, 0x7c00
+    dw 0x02b5, 0x36ca, 0xf6fe, 0xf1ef
+    dw 0x02b6, 0xc1d0, 0x6ac0, 0xf0e8
+    dw 0x02b7, 0xa8ba, 0xa115, 0x0e01
+    dw 0x02b8, 0xef70, 0xec0e, 0x7c00
+    dw 0x02b9, 0xb6f9, 0xa364, 0x1e71
+    dw 0x02ba, 0x4e3b, 0xd8ff, 0xebc8
+    dw 0x02bb, 0xbc10, 0xab27, 0x2b44
+    dw 0x02bc, 0x25f9, 0x7201, 0x5c7b
+    dw 0x02bd, 0xc68d, 0x8616, 0x10fc
+    dw 0x02be, 0x9d34, 0x62e2, 0xc47a
+    dw 0x02bf, 0xf98d, 0x2550, 0xe35f
+    dw 0x02c0, 0xbb0d, 0x8a52, 0x0992
+    dw 0x02c1, 0x0266, 0x9752, 0x8001
+    dw 0x02c2, 0x4a0b, 0x8ec2, 0x9d1b
+    dw 0x02c3, 0x98bf, 0x2cd4, 0x89bb
+    dw 0x02c4, 0x2ee3, 0x29df, 0x1d0e
+    dw 0x02c5, 0xc021, 0xd6be, 0x5af6
+    dw 0x02c6, 0xadf6, 0xcd47, 0x3fdd
+    dw 0x02c7, 0xc95b, 0x5bcb, 0xe938
+    dw 0x02c8, 0x21d2, 0x31b4, 0x1826
+    dw 0x02c9, 0xc04c, 0xd951, 0x5db6
+    dw 0x02ca, 0xba25, 0x1c8c, 0x9afc
+    dw 0x02cb, 0xf6a3, 0xfae6, 0x7c00
+    dw 0x02cc, 0x0dfb, 0x843b, 0x8000
+    dw 0x02cd, 0xa7f5, 0x0906, 0x8050
+    dw 0x02ce, 0x52ac, 0xad8a, 0xc49f
+    dw 0x02cf, 0xea7f, 0x26c0, 0xd57b
+    dw 0x02d0, 0xb63e, 0x9b65, 0x15c5
+    dw 0x02d1, 0x3b1a, 0xdf6d, 0xde98
+    dw 0x02d2, 0x4e6d, 0xdb97, 0xee19
+    dw 0x02d3, 0xd1c7, 0xd190, 0x6804
+    dw 0x02d4, 0xd350, 0x4516, 0xdca6
+    dw 0x02d5, 0x6fc3, 0xcb92, 0xfc00
+    dw 0x02d6, 0xdcc5, 0xcdaa, 0x6ec1
+    dw 0x02d7, 0x981f, 0xb0c3, 0x0ce8
+    dw 0x02d8, 0xd80a, 0x6e00, 0xfc00
+    dw 0x02d9, 0xccb5, 0x7bf5, 0xfc00
+    dw 0x02da, 0xd8d0, 0xbf09, 0x5c3b
+    dw 0x02db, 0xc83d, 0xde82, 0x6ae5
+    dw 0x02dc, 0xf881, 0x32c4, 0xef9e
+    dw 0x02dd, 0x0196, 0x7241, 0x34f6
+    dw 0x02de, 0x82be, 0x30b4, 0x8067
+    dw 0x02df, 0x5229, 0xf8e7, 0xfc00
+    dw 0x02e0, 0x01ac, 0x39a0, 0x012d
+    dw 0x02e1, 0xbe86, 0xed0f, 0x7020
+    dw 0x02e2, 0x0f81, 0x075f, 0x0001
+    dw 0x02e3, 0x14e3, 0x9183, 0x800d
+    dw 0x02e4, 0x5865, 0x4974, 0x65fe
+    dw 0x02e5, 0x355f, 0xc62b, 0xc024
+    dw 0x02e6, 0x6c68, 0x5ea0, 0x7c00
+    dw 0x02e7, 0x3142, 0xb0da, 0xa661
+    dw 0x02e8, 0xe56d, 0x0589, 0xaf82
+    dw 0x02e9, 0xa7a2, 0x6e66, 0xda1b
+    dw 0x02ea, 0xca4e, 0x4999, 0xd869
+    dw 0x02eb, 0x91d6, 0xe785, 0x3d7c
+    dw 0x02ec, 0x25c4, 0xef18, 0xd91d
+    dw 0x02ed, 0x09d0, 0xb04c, 0x8190
+    dw 0x02ee, 0x77cb, 0x459d, 0x7c00
+    dw 0x02ef, 0x802e, 0x9a65, 0x0000
+    dw 0x02f0, 0xbae5, 0x8646, 0x0568
+    dw 0x02f1, 0xb786, 0xd9f8, 0x559d
+    dw 0x02f2, 0x20bf, 0x5580, 0x3a87
+    dw 0x02f3, 0x8318, 0xeeca, 0x3540
+    dw 0x02f4, 0x56ea, 0xbc21, 0xd723
+    dw 0x02f5, 0xb27d, 0xa701, 0x1dae
+    dw 0x02f6, 0x09ac, 0x0b97, 0x0001
+    dw 0x02f7, 0x6e7a, 0xd3c8, 0xfc00
+    dw 0x02f8, 0xe884, 0xc780, 0x743c
+    dw 0x02f9, 0x75a3, 0x6088, 0x7c00
+    dw 0x02fa, 0xbf9f, 0x2b1c, 0xaec6
+    dw 0x02fb, 0x57e6, 0x77b2, 0x7c00
+    dw 0x02fc, 0xa062, 0xc3ca, 0x2844
+    dw 0x02fd, 0xe6de, 0x14a1, 0xbff2
+    dw 0x02fe, 0x9bfb, 0xfb0d, 0x5b09
+    dw 0x02ff, 0xd66f, 0xc71e, 0x61b9
+    dw 0x0300, 0xf34b, 0x8c46, 0x43cb
+    dw 0x0301, 0x5bea, 0xbce4, 0xdcd7
+    dw 0x0302, 0x69f0, 0x685f, 0x7c00
+    dw 0x0303, 0xa718, 0x46e7, 0xb21f
+    dw 0x0304, 0x3d09, 0x1f32, 0x2087
+    dw 0x0305, 0x14b6, 0x0c34, 0x0005
+    dw 0x0306, 0x4afe, 0xd8a0, 0xe80b
+    dw 0x0307, 0x9ced, 0x7095, 0xd1a4
+    dw 0x0308, 0x82a4, 0x52df, 0x9889
+    dw 0x0309, 0xe0a7, 0x02c8, 0xa678
+    dw 0x030a, 0x7be8, 0x0f5a, 0x4f44
+    dw 0x030b, 0x1db1, 0x5f8c, 0x415e
+    dw 0x030c, 0x2f23, 0x6de8, 0x6145
+    dw 0x030d, 0xea65, 0xf783, 0x7c00
+    dw 0x030e, 0x2e0a, 0x4500, 0x378c
+    dw 0x030f, 0xf0ef, 0xface, 0x7c00
+    dw 0x0310, 0xb682, 0x4729, 0xc1d3
+    dw 0x0311, 0x5454, 0x4d4c, 0x65bb
+    dw 0x0312, 0xed97, 0x5e2c, 0xfc00
+    dw 0x0313, 0x088c, 0x0165, 0x0000
+    dw 0x0314, 0xc633, 0xd9c8, 0x647b
+    dw 0x0315, 0x4889, 0x12ed, 0x1fda
+    dw 0x0316, 0xdb33, 0xc49d, 0x6427
+    dw 0x0317, 0x1a13, 0x8dc1, 0x8011
+    dw 0x0318, 0xcc95, 0xd576, 0x6641
+    dw 0x0319, 0x69f4, 0x0cd7, 0x3b34
+    dw 0x031a, 0x8404, 0x82c7, 0x0000
+    dw 0x031b, 0xce3f, 0x473c, 0xd9a6
+    dw 0x031c, 0x2a8c, 0x91b1, 0x8254
+    dw 0x031d, 0x11d8, 0x232e, 0x00a8
+    dw 0x031e, 0x95cd, 0x09b2, 0x8004
+    dw 0x031f, 0x5425, 0x76dc, 0x7c00
+    dw 0x0320, 0x658c, 0xb392, 0xdd40
+    dw 0x0321, 0x7786, 0x0182, 0x39ac
+    dw 0x0322, 0x0625, 0x252f, 0x0020
+    dw 0x0323, 0xd6f4, 0x89d1, 0x250e
+    dw 0x0324, 0x384c, 0x3fc4, 0x3c2c
+    dw 0x0325, 0x545e, 0xeffd, 0xfc00
+    dw 0x0326, 0xf4a2, 0xc01d, 0x78c4
+    dw 0x0327, 0x2297, 0xeb19, 0xd1d9
+    dw 0x0328, 0xa738, 0x5fde, 0xcb19
+    dw 0x0329, 0x31d7, 0x0ee9, 0x050b
+    dw 0x032a, 0x41e5, 0x9e08, 0xa472
+    dw 0x032b, 0x60d3, 0x4ace, 0x701a
+    dw 0x032c, 0x605e, 0x6954, 0x7c00
+    dw 0x032d, 0xe447, 0x6ec2, 0xfc00
+    dw 0x032e, 0x1e90, 0xb4db, 0x97f7
+    dw 0x032f, 0x6163, 0x2e67, 0x5450
+    dw 0x0330, 0x80fe, 0xafc1, 0x001f
+    dw 0x0331, 0xf2bd, 0xc5de, 0x7c00
+    dw 0x0332, 0xb5fb, 0x3152, 0xabf4
+    dw 0x0333, 0xe0f3, 0xde2e, 0x7c00
+    dw 0x0334, 0x452d, 0x2a8f, 0x343e
+    dw 0x0335, 0x1384, 0x9b1f, 0x8036
+    dw 0x0336, 0xf1fd, 0xf4f1, 0x7c00
+    dw 0x0337, 0xd9a4, 0xbca4, 0x5a8b
+    dw 0x0338, 0x7777, 0x9684, 0xd214
+    dw 0x0339, 0xae0f, 0xca29, 0x3caa
+    dw 0x033a, 0xa178, 0x4cc2, 0xb281
+    dw 0x033b, 0x8149, 0x28a2, 0x800c
+    dw 0x033c, 0x4d42, 0x8fdf, 0xa12c
+    dw 0x033d, 0x6882, 0x9119, 0xbdbf
+    dw 0x033e, 0x0617, 0x227a, 0x0014
+    dw 0x033f, 0x861e, 0xd756, 0x219c
+    dw 0x0340, 0x3621, 0xcbe0, 0xc608
+    dw 0x0341, 0x795e, 0x57a8, 0x7c00
+    dw 0x0342, 0xf04c, 0xab48, 0x5fd2
+    dw 0x0343, 0x209a, 0xd5c2, 0xbaa0
+    dw 0x0344, 0x18dd, 0xdd7e, 0xbaad
+    dw 0x0345, 0xe942, 0x22cb, 0xd077
+    dw 0x0346, 0x8383, 0x96c2, 0x0001
+    dw 0x0347, 0x0911, 0x5e49, 0x2bf6
+    dw 0x0348, 0x3a5a, 0x3269, 0x3117
+    dw 0x0349, 0x55f1, 0xfa17, 0xfc00
+    dw 0x034a, 0x2241, 0xf972, 0xe042
+    dw 0x034b, 0xa251, 0x4483, 0xab20
+    dw 0x034c, 0xc90d, 0x91ad, 0x1f2b
+    dw 0x034d, 0x75ad, 0x568a, 0x7c00
+    dw 0x034e, 0xed7f, 0xd25f, 0x7c00
+    dw 0x034f, 0x6f9c, 0x2095, 0x545c
+    dw 0x0350, 0xe8f6, 0xbe75, 0x6c01
+    dw 0x0351, 0x5be1, 0x73a3, 0x7c00
+    dw 0x0352, 0xa694, 0xcade, 0x35a6
+    dw 0x0353, 0x9742, 0x71ce, 0xcd44
+    dw 0x0354, 0x05a8, 0x04cb, 0x0000
+    dw 0x0355, 0xda99, 0x5dab, 0xfc00
+    dw 0x0356, 0x80b3, 0xa204, 0x0002
+    dw 0x0357, 0x5a46, 0xba82, 0xd91a
+    dw 0x0358, 0x6edf, 0xf482, 0xfc00
+    dw 0x0359, 0xbb0d, 0x3244, 0xb186
+    dw 0x035a, 0xa12a, 0x1909, 0x81a0
+    dw 0x035b, 0x61d2, 0xb304, 0xd91b
+    dw 0x035c, 0x8b66, 0xa6ec, 0x0066
+    dw 0x035d, 0x90b9, 0x1055, 0x8005
+    dw 0x035e, 0x58cb, 0xa9b5, 0xc6d7
+    dw 0x035f, 0x19ae, 0xca64, 0xa889
+    dw 0x0360, 0xe6c5, 0x47e7, 0xf2b0
+    dw 0x0361, 0x2be6, 0x634f, 0x5337
+    dw 0x0362, 0xc485, 0xa028, 0x28b2
+    dw 0x0363, 0x4c04, 0x92fc, 0xa303
+    dw 0x0364, 0xf2bb, 0x05b2, 0xbccb
+    dw 0x0365, 0x4fa0, 0x2e2d, 0x41e3
+    dw 0x0366, 0x304b, 0x8feb, 0x8440
+    dw 0x0367, 0x743b, 0xb167, 0xe9b7
+    dw 0x0368, 0x5afc, 0xa663, 0xc593
+    dw 0x0369, 0x3959, 0x7645, 0x7431
+    dw 0x036a, 0x9b93, 0x1a6e, 0x80c3
+    dw 0x036b, 0x96c7, 0xe22f, 0x3d3d
+    dw 0x036c, 0x7429, 0xa63a, 0xde7a
+    dw 0x036d, 0x6ec5, 0x8ce3, 0xc023
+    dw 0x036e, 0xd2a5, 0xb21e, 0x4915
+    dw 0x036f, 0x2dbb, 0xf756, 0xe941
+    dw 0x0370, 0x0d11, 0x0c08, 0x0001
+    dw 0x0371, 0x19e3, 0x0d58, 0x0010
+    dw 0x0372, 0x0cf5, 0xdc69, 0xad77
+    dw 0x0373, 0x2696, 0x282d, 0x12e0
+    dw 0x0374, 0x32f3, 0x279d, 0x1e9d
+    dw 0x0375, 0xfb64, 0x560b, 0xfc00
+    dw 0x0376, 0x5c82, 0xbba5, 0xdc4f
+    dw 0x0377, 0x3107, 0xe3d8, 0xd8ee
+    dw 0x0378, 0xab11, 0x62f5, 0xd225
+    dw 0x0379, 0x3dd2, 0x188b, 0x1a9c
+    dw 0x037a, 0x71b7, 0xf6b6, 0xfc00
+    dw 0x037b, 0xb149, 0x0b80, 0x827a
+    dw 0x037c, 0xbb69, 0x1f96, 0x9f07
+    dw 0x037d, 0xe0a1, 0x4ec8, 0xf3d9
+    dw 0x037e, 0x8cf2, 0x36ec, 0x8847
+    dw 0x037f, 0x9c3f, 0x3b9f, 0x9c0c
+    dw 0x0380, 0x491e, 0x28ad, 0x35fb
+    dw 0x0381, 0x24fa, 0x3bfc, 0x24f8
+    dw 0x0382, 0x59f8, 0xb417, 0xd21a
+    dw 0x0383, 0xad2b, 0x965c, 0x081c
+    dw 0x0384, 0x00e1, 0x174c, 0x0000
+    dw 0x0385, 0xbcbf, 0xe2f9, 0x6423
+    dw 0x0386, 0xae08, 0x2f87, 0xa1ad
+    dw 0x0387, 0x67f2, 0xb6cd, 0xe2c1
+    dw 0x0388, 0xe055, 0x822b, 0x24b2
+    dw 0x0389, 0x763c, 0xee2d, 0xfc00
+    dw 0x038a, 0x0718, 0x5471, 0x1fe0
+    dw 0x038b, 0xe7e1, 0x27f4, 0xd3d5
+    dw 0x038c, 0x997d, 0x1c1c, 0x80b4
+    dw 0x038d, 0x587e, 0x0967, 0x2611
+    dw 0x038e, 0x3a6d, 0xc464, 0xc30e
+    dw 0x038f, 0xbba3, 0x9fbd, 0x1f63
+    dw 0x0390, 0x6142, 0xedab, 0xfc00
+    dw 0x0391, 0x2b20, 0x2154, 0x10bf
+    dw 0x0392, 0x08c3, 0x453c, 0x123b
+    dw 0x0393, 0x2182, 0x40d8, 0x26ab
+    dw 0x0394, 0x2eb1, 0x8a75, 0x815a
+    dw 0x0395, 0x4f17, 0x6087, 0x7403
+    dw 0x0396, 0x2186, 0x93b2, 0x80aa
+    dw 0x0397, 0x5efe, 0xa0ac, 0xc415
+    dw 0x0398, 0x858c, 0x376f, 0x8294
+    dw 0x0399, 0x590e, 0x0fa6, 0x2cd5
+    dw 0x039a, 0x75cb, 0x697c, 0x7c00
+    dw 0x039b, 0x2694, 0xda23, 0xc50c
+    dw 0x039c, 0xbc44, 0x6525, 0xe57c
+    dw 0x039d, 0x6480, 0xe6fb, 0xfc00
+    dw 0x039e, 0x1400, 0xc93b, 0xa13b
+    dw 0x039f, 0x3d92, 0x0c1e, 0x0dbc
+    dw 0x03a0, 0x302b, 0xe3bf, 0xd809
+    dw 0x03a1, 0x3f04, 0x520b, 0x554d
+    dw 0x03a2, 0x1081, 0xa636, 0x80e0
+    dw 0x03a3, 0xb91f, 0x95ff, 0x13ad
+    dw 0x03a4, 0xb7cf, 0x1609, 0x91e4
+    dw 0x03a5, 0x450e, 0xe60e, 0xefa7
+    dw 0x03a6, 0x9f15, 0x6ca8, 0xd01f
+    dw 0x03a7, 0x68bd, 0x09f0, 0x3709
+    dw 0x03a8, 0xb43c, 0xce4b, 0x46a9
+    dw 0x03a9, 0xb6f0, 0xbe72, 0x3997
+    dw 0x03aa, 0x656e, 0xca3e, 0xf43d
+    dw 0x03ab, 0x8836, 0xb98a, 0x05d5
+    dw 0x03ac, 0x8033, 0x138d, 0x8000
+    dw 0x03ad, 0xa8c7, 0x4c37, 0xb909
+    dw 0x03ae, 0x35ad, 0x52b5, 0x4cc2
+    dw 0x03af, 0x5b33, 0x6c7a, 0x7c00
+    dw 0x03b0, 0x03bc, 0xe1e7, 0xa983
+    dw 0x03b1, 0x65b1, 0x493e, 0x7375
+    dw 0x03b2, 0x2413, 0x0476, 0x0012
+    dw 0x03b3, 0x9e33, 0x3ed8, 0xa14e
+    dw 0x03b4, 0x122c, 0x016f, 0x0000
+    dw 0x03b5, 0xe7d0, 0xa5d9, 0x51b6
+    dw 0x03b6, 0x81e2, 0xbdca, 0x02ba
+    dw 0x03b7, 0x26ff, 0xaa23, 0x955e
+    dw 0x03b8, 0xc045, 0xc5c4, 0x4a27
+    dw 0x03b9, 0xe53c, 0xe776, 0x7c00
+    dw 0x03ba, 0xdb15, 0x246a, 0xc3d1
+    dw 0x03bb, 0xa067, 0xe13f, 0x45c6
+    dw 0x03bc, 0x27ee, 0xe8a5, 0xd49b
+    dw 0x03bd, 0x5dba, 0x21c2, 0x441f
+    dw 0x03be, 0x6681, 0x05b4, 0x30a3
+    dw 0x03bf, 0x88bb, 0xd89c, 0x2573
+    dw 0x03c0, 0x26f7, 0x5f88, 0x4a8f
+    dw 0x03c1, 0xdcb8, 0xc828, 0x68e7
+    dw 0x03c2, 0xd416, 0xadb4, 0x45d3
+    dw 0x03c3, 0xb9ec, 0xb08f, 0x2ec0
+    dw 0x03c4, 0x9402, 0x60dd, 0xb8df
+    dw 0x03c5, 0x6c29, 0xca9b, 0xfadf
+    dw 0x03c6, 0xabf8, 0x0e07, 0x8180
+    dw 0x03c7, 0xb229, 0xb72e, 0x2d87
+    dw 0x03c8, 0x7b5f, 0xd550, 0xfc00
+    dw 0x03c9, 0xca7b, 0x4ec8, 0xdd7e
+    dw 0x03ca, 0x562a, 0x6090, 0x7b08
+    dw 0x03cb, 0x5e69, 0x084d, 0x2ae4
+    dw 0x03cc, 0x343a, 0x2449, 0x1c87
+    dw 0x03cd, 0xd726, 0xf935, 0x7c00
+    dw 0x03ce, 0xccfc, 0xc3f7, 0x54f6
+    dw 0x03cf, 0xa195, 0xe207, 0x4835
+    dw 0x03d0, 0xeb8a, 0xb112, 0x60c7
+    dw 0x03d1, 0xb0af, 0xa54c, 0x1a34
+    dw 0x03d2, 0xc2ef, 0xd26d, 0x5992
+    dw 0x03d3, 0x9302, 0x3c0c, 0x9317
+    dw 0x03d4, 0x5b7e, 0x3fc2, 0x5f44
+    dw 0x03d5, 0xe6ad, 0x95e1, 0x40e8
+    dw 0x03d6, 0x6869, 0xb8eb, 0xe56c
+    dw 0x03d7, 0x6c4a, 0x3723, 0x67a7
+    dw 0x03d8, 0x10d2, 0x5557, 0x2a6f
+    dw 0x03d9, 0xce0d, 0x29dc, 0xbc6f
+    dw 0x03da, 0x18b4, 0x1435, 0x0028
+    dw 0x03db, 0x27a1, 0xc32a, 0xaed5
+    dw 0x03dc, 0x0d47, 0x29c5, 0x00f4
+    dw 0x03dd, 0x92fe, 0xaa62, 0x02ca
+    dw 0x03de, 0x7421, 0xe692, 0xfc00
+    dw 0x03df, 0x945d, 0x9d3e, 0x005b
+    dw 0x03e0, 0x82b2, 0x6626, 0xac25
+    dw 0x03e1, 0xb8cd, 0x3f1c, 0xbc44
+    dw 0x03e2, 0x0eca, 0x04e8, 0x0001
+    dw 0x03e3, 0xb4da, 0xd4bc, 0x4dbe
+    dw 0x03e4, 0xe41e, 0x32cf, 0xdb02
+    dw 0x03e5, 0x9e33, 0x5fa7, 0xc1ee
+    dw 0x03e6, 0x6576, 0x2ca4, 0x5656
+    dw 0x03e7, 0x169c, 0x559a, 0x30a1
+    dw 0x03e8, 0xdba9, 0xd87e, 0x784d
+    dw 0x03e9, 0x520f, 0x907b, 0xa6c9
+    dw 0x03ea, 0x6658, 0xe720, 0xfc00
+    dw 0x03eb, 0x406c, 0x0dba, 0x1255
+    dw 0x03ec, 0xaf95, 0x7019, 0xe3c4
+    dw 0x03ed, 0xe20d, 0x2e0f, 0xd495
+    dw 0x03ee, 0x18f7, 0xf6ff, 0xd458
+
+    ; Results near the exponent boundaries
+    dw 0x03ef, 0x6f61, 0x49a1, 0x7c00
+    dw 0x03f0, 0xa655, 0xf90e, 0x6400
+    dw 0x03f1, 0x3b70, 0x09c2, 0x095a
+    dw 0x03f2, 0xdd9b, 0x579d, 0xf956
+    dw 0x03f3, 0x30d8, 0xfb80, 0xf08a
+    dw 0x03f4, 0x29bd, 0x9e5b, 0x8c8f
+    dw 0x03f5, 0x4ffa, 0x6806, 0x7c00
+    dw 0x03f6, 0xc7c2, 0x822d, 0x0c38
+    dw 0x03f7, 0xf61b, 0xbcd5, 0x7760
+    dw 0x03f8, 0xd6c7, 0xddbb, 0x78db
+    dw 0x03f9, 0x275c, 0xf873, 0xe418
+    dw 0x03fa, 0x3f54, 0x0265, 0x0463
+    dw 0x03fb, 0x6174, 0x00e0, 0x20c6
+    dw 0x03fc, 0x37ea, 0x78a6, 0x7499
+    dw 0x03fd, 0x92c7, 0x3329, 0x8a11
+    dw 0x03fe, 0x13fb, 0x320e, 0x0a0a
+    dw 0x03ff, 0xb800, 0x8a41, 0x0641
+    dw 0x0400, 0xb907, 0x84b5, 0x02f5
+    dw 0x0401, 0xabc5, 0x1f18, 0x8ee4
+    dw 0x0402, 0x57de, 0x82f8, 0x9dd7
+    dw 0x0403, 0x4027, 0x0193, 0x0345
+    dw 0x0404, 0x6c29, 0xcd5e, 0xfc00
+    dw 0x0405, 0x404c, 0x7a68, 0x7c00
+    dw 0x0406, 0x1506, 0xa520, 0x819c
+    dw 0x0407, 0xaa87, 0x1762, 0x8606
+    dw 0x0408, 0xec8f, 0xc5ff, 0x76d5
+    dw 0x0409, 0xa55e, 0xf853, 0x61cd
+    dw 0x040a, 0xbadc, 0x8719, 0x0616
+    dw 0x040b, 0xa452, 0x1d87, 0x85f8
+    dw 0x040c, 0xd618, 0xe077, 0x7acd
+    dw 0x040d, 0x2cbb, 0x7b9c, 0x6c80
+    dw 0x040e, 0xf3c3, 0x40dd, 0xf8b8
+    dw 0x040f, 0xe746, 0x8281, 0x2c8e
+    dw 0x0410, 0x6fc6, 0x00fd, 0x2faf
+    dw 0x0411, 0xd03f, 0x0060, 0x8a5e
+    dw 0x0412, 0xea99, 0x02e3, 0xb0c3
+    dw 0x0413, 0xc055, 0x004d, 0x80a7
+    dw 0x0414, 0xd801, 0x5cce, 0xf8cf
+    dw 0x0415, 0x1abd, 0xfbd9, 0xda9c
+    dw 0x0416, 0x6f2a, 0x44c4, 0x7845
+    dw 0x0417, 0x7a76, 0x82ac, 0xc051
+    dw 0x0418, 0x46be, 0x6c2e, 0x770c
+    dw 0x0419, 0x4205, 0x81f2, 0x85db
+    dw 0x041a, 0x84d8, 0xf877, 0x4168
+    dw 0x041b, 0xe482, 0xce44, 0x7710
+    dw 0x041c, 0x0490, 0x7a32, 0x4311
+    dw 0x041d, 0x9160, 0xae74, 0x0456
+    dw 0x041e, 0xbb6e, 0x8821, 0x07ab
+    dw 0x041f, 0x4b70, 0xeea6, 0xfc00
+    dw 0x0420, 0xe613, 0x80f0, 0x25b2
+    dw 0x0421, 0xf8d0, 0xba1b, 0x7758
+    dw 0x0422, 0xb9ad, 0x8abc, 0x08c7
+    dw 0x0423, 0x4aa2, 0x834f, 0x917c
+    dw 0x0424, 0x93b0, 0x799d, 0xd165
+    dw 0x0425, 0x6781, 0x009e, 0x24a2
+    dw 0x0426, 0xc119, 0x7b6e, 0xfc00
+    dw 0x0427, 0x3483, 0x7ac3, 0x73a0
+    dw 0x0428, 0xb520, 0x85bd, 0x01d7
+    dw 0x0429, 0x115c, 0x7bfd, 0x515a
+    dw 0x042a, 0x901e, 0xf995, 0x4dbf
+    dw 0x042b, 0x3115, 0x95d3, 0x8b66
+    dw 0x042c, 0x29e2, 0x18be, 0x06f9
+    dw 0x042d, 0x9bf8, 0xa189, 0x02c2
+    dw 0x042e, 0x554e, 0x800a, 0x8351
+    dw 0x042f, 0xde17, 0x823c, 0x22ce
+    dw 0x0430, 0x5305, 0xe3a2, 0xfab3
+    dw 0x0431, 0x196e, 0xfbaa, 0xd934
+    dw 0x0432, 0x1520, 0x31e5, 0x0b8d
+    dw 0x0433, 0x3ba1, 0x0de0, 0x0d9a
+    dw 0x0434, 0x8693, 0x7945, 0xc455
+    dw 0x0435, 0x433f, 0x0228, 0x07d0
+    dw 0x0436, 0x7629, 0x833d, 0xbcfd
+    dw 0x0437, 0x97f5, 0xfaaf, 0x56a6
+    dw 0x0438, 0x6f09, 0x82f4, 0xb532
+    dw 0x0439, 0xe400, 0x8169, 0x25a4
+    dw 0x043a, 0x8f88, 0xb992, 0x0d3e
+    dw 0x043b, 0xdfc4, 0x0016, 0x9157
+    dw 0x043c, 0xbc62, 0xfa78, 0x7b16
+    dw 0x043d, 0x3a57, 0x849c, 0x83a7
+    dw 0x043e, 0x1d84, 0xfaf7, 0xdccd
+    dw 0x043f, 0x7869, 0x0136, 0x3957
+    dw 0x0440, 0xeda4, 0x002b, 0xa394
+    dw 0x0441, 0xa749, 0x1490, 0x8214
+    dw 0x0442, 0x90a8, 0x78e0, 0xcdad
+    dw 0x0443, 0x3734, 0x120f, 0x0d75
+    dw 0x0444, 0xa9e1, 0x78e4, 0xe730
+    dw 0x0445, 0xb3a6, 0xf981, 0x7143
+    dw 0x0446, 0x1b0a, 0xa879, 0x87df
+    dw 0x0447, 0x43c0, 0x8032, 0x80c2
+    dw 0x0448, 0x37e4, 0x89ce, 0x85ba
+    dw 0x0449, 0x0b6a, 0x3c5c, 0x0c0a
+    dw 0x044a, 0x1cf8, 0x2193, 0x0376
+    dw 0x044b, 0x586d, 0x0170, 0x1a5d
+    dw 0x044c, 0x0942, 0x3d8d, 0x0b4c
+    dw 0x044d, 0xbc5f, 0xf559, 0x75d8
+    dw 0x044e, 0x0613, 0xf858, 0xc299
+    dw 0x044f, 0x2721, 0x7a4b, 0x659c
+    dw 0x0450, 0x8fe8, 0x2e05, 0x82f9
+    dw 0x0451, 0x4db0, 0x6eee, 0x7c00
+    dw 0x0452, 0xc162, 0xf5f6, 0x7c00
+    dw 0x0453, 0x30b3, 0xface, 0xefff
+    dw 0x0454, 0xa5dd, 0x7846, 0xe244
+    dw 0x0455, 0xc70b, 0x036f, 0x8e0c
+    dw 0x0456, 0x3f0d, 0x815e, 0x8269
+    dw 0x0457, 0x6612, 0x83a5, 0xad88
+    dw 0x0458, 0xcea3, 0xeb36, 0x7c00
+    dw 0x0459, 0x600e, 0x0380, 0x2718
+    dw 0x045a, 0x34ba, 0x0dc2, 0x06ce
+    dw 0x045b, 0x8803, 0xb02b, 0x010c
+    dw 0x045c, 0x11de, 0xf82b, 0xce1d
+    dw 0x045d, 0x9b46, 0xa402, 0x03a5
+    dw 0x045e, 0x0d06, 0xaebb, 0x821d
+    dw 0x045f, 0xd4c0, 0x8047, 0x0d45
+    dw 0x0460, 0xf4a3, 0x80d1, 0x3392
+    dw 0x0461, 0x3de6, 0xf8f3, 0xfb4c
+    dw 0x0462, 0x1bdb, 0xf988, 0xd96e
+    dw 0x0463, 0x5e96, 0x8236, 0xa348
+    dw 0x0464, 0xae8c, 0xfb89, 0x6e2b
+    dw 0x0465, 0x075c, 0xfad8, 0xc64c
+    dw 0x0466, 0x9c5a, 0xa314, 0x03da
+    dw 0x0467, 0x6270, 0x5177, 0x7866
+    dw 0x0468, 0xd631, 0x60cf, 0xfb71
+    dw 0x0469, 0xd734, 0x8298, 0x1cac
+    dw 0x046a, 0x77b5, 0xc6e5, 0xfc00
+    dw 0x046b, 0x133e, 0xfb92, 0xd2da
+    dw 0x046c, 0xb026, 0x9674, 0x0ab1
+    dw 0x046d, 0x060c, 0x36d9, 0x0297
+    dw 0x046e, 0x596c, 0x5e21, 0x7c00
+    dw 0x046f, 0x16b0, 0xb04d, 0x8b31
+    dw 0x0470, 0xc129, 0x01b9, 0x8472
+    dw 0x0471, 0x4e5f, 0x81dd, 0x91f0
+    dw 0x0472, 0x3876, 0xfaae, 0xf773
+    dw 0x0473, 0x21bb, 0x78fa, 0x5f21
+    dw 0x0474, 0x6729, 0x818c, 0xa98a
+    dw 0x0475, 0x126b, 0x795e, 0x504e
+    dw 0x0476, 0x90d3, 0xf90a, 0x4e14
+    dw 0x0477, 0xca74, 0x822a, 0x0efc
+    dw 0x0478, 0xcb9b, 0x8126, 0x0c5e
+    dw 0x0479, 0x43da, 0xf047, 0xf833
+    dw 0x047a, 0x4ce8, 0x0247, 0x1196
+    dw 0x047b, 0x5382, 0x82a2, 0x98f1
+    dw 0x047c, 0x4461, 0x8259, 0x8924
+    dw 0x047d, 0x3508, 0x0995, 0x0383
+    dw 0x047e, 0xfa37, 0x3a31, 0xf8cf
+    dw 0x047f, 0xf457, 0x3f25, 0xf7c0
+    dw 0x0480, 0x16dc, 0xfade, 0xd5e3
+    dw 0x0481, 0x0e7d, 0x790f, 0x4c1a
+    dw 0x0482, 0x1224, 0x79b4, 0x5061
+    dw 0x0483, 0xced4, 0x6b7b, 0xfc00
+    dw 0x0484, 0xd16a, 0xea7f, 0x7c00
+    dw 0x0485, 0x2352, 0x1990, 0x028c
+    dw 0x0486, 0xdb64, 0xde74, 0x7c00
+    dw 0x0487, 0xda31, 0x002b, 0x9029
+    dw 0x0488, 0xa39b, 0x228c, 0x8a39
+    dw 0x0489, 0x0cd3, 0xbafb, 0x8c36
+    dw 0x048a, 0x56b4, 0x0353, 0x1d92
+    dw 0x048b, 0x55d2, 0x82d3, 0x9c1c
+    dw 0x048c, 0xd38e, 0x01d1, 0x96dc
+    dw 0x048d, 0xb89d, 0x78ab, 0xf562
+    dw 0x048e, 0x4fd2, 0x8090, 0x8c66
+    dw 0x048f, 0x4ade, 0x018a, 0x0d49
+    dw 0x0490, 0x9ebf, 0x1db6, 0x8268
+    dw 0x0491, 0x2ee9, 0x923f, 0x8565
+    dw 0x0492, 0xca69, 0x01ea, 0x8e22
+    dw 0x0493, 0xf73f, 0xc242, 0x7c00
+    dw 0x0494, 0xbdd4, 0x01f1, 0x82d4
+    dw 0x0495, 0xed86, 0x4c1b, 0xfc00
+    dw 0x0496, 0x84ed, 0x7a08, 0xc36d
+    dw 0x0497, 0xeefd, 0x0157, 0xb0ae
+    dw 0x0498, 0x0c96, 0xf9bb, 0xca92
+    dw 0x0499, 0xfa49, 0x3921, 0xf808
+    dw 0x049a, 0x7001, 0x40d7, 0x74d8
+    dw 0x049b, 0x64da, 0x80be, 0xa334
+    dw 0x049c, 0x197b, 0x21a1, 0x01ee
+    dw 0x049d, 0x2b25, 0x7ae5, 0x6a28
+    dw 0x049e, 0xe74a, 0x4e1e, 0xf993
+    dw 0x049f, 0x2d18, 0x797d, 0x6afd
+    dw 0x04a0, 0xd502, 0x83cd, 0x1cc2
+    dw 0x04a1, 0xd92e, 0x02c7, 0x9f31
+    dw 0x04a2, 0x8c97, 0xbb2c, 0x0c1d
+    dw 0x04a3, 0x8925, 0xfb23, 0x4897
+    dw 0x04a4, 0xcf4c, 0x6919, 0xfc00
+    dw 0x04a5, 0xf274, 0x80d9, 0x3178
+    dw 0x04a6, 0x1cf7, 0xa222, 0x83ce
+    dw 0x04a7, 0xce09, 0x8331, 0x14d1
+    dw 0x04a8, 0xa8c9, 0x195e, 0x866c
+    dw 0x04a9, 0xed73, 0x81d4, 0x30fb
+    dw 0x04aa, 0xbb74, 0x79c5, 0xf960
+    dw 0x04ab, 0xbdfd, 0x7bcb, 0xfc00
+    dw 0x04ac, 0x6069, 0x02a8, 0x25db
+    dw 0x04ad, 0xabe7, 0xf8cd, 0x68be
+    dw 0x04ae, 0xccd0, 0x034d, 0x93f1
+    dw 0x04af, 0x0b23, 0xfbfb, 0xcb1f
+    dw 0x04b0, 0x1065, 0x791e, 0x4d9f
+    dw 0x04b1, 0x514e, 0x80aa, 0x8f0c
+    dw 0x04b2, 0x6add, 0x02bc, 0x30b1
+    dw 0x04b3, 0x2b39, 0xf82c, 0xe788
+    dw 0x04b4, 0x574d, 0xe649, 0xfc00
+    dw 0x04b5, 0x8ec1, 0x30c3, 0x8405
+    dw 0x04b6, 0x6361, 0x83ce, 0xab05
+    dw 0x04b7, 0xf8eb, 0x0043, 0xb126
+    dw 0x04b8, 0x1388, 0xac97, 0x8452
+    dw 0x04b9, 0x5db8, 0x031b, 0x2471
+    dw 0x04ba, 0xefab, 0x832f, 0x361a
+    dw 0x04bb, 0x6508, 0x8233, 0xa988
+    dw 0x04bc, 0x73fc, 0x03f2, 0x3be0
+    dw 0x04bd, 0xb288, 0xfa51, 0x7128
+    dw 0x04be, 0x8b58, 0xf819, 0x4786
+    dw 0x04bf, 0xca83, 0x6fcd, 0xfc00
+    dw 0x04c0, 0xc225, 0x02ad, 0x881c
+    dw 0x04c1, 0x4f54, 0x8281, 0x9496
+    dw 0x04c2, 0x8a48, 0x7bad, 0xca07
+    dw 0x04c3, 0x2a35, 0x1c95, 0x0b1c
+    dw 0x04c4, 0x96a2, 0xab01, 0x05cf
+    dw 0x04c5, 0x2f49, 0x17cd, 0x0b1b
+    dw 0x04c6, 0xe6e8, 0xd0af, 0x7c00
+    dw 0x04c7, 0xb85c, 0x0820, 0x847f
+    dw 0x04c8, 0xb1fb, 0xf865, 0x6e92
+    dw 0x04c9, 0x360c, 0x09b4, 0x0450
+    dw 0x04ca, 0x2c33, 0x8c7a, 0x812d
+    dw 0x04cb, 0x17e4, 0xac45, 0x8836
+    dw 0x04cc, 0x87ee, 0xb529, 0x028f
+    dw 0x04cd, 0x913f, 0x79bf, 0xcf89
+    dw 0x04ce, 0xe83e, 0x80b9, 0x2622
+    dw 0x04cf, 0x623f, 0x81b4, 0xa552
+    dw 0x04d0, 0x63c0, 0x81f0, 0xa782
+    dw 0x04d1, 0xc3e0, 0xf95f, 0x7c00
+    dw 0x04d2, 0xcf62, 0xec60, 0x7c00
+    dw 0x04d3, 0xec6a, 0x0255, 0xb126
+    dw 0x04d4, 0xcbde, 0xed76, 0x7c00
+    dw 0x04d5, 0xd0c3, 0x03d7, 0x9892
+    dw 0x04d6, 0x2b44, 0x92bc, 0x830f
+    dw 0x04d7, 0xd5be, 0x605b, 0xfa41
+    dw 0x04d8, 0x56d5, 0x00eb, 0x1646
+    dw 0x04d9, 0x7be7, 0x8229, 0xc044
+    dw 0x04da, 0xb0a9, 0xf848, 0x6cfd
+    dw 0x04db, 0x5796, 0x5d33, 0x78ee
+    dw 0x04dc, 0xb104, 0x92d0, 0x0845
+    dw 0x04dd, 0x56f9, 0xe690, 0xfc00
+    dw 0x04de, 0xdd85, 0x837a, 0x24cc
+    dw 0x04df, 0x5fdb, 0xd874, 0xfc00
+    dw 0x04e0, 0x6b28, 0xcd0f, 0xfc00
+    dw 0x04e1, 0xae9a, 0x7901, 0xec21
+    dw 0x04e2, 0xedac, 0x0365, 0xb4d0
+    dw 0x04e3, 0x1801, 0x7b9c, 0x579e
+    dw 0x04e4, 0x2f7b, 0x9226, 0x85c0
+    dw 0x04e5, 0x9159, 0xb7a2, 0x0d1a
+    dw 0x04e6, 0x55b0, 0x0311, 0x1c5c
+    dw 0x04e7, 0xe35f, 0x5505, 0xfc00
+    dw 0x04e8, 0xde8a, 0x0045, 0x970d
+    dw 0x04e9, 0xf42b, 0x8215, 0x3857
+    dw 0x04ea, 0xc035, 0x7ab9, 0xfc00
+    dw 0x04eb, 0x6d38, 0x82f6, 0xb3ba
+    dw 0x04ec, 0xcf81, 0x669c, 0xfa33
+    dw 0x04ed, 0xb1a9, 0x9200, 0x083f
+    dw 0x04ee, 0xd42a, 0x81c7, 0x1767
+    dw 0x04ef, 0x0ab6, 0xf800, 0xc6b6
+    dw 0x04f0, 0xa481, 0x9e8a, 0x075d
+    dw 0x04f1, 0xa6fa, 0x1a7d, 0x85a9
+    dw 0x04f2, 0x4059, 0x0184, 0x034b
+    dw 0x04f3, 0x2aec, 0x1fdf, 0x0ecf
+    dw 0x04f4, 0x4fe0, 0x009e, 0x0cdc
+    dw 0x04f5, 0xef35, 0x8003, 0x1568
+    dw 0x04f6, 0x47e3, 0x8182, 0x89f2
+    dw 0x04f7, 0x1d8f, 0x2842, 0x09eb
+    dw 0x04f8, 0xe3ec, 0x82b4, 0x295a
+    dw 0x04f9, 0x432b, 0x7ab1, 0x7c00
+    dw 0x04fa, 0x5c6d, 0x034f, 0x2352
+    dw 0x04fb, 0x53de, 0x67ac, 0x7c00
+    dw 0x04fc, 0x92e5, 0xb6ff, 0x0e08
+    dw 0x04fd, 0x8434, 0xfbad, 0x4408
+    dw 0x04fe, 0xccd1, 0x6a56, 0xfba1
+    dw 0x04ff, 0xe57c, 0x80fd, 0x256c
+    dw 0x0500, 0x61ff, 0xd1d0, 0xf85b
+    dw 0x0501, 0xd62b, 0x82c7, 0x1c48
+    dw 0x0502, 0x67a7, 0x83d7, 0xaf59
+    dw 0x0503, 0x4493, 0x0256, 0x0958
+    dw 0x0504, 0xbba4, 0x8707, 0x06b6
+    dw 0x0505, 0x0927, 0x7ab3, 0x4851
+    dw 0x0506, 0x4b25, 0x83de, 0x92e8
+    dw 0x0507, 0x1e58, 0x21a4, 0x0479
+    dw 0x0508, 0x10a7, 0x7a1c, 0x4f1b
+    dw 0x0509, 0x6068, 0x80cb, 0x9efd
+    dw 0x050a, 0xb492, 0x0ff0, 0x8889
+    dw 0x050b, 0xfad6, 0x8398, 0x4224
+    dw 0x050c, 0x18c3, 0xa39e, 0x8244
+    dw 0x050d, 0xbcf5, 0x79a6, 0xfb00
+    dw 0x050e, 0x2aad, 0x9497, 0x83d5
+    dw 0x050f, 0xb5cf, 0x8a23, 0x0475
+    dw 0x0510, 0x6b39, 0x4c1e, 0x7b6f
+    dw 0x0511, 0xd554, 0x80c7, 0x1424
+    dw 0x0512, 0x48ae, 0x8241, 0x8d46
+    dw 0x0513, 0xf043, 0x013b, 0xb13e
+    dw 0x0514, 0x1719, 0xaca1, 0x881b
+    dw 0x0515, 0x10fc, 0x315b, 0x06ac
+    dw 0x0516, 0x4531, 0x0109, 0x0560
+    dw 0x0517, 0xf8a8, 0x01e9, 0xbc72
+    dw 0x0518, 0xc2cc, 0x0320, 0x894f
+    dw 0x0519, 0xca91, 0xf198, 0x7c00
+    dw 0x051a, 0xe05b, 0x0365, 0xa764
+    dw 0x051b, 0xc2bd, 0x0071, 0x817d
+    dw 0x051c, 0xd012, 0x68cb, 0xfc00
+    dw 0x051d, 0xe73c, 0x0019, 0x99a7
+    dw 0x051e, 0xc63c, 0x8075, 0x02d9
+    dw 0x051f, 0xea18, 0x4e7e, 0xfc00
+    dw 0x0520, 0x37e1, 0x0cae, 0x089c
+    dw 0x0521, 0x8f56, 0x36de, 0x8a4c
+    dw 0x0522, 0x722f, 0x802e, 0xa872
+    dw 0x0523, 0x69b7, 0x0131, 0x2acf
+    dw 0x0524, 0x56e0, 0x812d, 0x980b
+    dw 0x0525, 0xb104, 0xf98e, 0x6ef7
+    dw 0x0526, 0xf597, 0x8388, 0x3cef
+    dw 0x0527, 0xb70a, 0xf8de, 0x7448
+    dw 0x0528, 0xad4a, 0x1554, 0x870c
+    dw 0x0529, 0xa9ba, 0x7903, 0xe72d
+    dw 0x052a, 0xb9d0, 0x7ba9, 0xf991
+    dw 0x052b, 0xdda5, 0x574a, 0xf925
+    dw 0x052c, 0x76d0, 0x0239, 0x3b92
+    dw 0x052d, 0x1f1b, 0x7958, 0x5cbf
+    dw 0x052e, 0xd8a8, 0x583f, 0xf4f1
+    dw 0x052f, 0x1164, 0xadcc, 0x83e8
+    dw 0x0530, 0x3d8d, 0xf698, 0xf893
+    dw 0x0531, 0x1bf2, 0x7b59, 0x5b4c
+    dw 0x0532, 0x70b2, 0x8113, 0xb10b
+    dw 0x0533, 0x2f74, 0x91b4, 0x8550
+    dw 0x0534, 0xc9ca, 0x015b, 0x8bd9
+    dw 0x0535, 0xb87a, 0x8ee7, 0x0bba
+    dw 0x0536, 0x1f11, 0x9cfa, 0x8233
+    dw 0x0537, 0x96f6, 0xa5af, 0x0279
+    dw 0x0538, 0xaafb, 0x9ebf, 0x0de3
+    dw 0x0539, 0x1d7c, 0x7834, 0x59c3
+
+    ; Mostly subnormal values
+    dw 0x053a, 0x02a1, 0x010e, 0x0000
+    dw 0x053b, 0x027e, 0x80aa, 0x8000
+    dw 0x053c, 0x81d0, 0xd321, 0x1676
+    dw 0x053d, 0x8241, 0x015b, 0x8000
+    dw 0x053e, 0xde58, 0x8121, 0x1f29
+    dw 0x053f, 0xe667, 0x0328, 0xad0d
+    dw 0x0540, 0x8142, 0x7707, 0xb86b
+    dw 0x0541, 0x0274, 0x81a9, 0x8000
+    dw 0x0542, 0x812c, 0x01bf, 0x8000
+    dw 0x0543, 0x0025, 0x0318, 0x0000
+    dw 0x0544, 0xbe16, 0x3e87, 0xc0f7
+    dw 0x0545, 0x003c, 0x0161, 0x0000
+    dw 0x0546, 0x00fd, 0xa35f, 0x8004
+    dw 0x0547, 0x0091, 0x0058, 0x0000
+    dw 0x0548, 0x03e0, 0x8040, 0x8000
+    dw 0x0549, 0x03fe, 0x829c, 0x8000
+    dw 0x054a, 0x8129, 0x0370, 0x8000
+    dw 0x054b, 0x813f, 0x01d1, 0x8000
+    dw 0x054c, 0x0123, 0x0337, 0x0000
+    dw 0x054d, 0xe586, 0x706e, 0xfc00
+    dw 0x054e, 0x817b, 0x013d, 0x8000
+    dw 0x054f, 0x8217, 0x8110, 0x0000
+    dw 0x0550, 0x3959, 0x0164, 0x00ee
+    dw 0x0551, 0x8197, 0x80dd, 0x0000
+    dw 0x0552, 0x0089, 0x82d3, 0x8000
+    dw 0x0553, 0x80eb, 0x82cf, 0x0000
+    dw 0x0554, 0x65f4, 0x803c, 0x9d95
+    dw 0x0555, 0x539c, 0x0218, 0x17f7
+    dw 0x0556, 0x39a1, 0x80ce, 0x8091
+    dw 0x0557, 0x0024, 0x82ed, 0x8000
+    dw 0x0558, 0x0043, 0x006d, 0x0000
+    dw 0x0559, 0x829d, 0x829e, 0x0000
+    dw 0x055a, 0x8370, 0x0073, 0x8000
+    dw 0x055b, 0x809b, 0xb8c9, 0x005d
+    dw 0x055c, 0x81a8, 0xd604, 0x18fb
+    dw 0x055d, 0x54ca, 0x02d5, 0x1ac8
+    dw 0x055e, 0x03f7, 0x028b, 0x0000
+    dw 0x055f, 0x8310, 0x03d9, 0x8000
+    dw 0x0560, 0x01a0, 0x816c, 0x8000
+    dw 0x0561, 0x70a8, 0xa0b9, 0xd57f
+    dw 0x0562, 0x0292, 0x8058, 0x8000
+    dw 0x0563, 0x91df, 0x82f5, 0x0001
+    dw 0x0564, 0x0280, 0x8321, 0x8000
+    dw 0x0565, 0x810d, 0x80ae, 0x0000
+    dw 0x0566, 0x0118, 0x6087, 0x20f4
+    dw 0x0567, 0x829f, 0xd230, 0x180e
+    dw 0x0568, 0x1e96, 0x0039, 0x0000
+    dw 0x0569, 0x0228, 0x823a, 0x8000
+    dw 0x056a, 0xf817, 0x8206, 0x3c23
+    dw 0x056b, 0x0175, 0x00a8, 0x0000
+    dw 0x056c, 0x0142, 0x0017, 0x0000
+    dw 0x056d, 0x0059, 0x9bd2, 0x8000
+    dw 0x056e, 0x8090, 0x0180, 0x8000
+    dw 0x056f, 0x005d, 0x5642, 0x108c
+    dw 0x0570, 0x9c1d, 0x80cf, 0x0001
+    dw 0x0571, 0x02df, 0x307d, 0x0067
+    dw 0x0572, 0x8317, 0xbcaa, 0x039a
+    dw 0x0573, 0xb205, 0x8209, 0x0062
+    dw 0x0574, 0x001f, 0x0063, 0x0000
+    dw 0x0575, 0xccac, 0x0094, 0x8967
+    dw 0x0576, 0x03be, 0x0096, 0x0000
+    dw 0x0577, 0x8363, 0x01d2, 0x8000
+    dw 0x0578, 0xd12f, 0xd82e, 0x6d6b
+    dw 0x0579, 0x0020, 0x73c7, 0x27c7
+    dw 0x057a, 0x3323, 0x81eb, 0x806e
+    dw 0x057b, 0x804b, 0x828d, 0x0000
+    dw 0x057c, 0x82c9, 0x03b8, 0x8000
+    dw 0x057d, 0x035d, 0x02ff, 0x0000
+    dw 0x057e, 0x0376, 0x6a51, 0x3177
+    dw 0x057f, 0x82a9, 0x03c3, 0x8000
+    dw 0x0580, 0x839c, 0x0301, 0x8000
+    dw 0x0581, 0x0295, 0x2377, 0x000a
+    dw 0x0582, 0x897b, 0x007c, 0x8000
+    dw 0x0583, 0x83a0, 0x0079, 0x8000
+    dw 0x0584, 0x028a, 0x8301, 0x8000
+    dw 0x0585, 0x01b8, 0x0276, 0x0000
+    dw 0x0586, 0x81d0, 0x8136, 0x0000
+    dw 0x0587, 0x8170, 0x00b3, 0x8000
+    dw 0x0588, 0xd9ce, 0x82f4, 0x2049
+    dw 0x0589, 0x022f, 0x5d10, 0x2187
+    dw 0x058a, 0x01f6, 0x8275, 0x8000
+    dw 0x058b, 0xb6f6, 0x3e74, 0xb99d
+    dw 0x058c, 0x804b, 0x35ba, 0x801b
+    dw 0x058d, 0x02df, 0x8316, 0x8000
+    dw 0x058e, 0x0331, 0x0130, 0x0000
+    dw 0x058f, 0xab5c, 0x813f, 0x0012
+    dw 0x0590, 0x3015, 0x8188, 0x8032
+    dw 0x0591, 0x8392, 0x8328, 0x0000
+    dw 0x0592, 0x001c, 0x44c5, 0x0086
+    dw 0x0593, 0x00b7, 0x0203, 0x0000
+    dw 0x0594, 0x01c4, 0x815b, 0x8000
+    dw 0x0595, 0x504d, 0x01ed, 0x1424
+    dw 0x0596, 0x029d, 0x0333, 0x0000
+    dw 0x0597, 0x01df, 0x001d, 0x0000
+    dw 0x0598, 0x801b, 0x8267, 0x0000
+    dw 0x0599, 0x018a, 0x00dd, 0x0000
+    dw 0x059a, 0x6999, 0x9883, 0xc650
+    dw 0x059b, 0x006e, 0x037a, 0x0000
+    dw 0x059c, 0x01b6, 0x8092, 0x8000
+    dw 0x059d, 0x4763, 0x0095, 0x044d
+    dw 0x059e, 0x81b2, 0x821b, 0x0000
+    dw 0x059f, 0x6446, 0x0267, 0x2922
+    dw 0x05a0, 0x0377, 0x026b, 0x0000
+    dw 0x05a1, 0x025d, 0x01c7, 0x0000
+    dw 0x05a2, 0x0372, 0x3fd5, 0x06bf
+    dw 0x05a3, 0x0267, 0x013e, 0x0000
+    dw 0x05a4, 0x42e1, 0x0245, 0x07ce
+    dw 0x05a5, 0x0221, 0x02df, 0x0000
+    dw 0x05a6, 0x0256, 0x0188, 0x0000
+    dw 0x05a7, 0x8127, 0x8155, 0x0000
+    dw 0x05a8, 0x83db, 0x81ff, 0x0000
+    dw 0x05a9, 0x0118, 0x025d, 0x0000
+    dw 0x05aa, 0x813a, 0x0383, 0x8000
+    dw 0x05ab, 0x0063, 0x83c2, 0x8000
+    dw 0x05ac, 0x0285, 0x015c, 0x0000
+    dw 0x05ad, 0x8052, 0x01eb, 0x8000
+    dw 0x05ae, 0x016b, 0x0353, 0x0000
+    dw 0x05af, 0x8311, 0x806c, 0x0000
+    dw 0x05b0, 0x801f, 0xf16e, 0x2543
+    dw 0x05b1, 0x005e, 0x82ad, 0x8000
+    dw 0x05b2, 0x809d, 0xe4f8, 0x2218
+    dw 0x05b3, 0x030b, 0x8182, 0x8000
+    dw 0x05b4, 0x8134, 0x02a3, 0x8000
+    dw 0x05b5, 0xd408, 0x81e4, 0x179f
+    dw 0x05b6, 0x83b2, 0xb766, 0x01b5
+    dw 0x05b7, 0x0355, 0x019a, 0x0000
+    dw 0x05b8, 0x83c1, 0x80c1, 0x0000
+    dw 0x05b9, 0x0240, 0x837d, 0x8000
+    dw 0x05ba, 0x0240, 0x839a, 0x8000
+    dw 0x05bb, 0x8268, 0x8248, 0x0000
+    dw 0x05bc, 0x8363, 0x01cb, 0x8000
+    dw 0x05bd, 0x82f9, 0x03da, 0x8000
+    dw 0x05be, 0x817f, 0x8532, 0x0000
+    dw 0x05bf, 0x8061, 0x801a, 0x0000
+    dw 0x05c0, 0x020a, 0xcf28, 0x934c
+    dw 0x05c1, 0x016c, 0x018d, 0x0000
+    dw 0x05c2, 0x82cb, 0xc722, 0x0cfb
+    dw 0x05c3, 0xa64e, 0x8244, 0x000e
+    dw 0x05c4, 0x4fac, 0x29f4, 0x3db5
+    dw 0x05c5, 0x81dd, 0xcfa4, 0x131e
+    dw 0x05c6, 0x8368, 0x8331, 0x0000
+    dw 0x05c7, 0x81b8, 0x672d, 0xaa2b
+    dw 0x05c8, 0x8134, 0x035a, 0x8000
+    dw 0x05c9, 0x0172, 0x004c, 0x0000
+    dw 0x05ca, 0x80ad, 0x817c, 0x0000
+    dw 0x05cb, 0x8103, 0x00e2, 0x8000
+    dw 0x05cc, 0x8223, 0x82aa, 0x0000
+    dw 0x05cd, 0x80a2, 0x8029, 0x0000
+    dw 0x05ce, 0x01b6, 0x8058, 0x8000
+    dw 0x05cf, 0xef79, 0x029f, 0xb4e6
+    dw 0x05d0, 0x83f0, 0x6348, 0xab2b
+    dw 0x05d1, 0x884c, 0x8111, 0x0000
+    dw 0x05d2, 0x813e, 0x034a, 0x8000
+    dw 0x05d3, 0x3914, 0x8298, 0x81a5
+    dw 0x05d4, 0x8131, 0x8171, 0x0000
+    dw 0x05d5, 0x0015, 0x0039, 0x0000
+    dw 0x05d6, 0x837e, 0x83c2, 0x0000
+    dw 0x05d7, 0x0070, 0x6f23, 0x2a3f
+    dw 0x05d8, 0x981e, 0x0038, 0x8000
+    dw 0x05d9, 0x8127, 0x03da, 0x8000
+    dw 0x05da, 0x561d, 0x01f4, 0x19f8
+    dw 0x05db, 0x0249, 0x826d, 0x8000
+    dw 0x05dc, 0x82d3, 0x7a74, 0xc08e
+    dw 0x05dd, 0x83e1, 0x82de, 0x0000
+    dw 0x05de, 0x8009, 0x830a, 0x0000
+    dw 0x05df, 0x8319, 0x03f1, 0x8000
+    dw 0x05e0, 0x010e, 0x8281, 0x8000
+    dw 0x05e1, 0x808d, 0x8015, 0x0000
+    dw 0x05e2, 0x005e, 0x3e91, 0x009a
+    dw 0x05e3, 0x006f, 0x6a15, 0x2546
+    dw 0x05e4, 0x0080, 0x9c4a, 0x8001
+    dw 0x05e5, 0x8121, 0x8143, 0x0000
+    dw 0x05e6, 0x6cc3, 0x6548, 0x7c00
+    dw 0x05e7, 0x81c2, 0x8388, 0x0000
+    dw 0x05e8, 0x5c75, 0x0006, 0x06b0
+    dw 0x05e9, 0x7930, 0xd067, 0xfc00
+    dw 0x05ea, 0xa575, 0x5e63, 0xc85b
+    dw 0x05eb, 0x8353, 0x00c9, 0x8000
+    dw 0x05ec, 0xaf4f, 0x809b, 0x0012
+    dw 0x05ed, 0x8088, 0x7b54, 0xb7c9
+    dw 0x05ee, 0x01ae, 0x0353, 0x0000
+    dw 0x05ef, 0x02d0, 0x0059, 0x0000
+    dw 0x05f0, 0xa563, 0x853f, 0x001c
+    dw 0x05f1, 0x53c7, 0x032f, 0x1a31
+    dw 0x05f2, 0x82ce, 0x03f8, 0x8000
+    dw 0x05f3, 0x8319, 0x8361, 0x0000
+    dw 0x05f4, 0x80cd, 0x00ed, 0x8000
+    dw 0x05f5, 0x02fe, 0x83bc, 0x8000
+    dw 0x05f6, 0x0088, 0x815f, 0x8000
+    dw 0x05f7, 0x00f2, 0x939a, 0x8000
+    dw 0x05f8, 0x00c2, 0x60a9, 0x1f10
+    dw 0x05f9, 0x9549, 0x019b, 0x8001
+    dw 0x05fa, 0x019a, 0x83d3, 0x8000
+    dw 0x05fb, 0x018c, 0x530e, 0x1575
+    dw 0x05fc, 0x79ed, 0x0103, 0x39ff
+    dw 0x05fd, 0x0199, 0x836f, 0x8000
+    dw 0x05fe, 0x03ad, 0x8060, 0x8000
+    dw 0x05ff, 0x8234, 0x8096, 0x0000
+    dw 0x0600, 0x006e, 0x0246, 0x0000
+    dw 0x0601, 0x006a, 0x0212, 0x0000
+    dw 0x0602, 0x819c, 0x81a7, 0x0000
+    dw 0x0603, 0x020c, 0x004b, 0x0000
+    dw 0x0604, 0x0058, 0x81a2, 0x8000
+    dw 0x0605, 0x81a7, 0xeb4c, 0x2e07
+    dw 0x0606, 0x029a, 0x8127, 0x8000
+    dw 0x0607, 0x81c4, 0x1605, 0x8001
+    dw 0x0608, 0x7a5e, 0x833d, 0xc128
+    dw 0x0609, 0x8370, 0x82cb, 0x0000
+    dw 0x060a, 0x001a, 0x833a, 0x8000
+    dw 0x060b, 0x01a9, 0x01f7, 0x0000
+    dw 0x060c, 0x03d9, 0x8142, 0x8000
+    dw 0x060d, 0x03fe, 0x600b, 0x2809
+    dw 0x060e, 0x8067, 0x81dd, 0x0000
+    dw 0x060f, 0x031d, 0x80b2, 0x8000
+    dw 0x0610, 0x035f, 0x810b, 0x8000
+    dw 0x0611, 0x2c4e, 0x0201, 0x0023
+    dw 0x0612, 0x80d9, 0x0200, 0x8000
+    dw 0x0613, 0x811d, 0x0352, 0x8000
+    dw 0x0614, 0x8362, 0x8260, 0x0000
+    dw 0x0615, 0x01c9, 0x026c, 0x0000
+    dw 0x0616, 0x03c0, 0xb730, 0x81af
+    dw 0x0617, 0x8073, 0x99ff, 0x0000
+    dw 0x0618, 0x804b, 0x4411, 0x8131
+    dw 0x0619, 0x0369, 0xbc42, 0x83a1
+    dw 0x061a, 0x0257, 0x805e, 0x8000
+    dw 0x061b, 0x8032, 0x03b5, 0x8000
+    dw 0x061c, 0x80f9, 0xccf0, 0x0ccd
+    dw 0x061d, 0x81d8, 0x75ef, 0xb978
+    dw 0x061e, 0x8085, 0x039e, 0x8000
+    dw 0x061f, 0x8150, 0x032a, 0x8000
+    dw 0x0620, 0x8330, 0x001b, 0x8000
+    dw 0x0621, 0x00b8, 0x8031, 0x8000
+    dw 0x0622, 0x28e8, 0x0331, 0x001f
+    dw 0x0623, 0x8111, 0x80b7, 0x0000
+    dw 0x0624, 0xdf23, 0x00c1, 0x9d61
+    dw 0x0625, 0x0286, 0x5ae9, 0x205c
+    dw 0x0626, 0x032b, 0xb2bb, 0x80ab
+    dw 0x0627, 0x94bb, 0x8061, 0x0000
+    dw 0x0628, 0x82b6, 0x7187, 0xb77e
+    dw 0x0629, 0xbc6f, 0x8146, 0x0169
+    dw 0x062a, 0x3bcf, 0x8034, 0x8033
+    dw 0x062b, 0x8094, 0x01ea, 0x8000
+    dw 0x062c, 0x0366, 0x82cd, 0x8000
+    dw 0x062d, 0x008f, 0x0006, 0x0000
+    dw 0x062e, 0x01d0, 0x032e, 0x0000
+    dw 0x062f, 0x033d, 0x0086, 0x0000
+    dw 0x0630, 0x0181, 0x8297, 0x8000
+    dw 0x0631, 0x0182, 0x813c, 0x8000
+    dw 0x0632, 0xafe2, 0xf34b, 0x6730
+    dw 0x0633, 0x81a5, 0x83eb, 0x0000
+    dw 0x0634, 0x0110, 0xf785, 0xb7fd
+    dw 0x0635, 0x0079, 0x02ad, 0x0000
+    dw 0x0636, 0x815b, 0xee0d, 0x301a
+    dw 0x0637, 0x01e4, 0xa24d, 0x8006
+    dw 0x0638, 0x1d70, 0x805c, 0x8000
+    dw 0x0639, 0x0311, 0x8027, 0x8000
+    dw 0x063a, 0x02f7, 0x03a2, 0x0000
+    dw 0x063b, 0x028b, 0x836b, 0x8000
+    dw 0x063c, 0x0227, 0x8102, 0x8000
+    dw 0x063d, 0x1b81, 0x2890, 0x0848
+    dw 0x063e, 0x8224, 0x02fb, 0x8000
+    dw 0x063f, 0x0074, 0x9d8b, 0x8001
+    dw 0x0640, 0x0204, 0x9ce1, 0x8002
+    dw 0x0641, 0x82f9, 0x6eed, 0xb526
+    dw 0x0642, 0x4a81, 0x00eb, 0x09f8
+    dw 0x0643, 0x81a6, 0x81a4, 0x0000
+    dw 0x0644, 0x8110, 0x8295, 0x0000
+    dw 0x0645, 0x80fa, 0x7048, 0xb02e
+    dw 0x0646, 0x489b, 0x005d, 0x0359
+    dw 0x0647, 0x0249, 0x00e6, 0x0000
+    dw 0x0648, 0x83fa, 0xd400, 0x1bf4
+    dw 0x0649, 0x0226, 0x01c6, 0x0000
+    dw 0x064a, 0x02e4, 0x811b, 0x8000
+    dw 0x064b, 0x034d, 0x8098, 0x8000
+    dw 0x064c, 0x8005, 0x825f, 0x0000
+    dw 0x064d, 0xf496, 0x5103, 0xfc00
+    dw 0x064e, 0x01b2, 0x80de, 0x8000
+    dw 0x064f, 0x0056, 0x02af, 0x0000
+    dw 0x0650, 0xee4d, 0xb7b2, 0x6a10
+    dw 0x0651, 0x028d, 0x0029, 0x0000
+    dw 0x0652, 0x81f1, 0x83ba, 0x0000
+    dw 0x0653, 0x01dd, 0x00ee, 0x0000
+    dw 0x0654, 0x03d1, 0x80eb, 0x8000
+    dw 0x0655, 0x55da, 0x5b04, 0x7522
+    dw 0x0656, 0x0093, 0xf525, 0xb1e8
+    dw 0x0657, 0x0077, 0x000a, 0x0000
+    dw 0x0658, 0x20bb, 0x0207, 0x0005
+    dw 0x0659, 0x02b0, 0x8305, 0x8000
+    dw 0x065a, 0xdce9, 0xeba1, 0x7c00
+    dw 0x065b, 0xa900, 0x8384, 0x0023
+    dw 0x065c, 0x80ab, 0x024e, 0x8000
+    dw 0x065d, 0x0267, 0x825c, 0x8000
+    dw 0x065e, 0x81d8, 0xe269, 0x25e9
+    dw 0x065f, 0x8053, 0x0289, 0x8000
+    dw 0x0660, 0xd38e, 0x80b2, 0x1141
+    dw 0x0661, 0x0350, 0x5ea2, 0x257e
+    dw 0x0662, 0x82d4, 0x8242, 0x0000
+    dw 0x0663, 0x830e, 0x03fe, 0x8000
+    dw 0x0664, 0x019c, 0x00c7, 0x0000
+    dw 0x0665, 0x0249, 0xa989, 0x8019
+    dw 0x0666, 0x838a, 0x01ac, 0x8000
+    dw 0x0667, 0x8367, 0x800e, 0x0000
+    dw 0x0668, 0x0336, 0x8249, 0x8000
+    dw 0x0669, 0x814e, 0x9e2f, 0x0002
+    dw 0x066a, 0x03e1, 0x010b, 0x0000
+    dw 0x066b, 0x00a0, 0x5c6f, 0x198b
+    dw 0x066c, 0x0108, 0x03b5, 0x0000
+    dw 0x066d, 0x808c, 0x80af, 0x0000
+    dw 0x066e, 0x03e5, 0x827b, 0x8000
+    dw 0x066f, 0x80cf, 0x83bf, 0x0000
+    dw 0x0670, 0x969c, 0x80e2, 0x0000
+    dw 0x0671, 0xaf31, 0x8186, 0x002c
+    dw 0x0672, 0x0356, 0x8303, 0x8000
+    dw 0x0673, 0xb3aa, 0x80db, 0x0034
+    dw 0x0674, 0xe757, 0x803c, 0x1ee2
+    dw 0x0675, 0x82ab, 0x8051, 0x0000
+    dw 0x0676, 0x026f, 0x81b9, 0x8000
+    dw 0x0677, 0x03c3, 0x8268, 0x8000
+    dw 0x0678, 0x0281, 0x036e, 0x0000
+    dw 0x0679, 0x80a2, 0x01aa, 0x8000
+    dw 0x067a, 0x00fa, 0x8018, 0x8000
+    dw 0x067b, 0x8355, 0x837c, 0x0000
+    dw 0x067c, 0x019f, 0x819d, 0x8000
+    dw 0x067d, 0x0123, 0x8088, 0x8000
+    dw 0x067e, 0xda48, 0x83ea, 0x2225
+    dw 0x067f, 0x8217, 0xcbbe, 0x100c
+    dw 0x0680, 0x0220, 0x835d, 0x8000
+    dw 0x0681, 0x02b4, 0x02ee, 0x0000
+    dw 0x0682, 0x833b, 0x83cb, 0x0000
+    dw 0x0683, 0x004f, 0xcd16, 0x8647
+    dw 0x0684, 0x0016, 0x02d8, 0x0000
+
+    ; Rounding ties
+    dw 0x0685, 0x9b20, 0xba20, 0x1974
+    dw 0x0686, 0x8ae2, 0x3000, 0x81b8
+    dw 0x0687, 0x079c, 0xe100, 0xacc2
+    dw 0x0688, 0x9338, 0xa000, 0x0074
+    dw 0x0689, 0x5d00, 0x3734, 0x5880
+    dw 0x068a, 0xa900, 0xa562, 0x12ba
+    dw 0x068b, 0x0d00, 0x3e46, 0x0fd8
+    dw 0x068c, 0xf440, 0x4008, 0xf848
+    dw 0x068d, 0x0740, 0xd230, 0x9d9c
+    dw 0x068e, 0x68d8, 0x25c0, 0x52f6
+    dw 0x068f, 0x4a00, 0x8f42, 0x9d72
+    dw 0x0690, 0xa600, 0x3f2a, 0xa960
+    dw 0x0691, 0x1600, 0x1180, 0x0010
+    dw 0x0692, 0xb480, 0x42e4, 0xbbc0
+    dw 0x0693, 0x51f8, 0x1980, 0x301a
+    dw 0x0694, 0xdc63, 0x1a00, 0xba94
+    dw 0x0695, 0x5688, 0xdf80, 0xfa20
+    dw 0x0696, 0xc790, 0xaec0, 0x3a62
+    dw 0x0697, 0xede0, 0xaae0, 0x5d0c
+    dw 0x0698, 0x8308, 0xfac0, 0x411e
+    dw 0x0699, 0x0980, 0x1800, 0x0006
+    dw 0x069a, 0xf7a0, 0xbf60, 0x7b08
+    dw 0x069b, 0x13d0, 0xd4c0, 0xaca4
+    dw 0x069c, 0x4992, 0x3500, 0x42f6
+    dw 0x069d, 0x1ef8, 0xcf80, 0xb288
+    dw 0x069e, 0x3680, 0x3b38, 0x35de
+    dw 0x069f, 0x8924, 0x4700, 0x9480
+    dw 0x06a0, 0xd108, 0x0cc0, 0xa1fa
+    dw 0x06a1, 0xbf80, 0x3718, 0xbaa6
+    dw 0x06a2, 0xf1c0, 0x27f0, 0xddb4
+    dw 0x06a3, 0xcccc, 0xcf00, 0x6032
+    dw 0x06a4, 0xecf8, 0xbb80, 0x6ca8
+    dw 0x06a5, 0x5600, 0x3de6, 0x586c
+    dw 0x06a6, 0x3cc8, 0xeb80, 0xec7c
+    dw 0x06a7, 0xb6c0, 0x17f0, 0x92b2
+    dw 0x06a8, 0x3d80, 0xd9c4, 0xdbee
+    dw 0x06a9, 0x54c0, 0xd408, 0xecca
+    dw 0x06aa, 0xaa20, 0x7a60, 0xe8e2
+    dw 0x06ab, 0xdf9c, 0x3300, 0xd6a8
+    dw 0x06ac, 0x1be0, 0x1000, 0x0020
+    dw 0x06ad, 0x61ac, 0xa580, 0xcbcc
+    dw 0x06ae, 0xc5fc, 0x6700, 0xf13c
+    dw 0x06af, 0x1cb0, 0x40e0, 0x21b6
+    dw 0x06b0, 0x0900, 0xf256, 0xbfec
+    dw 0x06b1, 0x3e64, 0xc300, 0xc598
+    dw 0x06b2, 0x4e50, 0x0bc0, 0x1e1e
+    dw 0x06b3, 0x10a8, 0xa600, 0x80e0
+    dw 0x06b4, 0x2940, 0xd310, 0xc0a2
+    dw 0x06b5, 0xdaf0, 0x9240, 0x316c
+    dw 0x06b6, 0xe913, 0x1e00, 0xcb9c
+    dw 0x06b7, 0xc7a0, 0x00b4, 0x855c
+    dw 0x06b8, 0x1680, 0x54cc, 0x2fcc
+    dw 0x06b9, 0x398a, 0x9600, 0x9428
+    dw 0x06ba, 0x61a8, 0x8b80, 0xb14e
+    dw 0x06bb, 0x26c0, 0x4150, 0x2c7c
+    dw 0x06bc, 0x5d80, 0xbea8, 0xe094
+    dw 0x06bd, 0x8a62, 0xd600, 0x24ca
+    dw 0x06be, 0x22c0, 0x1c10, 0x036e
+    dw 0x06bf, 0x5fd4, 0xc500, 0xe8e4
+    dw 0x06c0, 0xc814, 0x6a80, 0xf6a0
+    dw 0x06c1, 0xa1c0, 0x6138, 0xc780
+    dw 0x06c2, 0xd600, 0xc65e, 0x60c6
+    dw 0x06c3, 0x6a0e, 0x8180, 0xac8a
+    dw 0x06c4, 0x3f10, 0xacc0, 0xb032
+    dw 0x06c5, 0xa000, 0x8440, 0x0008
+    dw 0x06c6, 0x9480, 0x1700, 0x8020
+    dw 0x06c7, 0x0928, 0xf780, 0xc4d6
+    dw 0x06c8, 0x0f70, 0x2600, 0x00b2
+    dw 0x06c9, 0x3afc, 0x1100, 0x105e
+    dw 0x06ca, 0x3220, 0x8580, 0x810e
+    dw 0x06cb, 0x0840, 0x9c00, 0x8008
+    dw 0x06cc, 0xda80, 0x13a8, 0xb238
+    dw 0x06cd, 0x2b68, 0x7440, 0x63de
+    dw 0x06ce, 0xd8c4, 0xc180, 0x5e8e
+    dw 0x06cf, 0x7284, 0x2900, 0x6012
+    dw 0x06d0, 0x1b80, 0x9480, 0x8044
+    dw 0x06d1, 0x8300, 0x2300, 0x800a
+    dw 0x06d2, 0x6b88, 0x9480, 0xc43c
+    dw 0x06d3, 0xcf00, 0xe456, 0x7796
+    dw 0x06d4, 0xb3ea, 0x5a00, 0xd1f0
+    dw 0x06d5, 0xc73a, 0x1600, 0xa16c
+    dw 0x06d6, 0xd8cc, 0xc280, 0x5fcc
+    dw 0x06d7, 0xc250, 0x8640, 0x0cee
+    dw 0x06d8, 0x1b00, 0x20c8, 0x0218
+    dw 0x06d9, 0xba00, 0xe556, 0x6400
+    dw 0x06da, 0x9400, 0x0200, 0x8000
+    dw 0x06db, 0x8780, 0x4dc8, 0x996c
+    dw 0x06dc, 0x0dc0, 0xab40, 0x814e
+    dw 0x06dd, 0x104e, 0xa800, 0x8114
+    dw 0x06de, 0xa02c, 0xc880, 0x2cb2
+    dw 0x06df, 0x3880, 0xa074, 0x9d02
+    dw 0x06e0, 0x18e0, 0xcd70, 0xaaa0
+    dw 0x06e1, 0xa7aa, 0x1a00, 0x85c0
+    dw 0x06e2, 0x2023, 0x6600, 0x4a34
+    dw 0x06e3, 0x40d0, 0x9fc0, 0xa4aa
+    dw 0x06e4, 0x22d2, 0x7a00, 0x611e
+    dw 0x06e5, 0x4568, 0x2dc0, 0x37c6
+    dw 0x06e6, 0x3040, 0x4138, 0x358c
+    dw 0x06e7, 0x7900, 0xa57a, 0xe2d8
+    dw 0x06e8, 0x29c4, 0xc980, 0xb7ee
+    dw 0x06e9, 0xe2dc, 0xbf00, 0x6600
+    dw 0x06ea, 0x1e00, 0xe732, 0xc966
+    dw 0x06eb, 0x19d0, 0x2380, 0x02ba
+    dw 0x06ec, 0xb7d2, 0xca00, 0x45de
+    dw 0x06ed, 0x1c08, 0xdfc0, 0xbfd0
+    dw 0x06ee, 0x14a0, 0xb510, 0x8dda
+    dw 0x06ef, 0x0400, 0xa5a0, 0x8016
+    dw 0x06f0, 0xa700, 0xeecc, 0x59f2
+    dw 0x06f1, 0x4cfc, 0x1880, 0x299c
+    dw 0x06f2, 0x28c0, 0x63f0, 0x50b6
+    dw 0x06f3, 0x9600, 0xe162, 0x3c0a
+    dw 0x06f4, 0x4700, 0xea1c, 0xf558
+    dw 0x06f5, 0x9a00, 0x48bf, 0xa71e
+    dw 0x06f6, 0x3780, 0x8928, 0x84d6
+    dw 0x06f7, 0x8590, 0xcc60, 0x1616
+    dw 0x06f8, 0x5700, 0xae9c, 0xc9c8
+    dw 0x06f9, 0xc140, 0xb270, 0x383a
+    dw 0x06fa, 0x9a80, 0x8800, 0x0006
+    dw 0x06fb, 0x0420, 0xad00, 0x8052
+    dw 0x06fc, 0x0cc0, 0x7790, 0x487e
+    dw 0x06fd, 0xb570, 0x5da0, 0xd7a6
+    dw 0x06fe, 0x4090, 0x8ae0, 0x8fd8
+    dw 0x06ff, 0xbfe0, 0x6320, 0xe704
+    dw 0x0700, 0x343f, 0xb200, 0xaa5e
+    dw 0x0701, 0xbbfe, 0x0a00, 0x89fe
+    dw 0x0702, 0xac00, 0x8118, 0x0012
+    dw 0x0703, 0xa340, 0x4ad0, 0xb22c
+    dw 0x0704, 0x7480, 0x119c, 0x4a50
+    dw 0x0705, 0x96c0, 0x9e80, 0x00b0
+    dw 0x0706, 0xee00, 0xb24e, 0x64ba
+    dw 0x0707, 0x2cc0, 0xa148, 0x9246
+    dw 0x0708, 0xc070, 0xf5a0, 0x7a3e
+    dw 0x0709, 0x5218, 0x0580, 0x1c30
+    dw 0x070a, 0x18a0, 0xbe90, 0x9b96
+    dw 0x070b, 0x6dac, 0x1b00, 0x4cf6
+    dw 0x070c, 0x7a00, 0x15de, 0x5466
+    dw 0x070d, 0xa176, 0xd200, 0x3818
+    dw 0x070e, 0x0e00, 0x0c00, 0x0002
+    dw 0x070f, 0x1d00, 0x2d82, 0x0ee2
+    dw 0x0710, 0x3e58, 0x4d80, 0x505c
+    dw 0x0711, 0x8c58, 0x61c0, 0xb23e
+    dw 0x0712, 0x4300, 0xd59c, 0xdce8
+    dw 0x0713, 0x4c30, 0x62e0, 0x7332
+    dw 0x0714, 0xbd56, 0x8d00, 0x0eac
+    dw 0x0715, 0x2a60, 0x3f60, 0x2de0
+    dw 0x0716, 0x1870, 0x5020, 0x2c94
+    dw 0x0717, 0x6a20, 0x0930, 0x37f2
+    dw 0x0718, 0xb580, 0x8ac8, 0x04aa
+    dw 0x0719, 0x7680, 0x9648, 0xd11a
+    dw 0x071a, 0xd6b6, 0xa200, 0x3d08
+    dw 0x071b, 0x2980, 0x0080, 0x0006
+    dw 0x071c, 0x0730, 0x2800, 0x003a
+    dw 0x071d, 0xa680, 0x27c8, 0x9252
+    dw 0x071e, 0x7900, 0x12d4, 0x5044
+    dw 0x071f, 0x8200, 0x2280, 0x8006
+    dw 0x0720, 0xda30, 0x2640, 0xc4d6
+    dw 0x0721, 0xd100, 0xcc5a, 0x6170
+    dw 0x0722, 0x5e46, 0x1200, 0x34b4
+    dw 0x0723, 0xda04, 0x4f00, 0xed44
+    dw 0x0724, 0xdfa4, 0xbf00, 0x62b0
+    dw 0x0725, 0xb860, 0x9e10, 0x1aa2
+    dw 0x0726, 0xa300, 0xf01a, 0x572e
+    dw 0x0727, 0x9c10, 0xe220, 0x4238
+    dw 0x0728, 0xd10c, 0xd580, 0x6af0
+    dw 0x0729, 0x1680, 0x9cc0, 0x807c
+    dw 0x072a, 0xea00, 0x132e, 0xc162
+    dw 0x072b, 0xe058, 0x8640, 0x2aca
+    dw 0x072c, 0x0672, 0x6a00, 0x34d6
+    dw 0x072d, 0xcc1a, 0xc700, 0x572e
+    dw 0x072e, 0xcf60, 0x0230, 0x9408
+    dw 0x072f, 0x88f4, 0xef00, 0x3c56
+    dw 0x0730, 0xce00, 0xbd66, 0x500c
+    dw 0x0731, 0xdd00, 0xd0be, 0x71ee
+    dw 0x0732, 0x9280, 0xfa88, 0x514e
+    dw 0x0733, 0x3520, 0x5a60, 0x5416
+    dw 0x0734, 0x6943, 0x8600, 0xb3e4
+    dw 0x0735, 0x3b88, 0xec80, 0xec3c
+    dw 0x0736, 0x4430, 0x48e0, 0x511a
+    dw 0x0737, 0x9200, 0x9ca0, 0x0038
+    dw 0x0738, 0xa200, 0xe7c2, 0x4dd2
+    dw 0x0739, 0xbe90, 0x2420, 0xa6c4
+    dw 0x073a, 0x30a0, 0xd8b0, 0xcd6c
+    dw 0x073b, 0x7780, 0x80d1, 0xb620
+    dw 0x073c, 0x36c8, 0x4180, 0x3caa
+    dw 0x073d, 0xf784, 0x2100, 0xdcb2
+    dw 0x073e, 0x0628, 0x6180, 0x2c3c
+    dw 0x073f, 0x4600, 0x2fb6, 0x39c8
+    dw 0x0740, 0x8700, 0x5f34, 0xaa4e
+    dw 0x0741, 0x3320, 0xf5e0, 0xed3c
+    dw 0x0742, 0xf020, 0x1d50, 0xd17a
+    dw 0x0743, 0x9e88, 0x2a80, 0x8d4e
+    dw 0x0744, 0xd500, 0x92dc, 0x2c4a
+    dw 0x0745, 0x8600, 0x2540, 0x8020
+    dw 0x0746, 0x2480, 0x2e9c, 0x1770
+    dw 0x0747, 0x7900, 0x26ac, 0x642c
+    dw 0x0748, 0x8ec0, 0x4290, 0x958a
+    dw 0x0749, 0x424c, 0x3700, 0x3d82
+    dw 0x074a, 0x176e, 0xe600, 0xc192
+    dw 0x074b, 0x8200, 0x1f00, 0x8004
+    dw 0x074c, 0x0170, 0x2800, 0x000c
+    dw 0x074d, 0x4e3c, 0xe080, 0xf304
+    dw 0x074e, 0xa800, 0x8550, 0x002a
+    dw 0x074f, 0x0da0, 0xb2a0, 0x84a8
+    dw 0x0750, 0x0d40, 0xa100, 0x8034
+    dw 0x0751, 0x4058, 0xa780, 0xac12
+    dw 0x0752, 0x8a00, 0x9000, 0x0002
+    dw 0x0753, 0xc116, 0x2500, 0xaa5c
+    dw 0x0754, 0x2d98, 0xfb80, 0xed3e
+    dw 0x0755, 0x6500, 0xc8d6, 0xf20c
+    dw 0x0756, 0x9996, 0xf500, 0x52fc
+    dw 0x0757, 0x3de2, 0x2e00, 0x306a
+    dw 0x0758, 0x1800, 0x8500, 0x8002
+    dw 0x0759, 0x9500, 0xdd3e, 0x368e
+    dw 0x075a, 0x3750, 0x22c0, 0x1e2c
+    dw 0x075b, 0xaa00, 0x83a0, 0x002c
+    dw 0x075c, 0x1948, 0x4f80, 0x2cf4
+    dw 0x075d, 0x7720, 0x3fe0, 0x7b04
+    dw 0x075e, 0xd3ae, 0xde00, 0x75c2
+    dw 0x075f, 0xf220, 0x9b20, 0x5174
+    dw 0x0760, 0xaad4, 0x5900, 0xc844
+    dw 0x0761, 0x0e20, 0xf470, 0xc6cc
+    dw 0x0762, 0x25cc, 0xcf00, 0xb912
+    dw 0x0763, 0xe6e0, 0x1360, 0xbe56
+    dw 0x0764, 0xeca0, 0x94d0, 0x4590
+    dw 0x0765, 0xa02e, 0xa700, 0x0b50
+    dw 0x0766, 0xb61e, 0x1600, 0x9096
+    dw 0x0767, 0x4e40, 0x67d0, 0x7a1a
+    dw 0x0768, 0x8370, 0x5920, 0xa068
+    dw 0x0769, 0x8d04, 0xcb00, 0x1c64
+    dw 0x076a, 0x7780, 0xbd48, 0xf8f4
+    dw 0x076b, 0xb8b4, 0xbd80, 0x3a78
+    dw 0x076c, 0x1860, 0x6ab0, 0x4750
+    dw 0x076d, 0x0800, 0x2430, 0x0022
+    dw 0x076e, 0xae00, 0xbeb6, 0x3108
+    dw 0x076f, 0xb260, 0x8a40, 0x027e
+    dw 0x0770, 0x4340, 0x4330, 0x4a84
+    dw 0x0771, 0x8e10, 0x2000, 0x8030
+    dw 0x0772, 0x1580, 0xded8, 0xb8b4
+    dw 0x0773, 0x54c0, 0x3cb8, 0x559a
+    dw 0x0774, 0xd480, 0x17f8, 0xb07c
+    dw 0x0775, 0xbbe2, 0xca00, 0x49ea
+    dw 0x0776, 0x45f8, 0xc840, 0xd258
+    dw 0x0777, 0x0800, 0x8c00, 0x8000
+    dw 0x0778, 0x35f0, 0x96c0, 0x9102
+    dw 0x0779, 0x3380, 0xc678, 0xbe10
+    dw 0x077a, 0x1700, 0xc9bc, 0xa504
+    dw 0x077b, 0x0350, 0x44e0, 0x0c0a
+    dw 0x077c, 0x2db4, 0x4700, 0x38fe
+    dw 0x077d, 0xb5da, 0x3a00, 0xb464
+    dw 0x077e, 0x8900, 0x1f00, 0x8012
+    dw 0x077f, 0xfb00, 0x042a, 0xc34a
+    dw 0x0780, 0xcd00, 0xe07e, 0x719e
+    dw 0x0781, 0x2b6c, 0x5f00, 0x4e7e
+    dw 0x0782, 0xde68, 0x0f80, 0xb202
+    dw 0x0783, 0xf70e, 0x9200, 0x4d4a
+    dw 0x0784, 0xac2b, 0xe200, 0x5240
+    dw 0x0785, 0x3198, 0xca80, 0xc08c
+    dw 0x0786, 0xada0, 0x9450, 0x0610
+    dw 0x0787, 0x2338, 0x5e80, 0x45de
+    dw 0x0788, 0x443a, 0x1f00, 0x2766
+    dw 0x0789, 0xde24, 0xd880, 0x7ae8
+    dw 0x078a, 0xa580, 0x2c0c, 0x9590
+    dw 0x078b, 0x1adc, 0xb880, 0x97b8
+    dw 0x078c, 0x0400, 0xb5c2, 0x8170
+    dw 0x078d, 0x6f9c, 0x3500, 0x68c2
+    dw 0x078e, 0x3a00, 0xc73a, 0xc56c
+    dw 0x078f, 0x8fc0, 0xaee0, 0x0354
+    dw 0x0790, 0x5e00, 0x0756, 0x2980
+    dw 0x0791, 0xe600, 0x9451, 0x3e7a
+    dw 0x0792, 0x2600, 0x33d6, 0x1de0
+    dw 0x0793, 0xed80, 0xc40c, 0x7590
+    dw 0x0794, 0xe380, 0xa4b8, 0x4c6c
+    dw 0x0795, 0x9b54, 0x5100, 0xb094
+    dw 0x0796, 0xdb68, 0x4840, 0xe7de
+    dw 0x0797, 0xb376, 0x4e00, 0xc598
+    dw 0x0798, 0xb500, 0x301e, 0xa926
+    dw 0x0799, 0x46f0, 0x0f40, 0x1a4a
+    dw 0x079a, 0x3a70, 0x0c60, 0x0b0a
+    dw 0x079b, 0x20a0, 0x1fe0, 0x048e
+    dw 0x079c, 0xea20, 0x8760, 0x35a6
+    dw 0x079d, 0xdc70, 0xcd60, 0x6df6
+    dw 0x079e, 0xf02c, 0x1d80, 0xd1bc
+    dw 0x079f, 0x2d5c, 0xef00, 0xe0b0
+    dw 0x07a0, 0x26ca, 0x1400, 0x01b2
+    dw 0x07a1, 0x2480, 0xcf38, 0xb810
+    dw 0x07a2, 0x3b9c, 0x2100, 0x20c2
+    dw 0x07a3, 0xcc60, 0xa9f0, 0x3a7e
+    dw 0x07a4, 0x0540, 0x3c88, 0x05f2
+    dw 0x07a5, 0x7920, 0x8e60, 0xcc16
+    dw 0x07a6, 0xb010, 0xd8e0, 0x4cf4
+    dw 0x07a7, 0x2440, 0x46c8, 0x2f34
+    dw 0x07a8, 0x2d24, 0x0e00, 0x01ee
+    dw 0x07a9, 0x0800, 0x9200, 0x8002
+    dw 0x07aa, 0x2e00, 0x30b1, 0x230a
+    dw 0x07ab, 0x33c0, 0x2430, 0x1c0e
+    dw 0x07ac, 0x6885, 0xba00, 0xe6c8
+    dw 0x07ad, 0x0740, 0x3890, 0x0422
+    dw 0x07ae, 0x2d00, 0x81a0, 0x8020
+    dw 0x07af, 0xc698, 0xcb80, 0x562e
+    dw 0x07b0, 0x916e, 0xbd00, 0x12ca
+    dw 0x07b1, 0xa730, 0x4940, 0xb4b8
+    dw 0x07b2, 0xa900, 0x8440, 0x002a
+    dw 0x07b3, 0xbb00, 0xd174, 0x50c6
+    dw 0x07b4, 0x4200, 0x1eaa, 0x2500
+    dw 0x07b5, 0x8500, 0xed3e, 0x368e
+    dw 0x07b6, 0xf8d0, 0x1f40, 0xdc5c
+    dw 0x07b7, 0x8900, 0x9400, 0x0002
+    dw 0x07b8, 0xbf00, 0x2c3a, 0xaf66
+    dw 0x07b9, 0xeee0, 0x87e0, 0x3ac4
+    dw 0x07ba, 0x3de4, 0xd080, 0xd2a0
+    dw 0x07bb, 0x1d80, 0x8d00, 0x801c
+    dw 0x07bc, 0x74bf, 0xc200, 0xfb1e
+    dw 0x07bd, 0xd1f8, 0x24c0, 0xbb16
+    dw 0x07be, 0x94e0, 0xa820, 0x0284
+    dw 0x07bf, 0x89b8, 0xae00, 0x0112
+    dw 0x07c0, 0xc120, 0xdaa0, 0x603e
+    dw 0x07c1, 0x95d0, 0xbce0, 0x1716
+    dw 0x07c2, 0xdc3c, 0x4780, 0xe7f0
+    dw 0x07c3, 0xaec0, 0xcf70, 0x4246
+    dw 0x07c4, 0xb018, 0x27c0, 0x9bee
+    dw 0x07c5, 0x3000, 0x85d4, 0x80ba
+    dw 0x07c6, 0xd210, 0x01b0, 0x951e
+    dw 0x07c7, 0xbfa2, 0xb600, 0x39ba
+    dw 0x07c8, 0x4700, 0xc244, 0xcd7c
+    dw 0x07c9, 0x0280, 0xea0e, 0xaf92
+    dw 0x07ca, 0xb600, 0x9676, 0x10d8
+    dw 0x07cb, 0x67a0, 0x9260, 0xbe14
+    dw 0x07cc, 0xbe98, 0xa980, 0x2c88
+    dw 0x07cd, 0x2360, 0x9940, 0x826c
+    dw 0x07ce, 0x8180, 0x2980, 0x8010
+    dw 0x07cf, 0x7058, 0x1740, 0x4be0
 .unit_test_end
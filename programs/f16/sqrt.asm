@@ -146,7 +146,7 @@
     prne
     bra .f16_round_pack
 
-    mov neg_rem, neg_rem
+    mov neg_rem, z
     lsr neg_rem, #1
 
     bic z, #1
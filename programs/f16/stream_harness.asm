@@ -0,0 +1,247 @@
+; Runs an f16 operation over test vectors streamed from the simulator's
+; --input file, a window of memory at a time, so that any number of them
+; can be run from one image without reassembling - list after
+; programs/semihost.asm and before the libraries, with the routine under
+; test, and its number of operands (2, or 3 for r2 as well), given by
+; .unit_test_op and .unit_test_operands, e.g.
+;
+;       ./out/gen_test -b out mul
+;       printf '.unit_test_op\n    dw .f16_mul\n' > out/op.asm
+;       printf '.unit_test_operands\n    dw 2\n' >> out/op.asm
+;       ./asm.pl programs/semihost.asm programs/f16/stream_harness.asm \
+;           out/op.asm programs/f16/internal.asm programs/f16/mul.asm \
+;           > out/asm.log
+;       ./out/sim -q -A out/asm.log --input out/mul.bin
+;
+; The input is a sequence of records, each the words a, b, (c) and the
+; expected result, most significant byte first, as written by gen_test -b;
+; a truncated last record is ignored. Each failure is written to stdout as
+;
+;       FAIL index a b (c) expected got
+;
+; in hex, and then the numbers of vectors and failures. Exits with status
+; 1 if any failed.
+
+    def STREAM_BUF      0x8000          ; the window refilled from the input
+    def STREAM_BUF_SIZE 0x6000          ; a whole number of records, of 6 or 8 bytes
+
+.stream_test
+{
+    alias r13 ptr                       ; preserved by the routine under test
+    alias r14 link
+    alias r15 pc
+
+    mov r12, #hi(.unit_test_operands)
+    add r12, #lo(.unit_test_operands)
+    ldw r0, [r12]
+    add r0, #1
+    add r0, r0                          ; the operands and result, in bytes
+    mov r12, #hi(.record_size)
+    add r12, #lo(.record_size)
+    stw r0, [r12]
+
+.refill
+    mov r0, #hi(.STREAM_BUF)
+    add r0, #lo(.STREAM_BUF)
+    mov r1, #hi(.STREAM_BUF_SIZE)
+    add r1, #lo(.STREAM_BUF_SIZE)
+    swi #.SYS_READ_INPUT
+    mov r1, #0
+    sub r1, #1
+    cmp r0, r1
+    preq
+    bra .no_input
+    and r0, r0
+    preq
+    bra .done
+
+    mov ptr, #hi(.STREAM_BUF)
+    add ptr, #lo(.STREAM_BUF)
+    add r0, ptr
+    mov r12, #hi(.buf_end)
+    add r12, #lo(.buf_end)
+    stw r0, [r12]
+
+.loop
+    mov r12, #hi(.buf_end)
+    add r12, #lo(.buf_end)
+    ldw r0, [r12]
+    sub r0, ptr
+    ldw r1, [r12, #2]                   ; .record_size
+    cmp r0, r1
+    prlo
+    bra .refill
+
+    ldw r0, [ptr, #0]
+    ldw r1, [ptr, #2]
+    ldw r2, [ptr, #4]                   ; c, if there are three
+    bl .call
+    mov r12, #hi(.record_size)
+    add r12, #lo(.record_size)
+    ldw r3, [r12]
+    add r3, ptr
+    sub r3, #2                          ; the expected result ends the record
+    ldw r3, [r3]
+    cmp r2, r3
+    prne
+    bra .failure
+
+.continue
+    mov r12, #hi(.count)
+    add r12, #lo(.count)
+    ldw r0, [r12, #2]
+    add r0, #1
+    stw r0, [r12, #2]
+    ldw r0, [r12, #0]
+    mov r1, #0
+    adc r0, r1
+    stw r0, [r12, #0]
+    mov r12, #hi(.record_size)
+    add r12, #lo(.record_size)
+    ldw r0, [r12]
+    add ptr, r0
+    bra .loop
+
+.failure
+    ; r2 = got, r3 = expected
+    mov r8, r2
+    mov r9, r3
+    mov r0, #hi(.fail_msg)
+    add r0, #lo(.fail_msg)
+    mov r1, #.fail_msg_end-.fail_msg
+    swi #.SYS_WRITE
+    mov r12, #hi(.count)
+    add r12, #lo(.count)
+    ldw r5, [r12, #0]
+    bl .put_hex
+    ldw r5, [r12, #2]
+    bl .put_hex
+    bl .put_space
+    ldw r5, [ptr, #0]
+    bl .put_hex
+    bl .put_space
+    ldw r5, [ptr, #2]
+    bl .put_hex
+    bl .put_space
+    mov r12, #hi(.record_size)
+    add r12, #lo(.record_size)
+    ldw r0, [r12]
+    mov r1, #8
+    cmp r0, r1
+    prne
+    bra .put_expected
+    ldw r5, [ptr, #4]
+    bl .put_hex
+    bl .put_space
+.put_expected
+    mov r5, r9
+    bl .put_hex
+    bl .put_space
+    mov r5, r8
+    bl .put_hex
+    mov r0, #10
+    swi #.SYS_PUTC
+
+    mov r12, #hi(.failures)
+    add r12, #lo(.failures)
+    ldw r0, [r12, #2]
+    add r0, #1
+    stw r0, [r12, #2]
+    ldw r0, [r12, #0]
+    mov r1, #0
+    adc r0, r1
+    stw r0, [r12, #0]
+    bra .continue
+
+.done
+    mov r0, #hi(.vectors_msg)
+    add r0, #lo(.vectors_msg)
+    mov r1, #.vectors_msg_end-.vectors_msg
+    swi #.SYS_WRITE
+    mov r12, #hi(.count)
+    add r12, #lo(.count)
+    ldw r5, [r12, #0]
+    bl .put_hex
+    ldw r5, [r12, #2]
+    bl .put_hex
+
+    mov r0, #hi(.failures_msg)
+    add r0, #lo(.failures_msg)
+    mov r1, #.failures_msg_end-.failures_msg
+    swi #.SYS_WRITE
+    mov r12, #hi(.failures)
+    add r12, #lo(.failures)
+    ldw r5, [r12, #0]
+    bl .put_hex
+    ldw r5, [r12, #2]
+    bl .put_hex
+    mov r0, #10
+    swi #.SYS_PUTC
+
+    ldw r0, [r12, #0]
+    ldw r1, [r12, #2]
+    orr r0, r1
+    prne
+    mov r0, #1
+    swi #.SYS_EXIT
+
+.no_input
+    mov r0, #hi(.no_input_msg)
+    add r0, #lo(.no_input_msg)
+    mov r1, #.no_input_msg_end-.no_input_msg
+    swi #.SYS_WRITE
+    mov r0, #1
+    swi #.SYS_EXIT
+
+.call
+    mov r12, #hi(.unit_test_op)
+    add r12, #lo(.unit_test_op)
+    ldw r15, [r12]
+
+; Writes r5 as 4 hex digits, clobbering r0, r5-r7.
+.put_hex
+    mov r6, #4
+.put_hex_loop
+    mov r0, r5
+    lsr r0, #12
+    lsl r5, #4
+    mov r7, #10
+    cmp r0, r7
+    prhs
+    add r0, #0x27                       ; 'a'-'0'-10
+    add r0, #0x30                       ; '0'
+    swi #.SYS_PUTC
+    sub r6, #1
+    prne
+    bra .put_hex_loop
+    mov pc, link
+
+.put_space
+    mov r0, #0x20
+    swi #.SYS_PUTC
+    mov pc, link
+
+.buf_end
+    dw 0
+.record_size
+    dw 0
+.count
+    dw 0, 0
+.failures
+    dw 0, 0
+
+.fail_msg
+    ds "FAIL "
+.fail_msg_end
+.vectors_msg
+    ds "vectors "
+.vectors_msg_end
+.failures_msg
+    ds " failures "
+.failures_msg_end
+.no_input_msg
+    ds "no --input file"
+    db 10
+.no_input_msg_end
+    align
+}
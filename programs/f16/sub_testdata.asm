@@ -679,1329 +679,1335 @@
     dw 0x02a2, 0xffff, 0xfe00, 0x7e00   ;   -max_nan   -qnan
     dw 0x02a3, 0xffff, 0xffff, 0x7e00   ;   -max_nan   -max_nan
 
-    ; Random values
-    dw 0x02a4, 0x2069, 0x091a, 0x2055
-    dw 0x02a5, 0xc971, 0x26a5, 0xc974
-    dw 0x02a6, 0x2dbf, 0x5607, 0xd606
-    dw 0x02a7, 0x51e1, 0xd944, 0x5abc
-    dw 0x02a8, 0xecaf, 0xb6ee, 0xecaf
-    dw 0x02a9, 0x5078, 0xeb19, 0x6b2b
-    dw 0x02aa, 0xb77f, 0x9517, 0xb77a
-    dw 0x02ab, 0xa673, 0x93f2, 0xa633
-    dw 0x02ac, 0x9c17, 0xc5bf, 0x45be
-    dw 0x02ad, 0x859a, 0x4ae8, 0xcae8
-    dw 0x02ae, 0x2518, 0xa825, 0x2ab1
-    dw 0x02af, 0x1b9b, 0xd66f, 0x566f
-    dw 0x02b0, 0x1dd3, 0xc1f7, 0x41fa
-    dw 0x02b1, 0x1dcb, 0x827d, 0x1dd5
-    dw 0x02b2, 0x9cd6, 0xb6b8, 0x36a5
-    dw 0x02b3, 0xa2e6, 0xa5f1, 0x20fc
-    dw 0x02b4, 0x802a, 0xa12b, 0x212b
-    dw 0x02b5, 0xcc96, 0xade9, 0xcc90
-    dw 0x02b6, 0xf733, 0x1e77, 0xf733
-    dw 0x02b7, 0x872e, 0xe3e2, 0x63e2
-    dw 0x02b8, 0xd565, 0xd7a6, 0x5082
-    dw 0x02b9, 0xcefb, 0x8ce5, 0xcefb
-    dw 0x02ba, 0x6cbd, 0x756e, 0xf43f
-    dw 0x02bb, 0x20d7, 0x08d5, 0x20c4
-    dw 0x02bc, 0x3b2e, 0xa671, 0x3b62
-    dw 0x02bd, 0x53bd, 0x6046, 0xdf94
-    dw 0x02be, 0x4e96, 0x6f59, 0xef52
-    dw 0x02bf, 0x36b6, 0x6c69, 0xec69
-    dw 0x02c0, 0x3150, 0x5481, 0xd47e
-    dw 0x02c1, 0xeee6, 0xce26, 0xeee0
-    dw 0x02c2, 0x0b3a, 0x91cc, 0x139a
-    dw 0x02c3, 0x7417, 0x8b64, 0x7417
-    dw 0x02c4, 0x32f7, 0x40ad, 0xc03e
-    dw 0x02c5, 0x394d, 0x2a2a, 0x38ea
-    dw 0x02c6, 0x5f25, 0xc07b, 0x5f2e
-    dw 0x02c7, 0x0e0c, 0x348a, 0xb488
-    dw 0x02c8, 0x9822, 0xdd07, 0x5d07
-    dw 0x02c9, 0xc16f, 0x04df, 0xc16f
-    dw 0x02ca, 0x5276, 0xe246, 0x62ad
-    dw 0x02cb, 0x0db4, 0x8da4, 0x11ac
-    dw 0x02cc, 0x88b7, 0x6172, 0xe172
-    dw 0x02cd, 0xedea, 0xd74d, 0xedcd
-    dw 0x02ce, 0xd0cb, 0x24a0, 0xd0cc
-    dw 0x02cf, 0x43b6, 0x021b, 0x43b6
-    dw 0x02d0, 0x7922, 0x329c, 0x7922
-    dw 0x02d1, 0xd041, 0x845c, 0xd041
-    dw 0x02d2, 0xc468, 0x4459, 0xc860
-    dw 0x02d3, 0x0fc0, 0xf760, 0x7760
-    dw 0x02d4, 0x8506, 0x490d, 0xc90d
-    dw 0x02d5, 0x218a, 0xe42b, 0x642b
-    dw 0x02d6, 0x0989, 0x2f97, 0xaf94
-    dw 0x02d7, 0x18b6, 0xa1ab, 0x22d8
-    dw 0x02d8, 0x0c9e, 0xda25, 0x5a25
-    dw 0x02d9, 0xa68a, 0x5f14, 0xdf14
-    dw 0x02da, 0xbc6c, 0xb43f, 0xbab8
-    dw 0x02db, 0xecb8, 0x4523, 0xecb9
-    dw 0x02dc, 0x15b1, 0xdaa3, 0x5aa3
-    dw 0x02dd, 0x1c71, 0xe67c, 0x667c
-    dw 0x02de, 0x6027, 0xe897, 0x69a1
-    dw 0x02df, 0x7865, 0x92c4, 0x7865
-    dw 0x02e0, 0xb8d8, 0x572c, 0xd736
-    dw 0x02e1, 0x0c81, 0x4e8c, 0xce8c
-    dw 0x02e2, 0x8238, 0x558f, 0xd58f
-    dw 0x02e3, 0x7017, 0x6663, 0x6e95
-    dw 0x02e4, 0x5f18, 0x9fae, 0x5f18
-    dw 0x02e5, 0x00c3, 0xac4c, 0x2c4c
-    dw 0x02e6, 0x593f, 0xa74d, 0x593f
-    dw 0x02e7, 0x0b61, 0x15ab, 0x94bf
-    dw 0x02e8, 0x5b8c, 0xf819, 0x7821
-    dw 0x02e9, 0x5ace, 0x713d, 0xf122
-    dw 0x02ea, 0xd2bc, 0x773f, 0xf742
-    dw 0x02eb, 0x57b9, 0xd200, 0x595c
-    dw 0x02ec, 0xd767, 0x4050, 0xd78a
-    dw 0x02ed, 0x4a65, 0x6a2b, 0xea25
-    dw 0x02ee, 0xf929, 0x4727, 0xf929
-    dw 0x02ef, 0xc157, 0xf65a, 0x765a
-    dw 0x02f0, 0x53a8, 0x0fe4, 0x53a8
-    dw 0x02f1, 0x7892, 0xa937, 0x7892
-    dw 0x02f2, 0xdef6, 0x084f, 0xdef6
-    dw 0x02f3, 0x1fa9, 0x5e0f, 0xde0f
-    dw 0x02f4, 0x0912, 0xcbf5, 0x4bf5
-    dw 0x02f5, 0xb74e, 0xb060, 0xb51e
-    dw 0x02f6, 0xd756, 0xccf9, 0xd618
-    dw 0x02f7, 0x0bec, 0xcf70, 0x4f70
-    dw 0x02f8, 0x27c8, 0xa22c, 0x296f
-    dw 0x02f9, 0x9f07, 0xd4e3, 0x54e3
-    dw 0x02fa, 0x742c, 0x766e, 0xf084
-    dw 0x02fb, 0x1534, 0xbe92, 0x3e93
-    dw 0x02fc, 0xe099, 0x0e5d, 0xe099
-    dw 0x02fd, 0x05b9, 0xa1f1, 0x21fc
-    dw 0x02fe, 0x04b7, 0x5961, 0xd961
-    dw 0x02ff, 0xb1d5, 0x0299, 0xb1d5
-    dw 0x0300, 0x31d0, 0x5c40, 0xdc3f
-    dw 0x0301, 0x0ae8, 0x5179, 0xd179
-    dw 0x0302, 0xba4f, 0x13fb, 0xba51
-    dw 0x0303, 0x1d6e, 0x719e, 0xf19e
-    dw 0x0304, 0xc45b, 0xf4c5, 0x74c5
-    dw 0x0305, 0x3e97, 0xd047, 0x507c
-    dw 0x0306, 0xc435, 0x665f, 0xe663
-    dw 0x0307, 0x4d71, 0x6661, 0xe64b
-    dw 0x0308, 0x0567, 0x2255, 0xa24a
-    dw 0x0309, 0xda8e, 0x7bd5, 0xfbdc
-    dw 0x030a, 0x3789, 0x9920, 0x3793
-    dw 0x030b, 0x5c6f, 0x45e6, 0x5c57
-    dw 0x030c, 0x9ed9, 0x4a9d, 0xca9e
-    dw 0x030d, 0xf83a, 0xb035, 0xf83a
-    dw 0x030e, 0xc7e7, 0xfad3, 0x7ad3
-    dw 0x030f, 0xe205, 0x2427, 0xe205
-    dw 0x0310, 0x05bc, 0x337e, 0xb37d
-    dw 0x0311, 0xde77, 0x19b7, 0xde77
-    dw 0x0312, 0x50ec, 0x5015, 0x46b8
-    dw 0x0313, 0xde12, 0x45b1, 0xde29
-    dw 0x0314, 0x8eac, 0xae59, 0x2e52
-    dw 0x0315, 0x09e6, 0xf50c, 0x750c
-    dw 0x0316, 0xfbcb, 0x7048, 0xfc00
-    dw 0x0317, 0xfa73, 0x1e20, 0xfa73
-    dw 0x0318, 0x4ad6, 0x7648, 0xf647
-    dw 0x0319, 0x55a9, 0xe3f6, 0x6456
-    dw 0x031a, 0xd2b7, 0x9b8f, 0xd2b7
-    dw 0x031b, 0x82cf, 0xd117, 0x5117
-    dw 0x031c, 0xe62c, 0x7b09, 0xfb3a
-    dw 0x031d, 0x814c, 0xae14, 0x2e14
-    dw 0x031e, 0x75dd, 0x6351, 0x75a2
-    dw 0x031f, 0xd23b, 0x7b99, 0xfb9b
-    dw 0x0320, 0x96cf, 0xb0b2, 0x30a4
-    dw 0x0321, 0x9550, 0xe7bc, 0x67bc
-    dw 0x0322, 0x00c7, 0x7362, 0xf362
-    dw 0x0323, 0x2d6d, 0x8f74, 0x2d74
-    dw 0x0324, 0x21bb, 0x3754, 0xb726
-    dw 0x0325, 0x8480, 0x1d86, 0x9d98
-    dw 0x0326, 0xa79c, 0x3ba6, 0xbbe3
-    dw 0x0327, 0xf272, 0xf53b, 0x7004
-    dw 0x0328, 0x914f, 0xd668, 0x5668
-    dw 0x0329, 0xc7f3, 0x2cde, 0xc803
-    dw 0x032a, 0x5937, 0x990a, 0x5937
-    dw 0x032b, 0x130b, 0xd440, 0x5440
-    dw 0x032c, 0x1a57, 0xc11f, 0x4121
-    dw 0x032d, 0x4a1d, 0x935a, 0x4a1d
-    dw 0x032e, 0xc5b6, 0x1478, 0xc5b6
-    dw 0x032f, 0x440d, 0x5b06, 0xdae6
-    dw 0x0330, 0x44d4, 0xce68, 0x4f9d
-    dw 0x0331, 0x29a1, 0xd448, 0x5449
-    dw 0x0332, 0xf024, 0x60f5, 0xf073
-    dw 0x0333, 0x58c8, 0x0daa, 0x58c8
-    dw 0x0334, 0x0891, 0xd7bb, 0x57bb
-    dw 0x0335, 0x4951, 0xfb03, 0x7b03
-    dw 0x0336, 0xccf7, 0xdaa0, 0x5a01
-    dw 0x0337, 0xd16b, 0x94ea, 0xd16b
-    dw 0x0338, 0x077f, 0x2aa2, 0xaa9e
-    dw 0x0339, 0x2df4, 0x1a8a, 0x2dc0
-    dw 0x033a, 0x484b, 0xdba9, 0x5bee
-    dw 0x033b, 0x4900, 0xc5f4, 0x4bfa
-    dw 0x033c, 0x6f03, 0x0eb7, 0x6f03
-    dw 0x033d, 0xda6c, 0xb310, 0xda6a
-    dw 0x033e, 0x69bd, 0xd6a0, 0x69f2
-    dw 0x033f, 0xf7e5, 0x3826, 0xf7e5
-    dw 0x0340, 0x0041, 0xcc2d, 0x4c2d
-    dw 0x0341, 0x284a, 0x6137, 0xe137
-    dw 0x0342, 0x24f6, 0x35f4, 0xb5a5
-    dw 0x0343, 0x69c8, 0x64cc, 0x66c4
-    dw 0x0344, 0xc9a8, 0x59e6, 0xda40
-    dw 0x0345, 0x3637, 0x5e92, 0xde90
-    dw 0x0346, 0x6165, 0x60da, 0x5458
-    dw 0x0347, 0x8c87, 0x7bef, 0xfbef
-    dw 0x0348, 0x5fbd, 0xd4d2, 0x6079
-    dw 0x0349, 0x5798, 0xa8bd, 0x5799
-    dw 0x034a, 0x9ac6, 0xc69b, 0x469a
-    dw 0x034b, 0xb774, 0x7532, 0xf532
-    dw 0x034c, 0x79ac, 0x2132, 0x79ac
-    dw 0x034d, 0x4bd2, 0x7191, 0xf18f
-    dw 0x034e, 0x5958, 0x4c14, 0x58d6
-    dw 0x034f, 0x3dbe, 0x81a2, 0x3dbe
-    dw 0x0350, 0xad4b, 0x62b4, 0xe2b4
-    dw 0x0351, 0xb796, 0x1713, 0xb79d
-    dw 0x0352, 0x5f66, 0x36dc, 0x5f64
-    dw 0x0353, 0x7bdf, 0x290e, 0x7bdf
-    dw 0x0354, 0x90c2, 0xb217, 0x3212
-    dw 0x0355, 0x87a1, 0xf227, 0x7227
-    dw 0x0356, 0x12f1, 0x1428, 0x897c
-    dw 0x0357, 0x6e16, 0x72ae, 0xef46
-    dw 0x0358, 0xe8fa, 0xc5ae, 0xe8f7
-    dw 0x0359, 0x1b6b, 0x83c1, 0x1b89
-    dw 0x035a, 0x8c49, 0xd2e0, 0x52e0
-    dw 0x035b, 0xf8f3, 0x05f5, 0xf8f3
-    dw 0x035c, 0xf412, 0x44c6, 0xf412
-    dw 0x035d, 0x7786, 0x4d6a, 0x7785
-    dw 0x035e, 0x90da, 0xb545, 0x3543
-    dw 0x035f, 0xcf0c, 0x3e25, 0xcf6e
-    dw 0x0360, 0x17f9, 0x86a2, 0x1832
-    dw 0x0361, 0x5538, 0x775f, 0xf75a
-    dw 0x0362, 0xbd7e, 0xd118, 0x50ec
-    dw 0x0363, 0xa06e, 0x4e40, 0xce41
-    dw 0x0364, 0x832f, 0x280f, 0xa811
-    dw 0x0365, 0x4067, 0x9620, 0x4068
-    dw 0x0366, 0x3c37, 0xae7d, 0x3c9f
-    dw 0x0367, 0x08ce, 0x2531, 0xa527
-    dw 0x0368, 0x742b, 0x2439, 0x742b
-    dw 0x0369, 0xa8f2, 0x0075, 0xa8f2
-    dw 0x036a, 0xf719, 0xa1e6, 0xf719
-    dw 0x036b, 0x066a, 0xeb2b, 0x6b2b
-    dw 0x036c, 0xe6ac, 0x3895, 0xe6ad
-    dw 0x036d, 0x7786, 0x3336, 0x7786
-    dw 0x036e, 0x07a1, 0xb5ab, 0x35ab
-    dw 0x036f, 0x4b2f, 0x8e44, 0x4b2f
-    dw 0x0370, 0x0ae3, 0xc28f, 0x428f
-    dw 0x0371, 0x4bc2, 0xdbfb, 0x5c3c
-    dw 0x0372, 0x62fd, 0x9a03, 0x62fd
-    dw 0x0373, 0x5f2a, 0x8b0c, 0x5f2a
-    dw 0x0374, 0xda6a, 0xf54a, 0x753d
-    dw 0x0375, 0xc743, 0x88e8, 0xc743
-    dw 0x0376, 0xec74, 0x2252, 0xec74
-    dw 0x0377, 0x9567, 0x196b, 0x9c0f
-    dw 0x0378, 0x374d, 0x03f3, 0x374d
-    dw 0x0379, 0x0497, 0x1df9, 0x9de7
-    dw 0x037a, 0x81e4, 0x3d2c, 0xbd2c
-    dw 0x037b, 0x957f, 0xb51a, 0x3515
-    dw 0x037c, 0x44ce, 0x4b2a, 0xc8c3
-    dw 0x037d, 0x0049, 0xd312, 0x5312
-    dw 0x037e, 0x560d, 0xc2d8, 0x5644
-    dw 0x037f, 0x1ed4, 0x3209, 0xb1d2
-    dw 0x0380, 0x25d5, 0xb8d7, 0x3906
-    dw 0x0381, 0x9133, 0xb0e1, 0x30dc
-    dw 0x0382, 0x9342, 0x867e, 0x9272
-    dw 0x0383, 0x7824, 0x1c2a, 0x7824
-    dw 0x0384, 0x8496, 0x6499, 0xe499
-    dw 0x0385, 0x193d, 0xa6e8, 0x2790
-    dw 0x0386, 0xfa00, 0x16c6, 0xfa00
-    dw 0x0387, 0xc054, 0x314d, 0xc0a9
-    dw 0x0388, 0x1ab9, 0xc4eb, 0x44ec
-    dw 0x0389, 0x4f46, 0x9c9d, 0x4f46
-    dw 0x038a, 0x0217, 0xe4c5, 0x64c5
-    dw 0x038b, 0x51b7, 0x46e5, 0x50da
-    dw 0x038c, 0x2fef, 0x5200, 0xd1fc
-    dw 0x038d, 0x19f7, 0x85fc, 0x1a27
-    dw 0x038e, 0x14d9, 0x38cc, 0xb8ca
-    dw 0x038f, 0xb805, 0x3aae, 0xbd5a
-    dw 0x0390, 0xf1a3, 0x4939, 0xf1a4
-    dw 0x0391, 0xeb90, 0x84e5, 0xeb90
-    dw 0x0392, 0xcfb7, 0x63b4, 0xe3f2
-    dw 0x0393, 0xa10f, 0x544d, 0xd44d
-    dw 0x0394, 0xc84d, 0xba4d, 0xc7d0
-    dw 0x0395, 0xfb36, 0xc24d, 0xfb36
-    dw 0x0396, 0xd113, 0xbb8a, 0xd0f5
-    dw 0x0397, 0xf39a, 0xebcc, 0xf1a7
-    dw 0x0398, 0x8075, 0x42e0, 0xc2e0
-    dw 0x0399, 0x8869, 0x828c, 0x8646
-    dw 0x039a, 0x27a5, 0xda20, 0x5a20
-    dw 0x039b, 0xc972, 0x5794, 0xd821
-    dw 0x039c, 0x2c20, 0xe369, 0x6369
-    dw 0x039d, 0xdd91, 0x40f9, 0xdd9b
-    dw 0x039e, 0x1c35, 0x9596, 0x1d9a
-    dw 0x039f, 0x7ba8, 0x0dd9, 0x7ba8
-    dw 0x03a0, 0xdecf, 0x6738, 0xe876
-    dw 0x03a1, 0x92be, 0xae86, 0x2e79
-    dw 0x03a2, 0xcaec, 0x33ce, 0xcb0b
-    dw 0x03a3, 0x02d4, 0x933a, 0x1394
-    dw 0x03a4, 0xee1b, 0x5587, 0xee31
-    dw 0x03a5, 0xbf2e, 0xb994, 0xbc64
-    dw 0x03a6, 0x4922, 0xaafa, 0x4929
-    dw 0x03a7, 0x3a09, 0x8c02, 0x3a0a
-    dw 0x03a8, 0x3363, 0xbc95, 0x3d81
-    dw 0x03a9, 0xb3a8, 0x0d83, 0xb3ab
-    dw 0x03aa, 0x8607, 0x0b3c, 0x8d20
-    dw 0x03ab, 0x39a3, 0x6971, 0xe971
-    dw 0x03ac, 0xe8cd, 0x7a9d, 0xfaea
-    dw 0x03ad, 0x85a6, 0xf645, 0x7645
-    dw 0x03ae, 0x937f, 0x5d33, 0xdd33
-    dw 0x03af, 0x5d7d, 0x263e, 0x5d7d
-    dw 0x03b0, 0x0bba, 0x2869, 0xa861
-    dw 0x03b1, 0x5a0c, 0x0e8e, 0x5a0c
-    dw 0x03b2, 0xbba3, 0x4827, 0xc8a1
-    dw 0x03b3, 0x0c98, 0x112b, 0x8dbe
-    dw 0x03b4, 0x0755, 0xc62c, 0x462c
-    dw 0x03b5, 0x5a4d, 0xb24f, 0x5a4f
-    dw 0x03b6, 0x0035, 0xe64f, 0x664f
-    dw 0x03b7, 0xe5b2, 0xbcca, 0xe5b1
-    dw 0x03b8, 0x99f7, 0xf335, 0x7335
-    dw 0x03b9, 0x42d2, 0xa534, 0x42dc
-    dw 0x03ba, 0x2cd8, 0xac43, 0x308e
-    dw 0x03bb, 0x8e01, 0xa775, 0x275d
-    dw 0x03bc, 0x31e9, 0x0c65, 0x31e7
-    dw 0x03bd, 0x9dba, 0xc569, 0x4568
-    dw 0x03be, 0x6999, 0xfb37, 0x7b91
-    dw 0x03bf, 0xeba7, 0x7553, 0xf648
-    dw 0x03c0, 0x23a1, 0x45b3, 0xc5af
-    dw 0x03c1, 0x83e1, 0xdf44, 0x5f44
-    dw 0x03c2, 0x8dda, 0x9079, 0x0a30
-    dw 0x03c3, 0xf06f, 0x952f, 0xf06f
-    dw 0x03c4, 0x56a5, 0x4abc, 0x55ce
-    dw 0x03c5, 0x477e, 0x56da, 0xd662
-    dw 0x03c6, 0x310c, 0x2d30, 0x2ce8
-    dw 0x03c7, 0x13a4, 0xcb03, 0x4b03
-    dw 0x03c8, 0x2065, 0x5676, 0xd676
-    dw 0x03c9, 0x7037, 0x4d3d, 0x7034
-    dw 0x03ca, 0x02b9, 0xf4b3, 0x74b3
-    dw 0x03cb, 0x34a3, 0x0a9e, 0x34a2
-    dw 0x03cc, 0x926d, 0xfa0c, 0x7a0c
-    dw 0x03cd, 0x7437, 0x8da5, 0x7437
-    dw 0x03ce, 0xe5b3, 0xe98a, 0x6561
-    dw 0x03cf, 0xb146, 0x2b66, 0xb320
-    dw 0x03d0, 0x6d6b, 0x908a, 0x6d6b
-    dw 0x03d1, 0xb940, 0x80fa, 0xb940
-    dw 0x03d2, 0x4e6f, 0x5489, 0xd1da
-    dw 0x03d3, 0xcbb6, 0x95ed, 0xcbb6
-    dw 0x03d4, 0xab63, 0xc31d, 0x42ff
-    dw 0x03d5, 0xbf08, 0xc7c6, 0x4604
-    dw 0x03d6, 0xe382, 0x157e, 0xe382
-    dw 0x03d7, 0x37fd, 0x30bf, 0x359e
-    dw 0x03d8, 0x1838, 0x3636, 0xb62e
-    dw 0x03d9, 0x2572, 0x4cdb, 0xccda
-    dw 0x03da, 0x40d5, 0xb7e0, 0x41d1
-    dw 0x03db, 0x46e7, 0xb50c, 0x4738
-    dw 0x03dc, 0x4585, 0x2c9a, 0x4573
-    dw 0x03dd, 0x9e97, 0xf6cb, 0x76cb
-    dw 0x03de, 0x5800, 0x0c02, 0x5800
-    dw 0x03df, 0x8755, 0x1140, 0x922b
-    dw 0x03e0, 0x09e7, 0x084f, 0x0330
-    dw 0x03e1, 0x5faf, 0x5e70, 0x54fc
-    dw 0x03e2, 0xd406, 0xf59c, 0x7598
-    dw 0x03e3, 0x09d4, 0xd0c8, 0x50c8
-    dw 0x03e4, 0xb8b9, 0xc8dc, 0x4890
-    dw 0x03e5, 0x988e, 0x9c3b, 0x17d0
-    dw 0x03e6, 0xde5a, 0xd08c, 0xddc8
-    dw 0x03e7, 0xccfa, 0xf692, 0x7691
-    dw 0x03e8, 0x06c2, 0xf26d, 0x726d
-    dw 0x03e9, 0x436d, 0x4797, 0xc3c1
-    dw 0x03ea, 0xaa4d, 0x8a54, 0xaa47
-    dw 0x03eb, 0xefd2, 0xb6ee, 0xefd2
-    dw 0x03ec, 0x9b3b, 0xe69d, 0x669d
-    dw 0x03ed, 0x0eee, 0xa73d, 0x2759
-    dw 0x03ee, 0x6df2, 0x202e, 0x6df2
-    dw 0x03ef, 0xb124, 0x7642, 0xf642
-    dw 0x03f0, 0x0f95, 0x4a48, 0xca48
-    dw 0x03f1, 0x7579, 0x1969, 0x7579
-    dw 0x03f2, 0x1b10, 0x2e32, 0xadfa
-    dw 0x03f3, 0xe245, 0xb39f, 0xe245
-    dw 0x03f4, 0xca6d, 0xc09f, 0xc945
-    dw 0x03f5, 0x842b, 0x9768, 0x1725
-    dw 0x03f6, 0xb732, 0x8aed, 0xb731
-    dw 0x03f7, 0x89d5, 0xfa9f, 0x7a9f
-    dw 0x03f8, 0xd285, 0x3422, 0xd28d
-    dw 0x03f9, 0x84f4, 0xcf29, 0x4f29
-    dw 0x03fa, 0x23f4, 0x3be2, 0xbbc2
-    dw 0x03fb, 0x6a64, 0x0a91, 0x6a64
-    dw 0x03fc, 0x4ad1, 0x11a1, 0x4ad1
-    dw 0x03fd, 0x7883, 0x6aff, 0x7813
-    dw 0x03fe, 0xc2c6, 0xeec5, 0x6ec4
-    dw 0x03ff, 0xeadd, 0xd25b, 0xeac4
-    dw 0x0400, 0x390d, 0x6056, 0xe055
-    dw 0x0401, 0xebc4, 0x541e, 0xebe5
-    dw 0x0402, 0x8e89, 0xce09, 0x4e09
-    dw 0x0403, 0x07bd, 0x58f6, 0xd8f6
-    dw 0x0404, 0x8ea8, 0x8be8, 0x8968
-    dw 0x0405, 0xf05e, 0x45da, 0xf05f
-    dw 0x0406, 0x16d5, 0x7a33, 0xfa33
-    dw 0x0407, 0x407a, 0xe95a, 0x695b
-    dw 0x0408, 0xae55, 0xc56e, 0x4555
-    dw 0x0409, 0xb883, 0xd249, 0x5237
-    dw 0x040a, 0x0150, 0x22e7, 0xa2e4
-    dw 0x040b, 0xdcda, 0x4c21, 0xdd1c
-    dw 0x040c, 0x3489, 0x555e, 0xd559
-    dw 0x040d, 0xb721, 0xf74f, 0x774f
-    dw 0x040e, 0x4423, 0xa1fe, 0x4426
-    dw 0x040f, 0xc9aa, 0x0254, 0xc9aa
-    dw 0x0410, 0xb56e, 0xd14f, 0x5144
-    dw 0x0411, 0x90dd, 0x8377, 0x906e
-    dw 0x0412, 0xd90c, 0xe9d4, 0x6983
-    dw 0x0413, 0x121f, 0x64f4, 0xe4f4
-    dw 0x0414, 0xda32, 0x57fa, 0xdd18
-    dw 0x0415, 0x7bc9, 0x5466, 0x7bc7
-    dw 0x0416, 0x9874, 0x6524, 0xe524
-    dw 0x0417, 0x02bb, 0x5de2, 0xdde2
-    dw 0x0418, 0x1da7, 0xd505, 0x5505
-    dw 0x0419, 0x5f32, 0x408f, 0x5f29
-    dw 0x041a, 0xb1df, 0xab54, 0xb00a
-    dw 0x041b, 0x7518, 0x073d, 0x7518
-    dw 0x041c, 0x6275, 0x6c67, 0xeb31
-    dw 0x041d, 0x4b61, 0x0473, 0x4b61
-    dw 0x041e, 0x3611, 0xc892, 0x48c3
-    dw 0x041f, 0x06c7, 0xeb7f, 0x6b7f
-    dw 0x0420, 0x99e1, 0x97a5, 0x941d
-    dw 0x0421, 0x6ef6, 0x72ed, 0xeee4
-    dw 0x0422, 0x8179, 0x8115, 0x8064
-    dw 0x0423, 0xd7e1, 0x5bab, 0xddce
-    dw 0x0424, 0xd90f, 0x53aa, 0xdafa
-    dw 0x0425, 0xb011, 0x7183, 0xf183
-    dw 0x0426, 0xb8ce, 0xb2cd, 0xb636
-    dw 0x0427, 0xcf65, 0xd676, 0x549d
-    dw 0x0428, 0x87d2, 0x2e98, 0xae9a
-    dw 0x0429, 0x1705, 0x39b1, 0xb9ad
-    dw 0x042a, 0xd9ec, 0x8c1d, 0xd9ec
-    dw 0x042b, 0x40ef, 0x3c61, 0x3d7d
-    dw 0x042c, 0xf884, 0x8c50, 0xf884
-    dw 0x042d, 0x40d4, 0x2e95, 0x409f
-    dw 0x042e, 0x54e2, 0x479b, 0x5468
-    dw 0x042f, 0x1a14, 0xeec3, 0x6ec3
-    dw 0x0430, 0xdf40, 0x890a, 0xdf40
-    dw 0x0431, 0x61b0, 0x60b9, 0x57b8
-    dw 0x0432, 0x0a1f, 0x3991, 0xb991
-    dw 0x0433, 0xbc65, 0xe32f, 0x632d
-    dw 0x0434, 0x8d3b, 0x6c76, 0xec76
-    dw 0x0435, 0x54b2, 0x460a, 0x5451
-    dw 0x0436, 0x1f43, 0x2418, 0xa08e
-    dw 0x0437, 0x1c80, 0xa715, 0x281a
-    dw 0x0438, 0x52b0, 0x3385, 0x52a8
-    dw 0x0439, 0xe0c7, 0x2c9c, 0xe0c7
-    dw 0x043a, 0xbfa2, 0x21b6, 0xbfad
-    dw 0x043b, 0x68fd, 0xb826, 0x68fd
-    dw 0x043c, 0xae06, 0xa9d1, 0xaa3b
-    dw 0x043d, 0xe6bb, 0x02e8, 0xe6bb
-    dw 0x043e, 0xf16c, 0x00cf, 0xf16c
-    dw 0x043f, 0xf1ab, 0xd0ad, 0xf1a6
-    dw 0x0440, 0x89d9, 0x535b, 0xd35b
-    dw 0x0441, 0x3166, 0x93f8, 0x316e
-    dw 0x0442, 0x8cec, 0xedcb, 0x6dcb
-    dw 0x0443, 0x7727, 0x1a27, 0x7727
-    dw 0x0444, 0x5a42, 0xcbda, 0x5ac0
-    dw 0x0445, 0x6031, 0x7985, 0xf974
-    dw 0x0446, 0xeff2, 0x209b, 0xeff2
-    dw 0x0447, 0x42a2, 0xb036, 0x42e5
-    dw 0x0448, 0x0162, 0x6f3e, 0xef3e
-    dw 0x0449, 0x6fd8, 0x2318, 0x6fd8
-    dw 0x044a, 0xd83b, 0x27fe, 0xd83b
-    dw 0x044b, 0xd11e, 0x820c, 0xd11e
-    dw 0x044c, 0x0eb9, 0xd406, 0x5406
-    dw 0x044d, 0x7378, 0x0f88, 0x7378
-    dw 0x044e, 0xc5b1, 0x4425, 0xc8eb
-    dw 0x044f, 0x9961, 0x190c, 0x9d36
-    dw 0x0450, 0x758c, 0x2d5a, 0x758c
-    dw 0x0451, 0xa5f8, 0x6357, 0xe357
-    dw 0x0452, 0xa481, 0xc01f, 0x4016
-    dw 0x0453, 0xbd99, 0x705b, 0xf05b
-    dw 0x0454, 0x2051, 0x371f, 0xb6fc
-    dw 0x0455, 0x604d, 0x9d02, 0x604d
-    dw 0x0456, 0x57ba, 0xa2ef, 0x57ba
-    dw 0x0457, 0x4d39, 0x591c, 0xd875
-    dw 0x0458, 0x122d, 0xbd11, 0x3d12
-    dw 0x0459, 0xea68, 0xe510, 0xe7c0
-    dw 0x045a, 0x4d52, 0x6c74, 0xec6f
-    dw 0x045b, 0xf3c9, 0x2158, 0xf3c9
-    dw 0x045c, 0xdfed, 0x0352, 0xdfed
-    dw 0x045d, 0xe709, 0x2412, 0xe709
-    dw 0x045e, 0x9cb3, 0x0015, 0x9cb3
-    dw 0x045f, 0x999e, 0xca0d, 0x4a0d
-    dw 0x0460, 0xa60d, 0x6e8f, 0xee8f
-    dw 0x0461, 0x662c, 0xba8f, 0x662d
-    dw 0x0462, 0xdeea, 0x867d, 0xdeea
-    dw 0x0463, 0xf1ae, 0x3f38, 0xf1ae
-    dw 0x0464, 0x2380, 0x4968, 0xc966
-    dw 0x0465, 0xe227, 0x70b9, 0xf11b
-    dw 0x0466, 0xa284, 0xf455, 0x7455
-    dw 0x0467, 0x2dca, 0x1eb8, 0x2d5e
-    dw 0x0468, 0xdebd, 0x12da, 0xdebd
-    dw 0x0469, 0x6c0a, 0x4b32, 0x6c06
-    dw 0x046a, 0x06a4, 0x8d62, 0x0f0b
-    dw 0x046b, 0x2b1f, 0x09f6, 0x2b19
-    dw 0x046c, 0x746b, 0x4f31, 0x7469
-    dw 0x046d, 0xa6a9, 0x7480, 0xf480
-    dw 0x046e, 0xe8d0, 0x70b7, 0xf1eb
-    dw 0x046f, 0x1a8d, 0xe5c6, 0x65c6
-    dw 0x0470, 0xdf46, 0x80ba, 0xdf46
-    dw 0x0471, 0xa055, 0xbe30, 0x3e27
-    dw 0x0472, 0x0737, 0x9204, 0x12eb
-    dw 0x0473, 0x2ab7, 0xdb6c, 0x5b6c
-    dw 0x0474, 0xdf90, 0x9b70, 0xdf90
-    dw 0x0475, 0xd3e5, 0xc93b, 0xd296
-    dw 0x0476, 0x9ca9, 0xb2a2, 0x327d
-    dw 0x0477, 0xdc15, 0x08b4, 0xdc15
-    dw 0x0478, 0xe2b9, 0x9616, 0xe2b9
-    dw 0x0479, 0x28f3, 0xecaf, 0x6caf
-    dw 0x047a, 0x0a82, 0x7825, 0xf825
-    dw 0x047b, 0x9359, 0x60f5, 0xe0f5
-    dw 0x047c, 0x0410, 0x9990, 0x19b0
-    dw 0x047d, 0x46bb, 0xe356, 0x6363
-    dw 0x047e, 0x1a4a, 0xe710, 0x6710
-    dw 0x047f, 0xa186, 0x2181, 0xa584
-    dw 0x0480, 0x7914, 0x9eef, 0x7914
-    dw 0x0481, 0x4c39, 0x5481, 0xd2e6
-    dw 0x0482, 0xe7a9, 0xd272, 0xe775
-    dw 0x0483, 0x5264, 0xb0e4, 0x5269
-    dw 0x0484, 0x6f1b, 0x0506, 0x6f1b
-    dw 0x0485, 0x8cfa, 0x77cf, 0xf7cf
-    dw 0x0486, 0x02db, 0x6fb3, 0xefb3
-    dw 0x0487, 0x0de6, 0x2bce, 0xabc2
-    dw 0x0488, 0x5c63, 0x1868, 0x5c63
-    dw 0x0489, 0xa3f3, 0xefbc, 0x6fbc
-    dw 0x048a, 0x976a, 0x04e8, 0x97b8
-    dw 0x048b, 0xf3cc, 0x30fa, 0xf3cc
-    dw 0x048c, 0x4ba3, 0xd722, 0x580b
-    dw 0x048d, 0x4b44, 0x32b4, 0x4b29
-    dw 0x048e, 0x78a8, 0x6cc6, 0x780f
-    dw 0x048f, 0xabc8, 0x1797, 0xac02
-    dw 0x0490, 0xb8ff, 0x0049, 0xb8ff
-    dw 0x0491, 0x9616, 0xa0a8, 0x1fca
-    dw 0x0492, 0xd2bb, 0xe87a, 0x685f
-    dw 0x0493, 0x518d, 0x41d7, 0x5130
-    dw 0x0494, 0xed81, 0xde87, 0xed19
-    dw 0x0495, 0xb9a6, 0xf05c, 0x705c
-    dw 0x0496, 0x4e3a, 0xc78c, 0x500e
-    dw 0x0497, 0x1c2a, 0xaa9d, 0x2b22
-    dw 0x0498, 0xdff4, 0xc01e, 0xdfec
-    dw 0x0499, 0x9a59, 0x775f, 0xf75f
-    dw 0x049a, 0xc506, 0x8e25, 0xc506
-    dw 0x049b, 0xa859, 0x10aa, 0xa86c
-    dw 0x049c, 0x6547, 0xf39e, 0x7423
-    dw 0x049d, 0x435e, 0xddf0, 0x5dff
-    dw 0x049e, 0x6064, 0xef26, 0x6fb2
-    dw 0x049f, 0xf587, 0x1963, 0xf587
-    dw 0x04a0, 0xef70, 0x8b9e, 0xef70
-    dw 0x04a1, 0xba0b, 0xc22b, 0x40a8
-    dw 0x04a2, 0x7418, 0x0b98, 0x7418
-    dw 0x04a3, 0x0402, 0x6199, 0xe199
-    dw 0x04a4, 0xea1f, 0xbda9, 0xea1e
-    dw 0x04a5, 0x51f5, 0x385a, 0x51e4
-    dw 0x04a6, 0x8535, 0x6e20, 0xee20
-    dw 0x04a7, 0xe2f7, 0x652a, 0xe853
-    dw 0x04a8, 0x2e3e, 0xdc89, 0x5c89
-    dw 0x04a9, 0xf344, 0x0b76, 0xf344
-    dw 0x04aa, 0x84e2, 0x03ee, 0x8868
-    dw 0x04ab, 0x70be, 0x7880, 0xf6a1
-    dw 0x04ac, 0x474c, 0x4eae, 0xccdb
-    dw 0x04ad, 0xd8e4, 0x3673, 0xd8e7
-    dw 0x04ae, 0x4435, 0xf247, 0x7248
-    dw 0x04af, 0x25e3, 0xcfd3, 0x4fd4
-    dw 0x04b0, 0xac53, 0xe80e, 0x680e
-    dw 0x04b1, 0x43ec, 0xb7eb, 0x4475
-    dw 0x04b2, 0xec11, 0xa585, 0xec11
-    dw 0x04b3, 0xa20b, 0xa9ba, 0x2837
-    dw 0x04b4, 0xf77b, 0xda65, 0xf76e
-    dw 0x04b5, 0x2eef, 0x659b, 0xe59b
-    dw 0x04b6, 0xbd5c, 0x9419, 0xbd5b
-    dw 0x04b7, 0x93d9, 0x3aad, 0xbaaf
-    dw 0x04b8, 0x70a2, 0x871d, 0x70a2
-    dw 0x04b9, 0x4624, 0xf585, 0x7585
-    dw 0x04ba, 0x8b0c, 0xb6e2, 0x36e1
-    dw 0x04bb, 0x6e05, 0xd258, 0x6e12
-    dw 0x04bc, 0x0590, 0x46ea, 0xc6ea
-    dw 0x04bd, 0x08cb, 0x49c5, 0xc9c5
-    dw 0x04be, 0x3931, 0x2eae, 0x385b
-    dw 0x04bf, 0x1999, 0xe584, 0x6584
-    dw 0x04c0, 0x16bd, 0x5d85, 0xdd85
-    dw 0x04c1, 0x9d70, 0x02ce, 0x9d7b
-    dw 0x04c2, 0x030a, 0x3f7b, 0xbf7b
-    dw 0x04c3, 0xac88, 0xfa85, 0x7a85
-    dw 0x04c4, 0x19e0, 0xdb77, 0x5b77
-    dw 0x04c5, 0x6020, 0xd73c, 0x6108
-    dw 0x04c6, 0x6f91, 0xf3f9, 0x75e1
-    dw 0x04c7, 0x11ea, 0xe033, 0x6033
-    dw 0x04c8, 0x7b17, 0x580e, 0x7b13
-    dw 0x04c9, 0xd5b8, 0x0623, 0xd5b8
-    dw 0x04ca, 0x0ef0, 0x43be, 0xc3be
-    dw 0x04cb, 0xd87b, 0x1480, 0xd87b
-    dw 0x04cc, 0x8aa8, 0xe147, 0x6147
-    dw 0x04cd, 0x5e45, 0xc3d9, 0x5e55
-    dw 0x04ce, 0x0ff5, 0x77de, 0xf7de
-    dw 0x04cf, 0xa95e, 0x26b2, 0xac5c
-    dw 0x04d0, 0xd563, 0x46ce, 0xd5d0
-    dw 0x04d1, 0x2980, 0xd86e, 0x586e
-    dw 0x04d2, 0x8649, 0xd608, 0x5608
-    dw 0x04d3, 0xd2f3, 0xa029, 0xd2f3
-    dw 0x04d4, 0xb180, 0x3314, 0xb64a
-    dw 0x04d5, 0x7765, 0x2111, 0x7765
-    dw 0x04d6, 0x270d, 0x894f, 0x2718
-    dw 0x04d7, 0x0144, 0xa224, 0x2227
-    dw 0x04d8, 0xe15d, 0xd6fd, 0xe07d
-    dw 0x04d9, 0xa847, 0xf04d, 0x704d
-    dw 0x04da, 0x1abb, 0x80c3, 0x1ac1
-    dw 0x04db, 0x04cd, 0xa563, 0x2568
-    dw 0x04dc, 0x620a, 0x6313, 0xd824
-    dw 0x04dd, 0x693c, 0x71ff, 0xf0b0
-    dw 0x04de, 0xdaf1, 0x129a, 0xdaf1
-    dw 0x04df, 0x98b2, 0xb055, 0x3042
-    dw 0x04e0, 0x5968, 0xc232, 0x5981
-    dw 0x04e1, 0x88c3, 0xdfb1, 0x5fb1
-    dw 0x04e2, 0x983b, 0x5bb6, 0xdbb6
-    dw 0x04e3, 0x49bb, 0x8eca, 0x49bb
-    dw 0x04e4, 0xf740, 0x6acc, 0xf80d
-    dw 0x04e5, 0xb5d8, 0x808f, 0xb5d8
-    dw 0x04e6, 0x6c10, 0x57fc, 0x6be0
-    dw 0x04e7, 0x61ed, 0x430d, 0x61e6
-    dw 0x04e8, 0x0044, 0x523a, 0xd23a
-    dw 0x04e9, 0x5dc8, 0x8107, 0x5dc8
-    dw 0x04ea, 0x5708, 0x032b, 0x5708
-    dw 0x04eb, 0xe311, 0xba1b, 0xe30f
-    dw 0x04ec, 0x6c68, 0x5510, 0x6c54
-    dw 0x04ed, 0x950c, 0xedc2, 0x6dc2
-    dw 0x04ee, 0x4561, 0xd86b, 0x5896
-    dw 0x04ef, 0xaff5, 0xce24, 0x4e1c
-    dw 0x04f0, 0xb81c, 0x4830, 0xc872
-    dw 0x04f1, 0x29db, 0x37f7, 0xb73c
-    dw 0x04f2, 0x91eb, 0xb8a5, 0x38a4
-    dw 0x04f3, 0x2f37, 0x6e7d, 0xee7d
-    dw 0x04f4, 0xafc6, 0x68c7, 0xe8c7
-    dw 0x04f5, 0xc67a, 0x11b3, 0xc67a
-    dw 0x04f6, 0xabd5, 0xc6be, 0x46ae
-    dw 0x04f7, 0x63ee, 0x099d, 0x63ee
-    dw 0x04f8, 0x47c5, 0xbaf6, 0x4852
-    dw 0x04f9, 0x0cc9, 0x2ad6, 0xaacc
-    dw 0x04fa, 0x7511, 0x7931, 0xf551
-    dw 0x04fb, 0x0a1d, 0xf833, 0x7833
-    dw 0x04fc, 0x6da9, 0x4f7f, 0x6da2
-    dw 0x04fd, 0xd09e, 0x1d9e, 0xd09e
-    dw 0x04fe, 0x1da3, 0x88bb, 0x1dc9
-    dw 0x04ff, 0x65ce, 0x477e, 0x65c7
-    dw 0x0500, 0xc0b2, 0xf7b9, 0x77b9
-    dw 0x0501, 0x0024, 0xefe9, 0x6fe9
-    dw 0x0502, 0xf470, 0x6ea1, 0xf618
-    dw 0x0503, 0x9faf, 0x5d37, 0xdd37
-    dw 0x0504, 0x351b, 0xb163, 0x37cc
-    dw 0x0505, 0x090c, 0xfbd9, 0x7bd9
-    dw 0x0506, 0x1551, 0x12aa, 0x0ff0
-    dw 0x0507, 0x439e, 0xd047, 0x50c1
-    dw 0x0508, 0x1f73, 0x6e74, 0xee74
-    dw 0x0509, 0x4558, 0x98a4, 0x4559
-    dw 0x050a, 0xee5b, 0x4f75, 0xee62
-    dw 0x050b, 0x90d7, 0x5c04, 0xdc04
-    dw 0x050c, 0x9ef4, 0x6176, 0xe176
-    dw 0x050d, 0x79a2, 0xbc98, 0x79a2
-    dw 0x050e, 0xea31, 0xdf70, 0xe943
-    dw 0x050f, 0x0416, 0xaae3, 0x2ae5
-    dw 0x0510, 0xd729, 0x043a, 0xd729
-    dw 0x0511, 0x9acc, 0xcb99, 0x4b99
-    dw 0x0512, 0x72dc, 0x3a7b, 0x72dc
-    dw 0x0513, 0x28d0, 0xa7f7, 0x2c66
-    dw 0x0514, 0xebde, 0x31dd, 0xebde
-    dw 0x0515, 0xa3d1, 0x012f, 0xa3d3
-    dw 0x0516, 0x4487, 0xe76f, 0x6774
-    dw 0x0517, 0xd176, 0x63fa, 0xe429
-    dw 0x0518, 0x55e4, 0x16ce, 0x55e4
-    dw 0x0519, 0x443f, 0x6644, 0xe640
-    dw 0x051a, 0x8d75, 0xa043, 0x2017
-    dw 0x051b, 0x0538, 0xeeeb, 0x6eeb
-    dw 0x051c, 0x19e5, 0xc1d0, 0x41d1
-    dw 0x051d, 0xd91c, 0xf955, 0x7950
-    dw 0x051e, 0xc5e7, 0x83ff, 0xc5e7
-    dw 0x051f, 0xd07e, 0xca21, 0xcdec
-    dw 0x0520, 0x1ecb, 0x9c17, 0x2171
-    dw 0x0521, 0x3cfd, 0x5947, 0xd93d
-    dw 0x0522, 0xc4e7, 0xe4f5, 0x64f0
-    dw 0x0523, 0x4525, 0xf6c4, 0x76c4
-    dw 0x0524, 0x88c6, 0x4655, 0xc655
-    dw 0x0525, 0x3b4b, 0x7035, 0xf035
-    dw 0x0526, 0x17cb, 0x9f45, 0x209c
-    dw 0x0527, 0xc619, 0x2e9a, 0xc633
-    dw 0x0528, 0x9be3, 0x0a58, 0x9c24
-    dw 0x0529, 0x94de, 0x2959, 0xa980
-    dw 0x052a, 0xaa9b, 0x9a16, 0xaa3a
-    dw 0x052b, 0x1844, 0xc480, 0x4481
-    dw 0x052c, 0x5be7, 0xf161, 0x7181
-    dw 0x052d, 0xbdd5, 0x21ce, 0xbde1
-    dw 0x052e, 0x7560, 0x8e53, 0x7560
-    dw 0x052f, 0xebef, 0x942c, 0xebef
-    dw 0x0530, 0x2a6a, 0x28ed, 0x21f4
-    dw 0x0531, 0xed73, 0xef52, 0x677c
-    dw 0x0532, 0x0de2, 0x3298, 0xb295
-    dw 0x0533, 0xe616, 0x96a8, 0xe616
-    dw 0x0534, 0x78ed, 0x2162, 0x78ed
-    dw 0x0535, 0x06dd, 0x90b9, 0x1195
-    dw 0x0536, 0xc0a7, 0xccf7, 0x4c62
-    dw 0x0537, 0xbf53, 0x5c8b, 0xdc92
-    dw 0x0538, 0xd74f, 0x5431, 0xd9c0
-    dw 0x0539, 0x85e4, 0x81eb, 0x83f9
-    dw 0x053a, 0xee47, 0x9e28, 0xee47
-    dw 0x053b, 0x466b, 0x4a2e, 0xc5f1
-    dw 0x053c, 0x8f89, 0x0441, 0x904d
-    dw 0x053d, 0x6bfc, 0x04ea, 0x6bfc
-    dw 0x053e, 0x9294, 0x57ec, 0xd7ec
-    dw 0x053f, 0x9916, 0xbcff, 0x3cfc
-    dw 0x0540, 0x80d9, 0x8689, 0x05b0
-    dw 0x0541, 0xac51, 0x8ebb, 0xac4a
-    dw 0x0542, 0xb921, 0x9267, 0xb91f
-    dw 0x0543, 0x2563, 0x320f, 0xb163
-    dw 0x0544, 0xb3c9, 0x2c40, 0xb4f4
-    dw 0x0545, 0xc2c8, 0x7471, 0xf471
-    dw 0x0546, 0xf937, 0x821b, 0xf937
-    dw 0x0547, 0xd0fc, 0xd087, 0xc350
-    dw 0x0548, 0xd64c, 0x56e0, 0xda96
-    dw 0x0549, 0x5272, 0xc493, 0x5304
-    dw 0x054a, 0xf508, 0x98dd, 0xf508
-    dw 0x054b, 0x0ec2, 0x8492, 0x0fe6
-    dw 0x054c, 0x9d1e, 0x7abe, 0xfabe
-    dw 0x054d, 0x897c, 0x2fb3, 0xafb6
-    dw 0x054e, 0xd2aa, 0x2292, 0xd2aa
-    dw 0x054f, 0xecb2, 0x5383, 0xecc1
-    dw 0x0550, 0xa91b, 0x9903, 0xa8cb
-    dw 0x0551, 0xe23e, 0x623c, 0xe63d
-    dw 0x0552, 0x2b6a, 0x07a1, 0x2b66
-    dw 0x0553, 0x944b, 0xdf34, 0x5f34
-    dw 0x0554, 0x33e2, 0x5713, 0xd70f
-    dw 0x0555, 0x53a5, 0x2d19, 0x53a2
-    dw 0x0556, 0xd92e, 0x24a1, 0xd92e
-    dw 0x0557, 0xaf7a, 0x7b81, 0xfb81
-    dw 0x0558, 0x5012, 0x740e, 0xf40c
-    dw 0x0559, 0x7089, 0xe8f0, 0x71c5
-    dw 0x055a, 0x82d0, 0xf51b, 0x751b
-    dw 0x055b, 0x860e, 0xb5c1, 0x35c1
-    dw 0x055c, 0xd039, 0xa129, 0xd039
-    dw 0x055d, 0xa273, 0x23bc, 0xa718
-    dw 0x055e, 0x4a44, 0x3b76, 0x49cd
-    dw 0x055f, 0x05fb, 0xac81, 0x2c82
-    dw 0x0560, 0x66e1, 0x0d9c, 0x66e1
-    dw 0x0561, 0x40cc, 0x4615, 0xc35e
-    dw 0x0562, 0x417e, 0x97e0, 0x417f
-    dw 0x0563, 0x99ba, 0x6e98, 0xee98
-    dw 0x0564, 0x710e, 0xbe5b, 0x710e
-    dw 0x0565, 0x6c38, 0x2089, 0x6c38
-    dw 0x0566, 0x39dc, 0xbc4b, 0x3f39
-    dw 0x0567, 0x9497, 0xaa65, 0x2a40
-    dw 0x0568, 0xa53b, 0x1767, 0xa5b1
-    dw 0x0569, 0x9f81, 0x2b49, 0xac1d
-    dw 0x056a, 0x14f5, 0x1e18, 0x9cdb
-    dw 0x056b, 0xe10b, 0xe52e, 0x6151
-    dw 0x056c, 0xbf42, 0x837e, 0xbf42
-    dw 0x056d, 0x08eb, 0x0986, 0x8136
-    dw 0x056e, 0xbef5, 0x0ee6, 0xbef5
-    dw 0x056f, 0xb607, 0x25d6, 0xb664
-    dw 0x0570, 0x1c82, 0xf6d4, 0x76d4
-    dw 0x0571, 0x6beb, 0x5e01, 0x6b2b
-    dw 0x0572, 0x8eb4, 0x05a5, 0x900f
-    dw 0x0573, 0xcc99, 0xc400, 0xcb32
-    dw 0x0574, 0x38d1, 0x204b, 0x38c0
-    dw 0x0575, 0xf51c, 0xb4e2, 0xf51c
-    dw 0x0576, 0xa841, 0x9a57, 0xa7b7
-    dw 0x0577, 0xcc49, 0x47c2, 0xce3a
-    dw 0x0578, 0xc5a1, 0xe13f, 0x6134
-    dw 0x0579, 0x65db, 0xa6ac, 0x65db
-    dw 0x057a, 0xc66d, 0x251d, 0xc672
-    dw 0x057b, 0x2a2a, 0xcf58, 0x4f5b
-    dw 0x057c, 0x2ea3, 0xe91f, 0x691f
-    dw 0x057d, 0xde3e, 0xe4ab, 0x6237
-    dw 0x057e, 0x0ef5, 0xfac1, 0x7ac1
-    dw 0x057f, 0xdb7f, 0x7ae0, 0xfae7
-    dw 0x0580, 0x58c2, 0x6a33, 0xe9e7
-    dw 0x0581, 0x8085, 0x255b, 0xa55c
-    dw 0x0582, 0x69f5, 0x4485, 0x69f3
-    dw 0x0583, 0x5e2c, 0x8a41, 0x5e2c
-    dw 0x0584, 0x4261, 0x5349, 0xd2e3
-    dw 0x0585, 0x3f23, 0xeaa3, 0x6aa4
-    dw 0x0586, 0xeda0, 0x0b6d, 0xeda0
-    dw 0x0587, 0x3265, 0xb341, 0x36d3
-    dw 0x0588, 0xecac, 0x9840, 0xecac
-    dw 0x0589, 0x59ed, 0xb319, 0x59ef
-    dw 0x058a, 0xbd5d, 0x8418, 0xbd5d
-    dw 0x058b, 0x8272, 0xec01, 0x6c01
-    dw 0x058c, 0x6d37, 0x60b0, 0x6ca1
-    dw 0x058d, 0xd0ac, 0x5b71, 0xdc4e
-    dw 0x058e, 0xac2b, 0xf70d, 0x770d
-    dw 0x058f, 0xb433, 0x165e, 0xb439
-    dw 0x0590, 0x7793, 0xd98e, 0x779e
-    dw 0x0591, 0x8053, 0xbc18, 0x3c18
-    dw 0x0592, 0x37bb, 0x0a94, 0x37ba
-    dw 0x0593, 0x8b04, 0x49b8, 0xc9b8
-    dw 0x0594, 0xe91d, 0x78a4, 0xf8f6
-    dw 0x0595, 0x5525, 0x1b82, 0x5525
-    dw 0x0596, 0x2be6, 0x41d1, 0xc1b1
-    dw 0x0597, 0xb3c3, 0x85d3, 0xb3c2
-    dw 0x0598, 0xf4ea, 0x7120, 0xf77a
-    dw 0x0599, 0x09eb, 0x775c, 0xf75c
-    dw 0x059a, 0x5d21, 0x7723, 0xf70e
-    dw 0x059b, 0xd80d, 0x2dcd, 0xd80e
-    dw 0x059c, 0xf350, 0x337e, 0xf350
-    dw 0x059d, 0xd9f8, 0xea5d, 0x69fe
-    dw 0x059e, 0xe7b2, 0xf056, 0x6ec0
-    dw 0x059f, 0x61f0, 0xc140, 0x61f5
-    dw 0x05a0, 0x70aa, 0x1e09, 0x70aa
-    dw 0x05a1, 0xf8fb, 0x7b3e, 0xfc00
-    dw 0x05a2, 0x1c83, 0x83ff, 0x1c93
-    dw 0x05a3, 0xc4f6, 0x05a0, 0xc4f6
-    dw 0x05a4, 0x1a1b, 0x2122, 0x9f36
-    dw 0x05a5, 0x288a, 0x5bec, 0xdbec
-    dw 0x05a6, 0xd4e5, 0xae5d, 0xd4e3
-    dw 0x05a7, 0x50d7, 0x4606, 0x5016
-    dw 0x05a8, 0xb849, 0xc833, 0x47dd
-    dw 0x05a9, 0xa327, 0x2f6c, 0xb028
-    dw 0x05aa, 0xa040, 0xd0f5, 0x50f5
-    dw 0x05ab, 0x22bc, 0xd3bf, 0x53bf
-    dw 0x05ac, 0xaaed, 0x0d19, 0xaaf7
-    dw 0x05ad, 0xbb71, 0x9b44, 0xbb6a
-    dw 0x05ae, 0x6f0a, 0x0bee, 0x6f0a
-    dw 0x05af, 0x8d13, 0x75ad, 0xf5ad
-    dw 0x05b0, 0x872c, 0xa996, 0x2992
-    dw 0x05b1, 0xf9ac, 0x4c23, 0xf9ad
-    dw 0x05b2, 0xaf36, 0xf650, 0x7650
-    dw 0x05b3, 0x663e, 0xd058, 0x6661
-    dw 0x05b4, 0x1eda, 0xc22b, 0x422e
-    dw 0x05b5, 0xa53e, 0xcd38, 0x4d37
-    dw 0x05b6, 0x1302, 0xeb44, 0x6b44
-    dw 0x05b7, 0x8581, 0xdb35, 0x5b35
-    dw 0x05b8, 0x8e6b, 0xb4ed, 0x34eb
-    dw 0x05b9, 0x7b76, 0x5f60, 0x7b67
-    dw 0x05ba, 0xd7a9, 0x4f35, 0xd8bb
-    dw 0x05bb, 0x0a4e, 0xe4c2, 0x64c2
-    dw 0x05bc, 0x0aa6, 0xa592, 0x259f
-    dw 0x05bd, 0x53cc, 0x8757, 0x53cc
-    dw 0x05be, 0xb180, 0xe0df, 0x60df
-    dw 0x05bf, 0x38ac, 0x8a75, 0x38ac
-    dw 0x05c0, 0xf6b1, 0x84cf, 0xf6b1
-    dw 0x05c1, 0x39ab, 0xed01, 0x6d01
-    dw 0x05c2, 0xeb0e, 0x0a04, 0xeb0e
-    dw 0x05c3, 0x0bdc, 0xad39, 0x2d3d
-    dw 0x05c4, 0xaf42, 0xd914, 0x5913
-    dw 0x05c5, 0xc03b, 0x9a86, 0xc039
-    dw 0x05c6, 0x5e95, 0x9b70, 0x5e95
-    dw 0x05c7, 0x28f1, 0x1382, 0x28d3
-    dw 0x05c8, 0x16e6, 0x8852, 0x1770
-    dw 0x05c9, 0xeb2b, 0x661b, 0xed1c
-    dw 0x05ca, 0x92a0, 0xcfed, 0x4fed
-    dw 0x05cb, 0x70c1, 0x3832, 0x70c1
-    dw 0x05cc, 0x23ba, 0xf819, 0x7819
-    dw 0x05cd, 0xe9b2, 0x0499, 0xe9b2
-    dw 0x05ce, 0xf51d, 0x225e, 0xf51d
-    dw 0x05cf, 0x8f0f, 0xebce, 0x6bce
-    dw 0x05d0, 0xa72e, 0xc8ba, 0x48b6
-    dw 0x05d1, 0xd8d0, 0x923c, 0xd8d0
-    dw 0x05d2, 0xd2be, 0xe4ac, 0x6476
-    dw 0x05d3, 0x3f75, 0x8200, 0x3f75
-    dw 0x05d4, 0xbdc0, 0x1c86, 0xbdc5
-    dw 0x05d5, 0x1c55, 0x9b20, 0x1fe5
-    dw 0x05d6, 0x4578, 0x2fd7, 0x4559
-    dw 0x05d7, 0xb207, 0xcdca, 0x4dbe
-    dw 0x05d8, 0x1b02, 0x1822, 0x15c0
-    dw 0x05d9, 0x606a, 0xeaef, 0x6c05
-    dw 0x05da, 0x88e4, 0x989c, 0x184e
-    dw 0x05db, 0x0ea9, 0x80fd, 0x0ee8
-    dw 0x05dc, 0x824e, 0x1343, 0x938d
-    dw 0x05dd, 0x761a, 0xa4ac, 0x761a
-    dw 0x05de, 0xa252, 0x61e9, 0xe1e9
-    dw 0x05df, 0x4bda, 0x6b0c, 0xeb04
-    dw 0x05e0, 0x3ab9, 0xde16, 0x5e19
-    dw 0x05e1, 0x3dcb, 0x1f65, 0x3dc4
-    dw 0x05e2, 0x1d8b, 0xbfcb, 0x3fd1
-    dw 0x05e3, 0xdd25, 0x1d3b, 0xdd25
-    dw 0x05e4, 0xdc52, 0xf97a, 0x7971
-    dw 0x05e5, 0xb85c, 0x21ca, 0xb873
-    dw 0x05e6, 0x2951, 0x6a63, 0xea63
-    dw 0x05e7, 0xef94, 0x4453, 0xef95
-    dw 0x05e8, 0x8285, 0x4ffe, 0xcffe
-    dw 0x05e9, 0x2f42, 0x0b69, 0x2f3e
-    dw 0x05ea, 0xe89a, 0x3dec, 0xe89b
-    dw 0x05eb, 0x8c66, 0x6ae8, 0xeae8
-    dw 0x05ec, 0x512f, 0x0281, 0x512f
-    dw 0x05ed, 0x0f94, 0xf381, 0x7381
-    dw 0x05ee, 0x646a, 0x5b6f, 0x62f8
-    dw 0x05ef, 0x5e8d, 0x9f23, 0x5e8d
-    dw 0x05f0, 0x3985, 0x9c58, 0x398e
-    dw 0x05f1, 0xbe88, 0x5711, 0xd72b
-    dw 0x05f2, 0x5c24, 0x9bad, 0x5c24
-    dw 0x05f3, 0x744c, 0x3876, 0x744c
-    dw 0x05f4, 0x9527, 0x2ca8, 0xacbd
-    dw 0x05f5, 0x5a40, 0xbe78, 0x5a4d
-    dw 0x05f6, 0x970b, 0x49d4, 0xc9d4
-    dw 0x05f7, 0x02cb, 0x1991, 0x997b
-    dw 0x05f8, 0x99d2, 0x320d, 0xb224
-    dw 0x05f9, 0x24fa, 0x826c, 0x24fc
-    dw 0x05fa, 0x6ff9, 0xb161, 0x6ff9
-    dw 0x05fb, 0xed54, 0xc128, 0xed53
-    dw 0x05fc, 0xb3e2, 0xb4a9, 0x29c0
-    dw 0x05fd, 0x184c, 0x5857, 0xd857
-    dw 0x05fe, 0x1337, 0xb76f, 0x3773
-    dw 0x05ff, 0x91dd, 0xaf8f, 0x2f83
-    dw 0x0600, 0x75f7, 0xe8ee, 0x7695
-    dw 0x0601, 0x0bb3, 0x11a4, 0x8f6e
-    dw 0x0602, 0x5d3a, 0x4429, 0x5d29
-    dw 0x0603, 0xa6cb, 0x89e3, 0xa6bf
-    dw 0x0604, 0x9e69, 0x6543, 0xe543
-    dw 0x0605, 0x20ee, 0xe83d, 0x683d
-    dw 0x0606, 0x680e, 0x3a7f, 0x680e
-    dw 0x0607, 0x820f, 0x9a1b, 0x1a0b
-    dw 0x0608, 0x5f7a, 0x047b, 0x5f7a
-    dw 0x0609, 0x0a15, 0x10db, 0x8eac
-    dw 0x060a, 0xf1cf, 0xcb3d, 0xf1cd
-    dw 0x060b, 0xc4bd, 0xeeb8, 0x6eb7
-    dw 0x060c, 0xdd09, 0x470f, 0xdd25
-    dw 0x060d, 0x931e, 0x9478, 0x0b48
-    dw 0x060e, 0xd8ec, 0x42ad, 0xd907
-    dw 0x060f, 0x0a6f, 0xc1da, 0x41da
-    dw 0x0610, 0x4e61, 0x1c13, 0x4e61
-    dw 0x0611, 0x1f15, 0x928a, 0x1fe6
-    dw 0x0612, 0xc2de, 0xa8f8, 0xc2ca
-    dw 0x0613, 0x30f4, 0x2821, 0x2fd8
-    dw 0x0614, 0xc9e6, 0x1931, 0xc9e6
-    dw 0x0615, 0x902f, 0x0466, 0x90bc
-    dw 0x0616, 0x9b41, 0x2a4a, 0xaabe
-    dw 0x0617, 0x63e0, 0x9fbc, 0x63e0
-    dw 0x0618, 0x345f, 0x74bb, 0xf4bb
-    dw 0x0619, 0x918c, 0x3978, 0xb979
-    dw 0x061a, 0x8044, 0x1681, 0x9685
-    dw 0x061b, 0xc753, 0x12a2, 0xc753
-    dw 0x061c, 0xaaf9, 0xa040, 0xa9e9
-    dw 0x061d, 0x554f, 0xb568, 0x5554
-    dw 0x061e, 0x621a, 0xa3b0, 0x621a
-    dw 0x061f, 0xd17b, 0x812f, 0xd17b
-    dw 0x0620, 0x363b, 0x9459, 0x363f
-    dw 0x0621, 0x2a27, 0x672f, 0xe72f
-    dw 0x0622, 0xbc7a, 0xf40e, 0x740e
-    dw 0x0623, 0x8060, 0x4ca9, 0xcca9
-    dw 0x0624, 0xf874, 0x1ba1, 0xf874
-    dw 0x0625, 0x76f3, 0x5c54, 0x76e2
-    dw 0x0626, 0xbb5e, 0xab53, 0xbae9
-    dw 0x0627, 0xd10f, 0x4cea, 0xd384
-    dw 0x0628, 0xaaf0, 0x0a87, 0xaaf7
-    dw 0x0629, 0xcd2e, 0x2a74, 0xcd31
-    dw 0x062a, 0x2108, 0x9481, 0x2198
-    dw 0x062b, 0x3d16, 0xcc01, 0x4c52
-    dw 0x062c, 0x34c1, 0x9265, 0x34c4
-    dw 0x062d, 0x8169, 0x96dc, 0x16c5
-    dw 0x062e, 0x3616, 0x52e4, 0xd2d8
-    dw 0x062f, 0x180b, 0x6c51, 0xec51
-    dw 0x0630, 0xe73d, 0x4233, 0xe740
-    dw 0x0631, 0xd380, 0xa3b7, 0xd380
-    dw 0x0632, 0x3641, 0x53e0, 0xd3d3
-    dw 0x0633, 0xf060, 0x2eb5, 0xf060
-    dw 0x0634, 0x6f82, 0x6753, 0x6dad
-    dw 0x0635, 0x8b09, 0x2ae0, 0xaae7
-    dw 0x0636, 0x12a6, 0x5c18, 0xdc18
-    dw 0x0637, 0x77ca, 0xbd96, 0x77ca
-    dw 0x0638, 0x669f, 0x44f8, 0x669a
-    dw 0x0639, 0xe80a, 0x87a7, 0xe80a
-    dw 0x063a, 0xd979, 0x2520, 0xd979
-    dw 0x063b, 0x53a8, 0x0e3b, 0x53a8
-    dw 0x063c, 0xb786, 0xd511, 0x5509
-    dw 0x063d, 0xa517, 0xed9c, 0x6d9c
-    dw 0x063e, 0x27f5, 0xbd22, 0x3d42
-    dw 0x063f, 0x59ed, 0x0f32, 0x59ed
-    dw 0x0640, 0x2d6d, 0xb2e9, 0x34d0
-    dw 0x0641, 0x3596, 0x814d, 0x3596
-    dw 0x0642, 0xa349, 0x644b, 0xe44b
-    dw 0x0643, 0xf0cf, 0x0a9c, 0xf0cf
-    dw 0x0644, 0xef54, 0x1baf, 0xef54
-    dw 0x0645, 0x1d43, 0x4b6c, 0xcb6b
-    dw 0x0646, 0x9379, 0xdad9, 0x5ad9
-    dw 0x0647, 0xb20b, 0xd871, 0x586f
-    dw 0x0648, 0xc2e4, 0x39b2, 0xc428
-    dw 0x0649, 0xb1eb, 0xe804, 0x6804
-    dw 0x064a, 0x8d5a, 0xc026, 0x4026
-    dw 0x064b, 0x9f8a, 0x626b, 0xe26b
-    dw 0x064c, 0x653d, 0x8d26, 0x653d
-    dw 0x064d, 0x8a60, 0x225f, 0xa278
-    dw 0x064e, 0xe713, 0x9992, 0xe713
-    dw 0x064f, 0x21b5, 0x1480, 0x2125
-    dw 0x0650, 0x4c7b, 0x574b, 0xd62c
-    dw 0x0651, 0x95ce, 0xefc4, 0x6fc4
-    dw 0x0652, 0xbb97, 0x869d, 0xbb97
-    dw 0x0653, 0xfa61, 0xaaeb, 0xfa61
-    dw 0x0654, 0xa24d, 0x17a4, 0xa342
-    dw 0x0655, 0xf658, 0x35c6, 0xf658
-    dw 0x0656, 0xf27d, 0xa863, 0xf27d
-    dw 0x0657, 0x0e38, 0xb561, 0x3563
-    dw 0x0658, 0xe216, 0xc023, 0xe212
-    dw 0x0659, 0x9d66, 0x6f70, 0xef70
-    dw 0x065a, 0x8049, 0x3cf0, 0xbcf0
-    dw 0x065b, 0xd1dc, 0xe586, 0x6557
-    dw 0x065c, 0xca17, 0x5c3c, 0xdc6d
-    dw 0x065d, 0x07e5, 0xb12a, 0x312b
-    dw 0x065e, 0xf5cf, 0x299a, 0xf5cf
-    dw 0x065f, 0xc5ab, 0x424a, 0xc868
-    dw 0x0660, 0x80e6, 0x5b79, 0xdb79
-    dw 0x0661, 0x320f, 0x3c7d, 0xbb76
-    dw 0x0662, 0xe216, 0x2c70, 0xe216
-    dw 0x0663, 0xe768, 0x8463, 0xe768
-    dw 0x0664, 0x4414, 0xddc0, 0x5dd0
-    dw 0x0665, 0xba2a, 0x3691, 0xbcb9
-    dw 0x0666, 0x8624, 0xc862, 0x4862
-    dw 0x0667, 0xebf3, 0x683a, 0xee16
-    dw 0x0668, 0x8885, 0x8959, 0x01a8
-    dw 0x0669, 0xd7aa, 0x08ce, 0xd7aa
-    dw 0x066a, 0xc649, 0xa986, 0xc63e
-    dw 0x066b, 0xee54, 0x9060, 0xee54
-    dw 0x066c, 0x05c3, 0xf639, 0x7639
-    dw 0x066d, 0x418b, 0xfb92, 0x7b92
-    dw 0x066e, 0x1fd4, 0x0736, 0x1fb7
-    dw 0x066f, 0x3ddc, 0xa0ba, 0x3de5
-    dw 0x0670, 0x62af, 0x6feb, 0xef15
-    dw 0x0671, 0xdd37, 0x44c5, 0xdd4a
-    dw 0x0672, 0x9c5b, 0xc49f, 0x449e
-    dw 0x0673, 0xc929, 0xe06f, 0x605a
-    dw 0x0674, 0xa260, 0x8353, 0xa259
-    dw 0x0675, 0x1701, 0x2884, 0xa84c
-    dw 0x0676, 0x4bb5, 0x02f4, 0x4bb5
-    dw 0x0677, 0x90be, 0xd43a, 0x543a
-    dw 0x0678, 0x8c4d, 0x6868, 0xe868
-    dw 0x0679, 0xdd08, 0x5296, 0xdddb
-    dw 0x067a, 0x11ef, 0xcb5c, 0x4b5c
-    dw 0x067b, 0xe2f7, 0x17b2, 0xe2f7
-    dw 0x067c, 0xc195, 0x2482, 0xc19e
-    dw 0x067d, 0x1344, 0xe169, 0x6169
-    dw 0x067e, 0x2bb8, 0x5120, 0xd11e
-    dw 0x067f, 0x8223, 0x8e67, 0x0dde
-    dw 0x0680, 0xc10c, 0x5f5a, 0xdf64
-    dw 0x0681, 0xd32c, 0x5d67, 0xde4c
-    dw 0x0682, 0x23fa, 0x9c55, 0x2512
-    dw 0x0683, 0x3dd7, 0xc65a, 0x47d0
-    dw 0x0684, 0x1fa8, 0x54d8, 0xd4d8
-    dw 0x0685, 0xeede, 0x6b5d, 0xf146
-    dw 0x0686, 0x57cc, 0x3f97, 0x57ae
-    dw 0x0687, 0xe419, 0xe804, 0x63de
-    dw 0x0688, 0x1c9f, 0x36af, 0xb69d
-    dw 0x0689, 0xf9f3, 0xe7fb, 0xf9b3
-    dw 0x068a, 0x19a6, 0x11a5, 0x183d
-    dw 0x068b, 0xa991, 0x3e28, 0xbe55
-    dw 0x068c, 0x24e9, 0x8afa, 0x24f7
-    dw 0x068d, 0x69e0, 0x760a, 0xf54e
-    dw 0x068e, 0x0d1e, 0xf847, 0x7847
-    dw 0x068f, 0x3716, 0x6c78, 0xec78
-    dw 0x0690, 0xcb74, 0x947d, 0xcb74
-    dw 0x0691, 0x9072, 0x67c9, 0xe7c9
-    dw 0x0692, 0xd254, 0x56cc, 0xd8fb
-    dw 0x0693, 0x8772, 0x272c, 0xa733
-    dw 0x0694, 0x45aa, 0xf2cf, 0x72d0
-    dw 0x0695, 0xc546, 0x3267, 0xc579
-    dw 0x0696, 0x6311, 0xad4b, 0x6311
-    dw 0x0697, 0x4f06, 0x99c1, 0x4f06
-    dw 0x0698, 0xa73e, 0x3702, 0xb776
-    dw 0x0699, 0xb367, 0xb8e4, 0x3614
-    dw 0x069a, 0xe093, 0xf190, 0x7147
-    dw 0x069b, 0xddcd, 0x6b8d, 0xec23
-    dw 0x069c, 0x5b70, 0x53d7, 0x597a
-    dw 0x069d, 0x78ab, 0x53b8, 0x78a9
-    dw 0x069e, 0x8aed, 0xe524, 0x6524
-    dw 0x069f, 0x1f2c, 0x1f6b, 0x8be0
-    dw 0x06a0, 0x7596, 0x86f5, 0x7596
-    dw 0x06a1, 0xf1bf, 0xcc63, 0xf1bd
-    dw 0x06a2, 0x0e67, 0x18ec, 0x981f
-    dw 0x06a3, 0x120d, 0x0137, 0x11e6
-    dw 0x06a4, 0x97e4, 0xd754, 0x5754
-    dw 0x06a5, 0x339e, 0xfaf6, 0x7af6
-    dw 0x06a6, 0x849f, 0x82a4, 0x81fb
-    dw 0x06a7, 0x94b7, 0x2bdd, 0xac01
-    dw 0x06a8, 0xb9a6, 0x481e, 0xc878
-    dw 0x06a9, 0xe4c1, 0x9a39, 0xe4c1
-    dw 0x06aa, 0x39ae, 0xc28f, 0x43fa
-    dw 0x06ab, 0x05c7, 0x951f, 0x157b
-    dw 0x06ac, 0x1666, 0xe8d7, 0x68d7
-    dw 0x06ad, 0xa154, 0x6396, 0xe396
-    dw 0x06ae, 0x0803, 0xc0bf, 0x40bf
-    dw 0x06af, 0xd92d, 0x8ef8, 0xd92d
-    dw 0x06b0, 0xb27e, 0xa590, 0xb1cc
-    dw 0x06b1, 0x9d60, 0xcb6a, 0x4b69
-    dw 0x06b2, 0xb79d, 0x9e97, 0xb783
-    dw 0x06b3, 0x634f, 0x8ef1, 0x634f
-    dw 0x06b4, 0xd235, 0x5e45, 0xdf0c
-    dw 0x06b5, 0x1390, 0x54d9, 0xd4d9
-    dw 0x06b6, 0xf2fc, 0x3f6e, 0xf2fc
-    dw 0x06b7, 0x0e80, 0x3b1a, 0xbb19
-    dw 0x06b8, 0x242f, 0xa8b9, 0x2ad0
-    dw 0x06b9, 0x74c9, 0xe6be, 0x7535
-    dw 0x06ba, 0xae80, 0x09e8, 0xae83
-    dw 0x06bb, 0x2cf3, 0xf2bf, 0x72bf
-    dw 0x06bc, 0x9e79, 0x9089, 0x9de8
-    dw 0x06bd, 0xfac2, 0x5f38, 0xfad0
-    dw 0x06be, 0x69b6, 0x89ba, 0x69b6
-    dw 0x06bf, 0x11b6, 0x0f46, 0x0c26
-    dw 0x06c0, 0x271a, 0xdd21, 0x5d21
-    dw 0x06c1, 0xc6e4, 0xc5b1, 0xbccc
-    dw 0x06c2, 0x4070, 0x55d5, 0xd5b2
-    dw 0x06c3, 0x97e6, 0x9eb5, 0x1cbc
-    dw 0x06c4, 0x6966, 0xecc0, 0x6f73
-    dw 0x06c5, 0x91b1, 0xa8d4, 0x28bd
-    dw 0x06c6, 0xfb40, 0xcccb, 0xfb3f
-    dw 0x06c7, 0xcd03, 0xa3f9, 0xcd02
-    dw 0x06c8, 0x4194, 0xb3c2, 0x4210
-    dw 0x06c9, 0x527a, 0x4b7c, 0x509b
-    dw 0x06ca, 0xb0e7, 0x3e3b, 0xbed8
-    dw 0x06cb, 0x4f60, 0x0ff6, 0x4f60
-    dw 0x06cc, 0x38fd, 0xae98, 0x39d0
-    dw 0x06cd, 0x79ad, 0xc2b8, 0x79ad
-    dw 0x06ce, 0xc04e, 0x88f3, 0xc04e
-    dw 0x06cf, 0xe9d2, 0x9d6f, 0xe9d2
-    dw 0x06d0, 0x4fd7, 0xaf84, 0x4fdf
-    dw 0x06d1, 0xdddf, 0xa5ad, 0xdddf
-    dw 0x06d2, 0x476a, 0x0f13, 0x476a
-    dw 0x06d3, 0x342a, 0x0e45, 0x3428
-    dw 0x06d4, 0xb7e7, 0x2f6a, 0xb8e1
-    dw 0x06d5, 0xdb11, 0x84ea, 0xdb11
-    dw 0x06d6, 0xd364, 0x1ca5, 0xd364
-    dw 0x06d7, 0x38ac, 0x25de, 0x387d
-    dw 0x06d8, 0x6822, 0xe993, 0x6cda
-    dw 0x06d9, 0xa54b, 0xa65d, 0x1c48
-    dw 0x06da, 0x38f3, 0xb541, 0x3b94
-    dw 0x06db, 0xdf5b, 0xe78b, 0x65b4
-    dw 0x06dc, 0x2eee, 0xa213, 0x2fb0
-    dw 0x06dd, 0xa7da, 0xb7e2, 0x3764
-    dw 0x06de, 0x8be5, 0x4549, 0xc549
-    dw 0x06df, 0x07b9, 0x3b69, 0xbb69
-    dw 0x06e0, 0x2329, 0xad66, 0x2e4b
-    dw 0x06e1, 0x82d4, 0x9fbd, 0x1fb2
-    dw 0x06e2, 0xbc79, 0xb6fe, 0xb973
-    dw 0x06e3, 0xae03, 0x7460, 0xf460
-    dw 0x06e4, 0xe669, 0x8914, 0xe669
-    dw 0x06e5, 0xf94b, 0xb9cd, 0xf94b
-    dw 0x06e6, 0xa5b9, 0x31f7, 0xb2ae
-    dw 0x06e7, 0xdfab, 0x0ddb, 0xdfab
-    dw 0x06e8, 0x1b8b, 0x84f6, 0x1bb3
-    dw 0x06e9, 0xb439, 0x547e, 0xd482
-    dw 0x06ea, 0x3a37, 0x9394, 0x3a39
-    dw 0x06eb, 0x3c0a, 0x6926, 0xe925
-    dw 0x06ec, 0x35a7, 0xe3e4, 0x63e5
-    dw 0x06ed, 0x2108, 0xc18c, 0x4191
-    dw 0x06ee, 0x292d, 0x28c1, 0x1ac0
-    dw 0x06ef, 0x4c56, 0xd628, 0x573e
-    dw 0x06f0, 0xec14, 0x92a1, 0xec14
-    dw 0x06f1, 0x36c8, 0x9a17, 0x36d4
-    dw 0x06f2, 0x0702, 0x1d31, 0x9d15
-    dw 0x06f3, 0x232b, 0x004d, 0x232a
-    dw 0x06f4, 0xd6fe, 0xc8e4, 0xd662
-    dw 0x06f5, 0x3244, 0xb6a9, 0x38e6
-    dw 0x06f6, 0xd6c0, 0x4dcf, 0xd81a
-    dw 0x06f7, 0x3b9f, 0x8af9, 0x3b9f
-    dw 0x06f8, 0xa24e, 0x75d7, 0xf5d7
-    dw 0x06f9, 0x1e8d, 0xde58, 0x5e58
-    dw 0x06fa, 0xdefd, 0x5434, 0xe005
-    dw 0x06fb, 0xc23c, 0x0005, 0xc23c
-    dw 0x06fc, 0x15c0, 0xeb69, 0x6b69
-    dw 0x06fd, 0x28c6, 0x12b6, 0x28ab
-    dw 0x06fe, 0x37c0, 0x9280, 0x37c3
-    dw 0x06ff, 0x23d4, 0x9190, 0x2416
-    dw 0x0700, 0xc949, 0xbdeb, 0xc88c
-    dw 0x0701, 0x9892, 0xe67a, 0x667a
-    dw 0x0702, 0xe116, 0x98df, 0xe116
-    dw 0x0703, 0xbd79, 0xa9fa, 0xbd49
-    dw 0x0704, 0xcb23, 0x7422, 0xf423
-    dw 0x0705, 0x80ba, 0x18f3, 0x98f9
-    dw 0x0706, 0xafc2, 0x0bb3, 0xafc6
-    dw 0x0707, 0xbb41, 0x2599, 0xbb6e
-    dw 0x0708, 0x2a40, 0x9999, 0x2a9a
-    dw 0x0709, 0x0496, 0x5bd5, 0xdbd5
-    dw 0x070a, 0x049b, 0x9435, 0x147f
-    dw 0x070b, 0x473e, 0x2d61, 0x4728
-    dw 0x070c, 0xa6eb, 0x2c50, 0xae0b
-    dw 0x070d, 0x396c, 0xa2d2, 0x3987
-    dw 0x070e, 0xbde0, 0x02b5, 0xbde0
-    dw 0x070f, 0x60bd, 0x5672, 0x5fde
-    dw 0x0710, 0xe92f, 0x41d3, 0xe930
-    dw 0x0711, 0xef51, 0xa6a8, 0xef51
-    dw 0x0712, 0xebce, 0xba74, 0xebce
-    dw 0x0713, 0x1acb, 0x6c88, 0xec88
-    dw 0x0714, 0xd367, 0xca8d, 0xd1c4
-    dw 0x0715, 0x783c, 0x8ea8, 0x783c
-    dw 0x0716, 0xf026, 0xa27c, 0xf026
-    dw 0x0717, 0x2841, 0xf4bc, 0x74bc
-    dw 0x0718, 0x20f1, 0x8416, 0x20f9
-    dw 0x0719, 0xf957, 0xb526, 0xf957
-    dw 0x071a, 0xcb55, 0x26b8, 0xcb58
-    dw 0x071b, 0x5c11, 0x4a53, 0x5bbd
-    dw 0x071c, 0x5308, 0x957d, 0x5308
-    dw 0x071d, 0xed26, 0x10e8, 0xed26
-    dw 0x071e, 0x9832, 0x4de3, 0xcde3
-    dw 0x071f, 0x675a, 0x8162, 0x675a
-    dw 0x0720, 0x8fb7, 0x56ab, 0xd6ab
-    dw 0x0721, 0x280a, 0x7b85, 0xfb85
-    dw 0x0722, 0x1120, 0x42d5, 0xc2d5
-    dw 0x0723, 0xe80d, 0xe487, 0xe326
-    dw 0x0724, 0x0d62, 0x6049, 0xe049
-    dw 0x0725, 0x7330, 0x02c6, 0x7330
-    dw 0x0726, 0x9b71, 0xf244, 0x7244
-    dw 0x0727, 0x23b7, 0x1f88, 0x1fe6
-    dw 0x0728, 0xeb9b, 0xd8dd, 0xeb4d
-    dw 0x0729, 0xeadd, 0x1254, 0xeadd
-    dw 0x072a, 0x34ee, 0x3530, 0xa420
-    dw 0x072b, 0x655c, 0xca6c, 0x6569
-    dw 0x072c, 0x2256, 0x7645, 0xf645
-    dw 0x072d, 0x629e, 0x703a, 0xefa0
-    dw 0x072e, 0xdd9f, 0xe400, 0x6130
-    dw 0x072f, 0x344b, 0x0c0b, 0x344a
-    dw 0x0730, 0x7b76, 0x456b, 0x7b76
-    dw 0x0731, 0x4ee0, 0x6383, 0xe34c
-    dw 0x0732, 0x29f2, 0x5c43, 0xdc43
-    dw 0x0733, 0xc3cd, 0x9d22, 0xc3ca
-    dw 0x0734, 0x59cb, 0xc693, 0x5a00
-    dw 0x0735, 0x3894, 0x4c10, 0xcbd7
-    dw 0x0736, 0xea4a, 0x581c, 0xea8c
-    dw 0x0737, 0x37ab, 0xc327, 0x440e
-    dw 0x0738, 0x42f9, 0x49ff, 0xc841
-    dw 0x0739, 0xf815, 0x7829, 0xfc00
-    dw 0x073a, 0xaf5c, 0xc281, 0x4246
-    dw 0x073b, 0x9a80, 0x25a1, 0xa671
-    dw 0x073c, 0x2520, 0x0aba, 0x2513
-    dw 0x073d, 0x0340, 0x0920, 0x8700
-    dw 0x073e, 0x0aab, 0x378b, 0xb78a
-    dw 0x073f, 0x152b, 0x8621, 0x158d
-    dw 0x0740, 0x640c, 0xe9a4, 0x6baa
-    dw 0x0741, 0xa6e9, 0xc04f, 0x4041
-    dw 0x0742, 0xad71, 0x440b, 0xc421
-    dw 0x0743, 0x1a1a, 0x7404, 0xf404
-    dw 0x0744, 0x662a, 0x5e4e, 0x6496
-    dw 0x0745, 0xd4bb, 0x9dd6, 0xd4bb
-    dw 0x0746, 0x2175, 0x17b4, 0x207e
-    dw 0x0747, 0xe7d5, 0x198b, 0xe7d5
-    dw 0x0748, 0x8fde, 0x9731, 0x153a
-    dw 0x0749, 0xdc0c, 0x2a5e, 0xdc0c
-    dw 0x074a, 0xbcd2, 0x012c, 0xbcd2
-    dw 0x074b, 0x3518, 0xc013, 0x40b6
-    dw 0x074c, 0x0a4d, 0x3fc3, 0xbfc3
-    dw 0x074d, 0xf79e, 0x1f78, 0xf79e
-    dw 0x074e, 0xc5e4, 0x7495, 0xf495
-    dw 0x074f, 0x8384, 0xaf88, 0x2f87
-    dw 0x0750, 0x1b7e, 0x43d3, 0xc3d1
-    dw 0x0751, 0x5cfa, 0x5f89, 0xd91e
-    dw 0x0752, 0x5dee, 0xd0fe, 0x5e8e
-    dw 0x0753, 0xdc29, 0xc418, 0xdc19
-    dw 0x0754, 0x2f4d, 0xb0e4, 0x3445
-    dw 0x0755, 0x61ee, 0x50c2, 0x61a2
-    dw 0x0756, 0xc899, 0x49c4, 0xcd2e
-    dw 0x0757, 0x6a4d, 0x5877, 0x6a06
-    dw 0x0758, 0xe0f5, 0x465a, 0xe102
-    dw 0x0759, 0x82d5, 0x9dc8, 0x1dbd
-    dw 0x075a, 0x4786, 0xb7ed, 0x4802
-    dw 0x075b, 0x5ddb, 0x51d3, 0x5d21
-    dw 0x075c, 0xf7b0, 0x5579, 0xf7b5
-    dw 0x075d, 0x714c, 0xbd94, 0x714c
-    dw 0x075e, 0xca0e, 0xf4d0, 0x74cf
-    dw 0x075f, 0x6d1c, 0xe58c, 0x6e7f
-    dw 0x0760, 0x38a4, 0xca16, 0x4a60
-    dw 0x0761, 0x4516, 0x9692, 0x4516
-    dw 0x0762, 0x9b15, 0x213f, 0xa304
-    dw 0x0763, 0x5aaa, 0xca62, 0x5b10
-    dw 0x0764, 0xd223, 0xbc99, 0xd1fe
-    dw 0x0765, 0x1b24, 0x9abc, 0x1ef0
-    dw 0x0766, 0x065d, 0x8572, 0x09e8
-    dw 0x0767, 0xf333, 0xe752, 0xf249
-    dw 0x0768, 0xcbcc, 0x7608, 0xf609
-    dw 0x0769, 0x851a, 0x1352, 0x93f5
-    dw 0x076a, 0x2df5, 0xe2f5, 0x62f5
-    dw 0x076b, 0x6526, 0x25a5, 0x6526
-    dw 0x076c, 0x386f, 0xd672, 0x567b
-    dw 0x076d, 0xe339, 0x027d, 0xe339
-    dw 0x076e, 0xcb42, 0x5056, 0xd226
-    dw 0x076f, 0xe80a, 0x03e6, 0xe80a
-    dw 0x0770, 0x1a6c, 0x2d20, 0xaced
-    dw 0x0771, 0x9a78, 0xb581, 0x3574
-    dw 0x0772, 0x4e5f, 0xf523, 0x7525
-    dw 0x0773, 0x2082, 0xb1bc, 0x3204
-    dw 0x0774, 0x9b08, 0xbb3f, 0x3b38
-    dw 0x0775, 0xb819, 0x207a, 0xb82b
-    dw 0x0776, 0xae72, 0x9f6b, 0xadfb
-    dw 0x0777, 0xec46, 0x247b, 0xec46
-    dw 0x0778, 0x2486, 0x5270, 0xd26f
-    dw 0x0779, 0x077b, 0x64be, 0xe4be
-    dw 0x077a, 0x7816, 0x3fea, 0x7816
-    dw 0x077b, 0x3b30, 0x5b4f, 0xdb48
-    dw 0x077c, 0x4268, 0x0673, 0x4268
-    dw 0x077d, 0xaba5, 0x2a72, 0xaf0c
-    dw 0x077e, 0x0a59, 0xc612, 0x4612
-    dw 0x077f, 0x5792, 0xa4d2, 0x5792
-    dw 0x0780, 0x7b93, 0xa5f1, 0x7b93
-    dw 0x0781, 0x99f5, 0xfb77, 0x7b77
-    dw 0x0782, 0xc673, 0x4bb1, 0xcd75
-    dw 0x0783, 0x967f, 0x81b2, 0x9664
-    dw 0x0784, 0x03ca, 0xb6f9, 0x36f9
-    dw 0x0785, 0x3025, 0xa335, 0x3098
-    dw 0x0786, 0xa33f, 0x54a0, 0xd4a0
-    dw 0x0787, 0xc7bb, 0xa2d7, 0xc7b8
-    dw 0x0788, 0xa710, 0xcf37, 0x4f35
-    dw 0x0789, 0x0796, 0x1f26, 0x9f08
-    dw 0x078a, 0x0f21, 0x42c6, 0xc2c6
-    dw 0x078b, 0x7a76, 0x5189, 0x7a75
-    dw 0x078c, 0x4939, 0x261b, 0x4936
-    dw 0x078d, 0x7bfb, 0x5393, 0x7bf9
-    dw 0x078e, 0xec2d, 0xd38d, 0xec1e
-    dw 0x078f, 0xf865, 0x67c1, 0xf8a3
-    dw 0x0790, 0x797e, 0x925a, 0x797e
-    dw 0x0791, 0x6338, 0x3ff2, 0x6334
-    dw 0x0792, 0xde0b, 0xf9b7, 0x79ab
-    dw 0x0793, 0xc1a4, 0xe1d5, 0x61cf
-    dw 0x0794, 0xb0b0, 0xf1c9, 0x71c9
-    dw 0x0795, 0x850a, 0x53ef, 0xd3ef
-    dw 0x0796, 0x4669, 0x4cc6, 0xca58
-    dw 0x0797, 0xf6c6, 0xed7a, 0xf568
-    dw 0x0798, 0x1bfd, 0x0ca0, 0x1b69
-    dw 0x0799, 0x2b1e, 0x4123, 0xc107
-    dw 0x079a, 0x8716, 0x8a5c, 0x05a2
-    dw 0x079b, 0xad32, 0xf8a3, 0x78a3
-    dw 0x079c, 0xddef, 0x995f, 0xddef
-    dw 0x079d, 0xcc31, 0xd654, 0x5548
-    dw 0x079e, 0x0120, 0x45af, 0xc5af
-    dw 0x079f, 0x68ae, 0x6458, 0x6504
-    dw 0x07a0, 0x85a1, 0x46b9, 0xc6b9
-    dw 0x07a1, 0x5e0f, 0x4746, 0x5df2
-    dw 0x07a2, 0x288e, 0x0ebf, 0x2881
-    dw 0x07a3, 0x390f, 0xad99, 0x39c2
-    dw 0x07a4, 0x62ae, 0xfa5f, 0x7a7a
-    dw 0x07a5, 0x5975, 0x6cf3, 0xecc7
-    dw 0x07a6, 0x165c, 0x57d1, 0xd7d1
-    dw 0x07a7, 0x7993, 0x417a, 0x7993
-    dw 0x07a8, 0x98f4, 0x00aa, 0x98f9
-    dw 0x07a9, 0xbe22, 0x2351, 0xbe31
-    dw 0x07aa, 0xaddc, 0xb6c6, 0x354f
-    dw 0x07ab, 0x0140, 0x473b, 0xc73b
-    dw 0x07ac, 0x82f7, 0xd795, 0x5795
-    dw 0x07ad, 0x485c, 0xc8a6, 0x4c81
-    dw 0x07ae, 0x4043, 0xacb4, 0x4069
-    dw 0x07af, 0x4e48, 0x86fd, 0x4e48
-    dw 0x07b0, 0x0ac4, 0x958e, 0x1666
-    dw 0x07b1, 0xaf8b, 0x1983, 0xafb7
-    dw 0x07b2, 0xce9d, 0x5d24, 0xdd8e
-    dw 0x07b3, 0x4e16, 0x5783, 0xd5fe
-    dw 0x07b4, 0xd5a7, 0xbb09, 0xd599
-    dw 0x07b5, 0x6ddf, 0x2d78, 0x6ddf
-    dw 0x07b6, 0x349d, 0xaf5a, 0x3674
-    dw 0x07b7, 0xc66d, 0x3547, 0xc6c1
-    dw 0x07b8, 0x6d7c, 0xe9be, 0x702e
-    dw 0x07b9, 0xe323, 0x2442, 0xe323
-    dw 0x07ba, 0xeafe, 0x2a5e, 0xeafe
-    dw 0x07bb, 0xa739, 0xc293, 0x4285
-    dw 0x07bc, 0x72ba, 0x6fe0, 0x6d94
-    dw 0x07bd, 0x02d7, 0x1f6f, 0x9f64
-    dw 0x07be, 0xbe28, 0x89d4, 0xbe28
-    dw 0x07bf, 0x2a33, 0x53b6, 0xd3b4
-    dw 0x07c0, 0x395f, 0x43b6, 0xc25e
-    dw 0x07c1, 0x2253, 0x9684, 0x2324
-    dw 0x07c2, 0xbfe8, 0x706a, 0xf06a
-    dw 0x07c3, 0xee07, 0x958f, 0xee07
-    dw 0x07c4, 0x2b73, 0x5be7, 0xdbe7
-    dw 0x07c5, 0xc308, 0x6010, 0xe017
-    dw 0x07c6, 0x0b41, 0x8975, 0x0e5b
-    dw 0x07c7, 0x9557, 0x78bd, 0xf8bd
-    dw 0x07c8, 0x7333, 0x787a, 0xf55a
-    dw 0x07c9, 0x9d00, 0x5e31, 0xde31
-    dw 0x07ca, 0xa2d9, 0x4439, 0xc43c
-    dw 0x07cb, 0x20c5, 0x1593, 0x2013
-    dw 0x07cc, 0xb419, 0x239c, 0xb456
-    dw 0x07cd, 0x3502, 0x7241, 0xf241
-    dw 0x07ce, 0xad70, 0x5f35, 0xdf35
-    dw 0x07cf, 0xc5f7, 0xe6cf, 0x66c9
+    ; Uniform random values
+    dw 0x02a4, 0x1bc8, 0xfb7c, 0x7b7c
+    dw 0x02a5, 0xb332, 0xc7fe, 0x47c4
+    dw 0x02a6, 0xdfdc, 0x1795, 0xdfdc
+    dw 0x02a7, 0x9726, 0x3ed7, 0xbed9
+    dw 0x02a8, 0x53ba, 0x93e3, 0x53ba
+    dw 0x02a9, 0x2a71, 0x4af2, 0xcaec
+    dw 0x02aa, 0x619c, 0x24d7, 0x619c
+    dw 0x02ab, 0x9904, 0x2c9c, 0xacc4
+    dw 0x02ac, 0xd981, 0xcfc1, 0xd889
+    dw 0x02ad, 0xa464, 0x1797, 0xa4dd
+    dw 0x02ae, 0x2e49, 0xd719, 0x571b
+    dw 0x02af, 0x800b, 0x6954, 0xe954
+    dw 0x02b0, 0xa530, 0x9b41, 0xa448
+    dw 0x02b1, 0x1ebe, 0xdb2c, 0x5b2c
+    dw 0x02b2, 0xf46a, 0xc0a0, 0xf46a
+    dw 0x02b3, 0x99d1, 0x89f5, 0x9972
+    dw 0x02b4, 0x0c3b, 0x1199, 0x8ef7
+    dw 0x02b5, 0x06cf, 0x3842, 0xb842
+    dw 0x02b6, 0x2e6c, 0x4de6, 0xcde0
+    dw 0x02b7, 0x6c3b, 0x8c8b, 0x6c3b
+    dw 0x02b8, 0x9040, 0x581d, 0xd81d
+    dw 0x02b9, 0x594f, 0x3ee2, 0x5941
+    dw 0x02ba, 0x79af, 0xab00, 0x79af
+    dw 0x02bb, 0x8bb1, 0x2577, 0xa586
+    dw 0x02bc, 0x316b, 0x11bf, 0x3165
+    dw 0x02bd, 0x795a, 0x8cf9, 0x795a
+    dw 0x02be, 0x8982, 0x4003, 0xc003
+    dw 0x02bf, 0x8f44, 0x5e76, 0xde76
+    dw 0x02c0, 0x4d9b, 0xec09, 0x6c0f
+    dw 0x02c1, 0x1264, 0x561e, 0xd61e
+    dw 0x02c2, 0x4824, 0x46bc, 0x3e30
+    dw 0x02c3, 0x32b3, 0x3f48, 0xbe72
+    dw 0x02c4, 0xbb0c, 0x8cec, 0xbb0b
+    dw 0x02c5, 0xb9e6, 0xbe2c, 0x3a72
+    dw 0x02c6, 0x5922, 0xc00e, 0x5932
+    dw 0x02c7, 0x7268, 0x0057, 0x7268
+    dw 0x02c8, 0x5d48, 0x78fd, 0xf8f2
+    dw 0x02c9, 0xe2e1, 0x6f8d, 0xf035
+    dw 0x02ca, 0x03d7, 0xf960, 0x7960
+    dw 0x02cb, 0xefc0, 0xa709, 0xefc0
+    dw 0x02cc, 0x6701, 0x34f5, 0x6701
+    dw 0x02cd, 0xcf55, 0xa1a6, 0xcf54
+    dw 0x02ce, 0x1e3f, 0x36b4, 0xb69b
+    dw 0x02cf, 0x77e9, 0xd5d6, 0x77ef
+    dw 0x02d0, 0xd989, 0x6bf3, 0xec26
+    dw 0x02d1, 0x4f57, 0xe22f, 0x626a
+    dw 0x02d2, 0x4b89, 0x17b6, 0x4b89
+    dw 0x02d3, 0xbfb1, 0xb7df, 0xbdb9
+    dw 0x02d4, 0x827d, 0xbe5e, 0x3e5e
+    dw 0x02d5, 0xc7e4, 0xacc2, 0xc7d1
+    dw 0x02d6, 0x33d2, 0x95a3, 0x33dd
+    dw 0x02d7, 0x4960, 0x46d2, 0x43dc
+    dw 0x02d8, 0x7006, 0xc94c, 0x7007
+    dw 0x02d9, 0x8469, 0x4c89, 0xcc89
+    dw 0x02da, 0x3dc7, 0x612f, 0xe12c
+    dw 0x02db, 0x5761, 0xaccc, 0x5762
+    dw 0x02dc, 0x83be, 0xaa44, 0x2a42
+    dw 0x02dd, 0x2feb, 0x8482, 0x2fec
+    dw 0x02de, 0x9978, 0x7b84, 0xfb84
+    dw 0x02df, 0xedfb, 0xae34, 0xedfb
+    dw 0x02e0, 0x13c5, 0x9f2f, 0x2014
+    dw 0x02e1, 0xbe09, 0xdbb2, 0x5ba6
+    dw 0x02e2, 0x341e, 0x34ee, 0xaa80
+    dw 0x02e3, 0xab22, 0x33f8, 0xb4e0
+    dw 0x02e4, 0x78c9, 0xca9e, 0x78c9
+    dw 0x02e5, 0xa796, 0x0504, 0xa79b
+    dw 0x02e6, 0x1578, 0x9b95, 0x1d28
+    dw 0x02e7, 0x375b, 0x1859, 0x3752
+    dw 0x02e8, 0x1a2a, 0x3186, 0xb16d
+    dw 0x02e9, 0x8dc3, 0x8781, 0x8bc6
+    dw 0x02ea, 0xd23b, 0xc385, 0xd1c3
+    dw 0x02eb, 0x63b2, 0xde49, 0x656b
+    dw 0x02ec, 0xe53c, 0x5227, 0xe56d
+    dw 0x02ed, 0x64d5, 0xb81f, 0x64d6
+    dw 0x02ee, 0xbfd2, 0xd2f1, 0x52b2
+    dw 0x02ef, 0x88b4, 0xd348, 0x5348
+    dw 0x02f0, 0xb561, 0x55ac, 0xd5b1
+    dw 0x02f1, 0x4884, 0x1a9e, 0x4884
+    dw 0x02f2, 0x263d, 0x1ec0, 0x248d
+    dw 0x02f3, 0x2bb0, 0xbf82, 0x3fc0
+    dw 0x02f4, 0xabc0, 0x0e12, 0xabcc
+    dw 0x02f5, 0xf10f, 0x0e3f, 0xf10f
+    dw 0x02f6, 0xcc02, 0x355c, 0xcc17
+    dw 0x02f7, 0x1de4, 0xbe0b, 0x3e11
+    dw 0x02f8, 0x782d, 0x0ada, 0x782d
+    dw 0x02f9, 0x4fda, 0x73bb, 0xf3b7
+    dw 0x02fa, 0xe913, 0xce12, 0xe907
+    dw 0x02fb, 0x61db, 0x734a, 0xf2ec
+    dw 0x02fc, 0x6150, 0xd9f1, 0x62cc
+    dw 0x02fd, 0x3848, 0x0122, 0x3848
+    dw 0x02fe, 0x06d5, 0xf960, 0x7960
+    dw 0x02ff, 0xc544, 0xeb56, 0x6b53
+    dw 0x0300, 0x00e1, 0xe94c, 0x694c
+    dw 0x0301, 0x4108, 0xb4cb, 0x41a1
+    dw 0x0302, 0x31bf, 0x6348, 0xe348
+    dw 0x0303, 0x1cd4, 0xb2b0, 0x32d7
+    dw 0x0304, 0x2b3c, 0xfa5e, 0x7a5e
+    dw 0x0305, 0xd49b, 0x9f7e, 0xd49b
+    dw 0x0306, 0x8b22, 0xbe4b, 0x3e4b
+    dw 0x0307, 0x8269, 0x437d, 0xc37d
+    dw 0x0308, 0xae3a, 0xf676, 0x7676
+    dw 0x0309, 0x04fe, 0xb4cc, 0x34cc
+    dw 0x030a, 0xd647, 0x3968, 0xd652
+    dw 0x030b, 0xac5d, 0x4b59, 0xcb62
+    dw 0x030c, 0xe771, 0x3959, 0xe772
+    dw 0x030d, 0xbde3, 0xf9f7, 0x79f7
+    dw 0x030e, 0x5e3e, 0xd18c, 0x5ef0
+    dw 0x030f, 0x0a56, 0xa391, 0x23aa
+    dw 0x0310, 0xce8b, 0x3a17, 0xcebc
+    dw 0x0311, 0xbf16, 0x4126, 0xc458
+    dw 0x0312, 0xb088, 0x1e23, 0xb0b9
+    dw 0x0313, 0x6a93, 0x9eb6, 0x6a93
+    dw 0x0314, 0x829b, 0x9d48, 0x1d3e
+    dw 0x0315, 0x3787, 0xde7e, 0x5e80
+    dw 0x0316, 0x58d3, 0x0a39, 0x58d3
+    dw 0x0317, 0xb538, 0x71c2, 0xf1c2
+    dw 0x0318, 0x64b6, 0x77e4, 0xf799
+    dw 0x0319, 0x07e8, 0xf611, 0x7611
+    dw 0x031a, 0x36af, 0xc354, 0x4415
+    dw 0x031b, 0x6ce4, 0x7439, 0xf200
+    dw 0x031c, 0xc323, 0x7934, 0xf934
+    dw 0x031d, 0xf03a, 0x1950, 0xf03a
+    dw 0x031e, 0x31ad, 0x1591, 0x31a2
+    dw 0x031f, 0x95c0, 0x327b, 0xb286
+    dw 0x0320, 0x5cce, 0xd348, 0x5db7
+    dw 0x0321, 0xde53, 0xb1bf, 0xde52
+    dw 0x0322, 0x5505, 0xe556, 0x65a6
+    dw 0x0323, 0x9ac6, 0x0e05, 0x9b87
+    dw 0x0324, 0x3343, 0x2230, 0x32e0
+    dw 0x0325, 0xb074, 0xc3f2, 0x43ab
+    dw 0x0326, 0x899b, 0x9478, 0x1389
+    dw 0x0327, 0x5b1f, 0xcc1c, 0x5ba2
+    dw 0x0328, 0xf16b, 0x09cc, 0xf16b
+    dw 0x0329, 0xa8ab, 0x0637, 0xa8ae
+    dw 0x032a, 0x8f96, 0x3073, 0xb077
+    dw 0x032b, 0xae23, 0x9bd6, 0xade4
+    dw 0x032c, 0x47df, 0x269f, 0x47d8
+    dw 0x032d, 0xbe13, 0x4359, 0xc531
+    dw 0x032e, 0xc21d, 0x4372, 0xc6c8
+    dw 0x032f, 0x55ec, 0x86c0, 0x55ec
+    dw 0x0330, 0x2c36, 0xdd4e, 0x5d4e
+    dw 0x0331, 0xc3a4, 0x4649, 0xc90e
+    dw 0x0332, 0xb3d7, 0xdd05, 0x5d04
+    dw 0x0333, 0xc412, 0x9dfa, 0xc411
+    dw 0x0334, 0xcb5a, 0xaabc, 0xcb53
+    dw 0x0335, 0x6bae, 0x2612, 0x6bae
+    dw 0x0336, 0x87fb, 0xae40, 0x2e3e
+    dw 0x0337, 0x0253, 0x06c8, 0x8475
+    dw 0x0338, 0xf10e, 0x2754, 0xf10e
+    dw 0x0339, 0xa974, 0xf626, 0x7626
+    dw 0x033a, 0xf808, 0x6110, 0xf81c
+    dw 0x033b, 0xd7bb, 0xe454, 0x63b1
+    dw 0x033c, 0xb67a, 0xde7d, 0x5e7b
+    dw 0x033d, 0xe730, 0xb7d3, 0xe730
+    dw 0x033e, 0x95d8, 0xa7f3, 0x2796
+    dw 0x033f, 0x3e18, 0xc339, 0x4522
+    dw 0x0340, 0x86fd, 0xfba2, 0x7ba2
+    dw 0x0341, 0xb19d, 0xf588, 0x7588
+    dw 0x0342, 0x5688, 0x89af, 0x5688
+    dw 0x0343, 0xae2c, 0xbfa4, 0x3f41
+    dw 0x0344, 0xf00f, 0x79c1, 0xfac5
+    dw 0x0345, 0x259a, 0x62c8, 0xe2c8
+    dw 0x0346, 0x3862, 0x18f2, 0x385d
+    dw 0x0347, 0x034d, 0x8918, 0x0abe
+    dw 0x0348, 0xb813, 0x1092, 0xb814
+    dw 0x0349, 0x3439, 0x313b, 0x2e6e
+    dw 0x034a, 0xd2f3, 0x45b2, 0xd3a9
+    dw 0x034b, 0x20c1, 0x6475, 0xe475
+    dw 0x034c, 0x31d2, 0xa458, 0x325d
+    dw 0x034d, 0x18be, 0xeb4e, 0x6b4e
+    dw 0x034e, 0xa80b, 0x58f7, 0xd8f7
+    dw 0x034f, 0x3245, 0x5f1d, 0xdf1c
+    dw 0x0350, 0x1bfe, 0xf003, 0x7003
+    dw 0x0351, 0x8dda, 0x0890, 0x9011
+    dw 0x0352, 0x5433, 0x11bf, 0x5433
+    dw 0x0353, 0x7740, 0x6b2e, 0x765a
+    dw 0x0354, 0x0bca, 0xc738, 0x4738
+    dw 0x0355, 0xe27f, 0x8180, 0xe27f
+    dw 0x0356, 0x5227, 0xa029, 0x5227
+    dw 0x0357, 0x3a8d, 0x82c5, 0x3a8d
+    dw 0x0358, 0x3d05, 0x7a67, 0xfa67
+    dw 0x0359, 0x56a6, 0x210d, 0x56a6
+    dw 0x035a, 0x9f1d, 0x4a47, 0xca48
+    dw 0x035b, 0xf799, 0x0b11, 0xf799
+    dw 0x035c, 0x3d78, 0x45f2, 0xc494
+    dw 0x035d, 0x4ae0, 0x1e39, 0x4adf
+    dw 0x035e, 0x945a, 0xd29b, 0x529b
+    dw 0x035f, 0xdee4, 0x1f07, 0xdee4
+    dw 0x0360, 0xb697, 0x92ba, 0xb694
+    dw 0x0361, 0xc0be, 0x1af7, 0xc0c0
+    dw 0x0362, 0x62fb, 0xf873, 0x788f
+    dw 0x0363, 0xd508, 0x44ea, 0xd557
+    dw 0x0364, 0x9b32, 0xaef4, 0x2eba
+    dw 0x0365, 0x9ac3, 0xb029, 0x300e
+    dw 0x0366, 0xde1c, 0xc936, 0xddf2
+    dw 0x0367, 0xeb1d, 0xce93, 0xeb10
+    dw 0x0368, 0x771d, 0xa537, 0x771d
+    dw 0x0369, 0x681c, 0x1d2e, 0x681c
+    dw 0x036a, 0xccd5, 0x63f7, 0xe40f
+    dw 0x036b, 0x569d, 0x6b23, 0xeaee
+    dw 0x036c, 0xb07e, 0xb68e, 0x344f
+    dw 0x036d, 0x3a26, 0xcbb9, 0x4c0e
+    dw 0x036e, 0xe314, 0xb5d2, 0xe313
+    dw 0x036f, 0xbde7, 0x46b4, 0xc817
+    dw 0x0370, 0xc84b, 0x15cd, 0xc84b
+    dw 0x0371, 0x7983, 0xd022, 0x7984
+    dw 0x0372, 0x68e6, 0xf689, 0x7726
+    dw 0x0373, 0x9e48, 0xa208, 0x1dc8
+    dw 0x0374, 0x1202, 0xfad0, 0x7ad0
+    dw 0x0375, 0x91b2, 0x26bd, 0xa6eb
+    dw 0x0376, 0x1bd5, 0x0d38, 0x1b2e
+    dw 0x0377, 0xbd33, 0x9fcc, 0xbd2b
+    dw 0x0378, 0x9e29, 0x6073, 0xe073
+    dw 0x0379, 0xd721, 0xd532, 0xcfbc
+    dw 0x037a, 0xeda6, 0xd471, 0xed94
+    dw 0x037b, 0x20d4, 0x8749, 0x20e3
+    dw 0x037c, 0xbf97, 0x266f, 0xbfb1
+    dw 0x037d, 0x23b4, 0xd263, 0x5263
+    dw 0x037e, 0x0698, 0x959f, 0x1608
+    dw 0x037f, 0xb18f, 0x1ae6, 0xb1ab
+    dw 0x0380, 0xa030, 0xd6b4, 0x56b4
+    dw 0x0381, 0xa050, 0xd10b, 0x510b
+    dw 0x0382, 0xde50, 0x8618, 0xde50
+    dw 0x0383, 0x502d, 0x6a4a, 0xea39
+    dw 0x0384, 0xb824, 0x8344, 0xb824
+    dw 0x0385, 0xb8b2, 0xdcd7, 0x5cd5
+    dw 0x0386, 0x1252, 0x51b3, 0xd1b3
+    dw 0x0387, 0xcd5a, 0x14d5, 0xcd5a
+    dw 0x0388, 0x2a54, 0x8854, 0x2a58
+    dw 0x0389, 0x5d1b, 0xb087, 0x5d1c
+    dw 0x038a, 0x8d10, 0xa221, 0x21f8
+    dw 0x038b, 0x943a, 0xc7f2, 0x47f2
+    dw 0x038c, 0xe6a4, 0xd26e, 0xe671
+    dw 0x038d, 0x3454, 0xe297, 0x6298
+    dw 0x038e, 0xe503, 0xecd8, 0x6b2e
+    dw 0x038f, 0x5fbc, 0x376d, 0x5fba
+    dw 0x0390, 0x14c7, 0xb427, 0x342c
+    dw 0x0391, 0x9f51, 0xb091, 0x3056
+    dw 0x0392, 0x4886, 0x3c4f, 0x47f8
+    dw 0x0393, 0x0c79, 0xc25e, 0x425e
+    dw 0x0394, 0x6b5e, 0xadfa, 0x6b5e
+    dw 0x0395, 0x09ca, 0xe2e5, 0x62e5
+    dw 0x0396, 0x5edb, 0xb279, 0x5edc
+    dw 0x0397, 0xc45b, 0xd340, 0x52b5
+    dw 0x0398, 0x0b33, 0x4d4c, 0xcd4c
+    dw 0x0399, 0xd665, 0x24b5, 0xd665
+    dw 0x039a, 0x36d5, 0x5f8e, 0xdf8c
+    dw 0x039b, 0x5fbe, 0x7612, 0xf5f3
+    dw 0x039c, 0x63ef, 0xd251, 0x642a
+    dw 0x039d, 0xabb8, 0x5ef2, 0xdef2
+    dw 0x039e, 0xc4a2, 0x0df4, 0xc4a2
+    dw 0x039f, 0xe3fe, 0x7be7, 0xfc00
+    dw 0x03a0, 0xafd0, 0x524b, 0xd24f
+    dw 0x03a1, 0x958b, 0x4150, 0xc151
+    dw 0x03a2, 0x1f2f, 0xcdfa, 0x4dfa
+    dw 0x03a3, 0x2f94, 0x48f6, 0xc8e7
+    dw 0x03a4, 0xccdb, 0x8e94, 0xccdb
+    dw 0x03a5, 0x1555, 0xd7c6, 0x57c6
+    dw 0x03a6, 0xcdb2, 0xd1b1, 0x4db0
+    dw 0x03a7, 0x1fe3, 0xe132, 0x6132
+    dw 0x03a8, 0x6ea5, 0x9498, 0x6ea5
+    dw 0x03a9, 0x85b4, 0x3953, 0xb953
+    dw 0x03aa, 0x37a5, 0x0114, 0x37a5
+    dw 0x03ab, 0x258a, 0x506d, 0xd06c
+    dw 0x03ac, 0xf415, 0x78f3, 0xfafe
+    dw 0x03ad, 0xc595, 0x0c09, 0xc595
+    dw 0x03ae, 0x75d5, 0x2502, 0x75d5
+    dw 0x03af, 0xa476, 0x5832, 0xd832
+    dw 0x03b0, 0x402b, 0x9391, 0x402b
+    dw 0x03b1, 0xb87e, 0x973d, 0xb87a
+    dw 0x03b2, 0x3498, 0x42e6, 0xc253
+    dw 0x03b3, 0x0af1, 0x5a08, 0xda08
+    dw 0x03b4, 0xd3f3, 0x1b0b, 0xd3f3
+    dw 0x03b5, 0xc357, 0x2fc0, 0xc395
+    dw 0x03b6, 0x802c, 0x41e5, 0xc1e5
+    dw 0x03b7, 0x8b8f, 0x71ba, 0xf1ba
+    dw 0x03b8, 0x9b7e, 0xefd0, 0x6fd0
+    dw 0x03b9, 0x7262, 0xaff1, 0x7262
+    dw 0x03ba, 0x5f31, 0xdf3e, 0x6338
+    dw 0x03bb, 0xe090, 0x5175, 0xe0e7
+    dw 0x03bc, 0x082c, 0x5644, 0xd644
+    dw 0x03bd, 0x5d44, 0x3d26, 0x5d3f
+    dw 0x03be, 0xce27, 0x8789, 0xce27
+    dw 0x03bf, 0x003c, 0x22c7, 0xa2c7
+    dw 0x03c0, 0xf5d9, 0xc14b, 0xf5d9
+    dw 0x03c1, 0xd2b6, 0x1409, 0xd2b6
+    dw 0x03c2, 0xeefe, 0xc7cd, 0xeefc
+    dw 0x03c3, 0x4730, 0x902a, 0x4730
+    dw 0x03c4, 0xa5e2, 0xd404, 0x5404
+    dw 0x03c5, 0x3a48, 0xaad2, 0x3ab5
+    dw 0x03c6, 0xe25f, 0xb5e5, 0xe25e
+    dw 0x03c7, 0x20f3, 0xebfa, 0x6bfa
+    dw 0x03c8, 0xef16, 0xaaf2, 0xef16
+    dw 0x03c9, 0xde03, 0x6072, 0xe374
+    dw 0x03ca, 0xa160, 0xf33d, 0x733d
+    dw 0x03cb, 0xcfae, 0xc482, 0xce8e
+    dw 0x03cc, 0x5876, 0x9d94, 0x5876
+    dw 0x03cd, 0x8bd1, 0xdb89, 0x5b89
+    dw 0x03ce, 0x1ab9, 0xccaf, 0x4caf
+    dw 0x03cf, 0x8f5f, 0xb7c4, 0x37c2
+    dw 0x03d0, 0x6f14, 0xcf70, 0x6f1b
+    dw 0x03d1, 0xe802, 0x4fa6, 0xe811
+    dw 0x03d2, 0x1389, 0x09d3, 0x1214
+    dw 0x03d3, 0x37f2, 0x6eb8, 0xeeb8
+    dw 0x03d4, 0x6f23, 0x96ce, 0x6f23
+    dw 0x03d5, 0x27c6, 0xbcd0, 0x3cef
+    dw 0x03d6, 0x771d, 0xdf98, 0x773b
+    dw 0x03d7, 0xbc2a, 0x0ae5, 0xbc2a
+    dw 0x03d8, 0x4a58, 0x2d69, 0x4a4d
+    dw 0x03d9, 0xf373, 0x4162, 0xf373
+    dw 0x03da, 0x1e8f, 0xdcec, 0x5cec
+    dw 0x03db, 0x7989, 0x82ec, 0x7989
+    dw 0x03dc, 0x15b7, 0x23be, 0xa307
+    dw 0x03dd, 0x9c43, 0x947b, 0x9a48
+    dw 0x03de, 0x7151, 0x852d, 0x7151
+    dw 0x03df, 0x7494, 0x06b6, 0x7494
+    dw 0x03e0, 0x47ba, 0xaacd, 0x47c8
+    dw 0x03e1, 0xdbbd, 0x534a, 0xdcc8
+    dw 0x03e2, 0xe4aa, 0xaed9, 0xe4aa
+    dw 0x03e3, 0x4bad, 0xee8c, 0x6e90
+    dw 0x03e4, 0x5497, 0x0d22, 0x5497
+    dw 0x03e5, 0x2ad9, 0xd504, 0x5505
+    dw 0x03e6, 0x8e44, 0xd8e1, 0x58e1
+    dw 0x03e7, 0x259e, 0x9708, 0x260e
+    dw 0x03e8, 0x199c, 0xd5f7, 0x55f7
+    dw 0x03e9, 0xc259, 0x8a64, 0xc259
+    dw 0x03ea, 0xd44b, 0x5b4a, 0xdcb8
+    dw 0x03eb, 0x8ce2, 0x5c14, 0xdc14
+    dw 0x03ec, 0x2ced, 0x6704, 0xe704
+    dw 0x03ed, 0x01d1, 0x4f3a, 0xcf3a
+    dw 0x03ee, 0x8da5, 0x2f68, 0xaf6e
+
+    ; Results near the exponent boundaries
+    dw 0x03ef, 0x0525, 0x051a, 0x000b
+    dw 0x03f0, 0x8a2c, 0x89c9, 0x80c6
+    dw 0x03f1, 0x0486, 0x07fe, 0x8378
+    dw 0x03f2, 0x0b62, 0x083f, 0x0646
+    dw 0x03f3, 0x028d, 0x03d8, 0x814b
+    dw 0x03f4, 0x7815, 0xf9bb, 0x7c00
+    dw 0x03f5, 0x0142, 0x00e1, 0x0061
+    dw 0x03f6, 0xf6bb, 0x73b0, 0xf94a
+    dw 0x03f7, 0x8b71, 0x8b50, 0x8042
+    dw 0x03f8, 0xfae3, 0x78cf, 0xfc00
+    dw 0x03f9, 0x01cc, 0x02fe, 0x8132
+    dw 0x03fa, 0xfb17, 0x7a18, 0xfc00
+    dw 0x03fb, 0xfa11, 0x7737, 0xfc00
+    dw 0x03fc, 0x8762, 0x8634, 0x812e
+    dw 0x03fd, 0x7857, 0xf41c, 0x7a65
+    dw 0x03fe, 0x78cd, 0xf713, 0x7c00
+    dw 0x03ff, 0x02f7, 0x0319, 0x8022
+    dw 0x0400, 0x005c, 0x02d9, 0x827d
+    dw 0x0401, 0x8872, 0x8ad9, 0x04ce
+    dw 0x0402, 0x85fc, 0x872c, 0x0130
+    dw 0x0403, 0xf8bb, 0x75d0, 0xfba3
+    dw 0x0404, 0xfb9a, 0x7514, 0xfc00
+    dw 0x0405, 0x8ba9, 0x8b60, 0x8092
+    dw 0x0406, 0x75cf, 0xf11e, 0x782f
+    dw 0x0407, 0x03ab, 0x02fd, 0x00ae
+    dw 0x0408, 0x8026, 0x8382, 0x035c
+    dw 0x0409, 0x7a89, 0xfbec, 0x7c00
+    dw 0x040a, 0x75a1, 0xf2be, 0x7880
+    dw 0x040b, 0xf47d, 0x713b, 0xf71a
+    dw 0x040c, 0x82be, 0x8304, 0x0046
+    dw 0x040d, 0x8a22, 0x873c, 0x8508
+    dw 0x040e, 0x78ce, 0xf6fa, 0x7c00
+    dw 0x040f, 0x8afe, 0x883a, 0x8588
+    dw 0x0410, 0xf935, 0x7a41, 0xfc00
+    dw 0x0411, 0x8300, 0x80a6, 0x825a
+    dw 0x0412, 0x750f, 0xf17e, 0x77ce
+    dw 0x0413, 0x8039, 0x812b, 0x00f2
+    dw 0x0414, 0xf416, 0x7039, 0xf632
+    dw 0x0415, 0x006f, 0x0131, 0x80c2
+    dw 0x0416, 0x0059, 0x00f7, 0x809e
+    dw 0x0417, 0xf5f6, 0x76d9, 0xfa68
+    dw 0x0418, 0xfbf2, 0x763e, 0xfc00
+    dw 0x0419, 0xfb7b, 0x7471, 0xfc00
+    dw 0x041a, 0x7869, 0xf44a, 0x7a8e
+    dw 0x041b, 0x0650, 0x03ce, 0x0282
+    dw 0x041c, 0xf9e6, 0x7b52, 0xfc00
+    dw 0x041d, 0x8550, 0x8728, 0x01d8
+    dw 0x041e, 0x8acf, 0x857c, 0x8811
+    dw 0x041f, 0x81ea, 0x81fa, 0x0010
+    dw 0x0420, 0x090f, 0x08f6, 0x0032
+    dw 0x0421, 0x81cb, 0x8262, 0x0097
+    dw 0x0422, 0x7653, 0xf237, 0x78b7
+    dw 0x0423, 0x09c3, 0x06f2, 0x0494
+    dw 0x0424, 0x7a38, 0xfb58, 0x7c00
+    dw 0x0425, 0x0902, 0x0bc3, 0x8582
+    dw 0x0426, 0x8772, 0x834f, 0x8423
+    dw 0x0427, 0x0a9b, 0x08cf, 0x0398
+    dw 0x0428, 0x851d, 0x81ab, 0x8372
+    dw 0x0429, 0x7530, 0xf3f2, 0x7894
+    dw 0x042a, 0x0495, 0x0604, 0x816f
+    dw 0x042b, 0x750a, 0xf22c, 0x7810
+    dw 0x042c, 0x84b2, 0x8484, 0x802e
+    dw 0x042d, 0x87fc, 0x8506, 0x82f6
+    dw 0x042e, 0x78db, 0xf569, 0x7b90
+    dw 0x042f, 0x89f7, 0x862a, 0x85c4
+    dw 0x0430, 0x84e2, 0x87b4, 0x02d2
+    dw 0x0431, 0x07fd, 0x0707, 0x00f6
+    dw 0x0432, 0x8342, 0x80af, 0x8293
+    dw 0x0433, 0xf5f9, 0x74a5, 0xf94f
+    dw 0x0434, 0xf97f, 0x75a6, 0xfc00
+    dw 0x0435, 0x055d, 0x04d0, 0x008d
+    dw 0x0436, 0x77f3, 0xf1da, 0x7970
+    dw 0x0437, 0x858a, 0x826d, 0x831d
+    dw 0x0438, 0x7724, 0xf040, 0x78a2
+    dw 0x0439, 0xfb6f, 0x76db, 0xfc00
+    dw 0x043a, 0x7510, 0xf7e9, 0x7a7c
+    dw 0x043b, 0x8707, 0x8080, 0x8687
+    dw 0x043c, 0x0287, 0x0072, 0x0215
+    dw 0x043d, 0x815a, 0x8044, 0x8116
+    dw 0x043e, 0x87a5, 0x830f, 0x8496
+    dw 0x043f, 0x880f, 0x85d5, 0x8249
+    dw 0x0440, 0xf734, 0x734c, 0xf96d
+    dw 0x0441, 0xf402, 0x7462, 0xf832
+    dw 0x0442, 0x76d4, 0xf20e, 0x78ee
+    dw 0x0443, 0x0a6e, 0x040a, 0x0869
+    dw 0x0444, 0x7b24, 0xf592, 0x7c00
+    dw 0x0445, 0xf73a, 0x77e6, 0xfb90
+    dw 0x0446, 0x0841, 0x06ce, 0x01b4
+    dw 0x0447, 0x81a7, 0x8110, 0x8097
+    dw 0x0448, 0x7457, 0xf217, 0x7762
+    dw 0x0449, 0x01a5, 0x03c9, 0x8224
+    dw 0x044a, 0x035a, 0x005b, 0x02ff
+    dw 0x044b, 0x7577, 0xf415, 0x78c6
+    dw 0x044c, 0x78a1, 0xf7d3, 0x7c00
+    dw 0x044d, 0xf80b, 0x741a, 0xfa18
+    dw 0x044e, 0x842c, 0x86b3, 0x0287
+    dw 0x044f, 0xf86f, 0x740d, 0xfa76
+    dw 0x0450, 0x85ee, 0x841f, 0x81cf
+    dw 0x0451, 0xfa06, 0x76f7, 0xfc00
+    dw 0x0452, 0xf6ec, 0x73a8, 0xf960
+    dw 0x0453, 0xf913, 0x76dd, 0xfc00
+    dw 0x0454, 0x0577, 0x05d6, 0x805f
+    dw 0x0455, 0x03a0, 0x015a, 0x0246
+    dw 0x0456, 0x897a, 0x8445, 0x86af
+    dw 0x0457, 0x76ad, 0xf708, 0x7ada
+    dw 0x0458, 0x0bd7, 0x070e, 0x0850
+    dw 0x0459, 0xf69e, 0x7343, 0xf920
+    dw 0x045a, 0xf652, 0x71d0, 0xf89d
+    dw 0x045b, 0xf8ec, 0x7678, 0xfc00
+    dw 0x045c, 0xf5b5, 0x74df, 0xf94a
+    dw 0x045d, 0x82fe, 0x8258, 0x80a6
+    dw 0x045e, 0xf7de, 0x7016, 0xf8f4
+    dw 0x045f, 0x743f, 0xf37a, 0x77fc
+    dw 0x0460, 0x03ae, 0x0081, 0x032d
+    dw 0x0461, 0x0ad7, 0x04fa, 0x085a
+    dw 0x0462, 0xf941, 0x75ec, 0xfc00
+    dw 0x0463, 0x032f, 0x035a, 0x802b
+    dw 0x0464, 0x883b, 0x89e3, 0x0350
+    dw 0x0465, 0x005d, 0x0170, 0x8113
+    dw 0x0466, 0xf959, 0x7b02, 0xfc00
+    dw 0x0467, 0x077f, 0x0761, 0x001e
+    dw 0x0468, 0x08d8, 0x0b9b, 0x8586
+    dw 0x0469, 0x7ac8, 0xf6f8, 0x7c00
+    dw 0x046a, 0x763f, 0xf578, 0x79dc
+    dw 0x046b, 0x05bb, 0x078d, 0x81d2
+    dw 0x046c, 0x7574, 0xf30b, 0x787d
+    dw 0x046d, 0x07a5, 0x016c, 0x0639
+    dw 0x046e, 0x8948, 0x8582, 0x850e
+    dw 0x046f, 0x0833, 0x0873, 0x8080
+    dw 0x0470, 0x8257, 0x82de, 0x0087
+    dw 0x0471, 0xf522, 0x7368, 0xf86b
+    dw 0x0472, 0xf513, 0x75ba, 0xf966
+    dw 0x0473, 0x0162, 0x00ad, 0x00b5
+    dw 0x0474, 0x06d5, 0x0389, 0x034c
+    dw 0x0475, 0x8802, 0x84e1, 0x8323
+    dw 0x0476, 0xf63b, 0x759d, 0xf9ec
+    dw 0x0477, 0x0b81, 0x041a, 0x0974
+    dw 0x0478, 0x759e, 0xf610, 0x79d7
+    dw 0x0479, 0xf6e2, 0x72c9, 0xf923
+    dw 0x047a, 0xf8f7, 0x748e, 0xfb3e
+    dw 0x047b, 0xfbe5, 0x795e, 0xfc00
+    dw 0x047c, 0x7564, 0xf74d, 0x7a58
+    dw 0x047d, 0x8be4, 0x8a43, 0x8342
+    dw 0x047e, 0xf69e, 0x7119, 0xf895
+    dw 0x047f, 0xf5fc, 0x700a, 0xf800
+    dw 0x0480, 0x85a1, 0x8219, 0x8388
+    dw 0x0481, 0xf934, 0x79b9, 0xfc00
+    dw 0x0482, 0x031a, 0x0181, 0x0199
+    dw 0x0483, 0x09ea, 0x0679, 0x055b
+    dw 0x0484, 0x825b, 0x823a, 0x8021
+    dw 0x0485, 0x7965, 0xf859, 0x7c00
+    dw 0x0486, 0x06f6, 0x0712, 0x801c
+    dw 0x0487, 0x82a7, 0x83c1, 0x011a
+    dw 0x0488, 0x03c9, 0x00e9, 0x02e0
+    dw 0x0489, 0x05a6, 0x0394, 0x0212
+    dw 0x048a, 0x7b8f, 0xf8b8, 0x7c00
+    dw 0x048b, 0x8494, 0x81c9, 0x82cb
+    dw 0x048c, 0x82b9, 0x810e, 0x81ab
+    dw 0x048d, 0x05d6, 0x069d, 0x80c7
+    dw 0x048e, 0x8970, 0x88d9, 0x812e
+    dw 0x048f, 0x0000, 0x02cc, 0x82cc
+    dw 0x0490, 0x7bab, 0xf770, 0x7c00
+    dw 0x0491, 0x09fa, 0x06f4, 0x0500
+    dw 0x0492, 0x00e2, 0x0311, 0x822f
+    dw 0x0493, 0xfac2, 0x751d, 0xfc00
+    dw 0x0494, 0x87e2, 0x82fc, 0x84e6
+    dw 0x0495, 0xf911, 0x74dc, 0xfb7f
+    dw 0x0496, 0x09f4, 0x08df, 0x022a
+    dw 0x0497, 0x8bf8, 0x851b, 0x896a
+    dw 0x0498, 0xf413, 0x773a, 0xf9a6
+    dw 0x0499, 0x8387, 0x8332, 0x8055
+    dw 0x049a, 0xf5b0, 0x7690, 0xfa20
+    dw 0x049b, 0x80a0, 0x8336, 0x0296
+    dw 0x049c, 0x0795, 0x06dd, 0x00b8
+    dw 0x049d, 0x7515, 0xf59b, 0x7958
+    dw 0x049e, 0x8062, 0x8000, 0x8062
+    dw 0x049f, 0x77f3, 0xf124, 0x7942
+    dw 0x04a0, 0x8089, 0x838b, 0x0302
+    dw 0x04a1, 0x0413, 0x04b5, 0x80a2
+    dw 0x04a2, 0x872e, 0x8380, 0x83ae
+    dw 0x04a3, 0xf89d, 0x794f, 0xfc00
+    dw 0x04a4, 0x865c, 0x86da, 0x007e
+    dw 0x04a5, 0x0adf, 0x0a92, 0x009a
+    dw 0x04a6, 0x784b, 0xf581, 0x7b0c
+    dw 0x04a7, 0x060b, 0x07ad, 0x81a2
+    dw 0x04a8, 0xf7a1, 0x7287, 0xf972
+    dw 0x04a9, 0x019d, 0x03a5, 0x8208
+    dw 0x04aa, 0x8666, 0x831d, 0x8349
+    dw 0x04ab, 0x0bb9, 0x062e, 0x08a2
+    dw 0x04ac, 0x879c, 0x8535, 0x8267
+    dw 0x04ad, 0x8a9d, 0x8a31, 0x80d8
+    dw 0x04ae, 0x0861, 0x0a3c, 0x83b6
+    dw 0x04af, 0x0b39, 0x0874, 0x058a
+    dw 0x04b0, 0x8a33, 0x86c2, 0x85a4
+    dw 0x04b1, 0x7595, 0xf5da, 0x79b8
+    dw 0x04b2, 0x879f, 0x80b3, 0x86ec
+    dw 0x04b3, 0x879b, 0x816a, 0x8631
+    dw 0x04b4, 0x7bdb, 0xfab8, 0x7c00
+    dw 0x04b5, 0x7731, 0xf664, 0x7aca
+    dw 0x04b6, 0x81e2, 0x839b, 0x01b9
+    dw 0x04b7, 0xfa21, 0x7802, 0xfc00
+    dw 0x04b8, 0x780f, 0xfacd, 0x7c00
+    dw 0x04b9, 0x02b4, 0x03e3, 0x812f
+    dw 0x04ba, 0x0679, 0x0549, 0x0130
+    dw 0x04bb, 0x792d, 0xf9d3, 0x7c00
+    dw 0x04bc, 0x85d6, 0x84c1, 0x8115
+    dw 0x04bd, 0xf411, 0x7164, 0xf6c3
+    dw 0x04be, 0x0b78, 0x0b62, 0x002c
+    dw 0x04bf, 0x880e, 0x8734, 0x80e8
+    dw 0x04c0, 0x8462, 0x8287, 0x81db
+    dw 0x04c1, 0x0392, 0x0338, 0x005a
+    dw 0x04c2, 0x89de, 0x876b, 0x8451
+    dw 0x04c3, 0x044c, 0x03b5, 0x0097
+    dw 0x04c4, 0x04af, 0x030a, 0x01a5
+    dw 0x04c5, 0x0ab9, 0x04e2, 0x0848
+    dw 0x04c6, 0x0875, 0x07b9, 0x0131
+    dw 0x04c7, 0x89e5, 0x89b8, 0x805a
+    dw 0x04c8, 0x08eb, 0x0867, 0x0108
+    dw 0x04c9, 0x79bd, 0xfb8c, 0x7c00
+    dw 0x04ca, 0x744f, 0xf38f, 0x780b
+    dw 0x04cb, 0x8a95, 0x8705, 0x8625
+    dw 0x04cc, 0x8617, 0x8661, 0x004a
+    dw 0x04cd, 0x78a4, 0xf74f, 0x7c00
+    dw 0x04ce, 0x878d, 0x81d8, 0x85b5
+    dw 0x04cf, 0x071e, 0x00a3, 0x067b
+    dw 0x04d0, 0x044d, 0x0558, 0x810b
+    dw 0x04d1, 0xf979, 0x74da, 0xfbe6
+    dw 0x04d2, 0x098a, 0x09d4, 0x8094
+    dw 0x04d3, 0x0456, 0x0253, 0x0203
+    dw 0x04d4, 0x7be2, 0xfa43, 0x7c00
+    dw 0x04d5, 0xf760, 0x7284, 0xf951
+    dw 0x04d6, 0x7419, 0xf3d9, 0x7803
+    dw 0x04d7, 0x7a26, 0xf64b, 0x7c00
+    dw 0x04d8, 0x75ef, 0xf3d4, 0x78ec
+    dw 0x04d9, 0x7a40, 0xf697, 0x7c00
+    dw 0x04da, 0x8054, 0x83f6, 0x03a2
+    dw 0x04db, 0x8213, 0x80fc, 0x8117
+    dw 0x04dc, 0x02ac, 0x006e, 0x023e
+    dw 0x04dd, 0x7a74, 0xfac6, 0x7c00
+    dw 0x04de, 0x797f, 0xf9c4, 0x7c00
+    dw 0x04df, 0xf59a, 0x73dc, 0xf8c4
+    dw 0x04e0, 0x7a5d, 0xfb6d, 0x7c00
+    dw 0x04e1, 0x812a, 0x8076, 0x80b4
+    dw 0x04e2, 0x86c3, 0x8055, 0x866e
+    dw 0x04e3, 0x814e, 0x83ad, 0x025f
+    dw 0x04e4, 0x0837, 0x0823, 0x0028
+    dw 0x04e5, 0x7b15, 0xf6f5, 0x7c00
+    dw 0x04e6, 0xf5e4, 0x7446, 0xf915
+    dw 0x04e7, 0x7a92, 0xfb48, 0x7c00
+    dw 0x04e8, 0x7866, 0xfa03, 0x7c00
+    dw 0x04e9, 0x8883, 0x8b41, 0x057c
+    dw 0x04ea, 0x8aef, 0x8664, 0x877a
+    dw 0x04eb, 0x025b, 0x01c8, 0x0093
+    dw 0x04ec, 0x7b50, 0xf599, 0x7c00
+    dw 0x04ed, 0xf570, 0x731f, 0xf880
+    dw 0x04ee, 0x7a47, 0xf470, 0x7c00
+    dw 0x04ef, 0x87fa, 0x85bc, 0x823e
+    dw 0x04f0, 0x0615, 0x0312, 0x0303
+    dw 0x04f1, 0x876d, 0x8748, 0x8025
+    dw 0x04f2, 0x762d, 0xf3ac, 0x7902
+    dw 0x04f3, 0xfa6c, 0x7871, 0xfc00
+    dw 0x04f4, 0x813e, 0x83ea, 0x02ac
+    dw 0x04f5, 0x03b5, 0x010a, 0x02ab
+    dw 0x04f6, 0x7b38, 0xfaa2, 0x7c00
+    dw 0x04f7, 0x8183, 0x82db, 0x0158
+    dw 0x04f8, 0xf78e, 0x7521, 0xfa58
+    dw 0x04f9, 0x0648, 0x067f, 0x8037
+    dw 0x04fa, 0x8a67, 0x8408, 0x8863
+    dw 0x04fb, 0x84fc, 0x8749, 0x024d
+    dw 0x04fc, 0x835b, 0x8314, 0x8047
+    dw 0x04fd, 0x7734, 0xf266, 0x7934
+    dw 0x04fe, 0xf45e, 0x70d9, 0xf6ca
+    dw 0x04ff, 0xfbd5, 0x79bc, 0xfc00
+    dw 0x0500, 0x80f6, 0x8078, 0x807e
+    dw 0x0501, 0x7bc2, 0xf4f1, 0x7c00
+    dw 0x0502, 0xf87b, 0x7736, 0xfc00
+    dw 0x0503, 0x780e, 0xf6cc, 0x7b74
+    dw 0x0504, 0x86c1, 0x84f2, 0x81cf
+    dw 0x0505, 0x8465, 0x87f3, 0x038e
+    dw 0x0506, 0x756e, 0xf034, 0x7788
+    dw 0x0507, 0x07ba, 0x04db, 0x02df
+    dw 0x0508, 0x89f8, 0x86d5, 0x851b
+    dw 0x0509, 0xf816, 0x774b, 0xfbbc
+    dw 0x050a, 0xf8c1, 0x7b6d, 0xfc00
+    dw 0x050b, 0x8bfb, 0x8a2f, 0x8398
+    dw 0x050c, 0x06d0, 0x0338, 0x0398
+    dw 0x050d, 0x826c, 0x83b0, 0x0144
+    dw 0x050e, 0x7812, 0xf6b3, 0x7b6c
+    dw 0x050f, 0x7b00, 0xfbff, 0x7c00
+    dw 0x0510, 0x7b33, 0xf90b, 0x7c00
+    dw 0x0511, 0x7947, 0xf510, 0x7bcf
+    dw 0x0512, 0x0425, 0x03f2, 0x0033
+    dw 0x0513, 0xfbba, 0x79a9, 0xfc00
+    dw 0x0514, 0x07c8, 0x0106, 0x06c2
+    dw 0x0515, 0x7acb, 0xfb81, 0x7c00
+    dw 0x0516, 0x74fe, 0xf111, 0x7786
+    dw 0x0517, 0x04d0, 0x05fe, 0x812e
+    dw 0x0518, 0xf51d, 0x724f, 0xf822
+    dw 0x0519, 0xf8dd, 0x78d9, 0xfc00
+    dw 0x051a, 0x08f3, 0x06c7, 0x031f
+    dw 0x051b, 0x0a75, 0x0836, 0x047e
+    dw 0x051c, 0x0638, 0x03af, 0x0289
+    dw 0x051d, 0x8bcb, 0x8668, 0x8897
+    dw 0x051e, 0x05a3, 0x0272, 0x0331
+    dw 0x051f, 0x8ba1, 0x84ca, 0x893c
+    dw 0x0520, 0x80da, 0x8030, 0x80aa
+    dw 0x0521, 0x8b57, 0x85e2, 0x8866
+    dw 0x0522, 0x0ad3, 0x0960, 0x02e6
+    dw 0x0523, 0x0332, 0x036d, 0x803b
+    dw 0x0524, 0xfbc5, 0x76e3, 0xfc00
+    dw 0x0525, 0x070e, 0x06b2, 0x005c
+    dw 0x0526, 0x76d0, 0xf045, 0x7879
+    dw 0x0527, 0x0405, 0x0144, 0x02c1
+    dw 0x0528, 0x8396, 0x8212, 0x8184
+    dw 0x0529, 0x8857, 0x85cc, 0x82e2
+    dw 0x052a, 0x09f0, 0x05c1, 0x061f
+    dw 0x052b, 0x867e, 0x8060, 0x861e
+    dw 0x052c, 0x76b4, 0xf357, 0x7930
+    dw 0x052d, 0x0468, 0x016a, 0x02fe
+    dw 0x052e, 0x0471, 0x068b, 0x821a
+    dw 0x052f, 0x80f5, 0x8343, 0x024e
+    dw 0x0530, 0xf791, 0x7395, 0xf9ae
+    dw 0x0531, 0x7433, 0xf101, 0x76b4
+    dw 0x0532, 0xf8d5, 0x7592, 0xfb9e
+    dw 0x0533, 0x06da, 0x0744, 0x806a
+    dw 0x0534, 0xfb0a, 0x7828, 0xfc00
+    dw 0x0535, 0xf58d, 0x75f8, 0xf9c2
+    dw 0x0536, 0x02e8, 0x0294, 0x0054
+    dw 0x0537, 0x0824, 0x0513, 0x0335
+    dw 0x0538, 0xf522, 0x713f, 0xf7c2
+    dw 0x0539, 0x0bae, 0x061d, 0x08a0
+
+    ; Mostly subnormal values
+    dw 0x053a, 0x83a1, 0x03c1, 0x8762
+    dw 0x053b, 0x811e, 0x037b, 0x8499
+    dw 0x053c, 0xd4ac, 0x82e3, 0xd4ac
+    dw 0x053d, 0xd727, 0x00e2, 0xd727
+    dw 0x053e, 0x82ea, 0x026a, 0x8554
+    dw 0x053f, 0x02a4, 0x3817, 0xb817
+    dw 0x0540, 0x802d, 0x0283, 0x82b0
+    dw 0x0541, 0x00e9, 0x80d4, 0x01bd
+    dw 0x0542, 0x83a2, 0x0368, 0x870a
+    dw 0x0543, 0xb826, 0x8233, 0xb826
+    dw 0x0544, 0x0184, 0x028c, 0x8108
+    dw 0x0545, 0x60ac, 0x80b2, 0x60ac
+    dw 0x0546, 0x577d, 0x0276, 0x577d
+    dw 0x0547, 0x037a, 0x0233, 0x0147
+    dw 0x0548, 0x012f, 0x01da, 0x80ab
+    dw 0x0549, 0x820e, 0x80e5, 0x8129
+    dw 0x054a, 0x8278, 0x69f9, 0xe9f9
+    dw 0x054b, 0x7067, 0x021e, 0x7067
+    dw 0x054c, 0xe776, 0x812a, 0xe776
+    dw 0x054d, 0x83f8, 0x02f8, 0x86f0
+    dw 0x054e, 0x8171, 0x31e0, 0xb1e0
+    dw 0x054f, 0xcbab, 0x8238, 0xcbab
+    dw 0x0550, 0x8243, 0x6694, 0xe694
+    dw 0x0551, 0x8191, 0x80a3, 0x80ee
+    dw 0x0552, 0x8079, 0x80d2, 0x0059
+    dw 0x0553, 0x875e, 0x8330, 0x842e
+    dw 0x0554, 0x82c2, 0x80bb, 0x8207
+    dw 0x0555, 0x8070, 0x6672, 0xe672
+    dw 0x0556, 0x8294, 0x0282, 0x8516
+    dw 0x0557, 0x807c, 0x563b, 0xd63b
+    dw 0x0558, 0x6c76, 0x0376, 0x6c76
+    dw 0x0559, 0x03b0, 0x83de, 0x078e
+    dw 0x055a, 0x3b41, 0xa6db, 0x3b78
+    dw 0x055b, 0x0043, 0x0283, 0x8240
+    dw 0x055c, 0xf4f3, 0x03cd, 0xf4f3
+    dw 0x055d, 0x81d3, 0x81f1, 0x001e
+    dw 0x055e, 0xdd5f, 0x03e4, 0xdd5f
+    dw 0x055f, 0x0055, 0x825a, 0x02af
+    dw 0x0560, 0x82fa, 0x8326, 0x002c
+    dw 0x0561, 0x02eb, 0x0231, 0x00ba
+    dw 0x0562, 0x807a, 0x0284, 0x82fe
+    dw 0x0563, 0x81ed, 0x1492, 0x94b1
+    dw 0x0564, 0x03cf, 0x82fd, 0x06cc
+    dw 0x0565, 0x81a2, 0x01b9, 0x835b
+    dw 0x0566, 0x80f1, 0x94a7, 0x1498
+    dw 0x0567, 0x83e4, 0x82c6, 0x811e
+    dw 0x0568, 0x01d5, 0x1210, 0x91d5
+    dw 0x0569, 0x02db, 0x4c2b, 0xcc2b
+    dw 0x056a, 0x8165, 0x01de, 0x8343
+    dw 0x056b, 0x8311, 0x825b, 0x80b6
+    dw 0x056c, 0x8232, 0x810b, 0x8127
+    dw 0x056d, 0x01ae, 0x80ad, 0x025b
+    dw 0x056e, 0x9aa3, 0x81f5, 0x9a93
+    dw 0x056f, 0x665a, 0x0390, 0x665a
+    dw 0x0570, 0xa077, 0x0340, 0xa07e
+    dw 0x0571, 0x4513, 0xc56f, 0x4941
+    dw 0x0572, 0x8117, 0x830d, 0x01f6
+    dw 0x0573, 0x0392, 0xb347, 0x3347
+    dw 0x0574, 0x0161, 0x9431, 0x1447
+    dw 0x0575, 0x0176, 0x0040, 0x0136
+    dw 0x0576, 0x8072, 0x825b, 0x01e9
+    dw 0x0577, 0x002c, 0x03a6, 0x837a
+    dw 0x0578, 0x1401, 0x8224, 0x1423
+    dw 0x0579, 0x0259, 0x828f, 0x04e8
+    dw 0x057a, 0x8657, 0xe391, 0x6391
+    dw 0x057b, 0x012f, 0x02a3, 0x8174
+    dw 0x057c, 0xd1e0, 0x0280, 0xd1e0
+    dw 0x057d, 0x008e, 0x02ef, 0x8261
+    dw 0x057e, 0x8110, 0x8263, 0x0153
+    dw 0x057f, 0x8380, 0x817b, 0x8205
+    dw 0x0580, 0x03b6, 0x810b, 0x04c1
+    dw 0x0581, 0x02f4, 0x01a2, 0x0152
+    dw 0x0582, 0x0100, 0x0039, 0x00c7
+    dw 0x0583, 0x8144, 0x82ed, 0x01a9
+    dw 0x0584, 0x0349, 0x832d, 0x0676
+    dw 0x0585, 0x19c8, 0x01bb, 0x19ba
+    dw 0x0586, 0x035f, 0x00af, 0x02b0
+    dw 0x0587, 0x0186, 0x81ee, 0x0374
+    dw 0x0588, 0x83fb, 0x81d1, 0x822a
+    dw 0x0589, 0x0156, 0x21f4, 0xa1f1
+    dw 0x058a, 0xfaab, 0x2562, 0xfaab
+    dw 0x058b, 0x03e8, 0x01bb, 0x022d
+    dw 0x058c, 0x2e9f, 0x03fa, 0x2e9e
+    dw 0x058d, 0x80c2, 0x80a0, 0x8022
+    dw 0x058e, 0x0091, 0x03e8, 0x8357
+    dw 0x058f, 0x749e, 0x00d5, 0x749e
+    dw 0x0590, 0x43d9, 0x0251, 0x43d9
+    dw 0x0591, 0x82c6, 0x0184, 0x844a
+    dw 0x0592, 0x51b9, 0xf01c, 0x7022
+    dw 0x0593, 0x83d9, 0x0232, 0x860b
+    dw 0x0594, 0x0028, 0x8087, 0x00af
+    dw 0x0595, 0x8301, 0xc551, 0x4551
+    dw 0x0596, 0xd729, 0x81c9, 0xd729
+    dw 0x0597, 0x822b, 0x020f, 0x843a
+    dw 0x0598, 0x82bb, 0x82b2, 0x8009
+    dw 0x0599, 0x820a, 0x02db, 0x84e5
+    dw 0x059a, 0xe064, 0x00ec, 0xe064
+    dw 0x059b, 0xe6c8, 0x81fc, 0xe6c8
+    dw 0x059c, 0x829a, 0x037a, 0x8614
+    dw 0x059d, 0xaee0, 0x9bf4, 0xaea0
+    dw 0x059e, 0x69ed, 0x82d0, 0x69ed
+    dw 0x059f, 0x0307, 0x03a2, 0x809b
+    dw 0x05a0, 0x8057, 0x00bc, 0x8113
+    dw 0x05a1, 0x0375, 0x01b1, 0x01c4
+    dw 0x05a2, 0x8187, 0x814f, 0x8038
+    dw 0x05a3, 0xa645, 0x014d, 0xa646
+    dw 0x05a4, 0x833c, 0x8c93, 0x0b88
+    dw 0x05a5, 0x813f, 0x0270, 0x83af
+    dw 0x05a6, 0x01dc, 0x2ba2, 0xaba1
+    dw 0x05a7, 0x0194, 0x03ff, 0x826b
+    dw 0x05a8, 0x54d3, 0x8229, 0x54d3
+    dw 0x05a9, 0x826c, 0x3e11, 0xbe11
+    dw 0x05aa, 0x0319, 0x03fc, 0x80e3
+    dw 0x05ab, 0x7ae2, 0x80a5, 0x7ae2
+    dw 0x05ac, 0x033e, 0x83a2, 0x06e0
+    dw 0x05ad, 0x8249, 0x82f6, 0x00ad
+    dw 0x05ae, 0x8241, 0x01a3, 0x83e4
+    dw 0x05af, 0x02ac, 0x8366, 0x0612
+    dw 0x05b0, 0x02bc, 0x8177, 0x0433
+    dw 0x05b1, 0x871a, 0x81be, 0x855c
+    dw 0x05b2, 0x819a, 0x022f, 0x83c9
+    dw 0x05b3, 0x815f, 0x0031, 0x8190
+    dw 0x05b4, 0x83f8, 0x81f9, 0x81ff
+    dw 0x05b5, 0x8003, 0x0339, 0x833c
+    dw 0x05b6, 0x2da5, 0x00aa, 0x2da5
+    dw 0x05b7, 0x024c, 0x014d, 0x00ff
+    dw 0x05b8, 0xdccb, 0x803f, 0xdccb
+    dw 0x05b9, 0x3fba, 0x0077, 0x3fba
+    dw 0x05ba, 0x0301, 0x60c8, 0xe0c8
+    dw 0x05bb, 0x830a, 0x956f, 0x153e
+    dw 0x05bc, 0x02f2, 0x00e7, 0x020b
+    dw 0x05bd, 0x008c, 0x8052, 0x00de
+    dw 0x05be, 0x0345, 0x803d, 0x0382
+    dw 0x05bf, 0x3945, 0x0025, 0x3945
+    dw 0x05c0, 0x01d6, 0x0130, 0x00a6
+    dw 0x05c1, 0x0135, 0x8327, 0x045c
+    dw 0x05c2, 0x0b58, 0xc214, 0x4214
+    dw 0x05c3, 0x819f, 0x81bb, 0x001c
+    dw 0x05c4, 0x025a, 0x824c, 0x04a6
+    dw 0x05c5, 0x8248, 0x03e7, 0x862f
+    dw 0x05c6, 0xf77a, 0x81c8, 0xf77a
+    dw 0x05c7, 0x3ad3, 0x8122, 0x3ad3
+    dw 0x05c8, 0x01e4, 0x827b, 0x045f
+    dw 0x05c9, 0xad77, 0x02db, 0xad78
+    dw 0x05ca, 0x8069, 0x807d, 0x0014
+    dw 0x05cb, 0x0354, 0x01ff, 0x0155
+    dw 0x05cc, 0x81aa, 0x00b3, 0x825d
+    dw 0x05cd, 0x8057, 0x01ae, 0x8205
+    dw 0x05ce, 0x5945, 0x83f4, 0x5945
+    dw 0x05cf, 0x826c, 0x2345, 0xa34a
+    dw 0x05d0, 0x814b, 0x814e, 0x0003
+    dw 0x05d1, 0x003a, 0x80bd, 0x00f7
+    dw 0x05d2, 0x0396, 0x9683, 0x16bc
+    dw 0x05d3, 0x4426, 0x02c0, 0x4426
+    dw 0x05d4, 0xeca5, 0x018b, 0xeca5
+    dw 0x05d5, 0x91da, 0xd727, 0x5727
+    dw 0x05d6, 0x02c0, 0x01c7, 0x00f9
+    dw 0x05d7, 0x8006, 0x8391, 0x038b
+    dw 0x05d8, 0x8350, 0xa0a8, 0x20a1
+    dw 0x05d9, 0x0023, 0x03e0, 0x83bd
+    dw 0x05da, 0x801b, 0x024c, 0x8267
+    dw 0x05db, 0x8308, 0x80eb, 0x821d
+    dw 0x05dc, 0x40c6, 0x827f, 0x40c6
+    dw 0x05dd, 0x800f, 0x03e3, 0x83f2
+    dw 0x05de, 0xe1bb, 0x4c90, 0xe1e0
+    dw 0x05df, 0x8194, 0x0ade, 0x8ba8
+    dw 0x05e0, 0x85e5, 0x0115, 0x86fa
+    dw 0x05e1, 0x83e6, 0x00a4, 0x848a
+    dw 0x05e2, 0x84ed, 0x81f9, 0x82f4
+    dw 0x05e3, 0x858e, 0x00a3, 0x8631
+    dw 0x05e4, 0x80ec, 0x01de, 0x82ca
+    dw 0x05e5, 0x0130, 0x0198, 0x8068
+    dw 0x05e6, 0x03a9, 0xf228, 0x7228
+    dw 0x05e7, 0x8217, 0x017f, 0x8396
+    dw 0x05e8, 0x00ff, 0x01a0, 0x80a1
+    dw 0x05e9, 0x83f6, 0x0020, 0x8416
+    dw 0x05ea, 0x8079, 0x80fb, 0x0082
+    dw 0x05eb, 0x01d7, 0x0164, 0x0073
+    dw 0x05ec, 0x8346, 0x0330, 0x8676
+    dw 0x05ed, 0x8092, 0x833f, 0x02ad
+    dw 0x05ee, 0x7570, 0x0205, 0x7570
+    dw 0x05ef, 0x81a7, 0x8088, 0x811f
+    dw 0x05f0, 0x92b0, 0x81a6, 0x927b
+    dw 0x05f1, 0x828d, 0xd089, 0x5089
+    dw 0x05f2, 0x8392, 0x7649, 0xf649
+    dw 0x05f3, 0x8fed, 0x0000, 0x8fed
+    dw 0x05f4, 0x813c, 0x4025, 0xc025
+    dw 0x05f5, 0x0324, 0x453c, 0xc53c
+    dw 0x05f6, 0x86e8, 0x0046, 0x872e
+    dw 0x05f7, 0x8000, 0x03e1, 0x83e1
+    dw 0x05f8, 0x0397, 0xc110, 0x4110
+    dw 0x05f9, 0x83d0, 0x95fc, 0x15bf
+    dw 0x05fa, 0x2d18, 0x03b6, 0x2d17
+    dw 0x05fb, 0x83a3, 0x83bc, 0x0019
+    dw 0x05fc, 0x03c9, 0x01ce, 0x01fb
+    dw 0x05fd, 0xd092, 0x02c2, 0xd092
+    dw 0x05fe, 0xbb79, 0x0229, 0xbb79
+    dw 0x05ff, 0x039c, 0x8210, 0x05ac
+    dw 0x0600, 0x00fd, 0x03ff, 0x8302
+    dw 0x0601, 0x0301, 0x007e, 0x0283
+    dw 0x0602, 0x39cd, 0x8376, 0x39cd
+    dw 0x0603, 0x81fd, 0x804f, 0x81ae
+    dw 0x0604, 0x8208, 0x80f8, 0x8110
+    dw 0x0605, 0xe3ee, 0x9b2e, 0xe3ee
+    dw 0x0606, 0xe158, 0x0260, 0xe158
+    dw 0x0607, 0x8366, 0x8158, 0x820e
+    dw 0x0608, 0x2d46, 0x8350, 0x2d47
+    dw 0x0609, 0x824c, 0x8395, 0x0149
+    dw 0x060a, 0xb128, 0x83b3, 0xb128
+    dw 0x060b, 0x00ac, 0x8018, 0x00c4
+    dw 0x060c, 0x82b0, 0x0058, 0x8308
+    dw 0x060d, 0x0329, 0x83f1, 0x071a
+    dw 0x060e, 0x83fe, 0x0243, 0x8641
+    dw 0x060f, 0x0331, 0x8349, 0x067a
+    dw 0x0610, 0x8270, 0x028f, 0x84ff
+    dw 0x0611, 0x02ee, 0x8329, 0x0617
+    dw 0x0612, 0x8126, 0x03be, 0x84e4
+    dw 0x0613, 0x8262, 0x83c2, 0x0160
+    dw 0x0614, 0x0012, 0x80a7, 0x00b9
+    dw 0x0615, 0x03a7, 0xfb00, 0x7b00
+    dw 0x0616, 0xb198, 0x8307, 0xb198
+    dw 0x0617, 0x8330, 0x83ff, 0x00cf
+    dw 0x0618, 0x4ee5, 0x80de, 0x4ee5
+    dw 0x0619, 0x01b2, 0x830f, 0x04c1
+    dw 0x061a, 0x826c, 0x82ec, 0x0080
+    dw 0x061b, 0x81b1, 0x3f17, 0xbf17
+    dw 0x061c, 0x83c8, 0x8291, 0x8137
+    dw 0x061d, 0x0366, 0x80b8, 0x041e
+    dw 0x061e, 0x9b97, 0x831d, 0x9b7e
+    dw 0x061f, 0x00fe, 0x8265, 0x0363
+    dw 0x0620, 0x4a15, 0x810b, 0x4a15
+    dw 0x0621, 0x025a, 0x0702, 0x84a8
+    dw 0x0622, 0x01e4, 0x457c, 0xc57c
+    dw 0x0623, 0x026e, 0x83c0, 0x062e
+    dw 0x0624, 0x6312, 0x4c39, 0x62f0
+    dw 0x0625, 0x023f, 0x029b, 0x805c
+    dw 0x0626, 0x00d2, 0x204c, 0xa04a
+    dw 0x0627, 0x0266, 0x0278, 0x8012
+    dw 0x0628, 0x823b, 0x80eb, 0x8150
+    dw 0x0629, 0x0251, 0x0395, 0x8144
+    dw 0x062a, 0x5237, 0x9973, 0x5237
+    dw 0x062b, 0x3086, 0x8310, 0x3086
+    dw 0x062c, 0x824c, 0x8e03, 0x0d70
+    dw 0x062d, 0x813a, 0x8ab8, 0x0a1b
+    dw 0x062e, 0x82a9, 0x0363, 0x860c
+    dw 0x062f, 0x0077, 0x832f, 0x03a6
+    dw 0x0630, 0xada0, 0x9736, 0xad83
+    dw 0x0631, 0x048e, 0x8060, 0x04ee
+    dw 0x0632, 0x03ae, 0x01e9, 0x01c5
+    dw 0x0633, 0x03e2, 0x00f7, 0x02eb
+    dw 0x0634, 0x839b, 0x0221, 0x85bc
+    dw 0x0635, 0x8386, 0x03e6, 0x876c
+    dw 0x0636, 0xfab7, 0x8022, 0xfab7
+    dw 0x0637, 0x83d7, 0x8340, 0x8097
+    dw 0x0638, 0x83d7, 0x81ae, 0x8229
+    dw 0x0639, 0x8225, 0x823e, 0x0019
+    dw 0x063a, 0x0192, 0x1025, 0x8fe6
+    dw 0x063b, 0x5431, 0x8100, 0x5431
+    dw 0x063c, 0x03c3, 0x8330, 0x06f3
+    dw 0x063d, 0x01af, 0x021c, 0x806d
+    dw 0x063e, 0x8140, 0xca28, 0x4a28
+    dw 0x063f, 0xaa16, 0x4eb7, 0xceba
+    dw 0x0640, 0x02aa, 0x03c8, 0x811e
+    dw 0x0641, 0x0163, 0x8774, 0x086c
+    dw 0x0642, 0x00ec, 0x8387, 0x0473
+    dw 0x0643, 0x1ad5, 0x8193, 0x1ae2
+    dw 0x0644, 0x02bc, 0x821e, 0x04da
+    dw 0x0645, 0x83be, 0x83c2, 0x0004
+    dw 0x0646, 0x827b, 0xce61, 0x4e61
+    dw 0x0647, 0x028a, 0x02af, 0x8025
+    dw 0x0648, 0xc12c, 0x0366, 0xc12c
+    dw 0x0649, 0x05f5, 0x821f, 0x080a
+    dw 0x064a, 0x0150, 0xf681, 0x7681
+    dw 0x064b, 0xa3e1, 0x8196, 0xa3de
+    dw 0x064c, 0x02c4, 0x022a, 0x009a
+    dw 0x064d, 0xf9e0, 0x03c2, 0xf9e0
+    dw 0x064e, 0x1a74, 0x8325, 0x1a8d
+    dw 0x064f, 0x8109, 0xab3c, 0x2b3b
+    dw 0x0650, 0x0078, 0x9eea, 0x1eec
+    dw 0x0651, 0x80b5, 0x81e6, 0x0131
+    dw 0x0652, 0x828b, 0xa115, 0x2110
+    dw 0x0653, 0x1d42, 0x808d, 0x1d44
+    dw 0x0654, 0x80be, 0x0265, 0x8323
+    dw 0x0655, 0x0fd2, 0x8072, 0x0fee
+    dw 0x0656, 0x01d6, 0x8154, 0x032a
+    dw 0x0657, 0x00fc, 0x7421, 0xf421
+    dw 0x0658, 0x837b, 0x94eb, 0x14b3
+    dw 0x0659, 0x83d8, 0x809d, 0x833b
+    dw 0x065a, 0x6d48, 0x81bd, 0x6d48
+    dw 0x065b, 0x831e, 0x82bc, 0x8062
+    dw 0x065c, 0x01a6, 0x1112, 0x90dd
+    dw 0x065d, 0x035d, 0x0350, 0x000d
+    dw 0x065e, 0x8354, 0x8064, 0x82f0
+    dw 0x065f, 0x03dd, 0xb1f3, 0x31f3
+    dw 0x0660, 0x8370, 0x56b0, 0xd6b0
+    dw 0x0661, 0x8232, 0x8273, 0x0041
+    dw 0x0662, 0x0020, 0x81df, 0x01ff
+    dw 0x0663, 0x81ae, 0x8099, 0x8115
+    dw 0x0664, 0x0091, 0x8303, 0x0394
+    dw 0x0665, 0x8308, 0x01c1, 0x84c9
+    dw 0x0666, 0x03c1, 0x8255, 0x0616
+    dw 0x0667, 0x023c, 0x02af, 0x8073
+    dw 0x0668, 0x01ee, 0x7bcb, 0xfbcb
+    dw 0x0669, 0x43e6, 0x00b5, 0x43e6
+    dw 0x066a, 0x8288, 0x014f, 0x83d7
+    dw 0x066b, 0xa0dd, 0x022a, 0xa0e1
+    dw 0x066c, 0x824c, 0x8261, 0x0015
+    dw 0x066d, 0x83ac, 0x0369, 0x8715
+    dw 0x066e, 0x83ea, 0x022c, 0x8616
+    dw 0x066f, 0x829c, 0xa124, 0x211f
+    dw 0x0670, 0x81d2, 0x02d0, 0x84a2
+    dw 0x0671, 0x0330, 0x80dd, 0x040d
+    dw 0x0672, 0x0038, 0x83a1, 0x03d9
+    dw 0x0673, 0x0181, 0x810c, 0x028d
+    dw 0x0674, 0x8383, 0x0268, 0x85eb
+    dw 0x0675, 0x8005, 0x0054, 0x8059
+    dw 0x0676, 0x81d8, 0x0103, 0x82db
+    dw 0x0677, 0x03b7, 0x806b, 0x0422
+    dw 0x0678, 0x0013, 0x81d5, 0x01e8
+    dw 0x0679, 0x02d7, 0x021c, 0x00bb
+    dw 0x067a, 0x815d, 0xa02a, 0x2027
+    dw 0x067b, 0x8311, 0x80cf, 0x8242
+    dw 0x067c, 0x80ac, 0x2a1e, 0xaa1e
+    dw 0x067d, 0xd096, 0xd7a1, 0x5556
+    dw 0x067e, 0x8196, 0x830f, 0x0179
+    dw 0x067f, 0x0192, 0x28b3, 0xa8b2
+    dw 0x0680, 0x22c7, 0x3d24, 0xbd16
+    dw 0x0681, 0x6361, 0x03c4, 0x6361
+    dw 0x0682, 0x0244, 0x80e1, 0x0325
+    dw 0x0683, 0x81d8, 0x89df, 0x08f3
+    dw 0x0684, 0x806d, 0x82e4, 0x0277
+
+    ; Rounding ties
+    dw 0x0685, 0x9274, 0x0dba, 0x94a8
+    dw 0x0686, 0x9600, 0x0218, 0x9622
+    dw 0x0687, 0x7a00, 0xd700, 0x7a04
+    dw 0x0688, 0xd600, 0xa800, 0xd600
+    dw 0x0689, 0xf518, 0xda40, 0xf50c
+    dw 0x068a, 0x6140, 0x3a00, 0x613e
+    dw 0x068b, 0x7800, 0x6738, 0x778c
+    dw 0x068c, 0x4c00, 0x2200, 0x4bfe
+    dw 0x068d, 0x2000, 0xa22f, 0x2518
+    dw 0x068e, 0xf058, 0x4a00, 0xf05a
+    dw 0x068f, 0x46c4, 0xa780, 0x46cc
+    dw 0x0690, 0x3400, 0xb053, 0x362a
+    dw 0x0691, 0x47d0, 0x9e00, 0x47d2
+    dw 0x0692, 0x9400, 0x8b52, 0x922c
+    dw 0x0693, 0xe4c0, 0x50d0, 0xe4e6
+    dw 0x0694, 0x4400, 0xbbdc, 0x44fc
+    dw 0x0695, 0x1640, 0x0358, 0x160a
+    dw 0x0696, 0xdce0, 0x5104, 0xdd80
+    dw 0x0697, 0x9c00, 0x8230, 0x9bee
+    dw 0x0698, 0xa2e0, 0x221b, 0xa67e
+    dw 0x0699, 0x78c0, 0xe8d8, 0x790e
+    dw 0x069a, 0x6300, 0xce50, 0x6332
+    dw 0x069b, 0x5741, 0xce00, 0x5860
+    dw 0x069c, 0xb449, 0x37c0, 0xba04
+    dw 0x069d, 0xfb00, 0x6c64, 0xfb8c
+    dw 0x069e, 0xd168, 0xc5c4, 0xd0b0
+    dw 0x069f, 0x0fc0, 0x00ce, 0x0f8c
+    dw 0x06a0, 0x2400, 0x9758, 0x2476
+    dw 0x06a1, 0x3800, 0x0800, 0x3800
+    dw 0x06a2, 0x1708, 0x8378, 0x1740
+    dw 0x06a3, 0xf680, 0xd9c0, 0xf674
+    dw 0x06a4, 0x2f60, 0x8200, 0x2f60
+    dw 0x06a5, 0xcd00, 0xbcf8, 0xccb0
+    dw 0x06a6, 0x2880, 0x2045, 0x26de
+    dw 0x06a7, 0xe7af, 0x4300, 0xe7b2
+    dw 0x06a8, 0xbb00, 0x1500, 0xbb02
+    dw 0x06a9, 0x77e0, 0xce00, 0x77e2
+    dw 0x06aa, 0x4280, 0x25c0, 0x4274
+    dw 0x06ab, 0x1d60, 0x9d9f, 0x2180
+    dw 0x06ac, 0xf400, 0x6558, 0xf456
+    dw 0x06ad, 0x4104, 0x9400, 0x4104
+    dw 0x06ae, 0xfa8e, 0xe1a0, 0xfa78
+    dw 0x06af, 0x6d70, 0xdfb8, 0x6dec
+    dw 0x06b0, 0xb970, 0x3272, 0xbb0c
+    dw 0x06b1, 0x6700, 0xc780, 0x6708
+    dw 0x06b2, 0xd4d0, 0x3680, 0xd4d6
+    dw 0x06b3, 0xb920, 0xac04, 0xb8a0
+    dw 0x06b4, 0xa100, 0x8340, 0xa0fa
+    dw 0x06b5, 0x3440, 0x2210, 0x3410
+    dw 0x06b6, 0xe828, 0xc880, 0xe824
+    dw 0x06b7, 0x0b28, 0x006b, 0x0af2
+    dw 0x06b8, 0x2000, 0x9724, 0x20e4
+    dw 0x06b9, 0xe100, 0x58d6, 0xe236
+    dw 0x06ba, 0xccf0, 0xb2c0, 0xcce2
+    dw 0x06bb, 0x3c00, 0x1a80, 0x3bfa
+    dw 0x06bc, 0xadbc, 0x8600, 0xadba
+    dw 0x06bd, 0xc900, 0xb5f0, 0xc8d0
+    dw 0x06be, 0xdf1b, 0xb000, 0xdf1a
+    dw 0x06bf, 0x7080, 0xca00, 0x7082
+    dw 0x06c0, 0x5080, 0x2a00, 0x507e
+    dw 0x06c1, 0x46a0, 0xc0fe, 0x4890
+    dw 0x06c2, 0xb9cc, 0x38af, 0xbd3e
+    dw 0x06c3, 0x0e14, 0x0346, 0x0d42
+    dw 0x06c4, 0x3850, 0x2ec6, 0x36ee
+    dw 0x06c5, 0x1000, 0x8484, 0x1090
+    dw 0x06c6, 0xc480, 0x31b0, 0xc4ae
+    dw 0x06c7, 0xb400, 0x1e60, 0xb41a
+    dw 0x06c8, 0x3e00, 0x2c18, 0x3dbe
+    dw 0x06c9, 0x4c00, 0xb620, 0x4c18
+    dw 0x06ca, 0x5d70, 0xb600, 0x5d72
+    dw 0x06cb, 0x9260, 0x0334, 0x92c6
+    dw 0x06cc, 0x2a18, 0x9ac8, 0x2a84
+    dw 0x06cd, 0xd320, 0xcd53, 0xd076
+    dw 0x06ce, 0x7180, 0xeabe, 0x7330
+    dw 0x06cf, 0xc742, 0x9800, 0xc742
+    dw 0x06d0, 0x6c00, 0xc600, 0x6c02
+    dw 0x06d1, 0x9c80, 0x8950, 0x9c56
+    dw 0x06d2, 0x9c60, 0x82a0, 0x9c56
+    dw 0x06d3, 0x5c00, 0x2c00, 0x5c00
+    dw 0x06d4, 0x5300, 0xbc50, 0x5322
+    dw 0x06d5, 0xcd70, 0x46e2, 0xcf28
+    dw 0x06d6, 0x16a0, 0x8328, 0x16d2
+    dw 0x06d7, 0xf880, 0x5200, 0xf882
+    dw 0x06d8, 0x6000, 0x3000, 0x6000
+    dw 0x06d9, 0xa790, 0x8380, 0xa78c
+    dw 0x06da, 0x5b00, 0x4f2c, 0x5a1a
+    dw 0x06db, 0xcb94, 0xad40, 0xcb8a
+    dw 0x06dc, 0x97a3, 0x0fc0, 0x98ca
+    dw 0x06dd, 0xa000, 0x05c0, 0xa00c
+    dw 0x06de, 0x4f60, 0xcf73, 0x536a
+    dw 0x06df, 0x59f4, 0x3200, 0x59f2
+    dw 0x06e0, 0xd620, 0xcc3e, 0xd510
+    dw 0x06e1, 0x2000, 0x8ba0, 0x201e
+    dw 0x06e2, 0x3d80, 0x1000, 0x3d80
+    dw 0x06e3, 0xa098, 0x81c0, 0xa094
+    dw 0x06e4, 0xac00, 0x0200, 0xac00
+    dw 0x06e5, 0x52f8, 0x3e70, 0x52c4
+    dw 0x06e6, 0x2880, 0x1cfe, 0x27c0
+    dw 0x06e7, 0x2400, 0x1f09, 0x207c
+    dw 0x06e8, 0xe200, 0xc080, 0xe1fc
+    dw 0x06e9, 0x5400, 0xae00, 0x5402
+    dw 0x06ea, 0xacc0, 0x91c0, 0xacb4
+    dw 0x06eb, 0xd75a, 0x4010, 0xd77a
+    dw 0x06ec, 0x915f, 0x0e00, 0x9430
+    dw 0x06ed, 0x71a0, 0xca00, 0x71a2
+    dw 0x06ee, 0xe380, 0x4080, 0xe384
+    dw 0x06ef, 0xd800, 0xa800, 0xd800
+    dw 0x06f0, 0x1b20, 0x0750, 0x1ae6
+    dw 0x06f1, 0xe400, 0xc080, 0xe3fc
+    dw 0x06f2, 0xab40, 0x0880, 0xab44
+    dw 0x06f3, 0x3700, 0x98c0, 0x370a
+    dw 0x06f4, 0x17d8, 0x0b1c, 0x16f4
+    dw 0x06f5, 0x6800, 0x59a4, 0x674c
+    dw 0x06f6, 0x4100, 0x1400, 0x4100
+    dw 0x06f7, 0x0b17, 0x8200, 0x0c0c
+    dw 0x06f8, 0x2700, 0x9310, 0x2738
+    dw 0x06f9, 0x89e0, 0x80db, 0x8972
+    dw 0x06fa, 0x3770, 0x298c, 0x36be
+    dw 0x06fb, 0x6980, 0xbc00, 0x6980
+    dw 0x06fc, 0x9800, 0x0928, 0x9852
+    dw 0x06fd, 0x6700, 0xbe00, 0x6702
+    dw 0x06fe, 0xdb1c, 0x2c00, 0xdb1c
+    dw 0x06ff, 0x1f48, 0x98fe, 0x20e4
+    dw 0x0700, 0x283f, 0x0100, 0x283e
+    dw 0x0701, 0xc800, 0xaa40, 0xc7f4
+    dw 0x0702, 0x97b0, 0x83b8, 0x9774
+    dw 0x0703, 0xda80, 0x4260, 0xda9a
+    dw 0x0704, 0x6800, 0x3e00, 0x67fe
+    dw 0x0705, 0x7800, 0xcc00, 0x7800
+    dw 0x0706, 0xdf00, 0x58aa, 0xe0aa
+    dw 0x0707, 0x4524, 0xabc0, 0x4534
+    dw 0x0708, 0x2ef8, 0x8600, 0x2efa
+    dw 0x0709, 0x6400, 0x4f30, 0x63c6
+    dw 0x070a, 0xf980, 0x5200, 0xf982
+    dw 0x070b, 0x4fec, 0x2b00, 0x4fe8
+    dw 0x070c, 0xdd98, 0x3000, 0xdd98
+    dw 0x070d, 0x3fb0, 0x9f80, 0x3fb8
+    dw 0x070e, 0xb5c0, 0x2e5a, 0xb756
+    dw 0x070f, 0x6ada, 0xe97f, 0x6e2c
+    dw 0x0710, 0x2080, 0x00c0, 0x207e
+    dw 0x0711, 0xf200, 0xd080, 0xf1fc
+    dw 0x0712, 0x4680, 0xa480, 0x4684
+    dw 0x0713, 0xe208, 0x4180, 0xe20e
+    dw 0x0714, 0xdc00, 0x4620, 0xdc18
+    dw 0x0715, 0x2c6a, 0x203a, 0x2bc6
+    dw 0x0716, 0x0808, 0x859b, 0x0ad6
+    dw 0x0717, 0x1800, 0x81d0, 0x180e
+    dw 0x0718, 0xe9b8, 0x4a80, 0xe9be
+    dw 0x0719, 0x4c10, 0x2000, 0x4c10
+    dw 0x071a, 0x0cef, 0x8cd0, 0x10e0
+    dw 0x071b, 0x3038, 0x9180, 0x303e
+    dw 0x071c, 0x78b0, 0xf3c6, 0x7aa2
+    dw 0x071d, 0xef6c, 0x5140, 0xef76
+    dw 0x071e, 0x9140, 0x8124, 0x911c
+    dw 0x071f, 0xf1a0, 0xc400, 0xf1a0
+    dw 0x0720, 0x7508, 0x692c, 0x7462
+    dw 0x0721, 0xc000, 0x1400, 0xc000
+    dw 0x0722, 0x2b40, 0x0c40, 0x2b38
+    dw 0x0723, 0xb140, 0x8a00, 0xb13e
+    dw 0x0724, 0x1c80, 0x166f, 0x19c8
+    dw 0x0725, 0xe754, 0xb800, 0xe754
+    dw 0x0726, 0x5b00, 0x2c00, 0x5b00
+    dw 0x0727, 0x6400, 0x3a00, 0x63fe
+    dw 0x0728, 0x3a00, 0x9200, 0x3a02
+    dw 0x0729, 0x1340, 0x03c4, 0x12c8
+    dw 0x072a, 0x9900, 0x81d0, 0x98f2
+    dw 0x072b, 0x4440, 0x3150, 0x4416
+    dw 0x072c, 0xc400, 0x9a00, 0xc3fe
+    dw 0x072d, 0x6be0, 0xbc00, 0x6be0
+    dw 0x072e, 0x2fcc, 0x0200, 0x2fcc
+    dw 0x072f, 0x9987, 0x0bb8, 0x9a02
+    dw 0x0730, 0x59f8, 0xbc40, 0x5a00
+    dw 0x0731, 0xb3c0, 0x2a44, 0xb4a8
+    dw 0x0732, 0x5400, 0xa800, 0x5400
+    dw 0x0733, 0xd0f0, 0xb180, 0xd0ea
+    dw 0x0734, 0x26c0, 0x9090, 0x26e4
+    dw 0x0735, 0x5e5e, 0xd72c, 0x6014
+    dw 0x0736, 0xa760, 0x0fe0, 0xa780
+    dw 0x0737, 0xa000, 0x2157, 0xa4ac
+    dw 0x0738, 0x870d, 0x0100, 0x8806
+    dw 0x0739, 0x0c00, 0x823a, 0x0c8e
+    dw 0x073a, 0x5c00, 0xbf80, 0x5c08
+    dw 0x073b, 0xc400, 0x9d00, 0xc3fe
+    dw 0x073c, 0x1170, 0x86c4, 0x1248
+    dw 0x073d, 0x0e6b, 0x8f12, 0x12be
+    dw 0x073e, 0xe840, 0xd2e0, 0xe824
+    dw 0x073f, 0x1900, 0x0a38, 0x189c
+    dw 0x0740, 0xe46c, 0x3800, 0xe46c
+    dw 0x0741, 0xf31d, 0x4400, 0xf31e
+    dw 0x0742, 0x3240, 0x95c0, 0x324c
+    dw 0x0743, 0xd500, 0x3fa0, 0xd51e
+    dw 0x0744, 0x7800, 0x4e00, 0x77fe
+    dw 0x0745, 0x9b00, 0x0090, 0x9b04
+    dw 0x0746, 0xb396, 0x9aa0, 0xb37c
+    dw 0x0747, 0x6c00, 0x6751, 0x6858
+    dw 0x0748, 0xa988, 0x0300, 0xa98a
+    dw 0x0749, 0x2d00, 0x0d80, 0x2cfa
+    dw 0x074a, 0x5400, 0xc4b8, 0x544c
+    dw 0x074b, 0x6800, 0xbc00, 0x6800
+    dw 0x074c, 0x631d, 0x51f8, 0x62be
+    dw 0x074d, 0x17e0, 0x8088, 0x17e8
+    dw 0x074e, 0x3d45, 0xa830, 0x3d66
+    dw 0x074f, 0xb400, 0xa5d4, 0xb346
+    dw 0x0750, 0x2012, 0x83c0, 0x201a
+    dw 0x0751, 0xf82e, 0x6e1c, 0xf8f2
+    dw 0x0752, 0x4800, 0x2ee0, 0x47e4
+    dw 0x0753, 0xcb91, 0x48e4, 0xce3a
+    dw 0x0754, 0xc800, 0xb738, 0xc78c
+    dw 0x0755, 0xae80, 0x0200, 0xae80
+    dw 0x0756, 0x7616, 0x5300, 0x7612
+    dw 0x0757, 0xf000, 0x4400, 0xf000
+    dw 0x0758, 0x9e28, 0x04a0, 0x9e3a
+    dw 0x0759, 0x9442, 0x82d8, 0x9414
+    dw 0x075a, 0xe140, 0xc5c0, 0xe134
+    dw 0x075b, 0x2640, 0x8680, 0x2646
+    dw 0x075c, 0xbbe0, 0x0c00, 0xbbe0
+    dw 0x075d, 0xc310, 0x9a00, 0xc30e
+    dw 0x075e, 0x3620, 0xa438, 0x3664
+    dw 0x075f, 0x5c60, 0xce28, 0x5cc2
+    dw 0x0760, 0x7840, 0x6924, 0x77dc
+    dw 0x0761, 0x67c0, 0x3800, 0x67c0
+    dw 0x0762, 0x2780, 0x9dc4, 0x2878
+    dw 0x0763, 0x6640, 0x57c8, 0x65c4
+    dw 0x0764, 0xdb28, 0xb200, 0xdb26
+    dw 0x0765, 0x0fc0, 0x008a, 0x0f9e
+    dw 0x0766, 0xc840, 0xab80, 0xc838
+    dw 0x0767, 0x44e0, 0x1e00, 0x44de
+    dw 0x0768, 0x1704, 0x82e8, 0x1732
+    dw 0x0769, 0xf773, 0x7640, 0xfada
+    dw 0x076a, 0x3780, 0x27b8, 0x3704
+    dw 0x076b, 0xd0b0, 0x3aa0, 0xd0ca
+    dw 0x076c, 0x7700, 0x5680, 0x76fa
+    dw 0x076d, 0x945e, 0x8b12, 0x92f8
+    dw 0x076e, 0x4900, 0xa880, 0x4904
+    dw 0x076f, 0xf170, 0xd5c0, 0xf164
+    dw 0x0770, 0x9100, 0x0034, 0x9106
+    dw 0x0771, 0xc500, 0xb0d0, 0xc4da
+    dw 0x0772, 0x2750, 0x9fcc, 0x28a2
+    dw 0x0773, 0x4800, 0x3468, 0x47ba
+    dw 0x0774, 0x6480, 0xdc4e, 0x6594
+    dw 0x0775, 0x4c00, 0xb6a0, 0x4c1a
+    dw 0x0776, 0x4400, 0x3188, 0x43a8
+    dw 0x0777, 0x7100, 0x679c, 0x700c
+    dw 0x0778, 0x4700, 0x2b40, 0x46f2
+    dw 0x0779, 0xce00, 0xb460, 0xcdee
+    dw 0x077a, 0xbe88, 0x1600, 0xbe8a
+    dw 0x077b, 0xaa00, 0x0a80, 0xaa06
+    dw 0x077c, 0xac0c, 0x2d6b, 0xb0bc
+    dw 0x077d, 0xf3c0, 0xcf00, 0xf3bc
+    dw 0x077e, 0x9da0, 0x83a0, 0x9d92
+    dw 0x077f, 0x2400, 0x8380, 0x2404
+    dw 0x0780, 0x1100, 0x005c, 0x10f4
+    dw 0x0781, 0x4000, 0x9d00, 0x4002
+    dw 0x0782, 0xb480, 0x8800, 0xb480
+    dw 0x0783, 0xce06, 0xc15c, 0xcd5a
+    dw 0x0784, 0x2eb4, 0x8200, 0x2eb4
+    dw 0x0785, 0xa500, 0x12d0, 0xa536
+    dw 0x0786, 0xe6f4, 0x3800, 0xe6f4
+    dw 0x0787, 0x6280, 0x3400, 0x6280
+    dw 0x0788, 0x2880, 0xa0ae, 0x29ac
+    dw 0x0789, 0x4000, 0x1b00, 0x3ffc
+    dw 0x078a, 0xa300, 0x0240, 0xa304
+    dw 0x078b, 0xd57e, 0x39c0, 0xd58a
+    dw 0x078c, 0xae20, 0x8c80, 0xae1c
+    dw 0x078d, 0x5f70, 0xb600, 0x5f72
+    dw 0x078e, 0xa000, 0x02c0, 0xa006
+    dw 0x078f, 0xf140, 0xc400, 0xf140
+    dw 0x0790, 0x1e00, 0x0360, 0x1df2
+    dw 0x0791, 0x3300, 0x28c6, 0x31ce
+    dw 0x0792, 0xfb00, 0xe360, 0xfae2
+    dw 0x0793, 0x3d98, 0x9000, 0x3d98
+    dw 0x0794, 0x6c80, 0xdbb0, 0x6cbe
+    dw 0x0795, 0x41ca, 0x9a00, 0x41cc
+    dw 0x0796, 0x3c50, 0x1000, 0x3c50
+    dw 0x0797, 0x5840, 0xda47, 0x5d44
+    dw 0x0798, 0xb3f2, 0x9cf0, 0xb3ca
+    dw 0x0799, 0xbdc0, 0x9c80, 0xbdbc
+    dw 0x079a, 0xe7c0, 0x57d0, 0xe81e
+    dw 0x079b, 0x38f0, 0x2878, 0x38a8
+    dw 0x079c, 0xa7da, 0x0bc0, 0xa7ea
+    dw 0x079d, 0xc406, 0x2fe0, 0xc426
+    dw 0x079e, 0xa1b8, 0x8340, 0xa1b2
+    dw 0x079f, 0x7900, 0xcc00, 0x7900
+    dw 0x07a0, 0x9b40, 0x02f0, 0x9b58
+    dw 0x07a1, 0x5700, 0x3300, 0x56fc
+    dw 0x07a2, 0x5000, 0xb380, 0x5008
+    dw 0x07a3, 0xb59c, 0x2738, 0xb610
+    dw 0x07a4, 0x6048, 0x3400, 0x6048
+    dw 0x07a5, 0xabc0, 0x28c9, 0xae44
+    dw 0x07a6, 0x1ffd, 0x13a4, 0x1f08
+    dw 0x07a7, 0xf198, 0x4a00, 0xf19a
+    dw 0x07a8, 0x19d0, 0x02d0, 0x19ba
+    dw 0x07a9, 0xbf80, 0x1c80, 0xbf84
+    dw 0x07aa, 0x9920, 0x0150, 0x992a
+    dw 0x07ab, 0xeb14, 0xc700, 0xeb10
+    dw 0x07ac, 0x6200, 0xbd00, 0x6202
+    dw 0x07ad, 0x9800, 0x0290, 0x9814
+    dw 0x07ae, 0xf410, 0x5c20, 0xf420
+    dw 0x07af, 0x1417, 0x00b8, 0x140c
+    dw 0x07b0, 0x782a, 0x6dd6, 0x76de
+    dw 0x07b1, 0x5fd0, 0xcd30, 0x6012
+    dw 0x07b2, 0x4a0c, 0x9c00, 0x4a0c
+    dw 0x07b3, 0xa5d0, 0x0180, 0xa5d2
+    dw 0x07b4, 0xade0, 0x1910, 0xae08
+    dw 0x07b5, 0xe8b0, 0xbc00, 0xe8b0
+    dw 0x07b6, 0x8e00, 0x0146, 0x8e52
+    dw 0x07b7, 0xf900, 0x5700, 0xf904
+    dw 0x07b8, 0xad98, 0x8600, 0xad96
+    dw 0x07b9, 0x48c0, 0xab80, 0x48c8
+    dw 0x07ba, 0x2100, 0x1128, 0x20ae
+    dw 0x07bb, 0xf200, 0x5740, 0xf20e
+    dw 0x07bc, 0x6f60, 0x679a, 0x6d7a
+    dw 0x07bd, 0x2a00, 0x8980, 0x2a06
+    dw 0x07be, 0x1d30, 0x948a, 0x1e52
+    dw 0x07bf, 0x5f70, 0xbc80, 0x5f74
+    dw 0x07c0, 0x6a00, 0x4a80, 0x69fa
+    dw 0x07c1, 0xd700, 0xc370, 0xd6c4
+    dw 0x07c2, 0x4800, 0x2b40, 0x47f2
+    dw 0x07c3, 0xe708, 0xdffe, 0xe508
+    dw 0x07c4, 0xe300, 0xd80a, 0xe1fe
+    dw 0x07c5, 0x6400, 0x4960, 0x63ea
+    dw 0x07c6, 0xa100, 0x8340, 0xa0fa
+    dw 0x07c7, 0x7060, 0xc400, 0x7060
+    dw 0x07c8, 0xc020, 0x1a00, 0xc022
+    dw 0x07c9, 0x4f00, 0xb8f0, 0x4f28
+    dw 0x07ca, 0x4ca3, 0xb0c0, 0x4cac
+    dw 0x07cb, 0x19a0, 0x0290, 0x198c
+    dw 0x07cc, 0xc6b1, 0x454e, 0xca00
+    dw 0x07cd, 0xb280, 0xa378, 0xb208
+    dw 0x07ce, 0xa420, 0x8180, 0xa41e
+    dw 0x07cf, 0xaa40, 0xa23e, 0xa8b0
 .unit_test_end
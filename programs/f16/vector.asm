@@ -0,0 +1,767 @@
+; Requires f16_internal.asm, mul.asm and fma.asm
+
+; Routines over arrays of n floats, given by pointers and n.
+;
+; .f16_dot and .f16_sum are reductions, which IEEE 754 allows to be computed
+; at any precision: their terms, each exact, are summed in an accumulator
+; held unpacked in registers - a sign, an exponent and 32 bits of
+; significand, with its leading 1 at bit 29, leaving room for a carry - and
+; rounded only once, at the end. Any bits of a term or of the accumulator
+; shifted out to align them are or-ed into the lowest bit. The results are
+; those of f16_dot and f16_sum in ref/float16.c.
+;
+; .f16_scale and .f16_axpy write a rounded result per element, as IEEE
+; requires, but do not repack what they can keep: .f16_scale unpacks its
+; scalar once, and .f16_axpy rounds each a * x + y only once, by .f16_fma.
+;
+; Each keeps up to four words on the stack, below sp, and restores sp.
+
+def f16_acc_nan         1   ; a NaN, inf - inf or 0 * inf was seen
+def f16_acc_pos_inf     2   ; +inf was seen
+def f16_acc_neg_inf     4   ; -inf was seen
+
+; Computes x[0] * y[0] + ... + x[n-1] * y[n-1].
+;
+; Arguments
+;   r0: x
+;   r1: y
+;   r2: n
+;
+; Results
+;   r2: the sum, +0 if n is 0; V=1 on NaN
+;
+.f16_dot
+{
+    alias r0 t_lo               ; once the product is formed
+    alias r2 acc_hi
+    alias r3 acc_exp
+    alias r4 acc_sign
+    alias r5 a_exp              ; then t_exp, the product's
+    alias r6 b_exp
+    alias r7 t_hi
+    alias r8 acc_lo
+    alias r9 x
+    alias r10 y
+    alias r11 t_sign
+
+    mov x, a
+    mov y, b
+    lsl z, #1                   ; n, in bytes
+    preq
+    bra .f16_return_pos_zero
+    add z, x
+
+    sub sp, #6
+    stw link, [sp, #0]
+    stw z, [sp, #2]             ; the end of x
+    mov tmp, #0
+    stw tmp, [sp, #4]           ; any specials seen
+
+    mov acc_hi, #0
+    mov acc_lo, #0
+    mov acc_exp, #0xc000        ; below any term's
+    mov acc_sign, #.f16_sign_mask
+
+.loop
+    ldw a, [x]
+    ldw b, [y]
+    add x, #2
+    add y, #2
+
+    mov tmp, #.f16_sign_mask
+    mov t_sign, a
+    eor t_sign, b
+    and t_sign, tmp             ; sign of the product
+
+    mov tmp, #.f16_sign_mask|.f16_exp_mask
+    mov a_exp, a                ; extract exponents
+    lsl a_exp, #1
+    lsr a_exp, #11
+    mov b_exp, b
+    lsl b_exp, #1
+    lsr b_exp, #11
+    bic a, tmp                  ; isolate fractions
+    bic b, tmp
+
+    ; less 1, as in .f16_fma
+    sub a_exp, #1
+    sub b_exp, #1
+    mov tmp, #30
+    cmp a_exp, tmp
+    prhs
+    bra .unusual
+    cmp b_exp, tmp
+    prhs
+    bra .unusual
+
+    orr a, #0x400
+    orr b, #0x400
+
+.significands
+    lsl a, #4                   ; the product, exact, as in .f16_fma
+    lsl b, #4
+    mov t_hi, a
+    muh t_hi, b
+    mul t_lo, b
+    add a_exp, b_exp
+    sub a_exp, #12
+    bl .f16_acc_add
+
+.next
+    ldw tmp, [sp, #2]
+    cmp x, tmp
+    prne
+    bra .loop
+
+    ldw b, [sp, #4]
+    ldw link, [sp, #0]
+    add sp, #6
+    bra .f16_acc_round
+
+.unusual
+    mov tmp, #30
+    cmp a_exp, tmp
+    preq
+    bra .a_special
+    cmp b_exp, tmp
+    preq
+    bra .b_special
+
+    and a_exp, a_exp            ; zero or subnormal?
+    prpl
+    bra .a_normal
+    and a, a
+    preq
+    bra .zero
+
+    clz tmp, a                  ; normalise a
+    sub tmp, #5
+    lsl a, tmp
+    mov a_exp, #0
+    sub a_exp, tmp
+    bra .a_done
+.a_normal
+    orr a, #0x400
+.a_done
+
+    and b_exp, b_exp            ; zero or subnormal?
+    prpl
+    bra .b_normal
+    and b, b
+    preq
+    bra .zero
+
+    clz tmp, b                  ; normalise b
+    sub tmp, #5
+    lsl b, tmp
+    mov b_exp, #0
+    sub b_exp, tmp
+    bra .significands
+.b_normal
+    orr b, #0x400
+    bra .significands
+
+.zero
+    and acc_hi, acc_hi          ; only the sign of a zero sum can change
+    preq
+    and acc_sign, t_sign
+    bra .next
+
+.a_special
+    and a, a
+    prne
+    bra .nan                    ; a is NaN
+    cmp b_exp, tmp
+    prne
+    bra .a_inf_b_finite
+    and b, b
+    prne
+    bra .nan                    ; b is NaN
+    bra .inf
+
+.a_inf_b_finite
+    mov tmp, b_exp              ; isZero(b) ?
+    add tmp, #1
+    orr tmp, b
+    preq
+    bra .nan                    ; inf * zero => nan
+    bra .inf
+
+.b_special
+    and b, b
+    prne
+    bra .nan                    ; b is NaN
+    mov tmp, a_exp              ; isZero(a) ?
+    add tmp, #1
+    orr tmp, a
+    preq
+    bra .nan                    ; zero * inf => nan
+
+.inf
+    mov tmp, #.f16_acc_pos_inf
+    and t_sign, t_sign
+    prne
+    mov tmp, #.f16_acc_neg_inf
+    bra .special
+
+.nan
+    mov tmp, #.f16_acc_nan
+
+.special
+    ldw b, [sp, #4]
+    orr b, tmp
+    stw b, [sp, #4]
+    bra .next
+}
+
+; Computes x[0] + ... + x[n-1].
+;
+; Arguments
+;   r0: x
+;   r1: n
+;
+; Results
+;   r2: the sum, +0 if n is 0; V=1 on NaN
+;
+.f16_sum
+{
+    alias r0 t_lo
+    alias r2 acc_hi
+    alias r3 acc_exp
+    alias r4 acc_sign
+    alias r5 t_exp
+    alias r7 t_hi
+    alias r8 acc_lo
+    alias r9 x
+    alias r11 t_sign
+
+    mov x, a
+    lsl b, #1                   ; n, in bytes
+    preq
+    bra .f16_return_pos_zero
+    add b, x
+
+    sub sp, #6
+    stw link, [sp, #0]
+    stw b, [sp, #2]             ; the end of x
+    mov tmp, #0
+    stw tmp, [sp, #4]           ; any specials seen
+
+    mov acc_hi, #0
+    mov acc_lo, #0
+    mov acc_exp, #0xc000        ; below any term's
+    mov acc_sign, #.f16_sign_mask
+
+.loop
+    ldw t_hi, [x]
+    add x, #2
+
+    mov tmp, #.f16_sign_mask
+    mov t_sign, t_hi
+    and t_sign, tmp
+
+    mov t_exp, t_hi             ; extract exponent, less 1
+    lsl t_exp, #1
+    lsr t_exp, #11
+    mov tmp, #.f16_sign_mask|.f16_exp_mask
+    bic t_hi, tmp
+    sub t_exp, #1
+    mov tmp, #30
+    cmp t_exp, tmp
+    prhs
+    bra .unusual
+
+    orr t_hi, #0x400
+
+.significand
+    lsl t_hi, #3                ; the leading 1 at bit 29
+    mov t_lo, #0
+    add t_exp, #1
+    bl .f16_acc_add
+
+.next
+    ldw tmp, [sp, #2]
+    cmp x, tmp
+    prne
+    bra .loop
+
+    ldw b, [sp, #4]
+    ldw link, [sp, #0]
+    add sp, #6
+    bra .f16_acc_round
+
+.unusual
+    and t_exp, t_exp            ; zero or subnormal?
+    prmi
+    bra .small
+
+    and t_hi, t_hi
+    mov tmp, #.f16_acc_nan
+    prne
+    bra .special
+    mov tmp, #.f16_acc_pos_inf
+    and t_sign, t_sign
+    prne
+    mov tmp, #.f16_acc_neg_inf
+
+.special
+    ldw b, [sp, #4]
+    orr b, tmp
+    stw b, [sp, #4]
+    bra .next
+
+.small
+    and t_hi, t_hi
+    preq
+    bra .zero
+
+    clz tmp, t_hi               ; normalise
+    sub tmp, #5
+    lsl t_hi, tmp
+    mov t_exp, #0
+    sub t_exp, tmp
+    bra .significand
+
+.zero
+    and acc_hi, acc_hi          ; only the sign of a zero sum can change
+    preq
+    and acc_sign, t_sign
+    bra .next
+}
+
+; Adds a term to the accumulator of .f16_dot or .f16_sum.
+;
+; Arguments
+;   r7:r0 term's significand, with its leading 1 at bit 28 or 29, and never 0
+;   r5: term's exponent, its value being r7:r0 * 2^(r5-44)
+;   r11: term's sign
+;
+;   r2:r8 accumulator's significand, with its leading 1 at bit 29, or 0
+;   r3: accumulator's exponent, as r5; 0xc000 when it is 0
+;   r4: accumulator's sign
+;
+; Results
+;   r2:r8, r3 and r4: the accumulator with the term added
+;   r0, r1, r5, r6, r7, r12: clobbered
+;
+.f16_acc_add
+{
+    alias r0 t_lo
+    alias r1 spill
+    alias r2 acc_hi
+    alias r3 acc_exp
+    alias r4 acc_sign
+    alias r5 shift
+    alias r6 spill_test
+    alias r7 t_hi
+    alias r8 acc_lo
+    alias r11 t_sign
+
+    sub shift, acc_exp          ; the term's exponent less the accumulator's
+    prlt
+    bra .acc_larger
+
+    ; The term's exponent is the greater, or the same: shift the
+    ; accumulator right to align it, as .f16_fma shifts c.
+    add acc_exp, shift
+    mov tmp, #16
+    cmp shift, tmp
+    prhs
+    bra .acc_far
+
+    mov spill, acc_lo
+    lsr acc_lo, shift
+    mov spill_test, acc_lo
+    lsl spill_test, shift
+    cmp spill_test, spill       ; any bits shifted out?
+    prne
+    orr acc_lo, #bit 0
+    mov spill, acc_hi           ; bits shifted into acc_lo
+    rsb shift, tmp
+    lsl spill, shift
+    orr acc_lo, spill
+    rsb shift, tmp
+    lsr acc_hi, shift
+    bra .acc_aligned
+
+.acc_far
+    sub shift, #16
+    mov spill, acc_hi
+    lsr spill, shift
+    mov spill_test, spill
+    lsl spill_test, shift
+    eor spill_test, acc_hi      ; the bits shifted out of acc_hi
+    orr spill_test, acc_lo      ; and all of acc_lo
+    mov acc_lo, spill
+    mov acc_hi, #0
+    and spill_test, spill_test
+    prne
+    orr acc_lo, #bit 0
+
+.acc_aligned
+    cmp t_sign, acc_sign
+    mov acc_sign, t_sign        ; the term's, unless it is the smaller
+    prne
+    bra .from_term
+
+    add acc_lo, t_lo
+    adc acc_hi, t_hi
+    bra .normalise
+
+.from_term
+    rsb acc_lo, t_lo
+    rsc acc_hi, t_hi
+    prcs
+    bra .positive
+
+    mov tmp, #0                 ; negate, and flip the sign
+    rsb acc_lo, tmp
+    rsc acc_hi, tmp
+    eor acc_sign, #.f16_sign_mask
+
+.positive
+    and acc_hi, acc_hi
+    prne
+    bra .normalise
+
+    ; after cancellation, which was exact
+    and acc_lo, acc_lo
+    preq
+    bra .cancelled
+    mov acc_hi, acc_lo
+    lsr acc_hi, #2
+    lsl acc_lo, #14
+    sub acc_exp, #14
+    bra .positive
+
+.cancelled
+    mov acc_sign, #0            ; +0
+    mov acc_exp, #0xc000
+    mov pc, link
+
+.acc_larger
+    ; The accumulator's exponent is the greater, so it is the larger: shift
+    ; the term right to align it.
+    mov tmp, #0
+    rsb shift, tmp              ; 1 or more
+    mov tmp, #16
+    cmp shift, tmp
+    prhs
+    bra .term_far
+
+    mov spill, t_lo
+    lsr t_lo, shift
+    mov spill_test, t_lo
+    lsl spill_test, shift
+    cmp spill_test, spill       ; any bits shifted out?
+    prne
+    orr t_lo, #bit 0
+    mov spill, t_hi             ; bits shifted into t_lo
+    rsb shift, tmp
+    lsl spill, shift
+    orr t_lo, spill
+    rsb shift, tmp
+    lsr t_hi, shift
+    bra .term_aligned
+
+.term_far
+    sub shift, #16
+    mov spill, t_hi
+    lsr spill, shift
+    mov spill_test, spill
+    lsl spill_test, shift
+    eor spill_test, t_hi        ; the bits shifted out of t_hi
+    orr spill_test, t_lo        ; and all of t_lo
+    mov t_lo, spill
+    mov t_hi, #0
+    and spill_test, spill_test
+    prne
+    orr t_lo, #bit 0
+
+.term_aligned
+    cmp t_sign, acc_sign
+    prne
+    bra .less_term
+
+    add acc_lo, t_lo
+    adc acc_hi, t_hi
+    bra .normalise
+
+.less_term
+    sub acc_lo, t_lo
+    sbc acc_hi, t_hi            ; leading 1 at bit 28 or 29
+
+.normalise
+    ; Bring the leading 1 back to bit 29, from anywhere up to bit 30.
+    clz shift, acc_hi
+    sub shift, #2
+    preq
+    mov pc, link
+    prmi
+    bra .halve
+
+    sub acc_exp, shift
+    lsl acc_hi, shift
+    mov spill, acc_lo
+    mov tmp, #16
+    sub tmp, shift
+    lsr spill, tmp
+    orr acc_hi, spill
+    lsl acc_lo, shift
+    mov pc, link
+
+.halve
+    add acc_exp, #1
+    lsr acc_hi, #1
+    rrx acc_lo
+    prcs
+    orr acc_lo, #bit 0
+    mov pc, link
+}
+
+; Rounds the accumulator of .f16_dot or .f16_sum, as described for
+; .f16_acc_add, to the result.
+;
+; Arguments
+;   r1: specials seen (f16_acc_nan, f16_acc_pos_inf and f16_acc_neg_inf)
+;   r2:r8, r3, r4: the accumulator
+;
+; Results
+;   r2: result; V=1 on NaN
+;
+.f16_acc_round
+{
+    alias r1 specials
+    alias r8 acc_lo
+
+    and specials, specials
+    prne
+    bra .special
+
+    and z, z
+    preq
+    bra .f16_return_zero
+
+    lsl z, #1                   ; the leading 1 to bit 14
+    mov tmp, acc_lo
+    lsr tmp, #15
+    orr z, tmp
+    lsl acc_lo, #1              ; and any bits below as a sticky bit
+    prne
+    orr z, #bit 0
+    sub z_exp, #1
+    bra .f16_round_pack
+
+.special
+    tst specials, #.f16_acc_nan
+    prne
+    bra .f16_return_nan
+    mov tmp, #.f16_acc_pos_inf|.f16_acc_neg_inf
+    cmp specials, tmp
+    preq
+    bra .f16_return_nan         ; inf - inf => nan
+    mov z_sign, #0
+    tst specials, #.f16_acc_neg_inf
+    prne
+    mov z_sign, #.f16_sign_mask
+    bra .f16_return_inf
+}
+
+; Computes x[i] = s * x[i] for i from 0 to n-1, each as .f16_mul would.
+;
+; Arguments
+;   r0: s
+;   r1: x
+;   r2: n
+;
+.f16_scale
+{
+    alias r7 s_sig
+    alias r8 s_exp
+    alias r9 s_sign
+    alias r10 x
+    alias r11 end
+
+    mov x, b
+    lsl z, #1                   ; n, in bytes
+    preq
+    mov pc, link
+    mov end, x
+    add end, z
+
+    sub sp, #4
+    stw link, [sp, #0]
+    stw a, [sp, #2]             ; s, for .f16_mul
+
+    mov tmp, #.f16_sign_mask
+    mov s_sign, a
+    and s_sign, tmp
+    mov s_exp, a                ; extract exponent, less 1
+    lsl s_exp, #1
+    lsr s_exp, #11
+    mov s_sig, a
+    mov tmp, #.f16_sign_mask|.f16_exp_mask
+    bic s_sig, tmp
+    sub s_exp, #1
+    mov tmp, #30
+    cmp s_exp, tmp
+    prlo
+    bra .s_normal
+
+    ; a zero, inf or NaN s leaves nothing worth unpacking
+    and s_exp, s_exp
+    prpl
+    bra .by_call
+    and s_sig, s_sig
+    preq
+    bra .by_call
+
+    clz tmp, s_sig              ; normalise s
+    sub tmp, #5
+    lsl s_sig, tmp
+    mov s_exp, #0
+    sub s_exp, tmp
+    bra .s_unpacked
+
+.s_normal
+    orr s_sig, #0x400
+.s_unpacked
+    lsl s_sig, #4
+    sub s_exp, #13              ; so a product's exponent is s_exp plus x[i]'s less 1
+
+.loop
+    ldw b, [x]
+    mov tmp, #.f16_sign_mask
+    mov z_sign, b
+    and z_sign, tmp
+    eor z_sign, s_sign
+
+    mov z_exp, b                ; extract exponent, less 1
+    lsl z_exp, #1
+    lsr z_exp, #11
+    mov tmp, #.f16_sign_mask|.f16_exp_mask
+    bic b, tmp
+    sub z_exp, #1
+    mov tmp, #30
+    cmp z_exp, tmp
+    prhs
+    bra .unusual
+
+    orr b, #0x400
+
+.significand
+    ; as .f16_mul
+    add z_exp, s_exp
+    lsl b, #5
+    mov z, s_sig
+    muh z, b
+    mul b, s_sig                ; lo bits of product, which we discard, but...
+    prne                        ; if any of the discarded bits are non-zero
+    orr z, #bit 0               ; set a sticky bit at the end of the retained bits
+
+    mov tmp, #0x4000
+    cmp z, tmp
+    prhs
+    bra .product
+    sub z_exp, #1
+    lsl z, #1
+.product
+    bl .f16_round_pack
+
+.store
+    stw z, [x]
+    add x, #2
+    cmp x, end
+    prne
+    bra .loop
+
+.done
+    ldw link, [sp, #0]
+    add sp, #4
+    mov pc, link
+
+.unusual
+    and z_exp, z_exp            ; zero or subnormal?
+    prpl
+    bra .special
+
+    and b, b
+    preq
+    bra .zero
+
+    clz tmp, b                  ; normalise x[i]
+    sub tmp, #5
+    lsl b, tmp
+    mov z_exp, #0
+    sub z_exp, tmp
+    bra .significand
+
+.zero
+    mov z, z_sign
+    bra .store
+
+.special
+    ldw a, [sp, #2]             ; inf or NaN
+    ldw b, [x]
+    bl .f16_mul
+    bra .store
+
+.by_call
+    ldw a, [sp, #2]
+    ldw b, [x]
+    bl .f16_mul
+    stw z, [x]
+    add x, #2
+    cmp x, end
+    prne
+    bra .by_call
+    bra .done
+}
+
+; Computes y[i] = a * x[i] + y[i] for i from 0 to n-1, each rounded once,
+; as .f16_fma.
+;
+; Arguments
+;   r0: a
+;   r1: x
+;   r2: y
+;   r3: n
+;
+.f16_axpy
+{
+    alias r11 x
+
+    lsl z_exp, #1               ; n, in bytes
+    preq
+    mov pc, link
+    add z_exp, b
+
+    ; .f16_fma leaves only r11, so the rest are kept on the stack
+    sub sp, #8
+    stw link, [sp, #0]
+    stw a, [sp, #2]
+    stw z, [sp, #4]             ; y
+    stw z_exp, [sp, #6]         ; the end of x
+    mov x, b
+
+.loop
+    ldw a, [sp, #2]
+    ldw b, [x]
+    ldw tmp, [sp, #4]
+    ldw z, [tmp]
+    bl .f16_fma
+
+    ldw tmp, [sp, #4]
+    stw z, [tmp]
+    add tmp, #2
+    stw tmp, [sp, #4]
+    add x, #2
+    ldw tmp, [sp, #6]
+    cmp x, tmp
+    prne
+    bra .loop
+
+    ldw link, [sp, #0]
+    add sp, #8
+    mov pc, link
+}
@@ -287,8 +287,8 @@ org 0x0000
     dw 0x8421, 0x8399, 0x8312, 0x828C, 0x8208, 0x8184, 0x8102, 0x8080
 }
 
-// TODO entry to save/restore regs
-// TODO signed versions
+; TODO entry to save/restore regs
+; TODO signed versions
 .math_udiv32_fast {
     ;
     ; Requires approx 107 instructions compared to
@@ -0,0 +1,26 @@
+; Semihosting calls, carried out by the simulator (see semihost.h) - list
+; this file before the program using them, e.g.
+;
+;       ./asm.pl programs/semihost.asm prog.asm
+;
+;       mov r0, #hi(.message)
+;       add r0, #lo(.message)
+;       mov r1, #.message_end-.message
+;       swi #.SYS_WRITE
+;       mov r0, #0
+;       swi #.SYS_EXIT
+;
+; Arguments and results are in r0-r3; no other registers are changed.
+
+    def SYS_EXIT            0xf0    ; exit with status r0
+    def SYS_PUTC            0xf1    ; write the byte r0 to stdout
+    def SYS_WRITE           0xf2    ; write r1 bytes from address r0 to stdout
+    def SYS_READ_FILE       0xf3    ; read file named at r0 to r1, at most r2 bytes;
+                                    ; r0 = bytes read, or 0xffff
+    def SYS_INSTRUCTIONS    0xf4    ; r0:r1:r2:r3 = instructions executed
+    def SYS_CYCLES          0xf5    ; r0:r1:r2:r3 = cycles executed
+    def SYS_BENCH_START     0xf6    ; start a benchmark region named by the label at r0
+    def SYS_BENCH_STOP      0xf7    ; stop the innermost benchmark region
+    def SYS_READ_INPUT      0xf8    ; read at most r1 bytes of the --input file to r0,
+                                    ; continuing from the last read;
+                                    ; r0 = bytes read, 0 at its end, or 0xffff
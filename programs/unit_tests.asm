@@ -280,6 +280,19 @@
     ; skip to here if all tests passed
     .bl_passed
 
+    ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    ; VERIFY READS OF PC
+
+    ; r15 reads as the address of the next instruction, also
+    ; straight after a mov #
+    mov r1, #hi(.pc_read)
+    add r1, #lo(.pc_read)
+    mov r0, #1
+    cmp r1, r15
+    .pc_read
+    prne
+    bl .fail
+
     ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
     ; VERIFY LOAD / STORE
 
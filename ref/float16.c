@@ -2,6 +2,9 @@
 #include <math.h>
 #include <string.h>
 
+#include "float16.h"
+#include "float16_int.h"
+
 #define numof(a) (sizeof(a)/sizeof((a)[0]))
 
 typedef int bool;
@@ -108,404 +111,309 @@ order compare(f16 x, f16 y) {
     }
 }
 
-f16 f16_from_float(float f)
+void f16_print(f16 a)
 {
-    if (isnan(f)) {f16 r; r.bits = qnan; return r;}
-    if (isinf(f)) {f16 r; r.bits = f<0 ? neg_inf : pos_inf; return r; }
-    if (f==0.0f)  {f16 r; r.bits = signbit(f) ? neg_zero : pos_zero; return r; }
-
-    u32 packed = *(u32*)&f;
-    int exp = ((packed >> 23) & 0xff) - 127 + bias;
-    if (exp > emax) {f16 r; r.bits = f<0 ? neg_inf : pos_inf; return r; }
-
-    if (exp >= emin) {
-        f16 r;
-        r.sign = (packed >> 31);
-        r.exp = exp;
-        r.fra = (u16)((packed & 0x007fffff) >> (23-mbits)); // TODO rounding
-        return r;
-    }
-
-    // subnormal
-    unsigned fra = ((packed & 0x007fffff) | 0x00800000) >> (23-mbits);
-    while(exp < emin) {fra >>= 1; exp++; }
-    f16 r;
-    r.sign = (packed >> 31);
-    r.exp = 0;
-    r.fra = fra;
-    return r;
+    float f = f16_to_float(a.bits);
+    printf("%x:%x:%03x = %.9f", a.sign, a.exp, a.fra, f);
+//    printf("sign=%s exp=%d fra=%f\n", a.sign?"-":"+", ((int)a.exp)-bias, (a.fra | 1 << mbits) / ((1<<mbits)+0.0));
 }
 
-float f16_to_float(f16 a)
+// Library: conversions, arithmetic, and batch forms (see float16.h)
+
+float f16_to_float(uint16_t a)
 {
-    u32 packed = 0;
-    if (a.sign) packed |= 1u<<31;
+    u32 sign = (u32)(a & 0x8000) << 16;
+    u32 exp = (a >> 10) & 0x1f;
+    u32 fra = a & 0x3ff;
+    u32 packed;
 
-    if (a.exp==exp_nan_inf) {
+    if (exp == exp_nan_inf) {
         // infinity or nan
-        packed |= 0xffu << 23;
-        packed |= ((u32)a.fra) << 13;
+        packed = sign | 0x7f800000 | fra << 13;
     }
-    else if (a.exp==0) {
-        if (a.fra==0) {
-            // zero - nothing to do
+    else if (exp == exp_zero_sub) {
+        if (fra == 0) {
+            packed = sign;
         }
         else {
-            int exp = -15;
-            u32 fra = ((u32)a.fra) << 14;
-            while((fra & (1<<23)) == 0) {
+            // subnormal - normalise, leading bit to bit 10
+            exp = 127 - bias + 1;
+            while((fra & 0x400) == 0) {
                 fra <<= 1;
-                exp -= 1;
+                exp--;
             }
-            packed |= ((u32)(exp+127)) << 23;
-            packed |= fra & ((1<<23)-1);
+            packed = sign | exp << 23 | (fra & 0x3ff) << 13;
         }
     }
     else {
         // normal
-        packed |= (a.exp-bias+127) << 23;
-        packed |= ((u32)a.fra) << 13;
+        packed = sign | (exp - bias + 127) << 23 | fra << 13;
     }
 
-    return *(float*)&packed;
-}
-
-void f16_print(f16 a)
-{
-    float f = f16_to_float(a);
-    printf("%x:%x:%03x = %.9f", a.sign, a.exp, a.fra, f);
-//    printf("sign=%s exp=%d fra=%f\n", a.sign?"-":"+", ((int)a.exp)-bias, (a.fra | 1 << mbits) / ((1<<mbits)+0.0));
-}
-
-u16 mul16_hi(u16 a, u16 b) 
-{
-    return (u16)((u32)a*b >> 16);
+    float f;
+    memcpy(&f, &packed, sizeof(f));
+    return f;
 }
 
-u16 mul16_lo(u16 a, u16 b) 
+uint16_t f16_from_float(float f)
 {
-    return (u16)((u32)a*b);
-}
-
-f16 f16_mul(f16 a, f16 b)
-{
-    if (isNan(a)) return a;
-    if (isNan(b)) return b;
-
-    u16 r_sign = a.sign ^ b.sign;
-
-    if (isZero(a)) {
-        if (isInfinite(b)) a.bits = qnan;
-        return a;
-    }
-    if (isZero(b)) {
-        if (isInfinite(a)) b.bits = qnan;
-        return b;
+    u32 packed;
+    memcpy(&packed, &f, sizeof(packed));
+    u16 sign = (packed >> 16) & 0x8000;
+    u32 mag = packed & 0x7fffffff;
+
+    if (mag > 0x7f800000) return qnan;
+    if (mag >= 0x477ff000) return sign | pos_inf;   // 65520 and up round to inf
+    if (mag < 0x33000000) return sign | pos_zero;   // below 2^-25 rounds to 0
+
+    u32 z, rest, half;
+    if (mag < 0x38800000) {
+        // subnormal: units of 2^-24, from a significand with 2^-149 units
+        int shift = 126 - (int)(mag >> 23);         // 14..24
+        u32 fra = (mag & 0x007fffff) | 0x00800000;
+        z = fra >> shift;
+        rest = fra & ((1u << shift) - 1);
+        half = 1u << (shift - 1);
     }
+    else {
+        // normal: rebias, and drop 13 bits of fraction; a carry out of the
+        // fraction correctly increments the exponent
+        z = (mag >> 13) - ((127 - bias) << 10);
+        rest = mag & 0x1fff;
+        half = 0x1000;
+    }
+    if (rest > half || (rest == half && (z & 1))) z++;
+    return sign | z;
+}
 
-    if (isInfinite(a)) { a.sign = r_sign; return a; }
-    if (isInfinite(b)) { b.sign = r_sign; return b; }
+uint16_t f16_mul(uint16_t a, uint16_t b) { return f16i_mul(a, b); }
+uint16_t f16_div(uint16_t a, uint16_t b) { return f16i_div(a, b); }
+uint16_t f16_add(uint16_t a, uint16_t b) { return f16i_add(a, b); }
+uint16_t f16_sub(uint16_t a, uint16_t b) { return f16i_sub(a, b); }
+uint16_t f16_fma(uint16_t a, uint16_t b, uint16_t c) { return f16i_fma(a, b, c); }
+uint16_t f16_sqrt(uint16_t a)            { return f16_from_float(sqrtf(f16_to_float(a))); }
+int f16_compare(uint16_t a, uint16_t b)  { return f16i_compare(a, b); }
 
-    int r_exp = a.exp + b.exp - bias;
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
 
-    // bits[12:3]=fra[9:0]
-    // 000f:ffff:ffff:f000
-    u16 a_fra = a.fra << 3;
-    u16 b_fra = b.fra << 3;
+#define F16_AVX2 __attribute__((target("avx2,f16c")))
 
-    if (isSubnormal(a)) {
-        r_exp += 1;
-        // Shift subnormal up until leading bit at implicit unit position (13)
-        // e.g.    0000:001f:ffff:f000
-        // becomes 001f:ffff:f000:0000
-        do { a_fra <<= 1; r_exp -= 1; } while((a_fra & (1<<13)) == 0);
-    }
-    else {
-        // Normal number - make implicit unit bit explicit
-        // e.g.    000f:ffff:ffff:f000
-        // becomes 001f:ffff:ffff:f000
-        a_fra |= (u16)1 << (mbits+3);
-    }
-
-    if (isSubnormal(b)) {
-        r_exp += 1;
-        do { b_fra <<= 1; r_exp -= 1; } while((b_fra & (1<<13)) == 0);
-    }
-    else {
-        // set implicit unit bit
-        b_fra |= (u16)1 << (mbits+3);
-    }
-
-    // prod_hi:prod_lo - PP.p{20} P=leading integer, p=trailing fraction
-    // 0000:PPpp:pppp:pppp : pppp:pppp:pp00:0000
-    u16 prod_hi = mul16_hi(a_fra, b_fra);
-    u16 prod_lo = mul16_lo(a_fra, b_fra);
-    // is PP > 1 ?
-    if (prod_hi & (1<<(27-16))) {
-        // divide by 2 so we have only 1 unit bit again
-        // e.g.    0000:1Ppp:pppp:pppp : pppp:pppp:pp00:0000
-        // becomes 0000:01Pp:pppp:pppp : pppp:pppp:ppp0:0000
-        prod_lo = (prod_lo>>1) | (prod_hi<<15);
-        prod_hi >>= 1;
-        r_exp += 1;
-    }
-    // Round to nearest - do we have >= 0.5 ulp?
-    if (prod_lo & (1<<15)) {
-        // so round up
-        prod_hi += 1;
-        // shift again in case we overflow
-        if (prod_hi & (1<<(27-16))) {
-            prod_hi >>= 1;
-            r_exp += 1;
-        }
+static bool have_avx2()
+{
+    static int have = -1;
+    if (have < 0) {
+        __builtin_cpu_init();
+        have = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
     }
+    return have;
+}
 
-    if (r_exp > emax) {
-        f16 r;
-        r.bits = r.sign ? neg_inf : pos_inf;
-        return r;
-    }
-    else if (r_exp > 0) {
-        // result frac will be in bits [26:0] of prod_hi:prod_lo,
-        // i.e. [10:0] of prod_hi - so mask out unit bit at [10]
-        f16 r;
-        r.sign = r_sign;
-        r.exp = r_exp;
-        r.fra = prod_hi & 0x3ff;
-        return r;
-    }
-
-    // Result is a subnormal...
-    //
-    // NOTE value of a subnormal is 2**-14 * 0.ffffffffff
-    //
-    // If we have r_exp==0, the value of the product
-    // is 2**-15 * 1.ppp... = 2**-14 * 0.1ppp...
-    // Therefore at least 1 shift is always required.
-    //
-    // If r_exp==-1, value is 2**-16 * 1.ppp... = 2**-14 * 0.01ppp...
-    // i.e. two shifts needed.
-    //
-    // Etc.
-
-    // shift right until subnormal has required valued
-    do {
-        prod_lo = (prod_hi<<15) | (prod_lo>>1);
-        prod_hi >>= 1;
-        r_exp += 1;
-    } while(r_exp <= 0);
-
-    // round up on 0.5ulp
-    if (prod_lo & (1<<15)) {
-        prod_hi += 1;
-        // if we overflow into leading unit position, we've now
-        // got the smallest representable normal, so return that
-        if (prod_hi & (1<<(26-16))) {
-            f16 r; r.bits = r.sign ? neg_min_norm : pos_min_norm;
-            return r;
-        }
-    }
+// Round 16 singles to half, replacing any NaN with qnan.
+static inline F16_AVX2 __m256i pack16(__m256 lo, __m256 hi)
+{
+    __m256i z = _mm256_set_m128i(
+            _mm256_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+            _mm256_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    __m256i mag = _mm256_and_si256(z, _mm256_set1_epi16(0x7fff));
+    __m256i nan = _mm256_cmpgt_epi16(mag, _mm256_set1_epi16(pos_inf));
+    return _mm256_blendv_epi8(z, _mm256_set1_epi16(qnan), nan);
+}
 
-    f16 r;
-    r.sign = r_sign;
-    r.exp = 0;
-    r.fra = prod_hi & 0x03ff;
-    return r;
+// Convert a and b 16 at a time, compute OP on each half, and round back.
+#define BINARY_AVX2(name, OP) \
+static F16_AVX2 size_t name(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n) \
+{ \
+    size_t i; \
+    for(i=0; i+16 <= n; i+=16) { \
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a+i)); \
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b+i)); \
+        __m256 a_lo = _mm256_cvtph_ps(_mm256_castsi256_si128(va)); \
+        __m256 a_hi = _mm256_cvtph_ps(_mm256_extracti128_si256(va, 1)); \
+        __m256 b_lo = _mm256_cvtph_ps(_mm256_castsi256_si128(vb)); \
+        __m256 b_hi = _mm256_cvtph_ps(_mm256_extracti128_si256(vb, 1)); \
+        _mm256_storeu_si256((__m256i *)(z+i), pack16(OP(a_lo, b_lo), OP(a_hi, b_hi))); \
+    } \
+    return i; \
 }
 
-// recip_6i_8o[i] = 0x3fff / (0x40+i)
-u8 recip_6i_8o[] = {
-    0xFF, 0xFC, 0xF8, 0xF4,
-    0xF0, 0xED, 0xEA, 0xE6,
-    0xE3, 0xE0, 0xDD, 0xDA,
-    0xD7, 0xD4, 0xD2, 0xCF,
-    0xCC, 0xCA, 0xC7, 0xC5,
-    0xC3, 0xC0, 0xBE, 0xBC,
-    0xBA, 0xB8, 0xB6, 0xB4,
-    0xB2, 0xB0, 0xAE, 0xAC,
-    0xAA, 0xA8, 0xA7, 0xA5,
-    0xA3, 0xA2, 0xA0, 0x9F,
-    0x9D, 0x9C, 0x9A, 0x99,
-    0x97, 0x96, 0x94, 0x93,
-    0x92, 0x90, 0x8F, 0x8E,
-    0x8D, 0x8C, 0x8A, 0x89,
-    0x88, 0x87, 0x86, 0x85,
-    0x84, 0x83, 0x82, 0x81,
-};
+BINARY_AVX2(mul_avx2, _mm256_mul_ps)
+BINARY_AVX2(div_avx2, _mm256_div_ps)
+BINARY_AVX2(add_avx2, _mm256_add_ps)
+BINARY_AVX2(sub_avx2, _mm256_sub_ps)
 
-f16 f16_div(f16 a, f16 b)
+static F16_AVX2 size_t sqrt_avx2(const uint16_t *a, uint16_t *z, size_t n)
 {
-    if (isNan(a)) return a;
-    if (isNan(b)) return b;
-
-    bool q_sign = a.sign ^ b.sign;
-
-    if (isZero(a))     {f16 q; q.bits = isZero(b)     ? qnan : q_sign ? neg_zero : pos_zero; return q; }
-    if (isInfinite(a)) {f16 q; q.bits = isInfinite(b) ? qnan : q_sign ? neg_inf  : pos_inf;  return q; }
-    if (isZero(b))     {f16 q; q.bits =                        q_sign ? neg_inf  : pos_inf;  return q; }
-    if (isInfinite(b)) {f16 q; q.bits =                        q_sign ? neg_zero : pos_zero; return q; }
+    size_t i;
+    for(i=0; i+16 <= n; i+=16) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a+i));
+        __m256 a_lo = _mm256_cvtph_ps(_mm256_castsi256_si128(va));
+        __m256 a_hi = _mm256_cvtph_ps(_mm256_extracti128_si256(va, 1));
+        _mm256_storeu_si256((__m256i *)(z+i), pack16(_mm256_sqrt_ps(a_lo), _mm256_sqrt_ps(a_hi)));
+    }
+    return i;
+}
 
-    int q_exp = bias + a.exp - b.exp-1;
+#define VECTOR(call) (have_avx2() ? call : 0)
+#else
+#define VECTOR(call) 0
+#endif
 
-    u16 a_fra = a.fra << 5;
-    u16 b_fra = b.fra << 5;
+void f16_mul_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n)
+{
+    for(size_t i = VECTOR(mul_avx2(a, b, z, n)); i<n; i++) z[i] = f16_mul(a[i], b[i]);
+}
 
-    // shift and set implicit top bit
-    if (isSubnormal(a)) {
-        q_exp -= 1;
-        while((a_fra & (1<<15)) == 0) { q_exp -= 1; a_fra <<= 1; }
-    } else {
-        a_fra |= 1<<15;
-    }
+void f16_div_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n)
+{
+    for(size_t i = VECTOR(div_avx2(a, b, z, n)); i<n; i++) z[i] = f16_div(a[i], b[i]);
+}
 
-    // shift and set implicit top bit
-    if (isSubnormal(b)) {
-        q_exp += 1;
-        while((b_fra & (1<<15)) == 0) { q_exp += 1; b_fra <<= 1; }
-    } else {
-        b_fra |= 1<<15;
-    }
+void f16_add_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n)
+{
+    for(size_t i = VECTOR(add_avx2(a, b, z, n)); i<n; i++) z[i] = f16_add(a[i], b[i]);
+}
 
-    // get 6 leading bits
-    u16 index = b.fra >> 4;
+void f16_sub_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n)
+{
+    for(size_t i = VECTOR(sub_avx2(a, b, z, n)); i<n; i++) z[i] = f16_sub(a[i], b[i]);
+}
 
-    // rough inverse
-    // inv0 = 0x3fff / (0x40 + index)
-    u16 inv0 = (u16)recip_6i_8o[index] << 8;
+void f16_sqrt_n(const uint16_t *a, uint16_t *z, size_t n)
+{
+    for(size_t i = VECTOR(sqrt_avx2(a, z, n)); i<n; i++) z[i] = f16_sqrt(a[i]);
+}
 
-    // Newton-Raphson gets 12 bits accuracy
-    u16 p0 = mul16_hi(inv0, b_fra);
-    p0 = 0u-p0;
-    u16 inv1 = mul16_hi(p0, inv0);
-//  inv1 <<= 1;
+// The reductions, as .f16_dot and .f16_sum (programs/f16/vector.asm) compute
+// them, step for step: each exact term is added to an accumulator, aligned
+// by shifting the smaller right with any bits lost or-ed into its lowest
+// bit, and the sum renormalised to 30 bits. Only the final sum is rounded.
 
-    // final quotient
-    u32 q_fra = mul16_hi(a_fra, inv1);
-    q_fra <<= 1;
-    if (q_fra & 0x8000) {
-        q_fra >>= 1;
-        q_exp += 1;
-    }
-    q_fra += 0x0008;
-    q_fra >>= 4;
+enum { ACC_NAN = 1, ACC_POS_INF = 2, ACC_NEG_INF = 4, ACC_ZERO_EXP = -0x4000 };
 
-    // TODO - adjust quotient (use last 4 bits for rounding?)
-    // TODO - subnormals, inf, nan, zero
-//  printf("q_fra=%08x\n", q_fra);
+typedef struct
+{
+    u32 m;          // with its leading 1 at bit 29, or 0
+    int e;          // the value being m * 2^(e-44); ACC_ZERO_EXP if m is 0
+    u16 sign;
+    int specials;   // ACC_NAN, ACC_POS_INF and ACC_NEG_INF seen
+} accumulator;
 
-    f16 q;
-    q.sign = q_sign;
-    q.exp = q_exp;
-    q.fra = q_fra & 0x3ff;
-    return q;
+static u32 shift_right_jam(u32 m, int d)
+{
+    return d == 0 ? m : d < 32 ? (m >> d) | ((m << (32 - d)) != 0) : (m != 0);
 }
 
-f16 f16_add(f16 a, f16 b)
+// Adds m * 2^(e-44), m having its leading 1 at bit 28 or 29.
+static void acc_add(accumulator *acc, u32 m, int e, u16 sign)
 {
-    // TODO - apply correct rules for sum and difference of Zeros
-
-    if (isNan(a)) return a;
-    if (isNan(b)) return b;
-
-    bool subtract = (a.sign != b.sign);
-    if (subtract) {
-        if (isZero(b)) { return a; }
-        if (isZero(a)) { b.sign ^= 1; return b; }
-        if (isInfinite(a)) {
-            if (isInfinite(b)) a.bits = qnan;
-            return a;
+    int d = e - acc->e;
+    if (d >= 0) {
+        acc->m = shift_right_jam(acc->m, d);
+        acc->e = e;
+        if (sign == acc->sign) {
+            acc->m += m;
+        }
+        else if (m >= acc->m) {
+            acc->m = m - acc->m;
+            acc->sign = sign;
+        }
+        else {
+            acc->m -= m;
         }
-        if (isInfinite(b)) { b.sign ^= 1; return b; }
     }
     else {
-        if (isInfinite(a)) return a;
-        if (isInfinite(b)) return b;
-        if (isZero(a)) return b;
-        if (isZero(b)) return a;
+        m = shift_right_jam(m, -d);
+        acc->m = sign == acc->sign ? acc->m + m : acc->m - m;
     }
 
-    if (a.exp < b.exp) {
-        f16 t = a;
-        a = b;
-        b = t;
+    if (acc->m == 0) {                      // exact cancellation
+        acc->e = ACC_ZERO_EXP;
+        acc->sign = 0;
+        return;
     }
-
-    u16 a_fra = a.fra;
-    u16 b_fra = b.fra;
-    int a_exp = a.exp;
-    int b_exp = b.exp;
-
-    if (a_exp > 0) {
-        a_fra |= 1<<10;
+    int s = f16i_clz32(acc->m) - 2;
+    if (s < 0) {
+        acc->m = (acc->m >> 1) | (acc->m & 1);
+        acc->e += 1;
     }
     else {
-        a_exp += 1;
-        do { a_fra <<= 1; a_exp -= 1; } while((a_fra & (1<<10)) == 0);
+        acc->m <<= s;
+        acc->e -= s;
     }
+}
 
-    if (b_exp > 0) {
-        b_fra |= 1<<10;
-    }
-    else {
-        b_exp += 1;
-        do { b_fra <<= 1; b_exp -= 1; } while((b_fra & (1<<10)) == 0);
-    }
-
-    int dexp = a_exp - b_exp;
-    a_fra <<= 4;
-    b_fra <<= 4;
-    b_fra >>= dexp;
-
-    int r_exp = a_exp;
-    u16 r_sign = a.sign;
-    u16 r_fra;
-
-    if (subtract) {
-        if (dexp == 0) {
-            if (a_fra < b_fra) {
-                u16 t = a_fra;
-                a_fra = b_fra;
-                b_fra = t;
-                r_sign = ~r_sign;
-            }
+// Adds a zero term, which can only change the sign of a zero sum.
+static void acc_add_zero(accumulator *acc, u16 sign)
+{
+    if (acc->m == 0) acc->sign &= sign;
+}
+
+static uint16_t acc_round(const accumulator *acc)
+{
+    int infs = acc->specials & (ACC_POS_INF | ACC_NEG_INF);
+    if ((acc->specials & ACC_NAN) || infs == (ACC_POS_INF | ACC_NEG_INF)) return F16_QNAN;
+    if (infs) return (infs == ACC_NEG_INF ? 0x8000 : 0) | pos_inf;
+    if (acc->m == 0) return acc->sign;
+    return f16i_round_pack(acc->sign, acc->e, acc->m << 2);
+}
+
+uint16_t f16_dot(const uint16_t *x, const uint16_t *y, size_t n)
+{
+    if (n == 0) return 0;
+    accumulator acc = {0, ACC_ZERO_EXP, 0x8000, 0};
+    for(size_t i=0; i<n; i++) {
+        uint16_t a = x[i], b = y[i];
+        uint16_t sign = (a ^ b) & 0x8000;
+        uint16_t a_abs = a & 0x7fff, b_abs = b & 0x7fff;
+        if (a_abs > pos_inf || b_abs > pos_inf) {
+            acc.specials |= ACC_NAN;
         }
-        printf("a_fra=%x b_fra=%x\n", a_fra, b_fra);
-        r_fra = a_fra - b_fra;
-        if (r_fra == 0) {f16 r; r.bits = pos_zero; return r; } // TODO - handle zeroes correctly
-        while((r_fra & (1<<14)) == 0) {
-            r_fra <<= 1;
-            r_exp -= 1;
+        else if (a_abs == pos_inf || b_abs == pos_inf) {
+            acc.specials |= (a_abs == 0 || b_abs == 0) ? ACC_NAN
+                          : sign ? ACC_NEG_INF : ACC_POS_INF;
+        }
+        else if (a_abs == 0 || b_abs == 0) {
+            acc_add_zero(&acc, sign);
+        }
+        else {
+            int ea, eb;
+            u32 ma = f16i_unpack(a, &ea) >> 21;
+            u32 mb = f16i_unpack(b, &eb) >> 21;
+            acc_add(&acc, (ma << 4) * (mb << 4), ea + eb - 14, sign);
         }
     }
-    else {
-        r_sign = a.sign;
-        r_fra = a_fra + b_fra;
-    }
-
-    // convert to subnormal if necessary
-    if (r_exp <= 0) {
-        r_fra >>= 1-r_exp;
-        r_exp = 0;
-    }
-
-    // TODO - rounding
+    return acc_round(&acc);
+}
 
-    // adjust
-    if (r_fra & 1<<15) {
-        r_fra >>= 1;
-        r_exp += 1;
+uint16_t f16_sum(const uint16_t *x, size_t n)
+{
+    if (n == 0) return 0;
+    accumulator acc = {0, ACC_ZERO_EXP, 0x8000, 0};
+    for(size_t i=0; i<n; i++) {
+        uint16_t a = x[i];
+        uint16_t sign = a & 0x8000;
+        uint16_t a_abs = a & 0x7fff;
+        if (a_abs > pos_inf) {
+            acc.specials |= ACC_NAN;
+        }
+        else if (a_abs == pos_inf) {
+            acc.specials |= sign ? ACC_NEG_INF : ACC_POS_INF;
+        }
+        else if (a_abs == 0) {
+            acc_add_zero(&acc, sign);
+        }
+        else {
+            int e;
+            u32 m = f16i_unpack(a, &e) >> 21;
+            acc_add(&acc, m << 19, e, sign);
+        }
     }
-    r_fra ^= 1<<14;
-    r_fra >>= 4;
-
-    f16 r;
-    if (r_exp > emax) {r.bits = r_sign ? neg_inf : pos_inf; return r;}
-    r.sign = r_sign;
-    r.exp = (u16)r_exp;
-    r.fra = r_fra;
-    return r;
+    return acc_round(&acc);
 }
 
+// Model of the vixen f16 library's formatting and parsing
+
 void test_compare()
 {
     struct s_test { f16 x; f16 y; order expect_xy, expect_yx; };
@@ -581,7 +489,7 @@ void print_consts()
         struct s_test *t = &tests[i];
         f16 x;
         x.bits = t->bits;
-        float value = f16_to_float(x);
+        float value = f16_to_float(x.bits);
 
         printf("%-10s value=%20.12f bits=%04x f16=", t->label, (double)value, x.bits); f16_print(x); printf("\n");
     }
@@ -927,6 +835,8 @@ f16 f16_from_ascii(char *buf)
     return r;
 }
 
+#ifdef FLOAT16_MAIN
+// A table of f16_to_ascii() results: build with -DFLOAT16_MAIN
 int main() {
     char buf[100];
     for(u16 i = 0x0000; i <= 0x07600; i++) {
@@ -937,6 +847,4 @@ int main() {
         printf("\n");
     }
 }
-
-
-
+#endif
@@ -0,0 +1,65 @@
+#ifndef FLOAT16_H
+#define FLOAT16_H
+
+// Reference IEEE 754 binary16 arithmetic, as implemented by the vixen f16
+// library (programs/f16), on raw bit patterns.
+//
+// Every result is correctly rounded - to nearest, ties to even - with
+// subnormals, and overflow to infinity. Any NaN result is the canonical
+// quiet NaN F16_QNAN, whatever the operands were.
+//
+// The scalar + - * /, fma and compare are integer kernels (float16_int.h),
+// shared with the lang VM. sqrt, and the vector forms below, are computed in
+// single precision and rounded once to half: single has 24 bits of
+// precision, at least 2*11+2, so that double rounding gives the same result
+// as rounding the exact one.
+//
+// The _n forms apply an operation to n operand pairs (a[i], b[i]) writing
+// z[i]. On x86 cpus with AVX2 and F16C they work on 16 pairs at a time,
+// converting with vcvtph2ps/vcvtps2ph; elsewhere, and for any remainder,
+// they use the scalar forms. Both give identical results.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define F16_QNAN 0x7e00
+
+// Exact.
+float f16_to_float(uint16_t a);
+
+// Rounded to nearest even; NaN gives F16_QNAN.
+uint16_t f16_from_float(float f);
+
+uint16_t f16_mul(uint16_t a, uint16_t b);
+uint16_t f16_div(uint16_t a, uint16_t b);
+uint16_t f16_add(uint16_t a, uint16_t b);
+uint16_t f16_sub(uint16_t a, uint16_t b);
+uint16_t f16_sqrt(uint16_t a);
+
+// a * b + c, rounded once.
+uint16_t f16_fma(uint16_t a, uint16_t b, uint16_t c);
+
+// As .f16_cmp: -1 if a < b, 0 if a == b, 1 if a > b, or 2 if unordered.
+int f16_compare(uint16_t a, uint16_t b);
+
+void f16_mul_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n);
+void f16_div_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n);
+void f16_add_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n);
+void f16_sub_n(const uint16_t *a, const uint16_t *b, uint16_t *z, size_t n);
+void f16_sqrt_n(const uint16_t *a, uint16_t *z, size_t n);
+
+// x[0]*y[0] + ... + x[n-1]*y[n-1], and x[0] + ... + x[n-1], as .f16_dot and
+// .f16_sum compute them: the exact terms are summed with 30 significant
+// bits, and a sticky bit, and rounded once. +0 if n is 0.
+uint16_t f16_dot(const uint16_t *x, const uint16_t *y, size_t n);
+uint16_t f16_sum(const uint16_t *x, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
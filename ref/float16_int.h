@@ -0,0 +1,198 @@
+#ifndef FLOAT16_INT_H
+#define FLOAT16_INT_H
+
+// IEEE 754 binary16 arithmetic in integers only, on raw bit patterns: the
+// kernels behind ref/float16.c's scalar operations, and the lang VM's
+// float operators (lang/vm.c), which include this directly.
+//
+// Results are those of the vixen f16 library (programs/f16): correctly
+// rounded - to nearest, ties to even - with subnormals, overflow to
+// infinity, an exact zero sum being +0, and any NaN result 0x7e00.
+//
+// Internally a finite nonzero value is unpacked to an exponent e and a
+// significand m with its leading 1 at bit 31, meaning m * 2^(e-15-31), so
+// a normal's e is its biased exponent. Bits of m below the 11 kept, with
+// any inexact remainder or-ed into bit 0, decide the rounding.
+
+#include <stdint.h>
+
+#define F16I_QNAN 0x7e00
+
+static inline int f16i_clz32(uint32_t x)
+{
+    return __builtin_clz(x);
+}
+
+static inline int f16i_is_nan(uint16_t a)
+{
+    return (a & 0x7fff) > 0x7c00;
+}
+
+// a's significand (a != 0, finite), with *e set as above.
+static inline uint32_t f16i_unpack(uint16_t a, int *e)
+{
+    uint32_t fra = a & 0x3ff;
+    int exp = (a >> 10) & 0x1f;
+    if (exp == 0) {
+        int s = f16i_clz32(fra);
+        *e = 22 - s;
+        return fra << s;
+    }
+    *e = exp;
+    return (fra | 0x400) << 21;
+}
+
+// Rounds m * 2^(e-15-31), m having its leading 1 at bit 31, to f16.
+static inline uint16_t f16i_round_pack(uint16_t sign, int e, uint32_t m)
+{
+    if (e >= 31) return sign | 0x7c00;
+    if (e < 1) {
+        int shift = 1 - e;
+        m = shift < 32 ? (m >> shift) | ((m << (31 - shift) << 1) != 0) : (m != 0);
+        e = 1;
+    }
+    uint32_t sig = m >> 21;                 // with the leading 1, if normal
+    uint32_t rem = m & 0x1fffff;
+    sig += rem > 0x100000 || (rem == 0x100000 && (sig & 1));
+    // the leading 1, and any carry out of the rounding, add to the exponent
+    uint32_t bits = ((uint32_t)(e - 1) << 10) + sig;
+    return sign | (bits >= 0x7c00 ? 0x7c00 : bits);
+}
+
+static inline uint16_t f16i_mul(uint16_t a, uint16_t b)
+{
+    uint16_t sign = (a ^ b) & 0x8000;
+    uint16_t a_abs = a & 0x7fff;
+    uint16_t b_abs = b & 0x7fff;
+    if (a_abs > 0x7c00 || b_abs > 0x7c00) return F16I_QNAN;
+    if (a_abs == 0x7c00 || b_abs == 0x7c00) {
+        return (a_abs == 0 || b_abs == 0) ? F16I_QNAN : sign | 0x7c00;
+    }
+    if (a_abs == 0 || b_abs == 0) return sign;
+
+    int ea, eb;
+    uint32_t p = (f16i_unpack(a, &ea) >> 21) * (f16i_unpack(b, &eb) >> 21);
+    int s = f16i_clz32(p);                  // exact: 22 bits at most
+    return f16i_round_pack(sign, ea + eb - 4 - s, p << s);
+}
+
+static inline uint16_t f16i_div(uint16_t a, uint16_t b)
+{
+    uint16_t sign = (a ^ b) & 0x8000;
+    uint16_t a_abs = a & 0x7fff;
+    uint16_t b_abs = b & 0x7fff;
+    if (a_abs > 0x7c00 || b_abs > 0x7c00) return F16I_QNAN;
+    if (a_abs == 0x7c00) return b_abs == 0x7c00 ? F16I_QNAN : sign | 0x7c00;
+    if (b_abs == 0x7c00) return sign;
+    if (b_abs == 0) return a_abs == 0 ? F16I_QNAN : sign | 0x7c00;
+    if (a_abs == 0) return sign;
+
+    int ea, eb;
+    uint32_t num = (f16i_unpack(a, &ea) >> 21) << 20;
+    uint32_t den = f16i_unpack(b, &eb) >> 21;
+    uint32_t q = num / den;                 // 20 or 21 bits
+    int s = f16i_clz32(q);
+    return f16i_round_pack(sign, ea - eb + 26 - s, (q << s) | (num % den != 0));
+}
+
+static inline uint16_t f16i_add(uint16_t a, uint16_t b)
+{
+    uint16_t a_abs = a & 0x7fff;
+    uint16_t b_abs = b & 0x7fff;
+    if (a_abs > 0x7c00 || b_abs > 0x7c00) return F16I_QNAN;
+    if (a_abs == 0x7c00) return (b_abs == 0x7c00 && a != b) ? F16I_QNAN : a;
+    if (b_abs == 0x7c00) return b;
+    if (b_abs == 0) return a_abs == 0 ? a & b : a;
+    if (a_abs == 0) return b;
+
+    if (a_abs < b_abs) {                    // so |a| >= |b|
+        uint16_t t = a; a = b; b = t;
+    }
+    int ea, eb;
+    // the leading 1 at bit 28, leaving room for a carry, and 18 bits for
+    // rounding
+    uint32_t ma = f16i_unpack(a, &ea) >> 3;
+    uint32_t mb = f16i_unpack(b, &eb) >> 3;
+    int d = ea - eb;
+    mb = d < 32 ? (mb >> d) | ((mb << (31 - d) << 1) != 0) : (mb != 0);
+
+    uint32_t m = ((a ^ b) & 0x8000) ? ma - mb : ma + mb;
+    if (m == 0) return 0;
+    int s = f16i_clz32(m);
+    return f16i_round_pack(a & 0x8000, ea + 3 - s, m << s);
+}
+
+static inline uint16_t f16i_sub(uint16_t a, uint16_t b)
+{
+    return f16i_add(a, f16i_is_nan(b) ? b : b ^ 0x8000);
+}
+
+// a * b + c, rounded once. The exact product, of 22 bits at most, and c are
+// summed in 64 bits: where either is shifted right far enough to lose bits
+// (jammed into bit 0), it is too small to make those bits matter.
+static inline uint16_t f16i_fma(uint16_t a, uint16_t b, uint16_t c)
+{
+    uint16_t sign = (a ^ b) & 0x8000;
+    uint16_t a_abs = a & 0x7fff;
+    uint16_t b_abs = b & 0x7fff;
+    uint16_t c_abs = c & 0x7fff;
+    if (a_abs > 0x7c00 || b_abs > 0x7c00 || c_abs > 0x7c00) return F16I_QNAN;
+    if (a_abs == 0x7c00 || b_abs == 0x7c00) {
+        if (a_abs == 0 || b_abs == 0) return F16I_QNAN;
+        return (c_abs == 0x7c00 && (c & 0x8000) != sign) ? F16I_QNAN : sign | 0x7c00;
+    }
+    if (c_abs == 0x7c00) return c;
+    if (a_abs == 0 || b_abs == 0) return c_abs == 0 ? sign & c : c;
+    if (c_abs == 0) return f16i_mul(a, b);
+
+    // each term as x * 2^(e-15-62), with its leading 1 at bit 60 to 62
+    int ea, eb, ec;
+    uint64_t p = (f16i_unpack(a, &ea) >> 21) * (f16i_unpack(b, &eb) >> 21);
+    uint64_t xp = p << 40;
+    uint64_t xc = (uint64_t) f16i_unpack(c, &ec) << 31;
+    int e = ea + eb - 12;
+    ec += 1;
+
+    int d = e - ec;
+    if (d >= 0) {
+        xc = d < 64 ? (xc >> d) | ((xc << (63 - d) << 1) != 0) : 1;
+    }
+    else {
+        d = -d;
+        xp = d < 64 ? (xp >> d) | ((xp << (63 - d) << 1) != 0) : 1;
+        e = ec;
+    }
+
+    uint64_t x;
+    uint16_t z_sign = sign;
+    if (sign == (c & 0x8000)) {
+        x = xp + xc;
+    }
+    else if (xp >= xc) {
+        x = xp - xc;
+    }
+    else {
+        x = xc - xp;
+        z_sign = c & 0x8000;
+    }
+    if (x == 0) return 0;
+
+    int s = __builtin_clzll(x);
+    x <<= s;
+    uint32_t m = (uint32_t)(x >> 32) | ((uint32_t) x != 0);
+    return f16i_round_pack(z_sign, e - s, m);
+}
+
+// As .f16_cmp: -1 if a < b, 0 if a == b, 1 if a > b, or 2 if unordered
+// (either is NaN). The zeros are equal.
+static inline int f16i_compare(uint16_t a, uint16_t b)
+{
+    if (f16i_is_nan(a) || f16i_is_nan(b)) return 2;
+    if (((a | b) & 0x7fff) == 0) return 0;
+    // as signed magnitudes, ordered as integers
+    int x = (a & 0x8000) ? -(int)(a & 0x7fff) : a;
+    int y = (b & 0x8000) ? -(int)(b & 0x7fff) : b;
+    return (x > y) - (x < y);
+}
+
+#endif
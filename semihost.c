@@ -0,0 +1,130 @@
+#include <stdio.h>
+
+#include "semihost.h"
+
+enum {
+    NAME_MAX_LEN = 256
+};
+
+static FILE *input = 0;
+
+static void (*output)(void *ctx, const char *buf, int len) = 0;
+static void *output_ctx = 0;
+
+static void put(const char *buf, int len)
+{
+    if (output) {
+        output(output_ctx, buf, len);
+    } else {
+        fwrite(buf, 1, len, stdout);
+    }
+}
+
+static void put64(cpu *c, u64 value)
+{
+    c->r[0] = value >> 48;
+    c->r[1] = value >> 32;
+    c->r[2] = value >> 16;
+    c->r[3] = value;
+}
+
+static u16 read_file(cpu *c, u16 name_addr, u16 addr, u16 max)
+{
+    char name[NAME_MAX_LEN];
+    int len = 0;
+    for(;;) {
+        u8 ch = mem_rd(c, name_addr + len, 0);
+        if (ch == 0) break;
+        if (len == NAME_MAX_LEN-1) return 0xffff;
+        name[len++] = ch;
+    }
+    name[len] = 0;
+
+    FILE *fp = fopen(name, "rb");
+    if (fp == 0) return 0xffff;
+    u16 n = 0;
+    int ch;
+    while(n < max && (ch = fgetc(fp)) != EOF) {
+        mem_wr(c, addr + n, 0, ch);
+        n++;
+    }
+    fclose(fp);
+    return n;
+}
+
+static u16 read_input(cpu *c, u16 addr, u16 max)
+{
+    if (input == 0) return 0xffff;
+    u8 buf[0x10000];
+    size_t n = fread(buf, 1, max, input);
+    for(size_t i=0; i<n; i++) {
+        mem_wr(c, addr + i, 0, buf[i]);
+    }
+    return n;
+}
+
+int semihost_input(const char *name)
+{
+    FILE *fp = fopen(name, "rb");
+    if (fp == 0) return -1;
+    if (input) fclose(input);
+    input = fp;
+    return 0;
+}
+
+void semihost_output(void (*write)(void *ctx, const char *buf, int len), void *ctx)
+{
+    output = write;
+    output_ctx = ctx;
+}
+
+int semihost(cpu *c, bench *b, int *status)
+{
+    u16 op = mem_rd(c, c->r[15] - 2, 1);
+    if ((op & 0xf00f) != 0x200f) return SEMIHOST_NONE;
+
+    switch((op >> 4) & 0xff) {
+        case SYS_EXIT:
+            *status = c->r[0];
+            return SEMIHOST_EXIT;
+        case SYS_PUTC: {
+            char ch = c->r[0];
+            put(&ch, 1);
+            break;
+        }
+        case SYS_WRITE: {
+            char buf[256];
+            int n = 0;
+            for(u16 i=0; i<c->r[1]; i++) {
+                buf[n++] = mem_rd(c, c->r[0] + i, 0);
+                if (n == sizeof(buf)) {
+                    put(buf, n);
+                    n = 0;
+                }
+            }
+            put(buf, n);
+            break;
+        }
+        case SYS_READ_FILE:
+            c->r[0] = read_file(c, c->r[0], c->r[1], c->r[2]);
+            return SEMIHOST_CHANGED;
+        case SYS_INSTRUCTIONS:
+            put64(c, c->instructions);
+            return SEMIHOST_CHANGED;
+        case SYS_CYCLES:
+            put64(c, c->cycles);
+            return SEMIHOST_CHANGED;
+        case SYS_BENCH_START:
+            if (b) bench_start(b, c, c->r[0]);
+            break;
+        case SYS_BENCH_STOP:
+            if (b) bench_stop(b, c);
+            break;
+        case SYS_READ_INPUT:
+            c->r[0] = read_input(c, c->r[0], c->r[1]);
+            return SEMIHOST_CHANGED;
+        default:
+            return SEMIHOST_NONE;
+    }
+    return SEMIHOST_DONE;
+}
@@ -0,0 +1,82 @@
+#ifndef SEMIHOST_H
+#define SEMIHOST_H
+
+// Semihosting: calls on the host, made by vixen programs run in the
+// simulator. The top of the swi range, swi #0xf0 to swi #0xff, is reserved
+// for these; the simulator carries out the call and carries on from the
+// next instruction, rather than stopping. Arguments and results are in
+// registers, with 32 and 64 bit values split most significant word first
+// (r0:r1, or r0:r1:r2:r3), as elsewhere. Each call costs only the cycles
+// of the swi itself.
+//
+//      swi #0xf0   exit        exit the simulator with status r0
+//      swi #0xf1   putc        write the byte r0 to stdout
+//      swi #0xf2   write       write r1 bytes from address r0 to stdout
+//      swi #0xf3   read file   read the file named by the \0 terminated
+//                              string at r0 to address r1, at most r2
+//                              bytes; r0 = bytes read, or 0xffff
+//      swi #0xf4   instructions r0:r1:r2:r3 = instructions executed
+//      swi #0xf5   cycles      r0:r1:r2:r3 = cycles executed
+//      swi #0xf6   bench start start a benchmark region named after the
+//                              label at r0 (see bench.h)
+//      swi #0xf7   bench stop  stop the innermost region
+//      swi #0xf8   read input  read at most r1 bytes of the simulator's input
+//                              file (see semihost_input) to address r0,
+//                              carrying on from where the last read ended;
+//                              r0 = bytes read, 0 at its end, or 0xffff
+//                              with no input file
+//
+// See programs/semihost.asm for definitions of these.
+//
+// A call which changes registers or memory cannot be replayed from the
+// debugger's history, so the history is restarted after it (see
+// history_reset): the debugger cannot step back past it.
+
+#include "cpu.h"
+#include "bench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    SEMIHOST_FIRST = 0xf0,
+
+    SYS_EXIT = SEMIHOST_FIRST,
+    SYS_PUTC,
+    SYS_WRITE,
+    SYS_READ_FILE,
+    SYS_INSTRUCTIONS,
+    SYS_CYCLES,
+    SYS_BENCH_START,
+    SYS_BENCH_STOP,
+    SYS_READ_INPUT
+};
+
+// What semihost() did.
+enum {
+    SEMIHOST_NONE,          // not a semihosting call: stop as usual
+    SEMIHOST_DONE,          // carried out: continue running
+    SEMIHOST_CHANGED,       // as SEMIHOST_DONE, but registers or memory were changed
+    SEMIHOST_EXIT           // the program asked to exit
+};
+
+// Carry out the swi just executed by c - that is, when cpu_run() has
+// stopped with stop_substate == SS_SWI - if it is a semihosting call.
+// Benchmark regions are recorded in b, or ignored if b is 0. The status for
+// SEMIHOST_EXIT is stored in *status.
+int semihost(cpu *c, bench *b, int *status);
+
+// Send what SYS_PUTC and SYS_WRITE write to write(ctx, buf, len), rather
+// than to stdout, or to stdout again if write is 0.
+void semihost_output(void (*write)(void *ctx, const char *buf, int len), void *ctx);
+
+// Open the file named for SYS_READ_INPUT to read, returning 0 on success,
+// or -1 with errno set.
+int semihost_input(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
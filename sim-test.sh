@@ -0,0 +1,35 @@
+#!/bin/bash
+
+# Runs the unit tests in the simulator, traced and at full speed, and checks
+# they pass and leave the machine in the same state either way - so that the
+# predecoded and fused handlers in engine.c agree with cpu_step().
+
+SRC=programs/unit_tests.asm
+OUT=out/sim-test
+
+mkdir -p "$OUT"
+./asm.pl "$SRC" > "$OUT/asm.log" || exit 1
+
+./out/sim -p -A "$OUT/asm.log" -s "$OUT/traced.ckpt" > "$OUT/traced.log"
+./out/sim -q -A "$OUT/asm.log" -s "$OUT/fast.ckpt" > "$OUT/fast.log"
+
+if ! perl -ne '
+    if (/^\s*\S*\s+(?:[[:xdigit:]]{4} ){14}([[:xdigit:]]{4}) [[:xdigit:]]{4} ; hlt/) {
+        $r14 = $1;
+    }
+    END {
+        if ($r14 eq "0000") {
+            exit 0;
+        }
+        print "FAIL at $r14\n";
+        exit 1;
+    }
+' "$OUT/traced.log"; then
+    exit 1
+fi
+
+if ! cmp -s "$OUT/traced.ckpt" "$OUT/fast.ckpt"; then
+    echo "FAIL: traced and fast runs differ"
+    exit 1
+fi
+echo SUCCESS
@@ -1,23 +1,47 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/errno.h>
-
-typedef unsigned char bool;
-typedef unsigned char u8;
-typedef unsigned short u16;
-typedef unsigned long u32;
-
-                            // light dark
-const u8 white   = 0x00;    //  67      
-const u8 red     = 0x01;    //  61     1
-const u8 green   = 0x02;    //  62     2
-const u8 yellow  = 0x03;    //  63     3
-const u8 blue    = 0x04;    //  64     4
-const u8 magenta = 0x05;    //  65     5
-const u8 cyan    = 0x06;    //  66     6
-const u8 grey    = 0x07;    //  7     60
-const u8 black   = 0x08;    //         0
+#include <errno.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "listing.h"
+#include "history.h"
+#include "stops.h"
+#include "gdbstub.h"
+#include "semihost.h"
+#include "bench.h"
+#include "coverage.h"
+
+// Exit statuses.
+enum {
+    EXIT_OK      = 0,       // the program stopped
+    EXIT_ERROR   = 1,
+    EXIT_STOPPED = 2,       // a --break, --watch or --until stop triggered
+    EXIT_LIMIT   = 3,       // --max-instructions or --max-cycles was reached
+    EXIT_BENCH   = 4        // --bench-baseline found a regression, or --bench failed
+};
+
+// What each stop in c->stops is for, as its tag.
+enum {
+    TAG_USER,               // given by the user
+    TAG_SAVE_AT,            // --save-at
+    TAG_DEBUG_AT,           // --debug-at
+    TAG_CONTINUE            // the debugger's "c ADDR"
+};
+
+enum {                      // light dark
+    white   = 0x00,         //  67
+    red     = 0x01,         //  61     1
+    green   = 0x02,         //  62     2
+    yellow  = 0x03,         //  63     3
+    blue    = 0x04,         //  64     4
+    magenta = 0x05,         //  65     5
+    cyan    = 0x06,         //  66     6
+    grey    = 0x07,         //  7     60
+    black   = 0x08,         //         0
+};
 
 const u8 dark      = 0x08;
 const u8 bg        = 0x10;
@@ -59,480 +83,45 @@ static inline char *attr(u8 code) {
 #define attr_reset  (enable_color ? "\033[0m" : "")
 #define attr_strike (enable_color ? "\033[9m" : "")
 
-bool trace_read = 0;
-bool trace_write = 0;
 int header_counter = 0;
 int header_every = 20;
 const char* asm_file = 0;
 
-const char* asm_labels[65536] = {};
-const char* asm_text[65536] = {};
-
-char disasm[32];
-
-u16 mem[0x8000];
-u16 r[16], prev_r[16];
-u16 special_regs[4], prev_special_regs[4];
-
-const int FLAGS      = 0;
-const int USER_FLAGS = 1;
-const int USER_R13   = 2;
-const int USER_R14   = 3;
-
-const u16 FLAG_N = 1<<15;
-const u16 FLAG_Z = 1<<14;
-const u16 FLAG_C = 1<<13;
-const u16 FLAG_V = 1<<12;
-const u16 FLAG_I = 1<<0;
-
-const int SS_NOP        = 0;
-const int SS_ALU        = 1;
-const int SS_LOAD       = 2;
-const int SS_STORE      = 3;
-const int SS_RD_FLAGS   = 4;
-const int SS_WR_FLAGS   = 5;
-const int SS_RD_SPECIAL = 6;
-const int SS_WR_SPECIAL = 7;
-const int SS_SWI        = 8;
-const int SS_RTU        = 9;
-const int SS_BRANCH     = 10;
-const int SS_PRED       = 11;
-const int SS_HALT       = 12;
-const int SS_TRAP       = 13;
-
-const u8 TOUCH_RD = 1;
-const u8 TOUCH_WR = 2;
-
-u8 touched_reg[16] = {};
-bool touched_skip = 0;
-
-u16 rd(int i)
-{
-    touched_reg[i] |= TOUCH_RD;
-    return r[i];
-}
-
-void wr(int i, u16 value)
-{
-    touched_reg[i] |= TOUCH_WR;
-    r[i] = value;
-}
-
-void touch_skip()
-{
-    touched_skip = 1;
-}
-
-void untouch_all()
-{
-    for(int i=0; i<16; i++) touched_reg[i] = 0;
-    touched_skip = 0;
-}
-
-u16 mem_rd(u16 addr, bool wide)
-{
-    u16 addr_hi = addr >> 1;
-    u16 addr_lo = (addr+1) >> 1;
-    bool aligned = (addr & 1) == 0;
-
-    if (wide) {
-        if (aligned) {
-            return mem[addr_hi];
-        } else {
-            return mem[addr_hi] << 8 | mem[addr_lo] >> 8;
-        }
-    }
-    else {
-        if (aligned) {
-            return mem[addr_hi] >> 8;
-        } else {
-            return mem[addr_hi] & 0xff;
-        }
-    }
-}
-
-void mem_wr(u16 addr, bool wide, u16 data)
-{
-    u16 addr_hi = addr >> 1;
-    u16 addr_lo = (addr+1) >> 1;
-    bool aligned = (addr & 1) == 0;
-
-    if (wide) {
-        if (aligned) {
-            mem[addr_hi] = data;
-        } else {
-            mem[addr_hi] = (mem[addr_hi] & 0xff00) | (data >> 8);
-            mem[addr_lo] = (mem[addr_lo] & 0x00ff) | (data << 8);
-        }
-    }
-    else {
-        if (aligned) {
-            mem[addr_hi] = (mem[addr_hi] & 0x00ff) | (data << 8);
-        } else {
-            mem[addr_hi] = (mem[addr_hi] & 0xff00) | (data & 0xff);
-        }
-    }
-}
-
-u16 clz(u16 val)
-{
-    if (!val) return 16;
-    u16 i = 0;
-    for( ; !(val & 0x8000); val <<= 1) i++;
-    return i;
-}
-
-void trap()
-{
-    printf("TRAP\n");
-    exit(0);
-}
-
-#define t(args...) sprintf(disasm, args)
-
-void execute(u16 op)
-{
-    u8 dst          = (op >> 0)  & 0x0f;
-    u8 src          = (op >> 4)  & 0x0f;
-    u8 num4         = (op >> 4)  & 0x0f;
-    u8 num5         = (op >> 8)  & 0x1f;
-    u8 num8         = (op >> 4)  & 0xff;
-    u8 sign         = (op >> 12) & 0x1;
-    u8 major_cat    = (op >> 14) & 0x3;
-    u8 arithlog_cat = (op >> 8)  & 0x3f;
-    u8 mov8_br      = (op >> 12) & 0x3;
-    u8 ldst_wide    = (op >> 13) & 0x1;
-    u8 ldst_base    = (op >> 4)  & 0xf;
-    u8 ldst_target  = (op >> 0)  & 0xf;
-    u8 pred_cond    = (op >> 4)  & 0xf;
-    u16 br_offset   = (op >> 0)  & 0xfff;
-    u8 special_reg  = (op >> 4)  & 0xf;
-
-    u16 cin = (special_regs[FLAGS] & FLAG_C) != 0;
-    u16 cout;
-    u32 res;
-
-    int substate = SS_TRAP;
-
-    bool mov_op   = 0;
-    bool sub_op   = 0;
-    bool add_op   = 0;
-    bool trap_op  = 0;
-    bool logic_op = 0;
-    bool cmp_op   = 0;
-    bool shift_op = 0;
-    bool tst_op   = 0;
-    bool signs_ne = 0;
-
-    u16 ldst_addr = 0;
-
-    bool br_link = 0;
-    u16 br_addr = 0;
-
-    bool pred_true = 0;
-
-    bool flag_n = (special_regs[FLAGS] & FLAG_N) != 0;
-    bool flag_z = (special_regs[FLAGS] & FLAG_Z) != 0;
-    bool flag_c = (special_regs[FLAGS] & FLAG_C) != 0;
-    bool flag_v = (special_regs[FLAGS] & FLAG_V) != 0;
-
-    u8 special_special = 0;
-
-    if (major_cat == 0x00) {
-        substate = SS_ALU;
-        signs_ne = (r[dst] ^ r[src]) >> 15;
-        switch(arithlog_cat) {
-            case 0x00: t("mov r%d, r%d", dst, src); mov_op = 1; res = rd(src); break;
-            case 0x01: t("mvn r%d, r%d", dst, src); mov_op = 1; res = (u16)~rd(src); break;
-            case 0x02: t("adc r%d, r%d", dst, src); add_op = 1; res = (u32)rd(dst) + rd(src) + cin; break;
-            case 0x03: t("sbc r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(dst) + (u16)~rd(src) + cin; break;
-            case 0x04: t("add r%d, r%d", dst, src); add_op = 1; res = (u32)rd(dst) + rd(src); break;
-            case 0x05: t("sub r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(dst) + (u16)~rd(src) + 1u; break;
-            case 0x06: t("rsc r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(src) + (u16)~rd(dst) + cin; break;
-            case 0x07: t("rsb r%d, r%d", dst, src); sub_op = 1; res = (u32)rd(src) + (u16)~rd(dst) + 1u; break;
-
-            case 0x08: t("clz r%d, r%d", dst, src); mov_op = 1; res = clz(rd(src)); break;
-            case 0x09: t("???");                    substate = SS_TRAP; break;
-            case 0x0a: t("mul r%d, r%d", dst, src); logic_op = 1; res = ((u32)rd(dst) * rd(src)) & 0xffff; break;
-            case 0x0b: t("muh r%d, r%d", dst, src); logic_op = 1; res = ((u32)rd(dst) * rd(src)) >> 16; break;
-            case 0x0c: t("and r%d, r%d", dst, src); logic_op = 1; res = rd(dst) & rd(src); break;
-            case 0x0d: t("cmp r%d, r%d", dst, src); cmp_op = 1; res = (u32)rd(dst) + (u16)~rd(src) + 1u; break;
-            case 0x0e: t("cmn r%d, r%d", dst, src); cmp_op = 1; res = (u32)rd(dst) + rd(src); break;
-            case 0x0f: t("???");                    substate = SS_TRAP; break;
-
-            // ROR
-            case 0x10:
-                t("ror r%d, r%d", dst, src);
-                if ((rd(src) & 0xf)==0) {
-                    logic_op = 1;
-                    res = rd(dst);
-                } else {
-                    shift_op = 1;
-                    res = rd(dst) << (16u-(rd(src) & 0xf)) |
-                        rd(dst) >>      (rd(src) & 0xf);
-                    cout = (rd(dst) >> ((rd(src)-1u) & 0xf)) & 1;
-                }
-                break;
-            // LSL
-            case 0x11:
-                t("lsl r%d, r%d", dst, src);
-                shift_op = 1;
-                if (rd(src) > 0u) {
-                    res = rd(dst) << rd(src);
-                    cout = (rd(src) <= 16u) && ((rd(dst) >> (16u-rd(src))) & 1);
-                } else {
-                    res = rd(dst);
-                    cout = 0;
-                }
-                break;
-            // LSR
-            case 0x12:
-                t("lsr r%d, r%d", dst, src);
-                shift_op = 1;
-                if (rd(src) > 0u) {
-                    res = rd(dst) >> rd(src);
-                    cout = (rd(dst) >> (rd(src)-1u)) & 1;
-                } else {
-                    res = rd(dst);
-                    cout = 0;
-                }
-                break;
-            // ASR
-            case 0x13:
-                t("asr r%d, r%d", dst, src);
-                shift_op = 1;
-                if (rd(src) > 0u) {
-                    res = rd(dst) >> rd(src);
-                    if (rd(dst) & 0x8000) res |= (~0) << (16u-rd(src));
-                    cout = (rd(dst) >> (rd(src)-1u)) & 1;
-                } else {
-                    res = rd(dst);
-                    cout = 0;
-                }
-                break;
-
-            case 0x14: t("orr r%d, r%d", dst, src); logic_op = 1; res = rd(dst) | rd(src); break;
-            case 0x15: t("eor r%d, r%d", dst, src); logic_op = 1; res = rd(dst) ^ rd(src); break;
-            case 0x16: t("bic r%d, r%d", dst, src); logic_op = 1; res = rd(dst) & ~rd(src); break;
-            case 0x17: t("tst r%d, r%d", dst, src); tst_op = 1;   res = rd(dst) & rd(src); break;
-
-            // RRX / ROR#
-            case 0x18:
-                shift_op = 1;
-                if (num4 == 0) {
-                    t("rrx r%d", dst);
-                    res = (cin ? 0x8000 : 0) | (rd(dst) >> 1);
-                    cout = rd(dst) & 1;
-                } else {
-                    t("ror r%d, #%d", dst, num4);
-                    shift_op = 1;
-                    res = rd(dst) << (16u-num4) |
-                        rd(dst) >>      num4;
-                    cout = (rd(dst) >> (num4-1u)) & 1;
-                }
-                break;
-
-            case 0x19:
-                t("lsl r%d, #%d", dst, num4);
-                shift_op = 1;
-                if (num4 > 0u) {
-                    res = rd(dst) << num4;
-                    cout = (rd(dst) >> (16u-num4)) & 1;
-                } else {
-                    res = rd(dst);
-                    cout = 0;
-                }
-                break;
-            case 0x1a:
-                t("lsr r%d, #%d", dst, num4);
-                shift_op = 1;
-                if (num4 > 0u) {
-                    res = rd(dst) >> num4;
-                    cout = (rd(dst) >> (num4-1u)) & 1;
-                } else {
-                    res = rd(dst);
-                    cout = 0;
-                }
-                break;
-            case 0x1b:
-                t("asr r%d, #%d", dst, num4);
-                shift_op = 1;
-                if (num4 > 0u) {
-                    res = rd(dst) >> num4;
-                    if (rd(dst) & 0x8000) res |= (~0) << (16u-num4);
-                    cout = (rd(dst) >> (num4-1u)) & 1;
-                } else {
-                    res = rd(dst);
-                    cout = 0;
-                }
-                break;
-
-            case 0x1c: t("orr r%d, #bit %d", dst, num4); logic_op = 1; res = rd(dst) | (1<<num4); break;
-            case 0x1d: t("eor r%d, #bit %d", dst, num4); logic_op = 1; res = rd(dst) ^ (1<<num4); break;
-            case 0x1e: t("bic r%d, #bit %d", dst, num4); logic_op = 1; res = rd(dst) & ~(1<<num4); break;
-            case 0x1f: t("tst r%d, #bit %d", dst, num4); tst_op = 1;   res = rd(dst) & (1<<num4); break;
-
-            default:
-                if (dst != 0xf) {
-                    add_op = 1;
-                    signs_ne = (rd(dst)>>15) != sign;
-                    if (sign == 0) {
-                        t("add r%d, #0x%02x", dst, num8);
-                        res = (u32)rd(dst) + num8;
-                    } else {
-                        u16 delta = (u16)num8 | 0xff00;
-                        t("sub r%d, #0x%02x", dst, -(signed short)delta);
-                        res = (u32)rd(dst) + delta;
-                    }
-                }
-                else if ((op>>8 & 0x1f) == 0x1f) {
-                    substate = SS_PRED;
-                    switch(pred_cond) {
-                        case 0x0: t("preq"); pred_true = flag_z; break;
-                        case 0x1: t("prne"); pred_true = !flag_z; break;
-                        case 0x2: t("prcs"); pred_true = flag_c; break;
-                        case 0x3: t("prcc"); pred_true = !flag_c; break;
-                        case 0x4: t("prmi"); pred_true = flag_n; break;
-                        case 0x5: t("prpl"); pred_true = !flag_n; break;
-                        case 0x6: t("prvs"); pred_true = flag_v; break;
-                        case 0x7: t("prvc"); pred_true = !flag_v; break;
-                        case 0x8: t("prhi"); pred_true = flag_c && !flag_z; break;
-                        case 0x9: t("prls"); pred_true = !flag_c || flag_z; break;
-                        case 0xa: t("prge"); pred_true = flag_n == flag_v; break;
-                        case 0xb: t("prlt"); pred_true = flag_n != flag_v; break;
-                        case 0xc: t("prgt"); pred_true = !flag_z && (flag_n == flag_v); break;
-                        case 0xd: t("prle"); pred_true = flag_z || (flag_n ^ flag_v); break;
-                        case 0xe: t("nop"); substate = SS_NOP; break;
-                        case 0xf: t("hlt"); substate = SS_HALT; break;
-                    }
-                }
-                else if ((op & 0xf00f) == 0x200f) {
-                    t("swi #%d", num8);
-                    substate = SS_SWI;
-                }
-                else switch(op & 0xff0f) {
-                    case 0x300f: t("mrs r%d, flags", special_reg); substate = SS_RD_FLAGS; break;
-                    case 0x310f: t("msr flags, r%d", special_reg); substate = SS_WR_FLAGS; break;
-                    case 0x320f: t("mrs r%d, uflags", special_reg); substate = SS_RD_SPECIAL; special_special = USER_FLAGS; break;
-                    case 0x330f: t("msr uflags, r%d", special_reg); substate = SS_WR_SPECIAL; special_special = USER_FLAGS; break;
-                    case 0x340f: t("mrs r%d, u13", special_reg); substate = SS_RD_SPECIAL; special_special = USER_R13; break;
-                    case 0x350f: t("msr u13, r%d", special_reg); substate = SS_WR_SPECIAL; special_special = USER_R13; break;
-                    case 0x360f: t("mrs r%d, u14", special_reg); substate = SS_RD_SPECIAL; special_special = USER_R14; break;
-                    case 0x370f: t("msr u14, r%d", special_reg); substate = SS_WR_SPECIAL; special_special = USER_R14; break;
-                    case 0x380f: t("rtu r%d", special_reg); substate = SS_RTU; break;
-                    default: t("???"); substate = SS_TRAP; break;
-                }
-                break;
-        }
-    }
-    else if (major_cat == 0x01) {
-        if (ldst_wide) {
-            t("ldw r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
-        } else {
-            t("ldb r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
-        }
-        substate = SS_LOAD;
-        ldst_addr = rd(ldst_base) + num5;
-    }
-    else if (major_cat == 0x02) {
-        if (ldst_wide) {
-            t("stw r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
-        } else {
-            t("stb r%d, [r%d, #%d]", ldst_target, ldst_base, num5);
-        }
-        substate = SS_STORE;
-        ldst_addr = rd(ldst_base) + num5;
-    }
-    else if (major_cat == 0x03) {
-        switch(mov8_br) {
-            case 0x0: t("mov r%d, #0x00%02x", dst, num8); substate = SS_ALU; mov_op = 1; res = (u16)num8; break;
-            case 0x1: t("mov r%d, #0x%02x00", dst, num8); substate = SS_ALU; mov_op = 1; res = (u16)num8 << 8; break;
-            default:
-                substate = SS_BRANCH;
-                br_link = mov8_br == 0x3;
-                if (br_offset & 0x800) {
-                    br_addr = r[15] + (br_offset<<1 | 0xf000);
-                } else {
-                    br_addr = r[15] + (br_offset<<1);
-                }
-                if (br_link) {
-                    t("bl 0x%04x", br_addr);
-                } else {
-                    t("bra 0x%04x", br_addr);
-                }
-                break;
-        }
-    }
-
-    if (add_op | sub_op | cmp_op) cout = (res >> 16) & 1;
-
-    bool wr_reg = add_op | sub_op          | shift_op | logic_op | mov_op ;
-    bool wr_nz  = add_op | sub_op | cmp_op | shift_op | logic_op | tst_op ;
-    bool wr_c   = add_op | sub_op | cmp_op | shift_op                     ;
-    bool wr_v   = add_op | sub_op | cmp_op                                ;
-    bool nout = (res >> 15) & 1;
-    bool zout = (res & 0xffff) == 0;
-    bool vout = nout ^ signs_ne ^ cout ^ (sub_op | cmp_op);
-
-    switch(substate) {
-        case SS_NOP:
-            break;
-        case SS_ALU:
-            if (wr_reg) {
-                wr(dst, res);
-            }
-            u16 fl = special_regs[FLAGS];
-            if (wr_nz) { fl &= ~FLAG_N; fl |= (nout ? FLAG_N : 0); }
-            if (wr_nz) { fl &= ~FLAG_Z; fl |= (zout ? FLAG_Z : 0); }
-            if (wr_c)  { fl &= ~FLAG_C; fl |= (cout ? FLAG_C : 0); }
-            if (wr_v)  { fl &= ~FLAG_V; fl |= (vout ? FLAG_V : 0); }
-            special_regs[FLAGS] = fl;
-            break;
-
-        case SS_LOAD:
-            wr(ldst_target, mem_rd(ldst_addr, ldst_wide));
-            if (trace_read) {
-                printf("READ %s [%04x] => %04x\n", ldst_wide ? "WORD" : "BYTE", ldst_addr, r[ldst_target]);
-            }
-            break;
-        case SS_STORE:
-            if (trace_write) {
-                printf("WRITE %s [%04x] <= %04x\n", ldst_wide ? "WORD" : "BYTE", ldst_addr, r[ldst_target]);
-            }
-            mem_wr(ldst_addr, ldst_wide, r[ldst_target]);
-            break;
-        case SS_RD_FLAGS:
-            wr(special_reg, special_regs[FLAGS]);
-            break;
-        case SS_WR_FLAGS:
-            special_regs[FLAGS] = rd(special_reg);
-            break;
-        case SS_BRANCH:
-            if (br_link) {
-                wr(14, r[15]);
-            }
-            r[15] = br_addr;
-            break;
-        case SS_PRED:
-            if (!pred_true) {
-                touch_skip();
-                r[15] += 2;
-            }
-            break;
-        case SS_RD_SPECIAL:
-            wr(special_reg, special_regs[special_special]);
-            break;
-        case SS_WR_SPECIAL:
-            special_regs[special_special] = rd(special_reg);
-            break;
-        case SS_SWI:
-        case SS_RTU:
-        case SS_HALT:
-        case SS_TRAP:
-            trap();
-            break;
-    }
-}
+const char* save_file = 0;
+const char* save_at = 0;
+const char* resume_file = 0;
+const char* entry = 0;
+const char* input_file = 0;
+const char* bench_file = 0;
+const char* bench_baseline = 0;
+bench *benchmarks = 0;
+const char* coverage_file = 0;
+const char* coverage_listing = 0;
+coverage *cov = 0;
+
+bool quiet = 0;
+bool debug = 0;
+bool code_stats = 0;
+u64 max_instructions = 0;   // 0 for no limit
+u64 max_cycles = 0;
+const char* debug_at = 0;
+u64 history_size = 1000000;
+const char* gdb_port = 0;
+history *hist = 0;
+
+// stops given on the command line, added once the listing is loaded
+struct {
+    int kind;
+    const char *opt;
+    const char *spec;
+} stop_args[64];
+int num_stop_args = 0;
+
+listing *asm_listing = 0;
+
+cpu *c = 0;
+
+u16 prev_special_regs[4];
 
 void trace_headers()
 {
@@ -569,7 +158,7 @@ void trace_flags()
     };
     for(int i=0; i<4; i++) {
         u16 pre = prev_special_regs[FLAGS] & info[i].mask;
-        u16 now = special_regs[FLAGS] & info[i].mask;
+        u16 now = c->special_regs[FLAGS] & info[i].mask;
         printf("%s%s%s",
                 (now == pre) ? "" : attr(dark|red),
                 now ? info[i].on : info[i].off,
@@ -583,15 +172,15 @@ void trace_regs()
     if (enable_ascii) {
         bool old_diff = 0;
         for(int i=0; i<16; i++) {
-            u8 touch = touched_reg[i];
+            u8 touch = c->touched_reg[i];
             if (touch & TOUCH_WR) {
-                printf("[%04x]", r[i]);
+                printf("[%04x]", c->r[i]);
             }
             else if (touch & TOUCH_RD) {
-                printf(" %04x ", r[i]);
+                printf(" %04x ", c->r[i]);
             }
             else {
-                printf(" %04x ", r[i]);
+                printf(" %04x ", c->r[i]);
             }
         }
     }
@@ -602,7 +191,7 @@ void trace_regs()
         for(int i=0; i<16; i++) {
             if (i>0) printf(" ");
 
-            u8 touch = touched_reg[i];
+            u8 touch = c->touched_reg[i];
             if (touch != old_touch) {
                 if (touch & TOUCH_WR) {
                     printf("%s", attr(dark|red));
@@ -614,38 +203,20 @@ void trace_regs()
                     printf("%s", attr(grey));
                 }
             }
-            printf("%04x", r[i]);
+            printf("%04x", c->r[i]);
             old_touch = touch;
         }
         printf("%s", attr_reset);
     }
 }
 
-void dw(u16 addr, u16 data)
-{
-    mem[addr>>1] = data;
-}
-
 void load_prog()
 {
-    const char *hi_file = "out/mem.bin.0";
-    const char *lo_file = "out/mem.bin.1";
-    FILE* hi_fp = fopen(hi_file, "r");
-    FILE* lo_fp = fopen(lo_file, "r");
-    if (hi_fp == 0 || lo_fp == 0) {
-        fclose(hi_fp);
-        fclose(lo_fp);
-        fprintf(stderr, "could not load %s, %s\n", hi_file, lo_file);
+    const char *base = "out/mem.bin";
+    if (cpu_load_image(c, base)) {
+        fprintf(stderr, "could not load %s.0, %s.1\n", base, base);
         exit(1);
     }
-    for(int i=0; i<0x8000; i++) {
-        u8 hi, lo;
-        fscanf(hi_fp, "%hhx", &hi);
-        fscanf(lo_fp, "%hhx", &lo);
-        mem[i] = (u16)hi<<8 | lo;
-    }
-    fclose(hi_fp);
-    fclose(lo_fp);
 }
 
 void load_asm()
@@ -653,44 +224,10 @@ void load_asm()
     if (asm_file == 0) {
         return;
     }
-
-    u16 org = 0x0000;
-    u16 opcode;
-
-    FILE *fp = fopen(asm_file, "r");
-    if (fp == 0) {
-        fprintf(stderr, "could not load %s\n", asm_file);
+    asm_listing = listing_load(asm_file);
+    if (asm_listing == 0) {
         exit(1);
     }
-    int lineno = 0;
-    char buf[1024];
-    while(fgets(buf, sizeof(buf), fp)) {
-        lineno++;
-        char *end = strchr(buf, '\n');
-        if (end) *end = '\0';
-
-        if (buf[0] == '.') {
-            // TODO - label should actually refer to next org read in?
-            asm_labels[org+2] = strdup(buf+1);
-        }
-        else if (2 == sscanf(buf, "%hx %hx ; ", &org, &opcode)) {
-            asm_text[org] = strdup(buf+12);
-        }
-        else if (buf[0] == ';') {
-            // ignore comment
-        }
-        else {
-            fprintf(stderr, "%s:%d: syntax error\n", asm_file, lineno);
-            exit(1);
-        }
-    }
-
-    if (ferror(fp)) {
-        fprintf(stderr, "%s:%d: while reading: %s\n", asm_file, lineno, strerror(errno));
-        exit(1);
-    }
-
-    fclose(fp);
 }
 
 typedef struct
@@ -712,12 +249,12 @@ typedef struct
 
 void opt_trace_write(args *args)
 {
-    trace_write = 1;
+    c->trace_write = 1;
 }
 
 void opt_trace_read(args *args)
 {
-    trace_read = 1;
+    c->trace_read = 1;
 }
 
 const char *arg_value(args *args)
@@ -774,6 +311,149 @@ void opt_post(args *args)
     mode_post = 1;
 }
 
+void opt_save(args *args)
+{
+    save_file = arg_value(args);
+}
+
+void opt_save_at(args *args)
+{
+    save_at = arg_value(args);
+}
+
+void opt_resume(args *args)
+{
+    resume_file = arg_value(args);
+}
+
+void opt_entry(args *args)
+{
+    entry = arg_value(args);
+}
+
+void opt_input(args *args)
+{
+    input_file = arg_value(args);
+}
+
+void opt_bench(args *args)
+{
+    bench_file = arg_value(args);
+}
+
+void opt_bench_baseline(args *args)
+{
+    bench_baseline = arg_value(args);
+}
+
+void opt_coverage(args *args)
+{
+    coverage_file = arg_value(args);
+}
+
+void opt_coverage_listing(args *args)
+{
+    coverage_listing = arg_value(args);
+}
+
+void opt_quiet(args *args)
+{
+    quiet = 1;
+}
+
+void opt_debug(args *args)
+{
+    debug = 1;
+}
+
+void opt_code_stats(args *args)
+{
+    code_stats = 1;
+}
+
+void opt_debug_at(args *args)
+{
+    debug_at = arg_value(args);
+}
+
+void opt_history(args *args)
+{
+    const char *arg = arg_value(args);
+    char *endptr = 0;
+    long long val = strtoll(arg, &endptr, 0);
+    if (val < 1 || *endptr) {
+        fprintf(stderr, "%s: invalid value %s\n", args->opt, arg);
+        exit(1);
+    }
+    history_size = val;
+}
+
+u64 limit_value(args *args)
+{
+    const char *arg = arg_value(args);
+    char *endptr = 0;
+    long long val = strtoll(arg, &endptr, 0);
+    if (val < 1 || *endptr) {
+        fprintf(stderr, "%s: invalid value %s\n", args->opt, arg);
+        exit(1);
+    }
+    return val;
+}
+
+void opt_max_instructions(args *args)
+{
+    max_instructions = limit_value(args);
+}
+
+void opt_max_cycles(args *args)
+{
+    max_cycles = limit_value(args);
+}
+
+void opt_gdb(args *args)
+{
+    gdb_port = arg_value(args);
+}
+
+void add_stop_arg(args *args, int kind)
+{
+    const char *opt = args->opt;
+    const char *spec = arg_value(args);
+    if (num_stop_args == sizeof(stop_args)/sizeof(stop_args[0])) {
+        fprintf(stderr, "%s: too many stops\n", opt);
+        exit(1);
+    }
+    stop_args[num_stop_args].kind = kind;
+    stop_args[num_stop_args].opt = opt;
+    stop_args[num_stop_args].spec = spec;
+    num_stop_args++;
+}
+
+void opt_break(args *args)
+{
+    add_stop_arg(args, STOP_BREAK);
+}
+
+void opt_watch(args *args)
+{
+    add_stop_arg(args, STOP_WATCH);
+}
+
+void opt_rwatch(args *args)
+{
+    add_stop_arg(args, STOP_RWATCH);
+}
+
+void opt_awatch(args *args)
+{
+    add_stop_arg(args, STOP_AWATCH);
+}
+
+void opt_until(args *args)
+{
+    add_stop_arg(args, STOP_UNTIL);
+}
+
 void opt_help(args *args);
 
 option options[] = {
@@ -787,6 +467,28 @@ option options[] = {
     {"-p", "--plain",        "",     "undecorated output",                     &opt_plain},
     {"",   "--pre",          "",     "output pre-instruction state (default)", &opt_pre},
     {"",   "--post",         "",     "output post-instruction state",          &opt_post},
+    {"-s", "--save",         "FILE", "save a snapshot to FILE on stopping",    &opt_save},
+    {"",   "--save-at",      "ADDR", "save instead when pc first reaches ADDR", &opt_save_at},
+    {"",   "--resume",       "FILE", "resume from snapshot FILE",              &opt_resume},
+    {"",   "--entry",        "ADDR", "start at ADDR instead of the reset address", &opt_entry},
+    {"",   "--input",        "FILE", "read FILE by the SYS_READ_INPUT semihosting call", &opt_input},
+    {"",   "--bench",        "FILE", "write benchmark regions to FILE as JSON", &opt_bench},
+    {"",   "--bench-baseline", "FILE", "fail if regions are slower than in FILE", &opt_bench_baseline},
+    {"",   "--coverage",     "FILE", "add coverage to that already in FILE",  &opt_coverage},
+    {"",   "--coverage-listing", "FILE", "write the --asm listing annotated with coverage to FILE", &opt_coverage_listing},
+    {"-q", "--quiet",        "",     "no trace output outside the debugger",   &opt_quiet},
+    {"-d", "--debug",        "",     "start in the debugger",                  &opt_debug},
+    {"",   "--debug-at",     "ADDR", "enter the debugger when pc first reaches ADDR", &opt_debug_at},
+    {"",   "--history",      "N",    "steps the debugger can undo directly",   &opt_history},
+    {"",   "--max-instructions", "N", "give up after N instructions",        &opt_max_instructions},
+    {"",   "--max-cycles",   "N",    "give up after N cycles",                 &opt_max_cycles},
+    {"",   "--code-stats",    "",     "report writes to predecoded code on exit", &opt_code_stats},
+    {"-g", "--gdb",          "PORT", "serve gdb on local PORT (- for stdin/stdout)", &opt_gdb},
+    {"-b", "--break",        "SPEC", "stop before executing ADDR [if COND]",   &opt_break},
+    {"",   "--watch",        "SPEC", "stop after a write to ADDR [if COND]",   &opt_watch},
+    {"",   "--rwatch",       "SPEC", "stop after a read of ADDR [if COND]",    &opt_rwatch},
+    {"",   "--awatch",       "SPEC", "stop after any access to ADDR [if COND]", &opt_awatch},
+    {"",   "--until",        "COND", "stop when COND becomes true, e.g. \"r14 == 0xffff\"", &opt_until},
 };
 
 void opt_help(args *args)
@@ -864,49 +566,784 @@ void parse_args(int argc, const char* argv[]) {
     }
 }
 
+// Resolve ADDR, which is either a number or a .label from the assembly
+// listing. Returns 0 if it is neither.
+bool lookup_addr(const char *arg, u16 *addr)
+{
+    if (arg[0] == '.') {
+        int found = asm_listing ? listing_find(asm_listing, arg+1) : -1;
+        if (found < 0) {
+            return 0;
+        }
+        *addr = found;
+        return 1;
+    }
+    char *endptr = 0;
+    long val = strtol(arg, &endptr, 0);
+    if (val < 0 || val > 0xffff || *endptr || endptr == arg) {
+        return 0;
+    }
+    *addr = val;
+    return 1;
+}
+
+u16 parse_addr(const char *opt, const char *arg)
+{
+    u16 addr;
+    if (lookup_addr(arg, &addr)) {
+        return addr;
+    }
+    if (arg[0] == '.') {
+        fprintf(stderr, "%s: unknown label %s%s\n", opt, arg, asm_file ? "" : " (no --asm listing given)");
+    } else {
+        fprintf(stderr, "%s: invalid value %s\n", opt, arg);
+    }
+    exit(1);
+}
+
+void save_snapshot()
+{
+    if (cpu_save(c, save_file)) {
+        fprintf(stderr, "could not save %s: %s\n", save_file, strerror(errno));
+        exit(1);
+    }
+    save_file = 0;
+}
+
+// Add a stop, with a message prefixed by what on failure. Returns its
+// index, or -1.
+int add_stop(int kind, const char *spec, int tag, const char *what)
+{
+    if (c->stops == 0) {
+        c->stops = stops_new();
+    }
+    char err[128];
+    int i = stops_add(c->stops, kind, spec, asm_listing, err, sizeof(err));
+    if (i < 0) {
+        fprintf(stderr, "%s: %s\n", what, err);
+        return -1;
+    }
+    c->stops->list[i].tag = tag;
+    return i;
+}
+
+// Add a breakpoint at addr for the simulator's own use.
+void add_internal_break(u16 addr, int tag)
+{
+    char spec[8];
+    snprintf(spec, sizeof(spec), "0x%04x", addr);
+    add_stop(STOP_BREAK, spec, tag, "internal");
+}
+
+void remove_tagged(int tag)
+{
+    for(int i=0; c->stops && i<c->stops->num; i++) {
+        if (c->stops->list[i].tag == tag) {
+            stops_remove(c->stops, c->stops->list[i].id);
+            i--;
+        }
+    }
+}
+
+const char *stop_kind_name(int kind)
+{
+    switch(kind) {
+        case STOP_BREAK:  return "break";
+        case STOP_WATCH:  return "watch";
+        case STOP_RWATCH: return "rwatch";
+        case STOP_AWATCH: return "awatch";
+        default:          return "until";
+    }
+}
+
+void print_stop(const stop *st)
+{
+    printf("STOPPED: %s %s\n", stop_kind_name(st->kind), st->text);
+}
+
+//------------------------------------------------------------------------------
+// Limits
+//
+// Runs are split so that --max-instructions and --max-cycles are only
+// checked between calls to cpu_run(). The last PC_HISTORY instructions
+// before a limit are stepped one at a time, and their addresses kept for
+// the report.
+
+enum {
+    PC_HISTORY = 4096,
+    CYCLES_MAX = 4          // most cycles a step takes (a load, or a skipped pr*)
+};
+
+u16 pc_history[PC_HISTORY];
+u64 pc_history_count = 0;
+
+bool limited()
+{
+    return max_instructions || max_cycles;
+}
+
+bool limit_reached()
+{
+    return (max_instructions && c->instructions >= max_instructions) ||
+           (max_cycles && c->cycles >= max_cycles);
+}
+
+// Steps which can certainly be taken without passing a limit.
+u64 steps_allowed()
+{
+    u64 n = ~0ull;
+    if (max_instructions) {
+        n = c->instructions < max_instructions ? max_instructions - c->instructions : 0;
+    }
+    if (max_cycles) {
+        u64 m = c->cycles < max_cycles ? (max_cycles - c->cycles + CYCLES_MAX-1) / CYCLES_MAX : 0;
+        if (m < n) n = m;
+    }
+    return n;
+}
+
+void record_pc(u16 pc)
+{
+    pc_history[pc_history_count++ % PC_HISTORY] = pc;
+}
+
+int compare_counts(const void *a, const void *b)
+{
+    const u32 *x = a;
+    const u32 *y = b;
+    if (x[1] != y[1]) return x[1] < y[1] ? 1 : -1;
+    return x[0] < y[0] ? -1 : x[0] > y[0];
+}
+
+// Print the addresses executed most often before the limit was reached.
+void print_pc_histogram()
+{
+    int n = pc_history_count < PC_HISTORY ? pc_history_count : PC_HISTORY;
+    static u32 counts[0x8000];
+    static u32 sorted[0x8000][2];
+    int num_sorted = 0;
+    for(int i=0; i<n; i++) {
+        u16 i_pc = pc_history[i] >> 1;
+        if (counts[i_pc]++ == 0) {
+            sorted[num_sorted++][0] = i_pc;
+        }
+    }
+    for(int i=0; i<num_sorted; i++) {
+        sorted[i][1] = counts[sorted[i][0]];
+    }
+    qsort(sorted, num_sorted, sizeof(sorted[0]), compare_counts);
+
+    printf("last %d instructions, by address:\n", n);
+    for(int i=0; i<num_sorted && i<20; i++) {
+        u16 pc = sorted[i][0] << 1;
+        const char *label = asm_listing ? asm_listing->label[pc] : 0;
+        const char *text = asm_listing ? asm_listing->text[pc] : 0;
+        printf("%6u  %04x", (unsigned)sorted[i][1], pc);
+        if (label) printf("  .%s", label);
+        if (text) printf("  %s", text);
+        printf("\n");
+    }
+    if (num_sorted > 20) {
+        printf("   ...  %d more\n", num_sorted - 20);
+    }
+}
+
+// Step once, returning the RUN_* result.
+int step()
+{
+    u16 pc = c->r[15];
+    u16 op = mem_rd(c, pc, 1);
+    u64 before = c->instructions;
+    int why = hist ? history_step(hist, c) : cpu_run(c, 1);
+    if (cov && c->instructions != before) {
+        coverage_record(cov, c, pc, op);
+    }
+    return why;
+}
+
+// Run until something stops us, returning the RUN_* result. When limited,
+// this may return RUN_LIMIT early.
+int run()
+{
+    if (cov) {
+        // stepped one at a time anyway
+        record_pc(c->r[15]);
+        return step();
+    }
+    u64 n = limited() ? steps_allowed() : ~0ull;
+    if (n <= PC_HISTORY) {
+        record_pc(c->r[15]);
+        return step();
+    }
+    if (limited()) {
+        n -= PC_HISTORY;
+    }
+    return hist ? history_run(hist, c, n) : cpu_run(c, n);
+}
+
+void trace_label(u16 pc)
+{
+    const char *label = asm_listing ? asm_listing->label[pc] : 0;
+    if (label != 0) {
+        if (enable_ascii) {
+            printf("%102s.%s\n", "", label);
+        } else {
+            printf("%85s.%s\n", "", label);
+        }
+    }
+}
+
+void trace_line(u16 pc, const char *disasm)
+{
+    trace_headers();
+    trace_label(pc);
+    trace_flags();
+    trace_regs();
+    printf(" %s; %s%s%s\n",
+            attr(dark|green),
+            c->touched_skip ? attr_strike : "",
+            (asm_listing && asm_listing->text[pc]) ? asm_listing->text[pc] : disasm,
+            attr_reset
+    );
+}
+
+// Step once, printing the trace. In --post mode, the instruction which
+// stopped the simulator is only printed if show_stop.
+int trace_step(bool show_stop)
+{
+    u16 pc = c->r[15];
+    int why = RUN_LIMIT;
+    if (mode_post) {
+        why = step();
+        if (why == RUN_BREAK || (why == RUN_STOPPED && !show_stop)) {
+            return why;
+        }
+    }
+    else if (c->stops && !c->resume_break && stops_is_break(c->stops, pc)) {
+        // check the breakpoint now, so nothing is printed if it stops us
+        int hit = stops_break(c->stops, c, pc);
+        c->resume_break = 1;
+        if (hit >= 0) {
+            c->stop_hit = hit;
+            return RUN_BREAK;
+        }
+    }
+    trace_line(pc, c->disasm);
+    if (!mode_post) {
+        why = step();
+    }
+    return why;
+}
+
+//------------------------------------------------------------------------------
+// Debugger
+//
+
+// Disassemble the next instruction, by executing it in a fork.
+void peek_disasm(char *buf, int size)
+{
+    cpu *tmp = cpu_fork(c);
+    tmp->want_disasm = 1;
+    tmp->trace_read = 0;
+    tmp->trace_write = 0;
+    cpu_step(tmp);
+    snprintf(buf, size, "%s", tmp->disasm);
+    cpu_free(tmp);
+}
+
+void debug_show()
+{
+    char disasm[32];
+    peek_disasm(disasm, sizeof(disasm));
+
+    header_counter = 0;
+    trace_headers();
+    trace_label(c->r[15]);
+    trace_flags();
+    trace_regs();
+    u16 pc = c->r[15];
+    printf(" %s; %s%s\n",
+            attr(dark|green),
+            (asm_listing && asm_listing->text[pc]) ? asm_listing->text[pc] : disasm,
+            attr_reset
+    );
+    printf("@%llu: %llu instructions, %llu cycles\n",
+            (unsigned long long)hist->now,
+            (unsigned long long)c->instructions,
+            (unsigned long long)c->cycles);
+}
+
+// Run forward n steps, or until a stop, tracing each step if show. Any
+// breakpoint at the current pc is passed over.
+void debug_run(u64 n, bool show)
+{
+    c->resume_break = 1;
+    c->want_disasm = show;
+
+    int why = RUN_LIMIT;
+    if (show) {
+        for(u64 i=0; i<n && why == RUN_LIMIT; i++) {
+            why = trace_step(1);
+        }
+    } else {
+        why = history_run(hist, c, n);
+    }
+
+    switch(why) {
+        case RUN_STOPPED:
+            printf("TRAP\n");
+            history_back(hist, c, 1);
+            break;
+        case RUN_BREAK:
+        case RUN_WATCH: {
+            stop *st = &c->stops->list[c->stop_hit];
+            if (st->tag == TAG_USER) {
+                print_stop(st);
+            }
+            break;
+        }
+    }
+}
+
+// Continue until pc reaches addr, or something else stops us.
+void debug_continue_to(u16 addr)
+{
+    add_internal_break(addr, TAG_CONTINUE);
+    debug_run(~0ull, 0);
+    remove_tagged(TAG_CONTINUE);
+}
+
+void debug_list_stops()
+{
+    int n = 0;
+    for(int i=0; c->stops && i<c->stops->num; i++) {
+        const stop *st = &c->stops->list[i];
+        if (st->tag != TAG_USER) continue;
+        printf("%3d  %-6s  %s  (%llu hits)\n", st->id, stop_kind_name(st->kind), st->text,
+                (unsigned long long)st->hits);
+        n++;
+    }
+    if (n == 0) {
+        printf("no stops\n");
+    }
+}
+
+void debug_help()
+{
+    printf("Commands:\n");
+    printf("  s [N]           step forward N instructions (default 1)\n");
+    printf("  b [N]           step back N instructions (default 1)\n");
+    printf("  c [ADDR]        continue until pc reaches ADDR, or the program stops\n");
+    printf("  rc [ADDR]       reverse continue to the last time pc was ADDR, or to the start\n");
+    printf("  rw ADDR         reverse continue to the last write to the byte at ADDR\n");
+    printf("  rewind N        go back N instructions without tracing\n");
+    printf("  goto T          go to time T (shown as @T) without tracing\n");
+    printf("  x ADDR [N]      display N memory words from ADDR (default 8)\n");
+    printf("  r               display the registers\n");
+    printf("  p EXPR          evaluate EXPR, e.g. [r13+2] or r0 << 8\n");
+    printf("  break SPEC      stop before executing ADDR [if COND]\n");
+    printf("  watch SPEC      stop after a write to ADDR or b[ADDR] [if COND]\n");
+    printf("  rwatch SPEC     ... after a read\n");
+    printf("  awatch SPEC     ... after any access\n");
+    printf("  until COND      stop when COND becomes true\n");
+    printf("  delete ID       remove a stop\n");
+    printf("  stops           list the stops\n");
+    printf("  q               quit\n");
+    printf("ADDR may be a number or a .label\n");
+}
+
+void debugger()
+{
+    if (hist == 0) {
+        hist = history_new(c, history_size, history_size);
+    }
+
+    debug_show();
+    char line[256];
+    while(1) {
+        printf("(vixen) ");
+        fflush(stdout);
+        if (!fgets(line, sizeof(line), stdin)) {
+            printf("\n");
+            exit(0);
+        }
+
+        char cmd[32] = "";
+        char arg1[128] = "";
+        char arg2[128] = "";
+        int nargs = sscanf(line, "%31s %127s %127s", cmd, arg1, arg2);
+        if (nargs <= 0) {
+            continue;
+        }
+        // commands taking an expression, which may contain spaces
+        const char *rest = line + strspn(line, " \t");
+        rest += strcspn(rest, " \t");
+        rest += strspn(rest, " \t");
+        char spec[256];
+        snprintf(spec, sizeof(spec), "%.*s", (int)strcspn(rest, "\r\n"), rest);
+
+        int kind = -1;
+        if      (!strcmp(cmd, "break"))  kind = STOP_BREAK;
+        else if (!strcmp(cmd, "watch"))  kind = STOP_WATCH;
+        else if (!strcmp(cmd, "rwatch")) kind = STOP_RWATCH;
+        else if (!strcmp(cmd, "awatch")) kind = STOP_AWATCH;
+        else if (!strcmp(cmd, "until"))  kind = STOP_UNTIL;
+        if (kind >= 0 && nargs >= 2) {
+            int i = add_stop(kind, spec, TAG_USER, cmd);
+            if (i >= 0) {
+                printf("%d: %s %s\n", c->stops->list[i].id, cmd, spec);
+            }
+            continue;
+        }
+        if (!strcmp(cmd, "delete") && nargs >= 2) {
+            if (c->stops == 0 || stops_remove(c->stops, strtol(arg1, 0, 0))) {
+                printf("no stop %s\n", arg1);
+            }
+            continue;
+        }
+        if (!strcmp(cmd, "stops")) {
+            debug_list_stops();
+            continue;
+        }
+        if (!strcmp(cmd, "p") && nargs >= 2) {
+            u32 value;
+            char err[128];
+            if (stops_eval(c, spec, asm_listing, &value, err, sizeof(err))) {
+                printf("%s\n", err);
+            } else {
+                printf("0x%04x (%lu)\n", (unsigned)value & 0xffff, (unsigned long)value);
+            }
+            continue;
+        }
+
+        u16 addr = 0;
+        if (nargs >= 2 && strcmp(cmd, "rewind") && strcmp(cmd, "goto") &&
+                strcmp(cmd, "s") && strcmp(cmd, "b") && !lookup_addr(arg1, &addr)) {
+            printf("bad address: %s\n", arg1);
+            continue;
+        }
+        u64 n = (nargs >= 2) ? strtoull(arg1, 0, 0) : 1;
+
+        if (!strcmp(cmd, "s")) {
+            debug_run(n, 1);
+        }
+        else if (!strcmp(cmd, "b")) {
+            history_back(hist, c, n);
+        }
+        else if (!strcmp(cmd, "rewind") && nargs >= 2) {
+            history_back(hist, c, n);
+        }
+        else if (!strcmp(cmd, "goto") && nargs >= 2) {
+            if (n > hist->now) {
+                debug_run(n - hist->now, 0);
+            } else {
+                history_goto(hist, c, n);
+            }
+        }
+        else if (!strcmp(cmd, "c")) {
+            if (nargs >= 2) {
+                debug_continue_to(addr);
+            } else {
+                debug_run(~0ull, 0);
+            }
+        }
+        else if (!strcmp(cmd, "rc")) {
+            if (nargs < 2 || history_reverse_to_pc(hist, c, addr)) {
+                history_goto(hist, c, 0);
+            }
+        }
+        else if (!strcmp(cmd, "rw") && nargs >= 2) {
+            if (history_reverse_to_write(hist, c, addr)) {
+                printf("no earlier write to %04x\n", addr);
+            }
+        }
+        else if (!strcmp(cmd, "x") && nargs >= 2) {
+            int count = (nargs >= 3) ? strtol(arg2, 0, 0) : 8;
+            for(int i=0; i<count; i++) {
+                u16 a = addr + 2*i;
+                if (i % 8 == 0) printf("%s%04x:", i ? "\n" : "", a);
+                printf(" %04x", mem_rd(c, a, 1));
+            }
+            printf("\n");
+            continue;
+        }
+        else if (!strcmp(cmd, "r")) {
+        }
+        else if (!strcmp(cmd, "q")) {
+            exit(0);
+        }
+        else {
+            debug_help();
+            continue;
+        }
+        debug_show();
+    }
+}
+
+void serve_gdb()
+{
+    // stdout may be the connection, so there must be no trace output
+    c->want_disasm = 0;
+    c->trace_read = 0;
+    c->trace_write = 0;
+
+    if (!strcmp(gdb_port, "-")) {
+        gdb_serve(c, hist, asm_listing, 0, 1);
+        exit(0);
+    }
+
+    char *endptr = 0;
+    long port = strtol(gdb_port, &endptr, 0);
+    if (port < 1 || port > 65535 || *endptr) {
+        fprintf(stderr, "--gdb: invalid port %s\n", gdb_port);
+        exit(1);
+    }
+    fprintf(stderr, "waiting for gdb on port %ld\n", port);
+    int fd = gdb_accept(port);
+    if (fd < 0) {
+        fprintf(stderr, "--gdb: %s\n", strerror(errno));
+        exit(1);
+    }
+    gdb_serve(c, hist, asm_listing, fd, fd);
+    close(fd);
+    exit(0);
+}
+
+void print_code_stats()
+{
+    fprintf(stderr, "%llu writes to code pages, %llu predecoded instructions discarded\n",
+            (unsigned long long)c->code_writes,
+            (unsigned long long)c->code_discarded);
+}
+
+// Save the coverage, and write the annotated listing, if wanted.
+void finish_coverage()
+{
+    if (coverage_file && coverage_save(cov, coverage_file)) {
+        fprintf(stderr, "could not save coverage to %s: %s\n", coverage_file, strerror(errno));
+    }
+    if (coverage_listing) {
+        FILE *fp = fopen(coverage_listing, "w");
+        if (fp == 0) {
+            fprintf(stderr, "could not write %s: %s\n", coverage_listing, strerror(errno));
+            return;
+        }
+        if (coverage_write_listing(cov, asm_file, fp)) {
+            fprintf(stderr, "could not read %s: %s\n", asm_file, strerror(errno));
+        }
+        fclose(fp);
+    }
+}
+
+// Write and check the benchmark results, if any, returning whether all is
+// well.
+bool finish_bench()
+{
+    if (benchmarks == 0) {
+        return 1;
+    }
+    if (bench_file) {
+        FILE *fp = strcmp(bench_file, "-") ? fopen(bench_file, "w") : stdout;
+        if (fp == 0) {
+            fprintf(stderr, "could not write %s: %s\n", bench_file, strerror(errno));
+            return 0;
+        }
+        bench_write(benchmarks, fp);
+        if (fp != stdout) {
+            fclose(fp);
+        }
+    }
+    if (bench_baseline) {
+        int regressions = bench_compare(benchmarks, bench_baseline, stderr);
+        if (regressions < 0) {
+            fprintf(stderr, "could not read %s: %s\n", bench_baseline, strerror(errno));
+            return 0;
+        }
+        return regressions == 0;
+    }
+    return 1;
+}
+
+void trap()
+{
+    printf("TRAP\n");
+    if (save_file) {
+        save_snapshot();
+    }
+    if (hist) {
+        // stop at the instruction which stopped us, and look around
+        history_back(hist, c, 1);
+        debugger();
+    }
+    exit(finish_bench() ? EXIT_OK : EXIT_BENCH);
+}
+
+// Report reaching --max-instructions or --max-cycles.
+void limit()
+{
+    if (max_instructions && c->instructions >= max_instructions) {
+        printf("LIMIT: %llu instructions\n", (unsigned long long)max_instructions);
+    } else {
+        printf("LIMIT: %llu cycles\n", (unsigned long long)max_cycles);
+    }
+    print_pc_histogram();
+    if (save_file) {
+        save_snapshot();
+    }
+    if (hist) {
+        debugger();
+    }
+    finish_bench();
+    exit(EXIT_LIMIT);
+}
+
+// The program asked to exit, by semihosting.
+void sys_exit(int status)
+{
+    if (save_file) {
+        save_snapshot();
+    }
+    if (hist) {
+        debugger();
+    }
+    if (!finish_bench() && status == 0) {
+        status = EXIT_BENCH;
+    }
+    exit(status);
+}
+
+// Act on whatever ended a run.
+void stopped(int why)
+{
+    if (why == RUN_STOPPED) {
+        int status;
+        switch(c->stop_substate == SS_SWI ? semihost(c, benchmarks, &status) : SEMIHOST_NONE) {
+            case SEMIHOST_CHANGED:
+                if (hist) {
+                    // which replaying the history would not reproduce
+                    history_reset(hist, c);
+                }
+                // fall through
+            case SEMIHOST_DONE:
+                if (mode_post && !quiet) {
+                    trace_line(c->r[15] - 2, c->disasm);
+                }
+                return;
+            case SEMIHOST_EXIT:
+                sys_exit(status);
+        }
+        trap();
+    }
+
+    stop *st = &c->stops->list[c->stop_hit];
+    switch(st->tag) {
+        case TAG_SAVE_AT:
+            save_snapshot();
+            remove_tagged(TAG_SAVE_AT);
+            return;
+        case TAG_DEBUG_AT:
+            remove_tagged(TAG_DEBUG_AT);
+            debugger();
+            return;
+    }
+
+    print_stop(st);
+    if (save_file) {
+        save_snapshot();
+    }
+    if (hist) {
+        debugger();
+    }
+    exit(EXIT_STOPPED);
+}
+
 int main(int argc, const char* argv[])
 {
+    c = cpu_new();
+    c->want_disasm = 1;
     parse_args(argc, argv);
-    load_prog();
+    if (save_at && save_file == 0) {
+        fprintf(stderr, "--save-at needs a --save FILE to save to\n");
+        exit(1);
+    }
+    if (entry && resume_file) {
+        fprintf(stderr, "--entry cannot be used with --resume, which starts where the snapshot left off\n");
+        exit(1);
+    }
     load_asm();
+    if (code_stats) {
+        atexit(print_code_stats);
+    }
 
-    for(int i=0; i<16; i++) r[i] = 0;
-    for(int i=0; i<4; i++) special_regs[i] = 0;
+    if (resume_file) {
+        if (cpu_load(c, resume_file)) {
+            fprintf(stderr, "could not resume from %s: %s\n", resume_file, strerror(errno));
+            exit(1);
+        }
+    }
+    else {
+        load_prog();
+        if (entry) {
+            c->r[15] = parse_addr("--entry", entry);
+        }
+    }
+    if (input_file && semihost_input(input_file)) {
+        fprintf(stderr, "could not open %s: %s\n", input_file, strerror(errno));
+        exit(1);
+    }
+    if (bench_file || bench_baseline) {
+        benchmarks = bench_new(asm_listing);
+    }
+    if (coverage_file || coverage_listing) {
+        if (coverage_listing && asm_file == 0) {
+            fprintf(stderr, "--coverage-listing needs an --asm listing\n");
+            exit(1);
+        }
+        cov = coverage_new();
+        if (coverage_file && coverage_merge(cov, coverage_file) && errno != ENOENT) {
+            fprintf(stderr, "could not merge coverage from %s: %s\n", coverage_file, strerror(errno));
+            exit(1);
+        }
+        atexit(finish_coverage);
+    }
+
+    for(int i=0; i<num_stop_args; i++) {
+        if (add_stop(stop_args[i].kind, stop_args[i].spec, TAG_USER, stop_args[i].opt) < 0) {
+            exit(1);
+        }
+    }
+    if (save_at) {
+        add_internal_break(parse_addr("--save-at", save_at), TAG_SAVE_AT);
+    }
+    if (debug_at) {
+        add_internal_break(parse_addr("--debug-at", debug_at), TAG_DEBUG_AT);
+    }
 
-    const char spaces[] = "                            ";
+    if (debug || debug_at || gdb_port) {
+        hist = history_new(c, history_size, history_size);
+    }
+    if (gdb_port) {
+        serve_gdb();
+    }
+    if (debug) {
+        debugger();
+    }
 
+    if (quiet) {
+        c->want_disasm = 0;
+    }
     while(1) {
-        u16 pc = r[15];
-        u16 op = mem_rd(pc, 1);
-        if (mode_post) {
-            r[15] = pc + 2;
-            untouch_all();
-            execute(op);
-        }
-
-        trace_headers();
-        const char *label = asm_labels[pc];
-        if (label != 0) {
-            if (enable_ascii) {
-                printf("%102s.%s\n", "", label);
-            } else {
-                printf("%85s.%s\n", "", label);
+        if (limited()) {
+            if (limit_reached()) {
+                limit();
+            }
+            if (!quiet) {
+                record_pc(c->r[15]);
             }
         }
-    
-        trace_flags();
-        trace_regs();
-        printf(" %s; %s%s%s\n", 
-                attr(dark|green),
-                touched_skip ? attr_strike : "",
-                (asm_file && asm_text[pc]) ? asm_text[pc] : disasm,
-                attr_reset
-        );
-
-        if (!mode_post) {
-            r[15] = pc + 2;
-            untouch_all();
-            execute(op);
+        int why = quiet ? run() : trace_step(0);
+        if (why != RUN_LIMIT) {
+            stopped(why);
         }
     }
 }
@@ -7,7 +7,7 @@ if ! ./asm.pl "$PROGRAM" > out/asm.log; then
     exit 1
 fi
 
-if ! gcc -o ./out/sim ./sim.c >& out/gcc.log; then
+if ! gcc -o ./out/sim ./sim.c ./cpu.c ./engine.c ./stops.c ./listing.c ./history.c ./gdbstub.c ./semihost.c ./bench.c ./coverage.c >& out/gcc.log; then
     cat out/gcc.log
     exit 1
 fi
@@ -0,0 +1,458 @@
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stops.h"
+
+//------------------------------------------------------------------------------
+// Expressions
+//
+
+enum {
+    E_NUM,
+    E_REG,              // value is the register, or 16 for flags
+    E_WORD,
+    E_BYTE,
+    E_NEG,
+    E_NOT,
+    E_INV,
+    E_MUL, E_DIV, E_MOD,
+    E_ADD, E_SUB,
+    E_SHL, E_SHR,
+    E_LT, E_LE, E_GT, E_GE,
+    E_EQ, E_NE,
+    E_AND, E_XOR, E_OR,
+    E_LAND, E_LOR
+};
+
+struct expr
+{
+    int op;
+    u32 value;
+    expr *l;
+    expr *r;
+};
+
+typedef struct
+{
+    const char *p;
+    const listing *l;
+    char *err;
+    int err_size;
+    bool failed;
+} parser;
+
+static void fail(parser *ps, const char *fmt, ...)
+{
+    if (ps->failed) return;
+    ps->failed = 1;
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(ps->err, ps->err_size, fmt, ap);
+    va_end(ap);
+}
+
+static expr *node(int op, u32 value, expr *l, expr *r)
+{
+    expr *e = calloc(1, sizeof(expr));
+    e->op = op;
+    e->value = value;
+    e->l = l;
+    e->r = r;
+    return e;
+}
+
+static void expr_free(expr *e)
+{
+    if (e == 0) return;
+    expr_free(e->l);
+    expr_free(e->r);
+    free(e);
+}
+
+static void skip_space(parser *ps)
+{
+    while(isspace((u8)*ps->p)) ps->p++;
+}
+
+// Consume tok if it is next.
+static bool accept(parser *ps, const char *tok)
+{
+    skip_space(ps);
+    int n = strlen(tok);
+    if (strncmp(ps->p, tok, n)) return 0;
+    // don't take "<" from "<=" or "<<", etc
+    if (n == 1 && strchr("<>=!&|", tok[0]) && ps->p[1] && strchr("<>=&|", ps->p[1])) return 0;
+    ps->p += n;
+    return 1;
+}
+
+static bool is_ident(char ch)
+{
+    return isalnum((u8)ch) || ch == '_';
+}
+
+static expr *parse_expr(parser *ps, int prec);
+
+static expr *parse_primary(parser *ps)
+{
+    skip_space(ps);
+    const char *p = ps->p;
+
+    if (accept(ps, "(")) {
+        expr *e = parse_expr(ps, 0);
+        if (!accept(ps, ")")) fail(ps, "missing )");
+        return e;
+    }
+    if (accept(ps, "[")) {
+        expr *e = parse_expr(ps, 0);
+        if (!accept(ps, "]")) fail(ps, "missing ]");
+        return node(E_WORD, 0, e, 0);
+    }
+    if (p[0] == 'b' && p[1] == '[') {
+        ps->p += 2;
+        expr *e = parse_expr(ps, 0);
+        if (!accept(ps, "]")) fail(ps, "missing ]");
+        return node(E_BYTE, 0, e, 0);
+    }
+    if (accept(ps, "-")) return node(E_NEG, 0, parse_primary(ps), 0);
+    if (accept(ps, "!")) return node(E_NOT, 0, parse_primary(ps), 0);
+    if (accept(ps, "~")) return node(E_INV, 0, parse_primary(ps), 0);
+
+    if (isdigit((u8)*p)) {
+        char *end;
+        u32 v = strtoul(p, &end, 0);
+        ps->p = end;
+        return node(E_NUM, v, 0, 0);
+    }
+
+    int n = 0;
+    if (*p == '.') n++;
+    while(is_ident(p[n])) n++;
+    char name[128];
+    if (n == 0 || n >= (int)sizeof(name)) {
+        fail(ps, "syntax error at '%s'", p);
+        return node(E_NUM, 0, 0, 0);
+    }
+    memcpy(name, p, n);
+    name[n] = 0;
+    ps->p += n;
+
+    if (name[0] == '.') {
+        int addr = ps->l ? listing_find(ps->l, name+1) : -1;
+        if (addr < 0) fail(ps, "unknown label %s", name);
+        return node(E_NUM, addr, 0, 0);
+    }
+    if (!strcmp(name, "pc")) return node(E_REG, 15, 0, 0);
+    if (!strcmp(name, "flags")) return node(E_REG, 16, 0, 0);
+    if (name[0] == 'r') {
+        char *end;
+        long r = strtol(name+1, &end, 10);
+        if (name[1] && !*end && r >= 0 && r < 16) return node(E_REG, r, 0, 0);
+    }
+    fail(ps, "unknown name %s", name);
+    return node(E_NUM, 0, 0, 0);
+}
+
+// Binary operators by precedence, lowest first.
+static const struct {
+    const char *tok;
+    int op;
+    int prec;
+} binops[] = {
+    { "||", E_LOR,  1 },
+    { "&&", E_LAND, 2 },
+    { "|",  E_OR,   3 },
+    { "^",  E_XOR,  4 },
+    { "&",  E_AND,  5 },
+    { "==", E_EQ,   6 }, { "!=", E_NE, 6 },
+    { "<=", E_LE,   7 }, { ">=", E_GE, 7 }, { "<<", E_SHL, 8 }, { ">>", E_SHR, 8 },
+    { "<",  E_LT,   7 }, { ">",  E_GT, 7 },
+    { "+",  E_ADD,  9 }, { "-",  E_SUB, 9 },
+    { "*",  E_MUL, 10 }, { "/",  E_DIV, 10 }, { "%", E_MOD, 10 },
+};
+
+static expr *parse_expr(parser *ps, int min_prec)
+{
+    expr *l = parse_primary(ps);
+    while(!ps->failed) {
+        int found = -1;
+        for(int i=0; i<(int)(sizeof(binops)/sizeof(binops[0])); i++) {
+            if (binops[i].prec <= min_prec) continue;
+            const char *save = ps->p;
+            if (accept(ps, binops[i].tok)) {
+                found = i;
+                break;
+            }
+            ps->p = save;
+        }
+        if (found < 0) break;
+        expr *r = parse_expr(ps, binops[found].prec);
+        l = node(binops[found].op, 0, l, r);
+    }
+    return l;
+}
+
+static expr *parse(const char *text, const listing *l, char *err, int err_size)
+{
+    parser ps = { text, l, err, err_size, 0 };
+    expr *e = parse_expr(&ps, 0);
+    skip_space(&ps);
+    if (*ps.p) fail(&ps, "unexpected '%s'", ps.p);
+    if (ps.failed) {
+        expr_free(e);
+        return 0;
+    }
+    return e;
+}
+
+static u32 eval(cpu *c, const expr *e)
+{
+    switch(e->op) {
+        case E_NUM:  return e->value;
+        case E_REG:  return e->value == 16 ? c->special_regs[FLAGS] : c->r[e->value];
+        case E_WORD: return mem_rd(c, eval(c, e->l), 1);
+        case E_BYTE: return mem_rd(c, eval(c, e->l), 0);
+        case E_NEG:  return -eval(c, e->l);
+        case E_NOT:  return !eval(c, e->l);
+        case E_INV:  return ~eval(c, e->l);
+        case E_LAND: return eval(c, e->l) && eval(c, e->r);
+        case E_LOR:  return eval(c, e->l) || eval(c, e->r);
+    }
+    u32 a = eval(c, e->l);
+    u32 b = eval(c, e->r);
+    switch(e->op) {
+        case E_MUL: return a * b;
+        case E_DIV: return b ? a / b : 0;
+        case E_MOD: return b ? a % b : 0;
+        case E_ADD: return a + b;
+        case E_SUB: return a - b;
+        case E_SHL: return b < 32 ? a << b : 0;
+        case E_SHR: return b < 32 ? a >> b : 0;
+        case E_LT:  return a < b;
+        case E_LE:  return a <= b;
+        case E_GT:  return a > b;
+        case E_GE:  return a >= b;
+        case E_EQ:  return a == b;
+        case E_NE:  return a != b;
+        case E_AND: return a & b;
+        case E_XOR: return a ^ b;
+        case E_OR:  return a | b;
+    }
+    return 0;
+}
+
+// Whether e can be evaluated without a cpu.
+static bool constant(const expr *e)
+{
+    if (e == 0) return 1;
+    if (e->op == E_REG || e->op == E_WORD || e->op == E_BYTE) return 0;
+    return constant(e->l) && constant(e->r);
+}
+
+// Work out what a condition depends on: the registers it reads, and the
+// pages holding memory it reads (all of them, if the address is not fixed).
+static void depends(const expr *e, u32 *regs, u8 *pages, bool *always)
+{
+    if (e == 0) return;
+    if (e->op == E_REG) {
+        if (e->value == 15) *always = 1;
+        *regs |= 1u << e->value;
+    }
+    if (e->op == E_WORD || e->op == E_BYTE) {
+        if (constant(e->l)) {
+            u16 a = eval(0, e->l);
+            pages[a >> 8] |= WATCH_WRITE;
+            if (e->op == E_WORD) pages[(u16)(a+1) >> 8] |= WATCH_WRITE;
+        } else {
+            memset(pages, WATCH_WRITE, 256);
+        }
+    }
+    depends(e->l, regs, pages, always);
+    depends(e->r, regs, pages, always);
+}
+
+//------------------------------------------------------------------------------
+// Stops
+//
+
+stops *stops_new(void)
+{
+    return calloc(1, sizeof(stops));
+}
+
+void stops_free(stops *s)
+{
+    if (s == 0) return;
+    for(int i=0; i<s->num; i++) {
+        expr_free(s->list[i].cond);
+        free(s->list[i].text);
+    }
+    free(s->list);
+    free(s);
+}
+
+static void rebuild(stops *s)
+{
+    memset(s->breakpoint, 0, sizeof(s->breakpoint));
+    memset(s->watch_page, 0, sizeof(s->watch_page));
+    s->until_regs = 0;
+    s->until_always = 0;
+
+    for(int i=0; i<s->num; i++) {
+        const stop *st = &s->list[i];
+        u8 how = 0;
+        switch(st->kind) {
+            case STOP_BREAK:
+                s->breakpoint[st->addr >> 3] |= 1 << (st->addr & 7);
+                break;
+            case STOP_WATCH:  how = WATCH_WRITE; break;
+            case STOP_RWATCH: how = WATCH_READ; break;
+            case STOP_AWATCH: how = WATCH_READ|WATCH_WRITE; break;
+            case STOP_UNTIL:
+                depends(st->cond, &s->until_regs, s->watch_page, &s->until_always);
+                break;
+        }
+        for(int j=0; j<st->len; j++) {
+            s->watch_page[(u16)(st->addr + j) >> 8] |= how;
+        }
+    }
+
+    s->num_watch_pages = 0;
+    for(int i=0; i<256; i++) {
+        if (s->watch_page[i]) s->num_watch_pages++;
+    }
+    s->version++;
+}
+
+int stops_add(stops *s, int kind, const char *spec, const listing *l, char *err, int err_size)
+{
+    stop st = {};
+    st.kind = kind;
+
+    if (kind == STOP_UNTIL) {
+        st.cond = parse(spec, l, err, err_size);
+        if (st.cond == 0) return -1;
+    }
+    else {
+        // ADDR [if COND]
+        char buf[256];
+        snprintf(buf, sizeof(buf), "%s", spec);
+        char *cond = strstr(buf, " if ");
+        if (cond) {
+            *cond = 0;
+            st.cond = parse(cond + 4, l, err, err_size);
+            if (st.cond == 0) return -1;
+        }
+
+        const char *addr = buf;
+        while(isspace((u8)*addr)) addr++;
+        st.len = (kind == STOP_BREAK) ? 0 : 2;
+        if (kind != STOP_BREAK && addr[0] == 'b' && addr[1] == '[') {
+            st.len = 1;
+            addr += 1;
+        }
+        expr *e = parse(addr, l, err, err_size);
+        if (e == 0) {
+            expr_free(st.cond);
+            return -1;
+        }
+        // a watch on [ADDR] means the same as on ADDR
+        expr *a = (e->op == E_WORD || e->op == E_BYTE) ? e->l : e;
+        if (!constant(a)) {
+            snprintf(err, err_size, "address must be constant: %s", addr);
+            expr_free(e);
+            expr_free(st.cond);
+            return -1;
+        }
+        st.addr = eval(0, a);
+        expr_free(e);
+    }
+
+    st.id = ++s->next_id;
+    st.text = strdup(spec);
+    s->list = realloc(s->list, (s->num + 1) * sizeof(stop));
+    s->list[s->num++] = st;
+    rebuild(s);
+    return s->num - 1;
+}
+
+int stops_remove(stops *s, int id)
+{
+    for(int i=0; i<s->num; i++) {
+        if (s->list[i].id == id) {
+            expr_free(s->list[i].cond);
+            free(s->list[i].text);
+            memmove(&s->list[i], &s->list[i+1], (s->num - i - 1) * sizeof(stop));
+            s->num--;
+            rebuild(s);
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int stops_eval(cpu *c, const char *text, const listing *l, u32 *value, char *err, int err_size)
+{
+    expr *e = parse(text, l, err, err_size);
+    if (e == 0) return -1;
+    *value = eval(c, e);
+    expr_free(e);
+    return 0;
+}
+
+static bool triggered(stop *st, cpu *c)
+{
+    if (st->kind == STOP_UNTIL) {
+        // only on becoming true, not for as long as it stays true
+        bool was_true = st->was_true;
+        st->was_true = eval(c, st->cond) != 0;
+        if (was_true || !st->was_true) return 0;
+    }
+    else if (st->cond && !eval(c, st->cond)) {
+        return 0;
+    }
+    st->hits++;
+    return 1;
+}
+
+int stops_break(stops *s, cpu *c, u16 pc)
+{
+    for(int i=0; i<s->num; i++) {
+        stop *st = &s->list[i];
+        if (st->kind == STOP_BREAK && st->addr == pc && triggered(st, c)) return i;
+    }
+    return -1;
+}
+
+int stops_until(stops *s, cpu *c)
+{
+    for(int i=0; i<s->num; i++) {
+        stop *st = &s->list[i];
+        if (st->kind == STOP_UNTIL && triggered(st, c)) return i;
+    }
+    return -1;
+}
+
+int stops_access(stops *s, cpu *c, u16 addr, bool wide, bool write)
+{
+    u8 how = write ? WATCH_WRITE : WATCH_READ;
+    for(int i=0; i<s->num; i++) {
+        stop *st = &s->list[i];
+        if (st->kind == STOP_BREAK || st->kind == STOP_UNTIL) continue;
+        if (!(s->watch_page[addr >> 8] & how) && !(s->watch_page[(u16)(addr + wide) >> 8] & how)) continue;
+        u8 kind_how = st->kind == STOP_WATCH ? WATCH_WRITE : st->kind == STOP_RWATCH ? WATCH_READ : WATCH_READ|WATCH_WRITE;
+        if (!(kind_how & how)) continue;
+        for(int j=0; j <= wide; j++) {
+            u16 offset = (u16)(addr + j) - st->addr;
+            if (offset < st->len && triggered(st, c)) return i;
+        }
+    }
+    // conditions reading memory
+    if (write) {
+        return stops_until(s, c);
+    }
+    return -1;
+}
@@ -0,0 +1,106 @@
+#ifndef STOPS_H
+#define STOPS_H
+
+// Stop conditions for cpu_run(): breakpoints, watchpoints and conditions.
+//
+// None of these cost anything while running unless armed. Breakpoints are
+// patched into cpu_run()'s table of predecoded instructions. Watchpoints
+// mark the 256 byte pages they fall in, and only loads and stores look at
+// those marks. A condition is re-evaluated only after an instruction which
+// may write a register it reads, or a store into a page it reads.
+//
+// Conditions are C-like expressions over:
+//
+//      r0-r15, pc, flags   registers
+//      [EXPR]              the word at address EXPR
+//      b[EXPR]             the byte at address EXPR
+//      123, 0x7b, .label   numbers
+//
+// using the operators ! ~ - * / % + - << >> < <= > >= == != & ^ | && ||,
+// e.g. "r14 == 0xffff" or "[0xfd02] & 0x8000".
+
+#include "cpu.h"
+#include "listing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    STOP_BREAK,         // before executing the instruction at addr
+    STOP_WATCH,         // after a store to any of the bytes watched
+    STOP_RWATCH,        // after a load from any of them
+    STOP_AWATCH,        // after either
+    STOP_UNTIL          // after an instruction which makes cond become true
+};
+
+enum {
+    WATCH_READ  = 1,
+    WATCH_WRITE = 2
+};
+
+typedef struct expr expr;
+
+typedef struct stop
+{
+    int id;             // unique, never reused
+    int kind;
+    u16 addr;           // breakpoint address, or first byte watched
+    u16 len;            // bytes watched
+    expr *cond;         // 0 if unconditional
+    char *text;         // as given to stops_add()
+    int tag;            // for the caller's use
+    u64 hits;
+    bool was_true;      // STOP_UNTIL: cond when last evaluated
+} stop;
+
+typedef struct stops
+{
+    stop *list;
+    int num;
+    int next_id;
+    int version;        // incremented on every change
+
+    // derived from list
+    u8 breakpoint[65536/8];
+    u8 watch_page[256];     // WATCH_* for each page holding a watched byte
+    int num_watch_pages;
+    u32 until_regs;         // registers read by STOP_UNTIL conditions (bit 16 is flags)
+    bool until_always;      // some condition must be checked after every instruction
+} stops;
+
+stops *stops_new(void);
+void stops_free(stops *s);
+
+// Add a stop, returning its index, or -1 with a message in err.
+//
+//      STOP_BREAK                  "ADDR [if COND]"
+//      STOP_WATCH/RWATCH/AWATCH    "ADDR [if COND]" for a word, or
+//                                  "b[ADDR] [if COND]" for a byte
+//      STOP_UNTIL                  "COND"
+//
+// ADDR may be a number, or a label from l (which may be 0).
+int stops_add(stops *s, int kind, const char *spec, const listing *l, char *err, int err_size);
+
+// Remove the stop with the given id. Returns 0, or -1 if there is none.
+int stops_remove(stops *s, int id);
+
+// Evaluate a condition parsed from text, for the debugger. Returns 0, or
+// -1 with a message in err.
+int stops_eval(cpu *c, const char *text, const listing *l, u32 *value, char *err, int err_size);
+
+static inline bool stops_is_break(const stops *s, u16 addr)
+{
+    return s->breakpoint[addr >> 3] & (1 << (addr & 7));
+}
+
+// For cpu_run(): each returns the index of the stop triggered, or -1.
+int stops_break(stops *s, cpu *c, u16 pc);
+int stops_access(stops *s, cpu *c, u16 addr, bool wide, bool write);
+int stops_until(stops *s, cpu *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif